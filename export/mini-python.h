@@ -1,9 +1,121 @@
+#pragma once
+
+#include <condition_variable>
+#include <memory>
+#include <mutex>
 #include <string>
+#include <vector>
 
 namespace MiniPython {
 
+class ModuleVariable;
+class Scope;
+class ScopeImpl;
+struct CompiledScope;
+
+/**
+ * @brief A script parsed once and executed any number of times
+ *
+ * The parsed tree is never modified by run(), so a single Program
+ * can be copied and executed from several threads at the same time.
+ */
+class Program {
+public:
+    static Program fromString(const std::string &fileContent);
+    static Program fromFile(const std::string &filename);
+
+    // Execute in a temporary Interpreter
+    void run() const;
+    // Execute with globals made by Interpreter::makeGlobals()
+    void run(const std::shared_ptr<Scope> &globals) const;
+
+private:
+    Program(std::shared_ptr<const CompiledScope> _code);
+
+    std::shared_ptr<const CompiledScope> code;
+};
+
+/**
+ * @brief Builtin functions and module instances used to run programs
+ *
+ * Interpreters share no mutable state, so separate threads can run
+ * programs concurrently as long as each one uses its own Interpreter.
+ * A single Interpreter must not be used from several threads at once.
+ */
+class Interpreter {
+public:
+    Interpreter();
+
+    /**
+     * @brief Create empty global variables backed by the builtins of this interpreter
+     *
+     * Variables assigned by a script stay there, so they can be inspected
+     * or reused by the next run.
+     */
+    std::shared_ptr<Scope> makeGlobals() const;
+
+    // Global variables used by run(). They are kept until reset().
+    std::shared_ptr<Scope> globals() const;
+
+    void run(const Program &program);
+
+    /**
+     * @brief Forget the global variables and the changes made to modules
+     *
+     * Builtins and modules are not recreated, so it is much cheaper than
+     * constructing a new Interpreter.
+     */
+    void reset();
+
+private:
+    std::shared_ptr<ScopeImpl> builtins;
+    std::vector<std::shared_ptr<ModuleVariable>> modules;
+    std::shared_ptr<Scope> globalScope;
+};
+
+/**
+ * @brief A fixed number of interpreters created in advance
+ *
+ * acquire() hands out an interpreter that is not used by anybody else and
+ * waits if all of them are busy. The interpreter is reset and returned to
+ * the pool when the Lease is destroyed.
+ */
+class InterpreterPool {
+public:
+    class Lease {
+    public:
+        Lease(Lease &&other);
+        ~Lease();
+
+        Interpreter &operator*() const { return *interpreter; }
+        Interpreter *operator->() const { return interpreter; }
+
+    private:
+        friend class InterpreterPool;
+        Lease(InterpreterPool &_pool, Interpreter *_interpreter);
+
+        InterpreterPool *pool;
+        Interpreter *interpreter;
+    };
+
+    InterpreterPool(size_t size);
+
+    Lease acquire();
+
+    // Run with a fresh set of globals on any free interpreter
+    void run(const Program &program);
+
+private:
+    void release(Interpreter *interpreter);
+
+    std::vector<std::unique_ptr<Interpreter>> interpreters;
+    std::vector<Interpreter *> free;
+    std::mutex mutex;
+    std::condition_variable freed;
+};
+
 void runFromString(const std::string &fileContent);
 
 void runFromFile(const std::string &filename);
 
-} // namespace MiniPython
\ No newline at end of file
+} // namespace MiniPython
@@ -0,0 +1,82 @@
+#include "Module.h"
+
+#include <algorithm>
+
+namespace MiniPython {
+
+LazyModule::LazyModule(Factory _factory)
+    : factory(_factory)
+    {}
+
+Variable LazyModule::get_attr(const Atom &name) {
+    return module()->get_attr(name);
+}
+
+void LazyModule::set_attr(const Atom &name, Variable attr_value) {
+    module()->set_attr(name, attr_value);
+}
+
+bool LazyModule::has_attr(const Atom &name) {
+    return module()->has_attr(name);
+}
+
+void LazyModule::reset() {
+    // Nothing to reset if the module was never used
+    if (instance) {
+        instance->reset();
+    }
+}
+
+std::shared_ptr<ModuleVariable> LazyModule::module() {
+    if (!instance) {
+        instance = factory();
+    }
+    return instance;
+}
+
+bool LazyModule::is_loaded() {
+    return instance != nullptr;
+}
+
+BuiltinModule::BuiltinModule(FunctionTable _functions)
+    : functions(_functions), function_variables(_functions.size())
+    {}
+
+Variable BuiltinModule::get_attr(const Atom &name) {
+    int index = functions.find(name.str());
+    if (index < 0) {
+        return ModuleVariable::get_attr(name);
+    }
+
+    auto &variable = function_variables[index];
+    if (!variable) {
+        variable = std::make_shared<FunctionVariable>(*functions[index].function);
+    }
+    return variable;
+}
+
+void BuiltinModule::set_attr(const Atom &name, Variable attr_value) {
+    int index = functions.find(name.str());
+    if (index < 0) {
+        ModuleVariable::set_attr(name, attr_value);
+    }
+    else {
+        function_variables[index] = attr_value;
+        functions_replaced = true;
+    }
+}
+
+void BuiltinModule::reset() {
+    ModuleVariable::reset();
+    if (functions_replaced) {
+        // Created again on the next access
+        std::fill(function_variables.begin(), function_variables.end(), nullptr);
+        functions_replaced = false;
+    }
+}
+
+bool BuiltinModule::has_attr(const Atom &name) {
+    return functions.find(name.str()) >= 0 || ModuleVariable::has_attr(name);
+}
+
+} // namespace MiniPython
@@ -2,6 +2,10 @@
 
 #include "variable/Variable.h"
 
+#include <array>
+#include <cstdint>
+#include <string_view>
+
 #define PARAM(i) (params[i]->execute(scope))
 #define PARAM_DEFAULT(i, DEFAULT_VALUE) \
         ((i < params.size()) ? (PARAM(i)) : (DEFAULT_VALUE))
@@ -11,57 +15,232 @@
 
 namespace MiniPython {
 
-class array: public ModuleVariable {
+struct ModuleFunction {
+    std::string_view name;
+    FunctionType *function;
+};
+
+constexpr uint32_t function_name_hash(std::string_view name, uint32_t seed) {
+    // FNV-1a
+    uint32_t hash = 2166136261u ^ seed;
+    for (char c: name) {
+        hash = (hash ^ static_cast<uint8_t>(c)) * 16777619u;
+    }
+    // Low bits of FNV-1a depend only on low bits of the input, so mix in the high ones
+    hash ^= hash >> 15;
+    hash *= 0x85ebca6bu;
+    hash ^= hash >> 13;
+    return hash;
+}
+
+constexpr size_t function_slots_count(size_t functions_count) {
+    size_t slots = 4;
+    while (slots < 2 * functions_count) {
+        slots *= 2;
+    }
+    return slots;
+}
+
+/**
+ * @brief Module functions with a perfect hash computed by the compiler
+ *
+ * The seed is searched for at compile time until every name gets its own slot,
+ * so lookup is one hash, one slot load and one string compare.
+ */
+template<size_t N>
+struct StaticFunctionTable {
+    static_assert(N < 255, "Slots store function indexes as uint8_t");
+
+    static constexpr uint8_t EMPTY_SLOT = 0xff;
+
+    std::array<ModuleFunction, N> functions{};
+    std::array<uint8_t, function_slots_count(N)> slots{};
+    uint32_t seed = 0;
+
+    consteval StaticFunctionTable(const ModuleFunction (&_functions)[N]) {
+        for (size_t i = 0; i < N; ++i) {
+            functions[i] = _functions[i];
+        }
+
+        for (;; ++seed) {
+            slots.fill(EMPTY_SLOT);
+            bool collision = false;
+            for (size_t i = 0; i < N && !collision; ++i) {
+                auto &slot = slots[function_name_hash(functions[i].name, seed) & (slots.size() - 1)];
+                collision = (slot != EMPTY_SLOT);
+                slot = i;
+            }
+            if (!collision) {
+                break;
+            }
+        }
+    }
+};
+
+// Type-erased view of a StaticFunctionTable
+class FunctionTable {
+public:
+    template<size_t N>
+    constexpr FunctionTable(const StaticFunctionTable<N> &table)
+        : functions(table.functions.data()), functions_count(N),
+          slots(table.slots.data()), slots_mask(table.slots.size() - 1), seed(table.seed)
+        {}
+
+    // Index of the function, or -1
+    int find(std::string_view name) const {
+        uint8_t index = slots[function_name_hash(name, seed) & slots_mask];
+        if (index < functions_count && functions[index].name == name) {
+            return index;
+        }
+        return -1;
+    }
+
+    size_t size() const { return functions_count; }
+    const ModuleFunction &operator[](size_t index) const { return functions[index]; }
+
+private:
+    const ModuleFunction *functions;
+    size_t functions_count;
+    const uint8_t *slots;
+    size_t slots_mask;
+    uint32_t seed;
+};
+
+/**
+ * @brief Module whose functions are looked up in a FunctionTable
+ *
+ * FunctionVariables are created on the first access to each function,
+ * other attributes are stored as usual.
+ */
+class BuiltinModule: public ModuleVariable {
+public:
+    BuiltinModule(FunctionTable _functions);
+
+    Variable get_attr(const Atom &name) override;
+    void set_attr(const Atom &name, Variable attr_value) override;
+    bool has_attr(const Atom &name) override;
+
+    // Also puts back functions that were replaced
+    void reset() override;
+
+private:
+    FunctionTable functions;
+    std::vector<Variable> function_variables;
+    bool functions_replaced = false;
+};
+
+/**
+ * @brief Stand-in registered instead of a module until the module is used
+ *
+ * The real module is created on the first attribute access, so scripts
+ * don't pay for modules they never touch.
+ */
+class LazyModule: public ModuleVariable {
+public:
+    using Factory = std::shared_ptr<ModuleVariable> (*)();
+
+    LazyModule(Factory _factory);
+
+    Variable get_attr(const Atom &name) override;
+    void set_attr(const Atom &name, Variable attr_value) override;
+    bool has_attr(const Atom &name) override;
+
+    void reset() override;
+
+    // The real module, created if needed
+    std::shared_ptr<ModuleVariable> module();
+    bool is_loaded();
+
+private:
+    Factory factory;
+    std::shared_ptr<ModuleVariable> instance;
+};
+
+template<typename T>
+std::shared_ptr<ModuleVariable> make_module() {
+    auto module = std::make_shared<T>();
+    module->save_initial_attrs();
+    return module;
+}
+
+class array: public BuiltinModule {
 public:
     array();
 };
 
-class base64: public ModuleVariable {
+class base64: public BuiltinModule {
 public:
     base64();
 };
 
-class binascii: public ModuleVariable {
+class binascii: public BuiltinModule {
 public:
     binascii();
 
-    static std::string helper_hexlify(const std::string &data, const std::string &sep, int bytes_per_sep);
+    static std::string helper_hexlify(std::string_view data, const std::string &sep, int bytes_per_sep);
     static std::string base64_encode(const std::string &input);
     static std::string base64_decode(const std::string &input);
 };
 
-class gc: public ModuleVariable {
+class gc: public BuiltinModule {
 public:
     gc();
 };
 
+class hashlib: public BuiltinModule {
+public:
+    hashlib();
+};
 
-class ipaddress: public ModuleVariable {
+class ipaddress: public BuiltinModule {
 public:
     ipaddress();
 };
 
-class math: public ModuleVariable {
+class math: public BuiltinModule {
 public:
     math();
 };
 
-class os: public ModuleVariable {
+/**
+ * @brief os module
+ *
+ * The environment is copied when the module is created and getenv()/putenv()
+ * work on the copy, so interpreters do not see each other's changes.
+ * reset() restores the environment the module was created with.
+ * os.environ gives a copy of that snapshot, never the snapshot itself.
+ */
+class os: public BuiltinModule {
 public:
     os();
-private:
+
+    Variable get_attr(const Atom &name) override;
+    void set_attr(const Atom &name, Variable attr_value) override;
+    bool has_attr(const Atom &name) override;
+
+    void reset() override;
+
     std::shared_ptr<DictVariable> env;
+    // Copies initial_env on the first change, so reset() does not need to copy anything
+    std::shared_ptr<DictVariable> writable_env();
+private:
+    std::shared_ptr<DictVariable> initial_env;
     void make_environ();
 };
 
-class sys: public ModuleVariable {
+class sys: public BuiltinModule {
 public:
     sys();
 };
 
-class time: public ModuleVariable {
+class time: public BuiltinModule {
 public:
     time();
 };
 
+class zlib: public BuiltinModule {
+public:
+    zlib();
+};
+
 } // namespace MiniPython
@@ -15,11 +15,29 @@ Variable array_constructor(const InstructionParams &params, Scope *scope) {
 
     auto parsed_params = ParsedFunctionParamaters::parse(params, scope, schema);
 
-    return std::make_shared<ArrayVariable>(parsed_params.vars["typecode"], VAR_TO_LIST(parsed_params.vars["initializer"]));
-}
+    auto initializer = parsed_params.vars["initializer"];
+    auto result = std::make_shared<ArrayVariable>(parsed_params.vars["typecode"]);
 
-array::array() {
-    SET_FUNCTION("array", array_constructor);
+    if (initializer->get_type() == VariableType::BYTES || initializer->get_type() == VariableType::MEMORYVIEW) {
+        result->frombytes(get_buffer(initializer));
+    }
+    else if (initializer->get_type() == VariableType::ARRAY
+             && std::dynamic_pointer_cast<ArrayVariable>(initializer)->typecode() != result->typecode()) {
+        // Converted item by item, extend() only copies arrays of the same kind
+        result->extend(NEW_LIST(std::dynamic_pointer_cast<ArrayVariable>(initializer)->to_list()));
+    }
+    else {
+        result->extend(initializer);
+    }
+    return result;
 }
 
+static constexpr StaticFunctionTable array_functions({
+    {"array", array_constructor},
+});
+
+array::array()
+    : BuiltinModule(array_functions)
+    {}
+
 } // namespace MiniPython
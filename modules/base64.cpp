@@ -1,45 +1,49 @@
 #include "Module.h"
 #include "Instruction.h"
 #include "FunctionParamatersParsing.h"
+#include "RaiseException.h"
 #include "Utils.h"
+#include "File.h"
+
+#include <stdexcept>
 
 namespace MiniPython {
 
-static std::string remove_non_base64_characters(const std::string &input) {
-    std::string result;
-    for (char ch: input) {
-        bool is_base64_char = false;
+// Files are piped through in chunks of this size, so memory use stays bounded
+static constexpr size_t STREAM_CHUNK_SIZE = 64 * 1024;
 
-        if (('A' <= ch) && (ch <= 'Z')) {
-            is_base64_char = true;
-        }
-        
-        if (('a' <= ch) && (ch <= 'z')) {
-            is_base64_char = true;
-        }
-        
-        if (('0' <= ch) && (ch <= '9')) {
-            is_base64_char = true;
-        }
-        
-        if (ch == '+') {
-            is_base64_char = true;
-        }
-        
-        if (ch == '/') {
-            is_base64_char = true;
-        }
+static std::shared_ptr<FileVariable> binary_file(const Variable &var) {
+    auto file = std::dynamic_pointer_cast<FileVariable>(var);
+    if (!file || !file->binary) {
+        raise_exception("TypeError", "a file opened in binary mode is required, not '" + var->get_class_name() + "'");
+        return nullptr;
+    }
+    if (!file->fh) {
+        raise_exception("ValueError", "I/O operation on closed file.");
+    }
+    return file;
+}
 
-        if (ch == '=') {
-            is_base64_char = true;
-        }
+template <typename Codec>
+static void pipe_file(Codec &codec, const Variable &input, const Variable &output) {
+    auto in = binary_file(input);
+    auto out = binary_file(output);
 
-        if (is_base64_char) {
-            result += ch;
+    auto write = [&out](const std::string &data) {
+        if (fwrite(data.data(), 1, data.size(), out->fh) != data.size()) {
+            throw std::runtime_error("fwrite error");
         }
-    }
+    };
 
-    return result;
+    std::string chunk(STREAM_CHUNK_SIZE, '\0');
+    size_t size;
+    while ((size = fread(chunk.data(), 1, chunk.size(), in->fh)) > 0) {
+        write(codec.update(std::string_view(chunk.data(), size)));
+    }
+    if (ferror(in->fh)) {
+        throw std::runtime_error("fread error");
+    }
+    write(codec.finish());
 }
 
 static Variable decodebytes(const InstructionParams &params, Scope *scope) {
@@ -50,9 +54,9 @@ static Variable decodebytes(const InstructionParams &params, Scope *scope) {
 
     auto parsed_params = ParsedFunctionParamaters::parse(params, scope, schema);
 
-    std::string input = VAR_TO_STR(parsed_params.vars["s"]->to_bytes_variable());
-    input = remove_non_base64_characters(input);
-    return NEW_BYTES(base64_decode(input));
+    Base64Decoder decoder;
+    auto result = decoder.update(get_buffer(parsed_params.vars["s"]));
+    return NEW_BYTES(result + decoder.finish());
 }
 
 static Variable encodebytes(const InstructionParams &params, Scope *scope) {
@@ -63,24 +67,47 @@ static Variable encodebytes(const InstructionParams &params, Scope *scope) {
     
     auto parsed_params = ParsedFunctionParamaters::parse(params, scope, schema);
 
-    std::string simple_encoded = base64_encode(VAR_TO_STR(parsed_params.vars["s"]));
+    // Lines of 76 characters, each ending with a newline (RFC 2045)
+    Base64Encoder encoder(76);
+    auto result = encoder.update(get_buffer(parsed_params.vars["s"]));
+    return NEW_BYTES(result + encoder.finish());
+}
 
-    // Insert a newline every 76 bytes (RFC 2045)
-    for (size_t next_insertion_pos = 76; next_insertion_pos < simple_encoded.size(); next_insertion_pos += 77) {
-        simple_encoded.insert(next_insertion_pos, "\n");
-    }
+static Variable decode(const InstructionParams &params, Scope *scope) {
+    FunctionParameterSchema schema = {
+        {"input", "output"},
+        {}
+    };
 
-    // Ensure the input ends up with a newline (RFC 2045)
-    if (simple_encoded.size() && (simple_encoded[simple_encoded.size() - 1] != '\n')) {
-        simple_encoded += '\n';
-    }
+    auto parsed_params = ParsedFunctionParamaters::parse(params, scope, schema);
 
-    return NEW_BYTES(simple_encoded);
+    Base64Decoder decoder;
+    pipe_file(decoder, parsed_params.vars["input"], parsed_params.vars["output"]);
+    return NONE;
 }
 
-base64::base64() {
-    SET_FUNCTION("decodebytes", decodebytes);
-    SET_FUNCTION("encodebytes", encodebytes);
+static Variable encode(const InstructionParams &params, Scope *scope) {
+    FunctionParameterSchema schema = {
+        {"input", "output"},
+        {}
+    };
+
+    auto parsed_params = ParsedFunctionParamaters::parse(params, scope, schema);
+
+    Base64Encoder encoder(76);
+    pipe_file(encoder, parsed_params.vars["input"], parsed_params.vars["output"]);
+    return NONE;
 }
 
+static constexpr StaticFunctionTable base64_functions({
+    {"decode", decode},
+    {"decodebytes", decodebytes},
+    {"encode", encode},
+    {"encodebytes", encodebytes},
+});
+
+base64::base64()
+    : BuiltinModule(base64_functions)
+    {}
+
 } // namespace MiniPython
@@ -1,4 +1,5 @@
 #include "Module.h"
+#include "Checksums.h"
 #include "FunctionParamatersParsing.h"
 #include "Instruction.h"
 #include "RaiseException.h"
@@ -6,24 +7,35 @@
 
 namespace MiniPython {
 
-std::string binascii::helper_hexlify(const std::string &data, const std::string &sep, int bytes_per_sep) {
-    std::string result;
-
-    int bytes_till_sep = (bytes_per_sep > 0) ? (data.length() % bytes_per_sep) : -bytes_per_sep;
-    if (bytes_till_sep == 0) {
-        bytes_till_sep = bytes_per_sep;
+// binascii functions taking ASCII data accept str as well as bytes-like objects
+static std::string_view ascii_buffer(const Variable &var) {
+    if (var->get_type() == VariableType::STRING) {
+        return std::dynamic_pointer_cast<StringVariable>(var)->value;
     }
+    return get_buffer(var);
+}
 
-    bytes_per_sep = (bytes_per_sep > 0) ? bytes_per_sep : -bytes_per_sep;
+std::string binascii::helper_hexlify(std::string_view data, const std::string &sep, int bytes_per_sep) {
+    if ((bytes_per_sep == 0) || sep.empty() || data.empty()) {
+        return hex_encode(data);
+    }
 
-    for (const char ch: data) {
-        if ((bytes_till_sep == 0) && (bytes_per_sep != 0)) {
-            result += sep;
-            bytes_till_sep = bytes_per_sep;
+    // Groups are counted from the right for positive bytes_per_sep
+    size_t group_size = std::abs(bytes_per_sep);
+    size_t groups = (data.size() + group_size - 1) / group_size;
+    size_t first_group_size = (bytes_per_sep > 0) ? data.size() - (groups - 1) * group_size : group_size;
+
+    std::string result(2 * data.size() + (groups - 1) * sep.size(), '\0');
+    char *output = result.data();
+    size_t group_start = 0;
+    for (size_t group = 0; group < groups; ++group) {
+        if (group != 0) {
+            output = std::copy(sep.begin(), sep.end(), output);
         }
-        bytes_till_sep--;
-
-        result += byte_to_hex(ch);
+        size_t size = std::min((group == 0) ? first_group_size : group_size, data.size() - group_start);
+        hex_encode(data.substr(group_start, size), output);
+        output += 2 * size;
+        group_start += size;
     }
 
     return result;
@@ -39,7 +51,7 @@ static Variable hexlify(const InstructionParams &params, Scope *scope) {
     };
 
     auto parsed_params = ParsedFunctionParamaters::parse(params, scope, schema);
-    auto data = VAR_TO_BYTES(parsed_params.vars["data"]);
+    auto data = get_buffer(parsed_params.vars["data"]);
     auto sep = VAR_TO_STR(parsed_params.vars["sep"]);
     auto bytes_per_sep = VAR_TO_INT(parsed_params.vars["bytes_per_sep"]);
 
@@ -47,8 +59,8 @@ static Variable hexlify(const InstructionParams &params, Scope *scope) {
 }
 
 static Variable unhexlify(const InstructionParams &params, Scope *scope) {
-    auto hexstr = VAR_TO_STR(PARAM(0));
-    return NEW_BYTES(str_from_hex_str(hexstr));
+    auto hexstr = PARAM(0);
+    return NEW_BYTES(str_from_hex_str(ascii_buffer(hexstr)));
 }
 
 static Variable b2a_base64(const InstructionParams &params, Scope *scope) {
@@ -60,7 +72,7 @@ static Variable b2a_base64(const InstructionParams &params, Scope *scope) {
     };
 
     auto parsed_params = ParsedFunctionParamaters::parse(params, scope, schema);
-    auto data = VAR_TO_BYTES(parsed_params.vars["data"]);
+    auto data = get_buffer(parsed_params.vars["data"]);
     auto newline = parsed_params.vars["newline"]->to_bool() ? "\n" : "";
 
     return NEW_BYTES(base64_encode(data) + newline);
@@ -73,7 +85,7 @@ static Variable a2b_base64(const InstructionParams &params, Scope *scope) {
     };
 
     auto parsed_params = ParsedFunctionParamaters::parse(params, scope, schema);
-    auto string = VAR_TO_STR(parsed_params.vars["string"]);
+    auto string = ascii_buffer(parsed_params.vars["string"]);
     auto strict_mode = parsed_params.vars["strict_mode"]->to_bool();
 
     if (strict_mode) {
@@ -86,7 +98,7 @@ static Variable a2b_base64(const InstructionParams &params, Scope *scope) {
         }
 
         size_t last_padding_pos = string.rfind('=');
-        if ((last_padding_pos != std::string::npos) && (last_padding_pos != string.size() - 1)) {
+        if ((last_padding_pos != std::string_view::npos) && (last_padding_pos != string.size() - 1)) {
             raise_exception("binascii.Error", "Discontinuous padding not allowed");
         }
     }
@@ -94,14 +106,45 @@ static Variable a2b_base64(const InstructionParams &params, Scope *scope) {
     return NEW_BYTES(base64_decode(string));
 }
 
-binascii::binascii() {
-    SET_FUNCTION("hexlify", hexlify);
-    SET_FUNCTION("b2a_hex", hexlify);
-    SET_FUNCTION("unhexlify", unhexlify);
-    SET_FUNCTION("a2b_hex", unhexlify);
+static Variable crc32(const InstructionParams &params, Scope *scope) {
+    FunctionParameterSchema schema = {
+        {"data", "crc"},
+        {{"crc", NEW_INT(0)}}
+    };
+
+    auto parsed_params = ParsedFunctionParamaters::parse(params, scope, schema);
+    auto data = get_buffer(parsed_params.vars["data"]);
+    auto crc = static_cast<uint32_t>(VAR_TO_INT(parsed_params.vars["crc"]));
+
+    return NEW_INT(static_cast<IntType>(Checksums::crc32(data, crc)));
+}
+
+static Variable crc_hqx(const InstructionParams &params, Scope *scope) {
+    FunctionParameterSchema schema = {
+        {"data", "crc"},
+        {}
+    };
+
+    auto parsed_params = ParsedFunctionParamaters::parse(params, scope, schema);
+    auto data = get_buffer(parsed_params.vars["data"]);
+    auto crc = static_cast<uint16_t>(VAR_TO_INT(parsed_params.vars["crc"]));
 
-    SET_FUNCTION("b2a_base64", b2a_base64);
-    SET_FUNCTION("a2b_base64", a2b_base64);
+    return NEW_INT(static_cast<IntType>(Checksums::crc_hqx(data, crc)));
 }
 
+static constexpr StaticFunctionTable binascii_functions({
+    {"hexlify", hexlify},
+    {"b2a_hex", hexlify},
+    {"unhexlify", unhexlify},
+    {"a2b_hex", unhexlify},
+    {"b2a_base64", b2a_base64},
+    {"a2b_base64", a2b_base64},
+    {"crc32", crc32},
+    {"crc_hqx", crc_hqx},
+});
+
+binascii::binascii()
+    : BuiltinModule(binascii_functions)
+    {}
+
 } // namespace MiniPython
@@ -7,9 +7,13 @@ static Variable do_nothing(const InstructionParams &params, Scope *scope) {
     return NONE;
 }
 
-gc::gc() {
-    SET_FUNCTION("enable", do_nothing);
-    SET_FUNCTION("disable", do_nothing);
-}
+static constexpr StaticFunctionTable gc_functions({
+    {"enable", do_nothing},
+    {"disable", do_nothing},
+});
+
+gc::gc()
+    : BuiltinModule(gc_functions)
+    {}
 
 } // namespace MiniPython
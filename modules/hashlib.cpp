@@ -0,0 +1,80 @@
+#include "Module.h"
+#include "FunctionParamatersParsing.h"
+#include "Hashing.h"
+#include "Instruction.h"
+#include "RaiseException.h"
+#include "Hash.h"
+
+namespace MiniPython {
+
+static Variable make_hash(std::unique_ptr<Hashing::Hash> hash, const Variable &data) {
+    hash->update(get_buffer(data));
+    return std::make_shared<HashVariable>(std::move(hash));
+}
+
+template<std::unique_ptr<Hashing::Hash> (*CONSTRUCTOR)()>
+static Variable constructor(const InstructionParams &params, Scope *scope) {
+    FunctionParameterSchema schema = {
+        {"data"},
+        {{"data", NEW_BYTES("")}}
+    };
+
+    auto parsed_params = ParsedFunctionParamaters::parse(params, scope, schema);
+    return make_hash(CONSTRUCTOR(), parsed_params.vars["data"]);
+}
+
+static Variable blake2b(const InstructionParams &params, Scope *scope) {
+    FunctionParameterSchema schema = {
+        {"data", "digest_size", "key"},
+        {
+            {"data", NEW_BYTES("")},
+            {"digest_size", NEW_INT(64)},
+            {"key", NEW_BYTES("")},
+        }
+    };
+
+    auto parsed_params = ParsedFunctionParamaters::parse(params, scope, schema);
+    auto digest_size = VAR_TO_INT(parsed_params.vars["digest_size"]);
+    auto key = get_buffer(parsed_params.vars["key"]);
+    if (digest_size < 1 || digest_size > 64) {
+        raise_exception("ValueError", "digest_size must be between 1 and 64 bytes");
+        return NONE;
+    }
+    if (key.size() > 64) {
+        raise_exception("ValueError", "maximum key length is 64 bytes");
+        return NONE;
+    }
+
+    return make_hash(Hashing::blake2b(digest_size, key), parsed_params.vars["data"]);
+}
+
+static Variable new_hash(const InstructionParams &params, Scope *scope) {
+    FunctionParameterSchema schema = {
+        {"name", "data"},
+        {{"data", NEW_BYTES("")}}
+    };
+
+    auto parsed_params = ParsedFunctionParamaters::parse(params, scope, schema);
+    auto name = VAR_TO_STR(parsed_params.vars["name"]);
+    auto hash = Hashing::by_name(name);
+    if (!hash) {
+        raise_exception("ValueError", "unsupported hash type " + name);
+        return NONE;
+    }
+
+    return make_hash(std::move(hash), parsed_params.vars["data"]);
+}
+
+static constexpr StaticFunctionTable hashlib_functions({
+    {"md5", constructor<Hashing::md5>},
+    {"sha1", constructor<Hashing::sha1>},
+    {"sha256", constructor<Hashing::sha256>},
+    {"blake2b", blake2b},
+    {"new", new_hash},
+});
+
+hashlib::hashlib()
+    : BuiltinModule(hashlib_functions)
+    {}
+
+} // namespace MiniPython
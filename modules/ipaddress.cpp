@@ -23,8 +23,12 @@ Variable v4_int_to_packed(const InstructionParams &params, Scope *scope) {
     return NEW_BYTES(result);
 }
 
-ipaddress::ipaddress() {
-    SET_FUNCTION("v4_int_to_packed", v4_int_to_packed);
-}
+static constexpr StaticFunctionTable ipaddress_functions({
+    {"v4_int_to_packed", v4_int_to_packed},
+});
+
+ipaddress::ipaddress()
+    : BuiltinModule(ipaddress_functions)
+    {}
 
 } // namespace MiniPython
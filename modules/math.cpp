@@ -1,6 +1,7 @@
 #include "Module.h"
 #include "Instruction.h"
 #include "RaiseException.h"
+#include "MathKernels.h"
 
 #include <cmath>
 
@@ -11,7 +12,7 @@ double to_float(Variable x) {
         return x->to_bool() ? 1 : 0;
     }
     else if (x->get_type() == VariableType::INT) {
-        return std::dynamic_pointer_cast<IntVariable>(x)->value;
+        return std::dynamic_pointer_cast<IntVariable>(x)->to_float();
     }
     else if (x->get_type() == VariableType::FLOAT) {
         return std::dynamic_pointer_cast<FloatVariable>(x)->value;
@@ -21,9 +22,58 @@ double to_float(Variable x) {
     }
 }
 
+// Ints are already integral, floats are rounded and converted without going through IntType
+static Variable to_integral(const Variable &x, double (*round)(double)) {
+    if (x->get_type() == VariableType::INT) {
+        return x;
+    }
+    if (x->get_type() == VariableType::BOOL) {
+        return NEW_INT(x->to_int());
+    }
+
+    double value = round(to_float(x));
+    if (std::isinf(value)) {
+        raise_exception("OverflowError", "cannot convert float infinity to integer");
+    }
+    if (std::isnan(value)) {
+        raise_exception("ValueError", "cannot convert float NaN to integer");
+    }
+    if (std::fabs(value) < 0x1p63) {
+        return NEW_INT(IntType(value));
+    }
+    // Beyond 2**63 the double is a 53-bit mantissa shifted left
+    int exponent;
+    double mantissa = std::frexp(value, &exponent);
+    return NEW_INT(BigInt(IntType(std::ldexp(mantissa, 53))) * BigInt::pow(2, exponent - 53));
+}
+
+// Lists and arrays are unboxed once and mapped by the vector kernel into an array('d')
+static Variable map_float(const Variable &x, MathKernels::Kernel kernel, double (*function)(double)) {
+    if (x->get_type() != VariableType::LIST && x->get_type() != VariableType::ARRAY) {
+        return NEW_FLOAT(function(to_float(x)));
+    }
+
+    auto result = std::make_shared<ArrayVariable>(NEW_STRING("d"));
+    auto array = std::dynamic_pointer_cast<ArrayVariable>(x);
+    if (array && array->typecode() == 'd') {
+        result->resize(array->size());
+        kernel(array->items<double>(), result->items<double>(), array->size());
+        return result;
+    }
+
+    auto items = std::dynamic_pointer_cast<IterableVariable>(x)->to_list();
+    result->resize(items.size());
+    auto values = result->items<double>();
+    for (size_t i = 0; i < items.size(); ++i) {
+        values[i] = to_float(items[i]);
+    }
+    kernel(values, values, items.size());
+    return result;
+}
+
 static Variable ceil(const InstructionParams &params, Scope *scope) {
     auto x = PARAM(0);
-    return NEW_INT(::ceil(to_float(x)));
+    return to_integral(x, ::ceil);
 }
 
 static Variable copysign(const InstructionParams &params, Scope *scope) {
@@ -35,30 +85,50 @@ static Variable copysign(const InstructionParams &params, Scope *scope) {
 
 static Variable fabs(const InstructionParams &params, Scope *scope) {
     auto x = PARAM(0);
-    return NEW_INT(::fabs(to_float(x)));
+    return NEW_FLOAT(::fabs(to_float(x)));
+}
+
+// Product of [from, to), split in halves so the big multiplications get operands of similar size
+static BigInt range_product(IntType from, IntType to) {
+    if (to - from <= 8) {
+        BigInt result = 1;
+        for (IntType i = from; i < to; ++i) {
+            result = result * i;
+        }
+        return result;
+    }
+    auto middle = from + (to - from) / 2;
+    return range_product(from, middle) * range_product(middle, to);
 }
 
 static Variable factorial(const InstructionParams &params, Scope *scope) {
     auto x = PARAM(0);
-    unsigned long long res = 1;
-    for (size_t i = 0; i < to_float(x) + 1; ++i) {
-        res *= i;
+    if (x->get_type() != VariableType::INT && x->get_type() != VariableType::BOOL) {
+        raise_exception("TypeError", "factorial() only accepts integral values");
+    }
+    if (x->to_int() < 0) {
+        raise_exception("ValueError", "factorial() not defined for negative values");
     }
-    return NEW_INT(res);
+    return NEW_INT(range_product(2, x->to_int() + 1));
 }
 
 static Variable floor(const InstructionParams &params, Scope *scope) {
     auto x = PARAM(0);
-    return NEW_INT(::floor(to_float(x)));
+    return to_integral(x, ::floor);
 }
 
 static Variable fsum(const InstructionParams &params, Scope *scope) {
     auto x = PARAM(0);
-    double res = 0;
-    for (auto &x: std::dynamic_pointer_cast<IterableVariable>(x)->to_list()) {
-        res += to_float(x);
+    auto array = std::dynamic_pointer_cast<ArrayVariable>(x);
+    if (array && array->typecode() == 'd') {
+        return NEW_FLOAT(MathKernels::fsum(array->items<double>(), array->size()));
     }
-    return NEW_FLOAT(res);
+
+    std::vector<double> values;
+    for (auto &item: std::dynamic_pointer_cast<IterableVariable>(x)->to_list()) {
+        values.push_back(to_float(item));
+    }
+    return NEW_FLOAT(MathKernels::fsum(values.data(), values.size()));
 }
 
 static Variable isfinite(const InstructionParams &params, Scope *scope) {
@@ -76,14 +146,51 @@ static Variable isnan(const InstructionParams &params, Scope *scope) {
     return NEW_BOOL(std::isnan(to_float(x)));
 }
 
+// Newton's iteration from a power of two above the root, it decreases until it reaches the floor
+static BigInt big_isqrt(const BigInt &n) {
+    BigInt root = BigInt::pow(2, (n.bit_length() + 1) / 2);
+    while (true) {
+        BigInt quotient, remainder, next;
+        BigInt::floor_divmod(n, root, quotient, remainder);
+        BigInt::floor_divmod(root + quotient, 2, next, remainder);
+        if (!(next < root)) {
+            return root;
+        }
+        root = next;
+    }
+}
+
 static Variable isqrt(const InstructionParams &params, Scope *scope) {
     auto x = PARAM(0);
-    return NEW_INT(::floor(::sqrt(to_float(x))));
+    if (x->get_type() != VariableType::INT && x->get_type() != VariableType::BOOL) {
+        raise_exception("TypeError", "isqrt() only accepts integral values");
+    }
+    auto n = x->get_type() == VariableType::INT ? std::dynamic_pointer_cast<IntVariable>(x)->to_big() : BigInt(x->to_int());
+    if (n.is_negative()) {
+        raise_exception("ValueError", "isqrt() argument must be nonnegative");
+    }
+    if (n.is_zero()) {
+        return NEW_INT(0);
+    }
+    if (!n.fits_int64()) {
+        return NEW_INT(big_isqrt(n));
+    }
+
+    // The double root is off by at most one
+    auto value = uint64_t(n.to_int64());
+    auto root = uint64_t(::sqrt(double(value)));
+    while (root * root > value) {
+        --root;
+    }
+    while ((root + 1) * (root + 1) <= value) {
+        ++root;
+    }
+    return NEW_INT(IntType(root));
 }
 
 static Variable trunc(const InstructionParams &params, Scope *scope) {
     auto x = PARAM(0);
-    return NEW_INT(::trunc(to_float(x)));
+    return to_integral(x, ::trunc);
 }
 
 static Variable cbrt(const InstructionParams &params, Scope *scope) {
@@ -93,7 +200,7 @@ static Variable cbrt(const InstructionParams &params, Scope *scope) {
 
 static Variable exp(const InstructionParams &params, Scope *scope) {
     auto x = PARAM(0);
-    return NEW_FLOAT(::exp(to_float(x)));
+    return map_float(x, MathKernels::exp, ::exp);
 }
 
 static Variable exp2(const InstructionParams &params, Scope *scope) {
@@ -108,7 +215,7 @@ static Variable expm1(const InstructionParams &params, Scope *scope) {
 
 static Variable log(const InstructionParams &params, Scope *scope) {
     auto x = PARAM(0);
-    return NEW_FLOAT(::log(to_float(x)));
+    return map_float(x, MathKernels::log, ::log);
 }
 
 static Variable log1p(const InstructionParams &params, Scope *scope) {
@@ -134,7 +241,7 @@ static Variable math_pow(const InstructionParams &params, Scope *scope) {
 
 static Variable sqrt(const InstructionParams &params, Scope *scope) {
     auto x = PARAM(0);
-    return NEW_FLOAT(::sqrt(to_float(x)));
+    return map_float(x, MathKernels::sqrt, ::sqrt);
 }
 
 static Variable acos(const InstructionParams &params, Scope *scope) {
@@ -160,7 +267,17 @@ static Variable atan2(const InstructionParams &params, Scope *scope) {
 
 static Variable cos(const InstructionParams &params, Scope *scope) {
     auto x = PARAM(0);
-    return NEW_FLOAT(::cos(to_float(x)));
+    return map_float(x, MathKernels::cos, ::cos);
+}
+
+static Variable sin(const InstructionParams &params, Scope *scope) {
+    auto x = PARAM(0);
+    return map_float(x, MathKernels::sin, ::sin);
+}
+
+static Variable tan(const InstructionParams &params, Scope *scope) {
+    auto x = PARAM(0);
+    return map_float(x, MathKernels::tan, ::tan);
 }
 
 static long double pi = 3.141592653589793238462643383279502884197;
@@ -205,42 +322,48 @@ static Variable tanh(const InstructionParams &params, Scope *scope) {
     return NEW_FLOAT(::tanh(to_float(x)));
 }
 
-math::math() {
-    SET_FUNCTION("ceil", ceil);
-    SET_FUNCTION("copysign", copysign);
-    SET_FUNCTION("fabs", fabs);
-    SET_FUNCTION("factorial", factorial);
-    SET_FUNCTION("floor", floor);
-    SET_FUNCTION("fsum", fsum);
-    SET_FUNCTION("isfinite", isfinite);
-    SET_FUNCTION("isinf", isinf);
-    SET_FUNCTION("isnan", isnan);
-    SET_FUNCTION("isqrt", isqrt);
-    SET_FUNCTION("trunc", trunc);
-    SET_FUNCTION("cbrt", cbrt);
-    SET_FUNCTION("exp", exp);
-    SET_FUNCTION("exp2", exp2);
-    SET_FUNCTION("expm1", expm1);
-    SET_FUNCTION("log", log);
-    SET_FUNCTION("log1p", log1p);
-    SET_FUNCTION("log2", log2);
-    SET_FUNCTION("log10", log10);
-    SET_FUNCTION("pow", math_pow);
-    SET_FUNCTION("sqrt", sqrt);
-    SET_FUNCTION("acos", acos);
-    SET_FUNCTION("asin", asin);
-    SET_FUNCTION("atan", atan);
-    SET_FUNCTION("atan2", atan2);
-    SET_FUNCTION("cos", cos);
-    SET_FUNCTION("degrees", degrees);
-    SET_FUNCTION("radians", radians);
-    SET_FUNCTION("acosh", acosh);
-    SET_FUNCTION("asinh", asinh);
-    SET_FUNCTION("atanh", atanh);
-    SET_FUNCTION("cosh", cosh);
-    SET_FUNCTION("sinh", sinh);
-    SET_FUNCTION("tanh", tanh);
-
+static constexpr StaticFunctionTable math_functions({
+    {"ceil", ceil},
+    {"copysign", copysign},
+    {"fabs", fabs},
+    {"factorial", factorial},
+    {"floor", floor},
+    {"fsum", fsum},
+    {"isfinite", isfinite},
+    {"isinf", isinf},
+    {"isnan", isnan},
+    {"isqrt", isqrt},
+    {"trunc", trunc},
+    {"cbrt", cbrt},
+    {"exp", exp},
+    {"exp2", exp2},
+    {"expm1", expm1},
+    {"log", log},
+    {"log1p", log1p},
+    {"log2", log2},
+    {"log10", log10},
+    {"pow", math_pow},
+    {"sqrt", sqrt},
+    {"acos", acos},
+    {"asin", asin},
+    {"atan", atan},
+    {"atan2", atan2},
+    {"cos", cos},
+    {"sin", sin},
+    {"tan", tan},
+    {"degrees", degrees},
+    {"radians", radians},
+    {"acosh", acosh},
+    {"asinh", asinh},
+    {"atanh", atanh},
+    {"cosh", cosh},
+    {"sinh", sinh},
+    {"tanh", tanh},
+});
+
+math::math()
+    : BuiltinModule(math_functions)
+{
     set_attr("pi", NEW_FLOAT(pi));
     set_attr("e", NEW_FLOAT(2.718281828459045));
 }
@@ -2,11 +2,12 @@
 #include "Instruction.h"
 #include "FunctionParamatersParsing.h"
 #include "RaiseException.h"
+#include "Scope.h"
 
 #include <cstdio>
 #include <cstdlib>
 #include <filesystem>
-#include <stdlib.h>
+#include <random>
 #include <unistd.h>
 
 namespace fs = std::filesystem;
@@ -16,7 +17,7 @@ extern char **environ;
 namespace MiniPython {
 
 void os::make_environ() {
-    env = std::make_shared<DictVariable>();
+    initial_env = std::make_shared<DictVariable>();
 
     char **c_str = environ;
     for (; *c_str; c_str++) {
@@ -24,10 +25,47 @@ void os::make_environ() {
         size_t pos = str.find('=');
         std::string key = str.substr(0, pos);
         std::string value = str.substr(pos + 1);
-        env->set_item(NEW_STRING(key), NEW_STRING(value));
+        initial_env->set_item(NEW_STRING(key), NEW_STRING(value));
     }
 }
 
+std::shared_ptr<DictVariable> os::writable_env() {
+    if (env == initial_env) {
+        env = std::dynamic_pointer_cast<DictVariable>(initial_env->copy());
+    }
+    return env;
+}
+
+// environ is not stored as an attribute: whoever gets it may change it
+Variable os::get_attr(const Atom &name) {
+    if (name.str() == "environ") {
+        return writable_env();
+    }
+    return BuiltinModule::get_attr(name);
+}
+
+void os::set_attr(const Atom &name, Variable attr_value) {
+    if (name.str() == "environ" && attr_value->get_type() == VariableType::DICT) {
+        env = std::static_pointer_cast<DictVariable>(attr_value);
+        return;
+    }
+    BuiltinModule::set_attr(name, attr_value);
+}
+
+bool os::has_attr(const Atom &name) {
+    return name.str() == "environ" || BuiltinModule::has_attr(name);
+}
+
+void os::reset() {
+    BuiltinModule::reset();
+    env = initial_env;
+}
+
+static std::shared_ptr<os> os_module(Scope *scope) {
+    auto module = std::dynamic_pointer_cast<LazyModule>(scope->getBuiltin("os"))->module();
+    return std::dynamic_pointer_cast<os>(module);
+}
+
 static Variable getenv(const InstructionParams &params, Scope *scope) {
     FunctionParameterSchema schema = {
         {"key", "default"},
@@ -39,11 +77,7 @@ static Variable getenv(const InstructionParams &params, Scope *scope) {
     PARSE_ARG(key);
     auto default_value = parsed_params.vars["default"];
 
-    char *value = std::getenv(std::dynamic_pointer_cast<StringVariable>(key)->value.c_str());
-    if (!value) {
-        return default_value;
-    }
-    return std::make_shared<StringVariable>(value);
+    return os_module(scope)->env->get(key, default_value);
 }
 
 static Variable putenv(const InstructionParams &params, Scope *scope) {
@@ -57,9 +91,7 @@ static Variable putenv(const InstructionParams &params, Scope *scope) {
     PARSE_ARG(key);
     PARSE_ARG(value);
 
-    setenv(std::dynamic_pointer_cast<StringVariable>(key)->value.c_str(),
-           std::dynamic_pointer_cast<StringVariable>(value)->value.c_str(),
-           true);
+    os_module(scope)->writable_env()->set_item(key, value);
     return NONE;
 }
 
@@ -73,7 +105,10 @@ static Variable unsetenv(const InstructionParams &params, Scope *scope) {
 
     PARSE_ARG(key);
 
-    ::unsetenv(std::dynamic_pointer_cast<StringVariable>(key)->value.c_str());
+    auto module = os_module(scope);
+    if (module->env->get(key, OBJECT_NOT_FOUND) != OBJECT_NOT_FOUND) {
+        module->writable_env()->pop(key);
+    }
     return NONE;
 }
 
@@ -247,36 +282,44 @@ static Variable system(const InstructionParams &params, Scope *scope) {
 
 static Variable urandom(const InstructionParams &params, Scope *scope) {
     FunctionParameterSchema schema = {
-        {"cmd"},
+        {"size"},
         {}
     };
 
     auto parsed_params = ParsedFunctionParamaters::parse(params, scope, schema);
     PARSE_ARG(size);
 
+    std::random_device device;
     std::string res;
     for (size_t i = 0; i < VAR_TO_INT(size); ++i) {
-        res += char(rand());
+        res += char(device());
     }
-    return NEW_STRING(res);
+    return NEW_BYTES(res);
 }
 
-os::os() {
-    SET_FUNCTION("getenv", getenv);
-    SET_FUNCTION("putenv", putenv);
-    SET_FUNCTION("unsetenv", unsetenv);
-    SET_FUNCTION("getcwd", getcwd);
-    SET_FUNCTION("chdir", chdir);
-    SET_FUNCTION("listdir", listdir);
-    SET_FUNCTION("mkdir", mkdir);
-    SET_FUNCTION("makedirs", makedirs);
-    SET_FUNCTION("readlink", readlink);
-    SET_FUNCTION("remove", remove);
-    SET_FUNCTION("rmdir", rmdir);
-    SET_FUNCTION("removedirs", removedirs);
-    SET_FUNCTION("rename", rename);
-    SET_FUNCTION("system", system);
-    SET_FUNCTION("urandom", urandom);
+static constexpr StaticFunctionTable os_functions({
+    {"getenv", getenv},
+    {"putenv", putenv},
+    {"unsetenv", unsetenv},
+    {"getcwd", getcwd},
+    {"chdir", chdir},
+    {"listdir", listdir},
+    {"mkdir", mkdir},
+    {"makedirs", makedirs},
+    {"readlink", readlink},
+    {"remove", remove},
+    {"rmdir", rmdir},
+    {"removedirs", removedirs},
+    {"rename", rename},
+    {"system", system},
+    {"urandom", urandom},
+});
+
+os::os()
+    : BuiltinModule(os_functions)
+{
+    make_environ();
+    env = initial_env;
 
 #ifdef _WIN32
     set_attr("devnull", NEW_STRING("nul"));
@@ -289,7 +332,6 @@ os::os() {
     set_attr("linesep", NEW_STRING("\n"));
     set_attr("pathsep", NEW_STRING(":"));
 #endif
-
 }
 
 } // namespace MiniPython
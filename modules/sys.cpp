@@ -11,8 +11,12 @@ static Variable exit(const InstructionParams &params, Scope *scope) {
     return NONE;
 }
 
-sys::sys() {
-    SET_FUNCTION("exit", exit);
-}
+static constexpr StaticFunctionTable sys_functions({
+    {"exit", exit},
+});
+
+sys::sys()
+    : BuiltinModule(sys_functions)
+    {}
 
 } // namespace MiniPython
@@ -39,10 +39,14 @@ static Variable sleep(const InstructionParams &params, Scope *scope) {
     return NONE;
 }
 
-time::time() {
-    SET_FUNCTION("time", time_func);
-    SET_FUNCTION("time_ns", time_ns);
-    SET_FUNCTION("sleep", sleep);
-}
+static constexpr StaticFunctionTable time_functions({
+    {"time", time_func},
+    {"time_ns", time_ns},
+    {"sleep", sleep},
+});
+
+time::time()
+    : BuiltinModule(time_functions)
+    {}
 
 } // namespace MiniPython
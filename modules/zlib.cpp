@@ -0,0 +1,43 @@
+#include "Module.h"
+#include "Checksums.h"
+#include "FunctionParamatersParsing.h"
+#include "Instruction.h"
+
+namespace MiniPython {
+
+static Variable adler32(const InstructionParams &params, Scope *scope) {
+    FunctionParameterSchema schema = {
+        {"data", "value"},
+        {{"value", NEW_INT(1)}}
+    };
+
+    auto parsed_params = ParsedFunctionParamaters::parse(params, scope, schema);
+    auto data = get_buffer(parsed_params.vars["data"]);
+    auto value = static_cast<uint32_t>(VAR_TO_INT(parsed_params.vars["value"]));
+
+    return NEW_INT(static_cast<IntType>(Checksums::adler32(data, value)));
+}
+
+static Variable crc32(const InstructionParams &params, Scope *scope) {
+    FunctionParameterSchema schema = {
+        {"data", "value"},
+        {{"value", NEW_INT(0)}}
+    };
+
+    auto parsed_params = ParsedFunctionParamaters::parse(params, scope, schema);
+    auto data = get_buffer(parsed_params.vars["data"]);
+    auto value = static_cast<uint32_t>(VAR_TO_INT(parsed_params.vars["value"]));
+
+    return NEW_INT(static_cast<IntType>(Checksums::crc32(data, value)));
+}
+
+static constexpr StaticFunctionTable zlib_functions({
+    {"adler32", adler32},
+    {"crc32", crc32},
+});
+
+zlib::zlib()
+    : BuiltinModule(zlib_functions)
+    {}
+
+} // namespace MiniPython
@@ -0,0 +1,310 @@
+#include "Checksums.h"
+#include "Utils.h"
+
+#include <algorithm>
+#include <array>
+#include <cstring>
+#include <immintrin.h>
+
+namespace MiniPython {
+
+namespace Checksums {
+
+#define SSSE3 __attribute__((target("ssse3")))
+#define AVX2 __attribute__((target("avx2")))
+#define PCLMUL __attribute__((target("sse4.1,pclmul")))
+
+static uint32_t load32(const unsigned char *data) {
+    uint32_t value;
+    std::memcpy(&value, data, sizeof(value));
+    return value;
+}
+
+/*
+ * crc32
+ *
+ * Slicing-by-8: table k gives the CRC of a byte followed by k zero bytes, so
+ * eight bytes are folded in with eight independent lookups.
+ */
+
+using Crc32Tables = std::array<std::array<uint32_t, 256>, 8>;
+
+static constexpr Crc32Tables make_crc32_tables() {
+    Crc32Tables tables{};
+    for (uint32_t i = 0; i < 256; ++i) {
+        uint32_t crc = i;
+        for (int bit = 0; bit < 8; ++bit) {
+            crc = (crc >> 1) ^ ((crc & 1) ? 0xedb88320 : 0);
+        }
+        tables[0][i] = crc;
+    }
+    for (size_t k = 1; k < tables.size(); ++k) {
+        for (uint32_t i = 0; i < 256; ++i) {
+            uint32_t previous = tables[k - 1][i];
+            tables[k][i] = (previous >> 8) ^ tables[0][previous & 0xff];
+        }
+    }
+    return tables;
+}
+
+static constexpr Crc32Tables CRC32_TABLES = make_crc32_tables();
+
+// Works on the inverted CRC
+static uint32_t crc32_tables(const unsigned char *data, size_t size, uint32_t crc) {
+    auto &t = CRC32_TABLES;
+    // Byte order of the loads assumes little endian, as the vector code does
+    for (; size >= 8; data += 8, size -= 8) {
+        uint32_t one = load32(data) ^ crc;
+        uint32_t two = load32(data + 4);
+        crc = t[7][one & 0xff] ^ t[6][(one >> 8) & 0xff] ^ t[5][(one >> 16) & 0xff] ^ t[4][one >> 24]
+              ^ t[3][two & 0xff] ^ t[2][(two >> 8) & 0xff] ^ t[1][(two >> 16) & 0xff] ^ t[0][two >> 24];
+    }
+    for (; size; ++data, --size) {
+        crc = (crc >> 8) ^ t[0][(crc ^ *data) & 0xff];
+    }
+    return crc;
+}
+
+/*
+ * Folding with carry-less multiplication, from Gopal et al., "Fast CRC
+ * Computation for Generic Polynomials Using PCLMULQDQ Instruction" (Intel).
+ * Four 128-bit lanes are folded 64 bytes forward at a time, then into one
+ * lane, then reduced to 32 bits with Barrett reduction. The constants are the
+ * bit-reflected ones for the zlib polynomial given in the paper.
+ *
+ * Needs at least 64 bytes and consumes a multiple of 16; works on the
+ * inverted CRC.
+ */
+static __m128i load(const unsigned char *data) {
+    return _mm_loadu_si128(reinterpret_cast<const __m128i *>(data));
+}
+
+// x * k folded onto next: both 64-bit halves are carried forward
+PCLMUL static __m128i fold(__m128i x, __m128i k, __m128i next) {
+    __m128i low = _mm_clmulepi64_si128(x, k, 0x00);
+    __m128i high = _mm_clmulepi64_si128(x, k, 0x11);
+    return _mm_xor_si128(_mm_xor_si128(high, low), next);
+}
+
+PCLMUL static uint32_t crc32_pclmul(const unsigned char *data, size_t size, uint32_t crc) {
+    alignas(16) static const uint64_t k1k2[] = {0x0154442bd4, 0x01c6e41596};
+    alignas(16) static const uint64_t k3k4[] = {0x01751997d0, 0x00ccaa009e};
+    alignas(16) static const uint64_t k5k0[] = {0x0163cd6124, 0x0000000000};
+    alignas(16) static const uint64_t poly[] = {0x01db710641, 0x01f7011641};
+
+    __m128i x1 = _mm_xor_si128(load(data), _mm_cvtsi32_si128(crc));
+    __m128i x2 = load(data + 16);
+    __m128i x3 = load(data + 32);
+    __m128i x4 = load(data + 48);
+    data += 64;
+    size -= 64;
+
+    __m128i k = _mm_load_si128(reinterpret_cast<const __m128i *>(k1k2));
+    for (; size >= 64; data += 64, size -= 64) {
+        x1 = fold(x1, k, load(data));
+        x2 = fold(x2, k, load(data + 16));
+        x3 = fold(x3, k, load(data + 32));
+        x4 = fold(x4, k, load(data + 48));
+    }
+
+    k = _mm_load_si128(reinterpret_cast<const __m128i *>(k3k4));
+    x1 = fold(x1, k, x2);
+    x1 = fold(x1, k, x3);
+    x1 = fold(x1, k, x4);
+    for (; size >= 16; data += 16, size -= 16) {
+        x1 = fold(x1, k, load(data));
+    }
+
+    // 128 bits to 64
+    __m128i mask = _mm_setr_epi32(~0, 0, ~0, 0);
+    x2 = _mm_clmulepi64_si128(x1, k, 0x10);
+    x1 = _mm_xor_si128(_mm_srli_si128(x1, 8), x2);
+
+    k = _mm_loadl_epi64(reinterpret_cast<const __m128i *>(k5k0));
+    x2 = _mm_srli_si128(x1, 4);
+    x1 = _mm_clmulepi64_si128(_mm_and_si128(x1, mask), k, 0x00);
+    x1 = _mm_xor_si128(x1, x2);
+
+    // Barrett reduction to 32 bits
+    k = _mm_load_si128(reinterpret_cast<const __m128i *>(poly));
+    x2 = _mm_clmulepi64_si128(_mm_and_si128(x1, mask), k, 0x10);
+    x2 = _mm_clmulepi64_si128(_mm_and_si128(x2, mask), k, 0x00);
+    x1 = _mm_xor_si128(x1, x2);
+    return _mm_extract_epi32(x1, 1);
+}
+
+uint32_t crc32(std::string_view data, uint32_t crc) {
+    auto bytes = reinterpret_cast<const unsigned char *>(data.data());
+    size_t size = data.size();
+    crc = ~crc;
+    auto &cpu = cpu_features();
+    if (size >= 64 && cpu.sse41 && cpu.pclmul) {
+        size_t vector_size = size & ~static_cast<size_t>(15);
+        crc = crc32_pclmul(bytes, vector_size, crc);
+        bytes += vector_size;
+        size -= vector_size;
+    }
+    return ~crc32_tables(bytes, size, crc);
+}
+
+/*
+ * crc_hqx
+ *
+ * The same slicing-by-8 for a 16-bit CRC shifting left.
+ */
+
+using CrcHqxTables = std::array<std::array<uint16_t, 256>, 8>;
+
+static constexpr CrcHqxTables make_crc_hqx_tables() {
+    CrcHqxTables tables{};
+    for (uint32_t i = 0; i < 256; ++i) {
+        uint16_t crc = i << 8;
+        for (int bit = 0; bit < 8; ++bit) {
+            crc = (crc << 1) ^ ((crc & 0x8000) ? 0x1021 : 0);
+        }
+        tables[0][i] = crc;
+    }
+    for (size_t k = 1; k < tables.size(); ++k) {
+        for (uint32_t i = 0; i < 256; ++i) {
+            uint16_t previous = tables[k - 1][i];
+            tables[k][i] = static_cast<uint16_t>(previous << 8) ^ tables[0][previous >> 8];
+        }
+    }
+    return tables;
+}
+
+static constexpr CrcHqxTables CRC_HQX_TABLES = make_crc_hqx_tables();
+
+uint16_t crc_hqx(std::string_view data, uint16_t crc) {
+    auto &t = CRC_HQX_TABLES;
+    auto bytes = reinterpret_cast<const unsigned char *>(data.data());
+    size_t size = data.size();
+    for (; size >= 8; bytes += 8, size -= 8) {
+        crc = t[7][bytes[0] ^ (crc >> 8)] ^ t[6][bytes[1] ^ (crc & 0xff)] ^ t[5][bytes[2]] ^ t[4][bytes[3]]
+              ^ t[3][bytes[4]] ^ t[2][bytes[5]] ^ t[1][bytes[6]] ^ t[0][bytes[7]];
+    }
+    for (; size; ++bytes, --size) {
+        crc = static_cast<uint16_t>(crc << 8) ^ t[0][(crc >> 8) ^ *bytes];
+    }
+    return crc;
+}
+
+/*
+ * adler32
+ *
+ * Over a block of n bytes, a grows by their sum and b by n * a plus the bytes
+ * weighted n, n - 1, ..., 1. The vector code accumulates both sums in 32-bit
+ * lanes and reduces modulo 65521 every NMAX bytes, as zlib does, the largest
+ * count for which b cannot overflow.
+ */
+
+static constexpr uint32_t ADLER_BASE = 65521;
+static constexpr size_t ADLER_NMAX = 5552;
+
+static uint32_t adler32_scalar(const unsigned char *data, size_t size, uint32_t adler) {
+    uint32_t a = adler & 0xffff;
+    uint32_t b = adler >> 16;
+    while (size) {
+        size_t count = std::min(size, ADLER_NMAX);
+        size -= count;
+        for (; count; ++data, --count) {
+            a += *data;
+            b += a;
+        }
+        a %= ADLER_BASE;
+        b %= ADLER_BASE;
+    }
+    // zlib reduces a starting value out of range even without data
+    return ((b % ADLER_BASE) << 16) | (a % ADLER_BASE);
+}
+
+SSSE3 static uint32_t hsum_epi32(__m128i v) {
+    v = _mm_add_epi32(v, _mm_shuffle_epi32(v, _MM_SHUFFLE(1, 0, 3, 2)));
+    v = _mm_add_epi32(v, _mm_shuffle_epi32(v, _MM_SHUFFLE(2, 3, 0, 1)));
+    return _mm_cvtsi128_si32(v);
+}
+
+// Consumes whole blocks of 16 bytes
+SSSE3 static uint32_t adler32_ssse3(const unsigned char *data, size_t blocks, uint32_t adler) {
+    uint32_t a = adler & 0xffff;
+    uint32_t b = adler >> 16;
+    const __m128i weights = _mm_setr_epi8(16, 15, 14, 13, 12, 11, 10, 9, 8, 7, 6, 5, 4, 3, 2, 1);
+    const __m128i ones = _mm_set1_epi16(1);
+    const __m128i zero = _mm_setzero_si128();
+
+    while (blocks) {
+        size_t count = std::min(blocks, ADLER_NMAX / 16);
+        blocks -= count;
+
+        // a of the blocks before the current one, added to b 16 times each
+        __m128i previous_a = _mm_cvtsi32_si128(a * count);
+        __m128i sum_a = zero;
+        __m128i sum_b = _mm_cvtsi32_si128(b);
+        for (; count; data += 16, --count) {
+            __m128i bytes = _mm_loadu_si128(reinterpret_cast<const __m128i *>(data));
+            previous_a = _mm_add_epi32(previous_a, sum_a);
+            sum_a = _mm_add_epi32(sum_a, _mm_sad_epu8(bytes, zero));
+            sum_b = _mm_add_epi32(sum_b, _mm_madd_epi16(_mm_maddubs_epi16(bytes, weights), ones));
+        }
+        sum_b = _mm_add_epi32(sum_b, _mm_slli_epi32(previous_a, 4));
+
+        a = (a + hsum_epi32(sum_a)) % ADLER_BASE;
+        b = hsum_epi32(sum_b) % ADLER_BASE;
+    }
+    return (b << 16) | a;
+}
+
+AVX2 static uint32_t hsum_epi32(__m256i v) {
+    return hsum_epi32(_mm_add_epi32(_mm256_castsi256_si128(v), _mm256_extracti128_si256(v, 1)));
+}
+
+// Consumes whole blocks of 32 bytes
+AVX2 static uint32_t adler32_avx2(const unsigned char *data, size_t blocks, uint32_t adler) {
+    uint32_t a = adler & 0xffff;
+    uint32_t b = adler >> 16;
+    const __m256i weights = _mm256_setr_epi8(32, 31, 30, 29, 28, 27, 26, 25, 24, 23, 22, 21, 20, 19, 18, 17,
+                                             16, 15, 14, 13, 12, 11, 10, 9, 8, 7, 6, 5, 4, 3, 2, 1);
+    const __m256i ones = _mm256_set1_epi16(1);
+    const __m256i zero = _mm256_setzero_si256();
+
+    while (blocks) {
+        size_t count = std::min(blocks, ADLER_NMAX / 32);
+        blocks -= count;
+
+        __m256i previous_a = _mm256_zextsi128_si256(_mm_cvtsi32_si128(a * count));
+        __m256i sum_a = zero;
+        __m256i sum_b = _mm256_zextsi128_si256(_mm_cvtsi32_si128(b));
+        for (; count; data += 32, --count) {
+            __m256i bytes = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(data));
+            previous_a = _mm256_add_epi32(previous_a, sum_a);
+            sum_a = _mm256_add_epi32(sum_a, _mm256_sad_epu8(bytes, zero));
+            sum_b = _mm256_add_epi32(sum_b, _mm256_madd_epi16(_mm256_maddubs_epi16(bytes, weights), ones));
+        }
+        sum_b = _mm256_add_epi32(sum_b, _mm256_slli_epi32(previous_a, 5));
+
+        a = (a + hsum_epi32(sum_a)) % ADLER_BASE;
+        b = hsum_epi32(sum_b) % ADLER_BASE;
+    }
+    return (b << 16) | a;
+}
+
+uint32_t adler32(std::string_view data, uint32_t adler) {
+    auto bytes = reinterpret_cast<const unsigned char *>(data.data());
+    size_t size = data.size();
+    auto &cpu = cpu_features();
+    if (cpu.avx2) {
+        adler = adler32_avx2(bytes, size / 32, adler);
+        bytes += size / 32 * 32;
+        size %= 32;
+    }
+    else if (cpu.ssse3) {
+        adler = adler32_ssse3(bytes, size / 16, adler);
+        bytes += size / 16 * 16;
+        size %= 16;
+    }
+    return adler32_scalar(bytes, size, adler);
+}
+
+} // namespace Checksums
+
+} // namespace MiniPython
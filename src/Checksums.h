@@ -0,0 +1,29 @@
+#pragma once
+
+#include <cstdint>
+#include <string_view>
+
+namespace MiniPython {
+
+/**
+ * @brief Checksums of binascii and zlib
+ *
+ * Each function continues from the value of the data before, so a stream can
+ * be checksummed chunk by chunk. The implementation is picked at runtime:
+ * crc32 folds with PCLMULQDQ and adler32 uses SSSE3/AVX2 when the CPU has
+ * them; slicing-by-8 tables (crc32, crc_hqx) and a scalar loop (adler32) are
+ * used otherwise and for the tails.
+ */
+namespace Checksums {
+
+// CRC-32 of zlib (reflected polynomial 0xedb88320)
+uint32_t crc32(std::string_view data, uint32_t crc = 0);
+
+// CRC-CCITT as in binhex4 (polynomial 0x1021, not reflected)
+uint16_t crc_hqx(std::string_view data, uint16_t crc);
+
+uint32_t adler32(std::string_view data, uint32_t adler = 1);
+
+} // namespace Checksums
+
+} // namespace MiniPython
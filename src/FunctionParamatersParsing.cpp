@@ -26,7 +26,7 @@ ParsedFunctionParamaters ParsedFunctionParamaters::parse(const InstructionParams
 
     for (auto &param: params) {
         if (param->op == Operation::KWARG) {
-            auto var_name = param->params[0]->var->to_str();
+            const auto &var_name = param->params[0]->name.str();
             auto value = execute_instruction(param->params[1], scope);
 
             bool is_kwarg = true;
@@ -0,0 +1,616 @@
+#include "Hashing.h"
+#include "Utils.h"
+
+#include <algorithm>
+#include <array>
+#include <cstdint>
+#include <cstring>
+#include <immintrin.h>
+
+namespace MiniPython {
+
+namespace Hashing {
+
+#define SHA __attribute__((target("sha,sse4.1")))
+#define AVX2 __attribute__((target("avx2")))
+
+static uint32_t rotl32(uint32_t x, int n) { return (x << n) | (x >> (32 - n)); }
+static uint32_t rotr32(uint32_t x, int n) { return (x >> n) | (x << (32 - n)); }
+static uint64_t rotr64(uint64_t x, int n) { return (x >> n) | (x << (64 - n)); }
+
+static uint32_t load_be32(const unsigned char *p) {
+    return (uint32_t(p[0]) << 24) | (uint32_t(p[1]) << 16) | (uint32_t(p[2]) << 8) | p[3];
+}
+
+static uint32_t load_le32(const unsigned char *p) {
+    return (uint32_t(p[3]) << 24) | (uint32_t(p[2]) << 16) | (uint32_t(p[1]) << 8) | p[0];
+}
+
+static uint64_t load_le64(const unsigned char *p) {
+    return (uint64_t(load_le32(p + 4)) << 32) | load_le32(p);
+}
+
+/*
+ * Merkle–Damgård hashes with 64-byte blocks: the input is buffered up to a
+ * whole block, and the final block carries 0x80, zeros and the bit length.
+ *
+ * An Algorithm provides the State, its INITIAL value, compress() over whole
+ * blocks and the byte order of words.
+ */
+template<typename Algorithm>
+class BlockHash: public Hash {
+public:
+    std::unique_ptr<Hash> copy() const override {
+        return std::make_unique<BlockHash>(*this);
+    }
+
+    void update(std::string_view data) override {
+        auto bytes = reinterpret_cast<const unsigned char *>(data.data());
+        size_t size = data.size();
+        length += size;
+        if (buffered) {
+            size_t count = std::min(size, BLOCK_SIZE - buffered);
+            std::memcpy(buffer + buffered, bytes, count);
+            buffered += count;
+            bytes += count;
+            size -= count;
+            if (buffered < BLOCK_SIZE) {
+                return;
+            }
+            Algorithm::compress(state, buffer, 1);
+            buffered = 0;
+        }
+        // Whole blocks are hashed straight from the input
+        Algorithm::compress(state, bytes, size / BLOCK_SIZE);
+        bytes += size / BLOCK_SIZE * BLOCK_SIZE;
+        size %= BLOCK_SIZE;
+        std::memcpy(buffer, bytes, size);
+        buffered = size;
+    }
+
+    std::string digest() const override {
+        unsigned char tail[2 * BLOCK_SIZE] = {};
+        std::memcpy(tail, buffer, buffered);
+        tail[buffered] = 0x80;
+        size_t blocks = (buffered + 1 + 8 <= BLOCK_SIZE) ? 1 : 2;
+        uint64_t bits = length * 8;
+        for (size_t i = 0; i < 8; ++i) {
+            size_t position = Algorithm::big_endian ? blocks * BLOCK_SIZE - 1 - i : blocks * BLOCK_SIZE - 8 + i;
+            tail[position] = static_cast<unsigned char>(bits >> (8 * i));
+        }
+
+        auto final_state = state;
+        Algorithm::compress(final_state, tail, blocks);
+
+        std::string result;
+        for (uint32_t word: final_state) {
+            for (int i = 0; i < 4; ++i) {
+                int shift = Algorithm::big_endian ? 24 - 8 * i : 8 * i;
+                result += static_cast<char>(word >> shift);
+            }
+        }
+        return result;
+    }
+
+    const char *name() const override { return Algorithm::NAME; }
+    size_t digest_size() const override { return sizeof(typename Algorithm::State); }
+    size_t block_size() const override { return BLOCK_SIZE; }
+
+private:
+    static constexpr size_t BLOCK_SIZE = 64;
+
+    typename Algorithm::State state = Algorithm::INITIAL;
+    unsigned char buffer[BLOCK_SIZE];
+    size_t buffered = 0;
+    uint64_t length = 0;
+};
+
+/*
+ * MD5 (RFC 1321)
+ */
+
+struct Md5 {
+    using State = std::array<uint32_t, 4>;
+    static constexpr State INITIAL = {0x67452301, 0xefcdab89, 0x98badcfe, 0x10325476};
+    static constexpr bool big_endian = false;
+    static constexpr const char *NAME = "md5";
+
+    static void compress(State &state, const unsigned char *data, size_t blocks);
+};
+
+static const uint32_t MD5_K[64] = {
+    0xd76aa478, 0xe8c7b756, 0x242070db, 0xc1bdceee, 0xf57c0faf, 0x4787c62a, 0xa8304613, 0xfd469501,
+    0x698098d8, 0x8b44f7af, 0xffff5bb1, 0x895cd7be, 0x6b901122, 0xfd987193, 0xa679438e, 0x49b40821,
+    0xf61e2562, 0xc040b340, 0x265e5a51, 0xe9b6c7aa, 0xd62f105d, 0x02441453, 0xd8a1e681, 0xe7d3fbc8,
+    0x21e1cde6, 0xc33707d6, 0xf4d50d87, 0x455a14ed, 0xa9e3e905, 0xfcefa3f8, 0x676f02d9, 0x8d2a4c8a,
+    0xfffa3942, 0x8771f681, 0x6d9d6122, 0xfde5380c, 0xa4beea44, 0x4bdecfa9, 0xf6bb4b60, 0xbebfbc70,
+    0x289b7ec6, 0xeaa127fa, 0xd4ef3085, 0x04881d05, 0xd9d4d039, 0xe6db99e5, 0x1fa27cf8, 0xc4ac5665,
+    0xf4292244, 0x432aff97, 0xab9423a7, 0xfc93a039, 0x655b59c3, 0x8f0ccc92, 0xffeff47d, 0x85845dd1,
+    0x6fa87e4f, 0xfe2ce6e0, 0xa3014314, 0x4e0811a1, 0xf7537e82, 0xbd3af235, 0x2ad7d2bb, 0xeb86d391,
+};
+
+static const int MD5_SHIFTS[4][4] = {{7, 12, 17, 22}, {5, 9, 14, 20}, {4, 11, 16, 23}, {6, 10, 15, 21}};
+
+void Md5::compress(State &state, const unsigned char *data, size_t blocks) {
+    for (; blocks; --blocks, data += 64) {
+        uint32_t m[16];
+        for (int i = 0; i < 16; ++i) {
+            m[i] = load_le32(data + 4 * i);
+        }
+        uint32_t a = state[0], b = state[1], c = state[2], d = state[3];
+        for (int i = 0; i < 64; ++i) {
+            uint32_t f;
+            int g;
+            switch (i / 16) {
+            case 0: f = (b & c) | (~b & d); g = i; break;
+            case 1: f = (d & b) | (~d & c); g = (5 * i + 1) % 16; break;
+            case 2: f = b ^ c ^ d; g = (3 * i + 5) % 16; break;
+            default: f = c ^ (b | ~d); g = (7 * i) % 16; break;
+            }
+            f += a + MD5_K[i] + m[g];
+            a = d;
+            d = c;
+            c = b;
+            b += rotl32(f, MD5_SHIFTS[i / 16][i % 4]);
+        }
+        state[0] += a;
+        state[1] += b;
+        state[2] += c;
+        state[3] += d;
+    }
+}
+
+/*
+ * SHA-1 (FIPS 180-4)
+ *
+ * The SHA extensions run four rounds per sha1rnds4; sha1msg1, sha1msg2 and
+ * xor compute the message schedule four words at a time, following Intel's
+ * reference code.
+ */
+
+struct Sha1 {
+    using State = std::array<uint32_t, 5>;
+    static constexpr State INITIAL = {0x67452301, 0xefcdab89, 0x98badcfe, 0x10325476, 0xc3d2e1f0};
+    static constexpr bool big_endian = true;
+    static constexpr const char *NAME = "sha1";
+
+    static void compress(State &state, const unsigned char *data, size_t blocks);
+};
+
+static void sha1_scalar(Sha1::State &state, const unsigned char *data, size_t blocks) {
+    for (; blocks; --blocks, data += 64) {
+        uint32_t w[80];
+        for (int i = 0; i < 16; ++i) {
+            w[i] = load_be32(data + 4 * i);
+        }
+        for (int i = 16; i < 80; ++i) {
+            w[i] = rotl32(w[i - 3] ^ w[i - 8] ^ w[i - 14] ^ w[i - 16], 1);
+        }
+        uint32_t a = state[0], b = state[1], c = state[2], d = state[3], e = state[4];
+        for (int i = 0; i < 80; ++i) {
+            uint32_t f, k;
+            switch (i / 20) {
+            case 0: f = (b & c) | (~b & d); k = 0x5a827999; break;
+            case 1: f = b ^ c ^ d; k = 0x6ed9eba1; break;
+            case 2: f = (b & c) | (b & d) | (c & d); k = 0x8f1bbcdc; break;
+            default: f = b ^ c ^ d; k = 0xca62c1d6; break;
+            }
+            uint32_t temp = rotl32(a, 5) + f + e + k + w[i];
+            e = d;
+            d = c;
+            c = rotl32(b, 30);
+            b = a;
+            a = temp;
+        }
+        state[0] += a;
+        state[1] += b;
+        state[2] += c;
+        state[3] += d;
+        state[4] += e;
+    }
+}
+
+// The round function is an immediate operand
+SHA static __m128i sha1_rounds(__m128i abcd, __m128i e, int group) {
+    switch (group / 5) {
+    case 0: return _mm_sha1rnds4_epu32(abcd, e, 0);
+    case 1: return _mm_sha1rnds4_epu32(abcd, e, 1);
+    case 2: return _mm_sha1rnds4_epu32(abcd, e, 2);
+    default: return _mm_sha1rnds4_epu32(abcd, e, 3);
+    }
+}
+
+SHA static void sha1_shani(Sha1::State &state, const unsigned char *data, size_t blocks) {
+    const __m128i byte_swap = _mm_set_epi64x(0x0001020304050607, 0x08090a0b0c0d0e0f);
+    __m128i abcd = _mm_shuffle_epi32(_mm_loadu_si128(reinterpret_cast<const __m128i *>(state.data())), 0x1b);
+    __m128i e0 = _mm_set_epi32(state[4], 0, 0, 0);
+
+    for (; blocks; --blocks, data += 64) {
+        __m128i abcd_save = abcd;
+        __m128i e0_save = e0;
+        __m128i e1;
+        __m128i msg[4];
+
+        // Groups of four rounds alternate between e0 and e1
+        for (int i = 0; i < 20; ++i) {
+            __m128i &current = msg[i % 4];
+            if (i < 4) {
+                current = _mm_shuffle_epi8(_mm_loadu_si128(reinterpret_cast<const __m128i *>(data + 16 * i)), byte_swap);
+            }
+            __m128i &e = (i % 2) ? e1 : e0;
+            __m128i &other = (i % 2) ? e0 : e1;
+            e = (i == 0) ? _mm_add_epi32(e, current) : _mm_sha1nexte_epu32(e, current);
+            other = abcd;
+            if (i >= 3 && i <= 18) {
+                msg[(i + 1) % 4] = _mm_sha1msg2_epu32(msg[(i + 1) % 4], current);
+            }
+            abcd = sha1_rounds(abcd, e, i);
+            if (i >= 1 && i <= 16) {
+                msg[(i + 3) % 4] = _mm_sha1msg1_epu32(msg[(i + 3) % 4], current);
+            }
+            if (i >= 2 && i <= 17) {
+                msg[(i + 2) % 4] = _mm_xor_si128(msg[(i + 2) % 4], current);
+            }
+        }
+
+        e0 = _mm_sha1nexte_epu32(e0, e0_save);
+        abcd = _mm_add_epi32(abcd, abcd_save);
+    }
+
+    _mm_storeu_si128(reinterpret_cast<__m128i *>(state.data()), _mm_shuffle_epi32(abcd, 0x1b));
+    state[4] = _mm_extract_epi32(e0, 3);
+}
+
+void Sha1::compress(State &state, const unsigned char *data, size_t blocks) {
+    if (cpu_features().sha && cpu_features().sse41) {
+        sha1_shani(state, data, blocks);
+    }
+    else {
+        sha1_scalar(state, data, blocks);
+    }
+}
+
+/*
+ * SHA-256 (FIPS 180-4)
+ *
+ * sha256rnds2 runs two rounds on the state split into ABEF and CDGH halves;
+ * sha256msg1/sha256msg2 extend the message schedule.
+ */
+
+struct Sha256 {
+    using State = std::array<uint32_t, 8>;
+    static constexpr State INITIAL = {0x6a09e667, 0xbb67ae85, 0x3c6ef372, 0xa54ff53a,
+                                      0x510e527f, 0x9b05688c, 0x1f83d9ab, 0x5be0cd19};
+    static constexpr bool big_endian = true;
+    static constexpr const char *NAME = "sha256";
+
+    static void compress(State &state, const unsigned char *data, size_t blocks);
+};
+
+alignas(16) static const uint32_t SHA256_K[64] = {
+    0x428a2f98, 0x71374491, 0xb5c0fbcf, 0xe9b5dba5, 0x3956c25b, 0x59f111f1, 0x923f82a4, 0xab1c5ed5,
+    0xd807aa98, 0x12835b01, 0x243185be, 0x550c7dc3, 0x72be5d74, 0x80deb1fe, 0x9bdc06a7, 0xc19bf174,
+    0xe49b69c1, 0xefbe4786, 0x0fc19dc6, 0x240ca1cc, 0x2de92c6f, 0x4a7484aa, 0x5cb0a9dc, 0x76f988da,
+    0x983e5152, 0xa831c66d, 0xb00327c8, 0xbf597fc7, 0xc6e00bf3, 0xd5a79147, 0x06ca6351, 0x14292967,
+    0x27b70a85, 0x2e1b2138, 0x4d2c6dfc, 0x53380d13, 0x650a7354, 0x766a0abb, 0x81c2c92e, 0x92722c85,
+    0xa2bfe8a1, 0xa81a664b, 0xc24b8b70, 0xc76c51a3, 0xd192e819, 0xd6990624, 0xf40e3585, 0x106aa070,
+    0x19a4c116, 0x1e376c08, 0x2748774c, 0x34b0bcb5, 0x391c0cb3, 0x4ed8aa4a, 0x5b9cca4f, 0x682e6ff3,
+    0x748f82ee, 0x78a5636f, 0x84c87814, 0x8cc70208, 0x90befffa, 0xa4506ceb, 0xbef9a3f7, 0xc67178f2,
+};
+
+static void sha256_scalar(Sha256::State &state, const unsigned char *data, size_t blocks) {
+    for (; blocks; --blocks, data += 64) {
+        uint32_t w[64];
+        for (int i = 0; i < 16; ++i) {
+            w[i] = load_be32(data + 4 * i);
+        }
+        for (int i = 16; i < 64; ++i) {
+            uint32_t s0 = rotr32(w[i - 15], 7) ^ rotr32(w[i - 15], 18) ^ (w[i - 15] >> 3);
+            uint32_t s1 = rotr32(w[i - 2], 17) ^ rotr32(w[i - 2], 19) ^ (w[i - 2] >> 10);
+            w[i] = w[i - 16] + s0 + w[i - 7] + s1;
+        }
+        uint32_t a = state[0], b = state[1], c = state[2], d = state[3];
+        uint32_t e = state[4], f = state[5], g = state[6], h = state[7];
+        for (int i = 0; i < 64; ++i) {
+            uint32_t t1 = h + (rotr32(e, 6) ^ rotr32(e, 11) ^ rotr32(e, 25)) + ((e & f) ^ (~e & g)) + SHA256_K[i] + w[i];
+            uint32_t t2 = (rotr32(a, 2) ^ rotr32(a, 13) ^ rotr32(a, 22)) + ((a & b) ^ (a & c) ^ (b & c));
+            h = g;
+            g = f;
+            f = e;
+            e = d + t1;
+            d = c;
+            c = b;
+            b = a;
+            a = t1 + t2;
+        }
+        state[0] += a;
+        state[1] += b;
+        state[2] += c;
+        state[3] += d;
+        state[4] += e;
+        state[5] += f;
+        state[6] += g;
+        state[7] += h;
+    }
+}
+
+SHA static void sha256_shani(Sha256::State &state, const unsigned char *data, size_t blocks) {
+    const __m128i byte_swap = _mm_set_epi64x(0x0c0d0e0f08090a0b, 0x0405060700010203);
+
+    __m128i tmp = _mm_shuffle_epi32(_mm_loadu_si128(reinterpret_cast<const __m128i *>(&state[0])), 0xb1);
+    __m128i cdgh = _mm_shuffle_epi32(_mm_loadu_si128(reinterpret_cast<const __m128i *>(&state[4])), 0x1b);
+    __m128i abef = _mm_alignr_epi8(tmp, cdgh, 8);
+    cdgh = _mm_blend_epi16(cdgh, tmp, 0xf0);
+
+    for (; blocks; --blocks, data += 64) {
+        __m128i abef_save = abef;
+        __m128i cdgh_save = cdgh;
+        __m128i msg[4];
+
+        for (int i = 0; i < 16; ++i) {
+            __m128i &current = msg[i % 4];
+            if (i < 4) {
+                current = _mm_shuffle_epi8(_mm_loadu_si128(reinterpret_cast<const __m128i *>(data + 16 * i)), byte_swap);
+            }
+            __m128i words = _mm_add_epi32(current, _mm_load_si128(reinterpret_cast<const __m128i *>(SHA256_K + 4 * i)));
+            cdgh = _mm_sha256rnds2_epu32(cdgh, abef, words);
+            if (i >= 3 && i <= 14) {
+                __m128i &next = msg[(i + 1) % 4];
+                next = _mm_add_epi32(next, _mm_alignr_epi8(current, msg[(i + 3) % 4], 4));
+                next = _mm_sha256msg2_epu32(next, current);
+            }
+            abef = _mm_sha256rnds2_epu32(abef, cdgh, _mm_shuffle_epi32(words, 0x0e));
+            if (i >= 1 && i <= 12) {
+                msg[(i + 3) % 4] = _mm_sha256msg1_epu32(msg[(i + 3) % 4], current);
+            }
+        }
+
+        abef = _mm_add_epi32(abef, abef_save);
+        cdgh = _mm_add_epi32(cdgh, cdgh_save);
+    }
+
+    tmp = _mm_shuffle_epi32(abef, 0x1b);
+    cdgh = _mm_shuffle_epi32(cdgh, 0xb1);
+    _mm_storeu_si128(reinterpret_cast<__m128i *>(&state[0]), _mm_blend_epi16(tmp, cdgh, 0xf0));
+    _mm_storeu_si128(reinterpret_cast<__m128i *>(&state[4]), _mm_alignr_epi8(cdgh, tmp, 8));
+}
+
+void Sha256::compress(State &state, const unsigned char *data, size_t blocks) {
+    if (cpu_features().sha && cpu_features().sse41) {
+        sha256_shani(state, data, blocks);
+    }
+    else {
+        sha256_scalar(state, data, blocks);
+    }
+}
+
+/*
+ * BLAKE2b (RFC 7693)
+ *
+ * The AVX2 code keeps each row of the 4x4 state in one register, so G runs
+ * on all four columns at once; rotating rows b, c and d lines the diagonals
+ * up for the second half of each round.
+ */
+
+static const uint64_t BLAKE2B_IV[8] = {
+    0x6a09e667f3bcc908, 0xbb67ae8584caa73b, 0x3c6ef372fe94f82b, 0xa54ff53a5f1d36f1,
+    0x510e527fade682d1, 0x9b05688c2b3e6c1f, 0x1f83d9abfb41bd6b, 0x5be0cd19137e2179,
+};
+
+static const uint8_t BLAKE2B_SIGMA[12][16] = {
+    {0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15},
+    {14, 10, 4, 8, 9, 15, 13, 6, 1, 12, 0, 2, 11, 7, 5, 3},
+    {11, 8, 12, 0, 5, 2, 15, 13, 10, 14, 3, 6, 7, 1, 9, 4},
+    {7, 9, 3, 1, 13, 12, 11, 14, 2, 6, 5, 10, 4, 0, 15, 8},
+    {9, 0, 5, 7, 2, 4, 10, 15, 14, 1, 11, 12, 6, 8, 3, 13},
+    {2, 12, 6, 10, 0, 11, 8, 3, 4, 13, 7, 5, 15, 14, 1, 9},
+    {12, 5, 1, 15, 14, 13, 4, 10, 0, 7, 6, 3, 9, 2, 8, 11},
+    {13, 11, 7, 14, 12, 1, 3, 9, 5, 0, 15, 4, 8, 6, 2, 10},
+    {6, 15, 14, 9, 11, 3, 0, 8, 12, 2, 13, 7, 1, 4, 10, 5},
+    {10, 2, 8, 4, 7, 6, 1, 5, 15, 11, 9, 14, 3, 12, 13, 0},
+    {0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15},
+    {14, 10, 4, 8, 9, 15, 13, 6, 1, 12, 0, 2, 11, 7, 5, 3},
+};
+
+static void blake2b_g(uint64_t *v, int a, int b, int c, int d, uint64_t x, uint64_t y) {
+    v[a] += v[b] + x;
+    v[d] = rotr64(v[d] ^ v[a], 32);
+    v[c] += v[d];
+    v[b] = rotr64(v[b] ^ v[c], 24);
+    v[a] += v[b] + y;
+    v[d] = rotr64(v[d] ^ v[a], 16);
+    v[c] += v[d];
+    v[b] = rotr64(v[b] ^ v[c], 63);
+}
+
+static void blake2b_scalar(uint64_t *h, const uint64_t *m, uint64_t t0, uint64_t t1, bool last) {
+    uint64_t v[16];
+    std::memcpy(v, h, 8 * sizeof(uint64_t));
+    std::memcpy(v + 8, BLAKE2B_IV, sizeof(BLAKE2B_IV));
+    v[12] ^= t0;
+    v[13] ^= t1;
+    if (last) {
+        v[14] = ~v[14];
+    }
+    for (auto &s: BLAKE2B_SIGMA) {
+        blake2b_g(v, 0, 4, 8, 12, m[s[0]], m[s[1]]);
+        blake2b_g(v, 1, 5, 9, 13, m[s[2]], m[s[3]]);
+        blake2b_g(v, 2, 6, 10, 14, m[s[4]], m[s[5]]);
+        blake2b_g(v, 3, 7, 11, 15, m[s[6]], m[s[7]]);
+        blake2b_g(v, 0, 5, 10, 15, m[s[8]], m[s[9]]);
+        blake2b_g(v, 1, 6, 11, 12, m[s[10]], m[s[11]]);
+        blake2b_g(v, 2, 7, 8, 13, m[s[12]], m[s[13]]);
+        blake2b_g(v, 3, 4, 9, 14, m[s[14]], m[s[15]]);
+    }
+    for (int i = 0; i < 8; ++i) {
+        h[i] ^= v[i] ^ v[i + 8];
+    }
+}
+
+AVX2 static __m256i rotr_epi64(__m256i x, int n) {
+    return _mm256_or_si256(_mm256_srli_epi64(x, n), _mm256_slli_epi64(x, 64 - n));
+}
+
+AVX2 static void blake2b_g_avx2(__m256i &a, __m256i &b, __m256i &c, __m256i &d, __m256i x, __m256i y) {
+    a = _mm256_add_epi64(_mm256_add_epi64(a, b), x);
+    d = rotr_epi64(_mm256_xor_si256(d, a), 32);
+    c = _mm256_add_epi64(c, d);
+    b = rotr_epi64(_mm256_xor_si256(b, c), 24);
+    a = _mm256_add_epi64(_mm256_add_epi64(a, b), y);
+    d = rotr_epi64(_mm256_xor_si256(d, a), 16);
+    c = _mm256_add_epi64(c, d);
+    b = rotr_epi64(_mm256_xor_si256(b, c), 63);
+}
+
+AVX2 static __m256i load(const uint64_t *p) {
+    return _mm256_loadu_si256(reinterpret_cast<const __m256i *>(p));
+}
+
+AVX2 static void store(uint64_t *p, __m256i value) {
+    _mm256_storeu_si256(reinterpret_cast<__m256i *>(p), value);
+}
+
+AVX2 static void blake2b_avx2(uint64_t *h, const uint64_t *m, uint64_t t0, uint64_t t1, bool last) {
+    __m256i a = load(h);
+    __m256i b = load(h + 4);
+    __m256i c = load(BLAKE2B_IV);
+    __m256i d = _mm256_xor_si256(load(BLAKE2B_IV + 4),
+                                 _mm256_set_epi64x(0, last ? ~uint64_t(0) : 0, t1, t0));
+    for (auto &s: BLAKE2B_SIGMA) {
+        blake2b_g_avx2(a, b, c, d, _mm256_set_epi64x(m[s[6]], m[s[4]], m[s[2]], m[s[0]]),
+                       _mm256_set_epi64x(m[s[7]], m[s[5]], m[s[3]], m[s[1]]));
+        b = _mm256_permute4x64_epi64(b, _MM_SHUFFLE(0, 3, 2, 1));
+        c = _mm256_permute4x64_epi64(c, _MM_SHUFFLE(1, 0, 3, 2));
+        d = _mm256_permute4x64_epi64(d, _MM_SHUFFLE(2, 1, 0, 3));
+        blake2b_g_avx2(a, b, c, d, _mm256_set_epi64x(m[s[14]], m[s[12]], m[s[10]], m[s[8]]),
+                       _mm256_set_epi64x(m[s[15]], m[s[13]], m[s[11]], m[s[9]]));
+        b = _mm256_permute4x64_epi64(b, _MM_SHUFFLE(2, 1, 0, 3));
+        c = _mm256_permute4x64_epi64(c, _MM_SHUFFLE(1, 0, 3, 2));
+        d = _mm256_permute4x64_epi64(d, _MM_SHUFFLE(0, 3, 2, 1));
+    }
+    store(h, _mm256_xor_si256(load(h), _mm256_xor_si256(a, c)));
+    store(h + 4, _mm256_xor_si256(load(h + 4), _mm256_xor_si256(b, d)));
+}
+
+class Blake2b: public Hash {
+public:
+    Blake2b(size_t _digest_size, std::string_view key)
+        : digest_length(_digest_size)
+    {
+        std::memcpy(h, BLAKE2B_IV, sizeof(h));
+        // Parameter block: digest length, key length, fanout 1, depth 1
+        h[0] ^= 0x01010000 ^ (key.size() << 8) ^ digest_length;
+        if (!key.empty()) {
+            // The key is hashed as a whole block of its own
+            unsigned char block[BLOCK_SIZE] = {};
+            std::memcpy(block, key.data(), key.size());
+            update(std::string_view(reinterpret_cast<char *>(block), BLOCK_SIZE));
+        }
+    }
+
+    std::unique_ptr<Hash> copy() const override {
+        return std::make_unique<Blake2b>(*this);
+    }
+
+    void update(std::string_view data) override {
+        auto bytes = reinterpret_cast<const unsigned char *>(data.data());
+        size_t size = data.size();
+        while (size) {
+            // The last block is compressed differently, so a full buffer waits for more data
+            if (buffered == BLOCK_SIZE) {
+                compress(buffer, BLOCK_SIZE, false);
+                buffered = 0;
+            }
+            if (buffered == 0) {
+                for (; size > BLOCK_SIZE; bytes += BLOCK_SIZE, size -= BLOCK_SIZE) {
+                    compress(bytes, BLOCK_SIZE, false);
+                }
+            }
+            size_t count = std::min(size, BLOCK_SIZE - buffered);
+            std::memcpy(buffer + buffered, bytes, count);
+            buffered += count;
+            bytes += count;
+            size -= count;
+        }
+    }
+
+    std::string digest() const override {
+        Blake2b final_state(*this);
+        std::memset(final_state.buffer + buffered, 0, BLOCK_SIZE - buffered);
+        final_state.compress(final_state.buffer, buffered, true);
+
+        std::string result(digest_length, '\0');
+        for (size_t i = 0; i < digest_length; ++i) {
+            result[i] = static_cast<char>(final_state.h[i / 8] >> (8 * (i % 8)));
+        }
+        return result;
+    }
+
+    const char *name() const override { return "blake2b"; }
+    size_t digest_size() const override { return digest_length; }
+    size_t block_size() const override { return BLOCK_SIZE; }
+
+private:
+    static constexpr size_t BLOCK_SIZE = 128;
+
+    void compress(const unsigned char *block, size_t size, bool last) {
+        // 128-bit byte counter
+        counter_low += size;
+        if (counter_low < size) {
+            ++counter_high;
+        }
+        uint64_t m[16];
+        for (int i = 0; i < 16; ++i) {
+            m[i] = load_le64(block + 8 * i);
+        }
+        if (cpu_features().avx2) {
+            blake2b_avx2(h, m, counter_low, counter_high, last);
+        }
+        else {
+            blake2b_scalar(h, m, counter_low, counter_high, last);
+        }
+    }
+
+    uint64_t h[8];
+    uint64_t counter_low = 0;
+    uint64_t counter_high = 0;
+    unsigned char buffer[BLOCK_SIZE];
+    size_t buffered = 0;
+    size_t digest_length;
+};
+
+std::unique_ptr<Hash> md5() {
+    return std::make_unique<BlockHash<Md5>>();
+}
+
+std::unique_ptr<Hash> sha1() {
+    return std::make_unique<BlockHash<Sha1>>();
+}
+
+std::unique_ptr<Hash> sha256() {
+    return std::make_unique<BlockHash<Sha256>>();
+}
+
+std::unique_ptr<Hash> blake2b(size_t digest_size, std::string_view key) {
+    return std::make_unique<Blake2b>(digest_size, key);
+}
+
+std::unique_ptr<Hash> by_name(std::string_view name) {
+    if (name == "md5") {
+        return md5();
+    }
+    if (name == "sha1") {
+        return sha1();
+    }
+    if (name == "sha256") {
+        return sha256();
+    }
+    if (name == "blake2b") {
+        return blake2b();
+    }
+    return nullptr;
+}
+
+} // namespace Hashing
+
+} // namespace MiniPython
@@ -0,0 +1,43 @@
+#pragma once
+
+#include <cstddef>
+#include <memory>
+#include <string>
+#include <string_view>
+
+namespace MiniPython {
+
+/**
+ * @brief Message digests of hashlib
+ *
+ * sha1 and sha256 use the SHA extensions when the CPU has them and blake2b
+ * works on whole rows of its state with AVX2; plain C++ is used otherwise.
+ */
+namespace Hashing {
+
+class Hash {
+public:
+    virtual ~Hash() = default;
+
+    virtual std::unique_ptr<Hash> copy() const = 0;
+    virtual void update(std::string_view data) = 0;
+    // Finishes a copy of the state, so more data can be added afterwards
+    virtual std::string digest() const = 0;
+
+    virtual const char *name() const = 0;
+    virtual size_t digest_size() const = 0;
+    virtual size_t block_size() const = 0;
+};
+
+std::unique_ptr<Hash> md5();
+std::unique_ptr<Hash> sha1();
+std::unique_ptr<Hash> sha256();
+// digest_size is 1 to 64 bytes and the key at most 64 bytes
+std::unique_ptr<Hash> blake2b(size_t digest_size = 64, std::string_view key = {});
+
+// One of the above by name, or nullptr
+std::unique_ptr<Hash> by_name(std::string_view name);
+
+} // namespace Hashing
+
+} // namespace MiniPython
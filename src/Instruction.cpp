@@ -1,4 +1,5 @@
 #include "Instruction.h"
+#include "RaiseException.h"
 #include "Scope.h"
 #include "StringFormatting.h"
 #include "TokenToVariable.h"
@@ -32,6 +33,8 @@ std::string opToString(Operation op) {
         return "MOD";
     case Operation::POW:
         return "POW";
+    case Operation::IN:
+        return "IN";
     case Operation::CALL:
         return "CALL";
     case Operation::VAR_NAME:
@@ -71,6 +74,7 @@ Instruction::Instruction(const Token &_token)
     case TokenType::IDENTIFIER: {
         op = Operation::VAR_NAME;
         var = std::static_pointer_cast<GenericVariable>(std::make_shared<StringVariable>(_token.value));
+        name = Atom(_token.value);
         break;
     }
     case TokenType::NUMBER:
@@ -104,12 +108,45 @@ Variable execute_instruction(std::shared_ptr<Instruction> instr, Scope *scope) {
     return instr->execute(scope);
 }
 
+/*
+ * s = s + piece
+ *
+ * When the variable holds the only reference to a str or bytes object, the
+ * piece is appended to it in place instead of copying both into a new
+ * object, so building a string in a loop takes linear time.
+ */
+static bool append_in_place(ScopeImpl &scope_with_variable, const Atom &var_name,
+                            Instruction &value, Scope *scope) {
+    if (value.op != Operation::ADD || value.params.size() != 2 || value.params[0]->op != Operation::VAR_NAME
+        || value.params[0]->name != var_name) {
+        return false;
+    }
+    auto current = std::dynamic_pointer_cast<StringVariable>(scope_with_variable.vars.get(var_name));
+    if (!current) {
+        return false;
+    }
+
+    auto piece = value.params[1]->execute(scope);
+    // Held by the variable and by current only: nobody else can see the change
+    bool unshared = (current.use_count() == 2) && (current.get() != piece.get());
+    if (!unshared || (current->get_type() != piece->get_type())) {
+        scope_with_variable.vars.set(var_name, current->add(piece));
+        return true;
+    }
+    current->value += std::static_pointer_cast<StringVariable>(piece)->value;
+    current->value_changed();
+    return true;
+}
+
 Variable Instruction::execute(Scope *scope) {
     switch(op) {
     case Operation::ASSIGN: {
         CHECK_PARAM_SIZE(2);
-        auto var_name = params[0]->var->to_str();
+        const auto &var_name = params[0]->name;
         auto scope_with_variable = scope->scopeWithVariable(var_name);
+        if (scope_with_variable && append_in_place(*scope_with_variable, var_name, *params[1], scope)) {
+            return nullptr;
+        }
         if (!scope_with_variable) {
             scope_with_variable = scope->parentScope.lock()->impl;
         }
@@ -118,17 +155,7 @@ Variable Instruction::execute(Scope *scope) {
     }
     case Operation::ATTR: {
         CHECK_PARAM_SIZE(2);
-        auto var_name = params[0]->var->to_str();
-        auto attr_name = params[1]->var->to_str();
-        auto scope_with_variable = scope->scopeWithVariable(var_name);
-        if (!scope_with_variable) {
-            scope_with_variable = scope->parentScope.lock()->impl;
-        }
-        auto var = scope_with_variable->vars.get(var_name);
-        if (!var->has_attr(attr_name)) {
-            var->set_attr(attr_name, NONE);
-        }
-        return var->get_attr(attr_name);
+        return get_bound_attr(scope->getVariable(params[0]->name), params[1]->name);
     }
     case Operation::ADD: {
         CHECK_PARAM_SIZE(2);
@@ -152,18 +179,32 @@ Variable Instruction::execute(Scope *scope) {
     }
     case Operation::MOD: {
         CHECK_PARAM_SIZE(2);
+        if (percent) {
+            return percent->mod(params[1]->execute(scope));
+        }
         return params[0]->execute(scope)->mod(params[1]->execute(scope));
     }
     case Operation::POW: {
         CHECK_PARAM_SIZE(2);
         return params[0]->execute(scope)->pow(params[1]->execute(scope));
     }
+    case Operation::IN: {
+        CHECK_PARAM_SIZE(2);
+        auto item = params[0]->execute(scope);
+        auto container = params[1]->execute(scope);
+        auto iterable = std::dynamic_pointer_cast<IterableVariable>(container);
+        if (!iterable) {
+            raise_exception("TypeError", "argument of type '" + container->get_class_name() + "' is not iterable");
+            return NONE;
+        }
+        return NEW_BOOL(iterable->contains(item));
+    }
     case Operation::VAR_NAME: {
         CHECK_PARAM_SIZE(0);
         if (!scope) {
             throw std::runtime_error("instruction: scope already destroyed");
         }
-        return scope->getVariable(var->to_str());
+        return scope->getVariable(name);
     }
     case Operation::RET_VALUE: {
         CHECK_PARAM_SIZE(0);
@@ -182,12 +223,28 @@ Variable Instruction::execute(Scope *scope) {
         return func->call((const InstructionParams)(params[1]->params), scope);
     }
     case Operation::FSTRING: {
-        CHECK_PARAM_SIZE(1);
-        std::string str = FStringFormatter(params[0]->execute(scope)->to_str()).format(scope);
-        return NEW_STRING(str);
+        return NEW_STRING(fstring->format(scope));
+    }
+    }
+    return NONE;
+}
+
+// A MOD with a str or bytes literal on the left gets its format compiled once.
+// An invalid format is left to raise when the line runs.
+static void compilePercentFormat(Instruction &instr) {
+    if ((instr.op != Operation::MOD) || (instr.params[0]->op != Operation::RET_VALUE)) {
+        return;
+    }
+    VariableType type = instr.params[0]->var->get_type();
+    if ((type != VariableType::STRING) && (type != VariableType::BYTES)) {
+        return;
     }
+    try {
+        auto format = std::static_pointer_cast<StringVariable>(instr.params[0]->var);
+        instr.percent = std::make_shared<PercentFormatter>(format->value, type == VariableType::BYTES);
+    }
+    catch (const std::runtime_error &) {
     }
-    return std::make_shared<NoneVariable>();
 }
 
 Instruction Instruction::fromTokenList(const TokenList &tokens) {
@@ -252,8 +309,7 @@ Instruction Instruction::fromTokenRange(std::vector<Token>::const_iterator &curr
     for (size_t i = 0; i < result.params.size(); ++i) {
         if ((result.params[i]->op == Operation::TOKEN) && (result.params[i]->token.type == TokenType::FSTRING)) {
             result.params[i]->op = Operation::FSTRING;
-            Variable param = NEW_STRING(result.params[i]->token.value);
-            result.params[i]->params.push_back(std::make_shared<Instruction>(param));
+            result.params[i]->fstring = std::make_shared<FStringFormatter>(result.params[i]->token.value);
         }
     }
 
@@ -277,6 +333,7 @@ Instruction Instruction::fromTokenRange(std::vector<Token>::const_iterator &curr
                             instr->op = pair.second;
                             instr->params.push_back(result.params[i - 1]);
                             instr->params.push_back(result.params[i + 1]);
+                            compilePercentFormat(*instr);
 
                             result.params.erase(result.params.begin() + i - 1, result.params.begin() + i + 2);
                             result.params.insert(result.params.begin() + i - 1, instr);
@@ -301,6 +358,7 @@ Instruction Instruction::fromTokenRange(std::vector<Token>::const_iterator &curr
                      {"%", Operation::MOD}});
     groupByOperator({{"+", Operation::ADD},
                      {"-", Operation::SUB}});
+    groupByOperator({{"in", Operation::IN}});
     groupByOperator({{"=", (context == ParsingConext::IN_ROUND_BRACKETS) ? Operation::KWARG : Operation::ASSIGN}});
 
     if (result.op == Operation::NONE && result.params.size() == 1) {
@@ -325,6 +383,11 @@ Instruction Instruction::fromTokenRange(std::vector<Token>::const_iterator &curr
         }
     }
 
+    // a method call as a whole statement (e.g. `os.putenv(key, value)`)
+    if (result.op == Operation::NONE && result.params.size() == 1 && result.params[0]->op == Operation::CALL) {
+        result = Instruction(*result.params[0]);
+    }
+
     std::function<void(Instruction *instr)> recursivelyParseCommaListInsideBrackets = [&](Instruction *instr) {
         bool in_brackets = (instr->op == Operation::IN_ROUND_BRACKETS)
                         || (instr->op == Operation::IN_SQUARE_BRACKETS)
@@ -24,6 +24,7 @@ enum class Operation {
     INT_DIV,
     MOD,
     POW,
+    IN,
     CALL,
     VAR_NAME,
     RET_VALUE,
@@ -43,6 +44,8 @@ enum class ParsingConext {
 };
 
 class Scope;
+class FStringFormatter;
+class PercentFormatter;
 
 class Instruction {
 public:
@@ -61,7 +64,13 @@ public:
     InstructionParams params;
 
     Variable var;
+    // Interned name of a VAR_NAME, looked up without rehashing the string
+    Atom name;
     Token token;
+    // Compiled template of an FSTRING
+    std::shared_ptr<const FStringFormatter> fstring;
+    // Compiled format of a MOD whose left operand is a str or bytes literal
+    std::shared_ptr<const PercentFormatter> percent;
 
     std::string debug_string(int indent_level=0);
 };
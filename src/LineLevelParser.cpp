@@ -1,4 +1,5 @@
 #include "LineLevelParser.h"
+#include "StringSearch.h"
 
 #include <stdexcept>
 
@@ -7,16 +8,7 @@ namespace MiniPython {
 std::string replace_all(const std::string &input,
                         const std::string &pattern,
                         const std::string &repalcement) {
-    std::string result;
-    int current_pos = 0;
-    int found_pos;
-    while ((found_pos = input.find(pattern, current_pos)) != std::string::npos) {
-        result += input.substr(current_pos, found_pos - current_pos);
-        result += repalcement;
-        current_pos = found_pos + pattern.size();
-    }
-    result += input.substr(current_pos);
-    return result;
+    return StringSearch::replace(input, pattern, repalcement);
 }
 
 Lines stringToLines(const std::string &data) {
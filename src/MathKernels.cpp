@@ -0,0 +1,405 @@
+#include "MathKernels.h"
+#include "RaiseException.h"
+#include "Utils.h"
+
+#include <cmath>
+#include <immintrin.h>
+#include <vector>
+
+namespace MiniPython {
+
+namespace MathKernels {
+
+#define AVX2 __attribute__((target("avx2")))
+#define AVX512 __attribute__((target("avx512f")))
+
+template<double (*FUNCTION)(double)>
+static void scalar(const double *in, double *out, size_t count) {
+    for (size_t i = 0; i < count; ++i) {
+        out[i] = FUNCTION(in[i]);
+    }
+}
+
+static double scalar_sqrt(double x) { return std::sqrt(x); }
+static double scalar_exp(double x) { return std::exp(x); }
+static double scalar_log(double x) { return std::log(x); }
+static double scalar_sin(double x) { return std::sin(x); }
+static double scalar_cos(double x) { return std::cos(x); }
+static double scalar_tan(double x) { return std::tan(x); }
+
+// -------------------------------- AVX2 --------------------------------------
+
+AVX2 static inline __m256d set(double value) {
+    return _mm256_set1_pd(value);
+}
+
+// a + b * c without fused multiply-add, so the results don't depend on FMA support
+AVX2 static inline __m256d mul_add(__m256d b, __m256d c, __m256d a) {
+    return _mm256_add_pd(a, _mm256_mul_pd(b, c));
+}
+
+// 2^k for integral k in [-1022, 1023]
+AVX2 static inline __m256d pow2(__m256d k) {
+    __m128i k32 = _mm256_cvtpd_epi32(k);
+    __m256i k64 = _mm256_cvtepi32_epi64(k32);
+    return _mm256_castsi256_pd(_mm256_slli_epi64(_mm256_add_epi64(k64, _mm256_set1_epi64x(1023)), 52));
+}
+
+AVX2 static inline bool all_in_range(__m256d x, double low, double high) {
+    // Comparisons with NaN are false, so NaNs fail the check too
+    __m256d in_range = _mm256_and_pd(_mm256_cmp_pd(x, set(low), _CMP_GE_OQ), _mm256_cmp_pd(x, set(high), _CMP_LE_OQ));
+    return _mm256_movemask_pd(in_range) == 0xf;
+}
+
+// Runs VECTOR over blocks of 4 where CHECK passes and SCALAR elsewhere
+template<bool (*CHECK)(__m256d), __m256d (*VECTOR)(__m256d), double (*SCALAR)(double)>
+AVX2 static void run_avx2(const double *in, double *out, size_t count) {
+    size_t i = 0;
+    for (; i + 4 <= count; i += 4) {
+        __m256d x = _mm256_loadu_pd(in + i);
+        if (CHECK(x)) {
+            _mm256_storeu_pd(out + i, VECTOR(x));
+        }
+        else {
+            for (size_t j = i; j < i + 4; ++j) {
+                out[j] = SCALAR(in[j]);
+            }
+        }
+    }
+    for (; i < count; ++i) {
+        out[i] = SCALAR(in[i]);
+    }
+}
+
+AVX2 static void sqrt_avx2(const double *in, double *out, size_t count) {
+    size_t i = 0;
+    for (; i + 4 <= count; i += 4) {
+        _mm256_storeu_pd(out + i, _mm256_sqrt_pd(_mm256_loadu_pd(in + i)));
+    }
+    for (; i < count; ++i) {
+        out[i] = std::sqrt(in[i]);
+    }
+}
+
+static constexpr double LN2_HI = 6.93147180369123816490e-01;
+static constexpr double LN2_LO = 1.90821492927058770002e-10;
+static constexpr double INV_LN2 = 1.44269504088896338700e+00;
+
+AVX2 static inline bool exp_check(__m256d x) {
+    // Keeps 2^k representable
+    return all_in_range(x, -708.0, 709.0);
+}
+
+// fdlibm's e_exp.c: x = k*ln2 + r, exp(r) from a rational approximation
+AVX2 static inline __m256d exp_avx2_block(__m256d x) {
+    __m256d k = _mm256_round_pd(_mm256_mul_pd(x, set(INV_LN2)), _MM_FROUND_TO_NEAREST_INT | _MM_FROUND_NO_EXC);
+    __m256d hi = _mm256_sub_pd(x, _mm256_mul_pd(k, set(LN2_HI)));
+    __m256d lo = _mm256_mul_pd(k, set(LN2_LO));
+    __m256d r = _mm256_sub_pd(hi, lo);
+    __m256d t = _mm256_mul_pd(r, r);
+
+    __m256d p = set(4.13813679705723846039e-08);
+    p = mul_add(p, t, set(-1.65339022054652515390e-06));
+    p = mul_add(p, t, set(6.61375632143793436117e-05));
+    p = mul_add(p, t, set(-2.77777777770155933842e-03));
+    p = mul_add(p, t, set(1.66666666666666019037e-01));
+    __m256d c = _mm256_sub_pd(r, _mm256_mul_pd(t, p));
+
+    // 1 - ((lo - r*c/(2-c)) - hi)
+    __m256d quotient = _mm256_div_pd(_mm256_mul_pd(r, c), _mm256_sub_pd(set(2.0), c));
+    __m256d y = _mm256_sub_pd(set(1.0), _mm256_sub_pd(_mm256_sub_pd(lo, quotient), hi));
+    return _mm256_mul_pd(y, pow2(k));
+}
+
+AVX2 static inline bool log_check(__m256d x) {
+    // Positive normal numbers
+    return all_in_range(x, 2.2250738585072014e-308, 1.7976931348623157e308);
+}
+
+// fdlibm's e_log.c: x = 2^k * (1+f) with 1+f in [sqrt(2)/2, sqrt(2))
+AVX2 static inline __m256d log_avx2_block(__m256d x) {
+    __m256i bits = _mm256_castpd_si256(x);
+    __m256i exponent = _mm256_sub_epi64(_mm256_srli_epi64(bits, 52), _mm256_set1_epi64x(1023));
+    __m256d m = _mm256_castsi256_pd(_mm256_or_si256(
+        _mm256_and_si256(bits, _mm256_set1_epi64x(0x000fffffffffffffLL)),
+        _mm256_set1_epi64x(0x3ff0000000000000LL)));
+
+    // m in [1, 2), move the upper part to [sqrt(2)/2, 1)
+    __m256d above = _mm256_cmp_pd(m, set(1.4142135623730951), _CMP_GT_OQ);
+    m = _mm256_blendv_pd(m, _mm256_mul_pd(m, set(0.5)), above);
+    exponent = _mm256_sub_epi64(exponent, _mm256_castpd_si256(above));
+
+    // int64 -> double, exact for |exponent| < 2^51
+    __m256d magic = set(6755399441055744.0);
+    __m256d k = _mm256_sub_pd(_mm256_castsi256_pd(_mm256_add_epi64(exponent, _mm256_castpd_si256(magic))), magic);
+
+    __m256d f = _mm256_sub_pd(m, set(1.0));
+    __m256d s = _mm256_div_pd(f, _mm256_add_pd(set(2.0), f));
+    __m256d z = _mm256_mul_pd(s, s);
+
+    __m256d r = set(1.479819860511658591e-01);
+    r = mul_add(r, z, set(1.531383769920937332e-01));
+    r = mul_add(r, z, set(1.818357216161805012e-01));
+    r = mul_add(r, z, set(2.222219843214978396e-01));
+    r = mul_add(r, z, set(2.857142874366239149e-01));
+    r = mul_add(r, z, set(3.999999999940941908e-01));
+    r = mul_add(r, z, set(6.666666666666735130e-01));
+    r = _mm256_mul_pd(r, z);
+
+    // k*ln2_hi - ((hfsq - (s*(hfsq+R) + k*ln2_lo)) - f)
+    __m256d hfsq = _mm256_mul_pd(set(0.5), _mm256_mul_pd(f, f));
+    __m256d inner = _mm256_add_pd(_mm256_mul_pd(s, _mm256_add_pd(hfsq, r)), _mm256_mul_pd(k, set(LN2_LO)));
+    return _mm256_sub_pd(_mm256_mul_pd(k, set(LN2_HI)), _mm256_sub_pd(_mm256_sub_pd(hfsq, inner), f));
+}
+
+AVX2 static inline bool trig_check(__m256d x) {
+    // |q| < 2^20 keeps the products with the 33-bit parts of pi/2 below exact
+    return all_in_range(x, -1e5, 1e5);
+}
+
+// a - b as hi + lo exactly (Knuth's TwoSum, no ordering of |a| and |b| needed)
+AVX2 static inline __m256d exact_sub(__m256d a, __m256d b, __m256d &lo) {
+    __m256d hi = _mm256_sub_pd(a, b);
+    __m256d a_part = _mm256_add_pd(hi, b);
+    __m256d b_part = _mm256_sub_pd(a_part, hi);
+    lo = _mm256_add_pd(_mm256_sub_pd(a, a_part), _mm256_sub_pd(b_part, b));
+    return hi;
+}
+
+// fdlibm's __ieee754_rem_pio2 for medium arguments: x = q*pi/2 + hi + lo with
+// |hi| <= pi/4. pi/2 is split into three 33-bit parts and a tail; the rounding
+// error of every subtraction is kept, so no precision is lost when x is close
+// to a multiple of pi/2.
+AVX2 static inline __m256d reduce_pi_2(__m256d x, __m256d &q, __m256d &lo) {
+    q = _mm256_round_pd(_mm256_mul_pd(x, set(6.36619772367581382433e-01)), _MM_FROUND_TO_NEAREST_INT | _MM_FROUND_NO_EXC);
+    __m256d error1, error2;
+    __m256d r = _mm256_sub_pd(x, _mm256_mul_pd(q, set(1.57079632673412561417e+00)));
+    r = exact_sub(r, _mm256_mul_pd(q, set(6.07710050630396597660e-11)), error1);
+    r = exact_sub(r, _mm256_mul_pd(q, set(2.02226624871116645580e-21)), error2);
+    __m256d tail = _mm256_sub_pd(_mm256_add_pd(error1, error2), _mm256_mul_pd(q, set(8.47842766036889956997e-32)));
+    __m256d hi = _mm256_add_pd(r, tail);
+    lo = _mm256_sub_pd(tail, _mm256_sub_pd(hi, r));
+    return hi;
+}
+
+// fdlibm's __kernel_sin on [-pi/4, pi/4], for the argument x + y
+AVX2 static inline __m256d kernel_sin(__m256d x, __m256d y) {
+    __m256d z = _mm256_mul_pd(x, x);
+    __m256d v = _mm256_mul_pd(z, x);
+    __m256d r = set(1.58969099521155010221e-10);
+    r = mul_add(r, z, set(-2.50507602534068634195e-08));
+    r = mul_add(r, z, set(2.75573137070700676789e-06));
+    r = mul_add(r, z, set(-1.98412698298579493134e-04));
+    r = mul_add(r, z, set(8.33333333332248946124e-03));
+    // x - ((z*(y/2 - v*r) - y) - v*S1)
+    __m256d inner = _mm256_mul_pd(z, _mm256_sub_pd(_mm256_mul_pd(set(0.5), y), _mm256_mul_pd(v, r)));
+    __m256d sum = _mm256_sub_pd(_mm256_sub_pd(inner, y), _mm256_mul_pd(v, set(-1.66666666666666324348e-01)));
+    return _mm256_sub_pd(x, sum);
+}
+
+// fdlibm's __kernel_cos on [-pi/4, pi/4], for the argument x + y
+AVX2 static inline __m256d kernel_cos(__m256d x, __m256d y) {
+    __m256d z = _mm256_mul_pd(x, x);
+    __m256d r = set(-1.13596475577881948265e-11);
+    r = mul_add(r, z, set(2.08757232129817482790e-09));
+    r = mul_add(r, z, set(-2.75573143513906633035e-07));
+    r = mul_add(r, z, set(2.48015872894767294178e-05));
+    r = mul_add(r, z, set(-1.38888888888741095749e-03));
+    r = mul_add(r, z, set(4.16666666666666019037e-02));
+    r = _mm256_mul_pd(z, r);
+    __m256d hz = _mm256_mul_pd(set(0.5), z);
+    __m256d w = _mm256_sub_pd(set(1.0), hz);
+    __m256d correction = _mm256_add_pd(_mm256_sub_pd(_mm256_sub_pd(set(1.0), w), hz),
+                                       _mm256_sub_pd(_mm256_mul_pd(z, r), _mm256_mul_pd(x, y)));
+    return _mm256_add_pd(w, correction);
+}
+
+// Masks of the lanes where bit 0 / bit 1 of the quadrant is set
+AVX2 static inline void quadrant_masks(__m256d q, __m256d &odd, __m256d &upper) {
+    __m256i quadrant = _mm256_cvtepi32_epi64(_mm256_cvtpd_epi32(q));
+    odd = _mm256_castsi256_pd(_mm256_cmpeq_epi64(
+        _mm256_and_si256(quadrant, _mm256_set1_epi64x(1)), _mm256_set1_epi64x(1)));
+    upper = _mm256_castsi256_pd(_mm256_cmpeq_epi64(
+        _mm256_and_si256(quadrant, _mm256_set1_epi64x(2)), _mm256_set1_epi64x(2)));
+}
+
+AVX2 static inline __m256d negate_where(__m256d x, __m256d mask) {
+    return _mm256_xor_pd(x, _mm256_and_pd(mask, set(-0.0)));
+}
+
+AVX2 static inline __m256d sin_avx2_block(__m256d x) {
+    __m256d q, lo, odd, upper;
+    __m256d r = reduce_pi_2(x, q, lo);
+    quadrant_masks(q, odd, upper);
+    // sin, cos, -sin, -cos
+    __m256d result = _mm256_blendv_pd(kernel_sin(r, lo), kernel_cos(r, lo), odd);
+    return negate_where(result, upper);
+}
+
+AVX2 static inline __m256d cos_avx2_block(__m256d x) {
+    __m256d q, lo, odd, upper;
+    __m256d r = reduce_pi_2(x, q, lo);
+    quadrant_masks(q, odd, upper);
+    // cos, -sin, -cos, sin
+    __m256d result = _mm256_blendv_pd(kernel_cos(r, lo), kernel_sin(r, lo), odd);
+    return negate_where(result, _mm256_xor_pd(odd, upper));
+}
+
+AVX2 static inline __m256d tan_avx2_block(__m256d x) {
+    __m256d q, lo, odd, upper;
+    __m256d r = reduce_pi_2(x, q, lo);
+    quadrant_masks(q, odd, upper);
+    // sin/cos, or -cos/sin in odd quadrants
+    __m256d s = kernel_sin(r, lo);
+    __m256d c = kernel_cos(r, lo);
+    __m256d result = _mm256_div_pd(_mm256_blendv_pd(s, c, odd), _mm256_blendv_pd(c, s, odd));
+    return negate_where(result, odd);
+}
+
+// ------------------------------- AVX-512 ------------------------------------
+
+AVX512 static void sqrt_avx512(const double *in, double *out, size_t count) {
+    size_t i = 0;
+    for (; i + 8 <= count; i += 8) {
+        _mm512_storeu_pd(out + i, _mm512_sqrt_pd(_mm512_loadu_pd(in + i)));
+    }
+    if (i < count) {
+        __mmask8 tail = (1u << (count - i)) - 1;
+        _mm512_mask_storeu_pd(out + i, tail, _mm512_sqrt_pd(_mm512_maskz_loadu_pd(tail, in + i)));
+    }
+}
+
+// ------------------------------- Dispatch -----------------------------------
+
+void sqrt(const double *in, double *out, size_t count) {
+    if (cpu_features().avx512f) {
+        sqrt_avx512(in, out, count);
+    }
+    else if (cpu_features().avx2) {
+        sqrt_avx2(in, out, count);
+    }
+    else {
+        scalar<scalar_sqrt>(in, out, count);
+    }
+}
+
+void exp(const double *in, double *out, size_t count) {
+    if (cpu_features().avx2) {
+        run_avx2<exp_check, exp_avx2_block, scalar_exp>(in, out, count);
+    }
+    else {
+        scalar<scalar_exp>(in, out, count);
+    }
+}
+
+void log(const double *in, double *out, size_t count) {
+    if (cpu_features().avx2) {
+        run_avx2<log_check, log_avx2_block, scalar_log>(in, out, count);
+    }
+    else {
+        scalar<scalar_log>(in, out, count);
+    }
+}
+
+void sin(const double *in, double *out, size_t count) {
+    if (cpu_features().avx2) {
+        run_avx2<trig_check, sin_avx2_block, scalar_sin>(in, out, count);
+    }
+    else {
+        scalar<scalar_sin>(in, out, count);
+    }
+}
+
+void cos(const double *in, double *out, size_t count) {
+    if (cpu_features().avx2) {
+        run_avx2<trig_check, cos_avx2_block, scalar_cos>(in, out, count);
+    }
+    else {
+        scalar<scalar_cos>(in, out, count);
+    }
+}
+
+void tan(const double *in, double *out, size_t count) {
+    if (cpu_features().avx2) {
+        run_avx2<trig_check, tan_avx2_block, scalar_tan>(in, out, count);
+    }
+    else {
+        scalar<scalar_tan>(in, out, count);
+    }
+}
+
+// CPython's math_fsum: keeps non-overlapping partial sums, so nothing is ever rounded away
+double fsum(const double *values, size_t count) {
+    std::vector<double> partials;
+    double special_sum = 0;
+    double inf_sum = 0;
+
+    for (size_t i = 0; i < count; ++i) {
+        double x = values[i];
+        double original = x;
+
+        size_t used = 0;
+        for (double y: partials) {
+            if (std::fabs(x) < std::fabs(y)) {
+                std::swap(x, y);
+            }
+            double hi = x + y;
+            double lo = y - (hi - x);
+            if (lo != 0) {
+                partials[used++] = lo;
+            }
+            x = hi;
+        }
+
+        if (!std::isfinite(x)) {
+            // inf and nan don't take part in the exact sum, finite values must not reach them
+            if (std::isfinite(original)) {
+                raise_exception("OverflowError", "intermediate overflow in fsum");
+            }
+            special_sum += original;
+            inf_sum += std::isinf(original) ? original : 0;
+            partials.clear();
+            continue;
+        }
+        partials.resize(used);
+        partials.push_back(x);
+    }
+
+    if (special_sum != 0 || std::isnan(special_sum)) {
+        if (std::isnan(inf_sum)) {
+            raise_exception("ValueError", "-inf + inf in fsum");
+        }
+        return special_sum;
+    }
+
+    // Sum from the top, then round half to even using the next partial
+    double hi = 0;
+    if (!partials.empty()) {
+        size_t n = partials.size();
+        hi = partials[--n];
+        double lo = 0;
+        while (n > 0) {
+            double x = hi;
+            double y = partials[--n];
+            hi = x + y;
+            double yr = hi - x;
+            lo = y - yr;
+            if (lo != 0) {
+                break;
+            }
+        }
+        if (n > 0 && ((lo < 0 && partials[n - 1] < 0) || (lo > 0 && partials[n - 1] > 0))) {
+            double y = lo * 2;
+            double x = hi + y;
+            double yr = x - hi;
+            if (y == yr) {
+                hi = x;
+            }
+        }
+    }
+    return hi;
+}
+
+} // namespace MathKernels
+
+} // namespace MiniPython
@@ -0,0 +1,35 @@
+#pragma once
+
+#include <cstddef>
+
+namespace MiniPython {
+
+/**
+ * @brief math functions over arrays of doubles
+ *
+ * The implementation is picked at runtime: AVX-512 or AVX2 when the CPU has it,
+ * plain loops over <cmath> otherwise. Vector exp, log, sin, cos and tan follow
+ * fdlibm and stay within 1-2 ulp of <cmath>; blocks containing values outside
+ * the range the vector code handles (inf, nan, huge arguments) go to <cmath>.
+ * sqrt is exact everywhere.
+ *
+ * in and out may be the same array.
+ */
+namespace MathKernels {
+
+using Kernel = void (*)(const double *in, double *out, size_t count);
+
+void sqrt(const double *in, double *out, size_t count);
+void exp(const double *in, double *out, size_t count);
+void log(const double *in, double *out, size_t count);
+void sin(const double *in, double *out, size_t count);
+void cos(const double *in, double *out, size_t count);
+void tan(const double *in, double *out, size_t count);
+
+// Correctly rounded sum (Shewchuk's algorithm, same as Python's math.fsum)
+// Raises ValueError for inf + -inf and OverflowError when finite values overflow
+double fsum(const double *values, size_t count);
+
+} // namespace MathKernels
+
+} // namespace MiniPython
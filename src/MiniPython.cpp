@@ -8,43 +8,161 @@
 
 namespace MiniPython {
 
-void runFromString(const std::string &fileContent) {
+Program::Program(std::shared_ptr<const CompiledScope> _code)
+    : code(_code)
+    {}
+
+Program Program::fromString(const std::string &fileContent) {
     LineTree lineTree(fileContent);
-    auto scope = makeScope(lineTree);
-
-    scope->setVariable("print", std::make_shared<FunctionVariable>(StandardFunctions::print));
-    scope->setVariable("min", std::make_shared<FunctionVariable>(StandardFunctions::min));
-    scope->setVariable("max", std::make_shared<FunctionVariable>(StandardFunctions::max));
-    scope->setVariable("pow", std::make_shared<FunctionVariable>(StandardFunctions::pow));
-    scope->setVariable("bool", std::make_shared<FunctionVariable>(StandardFunctions::bool_func));
-    scope->setVariable("hex", std::make_shared<FunctionVariable>(StandardFunctions::hex));
-    scope->setVariable("ord", std::make_shared<FunctionVariable>(StandardFunctions::ord));
-    scope->setVariable("len", std::make_shared<FunctionVariable>(StandardFunctions::len));
-    scope->setVariable("list", std::make_shared<FunctionVariable>(StandardFunctions::list));
-    scope->setVariable("tuple", std::make_shared<FunctionVariable>(StandardFunctions::list));
-    scope->setVariable("set", std::make_shared<FunctionVariable>(StandardFunctions::set));
-    scope->setVariable("frozenset", std::make_shared<FunctionVariable>(StandardFunctions::set));
-    scope->setVariable("eval", std::make_shared<FunctionVariable>(StandardFunctions::eval));
-
-    scope->setVariable("array", std::static_pointer_cast<GenericVariable>(std::make_shared<array>()));
-    scope->setVariable("base64", std::static_pointer_cast<GenericVariable>(std::make_shared<base64>()));
-    scope->setVariable("binascii", std::static_pointer_cast<GenericVariable>(std::make_shared<binascii>()));
-    scope->setVariable("gc", std::static_pointer_cast<GenericVariable>(std::make_shared<gc>()));
-    scope->setVariable("ipaddress", std::static_pointer_cast<GenericVariable>(std::make_shared<ipaddress>()));
-    scope->setVariable("math", std::static_pointer_cast<GenericVariable>(std::make_shared<math>()));
-    scope->setVariable("os", std::static_pointer_cast<GenericVariable>(std::make_shared<os>()));
-    scope->setVariable("sys", std::static_pointer_cast<GenericVariable>(std::make_shared<sys>()));
-    scope->setVariable("time", std::static_pointer_cast<GenericVariable>(std::make_shared<time>()));
-
-    scope->execute();
+    return Program(compileScope(lineTree));
 }
 
-void runFromFile(const std::string &filename) {
+Program Program::fromFile(const std::string &filename) {
     std::ifstream f(filename);
     std::string str((std::istreambuf_iterator<char>(f)),
                      std::istreambuf_iterator<char>());
 
-    runFromString(str);
+    return fromString(str);
+}
+
+void Program::run() const {
+    Interpreter().run(*this);
+}
+
+void Program::run(const std::shared_ptr<Scope> &globals) const {
+    executeCompiledScope(*code, globals);
+}
+
+Interpreter::Interpreter()
+    : builtins(std::make_shared<ScopeImpl>())
+{
+    auto &vars = builtins->vars;
+
+    vars.set("print", std::make_shared<FunctionVariable>(StandardFunctions::print));
+    vars.set("min", std::make_shared<FunctionVariable>(StandardFunctions::min));
+    vars.set("max", std::make_shared<FunctionVariable>(StandardFunctions::max));
+    vars.set("pow", std::make_shared<FunctionVariable>(StandardFunctions::pow));
+    vars.set("bool", std::make_shared<FunctionVariable>(StandardFunctions::bool_func));
+    vars.set("hex", std::make_shared<FunctionVariable>(StandardFunctions::hex));
+    vars.set("ord", std::make_shared<FunctionVariable>(StandardFunctions::ord));
+    vars.set("len", std::make_shared<FunctionVariable>(StandardFunctions::len));
+    vars.set("memoryview", std::make_shared<FunctionVariable>(StandardFunctions::memoryview));
+    vars.set("open", std::make_shared<FunctionVariable>(StandardFunctions::open));
+    vars.set("getattr", std::make_shared<FunctionVariable>(StandardFunctions::getattr));
+    vars.set("setattr", std::make_shared<FunctionVariable>(StandardFunctions::setattr));
+    vars.set("hasattr", std::make_shared<FunctionVariable>(StandardFunctions::hasattr));
+    vars.set("list", std::make_shared<FunctionVariable>(StandardFunctions::list));
+    vars.set("tuple", std::make_shared<FunctionVariable>(StandardFunctions::list));
+    vars.set("set", std::make_shared<FunctionVariable>(StandardFunctions::set));
+    vars.set("frozenset", std::make_shared<FunctionVariable>(StandardFunctions::set));
+    vars.set("eval", std::make_shared<FunctionVariable>(StandardFunctions::eval));
+    vars.set("format", std::make_shared<FunctionVariable>(StandardFunctions::format));
+
+    modules = {
+        std::make_shared<LazyModule>(make_module<array>),
+        std::make_shared<LazyModule>(make_module<base64>),
+        std::make_shared<LazyModule>(make_module<binascii>),
+        std::make_shared<LazyModule>(make_module<gc>),
+        std::make_shared<LazyModule>(make_module<hashlib>),
+        std::make_shared<LazyModule>(make_module<ipaddress>),
+        std::make_shared<LazyModule>(make_module<math>),
+        std::make_shared<LazyModule>(make_module<os>),
+        std::make_shared<LazyModule>(make_module<sys>),
+        std::make_shared<LazyModule>(make_module<time>),
+        std::make_shared<LazyModule>(make_module<zlib>),
+    };
+
+    vars.set("array", modules[0]);
+    vars.set("base64", modules[1]);
+    vars.set("binascii", modules[2]);
+    vars.set("gc", modules[3]);
+    vars.set("hashlib", modules[4]);
+    vars.set("ipaddress", modules[5]);
+    vars.set("math", modules[6]);
+    vars.set("os", modules[7]);
+    vars.set("sys", modules[8]);
+    vars.set("time", modules[9]);
+    vars.set("zlib", modules[10]);
+
+    globalScope = makeGlobals();
+}
+
+std::shared_ptr<Scope> Interpreter::makeGlobals() const {
+    auto globals = std::make_shared<Scope>();
+    globals->impl->builtins = builtins;
+    return globals;
+}
+
+std::shared_ptr<Scope> Interpreter::globals() const {
+    return globalScope;
+}
+
+void Interpreter::run(const Program &program) {
+    program.run(globalScope);
+}
+
+void Interpreter::reset() {
+    globalScope->impl->vars.clear();
+    for (auto &module: modules) {
+        module->reset();
+    }
+}
+
+InterpreterPool::Lease::Lease(InterpreterPool &_pool, Interpreter *_interpreter)
+    : pool(&_pool)
+    , interpreter(_interpreter)
+    {}
+
+InterpreterPool::Lease::Lease(Lease &&other)
+    : pool(other.pool)
+    , interpreter(other.interpreter)
+{
+    other.interpreter = nullptr;
+}
+
+InterpreterPool::Lease::~Lease() {
+    if (interpreter) {
+        pool->release(interpreter);
+    }
+}
+
+InterpreterPool::InterpreterPool(size_t size) {
+    for (size_t i = 0; i < size; ++i) {
+        interpreters.push_back(std::make_unique<Interpreter>());
+        free.push_back(interpreters.back().get());
+    }
+}
+
+InterpreterPool::Lease InterpreterPool::acquire() {
+    std::unique_lock lock(mutex);
+    freed.wait(lock, [this]() { return !free.empty(); });
+
+    auto interpreter = free.back();
+    free.pop_back();
+    return Lease(*this, interpreter);
+}
+
+void InterpreterPool::release(Interpreter *interpreter) {
+    // Reset outside of the lock, it is the slowest part
+    interpreter->reset();
+
+    {
+        std::lock_guard lock(mutex);
+        free.push_back(interpreter);
+    }
+    freed.notify_one();
+}
+
+void InterpreterPool::run(const Program &program) {
+    acquire()->run(program);
+}
+
+void runFromString(const std::string &fileContent) {
+    Program::fromString(fileContent).run();
+}
+
+void runFromFile(const std::string &filename) {
+    Program::fromFile(filename).run();
 }
 
 } // namespace MiniPython
@@ -1,35 +1,40 @@
 #include "Scope.h"
 #include "LineLevelParser.h"
 
-#include <algorithm>
-#include <array>
 #include <stdexcept>
 
 namespace MiniPython {
 
-bool Variables::has(const std::string &name) {
+bool Variables::has(const Atom &name) {
     return vars.find(name) != vars.end();
 }
 
-Variable Variables::get(const std::string &name) {
+Variable Variables::get(const Atom &name) {
     auto it = vars.find(name);
     if (it == vars.end()) {
-        throw std::runtime_error(std::string("Variable '") + name + "' does not exist");
+        throw std::runtime_error(std::string("Variable '") + name.str() + "' does not exist");
     }
     return it->second;
 }
 
-void Variables::set(const std::string &name, Variable value) {
+void Variables::set(const Atom &name, Variable value) {
     vars[name] = value;
 }
 
+void Variables::clear() {
+    vars.clear();
+}
+
 Scope::Scope()
     : impl(std::make_shared<ScopeImpl>())
     {}
 
-std::shared_ptr<Scope> makeScope(const LineTree &lineTree, bool isTopLevel) {
-    auto scope = std::make_shared<Scope>();
-    scope->impl = std::make_shared<ScopeImpl>();
+Scope::Scope(std::shared_ptr<ScopeImpl> _impl)
+    : impl(_impl)
+    {}
+
+std::shared_ptr<const CompiledScope> compileScope(const LineTree &lineTree, bool isTopLevel) {
+    auto compiled = std::make_shared<CompiledScope>();
 
     auto tokenList = tokenizeLine(lineTree.value);
 
@@ -45,11 +50,21 @@ std::shared_ptr<Scope> makeScope(const LineTree &lineTree, bool isTopLevel) {
         }
     }
 
-    scope->impl->type = scopeType;
-    scope->impl->instruction = Instruction::fromTokenList(tokenList);
+    compiled->type = scopeType;
+    compiled->instruction = std::make_shared<Instruction>(Instruction::fromTokenList(tokenList));
 
     for (const auto& childTree : lineTree.children) {
-        auto newChild = makeScope(*childTree, false);
+        compiled->children.push_back(compileScope(*childTree, false));
+    }
+
+    return compiled;
+}
+
+std::shared_ptr<Scope> makeScope(const CompiledScope &compiled) {
+    auto scope = std::make_shared<Scope>(std::make_shared<ScopeImpl>(compiled.type, compiled.instruction));
+
+    for (const auto& compiledChild : compiled.children) {
+        auto newChild = makeScope(*compiledChild);
         newChild->parentScope = scope;
         newChild->impl->parent = scope->impl;
         scope->impl->children.push_back(newChild);
@@ -58,8 +73,37 @@ std::shared_ptr<Scope> makeScope(const LineTree &lineTree, bool isTopLevel) {
     return scope;
 }
 
+std::shared_ptr<Scope> makeScope(const LineTree &lineTree, bool isTopLevel) {
+    return makeScope(*compileScope(lineTree, isTopLevel));
+}
+
+Variable executeCompiledScope(const CompiledScope &compiled, const std::shared_ptr<Scope> &globals) {
+    auto res = compiled.instruction->execute(globals.get());
+
+    // Lines without nested blocks don't keep any state of their own,
+    // so they all share one Scope object instead of allocating one per line
+    auto line = std::make_shared<Scope>(std::make_shared<ScopeImpl>(ScopeType::ORDINARY_LINE, nullptr));
+    line->parentScope = globals;
+    line->impl->parent = globals->impl;
+
+    for (const auto& compiledChild : compiled.children) {
+        if ((compiledChild->type == ScopeType::ORDINARY_LINE) && compiledChild->children.empty()) {
+            line->impl->instruction = compiledChild->instruction;
+            res = line->execute();
+            continue;
+        }
+
+        auto block = makeScope(*compiledChild);
+        block->parentScope = globals;
+        block->impl->parent = globals->impl;
+        res = block->execute();
+    }
+
+    return res;
+}
+
 Variable Scope::execute() {
-    auto res = impl->instruction.execute(this);
+    auto res = impl->instruction->execute(this);
     switch (impl->type) {
     case ScopeType::TOP_LEVEL:
         for (auto child: impl->children) {
@@ -100,14 +144,30 @@ bool ScopeImpl::isTopLevelScope() {
     return type == ScopeType::TOP_LEVEL;
 }
 
-Variable Scope::call(const std::string &name, const InstructionParams &params) {
-    auto scope = scopeWithVariable(name);
-    if (!scope) {
-        throw std::runtime_error("Function not defined");
+std::shared_ptr<ScopeImpl> ScopeImpl::topLevelScope() {
+    if (isTopLevelScope()) {
+        return shared_from_this();
     }
 
-    if (!scope->vars.has(name)) {
-        throw std::runtime_error("Variable is not in scope");
+    auto parentImpl = parent.lock();
+    if (!parentImpl) {
+        throw std::runtime_error("Parent scope already destroyed");
+    }
+    return parentImpl->topLevelScope();
+}
+
+static const Atom NONE_NAME("None");
+static const Atom FALSE_NAME("False");
+static const Atom TRUE_NAME("True");
+
+static bool isReservedName(const Atom &name) {
+    return (name == NONE_NAME) || (name == FALSE_NAME) || (name == TRUE_NAME);
+}
+
+Variable Scope::call(const Atom &name, const InstructionParams &params) {
+    auto scope = scopeWithVariable(name, true);
+    if (!scope) {
+        throw std::runtime_error("Function not defined");
     }
 
     auto var = scope->vars.get(name);
@@ -119,10 +179,9 @@ Variable Scope::call(const std::string &name, const InstructionParams &params) {
     return func->call(params, this);
 }
 
-void Scope::setVariable(const std::string &name, Variable value) {
-    static std::array<std::string, 3> reserved_names = {"None", "False", "True"};
-    if (std::find(std::begin(reserved_names), std::end(reserved_names), name) != std::end(reserved_names)) {
-        throw std::runtime_error("Cannot assing to variable '" + name + "': the name is reserved");
+void Scope::setVariable(const Atom &name, Variable value) {
+    if (isReservedName(name)) {
+        throw std::runtime_error("Cannot assing to variable '" + name.str() + "': the name is reserved");
     }
 
     auto scope = scopeWithVariable(name);
@@ -137,33 +196,41 @@ void Scope::setVariable(const std::string &name, Variable value) {
     }
 }
 
-Variable Scope::getVariable(const std::string &name) {
-    auto scope = scopeWithVariable(name);
-
-    if (!scope) {
-        throw std::runtime_error("Variable not found " + name);
+Variable Scope::getVariable(const Atom &name) {
+    if (name == TRUE_NAME) {
+        return TRUE;
     }
 
-    if (name == "True") {
-        return std::make_shared<BoolVariable>(true);
+    if (name == FALSE_NAME) {
+        return FALSE;
     }
 
-    if (name == "False") {
-        return std::make_shared<BoolVariable>(false);
+    if (name == NONE_NAME) {
+        return NONE;
     }
 
-    if (name == "None") {
-        return std::make_shared<NoneVariable>();
+    auto scope = scopeWithVariable(name, true);
+
+    if (!scope) {
+        throw std::runtime_error("Variable not found " + name.str());
     }
 
     return scope->vars.get(name);
 }
 
-std::shared_ptr<ScopeImpl> Scope::scopeWithVariable(const std::string &name) {
+Variable Scope::getBuiltin(const Atom &name) {
+    auto builtins = impl->topLevelScope()->builtins;
+    if (!builtins) {
+        throw std::runtime_error("Builtin not found " + name.str());
+    }
+    return builtins->vars.get(name);
+}
+
+std::shared_ptr<ScopeImpl> Scope::scopeWithVariable(const Atom &name, bool include_builtins) {
     std::shared_ptr<ScopeImpl> curr = impl;
 
     while (true) {
-        if ((name == "True") || (name == "False") || (name == "None")) {
+        if (isReservedName(name)) {
             return curr;
         }
 
@@ -182,6 +249,10 @@ std::shared_ptr<ScopeImpl> Scope::scopeWithVariable(const std::string &name) {
         curr = parent;
     }
 
+    if (include_builtins && curr->builtins && curr->builtins->vars.has(name)) {
+        return curr->builtins;
+    }
+
     return nullptr;
 }
 
@@ -9,13 +9,15 @@
 
 namespace MiniPython {
 
+// Keyed on atoms, so a lookup hashes and compares pointers only
 class Variables {
 public:
-    bool has(const std::string &name);
-    Variable get(const std::string &name);
-    void set(const std::string &name, Variable value);
+    bool has(const Atom &name);
+    Variable get(const Atom &name);
+    void set(const Atom &name, Variable value);
+    void clear();
 private:
-    std::unordered_map<std::string, Variable> vars;
+    std::unordered_map<Atom, Variable> vars;
 };
 
 enum class ScopeType {
@@ -31,39 +33,73 @@ class LineTree;
 class Scope {
 public:
     Scope();
+    Scope(std::shared_ptr<ScopeImpl> _impl);
 
     void addChild(std::shared_ptr<Scope> child);
 
-    Variable call(const std::string &name, const InstructionParams &params);
+    Variable call(const Atom &name, const InstructionParams &params);
 
-    void setVariable(const std::string &name, Variable value);
-    Variable getVariable(const std::string &name);
+    void setVariable(const Atom &name, Variable value);
+    Variable getVariable(const Atom &name);
+    Variable getBuiltin(const Atom &name);
 
     Variable execute();
 
     std::shared_ptr<ScopeImpl> impl;
 
     std::weak_ptr<Scope> parentScope;
-    std::shared_ptr<ScopeImpl> scopeWithVariable(const std::string &name);
+    std::shared_ptr<ScopeImpl> scopeWithVariable(const Atom &name, bool include_builtins = false);
 };
 
-class ScopeImpl {
+class ScopeImpl: public std::enable_shared_from_this<ScopeImpl> {
 public:
     ScopeImpl()
-        : type(ScopeType::TOP_LEVEL) {}
+        : type(ScopeType::TOP_LEVEL)
+        , instruction(std::make_shared<Instruction>()) {}
+
+    ScopeImpl(ScopeType _type, std::shared_ptr<Instruction> _instruction)
+        : type(_type)
+        , instruction(_instruction) {}
 
     ScopeType type;
 
-    Instruction instruction;
+    std::shared_ptr<Instruction> instruction;
     Variables vars;
     std::weak_ptr<ScopeImpl> parent;
     std::vector<std::shared_ptr<Scope>> children;
 
+    // Builtin functions and modules of the interpreter (top-level scope only).
+    // Looked up after the globals and never assigned to by scripts.
+    std::shared_ptr<ScopeImpl> builtins;
+
     friend class Scope;
 private:
     bool isTopLevelScope();
+    std::shared_ptr<ScopeImpl> topLevelScope();
 };
 
+/**
+ * @brief Parsed lines of a block, without any variables
+ *
+ * It is not modified after compileScope() returns, so it can be shared
+ * between threads and turned into Scope objects any number of times.
+ */
+struct CompiledScope {
+    ScopeType type;
+    std::shared_ptr<Instruction> instruction;
+    std::vector<std::shared_ptr<const CompiledScope>> children;
+};
+
+std::shared_ptr<const CompiledScope> compileScope(const LineTree &lineTree, bool isTopLevel = true);
+
+std::shared_ptr<Scope> makeScope(const CompiledScope &compiled);
 std::shared_ptr<Scope> makeScope(const LineTree &lineTree, bool isTopLevel = true);
 
+/**
+ * @brief Execute the lines of a compiled top-level block
+ *
+ * Variables created by the lines end up in `globals`.
+ */
+Variable executeCompiledScope(const CompiledScope &compiled, const std::shared_ptr<Scope> &globals);
+
 } // namespace MiniPython
@@ -1,7 +1,9 @@
 #include "StandardFunctions.h"
 #include "Scope.h"
 #include "RaiseException.h"
+#include "StringFormatting.h"
 #include "../variable/Variable.h"
+#include "../variable/File.h"
 
 #include <iostream>
 #include <stdexcept>
@@ -12,15 +14,13 @@
 
 namespace MiniPython::StandardFunctions {
 
-static auto None = std::static_pointer_cast<GenericVariable>(std::make_shared<NoneVariable>());
-
 Variable print(const InstructionParams &params, Scope *scope) {
     for (size_t i = 0; i < params.size(); ++i) {
         std::cout << params[i]->execute(scope)->to_str();
         bool is_last = i == params.size() - 1;
         std::cout << (is_last ? "\n" : " ");
     }
-    return None;
+    return NONE;
 }
 
 Variable min(const InstructionParams &params, Scope *scope) {
@@ -57,6 +57,13 @@ Variable max(const InstructionParams &params, Scope *scope) {
     return res;
 }
 
+static BigInt to_big_int(const Variable &var) {
+    if (var->get_type() == VariableType::BOOL) {
+        return var->to_int();
+    }
+    return std::dynamic_pointer_cast<IntVariable>(var)->to_big();
+}
+
 Variable pow(const InstructionParams &params, Scope *scope) {
     auto arg1 = params[0]->execute(scope);
     auto arg2 = params[1]->execute(scope);
@@ -65,37 +72,36 @@ Variable pow(const InstructionParams &params, Scope *scope) {
         return arg1->pow(arg2);
     }
 
-    return arg1->pow(arg2)->mod(params[2]->execute(scope));
+    auto arg3 = params[2]->execute(scope);
+    for (auto &arg: {arg1, arg2, arg3}) {
+        if (arg->get_type() != VariableType::INT && arg->get_type() != VariableType::BOOL) {
+            raise_exception("TypeError", "pow() 3rd argument not allowed unless all arguments are integers");
+        }
+    }
+    if (!arg3->to_bool()) {
+        raise_exception("ValueError", "pow() 3rd argument cannot be 0");
+    }
+
+    // Reduces after every multiplication instead of computing the whole power first
+    return NEW_INT(BigInt::pow_mod(to_big_int(arg1), to_big_int(arg2), to_big_int(arg3)));
 }
 
 Variable bool_func(const InstructionParams &params, Scope *scope) {
     bool value = (params.size() > 0) && params[0]->execute(scope)->to_bool();
-    return std::make_shared<BoolVariable>(value);
+    return NEW_BOOL(value);
 }
 
-std::string _hex(int num) {
-    if (num == 0) {
-        return "0x0";
-    }
-
-    if (num < 0) {
-        return "-" + _hex(-num);
+Variable hex(const InstructionParams &params, Scope *scope) {
+    auto var = params[0]->execute(scope);
+    if (var->get_type() != VariableType::INT && var->get_type() != VariableType::BOOL) {
+        raise_exception("TypeError", "'" + var->get_class_name() + "' object cannot be interpreted as an integer");
+        return NONE;
     }
-
-    std::string res;
-    while (num > 0) {
-        static std::string digits = "0123456789abcdef";
-        int new_digit = num % 16;
-        num /= 16;
-        res = std::string(1, digits[new_digit]) + res;
+    auto digits = to_big_int(var).to_string(16);
+    if (digits[0] == '-') {
+        return NEW_STRING("-0x" + digits.substr(1));
     }
-
-    return "0x" + res;
-}
-
-Variable hex(const InstructionParams &params, Scope *scope) {
-    int num = std::dynamic_pointer_cast<IntVariable>(params[0]->execute(scope))->value;
-    return std::make_shared<StringVariable>(_hex(num));
+    return NEW_STRING("0x" + digits);
 }
 
 Variable ord(const InstructionParams &params, Scope *scope) {
@@ -105,6 +111,23 @@ Variable ord(const InstructionParams &params, Scope *scope) {
     return std::dynamic_pointer_cast<GenericVariable>(int_var);
 }
 
+Variable format(const InstructionParams &params, Scope *scope) {
+    if (params.empty() || params.size() > 2) {
+        raise_exception("TypeError", "format expected 1 or 2 arguments, got " + std::to_string(params.size()));
+        return NONE;
+    }
+    std::string spec;
+    if (params.size() == 2) {
+        auto spec_var = VAR(1);
+        if (spec_var->get_type() != VariableType::STRING) {
+            raise_exception("TypeError", "format() argument 2 must be str, not " + spec_var->get_class_name());
+            return NONE;
+        }
+        spec = spec_var->to_str();
+    }
+    return NEW_STRING(format_value(VAR(0), spec));
+}
+
 Variable len(const InstructionParams &params, Scope *scope) {
     if (params[0]->execute(scope)->get_type() == VariableType::STRING) {
         auto generic_var = params[0]->execute(scope);
@@ -113,27 +136,53 @@ Variable len(const InstructionParams &params, Scope *scope) {
         return std::dynamic_pointer_cast<GenericVariable>(int_var);
     }
 
+    auto var = VAR(0);
+    if (var->get_type() == VariableType::ARRAY) {
+        return NEW_INT(static_cast<IntType>(std::dynamic_pointer_cast<ArrayVariable>(var)->size()));
+    }
+    if (var->get_type() == VariableType::BYTES || var->get_type() == VariableType::MEMORYVIEW) {
+        return NEW_INT(static_cast<IntType>(get_buffer(var).size()));
+    }
+
     throw std::runtime_error("Unsupported type for len");
 }
 
+Variable memoryview(const InstructionParams &params, Scope *scope) {
+    return std::make_shared<MemoryView>(VAR(0));
+}
+
+Variable open(const InstructionParams &params, Scope *scope) {
+    auto mode = params.size() > 1 ? STRING(1)->value : "r";
+    return std::make_shared<FileVariable>(STRING(0)->value, mode);
+}
+
+// Names from strings are looked up without interning them
 Variable getattr(const InstructionParams &params, Scope *scope) {
     auto obj = VAR(0);
-    auto attr_name = STRING(1)->value;
-    return params.size() > 2 ? VAR(2) : obj->get_attr(attr_name);
+    Atom::Lookup name(STRING(1)->value);
+    if (params.size() > 2 && !obj->has_attr(name)) {
+        return VAR(2);
+    }
+    return get_bound_attr(obj, name);
 }
 
 Variable setattr(const InstructionParams &params, Scope *scope) {
     auto obj = VAR(0);
     auto attr_name = STRING(1)->value;
     auto new_value = VAR(2);
-    obj->set_attr(attr_name, new_value);
-    return None;
+    if (std::dynamic_pointer_cast<GenericVariableImpl>(obj)) {
+        // The object keeps the name in its attribute table
+        obj->set_attr(Atom(attr_name), new_value);
+    }
+    else {
+        obj->set_attr(Atom::Lookup(attr_name), new_value);
+    }
+    return NONE;
 }
 
 Variable hasattr(const InstructionParams &params, Scope *scope) {
     auto obj = VAR(0);
-    auto attr_name = STRING(1)->value;
-    return std::make_shared<BoolVariable>(obj->has_attr(attr_name));
+    return std::make_shared<BoolVariable>(obj->has_attr(Atom::Lookup(STRING(1)->value)));
 }
 
 Variable list(const InstructionParams &params, Scope *scope) {
@@ -169,24 +218,24 @@ Variable eval_string(const std::string &str, Scope *scope) {
     }
 
     if (str_is_a_var_name) {
-        return scope->getVariable(str);
+        return scope->getVariable(Atom::Lookup(str));
     }
 
     raise_exception("NotImplementedError", "advanced eval() statements not implemented");
-    return None;
+    return NONE;
 }
 
 Variable eval(const InstructionParams &params, Scope *scope) {
     if (!params.size()) {
         raise_exception("TypeError", "eval expected at least 1 argument, got 0");
-        return None;
+        return NONE;
     }
 
     auto str_var = params[0]->execute(scope);
 
     if (str_var->get_type() != VariableType::STRING) {
         raise_exception("TypeError", "eval() arg 1 must be a string, bytes or code object");
-        return None;
+        return NONE;
     }
 
     auto str = str_var->to_str();
@@ -14,8 +14,17 @@ Variable bool_func(const InstructionParams &params, Scope *scope);
 Variable hex(const InstructionParams &params, Scope *scope);
 Variable ord(const InstructionParams &params, Scope *scope);
 
+Variable format(const InstructionParams &params, Scope *scope);
+
 Variable len(const InstructionParams &params, Scope *scope);
 
+Variable memoryview(const InstructionParams &params, Scope *scope);
+Variable open(const InstructionParams &params, Scope *scope);
+
+Variable getattr(const InstructionParams &params, Scope *scope);
+Variable setattr(const InstructionParams &params, Scope *scope);
+Variable hasattr(const InstructionParams &params, Scope *scope);
+
 Variable list(const InstructionParams &params, Scope *scope);
 Variable set(const InstructionParams &params, Scope *scope);
 
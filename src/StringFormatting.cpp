@@ -1,232 +1,1130 @@
 #include "StringFormatting.h"
-#include "src/StandardFunctions.h"
+#include "src/Instruction.h"
+#include "RaiseException.h"
+#include "Utils.h"
 
+#include <algorithm>
 #include <cctype>
-#include <sstream>
+#include <charconv>
+#include <cmath>
+#include <cstdio>
+#include <cstring>
 
 namespace MiniPython {
 
-int get_number_from_stringstream(std::stringstream &ss) {
-    std::string num_str;
-    char ch;
-    while ((ch = ss.get()) != EOF) {
-        if (!isdigit(ch)) {
-            ss.putback(ch);
-            break;
+static double to_real_number(const Variable &var) {
+    switch (var->get_type()) {
+    case VariableType::INT:
+        return std::dynamic_pointer_cast<IntVariable>(var)->to_float();
+    case VariableType::BOOL:
+        return var->to_int();
+    case VariableType::FLOAT:
+        return std::dynamic_pointer_cast<FloatVariable>(var)->value;
+    default:
+        raise_exception("TypeError", "must be real number, not " + var->get_class_name());
+        return 0;
+    }
+}
+
+/*
+ * Format spec mini-language
+ *
+ * Numbers are written with std::to_chars into buffers on the stack and
+ * appended to the output together with their padding; nothing else is
+ * allocated, except for integers too big for IntType and for floats with
+ * hundreds of digits.
+ */
+
+static bool is_align(char ch) {
+    return ch == '<' || ch == '>' || ch == '=' || ch == '^';
+}
+
+FormatSpec::FormatSpec(std::string_view spec) {
+    size_t i = 0;
+    auto number = [&]() {
+        size_t result = 0;
+        while (i < spec.size() && std::isdigit(static_cast<unsigned char>(spec[i]))) {
+            result = result * 10 + (spec[i++] - '0');
+        }
+        return result;
+    };
+
+    // The fill character may be any UTF-8 character
+    size_t fill_size = 1;
+    while (fill_size < spec.size() && (spec[fill_size] & 0xc0) == 0x80) {
+        ++fill_size;
+    }
+    bool fill_given = false;
+    if (fill_size < spec.size() && is_align(spec[fill_size])) {
+        fill = spec.substr(0, fill_size);
+        fill_given = true;
+        align = spec[fill_size];
+        i = fill_size + 1;
+    }
+    else if (!spec.empty() && is_align(spec[0])) {
+        align = spec[0];
+        i = 1;
+    }
+    if (i < spec.size() && (spec[i] == '+' || spec[i] == '-' || spec[i] == ' ')) {
+        sign = spec[i++];
+    }
+    if (i < spec.size() && spec[i] == '#') {
+        alternate = true;
+        ++i;
+    }
+    if (i < spec.size() && spec[i] == '0') {
+        zero = true;
+        if (!fill_given) {
+            fill = "0";
+        }
+        ++i;
+    }
+    width = number();
+    if (i < spec.size() && (spec[i] == ',' || spec[i] == '_')) {
+        grouping = spec[i++];
+    }
+    if (i < spec.size() && spec[i] == '.') {
+        ++i;
+        if (i == spec.size() || !std::isdigit(static_cast<unsigned char>(spec[i]))) {
+            raise_exception("ValueError", "Format specifier missing precision");
+            return;
         }
-        num_str += ch;
+        precision = number();
+    }
+    if (i < spec.size()) {
+        type = spec[i++];
+    }
+    if (i < spec.size()) {
+        raise_exception("ValueError", "Invalid format specifier '" + std::string(spec) + "'");
+    }
+}
+
+bool FormatSpec::is_default() const {
+    return !align && !sign && !alternate && !zero && !grouping && !width && precision < 0 && !type && !min_digits;
+}
+
+static void append_fill(std::string &output, size_t count, std::string_view fill) {
+    if (fill.size() == 1) {
+        output.append(count, fill[0]);
+        return;
+    }
+    for (size_t i = 0; i < count; ++i) {
+        output += fill;
     }
-    return std::atoi(num_str.c_str());
 }
 
-size_t interpolation_element_count(const std::vector<FormatElement> &elements) {
-    size_t res = 0;
-    for (const auto &elem: elements) {
-        if (elem.type == FormatElementType::INTERPOLATION) {
-            res++;
+static size_t utf8_length(std::string_view text) {
+    return std::count_if(text.begin(), text.end(), [](char ch) { return (ch & 0xc0) != 0x80; });
+}
+
+// Characters of count digits with a separator between groups
+static size_t grouped_size(size_t count, char separator, size_t group_size) {
+    return (separator && count) ? count + (count - 1) / group_size : count;
+}
+
+// The digits after leading_zeros zeros, with a separator between groups
+static void append_grouped(std::string &output, std::string_view digits, size_t leading_zeros,
+                           char separator, size_t group_size) {
+    if (!separator && !leading_zeros) {
+        output += digits;
+        return;
+    }
+    size_t count = digits.size() + leading_zeros;
+    for (size_t i = 0; i < count; ++i) {
+        if (separator && i > 0 && (count - i) % group_size == 0) {
+            output += separator;
         }
+        output += (i < leading_zeros) ? '0' : digits[i - leading_zeros];
     }
-    return res;
 }
 
-ParsedFormat::ParsedFormat(const std::string &format): plus(false), dot(false), octothorp(false), after_dot(0), after_octothorp(0) {
-    std::stringstream ss(format);
-    char ch;
-    after_octothorp = 0;
-    while ((ch = ss.get()) != EOF) {
-        if (ch == '+') {
-            plus = true;
+/*
+ * Appends a number made of head (sign and base prefix), the digits of the
+ * integer part and tail (fraction, exponent, %), padded to the width of
+ * spec. Zeros of the 0 flag go between head and digits and are grouped
+ * like the digits, as Python does.
+ */
+static void append_number(std::string &output, std::string_view head, std::string_view digits, std::string_view tail,
+                          const FormatSpec &spec, size_t group_size) {
+    size_t length = head.size() + grouped_size(digits.size(), spec.grouping, group_size) + tail.size();
+    if (length >= spec.width) {
+        output += head;
+        append_grouped(output, digits, 0, spec.grouping, group_size);
+        output += tail;
+        return;
+    }
+
+    char align = spec.align ? spec.align : (spec.zero ? '=' : '>');
+    size_t padding = spec.width - length;
+    if (align == '=' && spec.zero && spec.grouping && spec.fill == "0") {
+        size_t count = digits.size();
+        while (head.size() + grouped_size(count, spec.grouping, group_size) + tail.size() < spec.width) {
+            ++count;
         }
-        else if (isdigit(ch)) {
-            ss.putback(ch);
+        output += head;
+        append_grouped(output, digits, count - digits.size(), spec.grouping, group_size);
+        output += tail;
+        return;
+    }
+
+    size_t left = (align == '<' || align == '=') ? 0 : (align == '^') ? padding / 2 : padding;
+    append_fill(output, left, spec.fill);
+    output += head;
+    if (align == '=') {
+        append_fill(output, padding, spec.fill);
+    }
+    append_grouped(output, digits, 0, spec.grouping, group_size);
+    output += tail;
+    append_fill(output, (align == '<' || align == '^') ? padding - left : 0, spec.fill);
+}
+
+static void format_text(std::string &output, std::string_view text, const FormatSpec &spec) {
+    if (spec.type && spec.type != 's') {
+        raise_exception("ValueError", std::string("Unknown format code '") + spec.type + "' for object of type 'str'");
+        return;
+    }
+    if (spec.sign) {
+        raise_exception("ValueError", "Sign not allowed in string format specifier");
+        return;
+    }
+    if (spec.align == '=') {
+        raise_exception("ValueError", "'=' alignment not allowed in string format specifier");
+        return;
+    }
+    if (spec.grouping) {
+        raise_exception("ValueError", std::string("Cannot specify '") + spec.grouping + "' with 's'.");
+        return;
+    }
+
+    size_t length = utf8_length(text);
+    if (spec.precision >= 0 && length > static_cast<size_t>(spec.precision)) {
+        // Cut before the character number precision
+        size_t end = 0;
+        for (size_t count = 0; end < text.size(); ++end) {
+            if ((text[end] & 0xc0) != 0x80 && count++ == static_cast<size_t>(spec.precision)) {
+                break;
+            }
         }
-        else if (ch == '.') {
-            dot = true;
-            after_dot = get_number_from_stringstream(ss);
+        text = text.substr(0, end);
+        length = spec.precision;
+    }
+    if (length >= spec.width) {
+        output += text;
+        return;
+    }
+
+    size_t padding = spec.width - length;
+    char align = spec.align ? spec.align : '<';
+    size_t left = (align == '<') ? 0 : (align == '^') ? padding / 2 : padding;
+    append_fill(output, left, spec.fill);
+    output += text;
+    append_fill(output, padding - left, spec.fill);
+}
+
+static void format_float(std::string &output, const Variable &var, const FormatSpec &spec);
+
+// The sign, the 0x prefix and the magnitude digits, zero-padded to spec.min_digits
+static void append_integer(std::string &output, bool negative, std::string_view digits, int base,
+                           const FormatSpec &spec) {
+    char head[3];
+    size_t head_size = 0;
+    if (negative || spec.sign == '+' || spec.sign == ' ') {
+        head[head_size++] = negative ? '-' : spec.sign;
+    }
+    if (spec.alternate && base != 10) {
+        head[head_size++] = '0';
+        head[head_size++] = (base == 2) ? 'b' : (base == 8) ? 'o' : spec.type;
+    }
+    std::string padded;
+    if (digits.size() < spec.min_digits) {
+        padded.assign(spec.min_digits - digits.size(), '0');
+        padded += digits;
+        digits = padded;
+    }
+    append_number(output, std::string_view(head, head_size), digits, {}, spec, (base == 10) ? 3 : 4);
+}
+
+static void format_int(std::string &output, const Variable &var, const FormatSpec &spec) {
+    int base = 10;
+    switch (spec.type) {
+    case 0:
+    case 'd':
+    case 'n':
+        break;
+    case 'b':
+        base = 2;
+        break;
+    case 'o':
+        base = 8;
+        break;
+    case 'x':
+    case 'X':
+        base = 16;
+        break;
+    case 'c': {
+        IntType code_point = var->to_int();
+        if (code_point < 0 || code_point > 0x10ffff) {
+            raise_exception("OverflowError", "%c arg not in range(0x110000)");
+            return;
         }
-        else if (ch == '#') {
-            octothorp = true;
-            after_octothorp = get_number_from_stringstream(ss);
+        char buffer[4];
+        size_t size = 0;
+        if (code_point < 0x80) {
+            buffer[size++] = code_point;
         }
-        else if (isalpha(ch)) {
-            letter += ch;
+        else {
+            size_t count = (code_point < 0x800) ? 2 : (code_point < 0x10000) ? 3 : 4;
+            buffer[0] = static_cast<char>((0xf00 >> count) | (code_point >> (6 * (count - 1))));
+            for (size = 1; size < count; ++size) {
+                buffer[size] = static_cast<char>(0x80 | ((code_point >> (6 * (count - 1 - size))) & 0x3f));
+            }
         }
+        FormatSpec text_spec = spec;
+        text_spec.type = 0;
+        format_text(output, std::string_view(buffer, size), text_spec);
+        return;
+    }
+    case 'e':
+    case 'E':
+    case 'f':
+    case 'F':
+    case 'g':
+    case 'G':
+    case '%':
+        format_float(output, var, spec);
+        return;
+    default:
+        raise_exception("ValueError", std::string("Unknown format code '") + spec.type + "' for object of type 'int'");
+        return;
+    }
+    if (spec.precision >= 0) {
+        raise_exception("ValueError", "Precision not allowed in integer format specifier");
+        return;
     }
+    if (spec.grouping == ',' && base != 10) {
+        raise_exception("ValueError", std::string("Cannot specify ',' with '") + spec.type + "'.");
+        return;
+    }
+
+    IntType value = 0;
+    std::string big;
+    if (var->get_type() == VariableType::INT && std::static_pointer_cast<IntVariable>(var)->is_big()) {
+        big = std::static_pointer_cast<IntVariable>(var)->big->to_string(base);
+    }
+    else {
+        value = var->to_int();
+    }
+
+    char buffer[72];
+    char *begin = buffer;
+    char *end;
+    bool negative;
+    if (big.empty()) {
+        negative = value < 0;
+        // The magnitude, also of the smallest IntType
+        uint64_t magnitude = negative ? 0 - static_cast<uint64_t>(value) : value;
+        end = std::to_chars(buffer, buffer + sizeof(buffer), magnitude, base).ptr;
+    }
+    else {
+        negative = big[0] == '-';
+        begin = big.data() + (negative ? 1 : 0);
+        end = big.data() + big.size();
+    }
+    if (spec.type == 'X') {
+        std::transform(begin, end, begin, [](char ch) { return std::toupper(ch); });
+    }
+    append_integer(output, negative, std::string_view(begin, end - begin), base, spec);
 }
 
-FormatElement::FormatElement(FormatElementType _type, const std::string &_value): type(_type), value(_value) {}
+static void format_float(std::string &output, const Variable &var, const FormatSpec &spec) {
+    char type = spec.type;
+    if (type && !std::strchr("eEfFgGn%", type)) {
+        raise_exception("ValueError", std::string("Unknown format code '") + type + "' for object of type 'float'");
+        return;
+    }
+    double value = to_real_number(var);
+    bool negative = std::signbit(value) && !std::isnan(value);
+    double magnitude = std::fabs(value);
 
-enum class PercentFormatterState {
-    READING_EXACT_STRING,
-    READING_FORMAT,
-};
+    // Room for the digits of DBL_MAX * 100 and of the precision
+    char buffer[128];
+    std::string large;
+    char *data = buffer;
+    size_t capacity = sizeof(buffer) - 2;
+    size_t size = 0;
+
+    auto write = [&](double number, std::chars_format format, int precision) {
+        auto result = std::to_chars(data, data + capacity, number, format, precision);
+        if (result.ec == std::errc::value_too_large) {
+            large.resize(330 + precision);
+            data = large.data();
+            capacity = large.size() - 2;
+            result = std::to_chars(data, data + capacity, number, format, precision);
+        }
+        size = result.ptr - data;
+    };
 
-PercentFormatter::PercentFormatter(const std::string &format) {
-    PercentFormatterState state = PercentFormatterState::READING_EXACT_STRING;
-    std::stringstream ss(format);
-    char ch;
-    std::string value;
-    while((ch = ss.get()) != EOF) {
-        if (state == PercentFormatterState::READING_EXACT_STRING) {
-            if (ch == '%') {
-                elements.push_back(FormatElement(FormatElementType::EXACT_STRING, value));
-                value = ch;
-                state = PercentFormatterState::READING_FORMAT;
+    if (!std::isfinite(magnitude)) {
+        size = 3;
+        std::memcpy(data, std::isnan(magnitude) ? "nan" : "inf", size);
+    }
+    else {
+        int precision = spec.precision;
+        switch (type) {
+        case 'f':
+        case 'F':
+        case '%':
+            write((type == '%') ? magnitude * 100 : magnitude, std::chars_format::fixed, (precision < 0) ? 6 : precision);
+            break;
+        case 'e':
+        case 'E':
+            write(magnitude, std::chars_format::scientific, (precision < 0) ? 6 : precision);
+            break;
+        case 0:
+            if (precision < 0) {
+                // Shortest repr, as str() gives it
+                std::string repr = FloatVariable(magnitude).to_str();
+                size = std::min(repr.size(), capacity);
+                std::memcpy(data, repr.data(), size);
+                break;
             }
             else {
-                value += ch;
+                // Like g, but fixed notation keeps a fraction, so it needs one
+                // digit less before switching to an exponent: 123.0 with .3 is 1.23e+02
+                int digits = std::max(precision, 1);
+                write(magnitude, std::chars_format::scientific, digits - 1);
+                char *exponent_begin = static_cast<char *>(std::memchr(data, 'e', size));
+                int exponent = 0;
+                std::from_chars(exponent_begin + (exponent_begin[1] == '+' ? 2 : 1), data + size, exponent);
+                if (exponent < -4 || exponent >= digits - 1) {
+                    // Trailing zeros of the mantissa go, as with g
+                    char *mantissa_end = exponent_begin;
+                    if (std::memchr(data, '.', exponent_begin - data)) {
+                        while (mantissa_end[-1] == '0') {
+                            --mantissa_end;
+                        }
+                        if (mantissa_end[-1] == '.') {
+                            --mantissa_end;
+                        }
+                    }
+                    size_t exponent_size = data + size - exponent_begin;
+                    std::memmove(mantissa_end, exponent_begin, exponent_size);
+                    size = mantissa_end + exponent_size - data;
+                }
+                else {
+                    write(magnitude, std::chars_format::general, digits);
+                    if (!std::memchr(data, '.', size)) {
+                        data[size++] = '.';
+                        data[size++] = '0';
+                    }
+                }
             }
+            break;
+        default:
+            write(magnitude, std::chars_format::general, (precision < 0) ? 6 : std::max(precision, 1));
         }
-        if (state == PercentFormatterState::READING_FORMAT) {
-            value += ch;
-            if (isalpha(ch)) {
-                elements.push_back(FormatElement(FormatElementType::INTERPOLATION, value));
-                value = "";
-                state = PercentFormatterState::READING_EXACT_STRING;
-            }
+        if (spec.alternate && !std::memchr(data, '.', size)) {
+            // # keeps the point: 1. and 1.e+00
+            char *exponent = static_cast<char *>(std::memchr(data, 'e', size));
+            size_t at = exponent ? exponent - data : size;
+            std::memmove(data + at + 1, data + at, size - at);
+            data[at] = '.';
+            ++size;
         }
     }
+    if (type == 'E' || type == 'F' || type == 'G') {
+        std::transform(data, data + size, data, [](char ch) { return std::toupper(ch); });
+    }
+    if (type == '%' && std::isfinite(magnitude)) {
+        data[size++] = '%';
+    }
 
-    auto last_elem_type = (state == PercentFormatterState::READING_EXACT_STRING)
-                        ? FormatElementType::EXACT_STRING
-                        : FormatElementType::INTERPOLATION;
-    elements.push_back(FormatElement(last_elem_type, value));
+    std::string_view body(data, size);
+    size_t digits_size = 0;
+    while (digits_size < body.size() && std::isdigit(static_cast<unsigned char>(body[digits_size]))) {
+        ++digits_size;
+    }
+    char head = negative ? '-' : spec.sign;
+    std::string_view head_view(&head, (negative || spec.sign == '+' || spec.sign == ' ') ? 1 : 0);
+    append_number(output, head_view, body.substr(0, digits_size), body.substr(digits_size), spec, 3);
 }
 
-std::string interpolate_value(const std::string &format, Variable var) {
-    ParsedFormat f(format);
-    std::string str;
-    if (f.letter == "s") {
-        str = var->to_str();
-        if ((f.dot) && (str.length() > f.after_dot)) {
-            str = str.substr(0, f.after_dot);
-        }
-    }
-    else if (f.letter == "d") {
-        str = std::to_string(std::stoi(var->to_str()));
-    }
-    else if (f.letter == "f") {
-        str = std::to_string(std::stod(var->to_str()));
-        if (f.dot) {
-            size_t pos = str.find(".");
-            if (pos == std::string::npos) {
-                str += "." + std::string(pos, '0');
-            }
-            else {
-                str += std::string(str.length() - pos, '0');
-            }
+void format_value(std::string &output, const Variable &var, const FormatSpec &spec) {
+    switch (var->get_type()) {
+    case VariableType::STRING:
+        if (spec.is_default()) {
+            output += std::static_pointer_cast<StringVariable>(var)->value;
+            return;
+        }
+        format_text(output, std::static_pointer_cast<StringVariable>(var)->value, spec);
+        return;
+    case VariableType::INT:
+        format_int(output, var, spec);
+        return;
+    case VariableType::BOOL:
+        // True and False without a spec, 1 and 0 with one
+        if (spec.is_default()) {
+            output += var->to_str();
+            return;
         }
+        format_int(output, var, spec);
+        return;
+    case VariableType::FLOAT:
+        format_float(output, var, spec);
+        return;
+    default:
+        if (!spec.is_default()) {
+            raise_exception("TypeError", "unsupported format string passed to " + var->get_class_name() + ".__format__");
+            return;
+        }
+        output += var->to_str();
     }
+}
 
-    if (str.length() < f.after_octothorp) {
-        str = std::string(f.after_octothorp - str.length(), ' ') + str;
+std::string format_value(const Variable &var, std::string_view spec) {
+    std::string result;
+    format_value(result, var, FormatSpec(spec));
+    return result;
+}
+
+/*
+ * %-formatting
+ */
+
+ParsedFormat::ParsedFormat(std::string_view format) {
+    size_t i = format.starts_with('%') ? 1 : 0;
+    auto number = [&]() {
+        int result = 0;
+        while (i < format.size() && std::isdigit(static_cast<unsigned char>(format[i]))) {
+            result = result * 10 + (format[i++] - '0');
+        }
+        return result;
+    };
+
+    for (; i < format.size(); ++i) {
+        char ch = format[i];
+        if (ch == '+') {
+            plus = true;
+        }
+        else if (ch == '#') {
+            octothorp = true;
+        }
+        else if (ch == '-') {
+            minus = true;
+        }
+        else if (ch == '0') {
+            zero = true;
+        }
+        else if (ch == ' ') {
+            space = true;
+        }
+        else {
+            break;
+        }
+    }
+    width = number();
+    after_octothorp = octothorp ? width : 0;
+    if (i < format.size() && format[i] == '.') {
+        ++i;
+        dot = true;
+        after_dot = number();
+    }
+    // Length modifiers mean nothing in Python
+    while (i < format.size() && (format[i] == 'h' || format[i] == 'l' || format[i] == 'L')) {
+        ++i;
     }
+    if (i < format.size()) {
+        letter = format[i];
+    }
+}
 
-    return str;
+// The format spec doing what a %-conversion does
+static FormatSpec to_format_spec(const ParsedFormat &f) {
+    FormatSpec spec;
+    spec.width = f.width;
+    spec.align = f.minus ? '<' : '>';
+    if (f.dot) {
+        spec.precision = f.after_dot;
+    }
+    switch (f.letter[0]) {
+    case 's':
+    case 'b':
+    case 'r':
+        return spec;
+    case 'i':
+    case 'u':
+        spec.type = 'd';
+        break;
+    default:
+        spec.type = f.letter[0];
+    }
+    spec.sign = f.plus ? '+' : f.space ? ' ' : 0;
+    spec.alternate = f.octothorp;
+    if (f.zero && !f.minus) {
+        spec.zero = true;
+        spec.fill = "0";
+        spec.align = '=';
+    }
+    if (!std::strchr("fFeEgG", spec.type)) {
+        // %.3d means at least 3 digits, which format() has no way to say
+        spec.min_digits = spec.precision < 0 ? 0 : spec.precision;
+        spec.precision = -1;
+    }
+    return spec;
 }
 
-std::string PercentFormatter::format(const std::vector<Variable> &variables) {
-    size_t variables_required = 0;
-    for (const auto& elem : elements) {
-        if (elem.type == FormatElementType::INTERPOLATION) {
-            ++variables_required;
+// Length of the conversion starting with the % at format[begin]
+static size_t conversion_size(const std::string &format, size_t begin) {
+    for (size_t i = begin + 1; i < format.size(); ++i) {
+        char ch = format[i];
+        if (std::isalpha(static_cast<unsigned char>(ch)) && ch != 'h' && ch != 'l' && ch != 'L') {
+            return i + 1 - begin;
+        }
+        if (!std::isdigit(static_cast<unsigned char>(ch)) && !std::strchr("+-# 0.hlL", ch)) {
+            raise_exception("ValueError", std::string("unsupported format character '") + ch + "'");
+            return 0;
         }
     }
+    raise_exception("ValueError", "incomplete format");
+    return 0;
+}
 
-    if ((variables_required == 0) && (variables.size() == 1) && (variables[0]->get_type() == VariableType::LIST)) {
-        std::string result;
-        for (const auto& elem : elements) {
-            result += elem.value;
+PercentFormatter::PercentFormatter(const std::string &format, bool _bytes): bytes(_bytes) {
+    std::string text;
+    size_t i = 0;
+    while (i < format.size()) {
+        size_t percent = format.find('%', i);
+        if (percent == std::string::npos) {
+            text.append(format, i);
+            break;
         }
-        return result;
+        text.append(format, i, percent - i);
+        if (percent + 1 < format.size() && format[percent + 1] == '%') {
+            text += '%';
+            i = percent + 2;
+            continue;
+        }
+        size_t size = conversion_size(format, percent);
+        text_size += text.size();
+        ParsedFormat spec(std::string_view(format).substr(percent, size));
+        conversions.push_back({std::move(text), spec, to_format_spec(spec)});
+        const std::string &letter = conversions.back().spec.letter;
+        if (!std::strchr("sbrcdiuxXoeEfFgG", letter[0])) {
+            raise_exception("ValueError", "unsupported format character '" + letter + "'");
+            return;
+        }
+        if (bytes && letter == "s") {
+            conversions.back().spec.letter = "b";
+        }
+        text.clear();
+        i = percent + size;
     }
+    text_size += text.size();
+    tail = std::move(text);
+}
 
-    if (variables_required != variables.size()) {
-        throw std::runtime_error(" percent formatting: wrong number of arguments");
+// repr() of a str: quoted, with backslashes and control characters escaped
+static std::string string_repr(std::string_view value) {
+    bool has_single_quote = value.find('\'') != std::string_view::npos;
+    bool has_double_quote = value.find('"') != std::string_view::npos;
+    char quote = (has_single_quote && !has_double_quote) ? '"' : '\'';
+
+    std::string result(1, quote);
+    for (char ch: value) {
+        switch (ch) {
+        case '\\':
+            result += "\\\\";
+            break;
+        case '\t':
+            result += "\\t";
+            break;
+        case '\n':
+            result += "\\n";
+            break;
+        case '\r':
+            result += "\\r";
+            break;
+        default:
+            if (ch == quote) {
+                result += '\\';
+                result += ch;
+            }
+            else if ((static_cast<unsigned char>(ch) < 0x20) || (ch == 0x7f)) {
+                result += "\\x" + byte_to_hex(ch);
+            }
+            else {
+                result += ch;
+            }
+        }
     }
+    result += quote;
+    return result;
+}
 
-    std::string res;
-    size_t var_idx = 0;
-    for (const auto& elem : elements) {
-        if (elem.type == FormatElementType::EXACT_STRING) {
-            res += elem.value;
+// repr() of a value: strings are quoted, the others print as they do
+static std::string repr(const Variable &var) {
+    if (var->get_type() == VariableType::STRING) {
+        return string_repr(std::static_pointer_cast<StringVariable>(var)->value);
+    }
+    return var->to_str();
+}
+
+// ascii() of a repr: the code points past ASCII as \xhh, \uhhhh or \Uhhhhhhhh
+static std::string ascii_escape(std::string_view text) {
+    std::string result;
+    size_t i = 0;
+    while (i < text.size()) {
+        unsigned char lead = text[i];
+        if (lead < 0x80) {
+            result += text[i++];
+            continue;
+        }
+        size_t length = (lead >= 0xf0) ? 4 : (lead >= 0xe0) ? 3 : (lead >= 0xc0) ? 2 : 1;
+        char32_t code_point = (length == 1) ? lead : lead & (0x7f >> length);
+        for (size_t k = 1; k < length && i + k < text.size(); ++k) {
+            code_point = (code_point << 6) | (text[i + k] & 0x3f);
+        }
+        i += length;
+        char buffer[12];
+        if (code_point < 0x100) {
+            std::snprintf(buffer, sizeof(buffer), "\\x%02x", unsigned(code_point));
+        }
+        else if (code_point < 0x10000) {
+            std::snprintf(buffer, sizeof(buffer), "\\u%04x", unsigned(code_point));
         }
         else {
-            res += interpolate_value(elem.value, variables[var_idx++]);
+            std::snprintf(buffer, sizeof(buffer), "\\U%08x", unsigned(code_point));
         }
+        result += buffer;
     }
-    return res;
+    return result;
 }
 
-FStringFormatter::FStringFormatter(const std::string &format) {
-    std::stringstream ss(format);
-    while (ss) {
-        std::string value;
-        char ch = ss.peek();
-        if (ss.eof()) {
-            break;
+static void append_conversion(std::string &output, const Variable &var, const ParsedFormat &f, const FormatSpec &spec) {
+    VariableType type = var->get_type();
+    switch (f.letter[0]) {
+    case 'b':
+        // Bytes in a bytes format, as they are
+        if (type == VariableType::BYTES) {
+            format_text(output, std::static_pointer_cast<StringVariable>(var)->value, spec);
+            return;
         }
-        if (ch == '{') {
-            ss.get();
-            while (ss && (ch = ss.get())) {
-                if (ch == '}') {
-                    elements.push_back(FormatElement(FormatElementType::INTERPOLATION, value));
-                    value = "";
-                    break;
-                }
-                value += ch;
-            }
+        [[fallthrough]];
+    case 's':
+        if (type == VariableType::STRING) {
+            format_text(output, std::static_pointer_cast<StringVariable>(var)->value, spec);
         }
         else {
-            while (ss && (ch = ss.get()) && (!ss.eof())) {
-                if (ch == '{') {
-                    ss.putback('{');
-                    elements.push_back(FormatElement(FormatElementType::EXACT_STRING, value));
-                    value = "";
-                    break;
-                }
-                value += ch;
+            format_text(output, var->to_str(), spec);
+        }
+        return;
+    case 'r':
+        format_text(output, repr(var), spec);
+        return;
+    case 'c':
+        if (type == VariableType::STRING || type == VariableType::BYTES) {
+            const std::string &value = std::static_pointer_cast<StringVariable>(var)->value;
+            // One character: one code point of a str, one byte of bytes
+            size_t size = 1;
+            if (type == VariableType::STRING && !value.empty()) {
+                unsigned char lead = value[0];
+                size = (lead < 0xc0) ? 1 : (lead < 0xe0) ? 2 : (lead < 0xf0) ? 3 : 4;
             }
-            if (value.size()) { // to handle EOF
-                elements.push_back(FormatElement(FormatElementType::EXACT_STRING, value));
+            if (value.size() != size) {
+                raise_exception("TypeError", "%c requires an int or a char");
+                return;
             }
+            FormatSpec text_spec = spec;
+            text_spec.type = 0;
+            format_text(output, value, text_spec);
+            return;
+        }
+        if (type != VariableType::INT && type != VariableType::BOOL) {
+            raise_exception("TypeError", "%c requires an int or a char");
+            return;
         }
+        format_int(output, var, spec);
+        return;
+    case 'd':
+    case 'i':
+    case 'u':
+        if (type == VariableType::FLOAT) {
+            // The digits of the integer part, which may not fit in IntType
+            FormatSpec truncated;
+            truncated.type = 'f';
+            truncated.precision = 0;
+            std::string text;
+            format_float(text, NEW_FLOAT(std::trunc(std::static_pointer_cast<FloatVariable>(var)->value)), truncated);
+            // trunc(-0.5) is -0.0, which prints as 0
+            bool negative = text[0] == '-';
+            std::string_view digits = std::string_view(text).substr(negative ? 1 : 0);
+            append_integer(output, negative && digits != "0", digits, 10, spec);
+            return;
+        }
+        if (type != VariableType::INT && type != VariableType::BOOL) {
+            raise_exception("TypeError", "%" + f.letter + " format: a real number is required, not " + var->get_class_name());
+            return;
+        }
+        format_int(output, var, spec);
+        return;
+    case 'x':
+    case 'X':
+    case 'o':
+        if (type != VariableType::INT && type != VariableType::BOOL) {
+            raise_exception("TypeError", "%" + f.letter + " format: an integer is required, not " + var->get_class_name());
+            return;
+        }
+        format_int(output, var, spec);
+        return;
+    default:
+        format_float(output, var, spec);
     }
 }
 
-std::string apply_fstring_format_modifiers(const std::string &value, const std::string &format) {
-    std::string res = value;
-    return res;
+std::string interpolate_value(const std::string &format, Variable var) {
+    ParsedFormat f(format);
+    std::string result;
+    append_conversion(result, var, f, to_format_spec(f));
+    return result;
 }
 
-std::string FStringFormatter::format(Scope *scope) {
+std::string PercentFormatter::format(const std::vector<Variable> &variables) const {
+    if (conversions.empty() && (variables.size() == 1) && (variables[0]->get_type() == VariableType::LIST)) {
+        return tail;
+    }
+    if (variables.size() < conversions.size()) {
+        raise_exception("TypeError", "not enough arguments for format string");
+    }
+    if (variables.size() > conversions.size()) {
+        raise_exception("TypeError", "not all arguments converted during string formatting");
+    }
+
     std::string res;
-    for (const auto& elem : elements) {
-        if (elem.type == FormatElementType::EXACT_STRING) {
-            res += elem.value;
+    res.reserve(text_size + 8 * conversions.size());
+    for (size_t i = 0; i < conversions.size(); ++i) {
+        res += conversions[i].text;
+        append_conversion(res, variables[i], conversions[i].spec, conversions[i].format_spec);
+    }
+    res += tail;
+    return res;
+}
+
+Variable PercentFormatter::mod(const Variable &values) const {
+    std::string result = is_tuple(values) ? format(VAR_TO_LIST(values)) : format(std::vector<Variable>{values});
+    if (bytes) {
+        return NEW_BYTES(std::move(result));
+    }
+    return NEW_STRING(std::move(result));
+}
+
+/*
+ * f-strings
+ */
+
+/*
+ * End of the placeholder expression starting at begin: the closing brace,
+ * or the colon before the format spec. Brackets and quotes are skipped, so
+ * f"{d['a:b']}" and f"{f(x)[1]:>4}" split where Python splits them.
+ */
+static size_t expression_end(const std::string &format, size_t begin) {
+    int depth = 0;
+    char quote = 0;
+    for (size_t i = begin; i < format.size(); ++i) {
+        char ch = format[i];
+        if (quote) {
+            if (ch == quote) {
+                quote = 0;
+            }
         }
-        else {
-            size_t last_colon_pos = elem.value.rfind(":");
-            if (last_colon_pos != std::string::npos) {
-                for (auto &symbol: {")", "]", "\"", "'"}) {
-                    size_t last_other_symbol_pos = elem.value.find(symbol);
-                    if ((last_other_symbol_pos != std::string::npos) && (last_other_symbol_pos > last_colon_pos)) {
-                        last_colon_pos = std::string::npos;
-                    }
-                }
+        else if (ch == '\'' || ch == '"') {
+            quote = ch;
+        }
+        else if (ch == '(' || ch == '[' || ch == '{') {
+            ++depth;
+        }
+        else if ((ch == ')' || ch == ']' || ch == '}') && depth > 0) {
+            --depth;
+        }
+        else if ((ch == '}' || ch == ':') && depth == 0) {
+            return i;
+        }
+    }
+    raise_exception("SyntaxError", "f-string: expecting '}'");
+    return format.size();
+}
+
+std::vector<FStringFormatter::NestedField> FStringFormatter::parse_spec(const std::string &format, size_t begin, size_t &end) {
+    std::vector<NestedField> fields;
+    std::string text;
+    size_t i = begin;
+    while (i < format.size() && format[i] != '}') {
+        if (format[i] != '{') {
+            text += format[i++];
+            continue;
+        }
+        size_t expression_stop = expression_end(format, i + 1);
+        std::string expression = format.substr(i + 1, expression_stop - i - 1);
+        if (expression.find_first_not_of(" \t") == std::string::npos) {
+            raise_exception("SyntaxError", "f-string: empty expression not allowed");
+            return fields;
+        }
+        size_t field_end = format.find('}', expression_stop);
+        if (field_end == std::string::npos) {
+            raise_exception("SyntaxError", "f-string: expecting '}'");
+            return fields;
+        }
+        std::string_view spec;
+        if (format[expression_stop] == ':') {
+            spec = std::string_view(format).substr(expression_stop + 1, field_end - expression_stop - 1);
+            if (spec.find('{') != std::string_view::npos) {
+                raise_exception("SyntaxError", "f-string: expressions nested too deeply");
+                return fields;
             }
+        }
+        auto instruction = std::make_shared<Instruction>(Instruction::fromTokenList(tokenizeLine(expression)));
+        fields.push_back({std::move(text), std::move(instruction), FormatSpec(spec)});
+        text.clear();
+        i = field_end + 1;
+    }
+    if (i == format.size()) {
+        raise_exception("SyntaxError", "f-string: expecting '}'");
+        return fields;
+    }
+    fields.push_back({std::move(text), nullptr, FormatSpec()});
+    end = i;
+    return fields;
+}
 
-            std::string expression_to_eval;
-            std::string format_modifiers;
-            if (last_colon_pos != std::string::npos) {
-                expression_to_eval = elem.value.substr(0, last_colon_pos);
-                format_modifiers = elem.value.substr(last_colon_pos + 1);
+FStringFormatter::FStringFormatter(const std::string &format) {
+    std::string text;
+    size_t i = 0;
+    while (i < format.size()) {
+        char ch = format[i];
+        if ((ch == '{' || ch == '}') && i + 1 < format.size() && format[i + 1] == ch) {
+            text += ch;
+            i += 2;
+            continue;
+        }
+        if (ch == '}') {
+            raise_exception("SyntaxError", "f-string: single '}' is not allowed");
+            return;
+        }
+        if (ch != '{') {
+            text += ch;
+            ++i;
+            continue;
+        }
+
+        size_t end = expression_end(format, i + 1);
+        std::string expression = format.substr(i + 1, end - i - 1);
+        if (expression.find_first_not_of(" \t") == std::string::npos) {
+            raise_exception("SyntaxError", "f-string: empty expression not allowed");
+            return;
+        }
+        FormatSpec format_spec;
+        std::vector<NestedField> nested_spec;
+        if (format[end] == ':') {
+            size_t spec_begin = end + 1;
+            nested_spec = parse_spec(format, spec_begin, end);
+            if (nested_spec.size() == 1) {
+                format_spec = FormatSpec(std::string_view(format).substr(spec_begin, end - spec_begin));
+                nested_spec.clear();
             }
-            else {
-                expression_to_eval = elem.value;
+        }
+
+        auto instruction = std::make_shared<Instruction>(Instruction::fromTokenList(tokenizeLine(expression)));
+        size_estimate += text.size() + std::max<size_t>(format_spec.width, 8);
+        parts.push_back({std::move(text), std::move(instruction), format_spec, std::move(nested_spec)});
+        text.clear();
+        i = end + 1;
+    }
+    if (!text.empty() || parts.empty()) {
+        size_estimate += text.size();
+        parts.push_back({std::move(text), nullptr, FormatSpec(), {}});
+    }
+}
+
+std::string FStringFormatter::format(Scope *scope) const {
+    std::string res;
+    res.reserve(size_estimate);
+    for (const auto &part: parts) {
+        res += part.text;
+        if (!part.expression) {
+            continue;
+        }
+        Variable value = part.expression->execute(scope);
+        if (part.nested_spec.empty()) {
+            format_value(res, value, part.format_spec);
+            continue;
+        }
+        std::string spec;
+        for (const auto &field: part.nested_spec) {
+            spec += field.text;
+            if (field.expression) {
+                format_value(spec, field.expression->execute(scope), field.format_spec);
             }
-            res += apply_fstring_format_modifiers(StandardFunctions::eval_string(expression_to_eval, scope)->to_str(), format_modifiers);
         }
+        format_value(res, value, FormatSpec(spec));
+    }
+    return res;
+}
+
+/*
+ * str.format()
+ */
+
+namespace {
+
+// The arguments of a str.format() call and the numbering of its fields
+struct FieldArguments {
+    const std::vector<Variable> &args;
+    const std::vector<std::pair<std::string_view, Variable>> &kwargs;
+    // Automatic numbering ({}) and numbered fields ({0}) can't be mixed
+    size_t next_index = 0;
+    bool numbered = false;
+};
+
+} // namespace
+
+// The value of a field name: {} is the next argument, {0} and {x} the given one
+static Variable field_value(FieldArguments &arguments, std::string_view name) {
+    if (!name.empty() && !std::isdigit(static_cast<unsigned char>(name[0]))) {
+        for (const auto &[key, kwarg]: arguments.kwargs) {
+            if (key == name) {
+                return kwarg;
+            }
+        }
+        raise_exception("KeyError", "'" + std::string(name) + "'");
+        return NONE;
+    }
+
+    size_t index = 0;
+    if (name.empty()) {
+        if (arguments.numbered) {
+            raise_exception("ValueError", "cannot switch from manual field specification to automatic field numbering");
+            return NONE;
+        }
+        index = arguments.next_index++;
+    }
+    else {
+        if (arguments.next_index > 0) {
+            raise_exception("ValueError", "cannot switch from automatic field numbering to manual field specification");
+            return NONE;
+        }
+        arguments.numbered = true;
+        std::from_chars(name.data(), name.data() + name.size(), index);
+    }
+    if (index >= arguments.args.size()) {
+        raise_exception("IndexError", "Replacement index " + std::to_string(index) + " out of range for positional args tuple");
+        return NONE;
+    }
+    return arguments.args[index];
+}
+
+// End of the field whose { is at format[begin]: the matching }
+static size_t field_end(std::string_view format, size_t begin) {
+    size_t depth = 0;
+    for (size_t i = begin; i < format.size(); ++i) {
+        if (format[i] == '{') {
+            ++depth;
+        }
+        else if (format[i] == '}' && --depth == 0) {
+            return i;
+        }
+    }
+    raise_exception("ValueError", "expected '}' before end of string");
+    return format.size();
+}
+
+// Appends the field name[!conversion][:spec], where the spec may have fields
+// of its own, but those may not
+static void append_field(std::string &output, std::string_view field, FieldArguments &arguments, bool nested) {
+    size_t name_end = std::min(field.find_first_of("!:"), field.size());
+    char conversion = 0;
+    std::string_view spec;
+    if (name_end < field.size() && field[name_end] == '!') {
+        if (name_end + 1 == field.size()) {
+            raise_exception("ValueError", "end of string while looking for conversion specifier");
+            return;
+        }
+        conversion = field[name_end + 1];
+        if (name_end + 2 < field.size() && field[name_end + 2] != ':') {
+            raise_exception("ValueError", "expected ':' after conversion specifier");
+            return;
+        }
+        if (!std::strchr("rsa", conversion)) {
+            raise_exception("ValueError", std::string("Unknown conversion specifier ") + conversion);
+            return;
+        }
+        if (name_end + 2 < field.size()) {
+            spec = field.substr(name_end + 3);
+        }
+    }
+    else if (name_end < field.size()) {
+        spec = field.substr(name_end + 1);
+    }
+
+    Variable value = field_value(arguments, field.substr(0, name_end));
+    if (conversion == 'r') {
+        value = NEW_STRING(repr(value));
+    }
+    else if (conversion == 'a') {
+        value = NEW_STRING(ascii_escape(repr(value)));
+    }
+    else if (conversion == 's') {
+        value = NEW_STRING(value->to_str());
+    }
+
+    if (spec.find('{') == std::string_view::npos) {
+        format_value(output, value, FormatSpec(spec));
+        return;
+    }
+    if (nested) {
+        raise_exception("ValueError", "Max string recursion exceeded");
+        return;
+    }
+    std::string expanded;
+    size_t i = 0;
+    while (i < spec.size()) {
+        if (spec[i] != '{') {
+            expanded += spec[i++];
+            continue;
+        }
+        size_t end = field_end(spec, i);
+        append_field(expanded, spec.substr(i + 1, end - i - 1), arguments, true);
+        i = end + 1;
+    }
+    format_value(output, value, FormatSpec(expanded));
+}
+
+std::string format_fields(std::string_view format, const std::vector<Variable> &args,
+                          const std::vector<std::pair<std::string_view, Variable>> &kwargs) {
+    std::string res;
+    res.reserve(format.size() + 8 * args.size());
+    FieldArguments arguments{args, kwargs};
+    size_t i = 0;
+    while (i < format.size()) {
+        char ch = format[i];
+        if ((ch == '{' || ch == '}') && i + 1 < format.size() && format[i + 1] == ch) {
+            res += ch;
+            i += 2;
+            continue;
+        }
+        if (ch == '}') {
+            raise_exception("ValueError", "Single '}' encountered in format string");
+            return res;
+        }
+        if (ch != '{') {
+            size_t next = std::min(format.find('{', i), format.find('}', i));
+            next = std::min(next, format.size());
+            res += format.substr(i, next - i);
+            i = next;
+            continue;
+        }
+
+        size_t end = field_end(format, i);
+        append_field(res, format.substr(i + 1, end - i - 1), arguments, false);
+        i = end + 1;
     }
     return res;
 }
@@ -2,43 +2,139 @@
 
 #include "variable/Variable.h"
 
+#include <memory>
+#include <string_view>
+
 namespace MiniPython {
 
-struct ParsedFormat {
-    bool plus;
-    bool dot;
-    bool octothorp;
-    int after_dot;
-    int after_octothorp;
-    std::string letter;
-    ParsedFormat(const std::string &format);
-};
+/*
+ * Format spec of f-strings, format() and str.format():
+ * [[fill]align][sign][#][0][width][grouping][.precision][type]
+ */
+struct FormatSpec {
+    // One UTF-8 character
+    std::string fill = " ";
+    // <, >, ^ or =; 0 for the default of the value
+    char align = 0;
+    // +, - or space; 0 when not given
+    char sign = 0;
+    bool alternate = false;
+    bool zero = false;
+    // , or _
+    char grouping = 0;
+    size_t width = 0;
+    int precision = -1;
+    char type = 0;
+    // Zero-padding of the digits of an integer; only %-formatting sets it
+    size_t min_digits = 0;
 
-enum class FormatElementType {
-    EXACT_STRING,
-    INTERPOLATION,
+    FormatSpec() = default;
+    explicit FormatSpec(std::string_view spec);
+
+    // The empty spec, which formats as str() does
+    bool is_default() const;
 };
 
-struct FormatElement {
-    FormatElementType type;
-    std::string value;
-    FormatElement(FormatElementType _type, const std::string &_value);
+// Appends var formatted by spec to output
+void format_value(std::string &output, const Variable &var, const FormatSpec &spec);
+std::string format_value(const Variable &var, std::string_view spec);
+
+// str.format(): {}, {0} and {name} fields, each with an optional format spec
+std::string format_fields(std::string_view format, const std::vector<Variable> &args,
+                          const std::vector<std::pair<std::string_view, Variable>> &kwargs);
+
+/*
+ * A %-conversion: %[flags][width][.precision]letter. after_octothorp is
+ * the width when the # flag is given, width is the width in any case.
+ */
+struct ParsedFormat {
+    bool plus = false;
+    bool dot = false;
+    bool octothorp = false;
+    bool minus = false;
+    bool zero = false;
+    bool space = false;
+    int after_dot = 0;
+    int after_octothorp = 0;
+    int width = 0;
+    std::string letter;
+    ParsedFormat(std::string_view format);
 };
 
+/**
+ * @brief Compiled %-format
+ *
+ * The format is split once into text and conversions, and each conversion
+ * is turned into a FormatSpec, so the values are written straight into the
+ * result by the same engine as format() and f-strings. A literal format is
+ * compiled when its line is parsed, so a % in a loop doesn't parse it again.
+ */
 class PercentFormatter {
 public:
-    PercentFormatter(const std::string &format);
-    std::string format(const std::vector<Variable> &variables);
+    // %s of a bytes format inserts bytes as they are, like %b
+    PercentFormatter(const std::string &format, bool bytes = false);
+
+    std::string format(const std::vector<Variable> &variables) const;
+    // format % values, where values is a tuple or a single value
+    Variable mod(const Variable &values) const;
 private:
-    std::vector<FormatElement> elements;
+    struct Conversion {
+        // Text before the conversion, with %% unescaped
+        std::string text;
+        ParsedFormat spec;
+        // The same conversion for the format spec engine
+        FormatSpec format_spec;
+    };
+
+    bool bytes;
+    std::vector<Conversion> conversions;
+    // Text after the last conversion
+    std::string tail;
+    size_t text_size = 0;
 };
 
+class Instruction;
+
+/**
+ * @brief Compiled f-string
+ *
+ * The literal is split once, when the line is parsed, into text and
+ * placeholders, and each placeholder expression is parsed into an
+ * Instruction, as are the fields nested in a format spec ({x:>{width}}).
+ * format() then only executes the expressions and appends to a string
+ * reserved for the text plus an estimate of the values, made at parse time
+ * from the widths of the specs.
+ */
 class FStringFormatter {
 public:
     FStringFormatter(const std::string &format);
-    std::string format(Scope *scope);
+    std::string format(Scope *scope) const;
 private:
-    std::vector<FormatElement> elements;
+    // A field nested in a format spec, with the text before it
+    struct NestedField {
+        std::string text;
+        // nullptr for the text after the last field
+        std::shared_ptr<Instruction> expression;
+        FormatSpec format_spec;
+    };
+
+    struct Part {
+        // Text before the placeholder, with {{ and }} unescaped
+        std::string text;
+        // nullptr for the text after the last placeholder
+        std::shared_ptr<Instruction> expression;
+        // What follows the colon
+        FormatSpec format_spec;
+        // The spec when it has nested fields, format_spec is unused then
+        std::vector<NestedField> nested_spec;
+    };
+
+    // The spec starting at format[begin], up to the brace closing the
+    // placeholder, which is returned in end
+    static std::vector<NestedField> parse_spec(const std::string &format, size_t begin, size_t &end);
+
+    std::vector<Part> parts;
+    size_t size_estimate = 0;
 };
 
 std::string interpolate_value(const std::string &format, Variable var);
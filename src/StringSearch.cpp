@@ -0,0 +1,199 @@
+#include "StringSearch.h"
+#include "Utils.h"
+
+#include <algorithm>
+#include <cstring>
+#include <immintrin.h>
+#include <vector>
+
+namespace MiniPython {
+
+namespace StringSearch {
+
+#define AVX2 __attribute__((target("avx2")))
+
+// Candidates are positions holding the first byte of the needle
+static size_t find_scalar(const char *haystack, size_t size, std::string_view needle, size_t from) {
+    size_t n = needle.size();
+    while (from + n <= size) {
+        auto candidate = static_cast<const char *>(std::memchr(haystack + from, needle[0], size - n + 1 - from));
+        if (!candidate) {
+            return npos;
+        }
+        size_t position = candidate - haystack;
+        if (std::memcmp(candidate + 1, needle.data() + 1, n - 1) == 0) {
+            return position;
+        }
+        from = position + 1;
+    }
+    return npos;
+}
+
+/*
+ * The blocks compare the first byte of the needle at haystack[i..i+width)
+ * and the last byte at haystack[i+n-1..i+n-1+width); a set bit in both is
+ * a candidate checked with memcmp. Bytes in between are compared only for
+ * candidates, so text without the two bytes in the right distance streams
+ * through at full vector speed.
+ */
+
+static size_t find_sse2(const char *haystack, size_t size, std::string_view needle, size_t from) {
+    size_t n = needle.size();
+    __m128i first = _mm_set1_epi8(needle[0]);
+    __m128i last = _mm_set1_epi8(needle[n - 1]);
+    size_t i = from;
+    for (; i + n - 1 + 16 <= size; i += 16) {
+        __m128i block_first = _mm_loadu_si128(reinterpret_cast<const __m128i *>(haystack + i));
+        __m128i block_last = _mm_loadu_si128(reinterpret_cast<const __m128i *>(haystack + i + n - 1));
+        uint32_t mask = _mm_movemask_epi8(_mm_and_si128(_mm_cmpeq_epi8(first, block_first),
+                                                        _mm_cmpeq_epi8(last, block_last)));
+        while (mask) {
+            size_t position = i + __builtin_ctz(mask);
+            if (std::memcmp(haystack + position + 1, needle.data() + 1, n - 2) == 0) {
+                return position;
+            }
+            mask &= mask - 1;
+        }
+    }
+    return find_scalar(haystack, size, needle, i);
+}
+
+AVX2 static size_t find_avx2(const char *haystack, size_t size, std::string_view needle, size_t from) {
+    size_t n = needle.size();
+    __m256i first = _mm256_set1_epi8(needle[0]);
+    __m256i last = _mm256_set1_epi8(needle[n - 1]);
+    size_t i = from;
+    for (; i + n - 1 + 32 <= size; i += 32) {
+        __m256i block_first = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(haystack + i));
+        __m256i block_last = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(haystack + i + n - 1));
+        uint32_t mask = _mm256_movemask_epi8(_mm256_and_si256(_mm256_cmpeq_epi8(first, block_first),
+                                                              _mm256_cmpeq_epi8(last, block_last)));
+        while (mask) {
+            size_t position = i + __builtin_ctz(mask);
+            if (std::memcmp(haystack + position + 1, needle.data() + 1, n - 2) == 0) {
+                return position;
+            }
+            mask &= mask - 1;
+        }
+    }
+    return find_sse2(haystack, size, needle, i);
+}
+
+Searcher::Searcher(std::string_view _needle)
+    : needle(_needle)
+{
+    size_t n = needle.size();
+    if (n > LONG_NEEDLE) {
+        shifts.fill(n);
+        for (size_t i = 0; i + 1 < n; ++i) {
+            shifts[static_cast<unsigned char>(needle[i])] = n - 1 - i;
+        }
+    }
+}
+
+size_t Searcher::find(std::string_view haystack, size_t from) const {
+    const char *data = haystack.data();
+    size_t size = haystack.size();
+    size_t n = needle.size();
+    if (from > size || n > size - from) {
+        return npos;
+    }
+    if (n == 0) {
+        return from;
+    }
+    if (n == 1) {
+        auto found = static_cast<const char *>(std::memchr(data + from, needle[0], size - from));
+        return found ? found - data : npos;
+    }
+    if (n <= LONG_NEEDLE) {
+        return cpu_features().avx2 ? find_avx2(data, size, needle, from) : find_sse2(data, size, needle, from);
+    }
+
+    // Horspool: shift by the distance of the byte under the needle's end
+    // from the end of the needle
+    unsigned char last = needle[n - 1];
+    for (size_t i = from; i + n <= size; i += shifts[static_cast<unsigned char>(data[i + n - 1])]) {
+        if (static_cast<unsigned char>(data[i + n - 1]) == last && std::memcmp(data + i, needle.data(), n - 1) == 0) {
+            return i;
+        }
+    }
+    return npos;
+}
+
+size_t Searcher::rfind(std::string_view haystack) const {
+    const char *data = haystack.data();
+    size_t n = needle.size();
+    if (n > haystack.size()) {
+        return npos;
+    }
+    if (n == 0) {
+        return haystack.size();
+    }
+    // Candidates are searched for in [0, end)
+    size_t end = haystack.size() - n + 1;
+    while (end > 0) {
+        auto candidate = static_cast<const char *>(memrchr(data, needle[0], end));
+        if (!candidate) {
+            return npos;
+        }
+        if (std::memcmp(candidate + 1, needle.data() + 1, n - 1) == 0) {
+            return candidate - data;
+        }
+        end = candidate - data;
+    }
+    return npos;
+}
+
+size_t find(std::string_view haystack, std::string_view needle) {
+    return Searcher(needle).find(haystack);
+}
+
+size_t count(std::string_view haystack, std::string_view needle, size_t max_count) {
+    if (needle.empty()) {
+        return std::min(haystack.size() + 1, max_count);
+    }
+    Searcher searcher(needle);
+    size_t result = 0;
+    for (size_t position = searcher.find(haystack); position != npos && result < max_count;
+         position = searcher.find(haystack, position + needle.size())) {
+        ++result;
+    }
+    return result;
+}
+
+std::string replace(std::string_view input, std::string_view old, std::string_view replacement, size_t max_count) {
+    // Positions first, so the result is allocated once with its final size
+    std::vector<size_t> positions;
+    if (old.empty()) {
+        for (size_t i = 0; i <= input.size() && positions.size() < max_count; ++i) {
+            positions.push_back(i);
+        }
+    }
+    else {
+        Searcher searcher(old);
+        for (size_t position = searcher.find(input); position != npos && positions.size() < max_count;
+             position = searcher.find(input, position + old.size())) {
+            positions.push_back(position);
+        }
+    }
+    if (positions.empty()) {
+        return std::string(input);
+    }
+
+    size_t size = input.size() - positions.size() * old.size() + positions.size() * replacement.size();
+    return write_string(size, [&](char *output) {
+        size_t done = 0;
+        for (size_t position: positions) {
+            std::memcpy(output, input.data() + done, position - done);
+            output += position - done;
+            std::memcpy(output, replacement.data(), replacement.size());
+            output += replacement.size();
+            done = position + old.size();
+        }
+        std::memcpy(output, input.data() + done, input.size() - done);
+    });
+}
+
+} // namespace StringSearch
+
+} // namespace MiniPython
@@ -0,0 +1,57 @@
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <string_view>
+
+namespace MiniPython {
+
+/**
+ * @brief Substring search of str and bytes methods
+ *
+ * Everything works on views, nothing is copied. One-byte needles use memchr.
+ * Needles up to LONG_NEEDLE bytes use a SIMD filter (AVX2 or SSE2): the
+ * first and the last byte of the needle are compared at 32 or 16 positions
+ * at once and only the positions matching both are compared in full. Longer
+ * needles use Boyer-Moore-Horspool, which skips up to the needle length at
+ * each step.
+ */
+namespace StringSearch {
+
+constexpr size_t npos = std::string_view::npos;
+
+class Searcher {
+public:
+    static constexpr size_t LONG_NEEDLE = 64;
+
+    // The needle must outlive the searcher
+    explicit Searcher(std::string_view needle);
+
+    // First occurrence starting at or after from, or npos
+    size_t find(std::string_view haystack, size_t from = 0) const;
+    // Last occurrence, or npos
+    size_t rfind(std::string_view haystack) const;
+
+    size_t size() const { return needle.size(); }
+
+private:
+    std::string_view needle;
+    // Horspool shifts, filled for long needles only
+    std::array<uint32_t, 256> shifts;
+};
+
+size_t find(std::string_view haystack, std::string_view needle);
+
+// Non-overlapping occurrences, as in str.count()
+size_t count(std::string_view haystack, std::string_view needle, size_t max_count = npos);
+
+// The first max_count occurrences of old replaced; an empty old matches
+// between all characters, as in str.replace()
+std::string replace(std::string_view input, std::string_view old, std::string_view replacement,
+                    size_t max_count = npos);
+
+} // namespace StringSearch
+
+} // namespace MiniPython
@@ -0,0 +1,521 @@
+#include "TextKernels.h"
+#include "Utils.h"
+
+#include <algorithm>
+#include <array>
+#include <immintrin.h>
+#include <locale.h>
+#include <wctype.h>
+
+namespace MiniPython {
+
+namespace TextKernels {
+
+#define AVX2 __attribute__((target("avx2")))
+
+// \x1c-\x1f, whitespace in str and OTHER in bytes; folded into one of them
+// before classify() and classify_str() return
+static constexpr uint8_t SEPARATOR = 128;
+
+static constexpr std::array<uint8_t, 256> CLASSES = [] {
+    std::array<uint8_t, 256> classes{};
+    for (int ch = 0; ch < 256; ++ch) {
+        if ('a' <= ch && ch <= 'z') {
+            classes[ch] = LOWER;
+        }
+        else if ('A' <= ch && ch <= 'Z') {
+            classes[ch] = UPPER;
+        }
+        else if ('0' <= ch && ch <= '9') {
+            classes[ch] = DIGIT;
+        }
+        else if (ch == ' ' || ('\t' <= ch && ch <= '\r')) {
+            classes[ch] = SPACE;
+        }
+        else if (0x1c <= ch && ch <= 0x1f) {
+            classes[ch] = SEPARATOR;
+        }
+        else {
+            classes[ch] = ch < 0x80 ? OTHER : NON_ASCII;
+        }
+    }
+    return classes;
+}();
+
+static uint8_t classify_scalar(const unsigned char *input, size_t size) {
+    uint8_t result = 0;
+    for (size_t i = 0; i < size; ++i) {
+        result |= CLASSES[input[i]];
+    }
+    return result;
+}
+
+static char map_case_scalar(char ch, Case mapping) {
+    uint8_t classes = CLASSES[static_cast<unsigned char>(ch)];
+    bool flip = (mapping == Case::LOWER) ? (classes & UPPER)
+              : (mapping == Case::UPPER || mapping == Case::TITLE) ? (classes & LOWER)
+              : (classes & (LOWER | UPPER));
+    return flip ? (ch ^ 0x20) : ch;
+}
+
+/*
+ * A byte is in [first, first + count) when adding 0x80 - first moves it
+ * to [-128, -128 + count) as a signed byte, so each range is one add and
+ * one signed compare. Classes are collected as bits of each byte and
+ * ORed over the whole input.
+ */
+
+static __m128i in_range_sse2(__m128i ch, char first, char count) {
+    __m128i shifted = _mm_add_epi8(ch, _mm_set1_epi8(static_cast<char>(0x80 - first)));
+    return _mm_cmplt_epi8(shifted, _mm_set1_epi8(static_cast<char>(-128 + count)));
+}
+
+static __m128i classes_sse2(__m128i ch) {
+    __m128i lower = _mm_and_si128(in_range_sse2(ch, 'a', 26), _mm_set1_epi8(LOWER));
+    __m128i upper = _mm_and_si128(in_range_sse2(ch, 'A', 26), _mm_set1_epi8(UPPER));
+    __m128i digit = _mm_and_si128(in_range_sse2(ch, '0', 10), _mm_set1_epi8(DIGIT));
+    __m128i space = _mm_or_si128(in_range_sse2(ch, '\t', 5), _mm_cmpeq_epi8(ch, _mm_set1_epi8(' ')));
+    space = _mm_and_si128(space, _mm_set1_epi8(SPACE));
+    __m128i separator = _mm_and_si128(in_range_sse2(ch, 0x1c, 4), _mm_set1_epi8(static_cast<char>(SEPARATOR)));
+    __m128i non_ascii = _mm_and_si128(_mm_cmplt_epi8(ch, _mm_setzero_si128()), _mm_set1_epi8(NON_ASCII));
+
+    __m128i classes = _mm_or_si128(_mm_or_si128(lower, upper), _mm_or_si128(_mm_or_si128(digit, space), non_ascii));
+    classes = _mm_or_si128(classes, separator);
+    __m128i other = _mm_and_si128(_mm_cmpeq_epi8(classes, _mm_setzero_si128()), _mm_set1_epi8(OTHER));
+    return _mm_or_si128(classes, other);
+}
+
+static uint8_t reduce_or(__m128i bits) {
+    bits = _mm_or_si128(bits, _mm_srli_si128(bits, 8));
+    bits = _mm_or_si128(bits, _mm_srli_si128(bits, 4));
+    bits = _mm_or_si128(bits, _mm_srli_si128(bits, 2));
+    bits = _mm_or_si128(bits, _mm_srli_si128(bits, 1));
+    return static_cast<uint8_t>(_mm_cvtsi128_si32(bits));
+}
+
+static uint8_t classify_sse2(const unsigned char *input, size_t size) {
+    __m128i found = _mm_setzero_si128();
+    size_t i = 0;
+    for (; i + 16 <= size; i += 16) {
+        found = _mm_or_si128(found, classes_sse2(_mm_loadu_si128(reinterpret_cast<const __m128i *>(input + i))));
+    }
+    return reduce_or(found) | classify_scalar(input + i, size - i);
+}
+
+static __m128i flip_mask_sse2(__m128i ch, Case mapping) {
+    switch (mapping) {
+    case Case::LOWER:
+        return in_range_sse2(ch, 'A', 26);
+    case Case::UPPER:
+    case Case::TITLE:
+        return in_range_sse2(ch, 'a', 26);
+    default:
+        return _mm_or_si128(in_range_sse2(ch, 'A', 26), in_range_sse2(ch, 'a', 26));
+    }
+}
+
+static void map_case_sse2(const char *input, char *output, size_t size, Case mapping) {
+    size_t i = 0;
+    for (; i + 16 <= size; i += 16) {
+        __m128i ch = _mm_loadu_si128(reinterpret_cast<const __m128i *>(input + i));
+        __m128i flip = _mm_and_si128(flip_mask_sse2(ch, mapping), _mm_set1_epi8(0x20));
+        _mm_storeu_si128(reinterpret_cast<__m128i *>(output + i), _mm_xor_si128(ch, flip));
+    }
+    for (; i < size; ++i) {
+        output[i] = map_case_scalar(input[i], mapping);
+    }
+}
+
+AVX2 static __m256i in_range_avx2(__m256i ch, char first, char count) {
+    __m256i shifted = _mm256_add_epi8(ch, _mm256_set1_epi8(static_cast<char>(0x80 - first)));
+    return _mm256_cmpgt_epi8(_mm256_set1_epi8(static_cast<char>(-128 + count)), shifted);
+}
+
+AVX2 static __m256i classes_avx2(__m256i ch) {
+    __m256i lower = _mm256_and_si256(in_range_avx2(ch, 'a', 26), _mm256_set1_epi8(LOWER));
+    __m256i upper = _mm256_and_si256(in_range_avx2(ch, 'A', 26), _mm256_set1_epi8(UPPER));
+    __m256i digit = _mm256_and_si256(in_range_avx2(ch, '0', 10), _mm256_set1_epi8(DIGIT));
+    __m256i space = _mm256_or_si256(in_range_avx2(ch, '\t', 5), _mm256_cmpeq_epi8(ch, _mm256_set1_epi8(' ')));
+    space = _mm256_and_si256(space, _mm256_set1_epi8(SPACE));
+    __m256i separator = _mm256_and_si256(in_range_avx2(ch, 0x1c, 4), _mm256_set1_epi8(static_cast<char>(SEPARATOR)));
+    __m256i non_ascii = _mm256_and_si256(_mm256_cmpgt_epi8(_mm256_setzero_si256(), ch), _mm256_set1_epi8(NON_ASCII));
+
+    __m256i classes = _mm256_or_si256(_mm256_or_si256(lower, upper), _mm256_or_si256(_mm256_or_si256(digit, space), non_ascii));
+    classes = _mm256_or_si256(classes, separator);
+    __m256i other = _mm256_and_si256(_mm256_cmpeq_epi8(classes, _mm256_setzero_si256()), _mm256_set1_epi8(OTHER));
+    return _mm256_or_si256(classes, other);
+}
+
+AVX2 static uint8_t classify_avx2(const unsigned char *input, size_t size) {
+    __m256i found = _mm256_setzero_si256();
+    size_t i = 0;
+    for (; i + 32 <= size; i += 32) {
+        found = _mm256_or_si256(found, classes_avx2(_mm256_loadu_si256(reinterpret_cast<const __m256i *>(input + i))));
+    }
+    __m128i half = _mm_or_si128(_mm256_castsi256_si128(found), _mm256_extracti128_si256(found, 1));
+    return reduce_or(half) | classify_sse2(input + i, size - i);
+}
+
+AVX2 static __m256i flip_mask_avx2(__m256i ch, Case mapping) {
+    switch (mapping) {
+    case Case::LOWER:
+        return in_range_avx2(ch, 'A', 26);
+    case Case::UPPER:
+    case Case::TITLE:
+        return in_range_avx2(ch, 'a', 26);
+    default:
+        return _mm256_or_si256(in_range_avx2(ch, 'A', 26), in_range_avx2(ch, 'a', 26));
+    }
+}
+
+AVX2 static void map_case_avx2(const char *input, char *output, size_t size, Case mapping) {
+    size_t i = 0;
+    for (; i + 32 <= size; i += 32) {
+        __m256i ch = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(input + i));
+        __m256i flip = _mm256_and_si256(flip_mask_avx2(ch, mapping), _mm256_set1_epi8(0x20));
+        _mm256_storeu_si256(reinterpret_cast<__m256i *>(output + i), _mm256_xor_si256(ch, flip));
+    }
+    map_case_sse2(input + i, output + i, size - i, mapping);
+}
+
+static uint8_t classify_bytes(std::string_view input, uint8_t separator) {
+    auto bytes = reinterpret_cast<const unsigned char *>(input.data());
+    uint8_t classes = cpu_features().avx2 ? classify_avx2(bytes, input.size()) : classify_sse2(bytes, input.size());
+    return (classes & SEPARATOR) ? ((classes & ~SEPARATOR) | separator) : classes;
+}
+
+uint8_t classify(std::string_view input) {
+    return classify_bytes(input, OTHER);
+}
+
+uint8_t classify_str(std::string_view input) {
+    return classify_bytes(input, SPACE);
+}
+
+void map_case(std::string_view input, char *output, Case mapping) {
+    if (cpu_features().avx2) {
+        map_case_avx2(input.data(), output, input.size(), mapping);
+    }
+    else {
+        map_case_sse2(input.data(), output, input.size(), mapping);
+    }
+}
+
+std::string map_case(std::string_view input, Case mapping) {
+    return write_string(input.size(), [input, mapping](char *output) {
+        map_case(input, output, mapping);
+    });
+}
+
+/*
+ * UTF-8
+ */
+
+static locale_t utf8_locale() {
+    static const locale_t locale = newlocale(LC_CTYPE_MASK, "C.UTF-8", static_cast<locale_t>(0));
+    return locale;
+}
+
+static bool is_continuation(const std::string_view &input, size_t i) {
+    return i < input.size() && (static_cast<unsigned char>(input[i]) & 0xc0) == 0x80;
+}
+
+// Code point starting at input[i], which is not ASCII, and its length in
+// bytes; a malformed sequence is a single byte that is not a character
+static std::pair<char32_t, size_t> decode(std::string_view input, size_t i) {
+    unsigned char lead = input[i];
+    size_t length = (lead >= 0xf0) ? 4 : (lead >= 0xe0) ? 3 : (lead >= 0xc0) ? 2 : 0;
+    if (length == 0 || lead > 0xf4) {
+        return {0, 1};
+    }
+    char32_t code_point = lead & (0x7f >> length);
+    for (size_t k = 1; k < length; ++k) {
+        if (!is_continuation(input, i + k)) {
+            return {0, 1};
+        }
+        code_point = (code_point << 6) | (input[i + k] & 0x3f);
+    }
+    return {code_point, length};
+}
+
+static void encode(char32_t code_point, std::string &output) {
+    if (code_point < 0x80) {
+        output += static_cast<char>(code_point);
+    }
+    else if (code_point < 0x800) {
+        output += static_cast<char>(0xc0 | (code_point >> 6));
+        output += static_cast<char>(0x80 | (code_point & 0x3f));
+    }
+    else if (code_point < 0x10000) {
+        output += static_cast<char>(0xe0 | (code_point >> 12));
+        output += static_cast<char>(0x80 | ((code_point >> 6) & 0x3f));
+        output += static_cast<char>(0x80 | (code_point & 0x3f));
+    }
+    else {
+        output += static_cast<char>(0xf0 | (code_point >> 18));
+        output += static_cast<char>(0x80 | ((code_point >> 12) & 0x3f));
+        output += static_cast<char>(0x80 | ((code_point >> 6) & 0x3f));
+        output += static_cast<char>(0x80 | (code_point & 0x3f));
+    }
+}
+
+struct NumericRange {
+    char32_t first;
+    char32_t last;
+    NumericType type;
+};
+
+// Numbers (categories Nd, Nl and No) and their numeric types, generated from
+// the Unicode 14.0 database
+static constexpr NumericRange NUMBERS[] = {
+    {0x0030, 0x0039, NUMERIC_DECIMAL}, {0x00b2, 0x00b3, NUMERIC_DIGIT},
+    {0x00b9, 0x00b9, NUMERIC_DIGIT}, {0x00bc, 0x00be, NUMERIC_OTHER},
+    {0x0660, 0x0669, NUMERIC_DECIMAL}, {0x06f0, 0x06f9, NUMERIC_DECIMAL},
+    {0x07c0, 0x07c9, NUMERIC_DECIMAL}, {0x0966, 0x096f, NUMERIC_DECIMAL},
+    {0x09e6, 0x09ef, NUMERIC_DECIMAL}, {0x09f4, 0x09f9, NUMERIC_OTHER},
+    {0x0a66, 0x0a6f, NUMERIC_DECIMAL}, {0x0ae6, 0x0aef, NUMERIC_DECIMAL},
+    {0x0b66, 0x0b6f, NUMERIC_DECIMAL}, {0x0b72, 0x0b77, NUMERIC_OTHER},
+    {0x0be6, 0x0bef, NUMERIC_DECIMAL}, {0x0bf0, 0x0bf2, NUMERIC_OTHER},
+    {0x0c66, 0x0c6f, NUMERIC_DECIMAL}, {0x0c78, 0x0c7e, NUMERIC_OTHER},
+    {0x0ce6, 0x0cef, NUMERIC_DECIMAL}, {0x0d58, 0x0d5e, NUMERIC_OTHER},
+    {0x0d66, 0x0d6f, NUMERIC_DECIMAL}, {0x0d70, 0x0d78, NUMERIC_OTHER},
+    {0x0de6, 0x0def, NUMERIC_DECIMAL}, {0x0e50, 0x0e59, NUMERIC_DECIMAL},
+    {0x0ed0, 0x0ed9, NUMERIC_DECIMAL}, {0x0f20, 0x0f29, NUMERIC_DECIMAL},
+    {0x0f2a, 0x0f33, NUMERIC_OTHER}, {0x1040, 0x1049, NUMERIC_DECIMAL},
+    {0x1090, 0x1099, NUMERIC_DECIMAL}, {0x1369, 0x1371, NUMERIC_DIGIT},
+    {0x1372, 0x137c, NUMERIC_OTHER}, {0x16ee, 0x16f0, NUMERIC_OTHER},
+    {0x17e0, 0x17e9, NUMERIC_DECIMAL}, {0x17f0, 0x17f9, NUMERIC_OTHER},
+    {0x1810, 0x1819, NUMERIC_DECIMAL}, {0x1946, 0x194f, NUMERIC_DECIMAL},
+    {0x19d0, 0x19d9, NUMERIC_DECIMAL}, {0x19da, 0x19da, NUMERIC_DIGIT},
+    {0x1a80, 0x1a89, NUMERIC_DECIMAL}, {0x1a90, 0x1a99, NUMERIC_DECIMAL},
+    {0x1b50, 0x1b59, NUMERIC_DECIMAL}, {0x1bb0, 0x1bb9, NUMERIC_DECIMAL},
+    {0x1c40, 0x1c49, NUMERIC_DECIMAL}, {0x1c50, 0x1c59, NUMERIC_DECIMAL},
+    {0x2070, 0x2070, NUMERIC_DIGIT}, {0x2074, 0x2079, NUMERIC_DIGIT},
+    {0x2080, 0x2089, NUMERIC_DIGIT}, {0x2150, 0x2182, NUMERIC_OTHER},
+    {0x2185, 0x2189, NUMERIC_OTHER}, {0x2460, 0x2468, NUMERIC_DIGIT},
+    {0x2469, 0x2473, NUMERIC_OTHER}, {0x2474, 0x247c, NUMERIC_DIGIT},
+    {0x247d, 0x2487, NUMERIC_OTHER}, {0x2488, 0x2490, NUMERIC_DIGIT},
+    {0x2491, 0x249b, NUMERIC_OTHER}, {0x24ea, 0x24ea, NUMERIC_DIGIT},
+    {0x24eb, 0x24f4, NUMERIC_OTHER}, {0x24f5, 0x24fd, NUMERIC_DIGIT},
+    {0x24fe, 0x24fe, NUMERIC_OTHER}, {0x24ff, 0x24ff, NUMERIC_DIGIT},
+    {0x2776, 0x277e, NUMERIC_DIGIT}, {0x277f, 0x277f, NUMERIC_OTHER},
+    {0x2780, 0x2788, NUMERIC_DIGIT}, {0x2789, 0x2789, NUMERIC_OTHER},
+    {0x278a, 0x2792, NUMERIC_DIGIT}, {0x2793, 0x2793, NUMERIC_OTHER},
+    {0x2cfd, 0x2cfd, NUMERIC_OTHER}, {0x3007, 0x3007, NUMERIC_OTHER},
+    {0x3021, 0x3029, NUMERIC_OTHER}, {0x3038, 0x303a, NUMERIC_OTHER},
+    {0x3192, 0x3195, NUMERIC_OTHER}, {0x3220, 0x3229, NUMERIC_OTHER},
+    {0x3248, 0x324f, NUMERIC_OTHER}, {0x3251, 0x325f, NUMERIC_OTHER},
+    {0x3280, 0x3289, NUMERIC_OTHER}, {0x32b1, 0x32bf, NUMERIC_OTHER},
+    {0xa620, 0xa629, NUMERIC_DECIMAL}, {0xa6e6, 0xa6ef, NUMERIC_OTHER},
+    {0xa830, 0xa835, NUMERIC_OTHER}, {0xa8d0, 0xa8d9, NUMERIC_DECIMAL},
+    {0xa900, 0xa909, NUMERIC_DECIMAL}, {0xa9d0, 0xa9d9, NUMERIC_DECIMAL},
+    {0xa9f0, 0xa9f9, NUMERIC_DECIMAL}, {0xaa50, 0xaa59, NUMERIC_DECIMAL},
+    {0xabf0, 0xabf9, NUMERIC_DECIMAL}, {0xff10, 0xff19, NUMERIC_DECIMAL},
+    {0x10107, 0x10133, NUMERIC_OTHER}, {0x10140, 0x10178, NUMERIC_OTHER},
+    {0x1018a, 0x1018b, NUMERIC_OTHER}, {0x102e1, 0x102fb, NUMERIC_OTHER},
+    {0x10320, 0x10323, NUMERIC_OTHER}, {0x10341, 0x10341, NUMERIC_OTHER},
+    {0x1034a, 0x1034a, NUMERIC_OTHER}, {0x103d1, 0x103d5, NUMERIC_OTHER},
+    {0x104a0, 0x104a9, NUMERIC_DECIMAL}, {0x10858, 0x1085f, NUMERIC_OTHER},
+    {0x10879, 0x1087f, NUMERIC_OTHER}, {0x108a7, 0x108af, NUMERIC_OTHER},
+    {0x108fb, 0x108ff, NUMERIC_OTHER}, {0x10916, 0x1091b, NUMERIC_OTHER},
+    {0x109bc, 0x109bd, NUMERIC_OTHER}, {0x109c0, 0x109cf, NUMERIC_OTHER},
+    {0x109d2, 0x109ff, NUMERIC_OTHER}, {0x10a40, 0x10a43, NUMERIC_DIGIT},
+    {0x10a44, 0x10a48, NUMERIC_OTHER}, {0x10a7d, 0x10a7e, NUMERIC_OTHER},
+    {0x10a9d, 0x10a9f, NUMERIC_OTHER}, {0x10aeb, 0x10aef, NUMERIC_OTHER},
+    {0x10b58, 0x10b5f, NUMERIC_OTHER}, {0x10b78, 0x10b7f, NUMERIC_OTHER},
+    {0x10ba9, 0x10baf, NUMERIC_OTHER}, {0x10cfa, 0x10cff, NUMERIC_OTHER},
+    {0x10d30, 0x10d39, NUMERIC_DECIMAL}, {0x10e60, 0x10e68, NUMERIC_DIGIT},
+    {0x10e69, 0x10e7e, NUMERIC_OTHER}, {0x10f1d, 0x10f26, NUMERIC_OTHER},
+    {0x10f51, 0x10f54, NUMERIC_OTHER}, {0x10fc5, 0x10fcb, NUMERIC_OTHER},
+    {0x11052, 0x1105a, NUMERIC_DIGIT}, {0x1105b, 0x11065, NUMERIC_OTHER},
+    {0x11066, 0x1106f, NUMERIC_DECIMAL}, {0x110f0, 0x110f9, NUMERIC_DECIMAL},
+    {0x11136, 0x1113f, NUMERIC_DECIMAL}, {0x111d0, 0x111d9, NUMERIC_DECIMAL},
+    {0x111e1, 0x111f4, NUMERIC_OTHER}, {0x112f0, 0x112f9, NUMERIC_DECIMAL},
+    {0x11450, 0x11459, NUMERIC_DECIMAL}, {0x114d0, 0x114d9, NUMERIC_DECIMAL},
+    {0x11650, 0x11659, NUMERIC_DECIMAL}, {0x116c0, 0x116c9, NUMERIC_DECIMAL},
+    {0x11730, 0x11739, NUMERIC_DECIMAL}, {0x1173a, 0x1173b, NUMERIC_OTHER},
+    {0x118e0, 0x118e9, NUMERIC_DECIMAL}, {0x118ea, 0x118f2, NUMERIC_OTHER},
+    {0x11950, 0x11959, NUMERIC_DECIMAL}, {0x11c50, 0x11c59, NUMERIC_DECIMAL},
+    {0x11c5a, 0x11c6c, NUMERIC_OTHER}, {0x11d50, 0x11d59, NUMERIC_DECIMAL},
+    {0x11da0, 0x11da9, NUMERIC_DECIMAL}, {0x11fc0, 0x11fd4, NUMERIC_OTHER},
+    {0x12400, 0x1246e, NUMERIC_OTHER}, {0x16a60, 0x16a69, NUMERIC_DECIMAL},
+    {0x16ac0, 0x16ac9, NUMERIC_DECIMAL}, {0x16b50, 0x16b59, NUMERIC_DECIMAL},
+    {0x16b5b, 0x16b61, NUMERIC_OTHER}, {0x16e80, 0x16e96, NUMERIC_OTHER},
+    {0x1d2e0, 0x1d2f3, NUMERIC_OTHER}, {0x1d360, 0x1d378, NUMERIC_OTHER},
+    {0x1d7ce, 0x1d7ff, NUMERIC_DECIMAL}, {0x1e140, 0x1e149, NUMERIC_DECIMAL},
+    {0x1e2f0, 0x1e2f9, NUMERIC_DECIMAL}, {0x1e8c7, 0x1e8cf, NUMERIC_OTHER},
+    {0x1e950, 0x1e959, NUMERIC_DECIMAL}, {0x1ec71, 0x1ecab, NUMERIC_OTHER},
+    {0x1ecad, 0x1ecaf, NUMERIC_OTHER}, {0x1ecb1, 0x1ecb4, NUMERIC_OTHER},
+    {0x1ed01, 0x1ed2d, NUMERIC_OTHER}, {0x1ed2f, 0x1ed3d, NUMERIC_OTHER},
+    {0x1f100, 0x1f10a, NUMERIC_DIGIT}, {0x1f10b, 0x1f10c, NUMERIC_OTHER},
+    {0x1fbf0, 0x1fbf9, NUMERIC_DECIMAL},
+};
+
+// Letters with a numeric value, mostly CJK numerals such as U+4E09; all of
+// them are NUMERIC_OTHER
+static constexpr std::pair<char32_t, char32_t> NUMERIC_LETTERS[] = {
+    {0x3405, 0x3405}, {0x3483, 0x3483}, {0x382a, 0x382a}, {0x3b4d, 0x3b4d}, {0x4e00, 0x4e00},
+    {0x4e03, 0x4e03}, {0x4e07, 0x4e07}, {0x4e09, 0x4e09}, {0x4e5d, 0x4e5d}, {0x4e8c, 0x4e8c},
+    {0x4e94, 0x4e94}, {0x4e96, 0x4e96}, {0x4ebf, 0x4ec0}, {0x4edf, 0x4edf}, {0x4ee8, 0x4ee8},
+    {0x4f0d, 0x4f0d}, {0x4f70, 0x4f70}, {0x5104, 0x5104}, {0x5146, 0x5146}, {0x5169, 0x5169},
+    {0x516b, 0x516b}, {0x516d, 0x516d}, {0x5341, 0x5341}, {0x5343, 0x5345}, {0x534c, 0x534c},
+    {0x53c1, 0x53c4}, {0x56db, 0x56db}, {0x58f1, 0x58f1}, {0x58f9, 0x58f9}, {0x5e7a, 0x5e7a},
+    {0x5efe, 0x5eff}, {0x5f0c, 0x5f0e}, {0x5f10, 0x5f10}, {0x62fe, 0x62fe}, {0x634c, 0x634c},
+    {0x67d2, 0x67d2}, {0x6f06, 0x6f06}, {0x7396, 0x7396}, {0x767e, 0x767e}, {0x8086, 0x8086},
+    {0x842c, 0x842c}, {0x8cae, 0x8cae}, {0x8cb3, 0x8cb3}, {0x8d30, 0x8d30}, {0x9621, 0x9621},
+    {0x9646, 0x9646}, {0x964c, 0x964c}, {0x9678, 0x9678}, {0x96f6, 0x96f6}, {0xf96b, 0xf96b},
+    {0xf973, 0xf973}, {0xf978, 0xf978}, {0xf9b2, 0xf9b2}, {0xf9d1, 0xf9d1}, {0xf9d3, 0xf9d3},
+    {0xf9fd, 0xf9fd}, {0x20001, 0x20001}, {0x20064, 0x20064}, {0x200e2, 0x200e2},
+    {0x20121, 0x20121}, {0x2092a, 0x2092a}, {0x20983, 0x20983}, {0x2098c, 0x2098c},
+    {0x2099c, 0x2099c}, {0x20aea, 0x20aea}, {0x20afd, 0x20afd}, {0x20b19, 0x20b19},
+    {0x22390, 0x22390}, {0x22998, 0x22998}, {0x23b1b, 0x23b1b}, {0x2626d, 0x2626d},
+    {0x2f890, 0x2f890},
+};
+
+
+// Type of the code point if it is in NUMBERS
+static NumericType number_type(char32_t code_point) {
+    auto range = std::upper_bound(std::begin(NUMBERS), std::end(NUMBERS), code_point,
+                                  [](char32_t value, const NumericRange &range) { return value < range.first; });
+    return (range != std::begin(NUMBERS) && code_point <= range[-1].last) ? range[-1].type : NUMERIC_NONE;
+}
+
+static NumericType numeric_type(char32_t code_point) {
+    NumericType type = number_type(code_point);
+    if (type != NUMERIC_NONE) {
+        return type;
+    }
+    auto range = std::upper_bound(std::begin(NUMERIC_LETTERS), std::end(NUMERIC_LETTERS), code_point,
+                                  [](char32_t value, const auto &range) { return value < range.first; });
+    return (range != std::begin(NUMERIC_LETTERS) && code_point <= range[-1].second) ? NUMERIC_OTHER : NUMERIC_NONE;
+}
+
+// Titlecase letters such as U+01C5 have both an uppercase and a lowercase form
+static bool is_title(char32_t code_point, locale_t locale) {
+    return towupper_l(code_point, locale) != code_point && towlower_l(code_point, locale) != code_point;
+}
+
+static uint8_t classify_code_point(char32_t code_point) {
+    locale_t locale = utf8_locale();
+    if (!locale || code_point == 0) {
+        return OTHER;
+    }
+    if (is_title(code_point, locale)) {
+        return TITLE;
+    }
+    if (iswupper_l(code_point, locale)) {
+        return UPPER;
+    }
+    if (iswlower_l(code_point, locale)) {
+        return LOWER;
+    }
+    // The C library counts the digits of other scripts as letters
+    if (number_type(code_point) != NUMERIC_NONE) {
+        return DIGIT;
+    }
+    if (iswalpha_l(code_point, locale)) {
+        return LETTER;
+    }
+    // Python counts the no-break spaces and NEL as whitespace, the C library doesn't
+    if (iswspace_l(code_point, locale) || code_point == 0x85 || code_point == 0xa0 || code_point == 0x2007
+        || code_point == 0x202f) {
+        return SPACE;
+    }
+    return OTHER;
+}
+
+static char32_t map_code_point(char32_t code_point, Case mapping) {
+    locale_t locale = utf8_locale();
+    if (!locale || code_point == 0) {
+        return code_point;
+    }
+    switch (mapping) {
+    case Case::LOWER:
+        return towlower_l(code_point, locale);
+    case Case::UPPER:
+        return towupper_l(code_point, locale);
+    case Case::TITLE: {
+        static const wctrans_t to_title = wctrans_l("totitle", locale);
+        return to_title ? towctrans_l(code_point, to_title, locale) : towupper_l(code_point, locale);
+    }
+    default:
+        // Titlecase letters are neither upper nor lower and stay as they are
+        if (is_title(code_point, locale)) {
+            return code_point;
+        }
+        if (iswupper_l(code_point, locale)) {
+            return towlower_l(code_point, locale);
+        }
+        return towupper_l(code_point, locale);
+    }
+}
+
+// Length of the ASCII run at the start of input
+static size_t ascii_prefix(std::string_view input) {
+    size_t i = 0;
+    while (i < input.size() && static_cast<unsigned char>(input[i]) < 0x80) {
+        ++i;
+    }
+    return i;
+}
+
+uint8_t classify_utf8(std::string_view input) {
+    uint8_t result = 0;
+    size_t i = 0;
+    while (i < input.size()) {
+        size_t run = ascii_prefix(input.substr(i));
+        result |= classify_str(input.substr(i, run));
+        i += run;
+        if (i < input.size()) {
+            auto [code_point, length] = decode(input, i);
+            result |= classify_code_point(code_point);
+            i += length;
+        }
+    }
+    return result;
+}
+
+uint8_t numeric_types_utf8(std::string_view input) {
+    uint8_t result = 0;
+    size_t i = 0;
+    while (i < input.size()) {
+        size_t run = ascii_prefix(input.substr(i));
+        uint8_t classes = classify(input.substr(i, run));
+        result |= ((classes & DIGIT) ? NUMERIC_DECIMAL : 0) | ((classes & ~DIGIT) ? NUMERIC_NONE : 0);
+        i += run;
+        if (i < input.size()) {
+            auto [code_point, length] = decode(input, i);
+            result |= (code_point == 0) ? NUMERIC_NONE : numeric_type(code_point);
+            i += length;
+        }
+    }
+    return result;
+}
+
+std::string map_case_utf8(std::string_view input, Case mapping) {
+    std::string result;
+    result.reserve(input.size());
+    size_t i = 0;
+    while (i < input.size()) {
+        size_t run = ascii_prefix(input.substr(i));
+        size_t done = result.size();
+        result.resize(done + run);
+        map_case(input.substr(i, run), result.data() + done, mapping);
+        i += run;
+        if (i < input.size()) {
+            auto [code_point, length] = decode(input, i);
+            if (code_point == 0) {
+                result += input[i];
+            }
+            else {
+                encode(map_code_point(code_point, mapping), result);
+            }
+            i += length;
+        }
+    }
+    return result;
+}
+
+} // namespace TextKernels
+
+} // namespace MiniPython
@@ -0,0 +1,65 @@
+#pragma once
+
+#include <cstdint>
+#include <string>
+#include <string_view>
+
+namespace MiniPython {
+
+/**
+ * @brief Character classes and case mapping of str and bytes
+ *
+ * The byte kernels know ASCII only and leave other bytes alone, which is
+ * what bytes methods do. They use AVX2 when the CPU has it and SSE2
+ * otherwise, with a table for the tails.
+ *
+ * The UTF-8 variants are for str values that are not pure ASCII: they decode
+ * the text and ask the C library (C.UTF-8 locale) about each non-ASCII code
+ * point. Without that locale, non-ASCII characters count as OTHER and keep
+ * their case.
+ */
+namespace TextKernels {
+
+// Bits of classify(): the kinds of characters found in the input
+enum CharClass: uint8_t {
+    LOWER = 1,      // a-z and other lowercase letters
+    UPPER = 2,      // A-Z and other uppercase letters
+    DIGIT = 4,      // 0-9, and the other numbers (categories Nd, Nl and No) in classify_utf8()
+    SPACE = 8,      // space, \t, \n, \v, \f, \r and other whitespace, \x1c-\x1f in str
+    OTHER = 16,
+    NON_ASCII = 32, // bytes 0x80-0xff (classify() only)
+    LETTER = 64,    // letters without case (classify_utf8() only)
+    TITLE = LOWER | UPPER, // titlecase letters such as U+01C5 (classify_utf8() only)
+};
+
+// Bits of numeric_types_utf8(): the Unicode numeric types found in the input
+enum NumericType: uint8_t {
+    NUMERIC_NONE = 1,    // not a number
+    NUMERIC_DECIMAL = 2, // 0-9 and the other decimal digits (category Nd)
+    NUMERIC_DIGIT = 4,   // other digits such as superscripts and U+2460
+    NUMERIC_OTHER = 8,   // fractions, Roman and CJK numerals and so on
+};
+
+enum class Case {
+    LOWER,
+    UPPER,
+    SWAP,
+    TITLE,          // upper for ASCII, titlecase for other code points
+};
+
+// OR of the classes of all bytes
+uint8_t classify(std::string_view input);
+// Same for a pure-ASCII str, where \x1c-\x1f are whitespace too
+uint8_t classify_str(std::string_view input);
+// output has input.size() bytes and may be input.data()
+void map_case(std::string_view input, char *output, Case mapping);
+std::string map_case(std::string_view input, Case mapping);
+
+// Same as above, character by character
+uint8_t classify_utf8(std::string_view input);
+uint8_t numeric_types_utf8(std::string_view input);
+std::string map_case_utf8(std::string_view input, Case mapping);
+
+} // namespace TextKernels
+
+} // namespace MiniPython
@@ -45,6 +45,9 @@ static std::string tokenizeEscapedCharacter(std::string_view &sv) {
     std::string result;
     char ch2;
 
+    if (sv.empty()) {
+        throw std::runtime_error("trailing \\ in string");
+    }
     char ch = sv[0];
     sv.remove_prefix(1);
     switch(ch) {
@@ -396,6 +399,7 @@ static const std::vector<Token> PREDEFINED_TOKENS = {
     {TokenType::OPERATOR, "<"},
 
     {TokenType::OPERATOR, "is"},
+    {TokenType::OPERATOR, "in"},
 
     {TokenType::COLON, ":"},
     {TokenType::COMMA, ","},
@@ -407,6 +411,14 @@ static const std::vector<Token> PREDEFINED_TOKENS = {
     {TokenType::CLOSING_CURLY_BRACKET, "}"},
 };
 
+// Keywords such as `is` are only tokens on their own, not at the start of `isdigit`
+static bool continuesWord(std::string_view sv, std::string_view token) {
+    auto is_word_char = [](char ch) {
+        return (('a' <= ch) && (ch <= 'z')) || (('A' <= ch) && (ch <= 'Z')) || (('0' <= ch) && (ch <= '9')) || (ch == '_');
+    };
+    return is_word_char(token.back()) && (sv.size() > token.size()) && is_word_char(sv[token.size()]);
+}
+
 TokenList tokenizeLine(const std::string &line) {
     TokenList result;
 
@@ -427,7 +439,7 @@ TokenList tokenizeLine(const std::string &line) {
 
         // Check for predefined tokens (such as +, -=, << etc.)
         for (const auto &predefined_token: PREDEFINED_TOKENS) {
-            if (sv.starts_with(predefined_token.value)) {
+            if (sv.starts_with(predefined_token.value) && !continuesWord(sv, predefined_token.value)) {
                 result.push_back(predefined_token);
                 sv.remove_prefix(predefined_token.value.size());
                 goto outer_loop_end;
@@ -1,5 +1,7 @@
 #include "TokenToVariable.h"
 
+#include <charconv>
+#include <cstdlib>
 #include <stdexcept>
 
 namespace MiniPython {
@@ -12,18 +14,36 @@ Variable parseTokenToVariable(const Token &token) {
         return NEW_BYTES(token.value);
     case TokenType::NUMBER: {
         // TODO - better type detection
-        bool isFloat = (token.value.find('.') != std::string::npos)
-                    || (token.value.find('e') != std::string::npos)
-                    || (token.value.find('E') != std::string::npos);
-
         bool isOct = (token.value.find('o') != std::string::npos)
                   || (token.value.find('O') != std::string::npos);
 
         bool isHex = (token.value.find('x') != std::string::npos)
                   || (token.value.find('X') != std::string::npos);
 
+        // 'e' is also a hex digit
+        bool isFloat = !isHex
+                    && ((token.value.find('.') != std::string::npos)
+                    || (token.value.find('e') != std::string::npos)
+                    || (token.value.find('E') != std::string::npos));
+
         if (isFloat) {
-            return NEW_FLOAT(std::stod(token.value));
+            std::string digits;
+            for (char c: token.value) {
+                if (c != '_') {
+                    digits += c;
+                }
+            }
+
+            double value;
+            auto [end, error] = std::from_chars(digits.data(), digits.data() + digits.size(), value);
+            if (error == std::errc::result_out_of_range) {
+                // Python gives inf or 0.0, from_chars leaves the value unset
+                value = std::strtod(digits.c_str(), nullptr);
+            }
+            else if (error != std::errc() || end != digits.data() + digits.size()) {
+                throw std::runtime_error("Invalid float literal " + token.value);
+            }
+            return NEW_FLOAT(value);
         }
         else {
             int base = isOct ? 8 : isHex ? 16 : 10;
@@ -31,7 +51,7 @@ Variable parseTokenToVariable(const Token &token) {
             // remove 0x / 0o prefix if needed
             auto str_value = base == 10 ? token.value : token.value.substr(2);
 
-            return NEW_INT(std::stoull(str_value, nullptr, base));
+            return NEW_INT(BigInt::from_string(str_value, base));
         }
     }
     default:
@@ -1,16 +1,87 @@
 #include "Utils.h"
+#include "RaiseException.h"
 
 #include <algorithm>
+#include <cstring>
+#include <immintrin.h>
+#include <new>
 #include <stdexcept>
 
 namespace MiniPython {
 
+#define SSSE3 __attribute__((target("ssse3")))
+#define AVX2 __attribute__((target("avx2")))
+#define AVX512BW __attribute__((target("avx512f,avx512bw")))
+#define AVX512VBMI __attribute__((target("avx512f,avx512bw,avx512vbmi")))
+
+const CpuFeatures &cpu_features() {
+    static const CpuFeatures features = {
+        .ssse3 = static_cast<bool>(__builtin_cpu_supports("ssse3")),
+        .sse41 = static_cast<bool>(__builtin_cpu_supports("sse4.1")),
+        .pclmul = static_cast<bool>(__builtin_cpu_supports("pclmul")),
+        .sha = static_cast<bool>(__builtin_cpu_supports("sha")),
+        .avx2 = static_cast<bool>(__builtin_cpu_supports("avx2")),
+        .avx512f = static_cast<bool>(__builtin_cpu_supports("avx512f")),
+        .avx512bw = static_cast<bool>(__builtin_cpu_supports("avx512bw")),
+        .avx512vbmi = static_cast<bool>(__builtin_cpu_supports("avx512vbmi")),
+    };
+    return features;
+}
+
+size_t repeated_size(size_t size, int64_t count, size_t max_size) {
+    if (count <= 0 || size == 0) {
+        return 0;
+    }
+    if (static_cast<uint64_t>(count) > max_size / size) {
+        raise_exception("OverflowError", "repeated sequence is too long");
+        return 0;
+    }
+    return size * count;
+}
+
+std::string repeat(std::string_view input, int64_t count) {
+    size_t size = repeated_size(input.size(), count, std::string().max_size());
+    try {
+        return write_string(size, [input, size](char *output) {
+            if (size) {
+                std::memcpy(output, input.data(), input.size());
+            }
+            for (size_t done = input.size(); done < size; done *= 2) {
+                std::memcpy(output + done, output, std::min(done, size - done));
+            }
+        });
+    }
+    catch (const std::bad_alloc &) {
+        raise_exception("MemoryError", "");
+        return {};
+    }
+}
+
+bool ascii_only(std::string_view input) {
+    const char *data = input.data();
+    size_t size = input.size();
+    uint64_t bits = 0;
+    size_t i = 0;
+    // Eight bytes at a time, high bits collected and checked once
+    for (; i + 8 <= size; i += 8) {
+        uint64_t word;
+        std::memcpy(&word, data + i, 8);
+        bits |= word;
+    }
+    for (; i < size; ++i) {
+        bits |= static_cast<unsigned char>(data[i]);
+    }
+    return !(bits & 0x8080808080808080ull);
+}
+
+static const char HEX_DIGITS[] = "0123456789abcdef";
+
 char nibble_to_hex(int ch) {
-    return (ch <= 9) ? '0' + ch : 'a' + ch - 10;
+    return HEX_DIGITS[ch];
 }
 
 std::string byte_to_hex(unsigned char ch) {
-    return std::string() + nibble_to_hex(ch >> 4) + nibble_to_hex(ch % 16);
+    return {HEX_DIGITS[ch >> 4], HEX_DIGITS[ch & 0xf]};
 }
 
 int int_from_hex_char(char ch) {
@@ -26,58 +97,303 @@ int int_from_hex_char(char ch) {
     throw std::runtime_error("Not a hex character");
 }
 
-std::string str_from_hex_str(const std::string &hexstr) {
-    std::string str_without_spaces;
-    for (size_t i = 0; i < hexstr.size(); ++i) {
-        if ((hexstr[i] != ' ') && (hexstr[i] != '\t')) {
-            str_without_spaces += hexstr[i];
-        }
+/*
+ * Hex
+ *
+ * Encoding widens every byte to 16 bits holding its two nibbles, which pshufb
+ * then maps to digits in place, so the output comes out in order.
+ */
+
+static void hex_encode_scalar(const unsigned char *input, size_t size, char *output) {
+    for (size_t i = 0; i < size; ++i) {
+        output[2 * i] = HEX_DIGITS[input[i] >> 4];
+        output[2 * i + 1] = HEX_DIGITS[input[i] & 0xf];
     }
+}
 
-    if (str_without_spaces.size() % 2) {
-        throw std::runtime_error("Even number of chars expected");
+SSSE3 static __m128i nibbles_to_hex(__m128i widened) {
+    __m128i high = _mm_and_si128(_mm_srli_epi16(widened, 4), _mm_set1_epi16(0x0f));
+    __m128i low = _mm_slli_epi16(_mm_and_si128(widened, _mm_set1_epi16(0x0f)), 8);
+    return _mm_shuffle_epi8(_mm_loadu_si128(reinterpret_cast<const __m128i *>(HEX_DIGITS)), _mm_or_si128(high, low));
+}
+
+SSSE3 static void hex_encode_ssse3(const unsigned char *input, size_t size, char *output) {
+    size_t i = 0;
+    for (; i + 16 <= size; i += 16) {
+        __m128i bytes = _mm_loadu_si128(reinterpret_cast<const __m128i *>(input + i));
+        __m128i zero = _mm_setzero_si128();
+        _mm_storeu_si128(reinterpret_cast<__m128i *>(output + 2 * i), nibbles_to_hex(_mm_unpacklo_epi8(bytes, zero)));
+        _mm_storeu_si128(reinterpret_cast<__m128i *>(output + 2 * i + 16), nibbles_to_hex(_mm_unpackhi_epi8(bytes, zero)));
+    }
+    hex_encode_scalar(input + i, size - i, output + 2 * i);
+}
+
+AVX2 static void hex_encode_avx2(const unsigned char *input, size_t size, char *output) {
+    __m256i digits = _mm256_broadcastsi128_si256(_mm_loadu_si128(reinterpret_cast<const __m128i *>(HEX_DIGITS)));
+    size_t i = 0;
+    for (; i + 16 <= size; i += 16) {
+        __m256i widened = _mm256_cvtepu8_epi16(_mm_loadu_si128(reinterpret_cast<const __m128i *>(input + i)));
+        __m256i high = _mm256_and_si256(_mm256_srli_epi16(widened, 4), _mm256_set1_epi16(0x0f));
+        __m256i low = _mm256_slli_epi16(_mm256_and_si256(widened, _mm256_set1_epi16(0x0f)), 8);
+        _mm256_storeu_si256(reinterpret_cast<__m256i *>(output + 2 * i), _mm256_shuffle_epi8(digits, _mm256_or_si256(high, low)));
+    }
+    hex_encode_scalar(input + i, size - i, output + 2 * i);
+}
+
+AVX512BW static void hex_encode_avx512(const unsigned char *input, size_t size, char *output) {
+    __m512i digits = _mm512_broadcast_i32x4(_mm_loadu_si128(reinterpret_cast<const __m128i *>(HEX_DIGITS)));
+    size_t i = 0;
+    for (; i + 32 <= size; i += 32) {
+        __m512i widened = _mm512_cvtepu8_epi16(_mm256_loadu_si256(reinterpret_cast<const __m256i *>(input + i)));
+        __m512i high = _mm512_and_si512(_mm512_srli_epi16(widened, 4), _mm512_set1_epi16(0x0f));
+        __m512i low = _mm512_slli_epi16(_mm512_and_si512(widened, _mm512_set1_epi16(0x0f)), 8);
+        _mm512_storeu_si512(output + 2 * i, _mm512_shuffle_epi8(digits, _mm512_or_si512(high, low)));
     }
+    hex_encode_scalar(input + i, size - i, output + 2 * i);
+}
 
-    std::string result;
-    for (size_t i = 0 ; i < str_without_spaces.size(); i += 2) {
-        char ch1 = str_without_spaces[i];
-        char ch2 = str_without_spaces[i+1];
-        result += (16 * int_from_hex_char(ch1) + int_from_hex_char(ch2));
+void hex_encode(std::string_view input, char *output) {
+    auto bytes = reinterpret_cast<const unsigned char *>(input.data());
+    auto &cpu = cpu_features();
+    if (cpu.avx512bw) {
+        hex_encode_avx512(bytes, input.size(), output);
+    }
+    else if (cpu.avx2) {
+        hex_encode_avx2(bytes, input.size(), output);
+    }
+    else if (cpu.ssse3) {
+        hex_encode_ssse3(bytes, input.size(), output);
     }
+    else {
+        hex_encode_scalar(bytes, input.size(), output);
+    }
+}
 
+std::string hex_encode(std::string_view input) {
+    std::string result(2 * input.size(), '\0');
+    hex_encode(input, result.data());
     return result;
 }
 
-static const char* BASE64_ALPHABET = "ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz0123456789+/";
+/*
+ * Decoding folds letters to lowercase, maps digits and letters to their values
+ * and merges each pair of nibbles with pmaddubsw. Blocks with anything but hex
+ * digits are left to the scalar code, which reports the error.
+ */
+
+static void hex_decode_scalar(const char *input, size_t size, char *output) {
+    for (size_t i = 0; i < size; ++i) {
+        output[i] = 16 * int_from_hex_char(input[2 * i]) + int_from_hex_char(input[2 * i + 1]);
+    }
+}
 
-std::string base64_encode(const std::string &input) {
-    std::string result;
+// Returns false if the block has a character that is not a hex digit
+SSSE3 static bool hex_values_ssse3(__m128i chars, __m128i &values) {
+    // Folding to lowercase would also turn 0x10-0x19 into digits
+    __m128i digit = _mm_sub_epi8(chars, _mm_set1_epi8('0'));
+    __m128i lower = _mm_or_si128(chars, _mm_set1_epi8(0x20));
+    __m128i letter = _mm_sub_epi8(lower, _mm_set1_epi8('a'));
+    __m128i is_digit = _mm_cmpeq_epi8(_mm_min_epu8(digit, _mm_set1_epi8(9)), digit);
+    __m128i is_letter = _mm_cmpeq_epi8(_mm_min_epu8(letter, _mm_set1_epi8(5)), letter);
+    values = _mm_or_si128(_mm_and_si128(is_digit, digit),
+                          _mm_and_si128(is_letter, _mm_add_epi8(letter, _mm_set1_epi8(10))));
+    return _mm_movemask_epi8(_mm_or_si128(is_digit, is_letter)) == 0xffff;
+}
 
-    unsigned char prev_value;
-    for (size_t i = 0; i < input.size(); ++i) {
-        if (i % 3 == 0) {
-            result += BASE64_ALPHABET[input[i] >> 2];
-            prev_value = input[i] & 0b00000011;
+SSSE3 static void hex_decode_ssse3(const char *input, size_t size, char *output) {
+    size_t i = 0;
+    for (; i + 16 <= size; i += 16) {
+        __m128i first, second;
+        if (!hex_values_ssse3(_mm_loadu_si128(reinterpret_cast<const __m128i *>(input + 2 * i)), first)
+            || !hex_values_ssse3(_mm_loadu_si128(reinterpret_cast<const __m128i *>(input + 2 * i + 16)), second)) {
+            break;
         }
-        else if (i % 3 == 1) {
-            result += BASE64_ALPHABET[(input[i] >> 4) | (prev_value << 4)];
-            prev_value = input[i] & 0b00001111;
+        __m128i weights = _mm_set1_epi16(0x0110);
+        __m128i bytes = _mm_packus_epi16(_mm_maddubs_epi16(first, weights), _mm_maddubs_epi16(second, weights));
+        _mm_storeu_si128(reinterpret_cast<__m128i *>(output + i), bytes);
+    }
+    hex_decode_scalar(input + 2 * i, size - i, output + i);
+}
+
+AVX2 static bool hex_values_avx2(__m256i chars, __m256i &values) {
+    __m256i digit = _mm256_sub_epi8(chars, _mm256_set1_epi8('0'));
+    __m256i lower = _mm256_or_si256(chars, _mm256_set1_epi8(0x20));
+    __m256i letter = _mm256_sub_epi8(lower, _mm256_set1_epi8('a'));
+    __m256i is_digit = _mm256_cmpeq_epi8(_mm256_min_epu8(digit, _mm256_set1_epi8(9)), digit);
+    __m256i is_letter = _mm256_cmpeq_epi8(_mm256_min_epu8(letter, _mm256_set1_epi8(5)), letter);
+    values = _mm256_or_si256(_mm256_and_si256(is_digit, digit),
+                             _mm256_and_si256(is_letter, _mm256_add_epi8(letter, _mm256_set1_epi8(10))));
+    return _mm256_movemask_epi8(_mm256_or_si256(is_digit, is_letter)) == -1;
+}
+
+AVX2 static void hex_decode_avx2(const char *input, size_t size, char *output) {
+    size_t i = 0;
+    for (; i + 32 <= size; i += 32) {
+        __m256i first, second;
+        if (!hex_values_avx2(_mm256_loadu_si256(reinterpret_cast<const __m256i *>(input + 2 * i)), first)
+            || !hex_values_avx2(_mm256_loadu_si256(reinterpret_cast<const __m256i *>(input + 2 * i + 32)), second)) {
+            break;
         }
-        else {
-            result += BASE64_ALPHABET[(input[i] >> 6) | (prev_value << 2)];
-            result += BASE64_ALPHABET[input[i] & 0b00111111];
+        __m256i weights = _mm256_set1_epi16(0x0110);
+        __m256i bytes = _mm256_packus_epi16(_mm256_maddubs_epi16(first, weights), _mm256_maddubs_epi16(second, weights));
+        // packus works within 128-bit lanes
+        bytes = _mm256_permute4x64_epi64(bytes, _MM_SHUFFLE(3, 1, 2, 0));
+        _mm256_storeu_si256(reinterpret_cast<__m256i *>(output + i), bytes);
+    }
+    hex_decode_scalar(input + 2 * i, size - i, output + i);
+}
+
+static void hex_decode(std::string_view input, char *output) {
+    if (input.size() % 2) {
+        throw std::runtime_error("Even number of chars expected");
+    }
+    auto &cpu = cpu_features();
+    if (cpu.avx2) {
+        hex_decode_avx2(input.data(), input.size() / 2, output);
+    }
+    else if (cpu.ssse3) {
+        hex_decode_ssse3(input.data(), input.size() / 2, output);
+    }
+    else {
+        hex_decode_scalar(input.data(), input.size() / 2, output);
+    }
+}
+
+std::string str_from_hex_str(std::string_view hexstr) {
+    std::string str_without_spaces;
+    if (hexstr.find_first_of(" \t") != std::string_view::npos) {
+        str_without_spaces.reserve(hexstr.size());
+        for (char ch: hexstr) {
+            if ((ch != ' ') && (ch != '\t')) {
+                str_without_spaces += ch;
+            }
         }
+        hexstr = str_without_spaces;
+    }
+
+    std::string result(hexstr.size() / 2, '\0');
+    hex_decode(hexstr, result.data());
+    return result;
+}
+
+/*
+ * Base64
+ *
+ * The vector code follows Muła and Lemire, "Faster Base64 Encoding and Decoding
+ * Using AVX2 Instructions": 3-byte groups are spread to four 6-bit indices with
+ * multiplies (or vpmultishiftqb), which are turned into characters by adding an
+ * offset looked up with pshufb.
+ */
+
+static const char* BASE64_ALPHABET = "ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz0123456789+/";
+
+static void base64_encode_scalar(const unsigned char *input, size_t size, char *output) {
+    size_t i = 0;
+    for (; i + 3 <= size; i += 3) {
+        uint32_t group = (input[i] << 16) | (input[i + 1] << 8) | input[i + 2];
+        *output++ = BASE64_ALPHABET[group >> 18];
+        *output++ = BASE64_ALPHABET[(group >> 12) & 0x3f];
+        *output++ = BASE64_ALPHABET[(group >> 6) & 0x3f];
+        *output++ = BASE64_ALPHABET[group & 0x3f];
+    }
+
+    if (size - i == 1) {
+        *output++ = BASE64_ALPHABET[input[i] >> 2];
+        *output++ = BASE64_ALPHABET[(input[i] & 0x03) << 4];
+        *output++ = '=';
+        *output++ = '=';
+    }
+    else if (size - i == 2) {
+        *output++ = BASE64_ALPHABET[input[i] >> 2];
+        *output++ = BASE64_ALPHABET[((input[i] & 0x03) << 4) | (input[i + 1] >> 4)];
+        *output++ = BASE64_ALPHABET[(input[i + 1] & 0x0f) << 2];
+        *output++ = '=';
+    }
+}
+
+// 12 bytes in the low part of each 128-bit lane -> 16 indices
+#define BASE64_ENCODE_SHUFFLE 10, 11, 9, 10, 7, 8, 6, 7, 4, 5, 3, 4, 1, 2, 0, 1
+// Offset from index to character, selected by the index class
+#define BASE64_ENCODE_OFFSETS 'a' - 26, '0' - 52, '0' - 52, '0' - 52, '0' - 52, '0' - 52, '0' - 52, '0' - 52, \
+                              '0' - 52, '0' - 52, '0' - 52, '+' - 62, '/' - 63, 'A', 0, 0
+
+SSSE3 static __m128i base64_encode_block_ssse3(__m128i input) {
+    input = _mm_shuffle_epi8(input, _mm_set_epi8(BASE64_ENCODE_SHUFFLE));
+    __m128i high = _mm_mulhi_epu16(_mm_and_si128(input, _mm_set1_epi32(0x0fc0fc00)), _mm_set1_epi32(0x04000040));
+    __m128i low = _mm_mullo_epi16(_mm_and_si128(input, _mm_set1_epi32(0x003f03f0)), _mm_set1_epi32(0x01000010));
+    __m128i indices = _mm_or_si128(high, low);
+
+    __m128i classes = _mm_subs_epu8(indices, _mm_set1_epi8(51));
+    __m128i upper = _mm_cmpgt_epi8(_mm_set1_epi8(26), indices);
+    classes = _mm_or_si128(classes, _mm_and_si128(upper, _mm_set1_epi8(13)));
+    __m128i offsets = _mm_shuffle_epi8(_mm_setr_epi8(BASE64_ENCODE_OFFSETS), classes);
+    return _mm_add_epi8(indices, offsets);
+}
+
+SSSE3 static void base64_encode_ssse3(const unsigned char *input, size_t size, char *output) {
+    size_t i = 0;
+    // 16 bytes are loaded but only 12 are used
+    for (; i + 16 <= size; i += 12, output += 16) {
+        __m128i block = _mm_loadu_si128(reinterpret_cast<const __m128i *>(input + i));
+        _mm_storeu_si128(reinterpret_cast<__m128i *>(output), base64_encode_block_ssse3(block));
     }
+    base64_encode_scalar(input + i, size - i, output);
+}
 
-    if (input.size() % 3 == 1) {
-        result += BASE64_ALPHABET[prev_value << 4];
-        result += "==";
+AVX2 static void base64_encode_avx2(const unsigned char *input, size_t size, char *output) {
+    size_t i = 0;
+    for (; i + 28 <= size; i += 24, output += 32) {
+        __m256i block = _mm256_inserti128_si256(
+            _mm256_castsi128_si256(_mm_loadu_si128(reinterpret_cast<const __m128i *>(input + i))),
+            _mm_loadu_si128(reinterpret_cast<const __m128i *>(input + i + 12)), 1);
+        block = _mm256_shuffle_epi8(block, _mm256_set_epi8(BASE64_ENCODE_SHUFFLE, BASE64_ENCODE_SHUFFLE));
+        __m256i high = _mm256_mulhi_epu16(_mm256_and_si256(block, _mm256_set1_epi32(0x0fc0fc00)), _mm256_set1_epi32(0x04000040));
+        __m256i low = _mm256_mullo_epi16(_mm256_and_si256(block, _mm256_set1_epi32(0x003f03f0)), _mm256_set1_epi32(0x01000010));
+        __m256i indices = _mm256_or_si256(high, low);
+
+        __m256i classes = _mm256_subs_epu8(indices, _mm256_set1_epi8(51));
+        __m256i upper = _mm256_cmpgt_epi8(_mm256_set1_epi8(26), indices);
+        classes = _mm256_or_si256(classes, _mm256_and_si256(upper, _mm256_set1_epi8(13)));
+        __m256i offsets = _mm256_shuffle_epi8(_mm256_setr_epi8(BASE64_ENCODE_OFFSETS, BASE64_ENCODE_OFFSETS), classes);
+        _mm256_storeu_si256(reinterpret_cast<__m256i *>(output), _mm256_add_epi8(indices, offsets));
     }
-    else if (input.size() % 3 == 2) {
-        result += BASE64_ALPHABET[prev_value << 2];
-        result += "=";
+    base64_encode_scalar(input + i, size - i, output);
+}
+
+AVX512VBMI static void base64_encode_avx512(const unsigned char *input, size_t size, char *output) {
+    // Every 3 bytes become the 4 bytes b, a, c, b of a 32-bit word
+    const __m512i spread = _mm512_setr_epi32(
+        0x01020001, 0x04050304, 0x07080607, 0x0a0b090a, 0x0d0e0c0d, 0x10110f10, 0x13141213, 0x16171516,
+        0x191a1819, 0x1c1d1b1c, 0x1f201e1f, 0x22232122, 0x25262425, 0x28292728, 0x2b2c2a2b, 0x2e2f2d2e);
+    // Bit offsets of the four 6-bit fields in each 32-bit half
+    const __m512i shifts = _mm512_set1_epi64(0x3036242a1016040a);
+    const __m512i alphabet = _mm512_loadu_si512(BASE64_ALPHABET);
+
+    size_t i = 0;
+    for (; i + 64 <= size; i += 48, output += 64) {
+        __m512i block = _mm512_permutexvar_epi8(spread, _mm512_loadu_si512(input + i));
+        __m512i indices = _mm512_multishift_epi64_epi8(shifts, block);
+        _mm512_storeu_si512(output, _mm512_permutexvar_epi8(indices, alphabet));
     }
+    base64_encode_scalar(input + i, size - i, output);
+}
 
+std::string base64_encode(std::string_view input) {
+    std::string result((input.size() + 2) / 3 * 4, '\0');
+    auto bytes = reinterpret_cast<const unsigned char *>(input.data());
+    auto &cpu = cpu_features();
+    if (cpu.avx512vbmi) {
+        base64_encode_avx512(bytes, input.size(), result.data());
+    }
+    else if (cpu.avx2) {
+        base64_encode_avx2(bytes, input.size(), result.data());
+    }
+    else if (cpu.ssse3) {
+        base64_encode_ssse3(bytes, input.size(), result.data());
+    }
+    else {
+        base64_encode_scalar(bytes, input.size(), result.data());
+    }
     return result;
 }
 
@@ -100,44 +416,204 @@ static unsigned char base64_decode_char(unsigned char ch) {
     throw std::runtime_error(std::string("Unexpected argument of base64_decode_char: '") + ((char)ch) + "'");
 }
 
-std::string base64_decode(std::string input) {
+// Decodes characters without padding, returns the end of the output
+static char *base64_decode_scalar(const char *input, size_t size, char *output) {
+    size_t i = 0;
+    for (; i + 4 <= size; i += 4) {
+        uint32_t group = (base64_decode_char(input[i]) << 18) | (base64_decode_char(input[i + 1]) << 12)
+                       | (base64_decode_char(input[i + 2]) << 6) | base64_decode_char(input[i + 3]);
+        *output++ = group >> 16;
+        *output++ = group >> 8;
+        *output++ = group;
+    }
+
+    // 2 or 3 characters left: 1 or 2 bytes, a single one carries no full byte
+    if (size - i >= 2) {
+        *output++ = (base64_decode_char(input[i]) << 2) | (base64_decode_char(input[i + 1]) >> 4);
+    }
+    if (size - i == 3) {
+        *output++ = (base64_decode_char(input[i + 1]) << 4) | (base64_decode_char(input[i + 2]) >> 2);
+    }
+    return output;
+}
+
+// Nibble classes for validation and the offset from character to value
+#define BASE64_DECODE_LOW_NIBBLES 0x15, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, \
+                                  0x11, 0x11, 0x13, 0x1a, 0x1b, 0x1b, 0x1b, 0x1a
+#define BASE64_DECODE_HIGH_NIBBLES 0x10, 0x10, 0x01, 0x02, 0x04, 0x08, 0x04, 0x08, \
+                                   0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10
+#define BASE64_DECODE_OFFSETS 0, 16, 19, 4, -65, -65, -71, -71, 0, 0, 0, 0, 0, 0, 0, 0
+// 3 bytes out of each 32-bit word, the last 4 bytes of the lane are unused
+#define BASE64_DECODE_PACK 2, 1, 0, 6, 5, 4, 10, 9, 8, 14, 13, 12, -1, -1, -1, -1
+
+SSSE3 static char *base64_decode_ssse3(const char *input, size_t size, char *output) {
+    size_t i = 0;
+    for (; i + 16 <= size; i += 16, output += 12) {
+        __m128i chars = _mm_loadu_si128(reinterpret_cast<const __m128i *>(input + i));
+        __m128i high_nibbles = _mm_and_si128(_mm_srli_epi32(chars, 4), _mm_set1_epi8(0x2f));
+        __m128i low_nibbles = _mm_and_si128(chars, _mm_set1_epi8(0x2f));
+        __m128i low = _mm_shuffle_epi8(_mm_setr_epi8(BASE64_DECODE_LOW_NIBBLES), low_nibbles);
+        __m128i high = _mm_shuffle_epi8(_mm_setr_epi8(BASE64_DECODE_HIGH_NIBBLES), high_nibbles);
+        if (_mm_movemask_epi8(_mm_cmpeq_epi8(_mm_and_si128(low, high), _mm_setzero_si128())) != 0xffff) {
+            break;
+        }
+        __m128i is_slash = _mm_cmpeq_epi8(chars, _mm_set1_epi8('/'));
+        __m128i offsets = _mm_shuffle_epi8(_mm_setr_epi8(BASE64_DECODE_OFFSETS), _mm_add_epi8(is_slash, high_nibbles));
+        __m128i values = _mm_add_epi8(chars, offsets);
+
+        __m128i pairs = _mm_maddubs_epi16(values, _mm_set1_epi32(0x01400140));
+        __m128i words = _mm_madd_epi16(pairs, _mm_set1_epi32(0x00011000));
+        // 16 bytes are stored, the caller leaves room for the 4 extra ones
+        _mm_storeu_si128(reinterpret_cast<__m128i *>(output), _mm_shuffle_epi8(words, _mm_setr_epi8(BASE64_DECODE_PACK)));
+    }
+    return base64_decode_scalar(input + i, size - i, output);
+}
+
+AVX2 static char *base64_decode_avx2(const char *input, size_t size, char *output) {
+    size_t i = 0;
+    for (; i + 32 <= size; i += 32, output += 24) {
+        __m256i chars = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(input + i));
+        __m256i high_nibbles = _mm256_and_si256(_mm256_srli_epi32(chars, 4), _mm256_set1_epi8(0x2f));
+        __m256i low_nibbles = _mm256_and_si256(chars, _mm256_set1_epi8(0x2f));
+        __m256i low = _mm256_shuffle_epi8(_mm256_setr_epi8(BASE64_DECODE_LOW_NIBBLES, BASE64_DECODE_LOW_NIBBLES), low_nibbles);
+        __m256i high = _mm256_shuffle_epi8(_mm256_setr_epi8(BASE64_DECODE_HIGH_NIBBLES, BASE64_DECODE_HIGH_NIBBLES), high_nibbles);
+        if (!_mm256_testz_si256(low, high)) {
+            break;
+        }
+        __m256i is_slash = _mm256_cmpeq_epi8(chars, _mm256_set1_epi8('/'));
+        __m256i offsets = _mm256_shuffle_epi8(_mm256_setr_epi8(BASE64_DECODE_OFFSETS, BASE64_DECODE_OFFSETS),
+                                              _mm256_add_epi8(is_slash, high_nibbles));
+        __m256i values = _mm256_add_epi8(chars, offsets);
+
+        __m256i pairs = _mm256_maddubs_epi16(values, _mm256_set1_epi32(0x01400140));
+        __m256i words = _mm256_madd_epi16(pairs, _mm256_set1_epi32(0x00011000));
+        words = _mm256_shuffle_epi8(words, _mm256_setr_epi8(BASE64_DECODE_PACK, BASE64_DECODE_PACK));
+        // 32 bytes are stored, the caller leaves room for the 8 extra ones
+        words = _mm256_permutevar8x32_epi32(words, _mm256_setr_epi32(0, 1, 2, 4, 5, 6, 3, 7));
+        _mm256_storeu_si256(reinterpret_cast<__m256i *>(output), words);
+    }
+    return base64_decode_ssse3(input + i, size - i, output);
+}
+
+std::string base64_decode(std::string_view input) {
     // binascii.a2b_base64() in non-strict mode ignores leading padding
     // base64.decodebytes() does the same
-    while(input.size() && (input[0] == '=')) {
-        input = input.substr(1);
-    }
+    size_t first_char_pos = input.find_first_not_of('=');
+    input.remove_prefix(std::min(first_char_pos, input.size()));
 
     // binascii.a2b_base64 ignores data after padding
-    // So remove everything after padding started
-    size_t first_equal_sign_pos = input.find('=');
-    if (first_equal_sign_pos != std::string::npos) {
-        input = input.substr(0, first_equal_sign_pos);
+    input = input.substr(0, input.find('='));
+
+    if (input.size() % 4 == 1) {
+        throw std::runtime_error("binascii.Error: Invalid base64-encoded string: number of data characters ("
+                                 + std::to_string(input.size()) + ") cannot be 1 more than a multiple of 4");
     }
 
-    // And since we removed the padding, add it back
-    while (input.size() % 4) {
-        input += '=';
+    // Room for the full vector stores past the end
+    std::string result(input.size() / 4 * 3 + 3 + 32, '\0');
+    char *end;
+    auto &cpu = cpu_features();
+    if (cpu.avx2) {
+        end = base64_decode_avx2(input.data(), input.size(), result.data());
+    }
+    else if (cpu.ssse3) {
+        end = base64_decode_ssse3(input.data(), input.size(), result.data());
+    }
+    else {
+        end = base64_decode_scalar(input.data(), input.size(), result.data());
     }
+    result.resize(end - result.data());
+    return result;
+}
 
-    std::string result;
+/*
+ * Incremental codecs
+ */
 
-    for (size_t i = 0; i < input.size(); i += 4) {
-        result += ((base64_decode_char(input[i]) << 2) | (base64_decode_char(input[i + 1]) >> 4));
+Base64Encoder::Base64Encoder(size_t _line_length)
+    : line_length(_line_length)
+    , column(0)
+    {}
 
-        if (input[i + 2] == '=') {
-            break;
+void Base64Encoder::append_wrapped(std::string &output, std::string_view encoded) {
+    if (!line_length) {
+        output += encoded;
+        return;
+    }
+    while (!encoded.empty()) {
+        size_t count = std::min(encoded.size(), line_length - column);
+        output += encoded.substr(0, count);
+        encoded.remove_prefix(count);
+        column += count;
+        if (column == line_length) {
+            output += '\n';
+            column = 0;
         }
+    }
+}
+
+std::string Base64Encoder::update(std::string_view chunk) {
+    std::string output;
+    if (!pending.empty()) {
+        size_t count = std::min(chunk.size(), 3 - pending.size());
+        pending += chunk.substr(0, count);
+        chunk.remove_prefix(count);
+        if (pending.size() < 3) {
+            return output;
+        }
+        append_wrapped(output, base64_encode(pending));
+        pending.clear();
+    }
+    // Whole 3-byte groups encode without padding
+    size_t whole = chunk.size() / 3 * 3;
+    append_wrapped(output, base64_encode(chunk.substr(0, whole)));
+    pending = chunk.substr(whole);
+    return output;
+}
+
+std::string Base64Encoder::finish() {
+    std::string output;
+    append_wrapped(output, base64_encode(pending));
+    pending.clear();
+    if (line_length && column) {
+        output += '\n';
+        column = 0;
+    }
+    return output;
+}
 
-        result += (base64_decode_char(input[i + 1]) << 4) | (base64_decode_char(input[i + 2]) >> 2);
+static bool is_base64_char(char ch) {
+    return ('A' <= ch && ch <= 'Z') || ('a' <= ch && ch <= 'z') || ('0' <= ch && ch <= '9') || ch == '+' || ch == '/';
+}
 
-        if (input[i + 3] == '=') {
+std::string Base64Decoder::update(std::string_view chunk) {
+    for (char ch: chunk) {
+        if (padded) {
             break;
         }
-
-        result += (base64_decode_char(input[i + 2]) << 6) | (base64_decode_char(input[i + 3]));
+        if (is_base64_char(ch)) {
+            pending += ch;
+            ++data_chars;
+        }
+        else if (ch == '=' && data_chars) {
+            // Leading padding is skipped, any other padding ends the data
+            padded = true;
+        }
     }
+    size_t whole = pending.size() / 4 * 4;
+    std::string output = base64_decode(std::string_view(pending).substr(0, whole));
+    pending.erase(0, whole);
+    return output;
+}
 
-    return result;
+std::string Base64Decoder::finish() {
+    if (pending.size() == 1) {
+        throw std::runtime_error("binascii.Error: Invalid base64-encoded string: number of data characters ("
+                                 + std::to_string(data_chars) + ") cannot be 1 more than a multiple of 4");
+    }
+    std::string output = base64_decode(pending);
+    pending.clear();
+    return output;
 }
 
 } // namespace MiniPython
@@ -1,16 +1,98 @@
 #pragma once
 
+#include <cstdint>
 #include <string>
+#include <string_view>
 
 namespace MiniPython {
 
+/**
+ * @brief Instruction set extensions of the CPU, detected once
+ */
+struct CpuFeatures {
+    bool ssse3;
+    bool sse41;
+    bool pclmul;
+    bool sha;
+    bool avx2;
+    bool avx512f;
+    bool avx512bw;
+    bool avx512vbmi;
+};
+
+const CpuFeatures &cpu_features();
+
+// Items in count copies of a sequence of size items: 0 for count <= 0,
+// OverflowError when that is more than max_size
+size_t repeated_size(size_t size, int64_t count, size_t max_size);
+// input repeated count times; the copied part is doubled, so memcpy runs
+// log2(count) times. MemoryError when the result can't be allocated.
+std::string repeat(std::string_view input, int64_t count);
+
+// A string of size characters filled by write(char *output), without zeroing
+// them first. Some standard libraries give the resize_and_overwrite() callback
+// the capacity instead of the requested size, so write() gets only the pointer
+// and must fill exactly size characters.
+template <typename Writer>
+std::string write_string(size_t size, Writer write) {
+    std::string result;
+    result.resize_and_overwrite(size, [size, &write](char *output, size_t) {
+        write(output);
+        return size;
+    });
+    return result;
+}
+
+// No byte has the high bit set
+bool ascii_only(std::string_view input);
+
 char nibble_to_hex(int ch);
 std::string byte_to_hex(unsigned char ch);
 
+// Writes 2 * input.size() lowercase hex digits to output
+void hex_encode(std::string_view input, char *output);
+std::string hex_encode(std::string_view input);
+
 int int_from_hex_char(char ch);
-std::string str_from_hex_str(const std::string &hexstr);
+// Spaces and tabs between the digits are ignored
+std::string str_from_hex_str(std::string_view hexstr);
+
+std::string base64_encode(std::string_view input);
+std::string base64_decode(std::string_view input);
+
+/*
+ * Incremental codecs: input arrives in chunks of any size and the partial
+ * quantum is carried to the next update(), so the output of all updates plus
+ * finish() equals the one-shot encoding of the concatenated input.
+ */
+
+class Base64Encoder {
+public:
+    // With a line length, a newline follows every line_length output characters
+    // and ends the output, as in base64.encodebytes()
+    explicit Base64Encoder(size_t line_length = 0);
+
+    std::string update(std::string_view chunk);
+    std::string finish();
+
+private:
+    void append_wrapped(std::string &output, std::string_view encoded);
+
+    size_t line_length;
+    size_t column;
+    std::string pending;
+};
+
+// Characters outside the alphabet are skipped and data after padding is ignored
+class Base64Decoder {
+public:
+    std::string update(std::string_view chunk);
+    std::string finish();
 
-std::string base64_encode(const std::string &input);
-std::string base64_decode(std::string input);
+private:
+    std::string pending;
+    size_t data_chars = 0;
+    bool padded = false;
+};
 
 } // namespace MiniPython
@@ -0,0 +1,111 @@
+#include "variable/Variable.h"
+#include "src/Scope.h"
+
+#include <gtest/gtest.h>
+
+using namespace MiniPython;
+
+class ArrayVariableTest: public testing::Test {
+protected:
+    static std::shared_ptr<ArrayVariable> make_array(const std::string &typecode, const ListType &items = {}) {
+        return std::make_shared<ArrayVariable>(NEW_STRING(typecode), items);
+    }
+};
+
+TEST_F(ArrayVariableTest, packed_storage) {
+    auto array = make_array("d", {NEW_FLOAT(1.5), NEW_INT(2), TRUE});
+    EXPECT_EQ(array->size(), 3);
+    EXPECT_EQ(array->buffer().size(), 3 * sizeof(double));
+    EXPECT_EQ(array->items<double>()[0], 1.5);
+    EXPECT_EQ(array->items<double>()[1], 2.0);
+    EXPECT_EQ(array->items<double>()[2], 1.0);
+    EXPECT_EQ(array->to_str(), "array('d', [1.5, 2.0, 1.0])");
+}
+
+TEST_F(ArrayVariableTest, itemsize) {
+    std::vector<std::pair<std::string, size_t>> sizes = {
+        {"b", 1}, {"B", 1}, {"u", 4}, {"h", 2}, {"H", 2}, {"i", 4}, {"I", 4},
+        {"l", 8}, {"L", 8}, {"q", 8}, {"Q", 8}, {"f", 4}, {"d", 8},
+    };
+    for (auto &[typecode, size]: sizes) {
+        auto array = make_array(typecode);
+        EXPECT_EQ(array->itemsize(), size);
+        EXPECT_EQ(VAR_TO_INT(array->get_attr("itemsize")), size);
+        EXPECT_EQ(array->get_attr("typecode")->to_str(), typecode);
+    }
+    EXPECT_THROW(make_array("x"), std::runtime_error);
+}
+
+TEST_F(ArrayVariableTest, integer_range) {
+    auto array = make_array("b", {NEW_INT(-128), NEW_INT(127)});
+    EXPECT_EQ(array->to_str(), "array('b', [-128, 127])");
+    EXPECT_THROW(array->append(NEW_INT(128)), std::runtime_error);
+    EXPECT_THROW(array->append(NEW_FLOAT(1.0)), std::runtime_error);
+    // A failed append leaves the array unchanged
+    EXPECT_EQ(array->size(), 2);
+
+    auto unsigned_array = make_array("Q", {NEW_INT(BigInt::from_string("18446744073709551615"))});
+    EXPECT_EQ(unsigned_array->to_str(), "array('Q', [18446744073709551615])");
+    EXPECT_THROW(unsigned_array->append(NEW_INT(-1)), std::runtime_error);
+    EXPECT_THROW(unsigned_array->append(NEW_INT(BigInt::from_string("18446744073709551616"))), std::runtime_error);
+}
+
+TEST_F(ArrayVariableTest, unicode) {
+    auto array = make_array("u", {NEW_STRING("a"), NEW_STRING("\xc3\xa9"), NEW_STRING("\xe2\x82\xac")});
+    EXPECT_EQ(array->to_str(), "array('u', 'a\xc3\xa9\xe2\x82\xac')");
+    EXPECT_EQ(array->items<char32_t>()[2], U'€');
+    EXPECT_THROW(array->append(NEW_STRING("ab")), std::runtime_error);
+}
+
+TEST_F(ArrayVariableTest, bytes_round_trip) {
+    auto array = make_array("i", {NEW_INT(1), NEW_INT(-2)});
+    EXPECT_EQ(array->buffer(), std::string("\x01\x00\x00\x00\xfe\xff\xff\xff", 8));
+
+    auto copy = make_array("i");
+    copy->frombytes(array->buffer());
+    EXPECT_TRUE(copy->strictly_equal(array));
+    EXPECT_THROW(copy->frombytes("abc"), std::runtime_error);
+}
+
+TEST_F(ArrayVariableTest, extend) {
+    auto array = make_array("h", {NEW_INT(1)});
+    array->extend(make_array("h", {NEW_INT(2), NEW_INT(3)}));
+    array->extend(NEW_LIST(ListType({NEW_INT(4)})));
+    EXPECT_EQ(array->to_str(), "array('h', [1, 2, 3, 4])");
+    EXPECT_THROW(array->extend(make_array("i", {NEW_INT(5)})), std::runtime_error);
+}
+
+TEST_F(ArrayVariableTest, equality) {
+    EXPECT_TRUE(make_array("i", {NEW_INT(1), NEW_INT(2)})->equal(make_array("d", {NEW_INT(1), NEW_INT(2)})));
+    EXPECT_TRUE(make_array("d", {NEW_FLOAT(0.0)})->equal(make_array("d", {NEW_FLOAT(-0.0)})));
+    EXPECT_FALSE(make_array("i", {NEW_INT(1)})->equal(make_array("i", {NEW_INT(2)})));
+    EXPECT_FALSE(make_array("i", {NEW_INT(1)})->equal(NEW_LIST(ListType({NEW_INT(1)}))));
+}
+
+TEST_F(ArrayVariableTest, operators) {
+    auto array = make_array("i", {NEW_INT(1), NEW_INT(2)});
+    EXPECT_EQ(array->add(make_array("i", {NEW_INT(3)}))->to_str(), "array('i', [1, 2, 3])");
+    EXPECT_EQ(array->mul(NEW_INT(2))->to_str(), "array('i', [1, 2, 1, 2])");
+    EXPECT_EQ(array->mul(NEW_INT(0))->to_str(), "array('i')");
+}
+
+TEST_F(ArrayVariableTest, bound_methods) {
+    Scope scope;
+    auto array = make_array("d");
+
+    auto append = std::dynamic_pointer_cast<FunctionVariable>(array->get_attr("append"));
+    Variable item = NEW_FLOAT(0.5);
+    append->call(item, &scope);
+    EXPECT_EQ(array->to_str(), "array('d', [0.5])");
+
+    auto tobytes = std::dynamic_pointer_cast<FunctionVariable>(array->get_attr("tobytes"));
+    auto bytes = tobytes->call({}, &scope);
+    EXPECT_EQ(bytes->get_type(), VariableType::BYTES);
+    EXPECT_EQ(VAR_TO_BYTES(bytes), array->buffer());
+
+    auto tolist = std::dynamic_pointer_cast<FunctionVariable>(array->get_attr("tolist"));
+    EXPECT_EQ(tolist->call({}, &scope)->to_str(), "[0.5]");
+
+    EXPECT_TRUE(array->has_attr("frombytes"));
+    EXPECT_FALSE(array->has_attr("nonexistent"));
+}
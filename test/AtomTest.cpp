@@ -0,0 +1,62 @@
+#include "variable/Atom.h"
+
+#include <gtest/gtest.h>
+
+#include <string>
+#include <thread>
+#include <vector>
+
+using namespace MiniPython;
+
+class AtomTest: public testing::Test {
+};
+
+TEST_F(AtomTest, interning) {
+    std::string built = "spa";
+    built += "m";
+    Atom a("spam");
+    Atom b(built);
+    EXPECT_EQ(a, b);
+    EXPECT_EQ(&a.str(), &b.str());
+    EXPECT_EQ(a.hash(), std::hash<std::string_view>()("spam"));
+    EXPECT_NE(a, Atom("eggs"));
+
+    EXPECT_TRUE(a == "spam");
+    EXPECT_FALSE(a == "spa");
+    EXPECT_TRUE(a == std::string_view("spam"));
+    EXPECT_EQ(Atom().str(), "");
+    EXPECT_EQ(Atom(), Atom(""));
+}
+
+TEST_F(AtomTest, threads) {
+    // Every thread gets the same entry for each name
+    std::vector<const std::string *> first(100), second(100);
+    auto intern_all = [](std::vector<const std::string *> &result) {
+        for (size_t i = 0; i < result.size(); ++i) {
+            result[i] = &Atom("atom_test_" + std::to_string(i)).str();
+        }
+    };
+    std::thread thread(intern_all, std::ref(first));
+    intern_all(second);
+    thread.join();
+    EXPECT_EQ(first, second);
+}
+
+TEST_F(AtomTest, find) {
+    Atom interned("atom_test_find");
+    EXPECT_EQ(Atom::find("atom_test_find"), interned);
+    EXPECT_FALSE(Atom::find("atom_test_never_interned").has_value());
+
+    // A lookup of a name that isn't interned doesn't add it
+    {
+        Atom::Lookup lookup("atom_test_lookup");
+        const Atom &atom = lookup;
+        EXPECT_EQ(atom.str(), "atom_test_lookup");
+        EXPECT_EQ(atom.hash(), std::hash<std::string_view>()("atom_test_lookup"));
+        EXPECT_TRUE(atom == "atom_test_lookup");
+    }
+    EXPECT_FALSE(Atom::find("atom_test_lookup").has_value());
+
+    Atom::Lookup known("atom_test_find");
+    EXPECT_EQ(static_cast<const Atom &>(known), interned);
+}
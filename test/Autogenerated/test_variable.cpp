@@ -0,0 +1,10 @@
+extern void test_variable_equal();
+extern void test_variable_less();
+extern void test_variable_to_bool();
+extern void test_variable_to_str();
+void test_variable() {
+    test_variable_equal();
+    test_variable_less();
+    test_variable_to_bool();
+    test_variable_to_str();
+}
@@ -0,0 +1,969 @@
+
+#include "variable/Variable.h"
+
+#include "Test.h"
+
+#define VAR(TYPE, VALUE) \
+    std::static_pointer_cast<GenericVariable>(std::make_shared<TYPE ## Variable>(VALUE))
+
+enum class OpReturningVar {
+    add,
+    sub,
+    mul,
+    div,
+    int_div,
+    pow,
+    mod,
+};
+
+enum class AssertResult {
+    PASS,
+    FAIL,
+    EXCEPTION,
+};
+
+static std::ostream& operator<< (std::ostream& os, AssertResult res) {
+    switch (res) {
+    case AssertResult::PASS:       os << "PASS";      break;
+    case AssertResult::FAIL:       os << "FAIL";      break;
+    case AssertResult::EXCEPTION:  os << "EXCEPTION"; break;
+    default:                       os << "???";
+    }
+    return os;
+}
+
+static Variable doOpReturningVar(Variable arg1, Variable arg2, OpReturningVar op) {
+    switch(op) {
+    case OpReturningVar::add: return arg1->add(arg2);
+    case OpReturningVar::sub: return arg1->sub(arg2);
+    case OpReturningVar::mul: return arg1->mul(arg2);
+    case OpReturningVar::div: return arg1->div(arg2);
+    case OpReturningVar::int_div: return arg1->int_div(arg2);
+    case OpReturningVar::mod: return arg1->mod(arg2);
+    case OpReturningVar::pow: return arg1->pow(arg2);
+    default: throw std::runtime_error("Bad op");
+    }
+}
+
+static void doOpReturningVarAndCompareResult(Variable arg1, Variable arg2, OpReturningVar op, Variable expected_res, AssertResult a_res, const char *descr) {
+    try {
+        auto res_var = doOpReturningVar(arg1, arg2, op);
+        auto assertion_result = res_var->strictly_equal(expected_res) ? AssertResult::PASS : AssertResult::FAIL;
+        if (assertion_result != a_res) {
+            std::cerr << descr << " returned " << assertion_result << " instead of " << a_res << "\n";
+        }
+    }
+    catch(...) {
+        if (a_res != AssertResult::EXCEPTION) {
+            std::cerr << descr << " returned EXCEPTION instead of " << a_res << "\n";
+        }
+    }
+}
+
+enum class OpReturningBool {
+    equal,
+    less,
+};
+
+static bool doOpReturningBool(Variable arg1, Variable arg2, OpReturningBool op) {
+    switch(op) {
+    case OpReturningBool::equal: return arg1->equal(arg2);
+    case OpReturningBool::less: return arg1->less(arg2);
+    default: throw std::runtime_error("Bad op");
+    }
+}
+
+static void doOpReturningBoolAndCompareResult(Variable arg1, Variable arg2, OpReturningBool op, bool expected_res, AssertResult a_res, const char *descr) {
+    try {
+        auto assertion_result = doOpReturningBool(arg1, arg2, op) ? AssertResult::PASS : AssertResult::FAIL;
+        if (assertion_result != a_res) {
+            std::cerr << descr << " returned " << assertion_result << " instead of " << a_res << "\n";
+        }
+    }
+    catch(...) {
+        if (a_res != AssertResult::EXCEPTION) {
+            std::cerr << descr << " returned EXCEPTION instead of " << a_res << "\n";
+        }
+    }
+}
+
+static auto None = std::static_pointer_cast<GenericVariable>(std::make_shared<NoneVariable>());
+static auto None2 = std::static_pointer_cast<GenericVariable>(std::make_shared<NoneVariable>());
+static auto False = VAR(Bool, false);
+static auto False2 = VAR(Bool, false);
+static auto True = VAR(Bool, true);
+static auto True2 = VAR(Bool, true);
+static auto IntZero = VAR(Int, 0);
+static auto IntOne = VAR(Int, 1);
+static auto IntTwo = VAR(Int, 2);
+static auto IntTwo2 = VAR(Int, 2);
+static auto Int8 = VAR(Int, 8);
+static auto IntMinusOne = VAR(Int, -1);
+static auto IntMinusOne2 = VAR(Int, -1);
+static auto IntMinus12 = VAR(Int, -12);
+static auto IntMinus73 = VAR(Int, -73);
+static auto FloatMinusOne = VAR(Float, -1);
+static auto FloatZero = VAR(Float, 0);
+static auto FloatOne = VAR(Float, 1);
+static auto FloatTwo = VAR(Float, 2);
+static auto FloatTwo2 = VAR(Float, 2);
+static auto Float2_5 = VAR(Float, 2.5);
+static auto Float_23_74 = VAR(Float, -23.74);
+static auto StrEmpty = VAR(String, "");
+static auto StrEmpty2 = VAR(String, "");
+static auto StrA = VAR(String, "some text");
+static auto StrA2 = VAR(String, "some text");
+static auto StrB = VAR(String, "other text");
+static auto ListEmpty = VAR(List, ListType());
+static auto ListEmpty2 = VAR(List, ListType());
+
+#include "variable/Variable.h"
+
+#include <gtest/gtest.h>
+
+class VariableAddTest: public testing::Test {
+};
+
+TEST_F(VariableAddTest, VariableAddTest) {
+    EXPECT_ANY_THROW(None->add(None));
+    EXPECT_ANY_THROW(None->add(None2));
+    EXPECT_ANY_THROW(None->add(False));
+    EXPECT_ANY_THROW(None->add(False2));
+    EXPECT_ANY_THROW(None->add(True));
+    EXPECT_ANY_THROW(None->add(True2));
+    EXPECT_ANY_THROW(None->add(IntZero));
+    EXPECT_ANY_THROW(None->add(IntOne));
+    EXPECT_ANY_THROW(None->add(IntTwo));
+    EXPECT_ANY_THROW(None->add(IntTwo2));
+    EXPECT_ANY_THROW(None->add(Int8));
+    EXPECT_ANY_THROW(None->add(IntMinusOne));
+    EXPECT_ANY_THROW(None->add(IntMinusOne2));
+    EXPECT_ANY_THROW(None->add(IntMinus12));
+    EXPECT_ANY_THROW(None->add(IntMinus73));
+    EXPECT_ANY_THROW(None->add(FloatMinusOne));
+    EXPECT_ANY_THROW(None->add(FloatZero));
+    EXPECT_ANY_THROW(None->add(FloatOne));
+    EXPECT_ANY_THROW(None->add(FloatTwo));
+    EXPECT_ANY_THROW(None->add(FloatTwo2));
+    EXPECT_ANY_THROW(None->add(Float2_5));
+    EXPECT_ANY_THROW(None->add(Float_23_74));
+    EXPECT_ANY_THROW(None->add(StrEmpty));
+    EXPECT_ANY_THROW(None->add(StrEmpty2));
+    EXPECT_ANY_THROW(None->add(StrA));
+    EXPECT_ANY_THROW(None->add(StrA2));
+    EXPECT_ANY_THROW(None->add(StrB));
+    EXPECT_ANY_THROW(None->add(ListEmpty));
+    EXPECT_ANY_THROW(None->add(ListEmpty2));
+    EXPECT_ANY_THROW(None2->add(None));
+    EXPECT_ANY_THROW(None2->add(None2));
+    EXPECT_ANY_THROW(None2->add(False));
+    EXPECT_ANY_THROW(None2->add(False2));
+    EXPECT_ANY_THROW(None2->add(True));
+    EXPECT_ANY_THROW(None2->add(True2));
+    EXPECT_ANY_THROW(None2->add(IntZero));
+    EXPECT_ANY_THROW(None2->add(IntOne));
+    EXPECT_ANY_THROW(None2->add(IntTwo));
+    EXPECT_ANY_THROW(None2->add(IntTwo2));
+    EXPECT_ANY_THROW(None2->add(Int8));
+    EXPECT_ANY_THROW(None2->add(IntMinusOne));
+    EXPECT_ANY_THROW(None2->add(IntMinusOne2));
+    EXPECT_ANY_THROW(None2->add(IntMinus12));
+    EXPECT_ANY_THROW(None2->add(IntMinus73));
+    EXPECT_ANY_THROW(None2->add(FloatMinusOne));
+    EXPECT_ANY_THROW(None2->add(FloatZero));
+    EXPECT_ANY_THROW(None2->add(FloatOne));
+    EXPECT_ANY_THROW(None2->add(FloatTwo));
+    EXPECT_ANY_THROW(None2->add(FloatTwo2));
+    EXPECT_ANY_THROW(None2->add(Float2_5));
+    EXPECT_ANY_THROW(None2->add(Float_23_74));
+    EXPECT_ANY_THROW(None2->add(StrEmpty));
+    EXPECT_ANY_THROW(None2->add(StrEmpty2));
+    EXPECT_ANY_THROW(None2->add(StrA));
+    EXPECT_ANY_THROW(None2->add(StrA2));
+    EXPECT_ANY_THROW(None2->add(StrB));
+    EXPECT_ANY_THROW(None2->add(ListEmpty));
+    EXPECT_ANY_THROW(None2->add(ListEmpty2));
+    EXPECT_ANY_THROW(False->add(None));
+    EXPECT_ANY_THROW(False->add(None2));
+    EXPECT_TRUE(False->add(False)->strictly_equal(VAR(Int, 0)));
+    EXPECT_TRUE(False->add(False2)->strictly_equal(VAR(Int, 0)));
+    EXPECT_TRUE(False->add(True)->strictly_equal(VAR(Int, 1)));
+    EXPECT_TRUE(False->add(True2)->strictly_equal(VAR(Int, 1)));
+    EXPECT_TRUE(False->add(IntZero)->strictly_equal(VAR(Int, 0)));
+    EXPECT_TRUE(False->add(IntOne)->strictly_equal(VAR(Int, 1)));
+    EXPECT_TRUE(False->add(IntTwo)->strictly_equal(VAR(Int, 2)));
+    EXPECT_TRUE(False->add(IntTwo2)->strictly_equal(VAR(Int, 2)));
+    EXPECT_TRUE(False->add(Int8)->strictly_equal(VAR(Int, 8)));
+    EXPECT_TRUE(False->add(IntMinusOne)->strictly_equal(VAR(Int, -1)));
+    EXPECT_TRUE(False->add(IntMinusOne2)->strictly_equal(VAR(Int, -1)));
+    EXPECT_TRUE(False->add(IntMinus12)->strictly_equal(VAR(Int, -12)));
+    EXPECT_TRUE(False->add(IntMinus73)->strictly_equal(VAR(Int, -73)));
+    EXPECT_TRUE(False->add(FloatMinusOne)->strictly_equal(VAR(Float, -1.0)));
+    EXPECT_TRUE(False->add(FloatZero)->strictly_equal(VAR(Float, 0.0)));
+    EXPECT_TRUE(False->add(FloatOne)->strictly_equal(VAR(Float, 1.0)));
+    EXPECT_TRUE(False->add(FloatTwo)->strictly_equal(VAR(Float, 2.0)));
+    EXPECT_TRUE(False->add(FloatTwo2)->strictly_equal(VAR(Float, 2.0)));
+    EXPECT_TRUE(False->add(Float2_5)->strictly_equal(VAR(Float, 2.5)));
+    EXPECT_TRUE(False->add(Float_23_74)->strictly_equal(VAR(Float, -23.74)));
+    EXPECT_ANY_THROW(False->add(StrEmpty));
+    EXPECT_ANY_THROW(False->add(StrEmpty2));
+    EXPECT_ANY_THROW(False->add(StrA));
+    EXPECT_ANY_THROW(False->add(StrA2));
+    EXPECT_ANY_THROW(False->add(StrB));
+    EXPECT_ANY_THROW(False->add(ListEmpty));
+    EXPECT_ANY_THROW(False->add(ListEmpty2));
+    EXPECT_ANY_THROW(False2->add(None));
+    EXPECT_ANY_THROW(False2->add(None2));
+    EXPECT_TRUE(False2->add(False)->strictly_equal(VAR(Int, 0)));
+    EXPECT_TRUE(False2->add(False2)->strictly_equal(VAR(Int, 0)));
+    EXPECT_TRUE(False2->add(True)->strictly_equal(VAR(Int, 1)));
+    EXPECT_TRUE(False2->add(True2)->strictly_equal(VAR(Int, 1)));
+    EXPECT_TRUE(False2->add(IntZero)->strictly_equal(VAR(Int, 0)));
+    EXPECT_TRUE(False2->add(IntOne)->strictly_equal(VAR(Int, 1)));
+    EXPECT_TRUE(False2->add(IntTwo)->strictly_equal(VAR(Int, 2)));
+    EXPECT_TRUE(False2->add(IntTwo2)->strictly_equal(VAR(Int, 2)));
+    EXPECT_TRUE(False2->add(Int8)->strictly_equal(VAR(Int, 8)));
+    EXPECT_TRUE(False2->add(IntMinusOne)->strictly_equal(VAR(Int, -1)));
+    EXPECT_TRUE(False2->add(IntMinusOne2)->strictly_equal(VAR(Int, -1)));
+    EXPECT_TRUE(False2->add(IntMinus12)->strictly_equal(VAR(Int, -12)));
+    EXPECT_TRUE(False2->add(IntMinus73)->strictly_equal(VAR(Int, -73)));
+    EXPECT_TRUE(False2->add(FloatMinusOne)->strictly_equal(VAR(Float, -1.0)));
+    EXPECT_TRUE(False2->add(FloatZero)->strictly_equal(VAR(Float, 0.0)));
+    EXPECT_TRUE(False2->add(FloatOne)->strictly_equal(VAR(Float, 1.0)));
+    EXPECT_TRUE(False2->add(FloatTwo)->strictly_equal(VAR(Float, 2.0)));
+    EXPECT_TRUE(False2->add(FloatTwo2)->strictly_equal(VAR(Float, 2.0)));
+    EXPECT_TRUE(False2->add(Float2_5)->strictly_equal(VAR(Float, 2.5)));
+    EXPECT_TRUE(False2->add(Float_23_74)->strictly_equal(VAR(Float, -23.74)));
+    EXPECT_ANY_THROW(False2->add(StrEmpty));
+    EXPECT_ANY_THROW(False2->add(StrEmpty2));
+    EXPECT_ANY_THROW(False2->add(StrA));
+    EXPECT_ANY_THROW(False2->add(StrA2));
+    EXPECT_ANY_THROW(False2->add(StrB));
+    EXPECT_ANY_THROW(False2->add(ListEmpty));
+    EXPECT_ANY_THROW(False2->add(ListEmpty2));
+    EXPECT_ANY_THROW(True->add(None));
+    EXPECT_ANY_THROW(True->add(None2));
+    EXPECT_TRUE(True->add(False)->strictly_equal(VAR(Int, 1)));
+    EXPECT_TRUE(True->add(False2)->strictly_equal(VAR(Int, 1)));
+    EXPECT_TRUE(True->add(True)->strictly_equal(VAR(Int, 2)));
+    EXPECT_TRUE(True->add(True2)->strictly_equal(VAR(Int, 2)));
+    EXPECT_TRUE(True->add(IntZero)->strictly_equal(VAR(Int, 1)));
+    EXPECT_TRUE(True->add(IntOne)->strictly_equal(VAR(Int, 2)));
+    EXPECT_TRUE(True->add(IntTwo)->strictly_equal(VAR(Int, 3)));
+    EXPECT_TRUE(True->add(IntTwo2)->strictly_equal(VAR(Int, 3)));
+    EXPECT_TRUE(True->add(Int8)->strictly_equal(VAR(Int, 9)));
+    EXPECT_TRUE(True->add(IntMinusOne)->strictly_equal(VAR(Int, 0)));
+    EXPECT_TRUE(True->add(IntMinusOne2)->strictly_equal(VAR(Int, 0)));
+    EXPECT_TRUE(True->add(IntMinus12)->strictly_equal(VAR(Int, -11)));
+    EXPECT_TRUE(True->add(IntMinus73)->strictly_equal(VAR(Int, -72)));
+    EXPECT_TRUE(True->add(FloatMinusOne)->strictly_equal(VAR(Float, 0.0)));
+    EXPECT_TRUE(True->add(FloatZero)->strictly_equal(VAR(Float, 1.0)));
+    EXPECT_TRUE(True->add(FloatOne)->strictly_equal(VAR(Float, 2.0)));
+    EXPECT_TRUE(True->add(FloatTwo)->strictly_equal(VAR(Float, 3.0)));
+    EXPECT_TRUE(True->add(FloatTwo2)->strictly_equal(VAR(Float, 3.0)));
+    EXPECT_TRUE(True->add(Float2_5)->strictly_equal(VAR(Float, 3.5)));
+    EXPECT_TRUE(True->add(Float_23_74)->strictly_equal(VAR(Float, -22.74)));
+    EXPECT_ANY_THROW(True->add(StrEmpty));
+    EXPECT_ANY_THROW(True->add(StrEmpty2));
+    EXPECT_ANY_THROW(True->add(StrA));
+    EXPECT_ANY_THROW(True->add(StrA2));
+    EXPECT_ANY_THROW(True->add(StrB));
+    EXPECT_ANY_THROW(True->add(ListEmpty));
+    EXPECT_ANY_THROW(True->add(ListEmpty2));
+    EXPECT_ANY_THROW(True2->add(None));
+    EXPECT_ANY_THROW(True2->add(None2));
+    EXPECT_TRUE(True2->add(False)->strictly_equal(VAR(Int, 1)));
+    EXPECT_TRUE(True2->add(False2)->strictly_equal(VAR(Int, 1)));
+    EXPECT_TRUE(True2->add(True)->strictly_equal(VAR(Int, 2)));
+    EXPECT_TRUE(True2->add(True2)->strictly_equal(VAR(Int, 2)));
+    EXPECT_TRUE(True2->add(IntZero)->strictly_equal(VAR(Int, 1)));
+    EXPECT_TRUE(True2->add(IntOne)->strictly_equal(VAR(Int, 2)));
+    EXPECT_TRUE(True2->add(IntTwo)->strictly_equal(VAR(Int, 3)));
+    EXPECT_TRUE(True2->add(IntTwo2)->strictly_equal(VAR(Int, 3)));
+    EXPECT_TRUE(True2->add(Int8)->strictly_equal(VAR(Int, 9)));
+    EXPECT_TRUE(True2->add(IntMinusOne)->strictly_equal(VAR(Int, 0)));
+    EXPECT_TRUE(True2->add(IntMinusOne2)->strictly_equal(VAR(Int, 0)));
+    EXPECT_TRUE(True2->add(IntMinus12)->strictly_equal(VAR(Int, -11)));
+    EXPECT_TRUE(True2->add(IntMinus73)->strictly_equal(VAR(Int, -72)));
+    EXPECT_TRUE(True2->add(FloatMinusOne)->strictly_equal(VAR(Float, 0.0)));
+    EXPECT_TRUE(True2->add(FloatZero)->strictly_equal(VAR(Float, 1.0)));
+    EXPECT_TRUE(True2->add(FloatOne)->strictly_equal(VAR(Float, 2.0)));
+    EXPECT_TRUE(True2->add(FloatTwo)->strictly_equal(VAR(Float, 3.0)));
+    EXPECT_TRUE(True2->add(FloatTwo2)->strictly_equal(VAR(Float, 3.0)));
+    EXPECT_TRUE(True2->add(Float2_5)->strictly_equal(VAR(Float, 3.5)));
+    EXPECT_TRUE(True2->add(Float_23_74)->strictly_equal(VAR(Float, -22.74)));
+    EXPECT_ANY_THROW(True2->add(StrEmpty));
+    EXPECT_ANY_THROW(True2->add(StrEmpty2));
+    EXPECT_ANY_THROW(True2->add(StrA));
+    EXPECT_ANY_THROW(True2->add(StrA2));
+    EXPECT_ANY_THROW(True2->add(StrB));
+    EXPECT_ANY_THROW(True2->add(ListEmpty));
+    EXPECT_ANY_THROW(True2->add(ListEmpty2));
+    EXPECT_ANY_THROW(IntZero->add(None));
+    EXPECT_ANY_THROW(IntZero->add(None2));
+    EXPECT_TRUE(IntZero->add(False)->strictly_equal(VAR(Int, 0)));
+    EXPECT_TRUE(IntZero->add(False2)->strictly_equal(VAR(Int, 0)));
+    EXPECT_TRUE(IntZero->add(True)->strictly_equal(VAR(Int, 1)));
+    EXPECT_TRUE(IntZero->add(True2)->strictly_equal(VAR(Int, 1)));
+    EXPECT_TRUE(IntZero->add(IntZero)->strictly_equal(VAR(Int, 0)));
+    EXPECT_TRUE(IntZero->add(IntOne)->strictly_equal(VAR(Int, 1)));
+    EXPECT_TRUE(IntZero->add(IntTwo)->strictly_equal(VAR(Int, 2)));
+    EXPECT_TRUE(IntZero->add(IntTwo2)->strictly_equal(VAR(Int, 2)));
+    EXPECT_TRUE(IntZero->add(Int8)->strictly_equal(VAR(Int, 8)));
+    EXPECT_TRUE(IntZero->add(IntMinusOne)->strictly_equal(VAR(Int, -1)));
+    EXPECT_TRUE(IntZero->add(IntMinusOne2)->strictly_equal(VAR(Int, -1)));
+    EXPECT_TRUE(IntZero->add(IntMinus12)->strictly_equal(VAR(Int, -12)));
+    EXPECT_TRUE(IntZero->add(IntMinus73)->strictly_equal(VAR(Int, -73)));
+    EXPECT_TRUE(IntZero->add(FloatMinusOne)->strictly_equal(VAR(Float, -1.0)));
+    EXPECT_TRUE(IntZero->add(FloatZero)->strictly_equal(VAR(Float, 0.0)));
+    EXPECT_TRUE(IntZero->add(FloatOne)->strictly_equal(VAR(Float, 1.0)));
+    EXPECT_TRUE(IntZero->add(FloatTwo)->strictly_equal(VAR(Float, 2.0)));
+    EXPECT_TRUE(IntZero->add(FloatTwo2)->strictly_equal(VAR(Float, 2.0)));
+    EXPECT_TRUE(IntZero->add(Float2_5)->strictly_equal(VAR(Float, 2.5)));
+    EXPECT_TRUE(IntZero->add(Float_23_74)->strictly_equal(VAR(Float, -23.74)));
+    EXPECT_ANY_THROW(IntZero->add(StrEmpty));
+    EXPECT_ANY_THROW(IntZero->add(StrEmpty2));
+    EXPECT_ANY_THROW(IntZero->add(StrA));
+    EXPECT_ANY_THROW(IntZero->add(StrA2));
+    EXPECT_ANY_THROW(IntZero->add(StrB));
+    EXPECT_ANY_THROW(IntZero->add(ListEmpty));
+    EXPECT_ANY_THROW(IntZero->add(ListEmpty2));
+    EXPECT_ANY_THROW(IntOne->add(None));
+    EXPECT_ANY_THROW(IntOne->add(None2));
+    EXPECT_TRUE(IntOne->add(False)->strictly_equal(VAR(Int, 1)));
+    EXPECT_TRUE(IntOne->add(False2)->strictly_equal(VAR(Int, 1)));
+    EXPECT_TRUE(IntOne->add(True)->strictly_equal(VAR(Int, 2)));
+    EXPECT_TRUE(IntOne->add(True2)->strictly_equal(VAR(Int, 2)));
+    EXPECT_TRUE(IntOne->add(IntZero)->strictly_equal(VAR(Int, 1)));
+    EXPECT_TRUE(IntOne->add(IntOne)->strictly_equal(VAR(Int, 2)));
+    EXPECT_TRUE(IntOne->add(IntTwo)->strictly_equal(VAR(Int, 3)));
+    EXPECT_TRUE(IntOne->add(IntTwo2)->strictly_equal(VAR(Int, 3)));
+    EXPECT_TRUE(IntOne->add(Int8)->strictly_equal(VAR(Int, 9)));
+    EXPECT_TRUE(IntOne->add(IntMinusOne)->strictly_equal(VAR(Int, 0)));
+    EXPECT_TRUE(IntOne->add(IntMinusOne2)->strictly_equal(VAR(Int, 0)));
+    EXPECT_TRUE(IntOne->add(IntMinus12)->strictly_equal(VAR(Int, -11)));
+    EXPECT_TRUE(IntOne->add(IntMinus73)->strictly_equal(VAR(Int, -72)));
+    EXPECT_TRUE(IntOne->add(FloatMinusOne)->strictly_equal(VAR(Float, 0.0)));
+    EXPECT_TRUE(IntOne->add(FloatZero)->strictly_equal(VAR(Float, 1.0)));
+    EXPECT_TRUE(IntOne->add(FloatOne)->strictly_equal(VAR(Float, 2.0)));
+    EXPECT_TRUE(IntOne->add(FloatTwo)->strictly_equal(VAR(Float, 3.0)));
+    EXPECT_TRUE(IntOne->add(FloatTwo2)->strictly_equal(VAR(Float, 3.0)));
+    EXPECT_TRUE(IntOne->add(Float2_5)->strictly_equal(VAR(Float, 3.5)));
+    EXPECT_TRUE(IntOne->add(Float_23_74)->strictly_equal(VAR(Float, -22.74)));
+    EXPECT_ANY_THROW(IntOne->add(StrEmpty));
+    EXPECT_ANY_THROW(IntOne->add(StrEmpty2));
+    EXPECT_ANY_THROW(IntOne->add(StrA));
+    EXPECT_ANY_THROW(IntOne->add(StrA2));
+    EXPECT_ANY_THROW(IntOne->add(StrB));
+    EXPECT_ANY_THROW(IntOne->add(ListEmpty));
+    EXPECT_ANY_THROW(IntOne->add(ListEmpty2));
+    EXPECT_ANY_THROW(IntTwo->add(None));
+    EXPECT_ANY_THROW(IntTwo->add(None2));
+    EXPECT_TRUE(IntTwo->add(False)->strictly_equal(VAR(Int, 2)));
+    EXPECT_TRUE(IntTwo->add(False2)->strictly_equal(VAR(Int, 2)));
+    EXPECT_TRUE(IntTwo->add(True)->strictly_equal(VAR(Int, 3)));
+    EXPECT_TRUE(IntTwo->add(True2)->strictly_equal(VAR(Int, 3)));
+    EXPECT_TRUE(IntTwo->add(IntZero)->strictly_equal(VAR(Int, 2)));
+    EXPECT_TRUE(IntTwo->add(IntOne)->strictly_equal(VAR(Int, 3)));
+    EXPECT_TRUE(IntTwo->add(IntTwo)->strictly_equal(VAR(Int, 4)));
+    EXPECT_TRUE(IntTwo->add(IntTwo2)->strictly_equal(VAR(Int, 4)));
+    EXPECT_TRUE(IntTwo->add(Int8)->strictly_equal(VAR(Int, 10)));
+    EXPECT_TRUE(IntTwo->add(IntMinusOne)->strictly_equal(VAR(Int, 1)));
+    EXPECT_TRUE(IntTwo->add(IntMinusOne2)->strictly_equal(VAR(Int, 1)));
+    EXPECT_TRUE(IntTwo->add(IntMinus12)->strictly_equal(VAR(Int, -10)));
+    EXPECT_TRUE(IntTwo->add(IntMinus73)->strictly_equal(VAR(Int, -71)));
+    EXPECT_TRUE(IntTwo->add(FloatMinusOne)->strictly_equal(VAR(Float, 1.0)));
+    EXPECT_TRUE(IntTwo->add(FloatZero)->strictly_equal(VAR(Float, 2.0)));
+    EXPECT_TRUE(IntTwo->add(FloatOne)->strictly_equal(VAR(Float, 3.0)));
+    EXPECT_TRUE(IntTwo->add(FloatTwo)->strictly_equal(VAR(Float, 4.0)));
+    EXPECT_TRUE(IntTwo->add(FloatTwo2)->strictly_equal(VAR(Float, 4.0)));
+    EXPECT_TRUE(IntTwo->add(Float2_5)->strictly_equal(VAR(Float, 4.5)));
+    EXPECT_TRUE(IntTwo->add(Float_23_74)->strictly_equal(VAR(Float, -21.74)));
+    EXPECT_ANY_THROW(IntTwo->add(StrEmpty));
+    EXPECT_ANY_THROW(IntTwo->add(StrEmpty2));
+    EXPECT_ANY_THROW(IntTwo->add(StrA));
+    EXPECT_ANY_THROW(IntTwo->add(StrA2));
+    EXPECT_ANY_THROW(IntTwo->add(StrB));
+    EXPECT_ANY_THROW(IntTwo->add(ListEmpty));
+    EXPECT_ANY_THROW(IntTwo->add(ListEmpty2));
+    EXPECT_ANY_THROW(IntTwo2->add(None));
+    EXPECT_ANY_THROW(IntTwo2->add(None2));
+    EXPECT_TRUE(IntTwo2->add(False)->strictly_equal(VAR(Int, 2)));
+    EXPECT_TRUE(IntTwo2->add(False2)->strictly_equal(VAR(Int, 2)));
+    EXPECT_TRUE(IntTwo2->add(True)->strictly_equal(VAR(Int, 3)));
+    EXPECT_TRUE(IntTwo2->add(True2)->strictly_equal(VAR(Int, 3)));
+    EXPECT_TRUE(IntTwo2->add(IntZero)->strictly_equal(VAR(Int, 2)));
+    EXPECT_TRUE(IntTwo2->add(IntOne)->strictly_equal(VAR(Int, 3)));
+    EXPECT_TRUE(IntTwo2->add(IntTwo)->strictly_equal(VAR(Int, 4)));
+    EXPECT_TRUE(IntTwo2->add(IntTwo2)->strictly_equal(VAR(Int, 4)));
+    EXPECT_TRUE(IntTwo2->add(Int8)->strictly_equal(VAR(Int, 10)));
+    EXPECT_TRUE(IntTwo2->add(IntMinusOne)->strictly_equal(VAR(Int, 1)));
+    EXPECT_TRUE(IntTwo2->add(IntMinusOne2)->strictly_equal(VAR(Int, 1)));
+    EXPECT_TRUE(IntTwo2->add(IntMinus12)->strictly_equal(VAR(Int, -10)));
+    EXPECT_TRUE(IntTwo2->add(IntMinus73)->strictly_equal(VAR(Int, -71)));
+    EXPECT_TRUE(IntTwo2->add(FloatMinusOne)->strictly_equal(VAR(Float, 1.0)));
+    EXPECT_TRUE(IntTwo2->add(FloatZero)->strictly_equal(VAR(Float, 2.0)));
+    EXPECT_TRUE(IntTwo2->add(FloatOne)->strictly_equal(VAR(Float, 3.0)));
+    EXPECT_TRUE(IntTwo2->add(FloatTwo)->strictly_equal(VAR(Float, 4.0)));
+    EXPECT_TRUE(IntTwo2->add(FloatTwo2)->strictly_equal(VAR(Float, 4.0)));
+    EXPECT_TRUE(IntTwo2->add(Float2_5)->strictly_equal(VAR(Float, 4.5)));
+    EXPECT_TRUE(IntTwo2->add(Float_23_74)->strictly_equal(VAR(Float, -21.74)));
+    EXPECT_ANY_THROW(IntTwo2->add(StrEmpty));
+    EXPECT_ANY_THROW(IntTwo2->add(StrEmpty2));
+    EXPECT_ANY_THROW(IntTwo2->add(StrA));
+    EXPECT_ANY_THROW(IntTwo2->add(StrA2));
+    EXPECT_ANY_THROW(IntTwo2->add(StrB));
+    EXPECT_ANY_THROW(IntTwo2->add(ListEmpty));
+    EXPECT_ANY_THROW(IntTwo2->add(ListEmpty2));
+    EXPECT_ANY_THROW(Int8->add(None));
+    EXPECT_ANY_THROW(Int8->add(None2));
+    EXPECT_TRUE(Int8->add(False)->strictly_equal(VAR(Int, 8)));
+    EXPECT_TRUE(Int8->add(False2)->strictly_equal(VAR(Int, 8)));
+    EXPECT_TRUE(Int8->add(True)->strictly_equal(VAR(Int, 9)));
+    EXPECT_TRUE(Int8->add(True2)->strictly_equal(VAR(Int, 9)));
+    EXPECT_TRUE(Int8->add(IntZero)->strictly_equal(VAR(Int, 8)));
+    EXPECT_TRUE(Int8->add(IntOne)->strictly_equal(VAR(Int, 9)));
+    EXPECT_TRUE(Int8->add(IntTwo)->strictly_equal(VAR(Int, 10)));
+    EXPECT_TRUE(Int8->add(IntTwo2)->strictly_equal(VAR(Int, 10)));
+    EXPECT_TRUE(Int8->add(Int8)->strictly_equal(VAR(Int, 16)));
+    EXPECT_TRUE(Int8->add(IntMinusOne)->strictly_equal(VAR(Int, 7)));
+    EXPECT_TRUE(Int8->add(IntMinusOne2)->strictly_equal(VAR(Int, 7)));
+    EXPECT_TRUE(Int8->add(IntMinus12)->strictly_equal(VAR(Int, -4)));
+    EXPECT_TRUE(Int8->add(IntMinus73)->strictly_equal(VAR(Int, -65)));
+    EXPECT_TRUE(Int8->add(FloatMinusOne)->strictly_equal(VAR(Float, 7.0)));
+    EXPECT_TRUE(Int8->add(FloatZero)->strictly_equal(VAR(Float, 8.0)));
+    EXPECT_TRUE(Int8->add(FloatOne)->strictly_equal(VAR(Float, 9.0)));
+    EXPECT_TRUE(Int8->add(FloatTwo)->strictly_equal(VAR(Float, 10.0)));
+    EXPECT_TRUE(Int8->add(FloatTwo2)->strictly_equal(VAR(Float, 10.0)));
+    EXPECT_TRUE(Int8->add(Float2_5)->strictly_equal(VAR(Float, 10.5)));
+    EXPECT_TRUE(Int8->add(Float_23_74)->strictly_equal(VAR(Float, -15.739999999999998)));
+    EXPECT_ANY_THROW(Int8->add(StrEmpty));
+    EXPECT_ANY_THROW(Int8->add(StrEmpty2));
+    EXPECT_ANY_THROW(Int8->add(StrA));
+    EXPECT_ANY_THROW(Int8->add(StrA2));
+    EXPECT_ANY_THROW(Int8->add(StrB));
+    EXPECT_ANY_THROW(Int8->add(ListEmpty));
+    EXPECT_ANY_THROW(Int8->add(ListEmpty2));
+    EXPECT_ANY_THROW(IntMinusOne->add(None));
+    EXPECT_ANY_THROW(IntMinusOne->add(None2));
+    EXPECT_TRUE(IntMinusOne->add(False)->strictly_equal(VAR(Int, -1)));
+    EXPECT_TRUE(IntMinusOne->add(False2)->strictly_equal(VAR(Int, -1)));
+    EXPECT_TRUE(IntMinusOne->add(True)->strictly_equal(VAR(Int, 0)));
+    EXPECT_TRUE(IntMinusOne->add(True2)->strictly_equal(VAR(Int, 0)));
+    EXPECT_TRUE(IntMinusOne->add(IntZero)->strictly_equal(VAR(Int, -1)));
+    EXPECT_TRUE(IntMinusOne->add(IntOne)->strictly_equal(VAR(Int, 0)));
+    EXPECT_TRUE(IntMinusOne->add(IntTwo)->strictly_equal(VAR(Int, 1)));
+    EXPECT_TRUE(IntMinusOne->add(IntTwo2)->strictly_equal(VAR(Int, 1)));
+    EXPECT_TRUE(IntMinusOne->add(Int8)->strictly_equal(VAR(Int, 7)));
+    EXPECT_TRUE(IntMinusOne->add(IntMinusOne)->strictly_equal(VAR(Int, -2)));
+    EXPECT_TRUE(IntMinusOne->add(IntMinusOne2)->strictly_equal(VAR(Int, -2)));
+    EXPECT_TRUE(IntMinusOne->add(IntMinus12)->strictly_equal(VAR(Int, -13)));
+    EXPECT_TRUE(IntMinusOne->add(IntMinus73)->strictly_equal(VAR(Int, -74)));
+    EXPECT_TRUE(IntMinusOne->add(FloatMinusOne)->strictly_equal(VAR(Float, -2.0)));
+    EXPECT_TRUE(IntMinusOne->add(FloatZero)->strictly_equal(VAR(Float, -1.0)));
+    EXPECT_TRUE(IntMinusOne->add(FloatOne)->strictly_equal(VAR(Float, 0.0)));
+    EXPECT_TRUE(IntMinusOne->add(FloatTwo)->strictly_equal(VAR(Float, 1.0)));
+    EXPECT_TRUE(IntMinusOne->add(FloatTwo2)->strictly_equal(VAR(Float, 1.0)));
+    EXPECT_TRUE(IntMinusOne->add(Float2_5)->strictly_equal(VAR(Float, 1.5)));
+    EXPECT_TRUE(IntMinusOne->add(Float_23_74)->strictly_equal(VAR(Float, -24.74)));
+    EXPECT_ANY_THROW(IntMinusOne->add(StrEmpty));
+    EXPECT_ANY_THROW(IntMinusOne->add(StrEmpty2));
+    EXPECT_ANY_THROW(IntMinusOne->add(StrA));
+    EXPECT_ANY_THROW(IntMinusOne->add(StrA2));
+    EXPECT_ANY_THROW(IntMinusOne->add(StrB));
+    EXPECT_ANY_THROW(IntMinusOne->add(ListEmpty));
+    EXPECT_ANY_THROW(IntMinusOne->add(ListEmpty2));
+    EXPECT_ANY_THROW(IntMinusOne2->add(None));
+    EXPECT_ANY_THROW(IntMinusOne2->add(None2));
+    EXPECT_TRUE(IntMinusOne2->add(False)->strictly_equal(VAR(Int, -1)));
+    EXPECT_TRUE(IntMinusOne2->add(False2)->strictly_equal(VAR(Int, -1)));
+    EXPECT_TRUE(IntMinusOne2->add(True)->strictly_equal(VAR(Int, 0)));
+    EXPECT_TRUE(IntMinusOne2->add(True2)->strictly_equal(VAR(Int, 0)));
+    EXPECT_TRUE(IntMinusOne2->add(IntZero)->strictly_equal(VAR(Int, -1)));
+    EXPECT_TRUE(IntMinusOne2->add(IntOne)->strictly_equal(VAR(Int, 0)));
+    EXPECT_TRUE(IntMinusOne2->add(IntTwo)->strictly_equal(VAR(Int, 1)));
+    EXPECT_TRUE(IntMinusOne2->add(IntTwo2)->strictly_equal(VAR(Int, 1)));
+    EXPECT_TRUE(IntMinusOne2->add(Int8)->strictly_equal(VAR(Int, 7)));
+    EXPECT_TRUE(IntMinusOne2->add(IntMinusOne)->strictly_equal(VAR(Int, -2)));
+    EXPECT_TRUE(IntMinusOne2->add(IntMinusOne2)->strictly_equal(VAR(Int, -2)));
+    EXPECT_TRUE(IntMinusOne2->add(IntMinus12)->strictly_equal(VAR(Int, -13)));
+    EXPECT_TRUE(IntMinusOne2->add(IntMinus73)->strictly_equal(VAR(Int, -74)));
+    EXPECT_TRUE(IntMinusOne2->add(FloatMinusOne)->strictly_equal(VAR(Float, -2.0)));
+    EXPECT_TRUE(IntMinusOne2->add(FloatZero)->strictly_equal(VAR(Float, -1.0)));
+    EXPECT_TRUE(IntMinusOne2->add(FloatOne)->strictly_equal(VAR(Float, 0.0)));
+    EXPECT_TRUE(IntMinusOne2->add(FloatTwo)->strictly_equal(VAR(Float, 1.0)));
+    EXPECT_TRUE(IntMinusOne2->add(FloatTwo2)->strictly_equal(VAR(Float, 1.0)));
+    EXPECT_TRUE(IntMinusOne2->add(Float2_5)->strictly_equal(VAR(Float, 1.5)));
+    EXPECT_TRUE(IntMinusOne2->add(Float_23_74)->strictly_equal(VAR(Float, -24.74)));
+    EXPECT_ANY_THROW(IntMinusOne2->add(StrEmpty));
+    EXPECT_ANY_THROW(IntMinusOne2->add(StrEmpty2));
+    EXPECT_ANY_THROW(IntMinusOne2->add(StrA));
+    EXPECT_ANY_THROW(IntMinusOne2->add(StrA2));
+    EXPECT_ANY_THROW(IntMinusOne2->add(StrB));
+    EXPECT_ANY_THROW(IntMinusOne2->add(ListEmpty));
+    EXPECT_ANY_THROW(IntMinusOne2->add(ListEmpty2));
+    EXPECT_ANY_THROW(IntMinus12->add(None));
+    EXPECT_ANY_THROW(IntMinus12->add(None2));
+    EXPECT_TRUE(IntMinus12->add(False)->strictly_equal(VAR(Int, -12)));
+    EXPECT_TRUE(IntMinus12->add(False2)->strictly_equal(VAR(Int, -12)));
+    EXPECT_TRUE(IntMinus12->add(True)->strictly_equal(VAR(Int, -11)));
+    EXPECT_TRUE(IntMinus12->add(True2)->strictly_equal(VAR(Int, -11)));
+    EXPECT_TRUE(IntMinus12->add(IntZero)->strictly_equal(VAR(Int, -12)));
+    EXPECT_TRUE(IntMinus12->add(IntOne)->strictly_equal(VAR(Int, -11)));
+    EXPECT_TRUE(IntMinus12->add(IntTwo)->strictly_equal(VAR(Int, -10)));
+    EXPECT_TRUE(IntMinus12->add(IntTwo2)->strictly_equal(VAR(Int, -10)));
+    EXPECT_TRUE(IntMinus12->add(Int8)->strictly_equal(VAR(Int, -4)));
+    EXPECT_TRUE(IntMinus12->add(IntMinusOne)->strictly_equal(VAR(Int, -13)));
+    EXPECT_TRUE(IntMinus12->add(IntMinusOne2)->strictly_equal(VAR(Int, -13)));
+    EXPECT_TRUE(IntMinus12->add(IntMinus12)->strictly_equal(VAR(Int, -24)));
+    EXPECT_TRUE(IntMinus12->add(IntMinus73)->strictly_equal(VAR(Int, -85)));
+    EXPECT_TRUE(IntMinus12->add(FloatMinusOne)->strictly_equal(VAR(Float, -13.0)));
+    EXPECT_TRUE(IntMinus12->add(FloatZero)->strictly_equal(VAR(Float, -12.0)));
+    EXPECT_TRUE(IntMinus12->add(FloatOne)->strictly_equal(VAR(Float, -11.0)));
+    EXPECT_TRUE(IntMinus12->add(FloatTwo)->strictly_equal(VAR(Float, -10.0)));
+    EXPECT_TRUE(IntMinus12->add(FloatTwo2)->strictly_equal(VAR(Float, -10.0)));
+    EXPECT_TRUE(IntMinus12->add(Float2_5)->strictly_equal(VAR(Float, -9.5)));
+    EXPECT_TRUE(IntMinus12->add(Float_23_74)->strictly_equal(VAR(Float, -35.739999999999995)));
+    EXPECT_ANY_THROW(IntMinus12->add(StrEmpty));
+    EXPECT_ANY_THROW(IntMinus12->add(StrEmpty2));
+    EXPECT_ANY_THROW(IntMinus12->add(StrA));
+    EXPECT_ANY_THROW(IntMinus12->add(StrA2));
+    EXPECT_ANY_THROW(IntMinus12->add(StrB));
+    EXPECT_ANY_THROW(IntMinus12->add(ListEmpty));
+    EXPECT_ANY_THROW(IntMinus12->add(ListEmpty2));
+    EXPECT_ANY_THROW(IntMinus73->add(None));
+    EXPECT_ANY_THROW(IntMinus73->add(None2));
+    EXPECT_TRUE(IntMinus73->add(False)->strictly_equal(VAR(Int, -73)));
+    EXPECT_TRUE(IntMinus73->add(False2)->strictly_equal(VAR(Int, -73)));
+    EXPECT_TRUE(IntMinus73->add(True)->strictly_equal(VAR(Int, -72)));
+    EXPECT_TRUE(IntMinus73->add(True2)->strictly_equal(VAR(Int, -72)));
+    EXPECT_TRUE(IntMinus73->add(IntZero)->strictly_equal(VAR(Int, -73)));
+    EXPECT_TRUE(IntMinus73->add(IntOne)->strictly_equal(VAR(Int, -72)));
+    EXPECT_TRUE(IntMinus73->add(IntTwo)->strictly_equal(VAR(Int, -71)));
+    EXPECT_TRUE(IntMinus73->add(IntTwo2)->strictly_equal(VAR(Int, -71)));
+    EXPECT_TRUE(IntMinus73->add(Int8)->strictly_equal(VAR(Int, -65)));
+    EXPECT_TRUE(IntMinus73->add(IntMinusOne)->strictly_equal(VAR(Int, -74)));
+    EXPECT_TRUE(IntMinus73->add(IntMinusOne2)->strictly_equal(VAR(Int, -74)));
+    EXPECT_TRUE(IntMinus73->add(IntMinus12)->strictly_equal(VAR(Int, -85)));
+    EXPECT_TRUE(IntMinus73->add(IntMinus73)->strictly_equal(VAR(Int, -146)));
+    EXPECT_TRUE(IntMinus73->add(FloatMinusOne)->strictly_equal(VAR(Float, -74.0)));
+    EXPECT_TRUE(IntMinus73->add(FloatZero)->strictly_equal(VAR(Float, -73.0)));
+    EXPECT_TRUE(IntMinus73->add(FloatOne)->strictly_equal(VAR(Float, -72.0)));
+    EXPECT_TRUE(IntMinus73->add(FloatTwo)->strictly_equal(VAR(Float, -71.0)));
+    EXPECT_TRUE(IntMinus73->add(FloatTwo2)->strictly_equal(VAR(Float, -71.0)));
+    EXPECT_TRUE(IntMinus73->add(Float2_5)->strictly_equal(VAR(Float, -70.5)));
+    EXPECT_TRUE(IntMinus73->add(Float_23_74)->strictly_equal(VAR(Float, -96.74)));
+    EXPECT_ANY_THROW(IntMinus73->add(StrEmpty));
+    EXPECT_ANY_THROW(IntMinus73->add(StrEmpty2));
+    EXPECT_ANY_THROW(IntMinus73->add(StrA));
+    EXPECT_ANY_THROW(IntMinus73->add(StrA2));
+    EXPECT_ANY_THROW(IntMinus73->add(StrB));
+    EXPECT_ANY_THROW(IntMinus73->add(ListEmpty));
+    EXPECT_ANY_THROW(IntMinus73->add(ListEmpty2));
+    EXPECT_ANY_THROW(FloatMinusOne->add(None));
+    EXPECT_ANY_THROW(FloatMinusOne->add(None2));
+    EXPECT_TRUE(FloatMinusOne->add(False)->strictly_equal(VAR(Float, -1.0)));
+    EXPECT_TRUE(FloatMinusOne->add(False2)->strictly_equal(VAR(Float, -1.0)));
+    EXPECT_TRUE(FloatMinusOne->add(True)->strictly_equal(VAR(Float, 0.0)));
+    EXPECT_TRUE(FloatMinusOne->add(True2)->strictly_equal(VAR(Float, 0.0)));
+    EXPECT_TRUE(FloatMinusOne->add(IntZero)->strictly_equal(VAR(Float, -1.0)));
+    EXPECT_TRUE(FloatMinusOne->add(IntOne)->strictly_equal(VAR(Float, 0.0)));
+    EXPECT_TRUE(FloatMinusOne->add(IntTwo)->strictly_equal(VAR(Float, 1.0)));
+    EXPECT_TRUE(FloatMinusOne->add(IntTwo2)->strictly_equal(VAR(Float, 1.0)));
+    EXPECT_TRUE(FloatMinusOne->add(Int8)->strictly_equal(VAR(Float, 7.0)));
+    EXPECT_TRUE(FloatMinusOne->add(IntMinusOne)->strictly_equal(VAR(Float, -2.0)));
+    EXPECT_TRUE(FloatMinusOne->add(IntMinusOne2)->strictly_equal(VAR(Float, -2.0)));
+    EXPECT_TRUE(FloatMinusOne->add(IntMinus12)->strictly_equal(VAR(Float, -13.0)));
+    EXPECT_TRUE(FloatMinusOne->add(IntMinus73)->strictly_equal(VAR(Float, -74.0)));
+    EXPECT_TRUE(FloatMinusOne->add(FloatMinusOne)->strictly_equal(VAR(Float, -2.0)));
+    EXPECT_TRUE(FloatMinusOne->add(FloatZero)->strictly_equal(VAR(Float, -1.0)));
+    EXPECT_TRUE(FloatMinusOne->add(FloatOne)->strictly_equal(VAR(Float, 0.0)));
+    EXPECT_TRUE(FloatMinusOne->add(FloatTwo)->strictly_equal(VAR(Float, 1.0)));
+    EXPECT_TRUE(FloatMinusOne->add(FloatTwo2)->strictly_equal(VAR(Float, 1.0)));
+    EXPECT_TRUE(FloatMinusOne->add(Float2_5)->strictly_equal(VAR(Float, 1.5)));
+    EXPECT_TRUE(FloatMinusOne->add(Float_23_74)->strictly_equal(VAR(Float, -24.74)));
+    EXPECT_ANY_THROW(FloatMinusOne->add(StrEmpty));
+    EXPECT_ANY_THROW(FloatMinusOne->add(StrEmpty2));
+    EXPECT_ANY_THROW(FloatMinusOne->add(StrA));
+    EXPECT_ANY_THROW(FloatMinusOne->add(StrA2));
+    EXPECT_ANY_THROW(FloatMinusOne->add(StrB));
+    EXPECT_ANY_THROW(FloatMinusOne->add(ListEmpty));
+    EXPECT_ANY_THROW(FloatMinusOne->add(ListEmpty2));
+    EXPECT_ANY_THROW(FloatZero->add(None));
+    EXPECT_ANY_THROW(FloatZero->add(None2));
+    EXPECT_TRUE(FloatZero->add(False)->strictly_equal(VAR(Float, 0.0)));
+    EXPECT_TRUE(FloatZero->add(False2)->strictly_equal(VAR(Float, 0.0)));
+    EXPECT_TRUE(FloatZero->add(True)->strictly_equal(VAR(Float, 1.0)));
+    EXPECT_TRUE(FloatZero->add(True2)->strictly_equal(VAR(Float, 1.0)));
+    EXPECT_TRUE(FloatZero->add(IntZero)->strictly_equal(VAR(Float, 0.0)));
+    EXPECT_TRUE(FloatZero->add(IntOne)->strictly_equal(VAR(Float, 1.0)));
+    EXPECT_TRUE(FloatZero->add(IntTwo)->strictly_equal(VAR(Float, 2.0)));
+    EXPECT_TRUE(FloatZero->add(IntTwo2)->strictly_equal(VAR(Float, 2.0)));
+    EXPECT_TRUE(FloatZero->add(Int8)->strictly_equal(VAR(Float, 8.0)));
+    EXPECT_TRUE(FloatZero->add(IntMinusOne)->strictly_equal(VAR(Float, -1.0)));
+    EXPECT_TRUE(FloatZero->add(IntMinusOne2)->strictly_equal(VAR(Float, -1.0)));
+    EXPECT_TRUE(FloatZero->add(IntMinus12)->strictly_equal(VAR(Float, -12.0)));
+    EXPECT_TRUE(FloatZero->add(IntMinus73)->strictly_equal(VAR(Float, -73.0)));
+    EXPECT_TRUE(FloatZero->add(FloatMinusOne)->strictly_equal(VAR(Float, -1.0)));
+    EXPECT_TRUE(FloatZero->add(FloatZero)->strictly_equal(VAR(Float, 0.0)));
+    EXPECT_TRUE(FloatZero->add(FloatOne)->strictly_equal(VAR(Float, 1.0)));
+    EXPECT_TRUE(FloatZero->add(FloatTwo)->strictly_equal(VAR(Float, 2.0)));
+    EXPECT_TRUE(FloatZero->add(FloatTwo2)->strictly_equal(VAR(Float, 2.0)));
+    EXPECT_TRUE(FloatZero->add(Float2_5)->strictly_equal(VAR(Float, 2.5)));
+    EXPECT_TRUE(FloatZero->add(Float_23_74)->strictly_equal(VAR(Float, -23.74)));
+    EXPECT_ANY_THROW(FloatZero->add(StrEmpty));
+    EXPECT_ANY_THROW(FloatZero->add(StrEmpty2));
+    EXPECT_ANY_THROW(FloatZero->add(StrA));
+    EXPECT_ANY_THROW(FloatZero->add(StrA2));
+    EXPECT_ANY_THROW(FloatZero->add(StrB));
+    EXPECT_ANY_THROW(FloatZero->add(ListEmpty));
+    EXPECT_ANY_THROW(FloatZero->add(ListEmpty2));
+    EXPECT_ANY_THROW(FloatOne->add(None));
+    EXPECT_ANY_THROW(FloatOne->add(None2));
+    EXPECT_TRUE(FloatOne->add(False)->strictly_equal(VAR(Float, 1.0)));
+    EXPECT_TRUE(FloatOne->add(False2)->strictly_equal(VAR(Float, 1.0)));
+    EXPECT_TRUE(FloatOne->add(True)->strictly_equal(VAR(Float, 2.0)));
+    EXPECT_TRUE(FloatOne->add(True2)->strictly_equal(VAR(Float, 2.0)));
+    EXPECT_TRUE(FloatOne->add(IntZero)->strictly_equal(VAR(Float, 1.0)));
+    EXPECT_TRUE(FloatOne->add(IntOne)->strictly_equal(VAR(Float, 2.0)));
+    EXPECT_TRUE(FloatOne->add(IntTwo)->strictly_equal(VAR(Float, 3.0)));
+    EXPECT_TRUE(FloatOne->add(IntTwo2)->strictly_equal(VAR(Float, 3.0)));
+    EXPECT_TRUE(FloatOne->add(Int8)->strictly_equal(VAR(Float, 9.0)));
+    EXPECT_TRUE(FloatOne->add(IntMinusOne)->strictly_equal(VAR(Float, 0.0)));
+    EXPECT_TRUE(FloatOne->add(IntMinusOne2)->strictly_equal(VAR(Float, 0.0)));
+    EXPECT_TRUE(FloatOne->add(IntMinus12)->strictly_equal(VAR(Float, -11.0)));
+    EXPECT_TRUE(FloatOne->add(IntMinus73)->strictly_equal(VAR(Float, -72.0)));
+    EXPECT_TRUE(FloatOne->add(FloatMinusOne)->strictly_equal(VAR(Float, 0.0)));
+    EXPECT_TRUE(FloatOne->add(FloatZero)->strictly_equal(VAR(Float, 1.0)));
+    EXPECT_TRUE(FloatOne->add(FloatOne)->strictly_equal(VAR(Float, 2.0)));
+    EXPECT_TRUE(FloatOne->add(FloatTwo)->strictly_equal(VAR(Float, 3.0)));
+    EXPECT_TRUE(FloatOne->add(FloatTwo2)->strictly_equal(VAR(Float, 3.0)));
+    EXPECT_TRUE(FloatOne->add(Float2_5)->strictly_equal(VAR(Float, 3.5)));
+    EXPECT_TRUE(FloatOne->add(Float_23_74)->strictly_equal(VAR(Float, -22.74)));
+    EXPECT_ANY_THROW(FloatOne->add(StrEmpty));
+    EXPECT_ANY_THROW(FloatOne->add(StrEmpty2));
+    EXPECT_ANY_THROW(FloatOne->add(StrA));
+    EXPECT_ANY_THROW(FloatOne->add(StrA2));
+    EXPECT_ANY_THROW(FloatOne->add(StrB));
+    EXPECT_ANY_THROW(FloatOne->add(ListEmpty));
+    EXPECT_ANY_THROW(FloatOne->add(ListEmpty2));
+    EXPECT_ANY_THROW(FloatTwo->add(None));
+    EXPECT_ANY_THROW(FloatTwo->add(None2));
+    EXPECT_TRUE(FloatTwo->add(False)->strictly_equal(VAR(Float, 2.0)));
+    EXPECT_TRUE(FloatTwo->add(False2)->strictly_equal(VAR(Float, 2.0)));
+    EXPECT_TRUE(FloatTwo->add(True)->strictly_equal(VAR(Float, 3.0)));
+    EXPECT_TRUE(FloatTwo->add(True2)->strictly_equal(VAR(Float, 3.0)));
+    EXPECT_TRUE(FloatTwo->add(IntZero)->strictly_equal(VAR(Float, 2.0)));
+    EXPECT_TRUE(FloatTwo->add(IntOne)->strictly_equal(VAR(Float, 3.0)));
+    EXPECT_TRUE(FloatTwo->add(IntTwo)->strictly_equal(VAR(Float, 4.0)));
+    EXPECT_TRUE(FloatTwo->add(IntTwo2)->strictly_equal(VAR(Float, 4.0)));
+    EXPECT_TRUE(FloatTwo->add(Int8)->strictly_equal(VAR(Float, 10.0)));
+    EXPECT_TRUE(FloatTwo->add(IntMinusOne)->strictly_equal(VAR(Float, 1.0)));
+    EXPECT_TRUE(FloatTwo->add(IntMinusOne2)->strictly_equal(VAR(Float, 1.0)));
+    EXPECT_TRUE(FloatTwo->add(IntMinus12)->strictly_equal(VAR(Float, -10.0)));
+    EXPECT_TRUE(FloatTwo->add(IntMinus73)->strictly_equal(VAR(Float, -71.0)));
+    EXPECT_TRUE(FloatTwo->add(FloatMinusOne)->strictly_equal(VAR(Float, 1.0)));
+    EXPECT_TRUE(FloatTwo->add(FloatZero)->strictly_equal(VAR(Float, 2.0)));
+    EXPECT_TRUE(FloatTwo->add(FloatOne)->strictly_equal(VAR(Float, 3.0)));
+    EXPECT_TRUE(FloatTwo->add(FloatTwo)->strictly_equal(VAR(Float, 4.0)));
+    EXPECT_TRUE(FloatTwo->add(FloatTwo2)->strictly_equal(VAR(Float, 4.0)));
+    EXPECT_TRUE(FloatTwo->add(Float2_5)->strictly_equal(VAR(Float, 4.5)));
+    EXPECT_TRUE(FloatTwo->add(Float_23_74)->strictly_equal(VAR(Float, -21.74)));
+    EXPECT_ANY_THROW(FloatTwo->add(StrEmpty));
+    EXPECT_ANY_THROW(FloatTwo->add(StrEmpty2));
+    EXPECT_ANY_THROW(FloatTwo->add(StrA));
+    EXPECT_ANY_THROW(FloatTwo->add(StrA2));
+    EXPECT_ANY_THROW(FloatTwo->add(StrB));
+    EXPECT_ANY_THROW(FloatTwo->add(ListEmpty));
+    EXPECT_ANY_THROW(FloatTwo->add(ListEmpty2));
+    EXPECT_ANY_THROW(FloatTwo2->add(None));
+    EXPECT_ANY_THROW(FloatTwo2->add(None2));
+    EXPECT_TRUE(FloatTwo2->add(False)->strictly_equal(VAR(Float, 2.0)));
+    EXPECT_TRUE(FloatTwo2->add(False2)->strictly_equal(VAR(Float, 2.0)));
+    EXPECT_TRUE(FloatTwo2->add(True)->strictly_equal(VAR(Float, 3.0)));
+    EXPECT_TRUE(FloatTwo2->add(True2)->strictly_equal(VAR(Float, 3.0)));
+    EXPECT_TRUE(FloatTwo2->add(IntZero)->strictly_equal(VAR(Float, 2.0)));
+    EXPECT_TRUE(FloatTwo2->add(IntOne)->strictly_equal(VAR(Float, 3.0)));
+    EXPECT_TRUE(FloatTwo2->add(IntTwo)->strictly_equal(VAR(Float, 4.0)));
+    EXPECT_TRUE(FloatTwo2->add(IntTwo2)->strictly_equal(VAR(Float, 4.0)));
+    EXPECT_TRUE(FloatTwo2->add(Int8)->strictly_equal(VAR(Float, 10.0)));
+    EXPECT_TRUE(FloatTwo2->add(IntMinusOne)->strictly_equal(VAR(Float, 1.0)));
+    EXPECT_TRUE(FloatTwo2->add(IntMinusOne2)->strictly_equal(VAR(Float, 1.0)));
+    EXPECT_TRUE(FloatTwo2->add(IntMinus12)->strictly_equal(VAR(Float, -10.0)));
+    EXPECT_TRUE(FloatTwo2->add(IntMinus73)->strictly_equal(VAR(Float, -71.0)));
+    EXPECT_TRUE(FloatTwo2->add(FloatMinusOne)->strictly_equal(VAR(Float, 1.0)));
+    EXPECT_TRUE(FloatTwo2->add(FloatZero)->strictly_equal(VAR(Float, 2.0)));
+    EXPECT_TRUE(FloatTwo2->add(FloatOne)->strictly_equal(VAR(Float, 3.0)));
+    EXPECT_TRUE(FloatTwo2->add(FloatTwo)->strictly_equal(VAR(Float, 4.0)));
+    EXPECT_TRUE(FloatTwo2->add(FloatTwo2)->strictly_equal(VAR(Float, 4.0)));
+    EXPECT_TRUE(FloatTwo2->add(Float2_5)->strictly_equal(VAR(Float, 4.5)));
+    EXPECT_TRUE(FloatTwo2->add(Float_23_74)->strictly_equal(VAR(Float, -21.74)));
+    EXPECT_ANY_THROW(FloatTwo2->add(StrEmpty));
+    EXPECT_ANY_THROW(FloatTwo2->add(StrEmpty2));
+    EXPECT_ANY_THROW(FloatTwo2->add(StrA));
+    EXPECT_ANY_THROW(FloatTwo2->add(StrA2));
+    EXPECT_ANY_THROW(FloatTwo2->add(StrB));
+    EXPECT_ANY_THROW(FloatTwo2->add(ListEmpty));
+    EXPECT_ANY_THROW(FloatTwo2->add(ListEmpty2));
+    EXPECT_ANY_THROW(Float2_5->add(None));
+    EXPECT_ANY_THROW(Float2_5->add(None2));
+    EXPECT_TRUE(Float2_5->add(False)->strictly_equal(VAR(Float, 2.5)));
+    EXPECT_TRUE(Float2_5->add(False2)->strictly_equal(VAR(Float, 2.5)));
+    EXPECT_TRUE(Float2_5->add(True)->strictly_equal(VAR(Float, 3.5)));
+    EXPECT_TRUE(Float2_5->add(True2)->strictly_equal(VAR(Float, 3.5)));
+    EXPECT_TRUE(Float2_5->add(IntZero)->strictly_equal(VAR(Float, 2.5)));
+    EXPECT_TRUE(Float2_5->add(IntOne)->strictly_equal(VAR(Float, 3.5)));
+    EXPECT_TRUE(Float2_5->add(IntTwo)->strictly_equal(VAR(Float, 4.5)));
+    EXPECT_TRUE(Float2_5->add(IntTwo2)->strictly_equal(VAR(Float, 4.5)));
+    EXPECT_TRUE(Float2_5->add(Int8)->strictly_equal(VAR(Float, 10.5)));
+    EXPECT_TRUE(Float2_5->add(IntMinusOne)->strictly_equal(VAR(Float, 1.5)));
+    EXPECT_TRUE(Float2_5->add(IntMinusOne2)->strictly_equal(VAR(Float, 1.5)));
+    EXPECT_TRUE(Float2_5->add(IntMinus12)->strictly_equal(VAR(Float, -9.5)));
+    EXPECT_TRUE(Float2_5->add(IntMinus73)->strictly_equal(VAR(Float, -70.5)));
+    EXPECT_TRUE(Float2_5->add(FloatMinusOne)->strictly_equal(VAR(Float, 1.5)));
+    EXPECT_TRUE(Float2_5->add(FloatZero)->strictly_equal(VAR(Float, 2.5)));
+    EXPECT_TRUE(Float2_5->add(FloatOne)->strictly_equal(VAR(Float, 3.5)));
+    EXPECT_TRUE(Float2_5->add(FloatTwo)->strictly_equal(VAR(Float, 4.5)));
+    EXPECT_TRUE(Float2_5->add(FloatTwo2)->strictly_equal(VAR(Float, 4.5)));
+    EXPECT_TRUE(Float2_5->add(Float2_5)->strictly_equal(VAR(Float, 5.0)));
+    EXPECT_TRUE(Float2_5->add(Float_23_74)->strictly_equal(VAR(Float, -21.24)));
+    EXPECT_ANY_THROW(Float2_5->add(StrEmpty));
+    EXPECT_ANY_THROW(Float2_5->add(StrEmpty2));
+    EXPECT_ANY_THROW(Float2_5->add(StrA));
+    EXPECT_ANY_THROW(Float2_5->add(StrA2));
+    EXPECT_ANY_THROW(Float2_5->add(StrB));
+    EXPECT_ANY_THROW(Float2_5->add(ListEmpty));
+    EXPECT_ANY_THROW(Float2_5->add(ListEmpty2));
+    EXPECT_ANY_THROW(Float_23_74->add(None));
+    EXPECT_ANY_THROW(Float_23_74->add(None2));
+    EXPECT_TRUE(Float_23_74->add(False)->strictly_equal(VAR(Float, -23.74)));
+    EXPECT_TRUE(Float_23_74->add(False2)->strictly_equal(VAR(Float, -23.74)));
+    EXPECT_TRUE(Float_23_74->add(True)->strictly_equal(VAR(Float, -22.74)));
+    EXPECT_TRUE(Float_23_74->add(True2)->strictly_equal(VAR(Float, -22.74)));
+    EXPECT_TRUE(Float_23_74->add(IntZero)->strictly_equal(VAR(Float, -23.74)));
+    EXPECT_TRUE(Float_23_74->add(IntOne)->strictly_equal(VAR(Float, -22.74)));
+    EXPECT_TRUE(Float_23_74->add(IntTwo)->strictly_equal(VAR(Float, -21.74)));
+    EXPECT_TRUE(Float_23_74->add(IntTwo2)->strictly_equal(VAR(Float, -21.74)));
+    EXPECT_TRUE(Float_23_74->add(Int8)->strictly_equal(VAR(Float, -15.739999999999998)));
+    EXPECT_TRUE(Float_23_74->add(IntMinusOne)->strictly_equal(VAR(Float, -24.74)));
+    EXPECT_TRUE(Float_23_74->add(IntMinusOne2)->strictly_equal(VAR(Float, -24.74)));
+    EXPECT_TRUE(Float_23_74->add(IntMinus12)->strictly_equal(VAR(Float, -35.739999999999995)));
+    EXPECT_TRUE(Float_23_74->add(IntMinus73)->strictly_equal(VAR(Float, -96.74)));
+    EXPECT_TRUE(Float_23_74->add(FloatMinusOne)->strictly_equal(VAR(Float, -24.74)));
+    EXPECT_TRUE(Float_23_74->add(FloatZero)->strictly_equal(VAR(Float, -23.74)));
+    EXPECT_TRUE(Float_23_74->add(FloatOne)->strictly_equal(VAR(Float, -22.74)));
+    EXPECT_TRUE(Float_23_74->add(FloatTwo)->strictly_equal(VAR(Float, -21.74)));
+    EXPECT_TRUE(Float_23_74->add(FloatTwo2)->strictly_equal(VAR(Float, -21.74)));
+    EXPECT_TRUE(Float_23_74->add(Float2_5)->strictly_equal(VAR(Float, -21.24)));
+    EXPECT_TRUE(Float_23_74->add(Float_23_74)->strictly_equal(VAR(Float, -47.48)));
+    EXPECT_ANY_THROW(Float_23_74->add(StrEmpty));
+    EXPECT_ANY_THROW(Float_23_74->add(StrEmpty2));
+    EXPECT_ANY_THROW(Float_23_74->add(StrA));
+    EXPECT_ANY_THROW(Float_23_74->add(StrA2));
+    EXPECT_ANY_THROW(Float_23_74->add(StrB));
+    EXPECT_ANY_THROW(Float_23_74->add(ListEmpty));
+    EXPECT_ANY_THROW(Float_23_74->add(ListEmpty2));
+    EXPECT_ANY_THROW(StrEmpty->add(None));
+    EXPECT_ANY_THROW(StrEmpty->add(None2));
+    EXPECT_ANY_THROW(StrEmpty->add(False));
+    EXPECT_ANY_THROW(StrEmpty->add(False2));
+    EXPECT_ANY_THROW(StrEmpty->add(True));
+    EXPECT_ANY_THROW(StrEmpty->add(True2));
+    EXPECT_ANY_THROW(StrEmpty->add(IntZero));
+    EXPECT_ANY_THROW(StrEmpty->add(IntOne));
+    EXPECT_ANY_THROW(StrEmpty->add(IntTwo));
+    EXPECT_ANY_THROW(StrEmpty->add(IntTwo2));
+    EXPECT_ANY_THROW(StrEmpty->add(Int8));
+    EXPECT_ANY_THROW(StrEmpty->add(IntMinusOne));
+    EXPECT_ANY_THROW(StrEmpty->add(IntMinusOne2));
+    EXPECT_ANY_THROW(StrEmpty->add(IntMinus12));
+    EXPECT_ANY_THROW(StrEmpty->add(IntMinus73));
+    EXPECT_ANY_THROW(StrEmpty->add(FloatMinusOne));
+    EXPECT_ANY_THROW(StrEmpty->add(FloatZero));
+    EXPECT_ANY_THROW(StrEmpty->add(FloatOne));
+    EXPECT_ANY_THROW(StrEmpty->add(FloatTwo));
+    EXPECT_ANY_THROW(StrEmpty->add(FloatTwo2));
+    EXPECT_ANY_THROW(StrEmpty->add(Float2_5));
+    EXPECT_ANY_THROW(StrEmpty->add(Float_23_74));
+    EXPECT_TRUE(StrEmpty->add(StrEmpty)->strictly_equal(VAR(String, "")));
+    EXPECT_TRUE(StrEmpty->add(StrEmpty2)->strictly_equal(VAR(String, "")));
+    EXPECT_TRUE(StrEmpty->add(StrA)->strictly_equal(VAR(String, "some text")));
+    EXPECT_TRUE(StrEmpty->add(StrA2)->strictly_equal(VAR(String, "some text")));
+    EXPECT_TRUE(StrEmpty->add(StrB)->strictly_equal(VAR(String, "other text")));
+    EXPECT_ANY_THROW(StrEmpty->add(ListEmpty));
+    EXPECT_ANY_THROW(StrEmpty->add(ListEmpty2));
+    EXPECT_ANY_THROW(StrEmpty2->add(None));
+    EXPECT_ANY_THROW(StrEmpty2->add(None2));
+    EXPECT_ANY_THROW(StrEmpty2->add(False));
+    EXPECT_ANY_THROW(StrEmpty2->add(False2));
+    EXPECT_ANY_THROW(StrEmpty2->add(True));
+    EXPECT_ANY_THROW(StrEmpty2->add(True2));
+    EXPECT_ANY_THROW(StrEmpty2->add(IntZero));
+    EXPECT_ANY_THROW(StrEmpty2->add(IntOne));
+    EXPECT_ANY_THROW(StrEmpty2->add(IntTwo));
+    EXPECT_ANY_THROW(StrEmpty2->add(IntTwo2));
+    EXPECT_ANY_THROW(StrEmpty2->add(Int8));
+    EXPECT_ANY_THROW(StrEmpty2->add(IntMinusOne));
+    EXPECT_ANY_THROW(StrEmpty2->add(IntMinusOne2));
+    EXPECT_ANY_THROW(StrEmpty2->add(IntMinus12));
+    EXPECT_ANY_THROW(StrEmpty2->add(IntMinus73));
+    EXPECT_ANY_THROW(StrEmpty2->add(FloatMinusOne));
+    EXPECT_ANY_THROW(StrEmpty2->add(FloatZero));
+    EXPECT_ANY_THROW(StrEmpty2->add(FloatOne));
+    EXPECT_ANY_THROW(StrEmpty2->add(FloatTwo));
+    EXPECT_ANY_THROW(StrEmpty2->add(FloatTwo2));
+    EXPECT_ANY_THROW(StrEmpty2->add(Float2_5));
+    EXPECT_ANY_THROW(StrEmpty2->add(Float_23_74));
+    EXPECT_TRUE(StrEmpty2->add(StrEmpty)->strictly_equal(VAR(String, "")));
+    EXPECT_TRUE(StrEmpty2->add(StrEmpty2)->strictly_equal(VAR(String, "")));
+    EXPECT_TRUE(StrEmpty2->add(StrA)->strictly_equal(VAR(String, "some text")));
+    EXPECT_TRUE(StrEmpty2->add(StrA2)->strictly_equal(VAR(String, "some text")));
+    EXPECT_TRUE(StrEmpty2->add(StrB)->strictly_equal(VAR(String, "other text")));
+    EXPECT_ANY_THROW(StrEmpty2->add(ListEmpty));
+    EXPECT_ANY_THROW(StrEmpty2->add(ListEmpty2));
+    EXPECT_ANY_THROW(StrA->add(None));
+    EXPECT_ANY_THROW(StrA->add(None2));
+    EXPECT_ANY_THROW(StrA->add(False));
+    EXPECT_ANY_THROW(StrA->add(False2));
+    EXPECT_ANY_THROW(StrA->add(True));
+    EXPECT_ANY_THROW(StrA->add(True2));
+    EXPECT_ANY_THROW(StrA->add(IntZero));
+    EXPECT_ANY_THROW(StrA->add(IntOne));
+    EXPECT_ANY_THROW(StrA->add(IntTwo));
+    EXPECT_ANY_THROW(StrA->add(IntTwo2));
+    EXPECT_ANY_THROW(StrA->add(Int8));
+    EXPECT_ANY_THROW(StrA->add(IntMinusOne));
+    EXPECT_ANY_THROW(StrA->add(IntMinusOne2));
+    EXPECT_ANY_THROW(StrA->add(IntMinus12));
+    EXPECT_ANY_THROW(StrA->add(IntMinus73));
+    EXPECT_ANY_THROW(StrA->add(FloatMinusOne));
+    EXPECT_ANY_THROW(StrA->add(FloatZero));
+    EXPECT_ANY_THROW(StrA->add(FloatOne));
+    EXPECT_ANY_THROW(StrA->add(FloatTwo));
+    EXPECT_ANY_THROW(StrA->add(FloatTwo2));
+    EXPECT_ANY_THROW(StrA->add(Float2_5));
+    EXPECT_ANY_THROW(StrA->add(Float_23_74));
+    EXPECT_TRUE(StrA->add(StrEmpty)->strictly_equal(VAR(String, "some text")));
+    EXPECT_TRUE(StrA->add(StrEmpty2)->strictly_equal(VAR(String, "some text")));
+    EXPECT_TRUE(StrA->add(StrA)->strictly_equal(VAR(String, "some textsome text")));
+    EXPECT_TRUE(StrA->add(StrA2)->strictly_equal(VAR(String, "some textsome text")));
+    EXPECT_TRUE(StrA->add(StrB)->strictly_equal(VAR(String, "some textother text")));
+    EXPECT_ANY_THROW(StrA->add(ListEmpty));
+    EXPECT_ANY_THROW(StrA->add(ListEmpty2));
+    EXPECT_ANY_THROW(StrA2->add(None));
+    EXPECT_ANY_THROW(StrA2->add(None2));
+    EXPECT_ANY_THROW(StrA2->add(False));
+    EXPECT_ANY_THROW(StrA2->add(False2));
+    EXPECT_ANY_THROW(StrA2->add(True));
+    EXPECT_ANY_THROW(StrA2->add(True2));
+    EXPECT_ANY_THROW(StrA2->add(IntZero));
+    EXPECT_ANY_THROW(StrA2->add(IntOne));
+    EXPECT_ANY_THROW(StrA2->add(IntTwo));
+    EXPECT_ANY_THROW(StrA2->add(IntTwo2));
+    EXPECT_ANY_THROW(StrA2->add(Int8));
+    EXPECT_ANY_THROW(StrA2->add(IntMinusOne));
+    EXPECT_ANY_THROW(StrA2->add(IntMinusOne2));
+    EXPECT_ANY_THROW(StrA2->add(IntMinus12));
+    EXPECT_ANY_THROW(StrA2->add(IntMinus73));
+    EXPECT_ANY_THROW(StrA2->add(FloatMinusOne));
+    EXPECT_ANY_THROW(StrA2->add(FloatZero));
+    EXPECT_ANY_THROW(StrA2->add(FloatOne));
+    EXPECT_ANY_THROW(StrA2->add(FloatTwo));
+    EXPECT_ANY_THROW(StrA2->add(FloatTwo2));
+    EXPECT_ANY_THROW(StrA2->add(Float2_5));
+    EXPECT_ANY_THROW(StrA2->add(Float_23_74));
+    EXPECT_TRUE(StrA2->add(StrEmpty)->strictly_equal(VAR(String, "some text")));
+    EXPECT_TRUE(StrA2->add(StrEmpty2)->strictly_equal(VAR(String, "some text")));
+    EXPECT_TRUE(StrA2->add(StrA)->strictly_equal(VAR(String, "some textsome text")));
+    EXPECT_TRUE(StrA2->add(StrA2)->strictly_equal(VAR(String, "some textsome text")));
+    EXPECT_TRUE(StrA2->add(StrB)->strictly_equal(VAR(String, "some textother text")));
+    EXPECT_ANY_THROW(StrA2->add(ListEmpty));
+    EXPECT_ANY_THROW(StrA2->add(ListEmpty2));
+    EXPECT_ANY_THROW(StrB->add(None));
+    EXPECT_ANY_THROW(StrB->add(None2));
+    EXPECT_ANY_THROW(StrB->add(False));
+    EXPECT_ANY_THROW(StrB->add(False2));
+    EXPECT_ANY_THROW(StrB->add(True));
+    EXPECT_ANY_THROW(StrB->add(True2));
+    EXPECT_ANY_THROW(StrB->add(IntZero));
+    EXPECT_ANY_THROW(StrB->add(IntOne));
+    EXPECT_ANY_THROW(StrB->add(IntTwo));
+    EXPECT_ANY_THROW(StrB->add(IntTwo2));
+    EXPECT_ANY_THROW(StrB->add(Int8));
+    EXPECT_ANY_THROW(StrB->add(IntMinusOne));
+    EXPECT_ANY_THROW(StrB->add(IntMinusOne2));
+    EXPECT_ANY_THROW(StrB->add(IntMinus12));
+    EXPECT_ANY_THROW(StrB->add(IntMinus73));
+    EXPECT_ANY_THROW(StrB->add(FloatMinusOne));
+    EXPECT_ANY_THROW(StrB->add(FloatZero));
+    EXPECT_ANY_THROW(StrB->add(FloatOne));
+    EXPECT_ANY_THROW(StrB->add(FloatTwo));
+    EXPECT_ANY_THROW(StrB->add(FloatTwo2));
+    EXPECT_ANY_THROW(StrB->add(Float2_5));
+    EXPECT_ANY_THROW(StrB->add(Float_23_74));
+    EXPECT_TRUE(StrB->add(StrEmpty)->strictly_equal(VAR(String, "other text")));
+    EXPECT_TRUE(StrB->add(StrEmpty2)->strictly_equal(VAR(String, "other text")));
+    EXPECT_TRUE(StrB->add(StrA)->strictly_equal(VAR(String, "other textsome text")));
+    EXPECT_TRUE(StrB->add(StrA2)->strictly_equal(VAR(String, "other textsome text")));
+    EXPECT_TRUE(StrB->add(StrB)->strictly_equal(VAR(String, "other textother text")));
+    EXPECT_ANY_THROW(StrB->add(ListEmpty));
+    EXPECT_ANY_THROW(StrB->add(ListEmpty2));
+    EXPECT_ANY_THROW(ListEmpty->add(None));
+    EXPECT_ANY_THROW(ListEmpty->add(None2));
+    EXPECT_ANY_THROW(ListEmpty->add(False));
+    EXPECT_ANY_THROW(ListEmpty->add(False2));
+    EXPECT_ANY_THROW(ListEmpty->add(True));
+    EXPECT_ANY_THROW(ListEmpty->add(True2));
+    EXPECT_ANY_THROW(ListEmpty->add(IntZero));
+    EXPECT_ANY_THROW(ListEmpty->add(IntOne));
+    EXPECT_ANY_THROW(ListEmpty->add(IntTwo));
+    EXPECT_ANY_THROW(ListEmpty->add(IntTwo2));
+    EXPECT_ANY_THROW(ListEmpty->add(Int8));
+    EXPECT_ANY_THROW(ListEmpty->add(IntMinusOne));
+    EXPECT_ANY_THROW(ListEmpty->add(IntMinusOne2));
+    EXPECT_ANY_THROW(ListEmpty->add(IntMinus12));
+    EXPECT_ANY_THROW(ListEmpty->add(IntMinus73));
+    EXPECT_ANY_THROW(ListEmpty->add(FloatMinusOne));
+    EXPECT_ANY_THROW(ListEmpty->add(FloatZero));
+    EXPECT_ANY_THROW(ListEmpty->add(FloatOne));
+    EXPECT_ANY_THROW(ListEmpty->add(FloatTwo));
+    EXPECT_ANY_THROW(ListEmpty->add(FloatTwo2));
+    EXPECT_ANY_THROW(ListEmpty->add(Float2_5));
+    EXPECT_ANY_THROW(ListEmpty->add(Float_23_74));
+    EXPECT_ANY_THROW(ListEmpty->add(StrEmpty));
+    EXPECT_ANY_THROW(ListEmpty->add(StrEmpty2));
+    EXPECT_ANY_THROW(ListEmpty->add(StrA));
+    EXPECT_ANY_THROW(ListEmpty->add(StrA2));
+    EXPECT_ANY_THROW(ListEmpty->add(StrB));
+    EXPECT_TRUE(ListEmpty->add(ListEmpty)->strictly_equal(VAR(List, ListType())));
+    EXPECT_TRUE(ListEmpty->add(ListEmpty2)->strictly_equal(VAR(List, ListType())));
+    EXPECT_ANY_THROW(ListEmpty2->add(None));
+    EXPECT_ANY_THROW(ListEmpty2->add(None2));
+    EXPECT_ANY_THROW(ListEmpty2->add(False));
+    EXPECT_ANY_THROW(ListEmpty2->add(False2));
+    EXPECT_ANY_THROW(ListEmpty2->add(True));
+    EXPECT_ANY_THROW(ListEmpty2->add(True2));
+    EXPECT_ANY_THROW(ListEmpty2->add(IntZero));
+    EXPECT_ANY_THROW(ListEmpty2->add(IntOne));
+    EXPECT_ANY_THROW(ListEmpty2->add(IntTwo));
+    EXPECT_ANY_THROW(ListEmpty2->add(IntTwo2));
+    EXPECT_ANY_THROW(ListEmpty2->add(Int8));
+    EXPECT_ANY_THROW(ListEmpty2->add(IntMinusOne));
+    EXPECT_ANY_THROW(ListEmpty2->add(IntMinusOne2));
+    EXPECT_ANY_THROW(ListEmpty2->add(IntMinus12));
+    EXPECT_ANY_THROW(ListEmpty2->add(IntMinus73));
+    EXPECT_ANY_THROW(ListEmpty2->add(FloatMinusOne));
+    EXPECT_ANY_THROW(ListEmpty2->add(FloatZero));
+    EXPECT_ANY_THROW(ListEmpty2->add(FloatOne));
+    EXPECT_ANY_THROW(ListEmpty2->add(FloatTwo));
+    EXPECT_ANY_THROW(ListEmpty2->add(FloatTwo2));
+    EXPECT_ANY_THROW(ListEmpty2->add(Float2_5));
+    EXPECT_ANY_THROW(ListEmpty2->add(Float_23_74));
+    EXPECT_ANY_THROW(ListEmpty2->add(StrEmpty));
+    EXPECT_ANY_THROW(ListEmpty2->add(StrEmpty2));
+    EXPECT_ANY_THROW(ListEmpty2->add(StrA));
+    EXPECT_ANY_THROW(ListEmpty2->add(StrA2));
+    EXPECT_ANY_THROW(ListEmpty2->add(StrB));
+    EXPECT_TRUE(ListEmpty2->add(ListEmpty)->strictly_equal(VAR(List, ListType())));
+    EXPECT_TRUE(ListEmpty2->add(ListEmpty2)->strictly_equal(VAR(List, ListType())));
+}
@@ -0,0 +1,969 @@
+
+#include "variable/Variable.h"
+
+#include "Test.h"
+
+#define VAR(TYPE, VALUE) \
+    std::static_pointer_cast<GenericVariable>(std::make_shared<TYPE ## Variable>(VALUE))
+
+enum class OpReturningVar {
+    add,
+    sub,
+    mul,
+    div,
+    int_div,
+    pow,
+    mod,
+};
+
+enum class AssertResult {
+    PASS,
+    FAIL,
+    EXCEPTION,
+};
+
+static std::ostream& operator<< (std::ostream& os, AssertResult res) {
+    switch (res) {
+    case AssertResult::PASS:       os << "PASS";      break;
+    case AssertResult::FAIL:       os << "FAIL";      break;
+    case AssertResult::EXCEPTION:  os << "EXCEPTION"; break;
+    default:                       os << "???";
+    }
+    return os;
+}
+
+static Variable doOpReturningVar(Variable arg1, Variable arg2, OpReturningVar op) {
+    switch(op) {
+    case OpReturningVar::add: return arg1->add(arg2);
+    case OpReturningVar::sub: return arg1->sub(arg2);
+    case OpReturningVar::mul: return arg1->mul(arg2);
+    case OpReturningVar::div: return arg1->div(arg2);
+    case OpReturningVar::int_div: return arg1->int_div(arg2);
+    case OpReturningVar::mod: return arg1->mod(arg2);
+    case OpReturningVar::pow: return arg1->pow(arg2);
+    default: throw std::runtime_error("Bad op");
+    }
+}
+
+static void doOpReturningVarAndCompareResult(Variable arg1, Variable arg2, OpReturningVar op, Variable expected_res, AssertResult a_res, const char *descr) {
+    try {
+        auto res_var = doOpReturningVar(arg1, arg2, op);
+        auto assertion_result = res_var->strictly_equal(expected_res) ? AssertResult::PASS : AssertResult::FAIL;
+        if (assertion_result != a_res) {
+            std::cerr << descr << " returned " << assertion_result << " instead of " << a_res << "\n";
+        }
+    }
+    catch(...) {
+        if (a_res != AssertResult::EXCEPTION) {
+            std::cerr << descr << " returned EXCEPTION instead of " << a_res << "\n";
+        }
+    }
+}
+
+enum class OpReturningBool {
+    equal,
+    less,
+};
+
+static bool doOpReturningBool(Variable arg1, Variable arg2, OpReturningBool op) {
+    switch(op) {
+    case OpReturningBool::equal: return arg1->equal(arg2);
+    case OpReturningBool::less: return arg1->less(arg2);
+    default: throw std::runtime_error("Bad op");
+    }
+}
+
+static void doOpReturningBoolAndCompareResult(Variable arg1, Variable arg2, OpReturningBool op, bool expected_res, AssertResult a_res, const char *descr) {
+    try {
+        auto assertion_result = doOpReturningBool(arg1, arg2, op) ? AssertResult::PASS : AssertResult::FAIL;
+        if (assertion_result != a_res) {
+            std::cerr << descr << " returned " << assertion_result << " instead of " << a_res << "\n";
+        }
+    }
+    catch(...) {
+        if (a_res != AssertResult::EXCEPTION) {
+            std::cerr << descr << " returned EXCEPTION instead of " << a_res << "\n";
+        }
+    }
+}
+
+static auto None = std::static_pointer_cast<GenericVariable>(std::make_shared<NoneVariable>());
+static auto None2 = std::static_pointer_cast<GenericVariable>(std::make_shared<NoneVariable>());
+static auto False = VAR(Bool, false);
+static auto False2 = VAR(Bool, false);
+static auto True = VAR(Bool, true);
+static auto True2 = VAR(Bool, true);
+static auto IntZero = VAR(Int, 0);
+static auto IntOne = VAR(Int, 1);
+static auto IntTwo = VAR(Int, 2);
+static auto IntTwo2 = VAR(Int, 2);
+static auto Int8 = VAR(Int, 8);
+static auto IntMinusOne = VAR(Int, -1);
+static auto IntMinusOne2 = VAR(Int, -1);
+static auto IntMinus12 = VAR(Int, -12);
+static auto IntMinus73 = VAR(Int, -73);
+static auto FloatMinusOne = VAR(Float, -1);
+static auto FloatZero = VAR(Float, 0);
+static auto FloatOne = VAR(Float, 1);
+static auto FloatTwo = VAR(Float, 2);
+static auto FloatTwo2 = VAR(Float, 2);
+static auto Float2_5 = VAR(Float, 2.5);
+static auto Float_23_74 = VAR(Float, -23.74);
+static auto StrEmpty = VAR(String, "");
+static auto StrEmpty2 = VAR(String, "");
+static auto StrA = VAR(String, "some text");
+static auto StrA2 = VAR(String, "some text");
+static auto StrB = VAR(String, "other text");
+static auto ListEmpty = VAR(List, ListType());
+static auto ListEmpty2 = VAR(List, ListType());
+
+#include "variable/Variable.h"
+
+#include <gtest/gtest.h>
+
+class VariableDivTest: public testing::Test {
+};
+
+TEST_F(VariableDivTest, VariableDivTest) {
+    EXPECT_ANY_THROW(None->div(None));
+    EXPECT_ANY_THROW(None->div(None2));
+    EXPECT_ANY_THROW(None->div(False));
+    EXPECT_ANY_THROW(None->div(False2));
+    EXPECT_ANY_THROW(None->div(True));
+    EXPECT_ANY_THROW(None->div(True2));
+    EXPECT_ANY_THROW(None->div(IntZero));
+    EXPECT_ANY_THROW(None->div(IntOne));
+    EXPECT_ANY_THROW(None->div(IntTwo));
+    EXPECT_ANY_THROW(None->div(IntTwo2));
+    EXPECT_ANY_THROW(None->div(Int8));
+    EXPECT_ANY_THROW(None->div(IntMinusOne));
+    EXPECT_ANY_THROW(None->div(IntMinusOne2));
+    EXPECT_ANY_THROW(None->div(IntMinus12));
+    EXPECT_ANY_THROW(None->div(IntMinus73));
+    EXPECT_ANY_THROW(None->div(FloatMinusOne));
+    EXPECT_ANY_THROW(None->div(FloatZero));
+    EXPECT_ANY_THROW(None->div(FloatOne));
+    EXPECT_ANY_THROW(None->div(FloatTwo));
+    EXPECT_ANY_THROW(None->div(FloatTwo2));
+    EXPECT_ANY_THROW(None->div(Float2_5));
+    EXPECT_ANY_THROW(None->div(Float_23_74));
+    EXPECT_ANY_THROW(None->div(StrEmpty));
+    EXPECT_ANY_THROW(None->div(StrEmpty2));
+    EXPECT_ANY_THROW(None->div(StrA));
+    EXPECT_ANY_THROW(None->div(StrA2));
+    EXPECT_ANY_THROW(None->div(StrB));
+    EXPECT_ANY_THROW(None->div(ListEmpty));
+    EXPECT_ANY_THROW(None->div(ListEmpty2));
+    EXPECT_ANY_THROW(None2->div(None));
+    EXPECT_ANY_THROW(None2->div(None2));
+    EXPECT_ANY_THROW(None2->div(False));
+    EXPECT_ANY_THROW(None2->div(False2));
+    EXPECT_ANY_THROW(None2->div(True));
+    EXPECT_ANY_THROW(None2->div(True2));
+    EXPECT_ANY_THROW(None2->div(IntZero));
+    EXPECT_ANY_THROW(None2->div(IntOne));
+    EXPECT_ANY_THROW(None2->div(IntTwo));
+    EXPECT_ANY_THROW(None2->div(IntTwo2));
+    EXPECT_ANY_THROW(None2->div(Int8));
+    EXPECT_ANY_THROW(None2->div(IntMinusOne));
+    EXPECT_ANY_THROW(None2->div(IntMinusOne2));
+    EXPECT_ANY_THROW(None2->div(IntMinus12));
+    EXPECT_ANY_THROW(None2->div(IntMinus73));
+    EXPECT_ANY_THROW(None2->div(FloatMinusOne));
+    EXPECT_ANY_THROW(None2->div(FloatZero));
+    EXPECT_ANY_THROW(None2->div(FloatOne));
+    EXPECT_ANY_THROW(None2->div(FloatTwo));
+    EXPECT_ANY_THROW(None2->div(FloatTwo2));
+    EXPECT_ANY_THROW(None2->div(Float2_5));
+    EXPECT_ANY_THROW(None2->div(Float_23_74));
+    EXPECT_ANY_THROW(None2->div(StrEmpty));
+    EXPECT_ANY_THROW(None2->div(StrEmpty2));
+    EXPECT_ANY_THROW(None2->div(StrA));
+    EXPECT_ANY_THROW(None2->div(StrA2));
+    EXPECT_ANY_THROW(None2->div(StrB));
+    EXPECT_ANY_THROW(None2->div(ListEmpty));
+    EXPECT_ANY_THROW(None2->div(ListEmpty2));
+    EXPECT_ANY_THROW(False->div(None));
+    EXPECT_ANY_THROW(False->div(None2));
+    EXPECT_ANY_THROW(False->div(False));
+    EXPECT_ANY_THROW(False->div(False2));
+    EXPECT_TRUE(False->div(True)->strictly_equal(VAR(Float, 0.0)));
+    EXPECT_TRUE(False->div(True2)->strictly_equal(VAR(Float, 0.0)));
+    EXPECT_ANY_THROW(False->div(IntZero));
+    EXPECT_TRUE(False->div(IntOne)->strictly_equal(VAR(Float, 0.0)));
+    EXPECT_TRUE(False->div(IntTwo)->strictly_equal(VAR(Float, 0.0)));
+    EXPECT_TRUE(False->div(IntTwo2)->strictly_equal(VAR(Float, 0.0)));
+    EXPECT_TRUE(False->div(Int8)->strictly_equal(VAR(Float, 0.0)));
+    EXPECT_TRUE(False->div(IntMinusOne)->strictly_equal(VAR(Float, -0.0)));
+    EXPECT_TRUE(False->div(IntMinusOne2)->strictly_equal(VAR(Float, -0.0)));
+    EXPECT_TRUE(False->div(IntMinus12)->strictly_equal(VAR(Float, -0.0)));
+    EXPECT_TRUE(False->div(IntMinus73)->strictly_equal(VAR(Float, -0.0)));
+    EXPECT_TRUE(False->div(FloatMinusOne)->strictly_equal(VAR(Float, -0.0)));
+    EXPECT_ANY_THROW(False->div(FloatZero));
+    EXPECT_TRUE(False->div(FloatOne)->strictly_equal(VAR(Float, 0.0)));
+    EXPECT_TRUE(False->div(FloatTwo)->strictly_equal(VAR(Float, 0.0)));
+    EXPECT_TRUE(False->div(FloatTwo2)->strictly_equal(VAR(Float, 0.0)));
+    EXPECT_TRUE(False->div(Float2_5)->strictly_equal(VAR(Float, 0.0)));
+    EXPECT_TRUE(False->div(Float_23_74)->strictly_equal(VAR(Float, -0.0)));
+    EXPECT_ANY_THROW(False->div(StrEmpty));
+    EXPECT_ANY_THROW(False->div(StrEmpty2));
+    EXPECT_ANY_THROW(False->div(StrA));
+    EXPECT_ANY_THROW(False->div(StrA2));
+    EXPECT_ANY_THROW(False->div(StrB));
+    EXPECT_ANY_THROW(False->div(ListEmpty));
+    EXPECT_ANY_THROW(False->div(ListEmpty2));
+    EXPECT_ANY_THROW(False2->div(None));
+    EXPECT_ANY_THROW(False2->div(None2));
+    EXPECT_ANY_THROW(False2->div(False));
+    EXPECT_ANY_THROW(False2->div(False2));
+    EXPECT_TRUE(False2->div(True)->strictly_equal(VAR(Float, 0.0)));
+    EXPECT_TRUE(False2->div(True2)->strictly_equal(VAR(Float, 0.0)));
+    EXPECT_ANY_THROW(False2->div(IntZero));
+    EXPECT_TRUE(False2->div(IntOne)->strictly_equal(VAR(Float, 0.0)));
+    EXPECT_TRUE(False2->div(IntTwo)->strictly_equal(VAR(Float, 0.0)));
+    EXPECT_TRUE(False2->div(IntTwo2)->strictly_equal(VAR(Float, 0.0)));
+    EXPECT_TRUE(False2->div(Int8)->strictly_equal(VAR(Float, 0.0)));
+    EXPECT_TRUE(False2->div(IntMinusOne)->strictly_equal(VAR(Float, -0.0)));
+    EXPECT_TRUE(False2->div(IntMinusOne2)->strictly_equal(VAR(Float, -0.0)));
+    EXPECT_TRUE(False2->div(IntMinus12)->strictly_equal(VAR(Float, -0.0)));
+    EXPECT_TRUE(False2->div(IntMinus73)->strictly_equal(VAR(Float, -0.0)));
+    EXPECT_TRUE(False2->div(FloatMinusOne)->strictly_equal(VAR(Float, -0.0)));
+    EXPECT_ANY_THROW(False2->div(FloatZero));
+    EXPECT_TRUE(False2->div(FloatOne)->strictly_equal(VAR(Float, 0.0)));
+    EXPECT_TRUE(False2->div(FloatTwo)->strictly_equal(VAR(Float, 0.0)));
+    EXPECT_TRUE(False2->div(FloatTwo2)->strictly_equal(VAR(Float, 0.0)));
+    EXPECT_TRUE(False2->div(Float2_5)->strictly_equal(VAR(Float, 0.0)));
+    EXPECT_TRUE(False2->div(Float_23_74)->strictly_equal(VAR(Float, -0.0)));
+    EXPECT_ANY_THROW(False2->div(StrEmpty));
+    EXPECT_ANY_THROW(False2->div(StrEmpty2));
+    EXPECT_ANY_THROW(False2->div(StrA));
+    EXPECT_ANY_THROW(False2->div(StrA2));
+    EXPECT_ANY_THROW(False2->div(StrB));
+    EXPECT_ANY_THROW(False2->div(ListEmpty));
+    EXPECT_ANY_THROW(False2->div(ListEmpty2));
+    EXPECT_ANY_THROW(True->div(None));
+    EXPECT_ANY_THROW(True->div(None2));
+    EXPECT_ANY_THROW(True->div(False));
+    EXPECT_ANY_THROW(True->div(False2));
+    EXPECT_TRUE(True->div(True)->strictly_equal(VAR(Float, 1.0)));
+    EXPECT_TRUE(True->div(True2)->strictly_equal(VAR(Float, 1.0)));
+    EXPECT_ANY_THROW(True->div(IntZero));
+    EXPECT_TRUE(True->div(IntOne)->strictly_equal(VAR(Float, 1.0)));
+    EXPECT_TRUE(True->div(IntTwo)->strictly_equal(VAR(Float, 0.5)));
+    EXPECT_TRUE(True->div(IntTwo2)->strictly_equal(VAR(Float, 0.5)));
+    EXPECT_TRUE(True->div(Int8)->strictly_equal(VAR(Float, 0.125)));
+    EXPECT_TRUE(True->div(IntMinusOne)->strictly_equal(VAR(Float, -1.0)));
+    EXPECT_TRUE(True->div(IntMinusOne2)->strictly_equal(VAR(Float, -1.0)));
+    EXPECT_TRUE(True->div(IntMinus12)->strictly_equal(VAR(Float, -0.08333333333333333)));
+    EXPECT_TRUE(True->div(IntMinus73)->strictly_equal(VAR(Float, -0.0136986301369863)));
+    EXPECT_TRUE(True->div(FloatMinusOne)->strictly_equal(VAR(Float, -1.0)));
+    EXPECT_ANY_THROW(True->div(FloatZero));
+    EXPECT_TRUE(True->div(FloatOne)->strictly_equal(VAR(Float, 1.0)));
+    EXPECT_TRUE(True->div(FloatTwo)->strictly_equal(VAR(Float, 0.5)));
+    EXPECT_TRUE(True->div(FloatTwo2)->strictly_equal(VAR(Float, 0.5)));
+    EXPECT_TRUE(True->div(Float2_5)->strictly_equal(VAR(Float, 0.4)));
+    EXPECT_TRUE(True->div(Float_23_74)->strictly_equal(VAR(Float, -0.04212299915754002)));
+    EXPECT_ANY_THROW(True->div(StrEmpty));
+    EXPECT_ANY_THROW(True->div(StrEmpty2));
+    EXPECT_ANY_THROW(True->div(StrA));
+    EXPECT_ANY_THROW(True->div(StrA2));
+    EXPECT_ANY_THROW(True->div(StrB));
+    EXPECT_ANY_THROW(True->div(ListEmpty));
+    EXPECT_ANY_THROW(True->div(ListEmpty2));
+    EXPECT_ANY_THROW(True2->div(None));
+    EXPECT_ANY_THROW(True2->div(None2));
+    EXPECT_ANY_THROW(True2->div(False));
+    EXPECT_ANY_THROW(True2->div(False2));
+    EXPECT_TRUE(True2->div(True)->strictly_equal(VAR(Float, 1.0)));
+    EXPECT_TRUE(True2->div(True2)->strictly_equal(VAR(Float, 1.0)));
+    EXPECT_ANY_THROW(True2->div(IntZero));
+    EXPECT_TRUE(True2->div(IntOne)->strictly_equal(VAR(Float, 1.0)));
+    EXPECT_TRUE(True2->div(IntTwo)->strictly_equal(VAR(Float, 0.5)));
+    EXPECT_TRUE(True2->div(IntTwo2)->strictly_equal(VAR(Float, 0.5)));
+    EXPECT_TRUE(True2->div(Int8)->strictly_equal(VAR(Float, 0.125)));
+    EXPECT_TRUE(True2->div(IntMinusOne)->strictly_equal(VAR(Float, -1.0)));
+    EXPECT_TRUE(True2->div(IntMinusOne2)->strictly_equal(VAR(Float, -1.0)));
+    EXPECT_TRUE(True2->div(IntMinus12)->strictly_equal(VAR(Float, -0.08333333333333333)));
+    EXPECT_TRUE(True2->div(IntMinus73)->strictly_equal(VAR(Float, -0.0136986301369863)));
+    EXPECT_TRUE(True2->div(FloatMinusOne)->strictly_equal(VAR(Float, -1.0)));
+    EXPECT_ANY_THROW(True2->div(FloatZero));
+    EXPECT_TRUE(True2->div(FloatOne)->strictly_equal(VAR(Float, 1.0)));
+    EXPECT_TRUE(True2->div(FloatTwo)->strictly_equal(VAR(Float, 0.5)));
+    EXPECT_TRUE(True2->div(FloatTwo2)->strictly_equal(VAR(Float, 0.5)));
+    EXPECT_TRUE(True2->div(Float2_5)->strictly_equal(VAR(Float, 0.4)));
+    EXPECT_TRUE(True2->div(Float_23_74)->strictly_equal(VAR(Float, -0.04212299915754002)));
+    EXPECT_ANY_THROW(True2->div(StrEmpty));
+    EXPECT_ANY_THROW(True2->div(StrEmpty2));
+    EXPECT_ANY_THROW(True2->div(StrA));
+    EXPECT_ANY_THROW(True2->div(StrA2));
+    EXPECT_ANY_THROW(True2->div(StrB));
+    EXPECT_ANY_THROW(True2->div(ListEmpty));
+    EXPECT_ANY_THROW(True2->div(ListEmpty2));
+    EXPECT_ANY_THROW(IntZero->div(None));
+    EXPECT_ANY_THROW(IntZero->div(None2));
+    EXPECT_ANY_THROW(IntZero->div(False));
+    EXPECT_ANY_THROW(IntZero->div(False2));
+    EXPECT_TRUE(IntZero->div(True)->strictly_equal(VAR(Float, 0.0)));
+    EXPECT_TRUE(IntZero->div(True2)->strictly_equal(VAR(Float, 0.0)));
+    EXPECT_ANY_THROW(IntZero->div(IntZero));
+    EXPECT_TRUE(IntZero->div(IntOne)->strictly_equal(VAR(Float, 0.0)));
+    EXPECT_TRUE(IntZero->div(IntTwo)->strictly_equal(VAR(Float, 0.0)));
+    EXPECT_TRUE(IntZero->div(IntTwo2)->strictly_equal(VAR(Float, 0.0)));
+    EXPECT_TRUE(IntZero->div(Int8)->strictly_equal(VAR(Float, 0.0)));
+    EXPECT_TRUE(IntZero->div(IntMinusOne)->strictly_equal(VAR(Float, -0.0)));
+    EXPECT_TRUE(IntZero->div(IntMinusOne2)->strictly_equal(VAR(Float, -0.0)));
+    EXPECT_TRUE(IntZero->div(IntMinus12)->strictly_equal(VAR(Float, -0.0)));
+    EXPECT_TRUE(IntZero->div(IntMinus73)->strictly_equal(VAR(Float, -0.0)));
+    EXPECT_TRUE(IntZero->div(FloatMinusOne)->strictly_equal(VAR(Float, -0.0)));
+    EXPECT_ANY_THROW(IntZero->div(FloatZero));
+    EXPECT_TRUE(IntZero->div(FloatOne)->strictly_equal(VAR(Float, 0.0)));
+    EXPECT_TRUE(IntZero->div(FloatTwo)->strictly_equal(VAR(Float, 0.0)));
+    EXPECT_TRUE(IntZero->div(FloatTwo2)->strictly_equal(VAR(Float, 0.0)));
+    EXPECT_TRUE(IntZero->div(Float2_5)->strictly_equal(VAR(Float, 0.0)));
+    EXPECT_TRUE(IntZero->div(Float_23_74)->strictly_equal(VAR(Float, -0.0)));
+    EXPECT_ANY_THROW(IntZero->div(StrEmpty));
+    EXPECT_ANY_THROW(IntZero->div(StrEmpty2));
+    EXPECT_ANY_THROW(IntZero->div(StrA));
+    EXPECT_ANY_THROW(IntZero->div(StrA2));
+    EXPECT_ANY_THROW(IntZero->div(StrB));
+    EXPECT_ANY_THROW(IntZero->div(ListEmpty));
+    EXPECT_ANY_THROW(IntZero->div(ListEmpty2));
+    EXPECT_ANY_THROW(IntOne->div(None));
+    EXPECT_ANY_THROW(IntOne->div(None2));
+    EXPECT_ANY_THROW(IntOne->div(False));
+    EXPECT_ANY_THROW(IntOne->div(False2));
+    EXPECT_TRUE(IntOne->div(True)->strictly_equal(VAR(Float, 1.0)));
+    EXPECT_TRUE(IntOne->div(True2)->strictly_equal(VAR(Float, 1.0)));
+    EXPECT_ANY_THROW(IntOne->div(IntZero));
+    EXPECT_TRUE(IntOne->div(IntOne)->strictly_equal(VAR(Float, 1.0)));
+    EXPECT_TRUE(IntOne->div(IntTwo)->strictly_equal(VAR(Float, 0.5)));
+    EXPECT_TRUE(IntOne->div(IntTwo2)->strictly_equal(VAR(Float, 0.5)));
+    EXPECT_TRUE(IntOne->div(Int8)->strictly_equal(VAR(Float, 0.125)));
+    EXPECT_TRUE(IntOne->div(IntMinusOne)->strictly_equal(VAR(Float, -1.0)));
+    EXPECT_TRUE(IntOne->div(IntMinusOne2)->strictly_equal(VAR(Float, -1.0)));
+    EXPECT_TRUE(IntOne->div(IntMinus12)->strictly_equal(VAR(Float, -0.08333333333333333)));
+    EXPECT_TRUE(IntOne->div(IntMinus73)->strictly_equal(VAR(Float, -0.0136986301369863)));
+    EXPECT_TRUE(IntOne->div(FloatMinusOne)->strictly_equal(VAR(Float, -1.0)));
+    EXPECT_ANY_THROW(IntOne->div(FloatZero));
+    EXPECT_TRUE(IntOne->div(FloatOne)->strictly_equal(VAR(Float, 1.0)));
+    EXPECT_TRUE(IntOne->div(FloatTwo)->strictly_equal(VAR(Float, 0.5)));
+    EXPECT_TRUE(IntOne->div(FloatTwo2)->strictly_equal(VAR(Float, 0.5)));
+    EXPECT_TRUE(IntOne->div(Float2_5)->strictly_equal(VAR(Float, 0.4)));
+    EXPECT_TRUE(IntOne->div(Float_23_74)->strictly_equal(VAR(Float, -0.04212299915754002)));
+    EXPECT_ANY_THROW(IntOne->div(StrEmpty));
+    EXPECT_ANY_THROW(IntOne->div(StrEmpty2));
+    EXPECT_ANY_THROW(IntOne->div(StrA));
+    EXPECT_ANY_THROW(IntOne->div(StrA2));
+    EXPECT_ANY_THROW(IntOne->div(StrB));
+    EXPECT_ANY_THROW(IntOne->div(ListEmpty));
+    EXPECT_ANY_THROW(IntOne->div(ListEmpty2));
+    EXPECT_ANY_THROW(IntTwo->div(None));
+    EXPECT_ANY_THROW(IntTwo->div(None2));
+    EXPECT_ANY_THROW(IntTwo->div(False));
+    EXPECT_ANY_THROW(IntTwo->div(False2));
+    EXPECT_TRUE(IntTwo->div(True)->strictly_equal(VAR(Float, 2.0)));
+    EXPECT_TRUE(IntTwo->div(True2)->strictly_equal(VAR(Float, 2.0)));
+    EXPECT_ANY_THROW(IntTwo->div(IntZero));
+    EXPECT_TRUE(IntTwo->div(IntOne)->strictly_equal(VAR(Float, 2.0)));
+    EXPECT_TRUE(IntTwo->div(IntTwo)->strictly_equal(VAR(Float, 1.0)));
+    EXPECT_TRUE(IntTwo->div(IntTwo2)->strictly_equal(VAR(Float, 1.0)));
+    EXPECT_TRUE(IntTwo->div(Int8)->strictly_equal(VAR(Float, 0.25)));
+    EXPECT_TRUE(IntTwo->div(IntMinusOne)->strictly_equal(VAR(Float, -2.0)));
+    EXPECT_TRUE(IntTwo->div(IntMinusOne2)->strictly_equal(VAR(Float, -2.0)));
+    EXPECT_TRUE(IntTwo->div(IntMinus12)->strictly_equal(VAR(Float, -0.16666666666666666)));
+    EXPECT_TRUE(IntTwo->div(IntMinus73)->strictly_equal(VAR(Float, -0.0273972602739726)));
+    EXPECT_TRUE(IntTwo->div(FloatMinusOne)->strictly_equal(VAR(Float, -2.0)));
+    EXPECT_ANY_THROW(IntTwo->div(FloatZero));
+    EXPECT_TRUE(IntTwo->div(FloatOne)->strictly_equal(VAR(Float, 2.0)));
+    EXPECT_TRUE(IntTwo->div(FloatTwo)->strictly_equal(VAR(Float, 1.0)));
+    EXPECT_TRUE(IntTwo->div(FloatTwo2)->strictly_equal(VAR(Float, 1.0)));
+    EXPECT_TRUE(IntTwo->div(Float2_5)->strictly_equal(VAR(Float, 0.8)));
+    EXPECT_TRUE(IntTwo->div(Float_23_74)->strictly_equal(VAR(Float, -0.08424599831508003)));
+    EXPECT_ANY_THROW(IntTwo->div(StrEmpty));
+    EXPECT_ANY_THROW(IntTwo->div(StrEmpty2));
+    EXPECT_ANY_THROW(IntTwo->div(StrA));
+    EXPECT_ANY_THROW(IntTwo->div(StrA2));
+    EXPECT_ANY_THROW(IntTwo->div(StrB));
+    EXPECT_ANY_THROW(IntTwo->div(ListEmpty));
+    EXPECT_ANY_THROW(IntTwo->div(ListEmpty2));
+    EXPECT_ANY_THROW(IntTwo2->div(None));
+    EXPECT_ANY_THROW(IntTwo2->div(None2));
+    EXPECT_ANY_THROW(IntTwo2->div(False));
+    EXPECT_ANY_THROW(IntTwo2->div(False2));
+    EXPECT_TRUE(IntTwo2->div(True)->strictly_equal(VAR(Float, 2.0)));
+    EXPECT_TRUE(IntTwo2->div(True2)->strictly_equal(VAR(Float, 2.0)));
+    EXPECT_ANY_THROW(IntTwo2->div(IntZero));
+    EXPECT_TRUE(IntTwo2->div(IntOne)->strictly_equal(VAR(Float, 2.0)));
+    EXPECT_TRUE(IntTwo2->div(IntTwo)->strictly_equal(VAR(Float, 1.0)));
+    EXPECT_TRUE(IntTwo2->div(IntTwo2)->strictly_equal(VAR(Float, 1.0)));
+    EXPECT_TRUE(IntTwo2->div(Int8)->strictly_equal(VAR(Float, 0.25)));
+    EXPECT_TRUE(IntTwo2->div(IntMinusOne)->strictly_equal(VAR(Float, -2.0)));
+    EXPECT_TRUE(IntTwo2->div(IntMinusOne2)->strictly_equal(VAR(Float, -2.0)));
+    EXPECT_TRUE(IntTwo2->div(IntMinus12)->strictly_equal(VAR(Float, -0.16666666666666666)));
+    EXPECT_TRUE(IntTwo2->div(IntMinus73)->strictly_equal(VAR(Float, -0.0273972602739726)));
+    EXPECT_TRUE(IntTwo2->div(FloatMinusOne)->strictly_equal(VAR(Float, -2.0)));
+    EXPECT_ANY_THROW(IntTwo2->div(FloatZero));
+    EXPECT_TRUE(IntTwo2->div(FloatOne)->strictly_equal(VAR(Float, 2.0)));
+    EXPECT_TRUE(IntTwo2->div(FloatTwo)->strictly_equal(VAR(Float, 1.0)));
+    EXPECT_TRUE(IntTwo2->div(FloatTwo2)->strictly_equal(VAR(Float, 1.0)));
+    EXPECT_TRUE(IntTwo2->div(Float2_5)->strictly_equal(VAR(Float, 0.8)));
+    EXPECT_TRUE(IntTwo2->div(Float_23_74)->strictly_equal(VAR(Float, -0.08424599831508003)));
+    EXPECT_ANY_THROW(IntTwo2->div(StrEmpty));
+    EXPECT_ANY_THROW(IntTwo2->div(StrEmpty2));
+    EXPECT_ANY_THROW(IntTwo2->div(StrA));
+    EXPECT_ANY_THROW(IntTwo2->div(StrA2));
+    EXPECT_ANY_THROW(IntTwo2->div(StrB));
+    EXPECT_ANY_THROW(IntTwo2->div(ListEmpty));
+    EXPECT_ANY_THROW(IntTwo2->div(ListEmpty2));
+    EXPECT_ANY_THROW(Int8->div(None));
+    EXPECT_ANY_THROW(Int8->div(None2));
+    EXPECT_ANY_THROW(Int8->div(False));
+    EXPECT_ANY_THROW(Int8->div(False2));
+    EXPECT_TRUE(Int8->div(True)->strictly_equal(VAR(Float, 8.0)));
+    EXPECT_TRUE(Int8->div(True2)->strictly_equal(VAR(Float, 8.0)));
+    EXPECT_ANY_THROW(Int8->div(IntZero));
+    EXPECT_TRUE(Int8->div(IntOne)->strictly_equal(VAR(Float, 8.0)));
+    EXPECT_TRUE(Int8->div(IntTwo)->strictly_equal(VAR(Float, 4.0)));
+    EXPECT_TRUE(Int8->div(IntTwo2)->strictly_equal(VAR(Float, 4.0)));
+    EXPECT_TRUE(Int8->div(Int8)->strictly_equal(VAR(Float, 1.0)));
+    EXPECT_TRUE(Int8->div(IntMinusOne)->strictly_equal(VAR(Float, -8.0)));
+    EXPECT_TRUE(Int8->div(IntMinusOne2)->strictly_equal(VAR(Float, -8.0)));
+    EXPECT_TRUE(Int8->div(IntMinus12)->strictly_equal(VAR(Float, -0.6666666666666666)));
+    EXPECT_TRUE(Int8->div(IntMinus73)->strictly_equal(VAR(Float, -0.1095890410958904)));
+    EXPECT_TRUE(Int8->div(FloatMinusOne)->strictly_equal(VAR(Float, -8.0)));
+    EXPECT_ANY_THROW(Int8->div(FloatZero));
+    EXPECT_TRUE(Int8->div(FloatOne)->strictly_equal(VAR(Float, 8.0)));
+    EXPECT_TRUE(Int8->div(FloatTwo)->strictly_equal(VAR(Float, 4.0)));
+    EXPECT_TRUE(Int8->div(FloatTwo2)->strictly_equal(VAR(Float, 4.0)));
+    EXPECT_TRUE(Int8->div(Float2_5)->strictly_equal(VAR(Float, 3.2)));
+    EXPECT_TRUE(Int8->div(Float_23_74)->strictly_equal(VAR(Float, -0.33698399326032014)));
+    EXPECT_ANY_THROW(Int8->div(StrEmpty));
+    EXPECT_ANY_THROW(Int8->div(StrEmpty2));
+    EXPECT_ANY_THROW(Int8->div(StrA));
+    EXPECT_ANY_THROW(Int8->div(StrA2));
+    EXPECT_ANY_THROW(Int8->div(StrB));
+    EXPECT_ANY_THROW(Int8->div(ListEmpty));
+    EXPECT_ANY_THROW(Int8->div(ListEmpty2));
+    EXPECT_ANY_THROW(IntMinusOne->div(None));
+    EXPECT_ANY_THROW(IntMinusOne->div(None2));
+    EXPECT_ANY_THROW(IntMinusOne->div(False));
+    EXPECT_ANY_THROW(IntMinusOne->div(False2));
+    EXPECT_TRUE(IntMinusOne->div(True)->strictly_equal(VAR(Float, -1.0)));
+    EXPECT_TRUE(IntMinusOne->div(True2)->strictly_equal(VAR(Float, -1.0)));
+    EXPECT_ANY_THROW(IntMinusOne->div(IntZero));
+    EXPECT_TRUE(IntMinusOne->div(IntOne)->strictly_equal(VAR(Float, -1.0)));
+    EXPECT_TRUE(IntMinusOne->div(IntTwo)->strictly_equal(VAR(Float, -0.5)));
+    EXPECT_TRUE(IntMinusOne->div(IntTwo2)->strictly_equal(VAR(Float, -0.5)));
+    EXPECT_TRUE(IntMinusOne->div(Int8)->strictly_equal(VAR(Float, -0.125)));
+    EXPECT_TRUE(IntMinusOne->div(IntMinusOne)->strictly_equal(VAR(Float, 1.0)));
+    EXPECT_TRUE(IntMinusOne->div(IntMinusOne2)->strictly_equal(VAR(Float, 1.0)));
+    EXPECT_TRUE(IntMinusOne->div(IntMinus12)->strictly_equal(VAR(Float, 0.08333333333333333)));
+    EXPECT_TRUE(IntMinusOne->div(IntMinus73)->strictly_equal(VAR(Float, 0.0136986301369863)));
+    EXPECT_TRUE(IntMinusOne->div(FloatMinusOne)->strictly_equal(VAR(Float, 1.0)));
+    EXPECT_ANY_THROW(IntMinusOne->div(FloatZero));
+    EXPECT_TRUE(IntMinusOne->div(FloatOne)->strictly_equal(VAR(Float, -1.0)));
+    EXPECT_TRUE(IntMinusOne->div(FloatTwo)->strictly_equal(VAR(Float, -0.5)));
+    EXPECT_TRUE(IntMinusOne->div(FloatTwo2)->strictly_equal(VAR(Float, -0.5)));
+    EXPECT_TRUE(IntMinusOne->div(Float2_5)->strictly_equal(VAR(Float, -0.4)));
+    EXPECT_TRUE(IntMinusOne->div(Float_23_74)->strictly_equal(VAR(Float, 0.04212299915754002)));
+    EXPECT_ANY_THROW(IntMinusOne->div(StrEmpty));
+    EXPECT_ANY_THROW(IntMinusOne->div(StrEmpty2));
+    EXPECT_ANY_THROW(IntMinusOne->div(StrA));
+    EXPECT_ANY_THROW(IntMinusOne->div(StrA2));
+    EXPECT_ANY_THROW(IntMinusOne->div(StrB));
+    EXPECT_ANY_THROW(IntMinusOne->div(ListEmpty));
+    EXPECT_ANY_THROW(IntMinusOne->div(ListEmpty2));
+    EXPECT_ANY_THROW(IntMinusOne2->div(None));
+    EXPECT_ANY_THROW(IntMinusOne2->div(None2));
+    EXPECT_ANY_THROW(IntMinusOne2->div(False));
+    EXPECT_ANY_THROW(IntMinusOne2->div(False2));
+    EXPECT_TRUE(IntMinusOne2->div(True)->strictly_equal(VAR(Float, -1.0)));
+    EXPECT_TRUE(IntMinusOne2->div(True2)->strictly_equal(VAR(Float, -1.0)));
+    EXPECT_ANY_THROW(IntMinusOne2->div(IntZero));
+    EXPECT_TRUE(IntMinusOne2->div(IntOne)->strictly_equal(VAR(Float, -1.0)));
+    EXPECT_TRUE(IntMinusOne2->div(IntTwo)->strictly_equal(VAR(Float, -0.5)));
+    EXPECT_TRUE(IntMinusOne2->div(IntTwo2)->strictly_equal(VAR(Float, -0.5)));
+    EXPECT_TRUE(IntMinusOne2->div(Int8)->strictly_equal(VAR(Float, -0.125)));
+    EXPECT_TRUE(IntMinusOne2->div(IntMinusOne)->strictly_equal(VAR(Float, 1.0)));
+    EXPECT_TRUE(IntMinusOne2->div(IntMinusOne2)->strictly_equal(VAR(Float, 1.0)));
+    EXPECT_TRUE(IntMinusOne2->div(IntMinus12)->strictly_equal(VAR(Float, 0.08333333333333333)));
+    EXPECT_TRUE(IntMinusOne2->div(IntMinus73)->strictly_equal(VAR(Float, 0.0136986301369863)));
+    EXPECT_TRUE(IntMinusOne2->div(FloatMinusOne)->strictly_equal(VAR(Float, 1.0)));
+    EXPECT_ANY_THROW(IntMinusOne2->div(FloatZero));
+    EXPECT_TRUE(IntMinusOne2->div(FloatOne)->strictly_equal(VAR(Float, -1.0)));
+    EXPECT_TRUE(IntMinusOne2->div(FloatTwo)->strictly_equal(VAR(Float, -0.5)));
+    EXPECT_TRUE(IntMinusOne2->div(FloatTwo2)->strictly_equal(VAR(Float, -0.5)));
+    EXPECT_TRUE(IntMinusOne2->div(Float2_5)->strictly_equal(VAR(Float, -0.4)));
+    EXPECT_TRUE(IntMinusOne2->div(Float_23_74)->strictly_equal(VAR(Float, 0.04212299915754002)));
+    EXPECT_ANY_THROW(IntMinusOne2->div(StrEmpty));
+    EXPECT_ANY_THROW(IntMinusOne2->div(StrEmpty2));
+    EXPECT_ANY_THROW(IntMinusOne2->div(StrA));
+    EXPECT_ANY_THROW(IntMinusOne2->div(StrA2));
+    EXPECT_ANY_THROW(IntMinusOne2->div(StrB));
+    EXPECT_ANY_THROW(IntMinusOne2->div(ListEmpty));
+    EXPECT_ANY_THROW(IntMinusOne2->div(ListEmpty2));
+    EXPECT_ANY_THROW(IntMinus12->div(None));
+    EXPECT_ANY_THROW(IntMinus12->div(None2));
+    EXPECT_ANY_THROW(IntMinus12->div(False));
+    EXPECT_ANY_THROW(IntMinus12->div(False2));
+    EXPECT_TRUE(IntMinus12->div(True)->strictly_equal(VAR(Float, -12.0)));
+    EXPECT_TRUE(IntMinus12->div(True2)->strictly_equal(VAR(Float, -12.0)));
+    EXPECT_ANY_THROW(IntMinus12->div(IntZero));
+    EXPECT_TRUE(IntMinus12->div(IntOne)->strictly_equal(VAR(Float, -12.0)));
+    EXPECT_TRUE(IntMinus12->div(IntTwo)->strictly_equal(VAR(Float, -6.0)));
+    EXPECT_TRUE(IntMinus12->div(IntTwo2)->strictly_equal(VAR(Float, -6.0)));
+    EXPECT_TRUE(IntMinus12->div(Int8)->strictly_equal(VAR(Float, -1.5)));
+    EXPECT_TRUE(IntMinus12->div(IntMinusOne)->strictly_equal(VAR(Float, 12.0)));
+    EXPECT_TRUE(IntMinus12->div(IntMinusOne2)->strictly_equal(VAR(Float, 12.0)));
+    EXPECT_TRUE(IntMinus12->div(IntMinus12)->strictly_equal(VAR(Float, 1.0)));
+    EXPECT_TRUE(IntMinus12->div(IntMinus73)->strictly_equal(VAR(Float, 0.1643835616438356)));
+    EXPECT_TRUE(IntMinus12->div(FloatMinusOne)->strictly_equal(VAR(Float, 12.0)));
+    EXPECT_ANY_THROW(IntMinus12->div(FloatZero));
+    EXPECT_TRUE(IntMinus12->div(FloatOne)->strictly_equal(VAR(Float, -12.0)));
+    EXPECT_TRUE(IntMinus12->div(FloatTwo)->strictly_equal(VAR(Float, -6.0)));
+    EXPECT_TRUE(IntMinus12->div(FloatTwo2)->strictly_equal(VAR(Float, -6.0)));
+    EXPECT_TRUE(IntMinus12->div(Float2_5)->strictly_equal(VAR(Float, -4.8)));
+    EXPECT_TRUE(IntMinus12->div(Float_23_74)->strictly_equal(VAR(Float, 0.5054759898904803)));
+    EXPECT_ANY_THROW(IntMinus12->div(StrEmpty));
+    EXPECT_ANY_THROW(IntMinus12->div(StrEmpty2));
+    EXPECT_ANY_THROW(IntMinus12->div(StrA));
+    EXPECT_ANY_THROW(IntMinus12->div(StrA2));
+    EXPECT_ANY_THROW(IntMinus12->div(StrB));
+    EXPECT_ANY_THROW(IntMinus12->div(ListEmpty));
+    EXPECT_ANY_THROW(IntMinus12->div(ListEmpty2));
+    EXPECT_ANY_THROW(IntMinus73->div(None));
+    EXPECT_ANY_THROW(IntMinus73->div(None2));
+    EXPECT_ANY_THROW(IntMinus73->div(False));
+    EXPECT_ANY_THROW(IntMinus73->div(False2));
+    EXPECT_TRUE(IntMinus73->div(True)->strictly_equal(VAR(Float, -73.0)));
+    EXPECT_TRUE(IntMinus73->div(True2)->strictly_equal(VAR(Float, -73.0)));
+    EXPECT_ANY_THROW(IntMinus73->div(IntZero));
+    EXPECT_TRUE(IntMinus73->div(IntOne)->strictly_equal(VAR(Float, -73.0)));
+    EXPECT_TRUE(IntMinus73->div(IntTwo)->strictly_equal(VAR(Float, -36.5)));
+    EXPECT_TRUE(IntMinus73->div(IntTwo2)->strictly_equal(VAR(Float, -36.5)));
+    EXPECT_TRUE(IntMinus73->div(Int8)->strictly_equal(VAR(Float, -9.125)));
+    EXPECT_TRUE(IntMinus73->div(IntMinusOne)->strictly_equal(VAR(Float, 73.0)));
+    EXPECT_TRUE(IntMinus73->div(IntMinusOne2)->strictly_equal(VAR(Float, 73.0)));
+    EXPECT_TRUE(IntMinus73->div(IntMinus12)->strictly_equal(VAR(Float, 6.083333333333333)));
+    EXPECT_TRUE(IntMinus73->div(IntMinus73)->strictly_equal(VAR(Float, 1.0)));
+    EXPECT_TRUE(IntMinus73->div(FloatMinusOne)->strictly_equal(VAR(Float, 73.0)));
+    EXPECT_ANY_THROW(IntMinus73->div(FloatZero));
+    EXPECT_TRUE(IntMinus73->div(FloatOne)->strictly_equal(VAR(Float, -73.0)));
+    EXPECT_TRUE(IntMinus73->div(FloatTwo)->strictly_equal(VAR(Float, -36.5)));
+    EXPECT_TRUE(IntMinus73->div(FloatTwo2)->strictly_equal(VAR(Float, -36.5)));
+    EXPECT_TRUE(IntMinus73->div(Float2_5)->strictly_equal(VAR(Float, -29.2)));
+    EXPECT_TRUE(IntMinus73->div(Float_23_74)->strictly_equal(VAR(Float, 3.0749789385004216)));
+    EXPECT_ANY_THROW(IntMinus73->div(StrEmpty));
+    EXPECT_ANY_THROW(IntMinus73->div(StrEmpty2));
+    EXPECT_ANY_THROW(IntMinus73->div(StrA));
+    EXPECT_ANY_THROW(IntMinus73->div(StrA2));
+    EXPECT_ANY_THROW(IntMinus73->div(StrB));
+    EXPECT_ANY_THROW(IntMinus73->div(ListEmpty));
+    EXPECT_ANY_THROW(IntMinus73->div(ListEmpty2));
+    EXPECT_ANY_THROW(FloatMinusOne->div(None));
+    EXPECT_ANY_THROW(FloatMinusOne->div(None2));
+    EXPECT_ANY_THROW(FloatMinusOne->div(False));
+    EXPECT_ANY_THROW(FloatMinusOne->div(False2));
+    EXPECT_TRUE(FloatMinusOne->div(True)->strictly_equal(VAR(Float, -1.0)));
+    EXPECT_TRUE(FloatMinusOne->div(True2)->strictly_equal(VAR(Float, -1.0)));
+    EXPECT_ANY_THROW(FloatMinusOne->div(IntZero));
+    EXPECT_TRUE(FloatMinusOne->div(IntOne)->strictly_equal(VAR(Float, -1.0)));
+    EXPECT_TRUE(FloatMinusOne->div(IntTwo)->strictly_equal(VAR(Float, -0.5)));
+    EXPECT_TRUE(FloatMinusOne->div(IntTwo2)->strictly_equal(VAR(Float, -0.5)));
+    EXPECT_TRUE(FloatMinusOne->div(Int8)->strictly_equal(VAR(Float, -0.125)));
+    EXPECT_TRUE(FloatMinusOne->div(IntMinusOne)->strictly_equal(VAR(Float, 1.0)));
+    EXPECT_TRUE(FloatMinusOne->div(IntMinusOne2)->strictly_equal(VAR(Float, 1.0)));
+    EXPECT_TRUE(FloatMinusOne->div(IntMinus12)->strictly_equal(VAR(Float, 0.08333333333333333)));
+    EXPECT_TRUE(FloatMinusOne->div(IntMinus73)->strictly_equal(VAR(Float, 0.0136986301369863)));
+    EXPECT_TRUE(FloatMinusOne->div(FloatMinusOne)->strictly_equal(VAR(Float, 1.0)));
+    EXPECT_ANY_THROW(FloatMinusOne->div(FloatZero));
+    EXPECT_TRUE(FloatMinusOne->div(FloatOne)->strictly_equal(VAR(Float, -1.0)));
+    EXPECT_TRUE(FloatMinusOne->div(FloatTwo)->strictly_equal(VAR(Float, -0.5)));
+    EXPECT_TRUE(FloatMinusOne->div(FloatTwo2)->strictly_equal(VAR(Float, -0.5)));
+    EXPECT_TRUE(FloatMinusOne->div(Float2_5)->strictly_equal(VAR(Float, -0.4)));
+    EXPECT_TRUE(FloatMinusOne->div(Float_23_74)->strictly_equal(VAR(Float, 0.04212299915754002)));
+    EXPECT_ANY_THROW(FloatMinusOne->div(StrEmpty));
+    EXPECT_ANY_THROW(FloatMinusOne->div(StrEmpty2));
+    EXPECT_ANY_THROW(FloatMinusOne->div(StrA));
+    EXPECT_ANY_THROW(FloatMinusOne->div(StrA2));
+    EXPECT_ANY_THROW(FloatMinusOne->div(StrB));
+    EXPECT_ANY_THROW(FloatMinusOne->div(ListEmpty));
+    EXPECT_ANY_THROW(FloatMinusOne->div(ListEmpty2));
+    EXPECT_ANY_THROW(FloatZero->div(None));
+    EXPECT_ANY_THROW(FloatZero->div(None2));
+    EXPECT_ANY_THROW(FloatZero->div(False));
+    EXPECT_ANY_THROW(FloatZero->div(False2));
+    EXPECT_TRUE(FloatZero->div(True)->strictly_equal(VAR(Float, 0.0)));
+    EXPECT_TRUE(FloatZero->div(True2)->strictly_equal(VAR(Float, 0.0)));
+    EXPECT_ANY_THROW(FloatZero->div(IntZero));
+    EXPECT_TRUE(FloatZero->div(IntOne)->strictly_equal(VAR(Float, 0.0)));
+    EXPECT_TRUE(FloatZero->div(IntTwo)->strictly_equal(VAR(Float, 0.0)));
+    EXPECT_TRUE(FloatZero->div(IntTwo2)->strictly_equal(VAR(Float, 0.0)));
+    EXPECT_TRUE(FloatZero->div(Int8)->strictly_equal(VAR(Float, 0.0)));
+    EXPECT_TRUE(FloatZero->div(IntMinusOne)->strictly_equal(VAR(Float, -0.0)));
+    EXPECT_TRUE(FloatZero->div(IntMinusOne2)->strictly_equal(VAR(Float, -0.0)));
+    EXPECT_TRUE(FloatZero->div(IntMinus12)->strictly_equal(VAR(Float, -0.0)));
+    EXPECT_TRUE(FloatZero->div(IntMinus73)->strictly_equal(VAR(Float, -0.0)));
+    EXPECT_TRUE(FloatZero->div(FloatMinusOne)->strictly_equal(VAR(Float, -0.0)));
+    EXPECT_ANY_THROW(FloatZero->div(FloatZero));
+    EXPECT_TRUE(FloatZero->div(FloatOne)->strictly_equal(VAR(Float, 0.0)));
+    EXPECT_TRUE(FloatZero->div(FloatTwo)->strictly_equal(VAR(Float, 0.0)));
+    EXPECT_TRUE(FloatZero->div(FloatTwo2)->strictly_equal(VAR(Float, 0.0)));
+    EXPECT_TRUE(FloatZero->div(Float2_5)->strictly_equal(VAR(Float, 0.0)));
+    EXPECT_TRUE(FloatZero->div(Float_23_74)->strictly_equal(VAR(Float, -0.0)));
+    EXPECT_ANY_THROW(FloatZero->div(StrEmpty));
+    EXPECT_ANY_THROW(FloatZero->div(StrEmpty2));
+    EXPECT_ANY_THROW(FloatZero->div(StrA));
+    EXPECT_ANY_THROW(FloatZero->div(StrA2));
+    EXPECT_ANY_THROW(FloatZero->div(StrB));
+    EXPECT_ANY_THROW(FloatZero->div(ListEmpty));
+    EXPECT_ANY_THROW(FloatZero->div(ListEmpty2));
+    EXPECT_ANY_THROW(FloatOne->div(None));
+    EXPECT_ANY_THROW(FloatOne->div(None2));
+    EXPECT_ANY_THROW(FloatOne->div(False));
+    EXPECT_ANY_THROW(FloatOne->div(False2));
+    EXPECT_TRUE(FloatOne->div(True)->strictly_equal(VAR(Float, 1.0)));
+    EXPECT_TRUE(FloatOne->div(True2)->strictly_equal(VAR(Float, 1.0)));
+    EXPECT_ANY_THROW(FloatOne->div(IntZero));
+    EXPECT_TRUE(FloatOne->div(IntOne)->strictly_equal(VAR(Float, 1.0)));
+    EXPECT_TRUE(FloatOne->div(IntTwo)->strictly_equal(VAR(Float, 0.5)));
+    EXPECT_TRUE(FloatOne->div(IntTwo2)->strictly_equal(VAR(Float, 0.5)));
+    EXPECT_TRUE(FloatOne->div(Int8)->strictly_equal(VAR(Float, 0.125)));
+    EXPECT_TRUE(FloatOne->div(IntMinusOne)->strictly_equal(VAR(Float, -1.0)));
+    EXPECT_TRUE(FloatOne->div(IntMinusOne2)->strictly_equal(VAR(Float, -1.0)));
+    EXPECT_TRUE(FloatOne->div(IntMinus12)->strictly_equal(VAR(Float, -0.08333333333333333)));
+    EXPECT_TRUE(FloatOne->div(IntMinus73)->strictly_equal(VAR(Float, -0.0136986301369863)));
+    EXPECT_TRUE(FloatOne->div(FloatMinusOne)->strictly_equal(VAR(Float, -1.0)));
+    EXPECT_ANY_THROW(FloatOne->div(FloatZero));
+    EXPECT_TRUE(FloatOne->div(FloatOne)->strictly_equal(VAR(Float, 1.0)));
+    EXPECT_TRUE(FloatOne->div(FloatTwo)->strictly_equal(VAR(Float, 0.5)));
+    EXPECT_TRUE(FloatOne->div(FloatTwo2)->strictly_equal(VAR(Float, 0.5)));
+    EXPECT_TRUE(FloatOne->div(Float2_5)->strictly_equal(VAR(Float, 0.4)));
+    EXPECT_TRUE(FloatOne->div(Float_23_74)->strictly_equal(VAR(Float, -0.04212299915754002)));
+    EXPECT_ANY_THROW(FloatOne->div(StrEmpty));
+    EXPECT_ANY_THROW(FloatOne->div(StrEmpty2));
+    EXPECT_ANY_THROW(FloatOne->div(StrA));
+    EXPECT_ANY_THROW(FloatOne->div(StrA2));
+    EXPECT_ANY_THROW(FloatOne->div(StrB));
+    EXPECT_ANY_THROW(FloatOne->div(ListEmpty));
+    EXPECT_ANY_THROW(FloatOne->div(ListEmpty2));
+    EXPECT_ANY_THROW(FloatTwo->div(None));
+    EXPECT_ANY_THROW(FloatTwo->div(None2));
+    EXPECT_ANY_THROW(FloatTwo->div(False));
+    EXPECT_ANY_THROW(FloatTwo->div(False2));
+    EXPECT_TRUE(FloatTwo->div(True)->strictly_equal(VAR(Float, 2.0)));
+    EXPECT_TRUE(FloatTwo->div(True2)->strictly_equal(VAR(Float, 2.0)));
+    EXPECT_ANY_THROW(FloatTwo->div(IntZero));
+    EXPECT_TRUE(FloatTwo->div(IntOne)->strictly_equal(VAR(Float, 2.0)));
+    EXPECT_TRUE(FloatTwo->div(IntTwo)->strictly_equal(VAR(Float, 1.0)));
+    EXPECT_TRUE(FloatTwo->div(IntTwo2)->strictly_equal(VAR(Float, 1.0)));
+    EXPECT_TRUE(FloatTwo->div(Int8)->strictly_equal(VAR(Float, 0.25)));
+    EXPECT_TRUE(FloatTwo->div(IntMinusOne)->strictly_equal(VAR(Float, -2.0)));
+    EXPECT_TRUE(FloatTwo->div(IntMinusOne2)->strictly_equal(VAR(Float, -2.0)));
+    EXPECT_TRUE(FloatTwo->div(IntMinus12)->strictly_equal(VAR(Float, -0.16666666666666666)));
+    EXPECT_TRUE(FloatTwo->div(IntMinus73)->strictly_equal(VAR(Float, -0.0273972602739726)));
+    EXPECT_TRUE(FloatTwo->div(FloatMinusOne)->strictly_equal(VAR(Float, -2.0)));
+    EXPECT_ANY_THROW(FloatTwo->div(FloatZero));
+    EXPECT_TRUE(FloatTwo->div(FloatOne)->strictly_equal(VAR(Float, 2.0)));
+    EXPECT_TRUE(FloatTwo->div(FloatTwo)->strictly_equal(VAR(Float, 1.0)));
+    EXPECT_TRUE(FloatTwo->div(FloatTwo2)->strictly_equal(VAR(Float, 1.0)));
+    EXPECT_TRUE(FloatTwo->div(Float2_5)->strictly_equal(VAR(Float, 0.8)));
+    EXPECT_TRUE(FloatTwo->div(Float_23_74)->strictly_equal(VAR(Float, -0.08424599831508003)));
+    EXPECT_ANY_THROW(FloatTwo->div(StrEmpty));
+    EXPECT_ANY_THROW(FloatTwo->div(StrEmpty2));
+    EXPECT_ANY_THROW(FloatTwo->div(StrA));
+    EXPECT_ANY_THROW(FloatTwo->div(StrA2));
+    EXPECT_ANY_THROW(FloatTwo->div(StrB));
+    EXPECT_ANY_THROW(FloatTwo->div(ListEmpty));
+    EXPECT_ANY_THROW(FloatTwo->div(ListEmpty2));
+    EXPECT_ANY_THROW(FloatTwo2->div(None));
+    EXPECT_ANY_THROW(FloatTwo2->div(None2));
+    EXPECT_ANY_THROW(FloatTwo2->div(False));
+    EXPECT_ANY_THROW(FloatTwo2->div(False2));
+    EXPECT_TRUE(FloatTwo2->div(True)->strictly_equal(VAR(Float, 2.0)));
+    EXPECT_TRUE(FloatTwo2->div(True2)->strictly_equal(VAR(Float, 2.0)));
+    EXPECT_ANY_THROW(FloatTwo2->div(IntZero));
+    EXPECT_TRUE(FloatTwo2->div(IntOne)->strictly_equal(VAR(Float, 2.0)));
+    EXPECT_TRUE(FloatTwo2->div(IntTwo)->strictly_equal(VAR(Float, 1.0)));
+    EXPECT_TRUE(FloatTwo2->div(IntTwo2)->strictly_equal(VAR(Float, 1.0)));
+    EXPECT_TRUE(FloatTwo2->div(Int8)->strictly_equal(VAR(Float, 0.25)));
+    EXPECT_TRUE(FloatTwo2->div(IntMinusOne)->strictly_equal(VAR(Float, -2.0)));
+    EXPECT_TRUE(FloatTwo2->div(IntMinusOne2)->strictly_equal(VAR(Float, -2.0)));
+    EXPECT_TRUE(FloatTwo2->div(IntMinus12)->strictly_equal(VAR(Float, -0.16666666666666666)));
+    EXPECT_TRUE(FloatTwo2->div(IntMinus73)->strictly_equal(VAR(Float, -0.0273972602739726)));
+    EXPECT_TRUE(FloatTwo2->div(FloatMinusOne)->strictly_equal(VAR(Float, -2.0)));
+    EXPECT_ANY_THROW(FloatTwo2->div(FloatZero));
+    EXPECT_TRUE(FloatTwo2->div(FloatOne)->strictly_equal(VAR(Float, 2.0)));
+    EXPECT_TRUE(FloatTwo2->div(FloatTwo)->strictly_equal(VAR(Float, 1.0)));
+    EXPECT_TRUE(FloatTwo2->div(FloatTwo2)->strictly_equal(VAR(Float, 1.0)));
+    EXPECT_TRUE(FloatTwo2->div(Float2_5)->strictly_equal(VAR(Float, 0.8)));
+    EXPECT_TRUE(FloatTwo2->div(Float_23_74)->strictly_equal(VAR(Float, -0.08424599831508003)));
+    EXPECT_ANY_THROW(FloatTwo2->div(StrEmpty));
+    EXPECT_ANY_THROW(FloatTwo2->div(StrEmpty2));
+    EXPECT_ANY_THROW(FloatTwo2->div(StrA));
+    EXPECT_ANY_THROW(FloatTwo2->div(StrA2));
+    EXPECT_ANY_THROW(FloatTwo2->div(StrB));
+    EXPECT_ANY_THROW(FloatTwo2->div(ListEmpty));
+    EXPECT_ANY_THROW(FloatTwo2->div(ListEmpty2));
+    EXPECT_ANY_THROW(Float2_5->div(None));
+    EXPECT_ANY_THROW(Float2_5->div(None2));
+    EXPECT_ANY_THROW(Float2_5->div(False));
+    EXPECT_ANY_THROW(Float2_5->div(False2));
+    EXPECT_TRUE(Float2_5->div(True)->strictly_equal(VAR(Float, 2.5)));
+    EXPECT_TRUE(Float2_5->div(True2)->strictly_equal(VAR(Float, 2.5)));
+    EXPECT_ANY_THROW(Float2_5->div(IntZero));
+    EXPECT_TRUE(Float2_5->div(IntOne)->strictly_equal(VAR(Float, 2.5)));
+    EXPECT_TRUE(Float2_5->div(IntTwo)->strictly_equal(VAR(Float, 1.25)));
+    EXPECT_TRUE(Float2_5->div(IntTwo2)->strictly_equal(VAR(Float, 1.25)));
+    EXPECT_TRUE(Float2_5->div(Int8)->strictly_equal(VAR(Float, 0.3125)));
+    EXPECT_TRUE(Float2_5->div(IntMinusOne)->strictly_equal(VAR(Float, -2.5)));
+    EXPECT_TRUE(Float2_5->div(IntMinusOne2)->strictly_equal(VAR(Float, -2.5)));
+    EXPECT_TRUE(Float2_5->div(IntMinus12)->strictly_equal(VAR(Float, -0.20833333333333334)));
+    EXPECT_TRUE(Float2_5->div(IntMinus73)->strictly_equal(VAR(Float, -0.03424657534246575)));
+    EXPECT_TRUE(Float2_5->div(FloatMinusOne)->strictly_equal(VAR(Float, -2.5)));
+    EXPECT_ANY_THROW(Float2_5->div(FloatZero));
+    EXPECT_TRUE(Float2_5->div(FloatOne)->strictly_equal(VAR(Float, 2.5)));
+    EXPECT_TRUE(Float2_5->div(FloatTwo)->strictly_equal(VAR(Float, 1.25)));
+    EXPECT_TRUE(Float2_5->div(FloatTwo2)->strictly_equal(VAR(Float, 1.25)));
+    EXPECT_TRUE(Float2_5->div(Float2_5)->strictly_equal(VAR(Float, 1.0)));
+    EXPECT_TRUE(Float2_5->div(Float_23_74)->strictly_equal(VAR(Float, -0.10530749789385005)));
+    EXPECT_ANY_THROW(Float2_5->div(StrEmpty));
+    EXPECT_ANY_THROW(Float2_5->div(StrEmpty2));
+    EXPECT_ANY_THROW(Float2_5->div(StrA));
+    EXPECT_ANY_THROW(Float2_5->div(StrA2));
+    EXPECT_ANY_THROW(Float2_5->div(StrB));
+    EXPECT_ANY_THROW(Float2_5->div(ListEmpty));
+    EXPECT_ANY_THROW(Float2_5->div(ListEmpty2));
+    EXPECT_ANY_THROW(Float_23_74->div(None));
+    EXPECT_ANY_THROW(Float_23_74->div(None2));
+    EXPECT_ANY_THROW(Float_23_74->div(False));
+    EXPECT_ANY_THROW(Float_23_74->div(False2));
+    EXPECT_TRUE(Float_23_74->div(True)->strictly_equal(VAR(Float, -23.74)));
+    EXPECT_TRUE(Float_23_74->div(True2)->strictly_equal(VAR(Float, -23.74)));
+    EXPECT_ANY_THROW(Float_23_74->div(IntZero));
+    EXPECT_TRUE(Float_23_74->div(IntOne)->strictly_equal(VAR(Float, -23.74)));
+    EXPECT_TRUE(Float_23_74->div(IntTwo)->strictly_equal(VAR(Float, -11.87)));
+    EXPECT_TRUE(Float_23_74->div(IntTwo2)->strictly_equal(VAR(Float, -11.87)));
+    EXPECT_TRUE(Float_23_74->div(Int8)->strictly_equal(VAR(Float, -2.9675)));
+    EXPECT_TRUE(Float_23_74->div(IntMinusOne)->strictly_equal(VAR(Float, 23.74)));
+    EXPECT_TRUE(Float_23_74->div(IntMinusOne2)->strictly_equal(VAR(Float, 23.74)));
+    EXPECT_TRUE(Float_23_74->div(IntMinus12)->strictly_equal(VAR(Float, 1.9783333333333333)));
+    EXPECT_TRUE(Float_23_74->div(IntMinus73)->strictly_equal(VAR(Float, 0.32520547945205475)));
+    EXPECT_TRUE(Float_23_74->div(FloatMinusOne)->strictly_equal(VAR(Float, 23.74)));
+    EXPECT_ANY_THROW(Float_23_74->div(FloatZero));
+    EXPECT_TRUE(Float_23_74->div(FloatOne)->strictly_equal(VAR(Float, -23.74)));
+    EXPECT_TRUE(Float_23_74->div(FloatTwo)->strictly_equal(VAR(Float, -11.87)));
+    EXPECT_TRUE(Float_23_74->div(FloatTwo2)->strictly_equal(VAR(Float, -11.87)));
+    EXPECT_TRUE(Float_23_74->div(Float2_5)->strictly_equal(VAR(Float, -9.495999999999999)));
+    EXPECT_TRUE(Float_23_74->div(Float_23_74)->strictly_equal(VAR(Float, 1.0)));
+    EXPECT_ANY_THROW(Float_23_74->div(StrEmpty));
+    EXPECT_ANY_THROW(Float_23_74->div(StrEmpty2));
+    EXPECT_ANY_THROW(Float_23_74->div(StrA));
+    EXPECT_ANY_THROW(Float_23_74->div(StrA2));
+    EXPECT_ANY_THROW(Float_23_74->div(StrB));
+    EXPECT_ANY_THROW(Float_23_74->div(ListEmpty));
+    EXPECT_ANY_THROW(Float_23_74->div(ListEmpty2));
+    EXPECT_ANY_THROW(StrEmpty->div(None));
+    EXPECT_ANY_THROW(StrEmpty->div(None2));
+    EXPECT_ANY_THROW(StrEmpty->div(False));
+    EXPECT_ANY_THROW(StrEmpty->div(False2));
+    EXPECT_ANY_THROW(StrEmpty->div(True));
+    EXPECT_ANY_THROW(StrEmpty->div(True2));
+    EXPECT_ANY_THROW(StrEmpty->div(IntZero));
+    EXPECT_ANY_THROW(StrEmpty->div(IntOne));
+    EXPECT_ANY_THROW(StrEmpty->div(IntTwo));
+    EXPECT_ANY_THROW(StrEmpty->div(IntTwo2));
+    EXPECT_ANY_THROW(StrEmpty->div(Int8));
+    EXPECT_ANY_THROW(StrEmpty->div(IntMinusOne));
+    EXPECT_ANY_THROW(StrEmpty->div(IntMinusOne2));
+    EXPECT_ANY_THROW(StrEmpty->div(IntMinus12));
+    EXPECT_ANY_THROW(StrEmpty->div(IntMinus73));
+    EXPECT_ANY_THROW(StrEmpty->div(FloatMinusOne));
+    EXPECT_ANY_THROW(StrEmpty->div(FloatZero));
+    EXPECT_ANY_THROW(StrEmpty->div(FloatOne));
+    EXPECT_ANY_THROW(StrEmpty->div(FloatTwo));
+    EXPECT_ANY_THROW(StrEmpty->div(FloatTwo2));
+    EXPECT_ANY_THROW(StrEmpty->div(Float2_5));
+    EXPECT_ANY_THROW(StrEmpty->div(Float_23_74));
+    EXPECT_ANY_THROW(StrEmpty->div(StrEmpty));
+    EXPECT_ANY_THROW(StrEmpty->div(StrEmpty2));
+    EXPECT_ANY_THROW(StrEmpty->div(StrA));
+    EXPECT_ANY_THROW(StrEmpty->div(StrA2));
+    EXPECT_ANY_THROW(StrEmpty->div(StrB));
+    EXPECT_ANY_THROW(StrEmpty->div(ListEmpty));
+    EXPECT_ANY_THROW(StrEmpty->div(ListEmpty2));
+    EXPECT_ANY_THROW(StrEmpty2->div(None));
+    EXPECT_ANY_THROW(StrEmpty2->div(None2));
+    EXPECT_ANY_THROW(StrEmpty2->div(False));
+    EXPECT_ANY_THROW(StrEmpty2->div(False2));
+    EXPECT_ANY_THROW(StrEmpty2->div(True));
+    EXPECT_ANY_THROW(StrEmpty2->div(True2));
+    EXPECT_ANY_THROW(StrEmpty2->div(IntZero));
+    EXPECT_ANY_THROW(StrEmpty2->div(IntOne));
+    EXPECT_ANY_THROW(StrEmpty2->div(IntTwo));
+    EXPECT_ANY_THROW(StrEmpty2->div(IntTwo2));
+    EXPECT_ANY_THROW(StrEmpty2->div(Int8));
+    EXPECT_ANY_THROW(StrEmpty2->div(IntMinusOne));
+    EXPECT_ANY_THROW(StrEmpty2->div(IntMinusOne2));
+    EXPECT_ANY_THROW(StrEmpty2->div(IntMinus12));
+    EXPECT_ANY_THROW(StrEmpty2->div(IntMinus73));
+    EXPECT_ANY_THROW(StrEmpty2->div(FloatMinusOne));
+    EXPECT_ANY_THROW(StrEmpty2->div(FloatZero));
+    EXPECT_ANY_THROW(StrEmpty2->div(FloatOne));
+    EXPECT_ANY_THROW(StrEmpty2->div(FloatTwo));
+    EXPECT_ANY_THROW(StrEmpty2->div(FloatTwo2));
+    EXPECT_ANY_THROW(StrEmpty2->div(Float2_5));
+    EXPECT_ANY_THROW(StrEmpty2->div(Float_23_74));
+    EXPECT_ANY_THROW(StrEmpty2->div(StrEmpty));
+    EXPECT_ANY_THROW(StrEmpty2->div(StrEmpty2));
+    EXPECT_ANY_THROW(StrEmpty2->div(StrA));
+    EXPECT_ANY_THROW(StrEmpty2->div(StrA2));
+    EXPECT_ANY_THROW(StrEmpty2->div(StrB));
+    EXPECT_ANY_THROW(StrEmpty2->div(ListEmpty));
+    EXPECT_ANY_THROW(StrEmpty2->div(ListEmpty2));
+    EXPECT_ANY_THROW(StrA->div(None));
+    EXPECT_ANY_THROW(StrA->div(None2));
+    EXPECT_ANY_THROW(StrA->div(False));
+    EXPECT_ANY_THROW(StrA->div(False2));
+    EXPECT_ANY_THROW(StrA->div(True));
+    EXPECT_ANY_THROW(StrA->div(True2));
+    EXPECT_ANY_THROW(StrA->div(IntZero));
+    EXPECT_ANY_THROW(StrA->div(IntOne));
+    EXPECT_ANY_THROW(StrA->div(IntTwo));
+    EXPECT_ANY_THROW(StrA->div(IntTwo2));
+    EXPECT_ANY_THROW(StrA->div(Int8));
+    EXPECT_ANY_THROW(StrA->div(IntMinusOne));
+    EXPECT_ANY_THROW(StrA->div(IntMinusOne2));
+    EXPECT_ANY_THROW(StrA->div(IntMinus12));
+    EXPECT_ANY_THROW(StrA->div(IntMinus73));
+    EXPECT_ANY_THROW(StrA->div(FloatMinusOne));
+    EXPECT_ANY_THROW(StrA->div(FloatZero));
+    EXPECT_ANY_THROW(StrA->div(FloatOne));
+    EXPECT_ANY_THROW(StrA->div(FloatTwo));
+    EXPECT_ANY_THROW(StrA->div(FloatTwo2));
+    EXPECT_ANY_THROW(StrA->div(Float2_5));
+    EXPECT_ANY_THROW(StrA->div(Float_23_74));
+    EXPECT_ANY_THROW(StrA->div(StrEmpty));
+    EXPECT_ANY_THROW(StrA->div(StrEmpty2));
+    EXPECT_ANY_THROW(StrA->div(StrA));
+    EXPECT_ANY_THROW(StrA->div(StrA2));
+    EXPECT_ANY_THROW(StrA->div(StrB));
+    EXPECT_ANY_THROW(StrA->div(ListEmpty));
+    EXPECT_ANY_THROW(StrA->div(ListEmpty2));
+    EXPECT_ANY_THROW(StrA2->div(None));
+    EXPECT_ANY_THROW(StrA2->div(None2));
+    EXPECT_ANY_THROW(StrA2->div(False));
+    EXPECT_ANY_THROW(StrA2->div(False2));
+    EXPECT_ANY_THROW(StrA2->div(True));
+    EXPECT_ANY_THROW(StrA2->div(True2));
+    EXPECT_ANY_THROW(StrA2->div(IntZero));
+    EXPECT_ANY_THROW(StrA2->div(IntOne));
+    EXPECT_ANY_THROW(StrA2->div(IntTwo));
+    EXPECT_ANY_THROW(StrA2->div(IntTwo2));
+    EXPECT_ANY_THROW(StrA2->div(Int8));
+    EXPECT_ANY_THROW(StrA2->div(IntMinusOne));
+    EXPECT_ANY_THROW(StrA2->div(IntMinusOne2));
+    EXPECT_ANY_THROW(StrA2->div(IntMinus12));
+    EXPECT_ANY_THROW(StrA2->div(IntMinus73));
+    EXPECT_ANY_THROW(StrA2->div(FloatMinusOne));
+    EXPECT_ANY_THROW(StrA2->div(FloatZero));
+    EXPECT_ANY_THROW(StrA2->div(FloatOne));
+    EXPECT_ANY_THROW(StrA2->div(FloatTwo));
+    EXPECT_ANY_THROW(StrA2->div(FloatTwo2));
+    EXPECT_ANY_THROW(StrA2->div(Float2_5));
+    EXPECT_ANY_THROW(StrA2->div(Float_23_74));
+    EXPECT_ANY_THROW(StrA2->div(StrEmpty));
+    EXPECT_ANY_THROW(StrA2->div(StrEmpty2));
+    EXPECT_ANY_THROW(StrA2->div(StrA));
+    EXPECT_ANY_THROW(StrA2->div(StrA2));
+    EXPECT_ANY_THROW(StrA2->div(StrB));
+    EXPECT_ANY_THROW(StrA2->div(ListEmpty));
+    EXPECT_ANY_THROW(StrA2->div(ListEmpty2));
+    EXPECT_ANY_THROW(StrB->div(None));
+    EXPECT_ANY_THROW(StrB->div(None2));
+    EXPECT_ANY_THROW(StrB->div(False));
+    EXPECT_ANY_THROW(StrB->div(False2));
+    EXPECT_ANY_THROW(StrB->div(True));
+    EXPECT_ANY_THROW(StrB->div(True2));
+    EXPECT_ANY_THROW(StrB->div(IntZero));
+    EXPECT_ANY_THROW(StrB->div(IntOne));
+    EXPECT_ANY_THROW(StrB->div(IntTwo));
+    EXPECT_ANY_THROW(StrB->div(IntTwo2));
+    EXPECT_ANY_THROW(StrB->div(Int8));
+    EXPECT_ANY_THROW(StrB->div(IntMinusOne));
+    EXPECT_ANY_THROW(StrB->div(IntMinusOne2));
+    EXPECT_ANY_THROW(StrB->div(IntMinus12));
+    EXPECT_ANY_THROW(StrB->div(IntMinus73));
+    EXPECT_ANY_THROW(StrB->div(FloatMinusOne));
+    EXPECT_ANY_THROW(StrB->div(FloatZero));
+    EXPECT_ANY_THROW(StrB->div(FloatOne));
+    EXPECT_ANY_THROW(StrB->div(FloatTwo));
+    EXPECT_ANY_THROW(StrB->div(FloatTwo2));
+    EXPECT_ANY_THROW(StrB->div(Float2_5));
+    EXPECT_ANY_THROW(StrB->div(Float_23_74));
+    EXPECT_ANY_THROW(StrB->div(StrEmpty));
+    EXPECT_ANY_THROW(StrB->div(StrEmpty2));
+    EXPECT_ANY_THROW(StrB->div(StrA));
+    EXPECT_ANY_THROW(StrB->div(StrA2));
+    EXPECT_ANY_THROW(StrB->div(StrB));
+    EXPECT_ANY_THROW(StrB->div(ListEmpty));
+    EXPECT_ANY_THROW(StrB->div(ListEmpty2));
+    EXPECT_ANY_THROW(ListEmpty->div(None));
+    EXPECT_ANY_THROW(ListEmpty->div(None2));
+    EXPECT_ANY_THROW(ListEmpty->div(False));
+    EXPECT_ANY_THROW(ListEmpty->div(False2));
+    EXPECT_ANY_THROW(ListEmpty->div(True));
+    EXPECT_ANY_THROW(ListEmpty->div(True2));
+    EXPECT_ANY_THROW(ListEmpty->div(IntZero));
+    EXPECT_ANY_THROW(ListEmpty->div(IntOne));
+    EXPECT_ANY_THROW(ListEmpty->div(IntTwo));
+    EXPECT_ANY_THROW(ListEmpty->div(IntTwo2));
+    EXPECT_ANY_THROW(ListEmpty->div(Int8));
+    EXPECT_ANY_THROW(ListEmpty->div(IntMinusOne));
+    EXPECT_ANY_THROW(ListEmpty->div(IntMinusOne2));
+    EXPECT_ANY_THROW(ListEmpty->div(IntMinus12));
+    EXPECT_ANY_THROW(ListEmpty->div(IntMinus73));
+    EXPECT_ANY_THROW(ListEmpty->div(FloatMinusOne));
+    EXPECT_ANY_THROW(ListEmpty->div(FloatZero));
+    EXPECT_ANY_THROW(ListEmpty->div(FloatOne));
+    EXPECT_ANY_THROW(ListEmpty->div(FloatTwo));
+    EXPECT_ANY_THROW(ListEmpty->div(FloatTwo2));
+    EXPECT_ANY_THROW(ListEmpty->div(Float2_5));
+    EXPECT_ANY_THROW(ListEmpty->div(Float_23_74));
+    EXPECT_ANY_THROW(ListEmpty->div(StrEmpty));
+    EXPECT_ANY_THROW(ListEmpty->div(StrEmpty2));
+    EXPECT_ANY_THROW(ListEmpty->div(StrA));
+    EXPECT_ANY_THROW(ListEmpty->div(StrA2));
+    EXPECT_ANY_THROW(ListEmpty->div(StrB));
+    EXPECT_ANY_THROW(ListEmpty->div(ListEmpty));
+    EXPECT_ANY_THROW(ListEmpty->div(ListEmpty2));
+    EXPECT_ANY_THROW(ListEmpty2->div(None));
+    EXPECT_ANY_THROW(ListEmpty2->div(None2));
+    EXPECT_ANY_THROW(ListEmpty2->div(False));
+    EXPECT_ANY_THROW(ListEmpty2->div(False2));
+    EXPECT_ANY_THROW(ListEmpty2->div(True));
+    EXPECT_ANY_THROW(ListEmpty2->div(True2));
+    EXPECT_ANY_THROW(ListEmpty2->div(IntZero));
+    EXPECT_ANY_THROW(ListEmpty2->div(IntOne));
+    EXPECT_ANY_THROW(ListEmpty2->div(IntTwo));
+    EXPECT_ANY_THROW(ListEmpty2->div(IntTwo2));
+    EXPECT_ANY_THROW(ListEmpty2->div(Int8));
+    EXPECT_ANY_THROW(ListEmpty2->div(IntMinusOne));
+    EXPECT_ANY_THROW(ListEmpty2->div(IntMinusOne2));
+    EXPECT_ANY_THROW(ListEmpty2->div(IntMinus12));
+    EXPECT_ANY_THROW(ListEmpty2->div(IntMinus73));
+    EXPECT_ANY_THROW(ListEmpty2->div(FloatMinusOne));
+    EXPECT_ANY_THROW(ListEmpty2->div(FloatZero));
+    EXPECT_ANY_THROW(ListEmpty2->div(FloatOne));
+    EXPECT_ANY_THROW(ListEmpty2->div(FloatTwo));
+    EXPECT_ANY_THROW(ListEmpty2->div(FloatTwo2));
+    EXPECT_ANY_THROW(ListEmpty2->div(Float2_5));
+    EXPECT_ANY_THROW(ListEmpty2->div(Float_23_74));
+    EXPECT_ANY_THROW(ListEmpty2->div(StrEmpty));
+    EXPECT_ANY_THROW(ListEmpty2->div(StrEmpty2));
+    EXPECT_ANY_THROW(ListEmpty2->div(StrA));
+    EXPECT_ANY_THROW(ListEmpty2->div(StrA2));
+    EXPECT_ANY_THROW(ListEmpty2->div(StrB));
+    EXPECT_ANY_THROW(ListEmpty2->div(ListEmpty));
+    EXPECT_ANY_THROW(ListEmpty2->div(ListEmpty2));
+}
@@ -0,0 +1,962 @@
+
+#include "variable/Variable.h"
+
+#include "Test.h"
+
+#define VAR(TYPE, VALUE) \
+    std::static_pointer_cast<GenericVariable>(std::make_shared<TYPE ## Variable>(VALUE))
+
+enum class OpReturningVar {
+    add,
+    sub,
+    mul,
+    div,
+    int_div,
+    pow,
+    mod,
+};
+
+enum class AssertResult {
+    PASS,
+    FAIL,
+    EXCEPTION,
+};
+
+static std::ostream& operator<< (std::ostream& os, AssertResult res) {
+    switch (res) {
+    case AssertResult::PASS:       os << "PASS";      break;
+    case AssertResult::FAIL:       os << "FAIL";      break;
+    case AssertResult::EXCEPTION:  os << "EXCEPTION"; break;
+    default:                       os << "???";
+    }
+    return os;
+}
+
+static Variable doOpReturningVar(Variable arg1, Variable arg2, OpReturningVar op) {
+    switch(op) {
+    case OpReturningVar::add: return arg1->add(arg2);
+    case OpReturningVar::sub: return arg1->sub(arg2);
+    case OpReturningVar::mul: return arg1->mul(arg2);
+    case OpReturningVar::div: return arg1->div(arg2);
+    case OpReturningVar::int_div: return arg1->int_div(arg2);
+    case OpReturningVar::mod: return arg1->mod(arg2);
+    case OpReturningVar::pow: return arg1->pow(arg2);
+    default: throw std::runtime_error("Bad op");
+    }
+}
+
+static void doOpReturningVarAndCompareResult(Variable arg1, Variable arg2, OpReturningVar op, Variable expected_res, AssertResult a_res, const char *descr) {
+    try {
+        auto res_var = doOpReturningVar(arg1, arg2, op);
+        auto assertion_result = res_var->strictly_equal(expected_res) ? AssertResult::PASS : AssertResult::FAIL;
+        if (assertion_result != a_res) {
+            std::cerr << descr << " returned " << assertion_result << " instead of " << a_res << "\n";
+        }
+    }
+    catch(...) {
+        if (a_res != AssertResult::EXCEPTION) {
+            std::cerr << descr << " returned EXCEPTION instead of " << a_res << "\n";
+        }
+    }
+}
+
+enum class OpReturningBool {
+    equal,
+    less,
+};
+
+static bool doOpReturningBool(Variable arg1, Variable arg2, OpReturningBool op) {
+    switch(op) {
+    case OpReturningBool::equal: return arg1->equal(arg2);
+    case OpReturningBool::less: return arg1->less(arg2);
+    default: throw std::runtime_error("Bad op");
+    }
+}
+
+static void doOpReturningBoolAndCompareResult(Variable arg1, Variable arg2, OpReturningBool op, bool expected_res, AssertResult a_res, const char *descr) {
+    try {
+        auto assertion_result = doOpReturningBool(arg1, arg2, op) ? AssertResult::PASS : AssertResult::FAIL;
+        if (assertion_result != a_res) {
+            std::cerr << descr << " returned " << assertion_result << " instead of " << a_res << "\n";
+        }
+    }
+    catch(...) {
+        if (a_res != AssertResult::EXCEPTION) {
+            std::cerr << descr << " returned EXCEPTION instead of " << a_res << "\n";
+        }
+    }
+}
+
+static auto None = std::static_pointer_cast<GenericVariable>(std::make_shared<NoneVariable>());
+static auto None2 = std::static_pointer_cast<GenericVariable>(std::make_shared<NoneVariable>());
+static auto False = VAR(Bool, false);
+static auto False2 = VAR(Bool, false);
+static auto True = VAR(Bool, true);
+static auto True2 = VAR(Bool, true);
+static auto IntZero = VAR(Int, 0);
+static auto IntOne = VAR(Int, 1);
+static auto IntTwo = VAR(Int, 2);
+static auto IntTwo2 = VAR(Int, 2);
+static auto Int8 = VAR(Int, 8);
+static auto IntMinusOne = VAR(Int, -1);
+static auto IntMinusOne2 = VAR(Int, -1);
+static auto IntMinus12 = VAR(Int, -12);
+static auto IntMinus73 = VAR(Int, -73);
+static auto FloatMinusOne = VAR(Float, -1);
+static auto FloatZero = VAR(Float, 0);
+static auto FloatOne = VAR(Float, 1);
+static auto FloatTwo = VAR(Float, 2);
+static auto FloatTwo2 = VAR(Float, 2);
+static auto Float2_5 = VAR(Float, 2.5);
+static auto Float_23_74 = VAR(Float, -23.74);
+static auto StrEmpty = VAR(String, "");
+static auto StrEmpty2 = VAR(String, "");
+static auto StrA = VAR(String, "some text");
+static auto StrA2 = VAR(String, "some text");
+static auto StrB = VAR(String, "other text");
+static auto ListEmpty = VAR(List, ListType());
+static auto ListEmpty2 = VAR(List, ListType());
+
+void test_variable_equal() {
+    doOpReturningBoolAndCompareResult(None, None, OpReturningBool::equal, true, AssertResult::PASS, "None->equal(None)");
+    doOpReturningBoolAndCompareResult(None, None2, OpReturningBool::equal, true, AssertResult::PASS, "None->equal(None2)");
+    doOpReturningBoolAndCompareResult(None, False, OpReturningBool::equal, false, AssertResult::FAIL, "None->equal(False)");
+    doOpReturningBoolAndCompareResult(None, False2, OpReturningBool::equal, false, AssertResult::FAIL, "None->equal(False2)");
+    doOpReturningBoolAndCompareResult(None, True, OpReturningBool::equal, false, AssertResult::FAIL, "None->equal(True)");
+    doOpReturningBoolAndCompareResult(None, True2, OpReturningBool::equal, false, AssertResult::FAIL, "None->equal(True2)");
+    doOpReturningBoolAndCompareResult(None, IntZero, OpReturningBool::equal, false, AssertResult::FAIL, "None->equal(IntZero)");
+    doOpReturningBoolAndCompareResult(None, IntOne, OpReturningBool::equal, false, AssertResult::FAIL, "None->equal(IntOne)");
+    doOpReturningBoolAndCompareResult(None, IntTwo, OpReturningBool::equal, false, AssertResult::FAIL, "None->equal(IntTwo)");
+    doOpReturningBoolAndCompareResult(None, IntTwo2, OpReturningBool::equal, false, AssertResult::FAIL, "None->equal(IntTwo2)");
+    doOpReturningBoolAndCompareResult(None, Int8, OpReturningBool::equal, false, AssertResult::FAIL, "None->equal(Int8)");
+    doOpReturningBoolAndCompareResult(None, IntMinusOne, OpReturningBool::equal, false, AssertResult::FAIL, "None->equal(IntMinusOne)");
+    doOpReturningBoolAndCompareResult(None, IntMinusOne2, OpReturningBool::equal, false, AssertResult::FAIL, "None->equal(IntMinusOne2)");
+    doOpReturningBoolAndCompareResult(None, IntMinus12, OpReturningBool::equal, false, AssertResult::FAIL, "None->equal(IntMinus12)");
+    doOpReturningBoolAndCompareResult(None, IntMinus73, OpReturningBool::equal, false, AssertResult::FAIL, "None->equal(IntMinus73)");
+    doOpReturningBoolAndCompareResult(None, FloatMinusOne, OpReturningBool::equal, false, AssertResult::FAIL, "None->equal(FloatMinusOne)");
+    doOpReturningBoolAndCompareResult(None, FloatZero, OpReturningBool::equal, false, AssertResult::FAIL, "None->equal(FloatZero)");
+    doOpReturningBoolAndCompareResult(None, FloatOne, OpReturningBool::equal, false, AssertResult::FAIL, "None->equal(FloatOne)");
+    doOpReturningBoolAndCompareResult(None, FloatTwo, OpReturningBool::equal, false, AssertResult::FAIL, "None->equal(FloatTwo)");
+    doOpReturningBoolAndCompareResult(None, FloatTwo2, OpReturningBool::equal, false, AssertResult::FAIL, "None->equal(FloatTwo2)");
+    doOpReturningBoolAndCompareResult(None, Float2_5, OpReturningBool::equal, false, AssertResult::FAIL, "None->equal(Float2_5)");
+    doOpReturningBoolAndCompareResult(None, Float_23_74, OpReturningBool::equal, false, AssertResult::FAIL, "None->equal(Float_23_74)");
+    doOpReturningBoolAndCompareResult(None, StrEmpty, OpReturningBool::equal, false, AssertResult::FAIL, "None->equal(StrEmpty)");
+    doOpReturningBoolAndCompareResult(None, StrEmpty2, OpReturningBool::equal, false, AssertResult::FAIL, "None->equal(StrEmpty2)");
+    doOpReturningBoolAndCompareResult(None, StrA, OpReturningBool::equal, false, AssertResult::FAIL, "None->equal(StrA)");
+    doOpReturningBoolAndCompareResult(None, StrA2, OpReturningBool::equal, false, AssertResult::FAIL, "None->equal(StrA2)");
+    doOpReturningBoolAndCompareResult(None, StrB, OpReturningBool::equal, false, AssertResult::FAIL, "None->equal(StrB)");
+    doOpReturningBoolAndCompareResult(None, ListEmpty, OpReturningBool::equal, false, AssertResult::FAIL, "None->equal(ListEmpty)");
+    doOpReturningBoolAndCompareResult(None, ListEmpty2, OpReturningBool::equal, false, AssertResult::FAIL, "None->equal(ListEmpty2)");
+    doOpReturningBoolAndCompareResult(None2, None, OpReturningBool::equal, true, AssertResult::PASS, "None2->equal(None)");
+    doOpReturningBoolAndCompareResult(None2, None2, OpReturningBool::equal, true, AssertResult::PASS, "None2->equal(None2)");
+    doOpReturningBoolAndCompareResult(None2, False, OpReturningBool::equal, false, AssertResult::FAIL, "None2->equal(False)");
+    doOpReturningBoolAndCompareResult(None2, False2, OpReturningBool::equal, false, AssertResult::FAIL, "None2->equal(False2)");
+    doOpReturningBoolAndCompareResult(None2, True, OpReturningBool::equal, false, AssertResult::FAIL, "None2->equal(True)");
+    doOpReturningBoolAndCompareResult(None2, True2, OpReturningBool::equal, false, AssertResult::FAIL, "None2->equal(True2)");
+    doOpReturningBoolAndCompareResult(None2, IntZero, OpReturningBool::equal, false, AssertResult::FAIL, "None2->equal(IntZero)");
+    doOpReturningBoolAndCompareResult(None2, IntOne, OpReturningBool::equal, false, AssertResult::FAIL, "None2->equal(IntOne)");
+    doOpReturningBoolAndCompareResult(None2, IntTwo, OpReturningBool::equal, false, AssertResult::FAIL, "None2->equal(IntTwo)");
+    doOpReturningBoolAndCompareResult(None2, IntTwo2, OpReturningBool::equal, false, AssertResult::FAIL, "None2->equal(IntTwo2)");
+    doOpReturningBoolAndCompareResult(None2, Int8, OpReturningBool::equal, false, AssertResult::FAIL, "None2->equal(Int8)");
+    doOpReturningBoolAndCompareResult(None2, IntMinusOne, OpReturningBool::equal, false, AssertResult::FAIL, "None2->equal(IntMinusOne)");
+    doOpReturningBoolAndCompareResult(None2, IntMinusOne2, OpReturningBool::equal, false, AssertResult::FAIL, "None2->equal(IntMinusOne2)");
+    doOpReturningBoolAndCompareResult(None2, IntMinus12, OpReturningBool::equal, false, AssertResult::FAIL, "None2->equal(IntMinus12)");
+    doOpReturningBoolAndCompareResult(None2, IntMinus73, OpReturningBool::equal, false, AssertResult::FAIL, "None2->equal(IntMinus73)");
+    doOpReturningBoolAndCompareResult(None2, FloatMinusOne, OpReturningBool::equal, false, AssertResult::FAIL, "None2->equal(FloatMinusOne)");
+    doOpReturningBoolAndCompareResult(None2, FloatZero, OpReturningBool::equal, false, AssertResult::FAIL, "None2->equal(FloatZero)");
+    doOpReturningBoolAndCompareResult(None2, FloatOne, OpReturningBool::equal, false, AssertResult::FAIL, "None2->equal(FloatOne)");
+    doOpReturningBoolAndCompareResult(None2, FloatTwo, OpReturningBool::equal, false, AssertResult::FAIL, "None2->equal(FloatTwo)");
+    doOpReturningBoolAndCompareResult(None2, FloatTwo2, OpReturningBool::equal, false, AssertResult::FAIL, "None2->equal(FloatTwo2)");
+    doOpReturningBoolAndCompareResult(None2, Float2_5, OpReturningBool::equal, false, AssertResult::FAIL, "None2->equal(Float2_5)");
+    doOpReturningBoolAndCompareResult(None2, Float_23_74, OpReturningBool::equal, false, AssertResult::FAIL, "None2->equal(Float_23_74)");
+    doOpReturningBoolAndCompareResult(None2, StrEmpty, OpReturningBool::equal, false, AssertResult::FAIL, "None2->equal(StrEmpty)");
+    doOpReturningBoolAndCompareResult(None2, StrEmpty2, OpReturningBool::equal, false, AssertResult::FAIL, "None2->equal(StrEmpty2)");
+    doOpReturningBoolAndCompareResult(None2, StrA, OpReturningBool::equal, false, AssertResult::FAIL, "None2->equal(StrA)");
+    doOpReturningBoolAndCompareResult(None2, StrA2, OpReturningBool::equal, false, AssertResult::FAIL, "None2->equal(StrA2)");
+    doOpReturningBoolAndCompareResult(None2, StrB, OpReturningBool::equal, false, AssertResult::FAIL, "None2->equal(StrB)");
+    doOpReturningBoolAndCompareResult(None2, ListEmpty, OpReturningBool::equal, false, AssertResult::FAIL, "None2->equal(ListEmpty)");
+    doOpReturningBoolAndCompareResult(None2, ListEmpty2, OpReturningBool::equal, false, AssertResult::FAIL, "None2->equal(ListEmpty2)");
+    doOpReturningBoolAndCompareResult(False, None, OpReturningBool::equal, false, AssertResult::FAIL, "False->equal(None)");
+    doOpReturningBoolAndCompareResult(False, None2, OpReturningBool::equal, false, AssertResult::FAIL, "False->equal(None2)");
+    doOpReturningBoolAndCompareResult(False, False, OpReturningBool::equal, true, AssertResult::PASS, "False->equal(False)");
+    doOpReturningBoolAndCompareResult(False, False2, OpReturningBool::equal, true, AssertResult::PASS, "False->equal(False2)");
+    doOpReturningBoolAndCompareResult(False, True, OpReturningBool::equal, false, AssertResult::FAIL, "False->equal(True)");
+    doOpReturningBoolAndCompareResult(False, True2, OpReturningBool::equal, false, AssertResult::FAIL, "False->equal(True2)");
+    doOpReturningBoolAndCompareResult(False, IntZero, OpReturningBool::equal, true, AssertResult::PASS, "False->equal(IntZero)");
+    doOpReturningBoolAndCompareResult(False, IntOne, OpReturningBool::equal, false, AssertResult::FAIL, "False->equal(IntOne)");
+    doOpReturningBoolAndCompareResult(False, IntTwo, OpReturningBool::equal, false, AssertResult::FAIL, "False->equal(IntTwo)");
+    doOpReturningBoolAndCompareResult(False, IntTwo2, OpReturningBool::equal, false, AssertResult::FAIL, "False->equal(IntTwo2)");
+    doOpReturningBoolAndCompareResult(False, Int8, OpReturningBool::equal, false, AssertResult::FAIL, "False->equal(Int8)");
+    doOpReturningBoolAndCompareResult(False, IntMinusOne, OpReturningBool::equal, false, AssertResult::FAIL, "False->equal(IntMinusOne)");
+    doOpReturningBoolAndCompareResult(False, IntMinusOne2, OpReturningBool::equal, false, AssertResult::FAIL, "False->equal(IntMinusOne2)");
+    doOpReturningBoolAndCompareResult(False, IntMinus12, OpReturningBool::equal, false, AssertResult::FAIL, "False->equal(IntMinus12)");
+    doOpReturningBoolAndCompareResult(False, IntMinus73, OpReturningBool::equal, false, AssertResult::FAIL, "False->equal(IntMinus73)");
+    doOpReturningBoolAndCompareResult(False, FloatMinusOne, OpReturningBool::equal, false, AssertResult::FAIL, "False->equal(FloatMinusOne)");
+    doOpReturningBoolAndCompareResult(False, FloatZero, OpReturningBool::equal, true, AssertResult::PASS, "False->equal(FloatZero)");
+    doOpReturningBoolAndCompareResult(False, FloatOne, OpReturningBool::equal, false, AssertResult::FAIL, "False->equal(FloatOne)");
+    doOpReturningBoolAndCompareResult(False, FloatTwo, OpReturningBool::equal, false, AssertResult::FAIL, "False->equal(FloatTwo)");
+    doOpReturningBoolAndCompareResult(False, FloatTwo2, OpReturningBool::equal, false, AssertResult::FAIL, "False->equal(FloatTwo2)");
+    doOpReturningBoolAndCompareResult(False, Float2_5, OpReturningBool::equal, false, AssertResult::FAIL, "False->equal(Float2_5)");
+    doOpReturningBoolAndCompareResult(False, Float_23_74, OpReturningBool::equal, false, AssertResult::FAIL, "False->equal(Float_23_74)");
+    doOpReturningBoolAndCompareResult(False, StrEmpty, OpReturningBool::equal, false, AssertResult::FAIL, "False->equal(StrEmpty)");
+    doOpReturningBoolAndCompareResult(False, StrEmpty2, OpReturningBool::equal, false, AssertResult::FAIL, "False->equal(StrEmpty2)");
+    doOpReturningBoolAndCompareResult(False, StrA, OpReturningBool::equal, false, AssertResult::FAIL, "False->equal(StrA)");
+    doOpReturningBoolAndCompareResult(False, StrA2, OpReturningBool::equal, false, AssertResult::FAIL, "False->equal(StrA2)");
+    doOpReturningBoolAndCompareResult(False, StrB, OpReturningBool::equal, false, AssertResult::FAIL, "False->equal(StrB)");
+    doOpReturningBoolAndCompareResult(False, ListEmpty, OpReturningBool::equal, false, AssertResult::FAIL, "False->equal(ListEmpty)");
+    doOpReturningBoolAndCompareResult(False, ListEmpty2, OpReturningBool::equal, false, AssertResult::FAIL, "False->equal(ListEmpty2)");
+    doOpReturningBoolAndCompareResult(False2, None, OpReturningBool::equal, false, AssertResult::FAIL, "False2->equal(None)");
+    doOpReturningBoolAndCompareResult(False2, None2, OpReturningBool::equal, false, AssertResult::FAIL, "False2->equal(None2)");
+    doOpReturningBoolAndCompareResult(False2, False, OpReturningBool::equal, true, AssertResult::PASS, "False2->equal(False)");
+    doOpReturningBoolAndCompareResult(False2, False2, OpReturningBool::equal, true, AssertResult::PASS, "False2->equal(False2)");
+    doOpReturningBoolAndCompareResult(False2, True, OpReturningBool::equal, false, AssertResult::FAIL, "False2->equal(True)");
+    doOpReturningBoolAndCompareResult(False2, True2, OpReturningBool::equal, false, AssertResult::FAIL, "False2->equal(True2)");
+    doOpReturningBoolAndCompareResult(False2, IntZero, OpReturningBool::equal, true, AssertResult::PASS, "False2->equal(IntZero)");
+    doOpReturningBoolAndCompareResult(False2, IntOne, OpReturningBool::equal, false, AssertResult::FAIL, "False2->equal(IntOne)");
+    doOpReturningBoolAndCompareResult(False2, IntTwo, OpReturningBool::equal, false, AssertResult::FAIL, "False2->equal(IntTwo)");
+    doOpReturningBoolAndCompareResult(False2, IntTwo2, OpReturningBool::equal, false, AssertResult::FAIL, "False2->equal(IntTwo2)");
+    doOpReturningBoolAndCompareResult(False2, Int8, OpReturningBool::equal, false, AssertResult::FAIL, "False2->equal(Int8)");
+    doOpReturningBoolAndCompareResult(False2, IntMinusOne, OpReturningBool::equal, false, AssertResult::FAIL, "False2->equal(IntMinusOne)");
+    doOpReturningBoolAndCompareResult(False2, IntMinusOne2, OpReturningBool::equal, false, AssertResult::FAIL, "False2->equal(IntMinusOne2)");
+    doOpReturningBoolAndCompareResult(False2, IntMinus12, OpReturningBool::equal, false, AssertResult::FAIL, "False2->equal(IntMinus12)");
+    doOpReturningBoolAndCompareResult(False2, IntMinus73, OpReturningBool::equal, false, AssertResult::FAIL, "False2->equal(IntMinus73)");
+    doOpReturningBoolAndCompareResult(False2, FloatMinusOne, OpReturningBool::equal, false, AssertResult::FAIL, "False2->equal(FloatMinusOne)");
+    doOpReturningBoolAndCompareResult(False2, FloatZero, OpReturningBool::equal, true, AssertResult::PASS, "False2->equal(FloatZero)");
+    doOpReturningBoolAndCompareResult(False2, FloatOne, OpReturningBool::equal, false, AssertResult::FAIL, "False2->equal(FloatOne)");
+    doOpReturningBoolAndCompareResult(False2, FloatTwo, OpReturningBool::equal, false, AssertResult::FAIL, "False2->equal(FloatTwo)");
+    doOpReturningBoolAndCompareResult(False2, FloatTwo2, OpReturningBool::equal, false, AssertResult::FAIL, "False2->equal(FloatTwo2)");
+    doOpReturningBoolAndCompareResult(False2, Float2_5, OpReturningBool::equal, false, AssertResult::FAIL, "False2->equal(Float2_5)");
+    doOpReturningBoolAndCompareResult(False2, Float_23_74, OpReturningBool::equal, false, AssertResult::FAIL, "False2->equal(Float_23_74)");
+    doOpReturningBoolAndCompareResult(False2, StrEmpty, OpReturningBool::equal, false, AssertResult::FAIL, "False2->equal(StrEmpty)");
+    doOpReturningBoolAndCompareResult(False2, StrEmpty2, OpReturningBool::equal, false, AssertResult::FAIL, "False2->equal(StrEmpty2)");
+    doOpReturningBoolAndCompareResult(False2, StrA, OpReturningBool::equal, false, AssertResult::FAIL, "False2->equal(StrA)");
+    doOpReturningBoolAndCompareResult(False2, StrA2, OpReturningBool::equal, false, AssertResult::FAIL, "False2->equal(StrA2)");
+    doOpReturningBoolAndCompareResult(False2, StrB, OpReturningBool::equal, false, AssertResult::FAIL, "False2->equal(StrB)");
+    doOpReturningBoolAndCompareResult(False2, ListEmpty, OpReturningBool::equal, false, AssertResult::FAIL, "False2->equal(ListEmpty)");
+    doOpReturningBoolAndCompareResult(False2, ListEmpty2, OpReturningBool::equal, false, AssertResult::FAIL, "False2->equal(ListEmpty2)");
+    doOpReturningBoolAndCompareResult(True, None, OpReturningBool::equal, false, AssertResult::FAIL, "True->equal(None)");
+    doOpReturningBoolAndCompareResult(True, None2, OpReturningBool::equal, false, AssertResult::FAIL, "True->equal(None2)");
+    doOpReturningBoolAndCompareResult(True, False, OpReturningBool::equal, false, AssertResult::FAIL, "True->equal(False)");
+    doOpReturningBoolAndCompareResult(True, False2, OpReturningBool::equal, false, AssertResult::FAIL, "True->equal(False2)");
+    doOpReturningBoolAndCompareResult(True, True, OpReturningBool::equal, true, AssertResult::PASS, "True->equal(True)");
+    doOpReturningBoolAndCompareResult(True, True2, OpReturningBool::equal, true, AssertResult::PASS, "True->equal(True2)");
+    doOpReturningBoolAndCompareResult(True, IntZero, OpReturningBool::equal, false, AssertResult::FAIL, "True->equal(IntZero)");
+    doOpReturningBoolAndCompareResult(True, IntOne, OpReturningBool::equal, true, AssertResult::PASS, "True->equal(IntOne)");
+    doOpReturningBoolAndCompareResult(True, IntTwo, OpReturningBool::equal, false, AssertResult::FAIL, "True->equal(IntTwo)");
+    doOpReturningBoolAndCompareResult(True, IntTwo2, OpReturningBool::equal, false, AssertResult::FAIL, "True->equal(IntTwo2)");
+    doOpReturningBoolAndCompareResult(True, Int8, OpReturningBool::equal, false, AssertResult::FAIL, "True->equal(Int8)");
+    doOpReturningBoolAndCompareResult(True, IntMinusOne, OpReturningBool::equal, false, AssertResult::FAIL, "True->equal(IntMinusOne)");
+    doOpReturningBoolAndCompareResult(True, IntMinusOne2, OpReturningBool::equal, false, AssertResult::FAIL, "True->equal(IntMinusOne2)");
+    doOpReturningBoolAndCompareResult(True, IntMinus12, OpReturningBool::equal, false, AssertResult::FAIL, "True->equal(IntMinus12)");
+    doOpReturningBoolAndCompareResult(True, IntMinus73, OpReturningBool::equal, false, AssertResult::FAIL, "True->equal(IntMinus73)");
+    doOpReturningBoolAndCompareResult(True, FloatMinusOne, OpReturningBool::equal, false, AssertResult::FAIL, "True->equal(FloatMinusOne)");
+    doOpReturningBoolAndCompareResult(True, FloatZero, OpReturningBool::equal, false, AssertResult::FAIL, "True->equal(FloatZero)");
+    doOpReturningBoolAndCompareResult(True, FloatOne, OpReturningBool::equal, true, AssertResult::PASS, "True->equal(FloatOne)");
+    doOpReturningBoolAndCompareResult(True, FloatTwo, OpReturningBool::equal, false, AssertResult::FAIL, "True->equal(FloatTwo)");
+    doOpReturningBoolAndCompareResult(True, FloatTwo2, OpReturningBool::equal, false, AssertResult::FAIL, "True->equal(FloatTwo2)");
+    doOpReturningBoolAndCompareResult(True, Float2_5, OpReturningBool::equal, false, AssertResult::FAIL, "True->equal(Float2_5)");
+    doOpReturningBoolAndCompareResult(True, Float_23_74, OpReturningBool::equal, false, AssertResult::FAIL, "True->equal(Float_23_74)");
+    doOpReturningBoolAndCompareResult(True, StrEmpty, OpReturningBool::equal, false, AssertResult::FAIL, "True->equal(StrEmpty)");
+    doOpReturningBoolAndCompareResult(True, StrEmpty2, OpReturningBool::equal, false, AssertResult::FAIL, "True->equal(StrEmpty2)");
+    doOpReturningBoolAndCompareResult(True, StrA, OpReturningBool::equal, false, AssertResult::FAIL, "True->equal(StrA)");
+    doOpReturningBoolAndCompareResult(True, StrA2, OpReturningBool::equal, false, AssertResult::FAIL, "True->equal(StrA2)");
+    doOpReturningBoolAndCompareResult(True, StrB, OpReturningBool::equal, false, AssertResult::FAIL, "True->equal(StrB)");
+    doOpReturningBoolAndCompareResult(True, ListEmpty, OpReturningBool::equal, false, AssertResult::FAIL, "True->equal(ListEmpty)");
+    doOpReturningBoolAndCompareResult(True, ListEmpty2, OpReturningBool::equal, false, AssertResult::FAIL, "True->equal(ListEmpty2)");
+    doOpReturningBoolAndCompareResult(True2, None, OpReturningBool::equal, false, AssertResult::FAIL, "True2->equal(None)");
+    doOpReturningBoolAndCompareResult(True2, None2, OpReturningBool::equal, false, AssertResult::FAIL, "True2->equal(None2)");
+    doOpReturningBoolAndCompareResult(True2, False, OpReturningBool::equal, false, AssertResult::FAIL, "True2->equal(False)");
+    doOpReturningBoolAndCompareResult(True2, False2, OpReturningBool::equal, false, AssertResult::FAIL, "True2->equal(False2)");
+    doOpReturningBoolAndCompareResult(True2, True, OpReturningBool::equal, true, AssertResult::PASS, "True2->equal(True)");
+    doOpReturningBoolAndCompareResult(True2, True2, OpReturningBool::equal, true, AssertResult::PASS, "True2->equal(True2)");
+    doOpReturningBoolAndCompareResult(True2, IntZero, OpReturningBool::equal, false, AssertResult::FAIL, "True2->equal(IntZero)");
+    doOpReturningBoolAndCompareResult(True2, IntOne, OpReturningBool::equal, true, AssertResult::PASS, "True2->equal(IntOne)");
+    doOpReturningBoolAndCompareResult(True2, IntTwo, OpReturningBool::equal, false, AssertResult::FAIL, "True2->equal(IntTwo)");
+    doOpReturningBoolAndCompareResult(True2, IntTwo2, OpReturningBool::equal, false, AssertResult::FAIL, "True2->equal(IntTwo2)");
+    doOpReturningBoolAndCompareResult(True2, Int8, OpReturningBool::equal, false, AssertResult::FAIL, "True2->equal(Int8)");
+    doOpReturningBoolAndCompareResult(True2, IntMinusOne, OpReturningBool::equal, false, AssertResult::FAIL, "True2->equal(IntMinusOne)");
+    doOpReturningBoolAndCompareResult(True2, IntMinusOne2, OpReturningBool::equal, false, AssertResult::FAIL, "True2->equal(IntMinusOne2)");
+    doOpReturningBoolAndCompareResult(True2, IntMinus12, OpReturningBool::equal, false, AssertResult::FAIL, "True2->equal(IntMinus12)");
+    doOpReturningBoolAndCompareResult(True2, IntMinus73, OpReturningBool::equal, false, AssertResult::FAIL, "True2->equal(IntMinus73)");
+    doOpReturningBoolAndCompareResult(True2, FloatMinusOne, OpReturningBool::equal, false, AssertResult::FAIL, "True2->equal(FloatMinusOne)");
+    doOpReturningBoolAndCompareResult(True2, FloatZero, OpReturningBool::equal, false, AssertResult::FAIL, "True2->equal(FloatZero)");
+    doOpReturningBoolAndCompareResult(True2, FloatOne, OpReturningBool::equal, true, AssertResult::PASS, "True2->equal(FloatOne)");
+    doOpReturningBoolAndCompareResult(True2, FloatTwo, OpReturningBool::equal, false, AssertResult::FAIL, "True2->equal(FloatTwo)");
+    doOpReturningBoolAndCompareResult(True2, FloatTwo2, OpReturningBool::equal, false, AssertResult::FAIL, "True2->equal(FloatTwo2)");
+    doOpReturningBoolAndCompareResult(True2, Float2_5, OpReturningBool::equal, false, AssertResult::FAIL, "True2->equal(Float2_5)");
+    doOpReturningBoolAndCompareResult(True2, Float_23_74, OpReturningBool::equal, false, AssertResult::FAIL, "True2->equal(Float_23_74)");
+    doOpReturningBoolAndCompareResult(True2, StrEmpty, OpReturningBool::equal, false, AssertResult::FAIL, "True2->equal(StrEmpty)");
+    doOpReturningBoolAndCompareResult(True2, StrEmpty2, OpReturningBool::equal, false, AssertResult::FAIL, "True2->equal(StrEmpty2)");
+    doOpReturningBoolAndCompareResult(True2, StrA, OpReturningBool::equal, false, AssertResult::FAIL, "True2->equal(StrA)");
+    doOpReturningBoolAndCompareResult(True2, StrA2, OpReturningBool::equal, false, AssertResult::FAIL, "True2->equal(StrA2)");
+    doOpReturningBoolAndCompareResult(True2, StrB, OpReturningBool::equal, false, AssertResult::FAIL, "True2->equal(StrB)");
+    doOpReturningBoolAndCompareResult(True2, ListEmpty, OpReturningBool::equal, false, AssertResult::FAIL, "True2->equal(ListEmpty)");
+    doOpReturningBoolAndCompareResult(True2, ListEmpty2, OpReturningBool::equal, false, AssertResult::FAIL, "True2->equal(ListEmpty2)");
+    doOpReturningBoolAndCompareResult(IntZero, None, OpReturningBool::equal, false, AssertResult::FAIL, "IntZero->equal(None)");
+    doOpReturningBoolAndCompareResult(IntZero, None2, OpReturningBool::equal, false, AssertResult::FAIL, "IntZero->equal(None2)");
+    doOpReturningBoolAndCompareResult(IntZero, False, OpReturningBool::equal, true, AssertResult::PASS, "IntZero->equal(False)");
+    doOpReturningBoolAndCompareResult(IntZero, False2, OpReturningBool::equal, true, AssertResult::PASS, "IntZero->equal(False2)");
+    doOpReturningBoolAndCompareResult(IntZero, True, OpReturningBool::equal, false, AssertResult::FAIL, "IntZero->equal(True)");
+    doOpReturningBoolAndCompareResult(IntZero, True2, OpReturningBool::equal, false, AssertResult::FAIL, "IntZero->equal(True2)");
+    doOpReturningBoolAndCompareResult(IntZero, IntZero, OpReturningBool::equal, true, AssertResult::PASS, "IntZero->equal(IntZero)");
+    doOpReturningBoolAndCompareResult(IntZero, IntOne, OpReturningBool::equal, false, AssertResult::FAIL, "IntZero->equal(IntOne)");
+    doOpReturningBoolAndCompareResult(IntZero, IntTwo, OpReturningBool::equal, false, AssertResult::FAIL, "IntZero->equal(IntTwo)");
+    doOpReturningBoolAndCompareResult(IntZero, IntTwo2, OpReturningBool::equal, false, AssertResult::FAIL, "IntZero->equal(IntTwo2)");
+    doOpReturningBoolAndCompareResult(IntZero, Int8, OpReturningBool::equal, false, AssertResult::FAIL, "IntZero->equal(Int8)");
+    doOpReturningBoolAndCompareResult(IntZero, IntMinusOne, OpReturningBool::equal, false, AssertResult::FAIL, "IntZero->equal(IntMinusOne)");
+    doOpReturningBoolAndCompareResult(IntZero, IntMinusOne2, OpReturningBool::equal, false, AssertResult::FAIL, "IntZero->equal(IntMinusOne2)");
+    doOpReturningBoolAndCompareResult(IntZero, IntMinus12, OpReturningBool::equal, false, AssertResult::FAIL, "IntZero->equal(IntMinus12)");
+    doOpReturningBoolAndCompareResult(IntZero, IntMinus73, OpReturningBool::equal, false, AssertResult::FAIL, "IntZero->equal(IntMinus73)");
+    doOpReturningBoolAndCompareResult(IntZero, FloatMinusOne, OpReturningBool::equal, false, AssertResult::FAIL, "IntZero->equal(FloatMinusOne)");
+    doOpReturningBoolAndCompareResult(IntZero, FloatZero, OpReturningBool::equal, true, AssertResult::PASS, "IntZero->equal(FloatZero)");
+    doOpReturningBoolAndCompareResult(IntZero, FloatOne, OpReturningBool::equal, false, AssertResult::FAIL, "IntZero->equal(FloatOne)");
+    doOpReturningBoolAndCompareResult(IntZero, FloatTwo, OpReturningBool::equal, false, AssertResult::FAIL, "IntZero->equal(FloatTwo)");
+    doOpReturningBoolAndCompareResult(IntZero, FloatTwo2, OpReturningBool::equal, false, AssertResult::FAIL, "IntZero->equal(FloatTwo2)");
+    doOpReturningBoolAndCompareResult(IntZero, Float2_5, OpReturningBool::equal, false, AssertResult::FAIL, "IntZero->equal(Float2_5)");
+    doOpReturningBoolAndCompareResult(IntZero, Float_23_74, OpReturningBool::equal, false, AssertResult::FAIL, "IntZero->equal(Float_23_74)");
+    doOpReturningBoolAndCompareResult(IntZero, StrEmpty, OpReturningBool::equal, false, AssertResult::FAIL, "IntZero->equal(StrEmpty)");
+    doOpReturningBoolAndCompareResult(IntZero, StrEmpty2, OpReturningBool::equal, false, AssertResult::FAIL, "IntZero->equal(StrEmpty2)");
+    doOpReturningBoolAndCompareResult(IntZero, StrA, OpReturningBool::equal, false, AssertResult::FAIL, "IntZero->equal(StrA)");
+    doOpReturningBoolAndCompareResult(IntZero, StrA2, OpReturningBool::equal, false, AssertResult::FAIL, "IntZero->equal(StrA2)");
+    doOpReturningBoolAndCompareResult(IntZero, StrB, OpReturningBool::equal, false, AssertResult::FAIL, "IntZero->equal(StrB)");
+    doOpReturningBoolAndCompareResult(IntZero, ListEmpty, OpReturningBool::equal, false, AssertResult::FAIL, "IntZero->equal(ListEmpty)");
+    doOpReturningBoolAndCompareResult(IntZero, ListEmpty2, OpReturningBool::equal, false, AssertResult::FAIL, "IntZero->equal(ListEmpty2)");
+    doOpReturningBoolAndCompareResult(IntOne, None, OpReturningBool::equal, false, AssertResult::FAIL, "IntOne->equal(None)");
+    doOpReturningBoolAndCompareResult(IntOne, None2, OpReturningBool::equal, false, AssertResult::FAIL, "IntOne->equal(None2)");
+    doOpReturningBoolAndCompareResult(IntOne, False, OpReturningBool::equal, false, AssertResult::FAIL, "IntOne->equal(False)");
+    doOpReturningBoolAndCompareResult(IntOne, False2, OpReturningBool::equal, false, AssertResult::FAIL, "IntOne->equal(False2)");
+    doOpReturningBoolAndCompareResult(IntOne, True, OpReturningBool::equal, true, AssertResult::PASS, "IntOne->equal(True)");
+    doOpReturningBoolAndCompareResult(IntOne, True2, OpReturningBool::equal, true, AssertResult::PASS, "IntOne->equal(True2)");
+    doOpReturningBoolAndCompareResult(IntOne, IntZero, OpReturningBool::equal, false, AssertResult::FAIL, "IntOne->equal(IntZero)");
+    doOpReturningBoolAndCompareResult(IntOne, IntOne, OpReturningBool::equal, true, AssertResult::PASS, "IntOne->equal(IntOne)");
+    doOpReturningBoolAndCompareResult(IntOne, IntTwo, OpReturningBool::equal, false, AssertResult::FAIL, "IntOne->equal(IntTwo)");
+    doOpReturningBoolAndCompareResult(IntOne, IntTwo2, OpReturningBool::equal, false, AssertResult::FAIL, "IntOne->equal(IntTwo2)");
+    doOpReturningBoolAndCompareResult(IntOne, Int8, OpReturningBool::equal, false, AssertResult::FAIL, "IntOne->equal(Int8)");
+    doOpReturningBoolAndCompareResult(IntOne, IntMinusOne, OpReturningBool::equal, false, AssertResult::FAIL, "IntOne->equal(IntMinusOne)");
+    doOpReturningBoolAndCompareResult(IntOne, IntMinusOne2, OpReturningBool::equal, false, AssertResult::FAIL, "IntOne->equal(IntMinusOne2)");
+    doOpReturningBoolAndCompareResult(IntOne, IntMinus12, OpReturningBool::equal, false, AssertResult::FAIL, "IntOne->equal(IntMinus12)");
+    doOpReturningBoolAndCompareResult(IntOne, IntMinus73, OpReturningBool::equal, false, AssertResult::FAIL, "IntOne->equal(IntMinus73)");
+    doOpReturningBoolAndCompareResult(IntOne, FloatMinusOne, OpReturningBool::equal, false, AssertResult::FAIL, "IntOne->equal(FloatMinusOne)");
+    doOpReturningBoolAndCompareResult(IntOne, FloatZero, OpReturningBool::equal, false, AssertResult::FAIL, "IntOne->equal(FloatZero)");
+    doOpReturningBoolAndCompareResult(IntOne, FloatOne, OpReturningBool::equal, true, AssertResult::PASS, "IntOne->equal(FloatOne)");
+    doOpReturningBoolAndCompareResult(IntOne, FloatTwo, OpReturningBool::equal, false, AssertResult::FAIL, "IntOne->equal(FloatTwo)");
+    doOpReturningBoolAndCompareResult(IntOne, FloatTwo2, OpReturningBool::equal, false, AssertResult::FAIL, "IntOne->equal(FloatTwo2)");
+    doOpReturningBoolAndCompareResult(IntOne, Float2_5, OpReturningBool::equal, false, AssertResult::FAIL, "IntOne->equal(Float2_5)");
+    doOpReturningBoolAndCompareResult(IntOne, Float_23_74, OpReturningBool::equal, false, AssertResult::FAIL, "IntOne->equal(Float_23_74)");
+    doOpReturningBoolAndCompareResult(IntOne, StrEmpty, OpReturningBool::equal, false, AssertResult::FAIL, "IntOne->equal(StrEmpty)");
+    doOpReturningBoolAndCompareResult(IntOne, StrEmpty2, OpReturningBool::equal, false, AssertResult::FAIL, "IntOne->equal(StrEmpty2)");
+    doOpReturningBoolAndCompareResult(IntOne, StrA, OpReturningBool::equal, false, AssertResult::FAIL, "IntOne->equal(StrA)");
+    doOpReturningBoolAndCompareResult(IntOne, StrA2, OpReturningBool::equal, false, AssertResult::FAIL, "IntOne->equal(StrA2)");
+    doOpReturningBoolAndCompareResult(IntOne, StrB, OpReturningBool::equal, false, AssertResult::FAIL, "IntOne->equal(StrB)");
+    doOpReturningBoolAndCompareResult(IntOne, ListEmpty, OpReturningBool::equal, false, AssertResult::FAIL, "IntOne->equal(ListEmpty)");
+    doOpReturningBoolAndCompareResult(IntOne, ListEmpty2, OpReturningBool::equal, false, AssertResult::FAIL, "IntOne->equal(ListEmpty2)");
+    doOpReturningBoolAndCompareResult(IntTwo, None, OpReturningBool::equal, false, AssertResult::FAIL, "IntTwo->equal(None)");
+    doOpReturningBoolAndCompareResult(IntTwo, None2, OpReturningBool::equal, false, AssertResult::FAIL, "IntTwo->equal(None2)");
+    doOpReturningBoolAndCompareResult(IntTwo, False, OpReturningBool::equal, false, AssertResult::FAIL, "IntTwo->equal(False)");
+    doOpReturningBoolAndCompareResult(IntTwo, False2, OpReturningBool::equal, false, AssertResult::FAIL, "IntTwo->equal(False2)");
+    doOpReturningBoolAndCompareResult(IntTwo, True, OpReturningBool::equal, false, AssertResult::FAIL, "IntTwo->equal(True)");
+    doOpReturningBoolAndCompareResult(IntTwo, True2, OpReturningBool::equal, false, AssertResult::FAIL, "IntTwo->equal(True2)");
+    doOpReturningBoolAndCompareResult(IntTwo, IntZero, OpReturningBool::equal, false, AssertResult::FAIL, "IntTwo->equal(IntZero)");
+    doOpReturningBoolAndCompareResult(IntTwo, IntOne, OpReturningBool::equal, false, AssertResult::FAIL, "IntTwo->equal(IntOne)");
+    doOpReturningBoolAndCompareResult(IntTwo, IntTwo, OpReturningBool::equal, true, AssertResult::PASS, "IntTwo->equal(IntTwo)");
+    doOpReturningBoolAndCompareResult(IntTwo, IntTwo2, OpReturningBool::equal, true, AssertResult::PASS, "IntTwo->equal(IntTwo2)");
+    doOpReturningBoolAndCompareResult(IntTwo, Int8, OpReturningBool::equal, false, AssertResult::FAIL, "IntTwo->equal(Int8)");
+    doOpReturningBoolAndCompareResult(IntTwo, IntMinusOne, OpReturningBool::equal, false, AssertResult::FAIL, "IntTwo->equal(IntMinusOne)");
+    doOpReturningBoolAndCompareResult(IntTwo, IntMinusOne2, OpReturningBool::equal, false, AssertResult::FAIL, "IntTwo->equal(IntMinusOne2)");
+    doOpReturningBoolAndCompareResult(IntTwo, IntMinus12, OpReturningBool::equal, false, AssertResult::FAIL, "IntTwo->equal(IntMinus12)");
+    doOpReturningBoolAndCompareResult(IntTwo, IntMinus73, OpReturningBool::equal, false, AssertResult::FAIL, "IntTwo->equal(IntMinus73)");
+    doOpReturningBoolAndCompareResult(IntTwo, FloatMinusOne, OpReturningBool::equal, false, AssertResult::FAIL, "IntTwo->equal(FloatMinusOne)");
+    doOpReturningBoolAndCompareResult(IntTwo, FloatZero, OpReturningBool::equal, false, AssertResult::FAIL, "IntTwo->equal(FloatZero)");
+    doOpReturningBoolAndCompareResult(IntTwo, FloatOne, OpReturningBool::equal, false, AssertResult::FAIL, "IntTwo->equal(FloatOne)");
+    doOpReturningBoolAndCompareResult(IntTwo, FloatTwo, OpReturningBool::equal, true, AssertResult::PASS, "IntTwo->equal(FloatTwo)");
+    doOpReturningBoolAndCompareResult(IntTwo, FloatTwo2, OpReturningBool::equal, true, AssertResult::PASS, "IntTwo->equal(FloatTwo2)");
+    doOpReturningBoolAndCompareResult(IntTwo, Float2_5, OpReturningBool::equal, false, AssertResult::FAIL, "IntTwo->equal(Float2_5)");
+    doOpReturningBoolAndCompareResult(IntTwo, Float_23_74, OpReturningBool::equal, false, AssertResult::FAIL, "IntTwo->equal(Float_23_74)");
+    doOpReturningBoolAndCompareResult(IntTwo, StrEmpty, OpReturningBool::equal, false, AssertResult::FAIL, "IntTwo->equal(StrEmpty)");
+    doOpReturningBoolAndCompareResult(IntTwo, StrEmpty2, OpReturningBool::equal, false, AssertResult::FAIL, "IntTwo->equal(StrEmpty2)");
+    doOpReturningBoolAndCompareResult(IntTwo, StrA, OpReturningBool::equal, false, AssertResult::FAIL, "IntTwo->equal(StrA)");
+    doOpReturningBoolAndCompareResult(IntTwo, StrA2, OpReturningBool::equal, false, AssertResult::FAIL, "IntTwo->equal(StrA2)");
+    doOpReturningBoolAndCompareResult(IntTwo, StrB, OpReturningBool::equal, false, AssertResult::FAIL, "IntTwo->equal(StrB)");
+    doOpReturningBoolAndCompareResult(IntTwo, ListEmpty, OpReturningBool::equal, false, AssertResult::FAIL, "IntTwo->equal(ListEmpty)");
+    doOpReturningBoolAndCompareResult(IntTwo, ListEmpty2, OpReturningBool::equal, false, AssertResult::FAIL, "IntTwo->equal(ListEmpty2)");
+    doOpReturningBoolAndCompareResult(IntTwo2, None, OpReturningBool::equal, false, AssertResult::FAIL, "IntTwo2->equal(None)");
+    doOpReturningBoolAndCompareResult(IntTwo2, None2, OpReturningBool::equal, false, AssertResult::FAIL, "IntTwo2->equal(None2)");
+    doOpReturningBoolAndCompareResult(IntTwo2, False, OpReturningBool::equal, false, AssertResult::FAIL, "IntTwo2->equal(False)");
+    doOpReturningBoolAndCompareResult(IntTwo2, False2, OpReturningBool::equal, false, AssertResult::FAIL, "IntTwo2->equal(False2)");
+    doOpReturningBoolAndCompareResult(IntTwo2, True, OpReturningBool::equal, false, AssertResult::FAIL, "IntTwo2->equal(True)");
+    doOpReturningBoolAndCompareResult(IntTwo2, True2, OpReturningBool::equal, false, AssertResult::FAIL, "IntTwo2->equal(True2)");
+    doOpReturningBoolAndCompareResult(IntTwo2, IntZero, OpReturningBool::equal, false, AssertResult::FAIL, "IntTwo2->equal(IntZero)");
+    doOpReturningBoolAndCompareResult(IntTwo2, IntOne, OpReturningBool::equal, false, AssertResult::FAIL, "IntTwo2->equal(IntOne)");
+    doOpReturningBoolAndCompareResult(IntTwo2, IntTwo, OpReturningBool::equal, true, AssertResult::PASS, "IntTwo2->equal(IntTwo)");
+    doOpReturningBoolAndCompareResult(IntTwo2, IntTwo2, OpReturningBool::equal, true, AssertResult::PASS, "IntTwo2->equal(IntTwo2)");
+    doOpReturningBoolAndCompareResult(IntTwo2, Int8, OpReturningBool::equal, false, AssertResult::FAIL, "IntTwo2->equal(Int8)");
+    doOpReturningBoolAndCompareResult(IntTwo2, IntMinusOne, OpReturningBool::equal, false, AssertResult::FAIL, "IntTwo2->equal(IntMinusOne)");
+    doOpReturningBoolAndCompareResult(IntTwo2, IntMinusOne2, OpReturningBool::equal, false, AssertResult::FAIL, "IntTwo2->equal(IntMinusOne2)");
+    doOpReturningBoolAndCompareResult(IntTwo2, IntMinus12, OpReturningBool::equal, false, AssertResult::FAIL, "IntTwo2->equal(IntMinus12)");
+    doOpReturningBoolAndCompareResult(IntTwo2, IntMinus73, OpReturningBool::equal, false, AssertResult::FAIL, "IntTwo2->equal(IntMinus73)");
+    doOpReturningBoolAndCompareResult(IntTwo2, FloatMinusOne, OpReturningBool::equal, false, AssertResult::FAIL, "IntTwo2->equal(FloatMinusOne)");
+    doOpReturningBoolAndCompareResult(IntTwo2, FloatZero, OpReturningBool::equal, false, AssertResult::FAIL, "IntTwo2->equal(FloatZero)");
+    doOpReturningBoolAndCompareResult(IntTwo2, FloatOne, OpReturningBool::equal, false, AssertResult::FAIL, "IntTwo2->equal(FloatOne)");
+    doOpReturningBoolAndCompareResult(IntTwo2, FloatTwo, OpReturningBool::equal, true, AssertResult::PASS, "IntTwo2->equal(FloatTwo)");
+    doOpReturningBoolAndCompareResult(IntTwo2, FloatTwo2, OpReturningBool::equal, true, AssertResult::PASS, "IntTwo2->equal(FloatTwo2)");
+    doOpReturningBoolAndCompareResult(IntTwo2, Float2_5, OpReturningBool::equal, false, AssertResult::FAIL, "IntTwo2->equal(Float2_5)");
+    doOpReturningBoolAndCompareResult(IntTwo2, Float_23_74, OpReturningBool::equal, false, AssertResult::FAIL, "IntTwo2->equal(Float_23_74)");
+    doOpReturningBoolAndCompareResult(IntTwo2, StrEmpty, OpReturningBool::equal, false, AssertResult::FAIL, "IntTwo2->equal(StrEmpty)");
+    doOpReturningBoolAndCompareResult(IntTwo2, StrEmpty2, OpReturningBool::equal, false, AssertResult::FAIL, "IntTwo2->equal(StrEmpty2)");
+    doOpReturningBoolAndCompareResult(IntTwo2, StrA, OpReturningBool::equal, false, AssertResult::FAIL, "IntTwo2->equal(StrA)");
+    doOpReturningBoolAndCompareResult(IntTwo2, StrA2, OpReturningBool::equal, false, AssertResult::FAIL, "IntTwo2->equal(StrA2)");
+    doOpReturningBoolAndCompareResult(IntTwo2, StrB, OpReturningBool::equal, false, AssertResult::FAIL, "IntTwo2->equal(StrB)");
+    doOpReturningBoolAndCompareResult(IntTwo2, ListEmpty, OpReturningBool::equal, false, AssertResult::FAIL, "IntTwo2->equal(ListEmpty)");
+    doOpReturningBoolAndCompareResult(IntTwo2, ListEmpty2, OpReturningBool::equal, false, AssertResult::FAIL, "IntTwo2->equal(ListEmpty2)");
+    doOpReturningBoolAndCompareResult(Int8, None, OpReturningBool::equal, false, AssertResult::FAIL, "Int8->equal(None)");
+    doOpReturningBoolAndCompareResult(Int8, None2, OpReturningBool::equal, false, AssertResult::FAIL, "Int8->equal(None2)");
+    doOpReturningBoolAndCompareResult(Int8, False, OpReturningBool::equal, false, AssertResult::FAIL, "Int8->equal(False)");
+    doOpReturningBoolAndCompareResult(Int8, False2, OpReturningBool::equal, false, AssertResult::FAIL, "Int8->equal(False2)");
+    doOpReturningBoolAndCompareResult(Int8, True, OpReturningBool::equal, false, AssertResult::FAIL, "Int8->equal(True)");
+    doOpReturningBoolAndCompareResult(Int8, True2, OpReturningBool::equal, false, AssertResult::FAIL, "Int8->equal(True2)");
+    doOpReturningBoolAndCompareResult(Int8, IntZero, OpReturningBool::equal, false, AssertResult::FAIL, "Int8->equal(IntZero)");
+    doOpReturningBoolAndCompareResult(Int8, IntOne, OpReturningBool::equal, false, AssertResult::FAIL, "Int8->equal(IntOne)");
+    doOpReturningBoolAndCompareResult(Int8, IntTwo, OpReturningBool::equal, false, AssertResult::FAIL, "Int8->equal(IntTwo)");
+    doOpReturningBoolAndCompareResult(Int8, IntTwo2, OpReturningBool::equal, false, AssertResult::FAIL, "Int8->equal(IntTwo2)");
+    doOpReturningBoolAndCompareResult(Int8, Int8, OpReturningBool::equal, true, AssertResult::PASS, "Int8->equal(Int8)");
+    doOpReturningBoolAndCompareResult(Int8, IntMinusOne, OpReturningBool::equal, false, AssertResult::FAIL, "Int8->equal(IntMinusOne)");
+    doOpReturningBoolAndCompareResult(Int8, IntMinusOne2, OpReturningBool::equal, false, AssertResult::FAIL, "Int8->equal(IntMinusOne2)");
+    doOpReturningBoolAndCompareResult(Int8, IntMinus12, OpReturningBool::equal, false, AssertResult::FAIL, "Int8->equal(IntMinus12)");
+    doOpReturningBoolAndCompareResult(Int8, IntMinus73, OpReturningBool::equal, false, AssertResult::FAIL, "Int8->equal(IntMinus73)");
+    doOpReturningBoolAndCompareResult(Int8, FloatMinusOne, OpReturningBool::equal, false, AssertResult::FAIL, "Int8->equal(FloatMinusOne)");
+    doOpReturningBoolAndCompareResult(Int8, FloatZero, OpReturningBool::equal, false, AssertResult::FAIL, "Int8->equal(FloatZero)");
+    doOpReturningBoolAndCompareResult(Int8, FloatOne, OpReturningBool::equal, false, AssertResult::FAIL, "Int8->equal(FloatOne)");
+    doOpReturningBoolAndCompareResult(Int8, FloatTwo, OpReturningBool::equal, false, AssertResult::FAIL, "Int8->equal(FloatTwo)");
+    doOpReturningBoolAndCompareResult(Int8, FloatTwo2, OpReturningBool::equal, false, AssertResult::FAIL, "Int8->equal(FloatTwo2)");
+    doOpReturningBoolAndCompareResult(Int8, Float2_5, OpReturningBool::equal, false, AssertResult::FAIL, "Int8->equal(Float2_5)");
+    doOpReturningBoolAndCompareResult(Int8, Float_23_74, OpReturningBool::equal, false, AssertResult::FAIL, "Int8->equal(Float_23_74)");
+    doOpReturningBoolAndCompareResult(Int8, StrEmpty, OpReturningBool::equal, false, AssertResult::FAIL, "Int8->equal(StrEmpty)");
+    doOpReturningBoolAndCompareResult(Int8, StrEmpty2, OpReturningBool::equal, false, AssertResult::FAIL, "Int8->equal(StrEmpty2)");
+    doOpReturningBoolAndCompareResult(Int8, StrA, OpReturningBool::equal, false, AssertResult::FAIL, "Int8->equal(StrA)");
+    doOpReturningBoolAndCompareResult(Int8, StrA2, OpReturningBool::equal, false, AssertResult::FAIL, "Int8->equal(StrA2)");
+    doOpReturningBoolAndCompareResult(Int8, StrB, OpReturningBool::equal, false, AssertResult::FAIL, "Int8->equal(StrB)");
+    doOpReturningBoolAndCompareResult(Int8, ListEmpty, OpReturningBool::equal, false, AssertResult::FAIL, "Int8->equal(ListEmpty)");
+    doOpReturningBoolAndCompareResult(Int8, ListEmpty2, OpReturningBool::equal, false, AssertResult::FAIL, "Int8->equal(ListEmpty2)");
+    doOpReturningBoolAndCompareResult(IntMinusOne, None, OpReturningBool::equal, false, AssertResult::FAIL, "IntMinusOne->equal(None)");
+    doOpReturningBoolAndCompareResult(IntMinusOne, None2, OpReturningBool::equal, false, AssertResult::FAIL, "IntMinusOne->equal(None2)");
+    doOpReturningBoolAndCompareResult(IntMinusOne, False, OpReturningBool::equal, false, AssertResult::FAIL, "IntMinusOne->equal(False)");
+    doOpReturningBoolAndCompareResult(IntMinusOne, False2, OpReturningBool::equal, false, AssertResult::FAIL, "IntMinusOne->equal(False2)");
+    doOpReturningBoolAndCompareResult(IntMinusOne, True, OpReturningBool::equal, false, AssertResult::FAIL, "IntMinusOne->equal(True)");
+    doOpReturningBoolAndCompareResult(IntMinusOne, True2, OpReturningBool::equal, false, AssertResult::FAIL, "IntMinusOne->equal(True2)");
+    doOpReturningBoolAndCompareResult(IntMinusOne, IntZero, OpReturningBool::equal, false, AssertResult::FAIL, "IntMinusOne->equal(IntZero)");
+    doOpReturningBoolAndCompareResult(IntMinusOne, IntOne, OpReturningBool::equal, false, AssertResult::FAIL, "IntMinusOne->equal(IntOne)");
+    doOpReturningBoolAndCompareResult(IntMinusOne, IntTwo, OpReturningBool::equal, false, AssertResult::FAIL, "IntMinusOne->equal(IntTwo)");
+    doOpReturningBoolAndCompareResult(IntMinusOne, IntTwo2, OpReturningBool::equal, false, AssertResult::FAIL, "IntMinusOne->equal(IntTwo2)");
+    doOpReturningBoolAndCompareResult(IntMinusOne, Int8, OpReturningBool::equal, false, AssertResult::FAIL, "IntMinusOne->equal(Int8)");
+    doOpReturningBoolAndCompareResult(IntMinusOne, IntMinusOne, OpReturningBool::equal, true, AssertResult::PASS, "IntMinusOne->equal(IntMinusOne)");
+    doOpReturningBoolAndCompareResult(IntMinusOne, IntMinusOne2, OpReturningBool::equal, true, AssertResult::PASS, "IntMinusOne->equal(IntMinusOne2)");
+    doOpReturningBoolAndCompareResult(IntMinusOne, IntMinus12, OpReturningBool::equal, false, AssertResult::FAIL, "IntMinusOne->equal(IntMinus12)");
+    doOpReturningBoolAndCompareResult(IntMinusOne, IntMinus73, OpReturningBool::equal, false, AssertResult::FAIL, "IntMinusOne->equal(IntMinus73)");
+    doOpReturningBoolAndCompareResult(IntMinusOne, FloatMinusOne, OpReturningBool::equal, true, AssertResult::PASS, "IntMinusOne->equal(FloatMinusOne)");
+    doOpReturningBoolAndCompareResult(IntMinusOne, FloatZero, OpReturningBool::equal, false, AssertResult::FAIL, "IntMinusOne->equal(FloatZero)");
+    doOpReturningBoolAndCompareResult(IntMinusOne, FloatOne, OpReturningBool::equal, false, AssertResult::FAIL, "IntMinusOne->equal(FloatOne)");
+    doOpReturningBoolAndCompareResult(IntMinusOne, FloatTwo, OpReturningBool::equal, false, AssertResult::FAIL, "IntMinusOne->equal(FloatTwo)");
+    doOpReturningBoolAndCompareResult(IntMinusOne, FloatTwo2, OpReturningBool::equal, false, AssertResult::FAIL, "IntMinusOne->equal(FloatTwo2)");
+    doOpReturningBoolAndCompareResult(IntMinusOne, Float2_5, OpReturningBool::equal, false, AssertResult::FAIL, "IntMinusOne->equal(Float2_5)");
+    doOpReturningBoolAndCompareResult(IntMinusOne, Float_23_74, OpReturningBool::equal, false, AssertResult::FAIL, "IntMinusOne->equal(Float_23_74)");
+    doOpReturningBoolAndCompareResult(IntMinusOne, StrEmpty, OpReturningBool::equal, false, AssertResult::FAIL, "IntMinusOne->equal(StrEmpty)");
+    doOpReturningBoolAndCompareResult(IntMinusOne, StrEmpty2, OpReturningBool::equal, false, AssertResult::FAIL, "IntMinusOne->equal(StrEmpty2)");
+    doOpReturningBoolAndCompareResult(IntMinusOne, StrA, OpReturningBool::equal, false, AssertResult::FAIL, "IntMinusOne->equal(StrA)");
+    doOpReturningBoolAndCompareResult(IntMinusOne, StrA2, OpReturningBool::equal, false, AssertResult::FAIL, "IntMinusOne->equal(StrA2)");
+    doOpReturningBoolAndCompareResult(IntMinusOne, StrB, OpReturningBool::equal, false, AssertResult::FAIL, "IntMinusOne->equal(StrB)");
+    doOpReturningBoolAndCompareResult(IntMinusOne, ListEmpty, OpReturningBool::equal, false, AssertResult::FAIL, "IntMinusOne->equal(ListEmpty)");
+    doOpReturningBoolAndCompareResult(IntMinusOne, ListEmpty2, OpReturningBool::equal, false, AssertResult::FAIL, "IntMinusOne->equal(ListEmpty2)");
+    doOpReturningBoolAndCompareResult(IntMinusOne2, None, OpReturningBool::equal, false, AssertResult::FAIL, "IntMinusOne2->equal(None)");
+    doOpReturningBoolAndCompareResult(IntMinusOne2, None2, OpReturningBool::equal, false, AssertResult::FAIL, "IntMinusOne2->equal(None2)");
+    doOpReturningBoolAndCompareResult(IntMinusOne2, False, OpReturningBool::equal, false, AssertResult::FAIL, "IntMinusOne2->equal(False)");
+    doOpReturningBoolAndCompareResult(IntMinusOne2, False2, OpReturningBool::equal, false, AssertResult::FAIL, "IntMinusOne2->equal(False2)");
+    doOpReturningBoolAndCompareResult(IntMinusOne2, True, OpReturningBool::equal, false, AssertResult::FAIL, "IntMinusOne2->equal(True)");
+    doOpReturningBoolAndCompareResult(IntMinusOne2, True2, OpReturningBool::equal, false, AssertResult::FAIL, "IntMinusOne2->equal(True2)");
+    doOpReturningBoolAndCompareResult(IntMinusOne2, IntZero, OpReturningBool::equal, false, AssertResult::FAIL, "IntMinusOne2->equal(IntZero)");
+    doOpReturningBoolAndCompareResult(IntMinusOne2, IntOne, OpReturningBool::equal, false, AssertResult::FAIL, "IntMinusOne2->equal(IntOne)");
+    doOpReturningBoolAndCompareResult(IntMinusOne2, IntTwo, OpReturningBool::equal, false, AssertResult::FAIL, "IntMinusOne2->equal(IntTwo)");
+    doOpReturningBoolAndCompareResult(IntMinusOne2, IntTwo2, OpReturningBool::equal, false, AssertResult::FAIL, "IntMinusOne2->equal(IntTwo2)");
+    doOpReturningBoolAndCompareResult(IntMinusOne2, Int8, OpReturningBool::equal, false, AssertResult::FAIL, "IntMinusOne2->equal(Int8)");
+    doOpReturningBoolAndCompareResult(IntMinusOne2, IntMinusOne, OpReturningBool::equal, true, AssertResult::PASS, "IntMinusOne2->equal(IntMinusOne)");
+    doOpReturningBoolAndCompareResult(IntMinusOne2, IntMinusOne2, OpReturningBool::equal, true, AssertResult::PASS, "IntMinusOne2->equal(IntMinusOne2)");
+    doOpReturningBoolAndCompareResult(IntMinusOne2, IntMinus12, OpReturningBool::equal, false, AssertResult::FAIL, "IntMinusOne2->equal(IntMinus12)");
+    doOpReturningBoolAndCompareResult(IntMinusOne2, IntMinus73, OpReturningBool::equal, false, AssertResult::FAIL, "IntMinusOne2->equal(IntMinus73)");
+    doOpReturningBoolAndCompareResult(IntMinusOne2, FloatMinusOne, OpReturningBool::equal, true, AssertResult::PASS, "IntMinusOne2->equal(FloatMinusOne)");
+    doOpReturningBoolAndCompareResult(IntMinusOne2, FloatZero, OpReturningBool::equal, false, AssertResult::FAIL, "IntMinusOne2->equal(FloatZero)");
+    doOpReturningBoolAndCompareResult(IntMinusOne2, FloatOne, OpReturningBool::equal, false, AssertResult::FAIL, "IntMinusOne2->equal(FloatOne)");
+    doOpReturningBoolAndCompareResult(IntMinusOne2, FloatTwo, OpReturningBool::equal, false, AssertResult::FAIL, "IntMinusOne2->equal(FloatTwo)");
+    doOpReturningBoolAndCompareResult(IntMinusOne2, FloatTwo2, OpReturningBool::equal, false, AssertResult::FAIL, "IntMinusOne2->equal(FloatTwo2)");
+    doOpReturningBoolAndCompareResult(IntMinusOne2, Float2_5, OpReturningBool::equal, false, AssertResult::FAIL, "IntMinusOne2->equal(Float2_5)");
+    doOpReturningBoolAndCompareResult(IntMinusOne2, Float_23_74, OpReturningBool::equal, false, AssertResult::FAIL, "IntMinusOne2->equal(Float_23_74)");
+    doOpReturningBoolAndCompareResult(IntMinusOne2, StrEmpty, OpReturningBool::equal, false, AssertResult::FAIL, "IntMinusOne2->equal(StrEmpty)");
+    doOpReturningBoolAndCompareResult(IntMinusOne2, StrEmpty2, OpReturningBool::equal, false, AssertResult::FAIL, "IntMinusOne2->equal(StrEmpty2)");
+    doOpReturningBoolAndCompareResult(IntMinusOne2, StrA, OpReturningBool::equal, false, AssertResult::FAIL, "IntMinusOne2->equal(StrA)");
+    doOpReturningBoolAndCompareResult(IntMinusOne2, StrA2, OpReturningBool::equal, false, AssertResult::FAIL, "IntMinusOne2->equal(StrA2)");
+    doOpReturningBoolAndCompareResult(IntMinusOne2, StrB, OpReturningBool::equal, false, AssertResult::FAIL, "IntMinusOne2->equal(StrB)");
+    doOpReturningBoolAndCompareResult(IntMinusOne2, ListEmpty, OpReturningBool::equal, false, AssertResult::FAIL, "IntMinusOne2->equal(ListEmpty)");
+    doOpReturningBoolAndCompareResult(IntMinusOne2, ListEmpty2, OpReturningBool::equal, false, AssertResult::FAIL, "IntMinusOne2->equal(ListEmpty2)");
+    doOpReturningBoolAndCompareResult(IntMinus12, None, OpReturningBool::equal, false, AssertResult::FAIL, "IntMinus12->equal(None)");
+    doOpReturningBoolAndCompareResult(IntMinus12, None2, OpReturningBool::equal, false, AssertResult::FAIL, "IntMinus12->equal(None2)");
+    doOpReturningBoolAndCompareResult(IntMinus12, False, OpReturningBool::equal, false, AssertResult::FAIL, "IntMinus12->equal(False)");
+    doOpReturningBoolAndCompareResult(IntMinus12, False2, OpReturningBool::equal, false, AssertResult::FAIL, "IntMinus12->equal(False2)");
+    doOpReturningBoolAndCompareResult(IntMinus12, True, OpReturningBool::equal, false, AssertResult::FAIL, "IntMinus12->equal(True)");
+    doOpReturningBoolAndCompareResult(IntMinus12, True2, OpReturningBool::equal, false, AssertResult::FAIL, "IntMinus12->equal(True2)");
+    doOpReturningBoolAndCompareResult(IntMinus12, IntZero, OpReturningBool::equal, false, AssertResult::FAIL, "IntMinus12->equal(IntZero)");
+    doOpReturningBoolAndCompareResult(IntMinus12, IntOne, OpReturningBool::equal, false, AssertResult::FAIL, "IntMinus12->equal(IntOne)");
+    doOpReturningBoolAndCompareResult(IntMinus12, IntTwo, OpReturningBool::equal, false, AssertResult::FAIL, "IntMinus12->equal(IntTwo)");
+    doOpReturningBoolAndCompareResult(IntMinus12, IntTwo2, OpReturningBool::equal, false, AssertResult::FAIL, "IntMinus12->equal(IntTwo2)");
+    doOpReturningBoolAndCompareResult(IntMinus12, Int8, OpReturningBool::equal, false, AssertResult::FAIL, "IntMinus12->equal(Int8)");
+    doOpReturningBoolAndCompareResult(IntMinus12, IntMinusOne, OpReturningBool::equal, false, AssertResult::FAIL, "IntMinus12->equal(IntMinusOne)");
+    doOpReturningBoolAndCompareResult(IntMinus12, IntMinusOne2, OpReturningBool::equal, false, AssertResult::FAIL, "IntMinus12->equal(IntMinusOne2)");
+    doOpReturningBoolAndCompareResult(IntMinus12, IntMinus12, OpReturningBool::equal, true, AssertResult::PASS, "IntMinus12->equal(IntMinus12)");
+    doOpReturningBoolAndCompareResult(IntMinus12, IntMinus73, OpReturningBool::equal, false, AssertResult::FAIL, "IntMinus12->equal(IntMinus73)");
+    doOpReturningBoolAndCompareResult(IntMinus12, FloatMinusOne, OpReturningBool::equal, false, AssertResult::FAIL, "IntMinus12->equal(FloatMinusOne)");
+    doOpReturningBoolAndCompareResult(IntMinus12, FloatZero, OpReturningBool::equal, false, AssertResult::FAIL, "IntMinus12->equal(FloatZero)");
+    doOpReturningBoolAndCompareResult(IntMinus12, FloatOne, OpReturningBool::equal, false, AssertResult::FAIL, "IntMinus12->equal(FloatOne)");
+    doOpReturningBoolAndCompareResult(IntMinus12, FloatTwo, OpReturningBool::equal, false, AssertResult::FAIL, "IntMinus12->equal(FloatTwo)");
+    doOpReturningBoolAndCompareResult(IntMinus12, FloatTwo2, OpReturningBool::equal, false, AssertResult::FAIL, "IntMinus12->equal(FloatTwo2)");
+    doOpReturningBoolAndCompareResult(IntMinus12, Float2_5, OpReturningBool::equal, false, AssertResult::FAIL, "IntMinus12->equal(Float2_5)");
+    doOpReturningBoolAndCompareResult(IntMinus12, Float_23_74, OpReturningBool::equal, false, AssertResult::FAIL, "IntMinus12->equal(Float_23_74)");
+    doOpReturningBoolAndCompareResult(IntMinus12, StrEmpty, OpReturningBool::equal, false, AssertResult::FAIL, "IntMinus12->equal(StrEmpty)");
+    doOpReturningBoolAndCompareResult(IntMinus12, StrEmpty2, OpReturningBool::equal, false, AssertResult::FAIL, "IntMinus12->equal(StrEmpty2)");
+    doOpReturningBoolAndCompareResult(IntMinus12, StrA, OpReturningBool::equal, false, AssertResult::FAIL, "IntMinus12->equal(StrA)");
+    doOpReturningBoolAndCompareResult(IntMinus12, StrA2, OpReturningBool::equal, false, AssertResult::FAIL, "IntMinus12->equal(StrA2)");
+    doOpReturningBoolAndCompareResult(IntMinus12, StrB, OpReturningBool::equal, false, AssertResult::FAIL, "IntMinus12->equal(StrB)");
+    doOpReturningBoolAndCompareResult(IntMinus12, ListEmpty, OpReturningBool::equal, false, AssertResult::FAIL, "IntMinus12->equal(ListEmpty)");
+    doOpReturningBoolAndCompareResult(IntMinus12, ListEmpty2, OpReturningBool::equal, false, AssertResult::FAIL, "IntMinus12->equal(ListEmpty2)");
+    doOpReturningBoolAndCompareResult(IntMinus73, None, OpReturningBool::equal, false, AssertResult::FAIL, "IntMinus73->equal(None)");
+    doOpReturningBoolAndCompareResult(IntMinus73, None2, OpReturningBool::equal, false, AssertResult::FAIL, "IntMinus73->equal(None2)");
+    doOpReturningBoolAndCompareResult(IntMinus73, False, OpReturningBool::equal, false, AssertResult::FAIL, "IntMinus73->equal(False)");
+    doOpReturningBoolAndCompareResult(IntMinus73, False2, OpReturningBool::equal, false, AssertResult::FAIL, "IntMinus73->equal(False2)");
+    doOpReturningBoolAndCompareResult(IntMinus73, True, OpReturningBool::equal, false, AssertResult::FAIL, "IntMinus73->equal(True)");
+    doOpReturningBoolAndCompareResult(IntMinus73, True2, OpReturningBool::equal, false, AssertResult::FAIL, "IntMinus73->equal(True2)");
+    doOpReturningBoolAndCompareResult(IntMinus73, IntZero, OpReturningBool::equal, false, AssertResult::FAIL, "IntMinus73->equal(IntZero)");
+    doOpReturningBoolAndCompareResult(IntMinus73, IntOne, OpReturningBool::equal, false, AssertResult::FAIL, "IntMinus73->equal(IntOne)");
+    doOpReturningBoolAndCompareResult(IntMinus73, IntTwo, OpReturningBool::equal, false, AssertResult::FAIL, "IntMinus73->equal(IntTwo)");
+    doOpReturningBoolAndCompareResult(IntMinus73, IntTwo2, OpReturningBool::equal, false, AssertResult::FAIL, "IntMinus73->equal(IntTwo2)");
+    doOpReturningBoolAndCompareResult(IntMinus73, Int8, OpReturningBool::equal, false, AssertResult::FAIL, "IntMinus73->equal(Int8)");
+    doOpReturningBoolAndCompareResult(IntMinus73, IntMinusOne, OpReturningBool::equal, false, AssertResult::FAIL, "IntMinus73->equal(IntMinusOne)");
+    doOpReturningBoolAndCompareResult(IntMinus73, IntMinusOne2, OpReturningBool::equal, false, AssertResult::FAIL, "IntMinus73->equal(IntMinusOne2)");
+    doOpReturningBoolAndCompareResult(IntMinus73, IntMinus12, OpReturningBool::equal, false, AssertResult::FAIL, "IntMinus73->equal(IntMinus12)");
+    doOpReturningBoolAndCompareResult(IntMinus73, IntMinus73, OpReturningBool::equal, true, AssertResult::PASS, "IntMinus73->equal(IntMinus73)");
+    doOpReturningBoolAndCompareResult(IntMinus73, FloatMinusOne, OpReturningBool::equal, false, AssertResult::FAIL, "IntMinus73->equal(FloatMinusOne)");
+    doOpReturningBoolAndCompareResult(IntMinus73, FloatZero, OpReturningBool::equal, false, AssertResult::FAIL, "IntMinus73->equal(FloatZero)");
+    doOpReturningBoolAndCompareResult(IntMinus73, FloatOne, OpReturningBool::equal, false, AssertResult::FAIL, "IntMinus73->equal(FloatOne)");
+    doOpReturningBoolAndCompareResult(IntMinus73, FloatTwo, OpReturningBool::equal, false, AssertResult::FAIL, "IntMinus73->equal(FloatTwo)");
+    doOpReturningBoolAndCompareResult(IntMinus73, FloatTwo2, OpReturningBool::equal, false, AssertResult::FAIL, "IntMinus73->equal(FloatTwo2)");
+    doOpReturningBoolAndCompareResult(IntMinus73, Float2_5, OpReturningBool::equal, false, AssertResult::FAIL, "IntMinus73->equal(Float2_5)");
+    doOpReturningBoolAndCompareResult(IntMinus73, Float_23_74, OpReturningBool::equal, false, AssertResult::FAIL, "IntMinus73->equal(Float_23_74)");
+    doOpReturningBoolAndCompareResult(IntMinus73, StrEmpty, OpReturningBool::equal, false, AssertResult::FAIL, "IntMinus73->equal(StrEmpty)");
+    doOpReturningBoolAndCompareResult(IntMinus73, StrEmpty2, OpReturningBool::equal, false, AssertResult::FAIL, "IntMinus73->equal(StrEmpty2)");
+    doOpReturningBoolAndCompareResult(IntMinus73, StrA, OpReturningBool::equal, false, AssertResult::FAIL, "IntMinus73->equal(StrA)");
+    doOpReturningBoolAndCompareResult(IntMinus73, StrA2, OpReturningBool::equal, false, AssertResult::FAIL, "IntMinus73->equal(StrA2)");
+    doOpReturningBoolAndCompareResult(IntMinus73, StrB, OpReturningBool::equal, false, AssertResult::FAIL, "IntMinus73->equal(StrB)");
+    doOpReturningBoolAndCompareResult(IntMinus73, ListEmpty, OpReturningBool::equal, false, AssertResult::FAIL, "IntMinus73->equal(ListEmpty)");
+    doOpReturningBoolAndCompareResult(IntMinus73, ListEmpty2, OpReturningBool::equal, false, AssertResult::FAIL, "IntMinus73->equal(ListEmpty2)");
+    doOpReturningBoolAndCompareResult(FloatMinusOne, None, OpReturningBool::equal, false, AssertResult::FAIL, "FloatMinusOne->equal(None)");
+    doOpReturningBoolAndCompareResult(FloatMinusOne, None2, OpReturningBool::equal, false, AssertResult::FAIL, "FloatMinusOne->equal(None2)");
+    doOpReturningBoolAndCompareResult(FloatMinusOne, False, OpReturningBool::equal, false, AssertResult::FAIL, "FloatMinusOne->equal(False)");
+    doOpReturningBoolAndCompareResult(FloatMinusOne, False2, OpReturningBool::equal, false, AssertResult::FAIL, "FloatMinusOne->equal(False2)");
+    doOpReturningBoolAndCompareResult(FloatMinusOne, True, OpReturningBool::equal, false, AssertResult::FAIL, "FloatMinusOne->equal(True)");
+    doOpReturningBoolAndCompareResult(FloatMinusOne, True2, OpReturningBool::equal, false, AssertResult::FAIL, "FloatMinusOne->equal(True2)");
+    doOpReturningBoolAndCompareResult(FloatMinusOne, IntZero, OpReturningBool::equal, false, AssertResult::FAIL, "FloatMinusOne->equal(IntZero)");
+    doOpReturningBoolAndCompareResult(FloatMinusOne, IntOne, OpReturningBool::equal, false, AssertResult::FAIL, "FloatMinusOne->equal(IntOne)");
+    doOpReturningBoolAndCompareResult(FloatMinusOne, IntTwo, OpReturningBool::equal, false, AssertResult::FAIL, "FloatMinusOne->equal(IntTwo)");
+    doOpReturningBoolAndCompareResult(FloatMinusOne, IntTwo2, OpReturningBool::equal, false, AssertResult::FAIL, "FloatMinusOne->equal(IntTwo2)");
+    doOpReturningBoolAndCompareResult(FloatMinusOne, Int8, OpReturningBool::equal, false, AssertResult::FAIL, "FloatMinusOne->equal(Int8)");
+    doOpReturningBoolAndCompareResult(FloatMinusOne, IntMinusOne, OpReturningBool::equal, true, AssertResult::PASS, "FloatMinusOne->equal(IntMinusOne)");
+    doOpReturningBoolAndCompareResult(FloatMinusOne, IntMinusOne2, OpReturningBool::equal, true, AssertResult::PASS, "FloatMinusOne->equal(IntMinusOne2)");
+    doOpReturningBoolAndCompareResult(FloatMinusOne, IntMinus12, OpReturningBool::equal, false, AssertResult::FAIL, "FloatMinusOne->equal(IntMinus12)");
+    doOpReturningBoolAndCompareResult(FloatMinusOne, IntMinus73, OpReturningBool::equal, false, AssertResult::FAIL, "FloatMinusOne->equal(IntMinus73)");
+    doOpReturningBoolAndCompareResult(FloatMinusOne, FloatMinusOne, OpReturningBool::equal, true, AssertResult::PASS, "FloatMinusOne->equal(FloatMinusOne)");
+    doOpReturningBoolAndCompareResult(FloatMinusOne, FloatZero, OpReturningBool::equal, false, AssertResult::FAIL, "FloatMinusOne->equal(FloatZero)");
+    doOpReturningBoolAndCompareResult(FloatMinusOne, FloatOne, OpReturningBool::equal, false, AssertResult::FAIL, "FloatMinusOne->equal(FloatOne)");
+    doOpReturningBoolAndCompareResult(FloatMinusOne, FloatTwo, OpReturningBool::equal, false, AssertResult::FAIL, "FloatMinusOne->equal(FloatTwo)");
+    doOpReturningBoolAndCompareResult(FloatMinusOne, FloatTwo2, OpReturningBool::equal, false, AssertResult::FAIL, "FloatMinusOne->equal(FloatTwo2)");
+    doOpReturningBoolAndCompareResult(FloatMinusOne, Float2_5, OpReturningBool::equal, false, AssertResult::FAIL, "FloatMinusOne->equal(Float2_5)");
+    doOpReturningBoolAndCompareResult(FloatMinusOne, Float_23_74, OpReturningBool::equal, false, AssertResult::FAIL, "FloatMinusOne->equal(Float_23_74)");
+    doOpReturningBoolAndCompareResult(FloatMinusOne, StrEmpty, OpReturningBool::equal, false, AssertResult::FAIL, "FloatMinusOne->equal(StrEmpty)");
+    doOpReturningBoolAndCompareResult(FloatMinusOne, StrEmpty2, OpReturningBool::equal, false, AssertResult::FAIL, "FloatMinusOne->equal(StrEmpty2)");
+    doOpReturningBoolAndCompareResult(FloatMinusOne, StrA, OpReturningBool::equal, false, AssertResult::FAIL, "FloatMinusOne->equal(StrA)");
+    doOpReturningBoolAndCompareResult(FloatMinusOne, StrA2, OpReturningBool::equal, false, AssertResult::FAIL, "FloatMinusOne->equal(StrA2)");
+    doOpReturningBoolAndCompareResult(FloatMinusOne, StrB, OpReturningBool::equal, false, AssertResult::FAIL, "FloatMinusOne->equal(StrB)");
+    doOpReturningBoolAndCompareResult(FloatMinusOne, ListEmpty, OpReturningBool::equal, false, AssertResult::FAIL, "FloatMinusOne->equal(ListEmpty)");
+    doOpReturningBoolAndCompareResult(FloatMinusOne, ListEmpty2, OpReturningBool::equal, false, AssertResult::FAIL, "FloatMinusOne->equal(ListEmpty2)");
+    doOpReturningBoolAndCompareResult(FloatZero, None, OpReturningBool::equal, false, AssertResult::FAIL, "FloatZero->equal(None)");
+    doOpReturningBoolAndCompareResult(FloatZero, None2, OpReturningBool::equal, false, AssertResult::FAIL, "FloatZero->equal(None2)");
+    doOpReturningBoolAndCompareResult(FloatZero, False, OpReturningBool::equal, true, AssertResult::PASS, "FloatZero->equal(False)");
+    doOpReturningBoolAndCompareResult(FloatZero, False2, OpReturningBool::equal, true, AssertResult::PASS, "FloatZero->equal(False2)");
+    doOpReturningBoolAndCompareResult(FloatZero, True, OpReturningBool::equal, false, AssertResult::FAIL, "FloatZero->equal(True)");
+    doOpReturningBoolAndCompareResult(FloatZero, True2, OpReturningBool::equal, false, AssertResult::FAIL, "FloatZero->equal(True2)");
+    doOpReturningBoolAndCompareResult(FloatZero, IntZero, OpReturningBool::equal, true, AssertResult::PASS, "FloatZero->equal(IntZero)");
+    doOpReturningBoolAndCompareResult(FloatZero, IntOne, OpReturningBool::equal, false, AssertResult::FAIL, "FloatZero->equal(IntOne)");
+    doOpReturningBoolAndCompareResult(FloatZero, IntTwo, OpReturningBool::equal, false, AssertResult::FAIL, "FloatZero->equal(IntTwo)");
+    doOpReturningBoolAndCompareResult(FloatZero, IntTwo2, OpReturningBool::equal, false, AssertResult::FAIL, "FloatZero->equal(IntTwo2)");
+    doOpReturningBoolAndCompareResult(FloatZero, Int8, OpReturningBool::equal, false, AssertResult::FAIL, "FloatZero->equal(Int8)");
+    doOpReturningBoolAndCompareResult(FloatZero, IntMinusOne, OpReturningBool::equal, false, AssertResult::FAIL, "FloatZero->equal(IntMinusOne)");
+    doOpReturningBoolAndCompareResult(FloatZero, IntMinusOne2, OpReturningBool::equal, false, AssertResult::FAIL, "FloatZero->equal(IntMinusOne2)");
+    doOpReturningBoolAndCompareResult(FloatZero, IntMinus12, OpReturningBool::equal, false, AssertResult::FAIL, "FloatZero->equal(IntMinus12)");
+    doOpReturningBoolAndCompareResult(FloatZero, IntMinus73, OpReturningBool::equal, false, AssertResult::FAIL, "FloatZero->equal(IntMinus73)");
+    doOpReturningBoolAndCompareResult(FloatZero, FloatMinusOne, OpReturningBool::equal, false, AssertResult::FAIL, "FloatZero->equal(FloatMinusOne)");
+    doOpReturningBoolAndCompareResult(FloatZero, FloatZero, OpReturningBool::equal, true, AssertResult::PASS, "FloatZero->equal(FloatZero)");
+    doOpReturningBoolAndCompareResult(FloatZero, FloatOne, OpReturningBool::equal, false, AssertResult::FAIL, "FloatZero->equal(FloatOne)");
+    doOpReturningBoolAndCompareResult(FloatZero, FloatTwo, OpReturningBool::equal, false, AssertResult::FAIL, "FloatZero->equal(FloatTwo)");
+    doOpReturningBoolAndCompareResult(FloatZero, FloatTwo2, OpReturningBool::equal, false, AssertResult::FAIL, "FloatZero->equal(FloatTwo2)");
+    doOpReturningBoolAndCompareResult(FloatZero, Float2_5, OpReturningBool::equal, false, AssertResult::FAIL, "FloatZero->equal(Float2_5)");
+    doOpReturningBoolAndCompareResult(FloatZero, Float_23_74, OpReturningBool::equal, false, AssertResult::FAIL, "FloatZero->equal(Float_23_74)");
+    doOpReturningBoolAndCompareResult(FloatZero, StrEmpty, OpReturningBool::equal, false, AssertResult::FAIL, "FloatZero->equal(StrEmpty)");
+    doOpReturningBoolAndCompareResult(FloatZero, StrEmpty2, OpReturningBool::equal, false, AssertResult::FAIL, "FloatZero->equal(StrEmpty2)");
+    doOpReturningBoolAndCompareResult(FloatZero, StrA, OpReturningBool::equal, false, AssertResult::FAIL, "FloatZero->equal(StrA)");
+    doOpReturningBoolAndCompareResult(FloatZero, StrA2, OpReturningBool::equal, false, AssertResult::FAIL, "FloatZero->equal(StrA2)");
+    doOpReturningBoolAndCompareResult(FloatZero, StrB, OpReturningBool::equal, false, AssertResult::FAIL, "FloatZero->equal(StrB)");
+    doOpReturningBoolAndCompareResult(FloatZero, ListEmpty, OpReturningBool::equal, false, AssertResult::FAIL, "FloatZero->equal(ListEmpty)");
+    doOpReturningBoolAndCompareResult(FloatZero, ListEmpty2, OpReturningBool::equal, false, AssertResult::FAIL, "FloatZero->equal(ListEmpty2)");
+    doOpReturningBoolAndCompareResult(FloatOne, None, OpReturningBool::equal, false, AssertResult::FAIL, "FloatOne->equal(None)");
+    doOpReturningBoolAndCompareResult(FloatOne, None2, OpReturningBool::equal, false, AssertResult::FAIL, "FloatOne->equal(None2)");
+    doOpReturningBoolAndCompareResult(FloatOne, False, OpReturningBool::equal, false, AssertResult::FAIL, "FloatOne->equal(False)");
+    doOpReturningBoolAndCompareResult(FloatOne, False2, OpReturningBool::equal, false, AssertResult::FAIL, "FloatOne->equal(False2)");
+    doOpReturningBoolAndCompareResult(FloatOne, True, OpReturningBool::equal, true, AssertResult::PASS, "FloatOne->equal(True)");
+    doOpReturningBoolAndCompareResult(FloatOne, True2, OpReturningBool::equal, true, AssertResult::PASS, "FloatOne->equal(True2)");
+    doOpReturningBoolAndCompareResult(FloatOne, IntZero, OpReturningBool::equal, false, AssertResult::FAIL, "FloatOne->equal(IntZero)");
+    doOpReturningBoolAndCompareResult(FloatOne, IntOne, OpReturningBool::equal, true, AssertResult::PASS, "FloatOne->equal(IntOne)");
+    doOpReturningBoolAndCompareResult(FloatOne, IntTwo, OpReturningBool::equal, false, AssertResult::FAIL, "FloatOne->equal(IntTwo)");
+    doOpReturningBoolAndCompareResult(FloatOne, IntTwo2, OpReturningBool::equal, false, AssertResult::FAIL, "FloatOne->equal(IntTwo2)");
+    doOpReturningBoolAndCompareResult(FloatOne, Int8, OpReturningBool::equal, false, AssertResult::FAIL, "FloatOne->equal(Int8)");
+    doOpReturningBoolAndCompareResult(FloatOne, IntMinusOne, OpReturningBool::equal, false, AssertResult::FAIL, "FloatOne->equal(IntMinusOne)");
+    doOpReturningBoolAndCompareResult(FloatOne, IntMinusOne2, OpReturningBool::equal, false, AssertResult::FAIL, "FloatOne->equal(IntMinusOne2)");
+    doOpReturningBoolAndCompareResult(FloatOne, IntMinus12, OpReturningBool::equal, false, AssertResult::FAIL, "FloatOne->equal(IntMinus12)");
+    doOpReturningBoolAndCompareResult(FloatOne, IntMinus73, OpReturningBool::equal, false, AssertResult::FAIL, "FloatOne->equal(IntMinus73)");
+    doOpReturningBoolAndCompareResult(FloatOne, FloatMinusOne, OpReturningBool::equal, false, AssertResult::FAIL, "FloatOne->equal(FloatMinusOne)");
+    doOpReturningBoolAndCompareResult(FloatOne, FloatZero, OpReturningBool::equal, false, AssertResult::FAIL, "FloatOne->equal(FloatZero)");
+    doOpReturningBoolAndCompareResult(FloatOne, FloatOne, OpReturningBool::equal, true, AssertResult::PASS, "FloatOne->equal(FloatOne)");
+    doOpReturningBoolAndCompareResult(FloatOne, FloatTwo, OpReturningBool::equal, false, AssertResult::FAIL, "FloatOne->equal(FloatTwo)");
+    doOpReturningBoolAndCompareResult(FloatOne, FloatTwo2, OpReturningBool::equal, false, AssertResult::FAIL, "FloatOne->equal(FloatTwo2)");
+    doOpReturningBoolAndCompareResult(FloatOne, Float2_5, OpReturningBool::equal, false, AssertResult::FAIL, "FloatOne->equal(Float2_5)");
+    doOpReturningBoolAndCompareResult(FloatOne, Float_23_74, OpReturningBool::equal, false, AssertResult::FAIL, "FloatOne->equal(Float_23_74)");
+    doOpReturningBoolAndCompareResult(FloatOne, StrEmpty, OpReturningBool::equal, false, AssertResult::FAIL, "FloatOne->equal(StrEmpty)");
+    doOpReturningBoolAndCompareResult(FloatOne, StrEmpty2, OpReturningBool::equal, false, AssertResult::FAIL, "FloatOne->equal(StrEmpty2)");
+    doOpReturningBoolAndCompareResult(FloatOne, StrA, OpReturningBool::equal, false, AssertResult::FAIL, "FloatOne->equal(StrA)");
+    doOpReturningBoolAndCompareResult(FloatOne, StrA2, OpReturningBool::equal, false, AssertResult::FAIL, "FloatOne->equal(StrA2)");
+    doOpReturningBoolAndCompareResult(FloatOne, StrB, OpReturningBool::equal, false, AssertResult::FAIL, "FloatOne->equal(StrB)");
+    doOpReturningBoolAndCompareResult(FloatOne, ListEmpty, OpReturningBool::equal, false, AssertResult::FAIL, "FloatOne->equal(ListEmpty)");
+    doOpReturningBoolAndCompareResult(FloatOne, ListEmpty2, OpReturningBool::equal, false, AssertResult::FAIL, "FloatOne->equal(ListEmpty2)");
+    doOpReturningBoolAndCompareResult(FloatTwo, None, OpReturningBool::equal, false, AssertResult::FAIL, "FloatTwo->equal(None)");
+    doOpReturningBoolAndCompareResult(FloatTwo, None2, OpReturningBool::equal, false, AssertResult::FAIL, "FloatTwo->equal(None2)");
+    doOpReturningBoolAndCompareResult(FloatTwo, False, OpReturningBool::equal, false, AssertResult::FAIL, "FloatTwo->equal(False)");
+    doOpReturningBoolAndCompareResult(FloatTwo, False2, OpReturningBool::equal, false, AssertResult::FAIL, "FloatTwo->equal(False2)");
+    doOpReturningBoolAndCompareResult(FloatTwo, True, OpReturningBool::equal, false, AssertResult::FAIL, "FloatTwo->equal(True)");
+    doOpReturningBoolAndCompareResult(FloatTwo, True2, OpReturningBool::equal, false, AssertResult::FAIL, "FloatTwo->equal(True2)");
+    doOpReturningBoolAndCompareResult(FloatTwo, IntZero, OpReturningBool::equal, false, AssertResult::FAIL, "FloatTwo->equal(IntZero)");
+    doOpReturningBoolAndCompareResult(FloatTwo, IntOne, OpReturningBool::equal, false, AssertResult::FAIL, "FloatTwo->equal(IntOne)");
+    doOpReturningBoolAndCompareResult(FloatTwo, IntTwo, OpReturningBool::equal, true, AssertResult::PASS, "FloatTwo->equal(IntTwo)");
+    doOpReturningBoolAndCompareResult(FloatTwo, IntTwo2, OpReturningBool::equal, true, AssertResult::PASS, "FloatTwo->equal(IntTwo2)");
+    doOpReturningBoolAndCompareResult(FloatTwo, Int8, OpReturningBool::equal, false, AssertResult::FAIL, "FloatTwo->equal(Int8)");
+    doOpReturningBoolAndCompareResult(FloatTwo, IntMinusOne, OpReturningBool::equal, false, AssertResult::FAIL, "FloatTwo->equal(IntMinusOne)");
+    doOpReturningBoolAndCompareResult(FloatTwo, IntMinusOne2, OpReturningBool::equal, false, AssertResult::FAIL, "FloatTwo->equal(IntMinusOne2)");
+    doOpReturningBoolAndCompareResult(FloatTwo, IntMinus12, OpReturningBool::equal, false, AssertResult::FAIL, "FloatTwo->equal(IntMinus12)");
+    doOpReturningBoolAndCompareResult(FloatTwo, IntMinus73, OpReturningBool::equal, false, AssertResult::FAIL, "FloatTwo->equal(IntMinus73)");
+    doOpReturningBoolAndCompareResult(FloatTwo, FloatMinusOne, OpReturningBool::equal, false, AssertResult::FAIL, "FloatTwo->equal(FloatMinusOne)");
+    doOpReturningBoolAndCompareResult(FloatTwo, FloatZero, OpReturningBool::equal, false, AssertResult::FAIL, "FloatTwo->equal(FloatZero)");
+    doOpReturningBoolAndCompareResult(FloatTwo, FloatOne, OpReturningBool::equal, false, AssertResult::FAIL, "FloatTwo->equal(FloatOne)");
+    doOpReturningBoolAndCompareResult(FloatTwo, FloatTwo, OpReturningBool::equal, true, AssertResult::PASS, "FloatTwo->equal(FloatTwo)");
+    doOpReturningBoolAndCompareResult(FloatTwo, FloatTwo2, OpReturningBool::equal, true, AssertResult::PASS, "FloatTwo->equal(FloatTwo2)");
+    doOpReturningBoolAndCompareResult(FloatTwo, Float2_5, OpReturningBool::equal, false, AssertResult::FAIL, "FloatTwo->equal(Float2_5)");
+    doOpReturningBoolAndCompareResult(FloatTwo, Float_23_74, OpReturningBool::equal, false, AssertResult::FAIL, "FloatTwo->equal(Float_23_74)");
+    doOpReturningBoolAndCompareResult(FloatTwo, StrEmpty, OpReturningBool::equal, false, AssertResult::FAIL, "FloatTwo->equal(StrEmpty)");
+    doOpReturningBoolAndCompareResult(FloatTwo, StrEmpty2, OpReturningBool::equal, false, AssertResult::FAIL, "FloatTwo->equal(StrEmpty2)");
+    doOpReturningBoolAndCompareResult(FloatTwo, StrA, OpReturningBool::equal, false, AssertResult::FAIL, "FloatTwo->equal(StrA)");
+    doOpReturningBoolAndCompareResult(FloatTwo, StrA2, OpReturningBool::equal, false, AssertResult::FAIL, "FloatTwo->equal(StrA2)");
+    doOpReturningBoolAndCompareResult(FloatTwo, StrB, OpReturningBool::equal, false, AssertResult::FAIL, "FloatTwo->equal(StrB)");
+    doOpReturningBoolAndCompareResult(FloatTwo, ListEmpty, OpReturningBool::equal, false, AssertResult::FAIL, "FloatTwo->equal(ListEmpty)");
+    doOpReturningBoolAndCompareResult(FloatTwo, ListEmpty2, OpReturningBool::equal, false, AssertResult::FAIL, "FloatTwo->equal(ListEmpty2)");
+    doOpReturningBoolAndCompareResult(FloatTwo2, None, OpReturningBool::equal, false, AssertResult::FAIL, "FloatTwo2->equal(None)");
+    doOpReturningBoolAndCompareResult(FloatTwo2, None2, OpReturningBool::equal, false, AssertResult::FAIL, "FloatTwo2->equal(None2)");
+    doOpReturningBoolAndCompareResult(FloatTwo2, False, OpReturningBool::equal, false, AssertResult::FAIL, "FloatTwo2->equal(False)");
+    doOpReturningBoolAndCompareResult(FloatTwo2, False2, OpReturningBool::equal, false, AssertResult::FAIL, "FloatTwo2->equal(False2)");
+    doOpReturningBoolAndCompareResult(FloatTwo2, True, OpReturningBool::equal, false, AssertResult::FAIL, "FloatTwo2->equal(True)");
+    doOpReturningBoolAndCompareResult(FloatTwo2, True2, OpReturningBool::equal, false, AssertResult::FAIL, "FloatTwo2->equal(True2)");
+    doOpReturningBoolAndCompareResult(FloatTwo2, IntZero, OpReturningBool::equal, false, AssertResult::FAIL, "FloatTwo2->equal(IntZero)");
+    doOpReturningBoolAndCompareResult(FloatTwo2, IntOne, OpReturningBool::equal, false, AssertResult::FAIL, "FloatTwo2->equal(IntOne)");
+    doOpReturningBoolAndCompareResult(FloatTwo2, IntTwo, OpReturningBool::equal, true, AssertResult::PASS, "FloatTwo2->equal(IntTwo)");
+    doOpReturningBoolAndCompareResult(FloatTwo2, IntTwo2, OpReturningBool::equal, true, AssertResult::PASS, "FloatTwo2->equal(IntTwo2)");
+    doOpReturningBoolAndCompareResult(FloatTwo2, Int8, OpReturningBool::equal, false, AssertResult::FAIL, "FloatTwo2->equal(Int8)");
+    doOpReturningBoolAndCompareResult(FloatTwo2, IntMinusOne, OpReturningBool::equal, false, AssertResult::FAIL, "FloatTwo2->equal(IntMinusOne)");
+    doOpReturningBoolAndCompareResult(FloatTwo2, IntMinusOne2, OpReturningBool::equal, false, AssertResult::FAIL, "FloatTwo2->equal(IntMinusOne2)");
+    doOpReturningBoolAndCompareResult(FloatTwo2, IntMinus12, OpReturningBool::equal, false, AssertResult::FAIL, "FloatTwo2->equal(IntMinus12)");
+    doOpReturningBoolAndCompareResult(FloatTwo2, IntMinus73, OpReturningBool::equal, false, AssertResult::FAIL, "FloatTwo2->equal(IntMinus73)");
+    doOpReturningBoolAndCompareResult(FloatTwo2, FloatMinusOne, OpReturningBool::equal, false, AssertResult::FAIL, "FloatTwo2->equal(FloatMinusOne)");
+    doOpReturningBoolAndCompareResult(FloatTwo2, FloatZero, OpReturningBool::equal, false, AssertResult::FAIL, "FloatTwo2->equal(FloatZero)");
+    doOpReturningBoolAndCompareResult(FloatTwo2, FloatOne, OpReturningBool::equal, false, AssertResult::FAIL, "FloatTwo2->equal(FloatOne)");
+    doOpReturningBoolAndCompareResult(FloatTwo2, FloatTwo, OpReturningBool::equal, true, AssertResult::PASS, "FloatTwo2->equal(FloatTwo)");
+    doOpReturningBoolAndCompareResult(FloatTwo2, FloatTwo2, OpReturningBool::equal, true, AssertResult::PASS, "FloatTwo2->equal(FloatTwo2)");
+    doOpReturningBoolAndCompareResult(FloatTwo2, Float2_5, OpReturningBool::equal, false, AssertResult::FAIL, "FloatTwo2->equal(Float2_5)");
+    doOpReturningBoolAndCompareResult(FloatTwo2, Float_23_74, OpReturningBool::equal, false, AssertResult::FAIL, "FloatTwo2->equal(Float_23_74)");
+    doOpReturningBoolAndCompareResult(FloatTwo2, StrEmpty, OpReturningBool::equal, false, AssertResult::FAIL, "FloatTwo2->equal(StrEmpty)");
+    doOpReturningBoolAndCompareResult(FloatTwo2, StrEmpty2, OpReturningBool::equal, false, AssertResult::FAIL, "FloatTwo2->equal(StrEmpty2)");
+    doOpReturningBoolAndCompareResult(FloatTwo2, StrA, OpReturningBool::equal, false, AssertResult::FAIL, "FloatTwo2->equal(StrA)");
+    doOpReturningBoolAndCompareResult(FloatTwo2, StrA2, OpReturningBool::equal, false, AssertResult::FAIL, "FloatTwo2->equal(StrA2)");
+    doOpReturningBoolAndCompareResult(FloatTwo2, StrB, OpReturningBool::equal, false, AssertResult::FAIL, "FloatTwo2->equal(StrB)");
+    doOpReturningBoolAndCompareResult(FloatTwo2, ListEmpty, OpReturningBool::equal, false, AssertResult::FAIL, "FloatTwo2->equal(ListEmpty)");
+    doOpReturningBoolAndCompareResult(FloatTwo2, ListEmpty2, OpReturningBool::equal, false, AssertResult::FAIL, "FloatTwo2->equal(ListEmpty2)");
+    doOpReturningBoolAndCompareResult(Float2_5, None, OpReturningBool::equal, false, AssertResult::FAIL, "Float2_5->equal(None)");
+    doOpReturningBoolAndCompareResult(Float2_5, None2, OpReturningBool::equal, false, AssertResult::FAIL, "Float2_5->equal(None2)");
+    doOpReturningBoolAndCompareResult(Float2_5, False, OpReturningBool::equal, false, AssertResult::FAIL, "Float2_5->equal(False)");
+    doOpReturningBoolAndCompareResult(Float2_5, False2, OpReturningBool::equal, false, AssertResult::FAIL, "Float2_5->equal(False2)");
+    doOpReturningBoolAndCompareResult(Float2_5, True, OpReturningBool::equal, false, AssertResult::FAIL, "Float2_5->equal(True)");
+    doOpReturningBoolAndCompareResult(Float2_5, True2, OpReturningBool::equal, false, AssertResult::FAIL, "Float2_5->equal(True2)");
+    doOpReturningBoolAndCompareResult(Float2_5, IntZero, OpReturningBool::equal, false, AssertResult::FAIL, "Float2_5->equal(IntZero)");
+    doOpReturningBoolAndCompareResult(Float2_5, IntOne, OpReturningBool::equal, false, AssertResult::FAIL, "Float2_5->equal(IntOne)");
+    doOpReturningBoolAndCompareResult(Float2_5, IntTwo, OpReturningBool::equal, false, AssertResult::FAIL, "Float2_5->equal(IntTwo)");
+    doOpReturningBoolAndCompareResult(Float2_5, IntTwo2, OpReturningBool::equal, false, AssertResult::FAIL, "Float2_5->equal(IntTwo2)");
+    doOpReturningBoolAndCompareResult(Float2_5, Int8, OpReturningBool::equal, false, AssertResult::FAIL, "Float2_5->equal(Int8)");
+    doOpReturningBoolAndCompareResult(Float2_5, IntMinusOne, OpReturningBool::equal, false, AssertResult::FAIL, "Float2_5->equal(IntMinusOne)");
+    doOpReturningBoolAndCompareResult(Float2_5, IntMinusOne2, OpReturningBool::equal, false, AssertResult::FAIL, "Float2_5->equal(IntMinusOne2)");
+    doOpReturningBoolAndCompareResult(Float2_5, IntMinus12, OpReturningBool::equal, false, AssertResult::FAIL, "Float2_5->equal(IntMinus12)");
+    doOpReturningBoolAndCompareResult(Float2_5, IntMinus73, OpReturningBool::equal, false, AssertResult::FAIL, "Float2_5->equal(IntMinus73)");
+    doOpReturningBoolAndCompareResult(Float2_5, FloatMinusOne, OpReturningBool::equal, false, AssertResult::FAIL, "Float2_5->equal(FloatMinusOne)");
+    doOpReturningBoolAndCompareResult(Float2_5, FloatZero, OpReturningBool::equal, false, AssertResult::FAIL, "Float2_5->equal(FloatZero)");
+    doOpReturningBoolAndCompareResult(Float2_5, FloatOne, OpReturningBool::equal, false, AssertResult::FAIL, "Float2_5->equal(FloatOne)");
+    doOpReturningBoolAndCompareResult(Float2_5, FloatTwo, OpReturningBool::equal, false, AssertResult::FAIL, "Float2_5->equal(FloatTwo)");
+    doOpReturningBoolAndCompareResult(Float2_5, FloatTwo2, OpReturningBool::equal, false, AssertResult::FAIL, "Float2_5->equal(FloatTwo2)");
+    doOpReturningBoolAndCompareResult(Float2_5, Float2_5, OpReturningBool::equal, true, AssertResult::PASS, "Float2_5->equal(Float2_5)");
+    doOpReturningBoolAndCompareResult(Float2_5, Float_23_74, OpReturningBool::equal, false, AssertResult::FAIL, "Float2_5->equal(Float_23_74)");
+    doOpReturningBoolAndCompareResult(Float2_5, StrEmpty, OpReturningBool::equal, false, AssertResult::FAIL, "Float2_5->equal(StrEmpty)");
+    doOpReturningBoolAndCompareResult(Float2_5, StrEmpty2, OpReturningBool::equal, false, AssertResult::FAIL, "Float2_5->equal(StrEmpty2)");
+    doOpReturningBoolAndCompareResult(Float2_5, StrA, OpReturningBool::equal, false, AssertResult::FAIL, "Float2_5->equal(StrA)");
+    doOpReturningBoolAndCompareResult(Float2_5, StrA2, OpReturningBool::equal, false, AssertResult::FAIL, "Float2_5->equal(StrA2)");
+    doOpReturningBoolAndCompareResult(Float2_5, StrB, OpReturningBool::equal, false, AssertResult::FAIL, "Float2_5->equal(StrB)");
+    doOpReturningBoolAndCompareResult(Float2_5, ListEmpty, OpReturningBool::equal, false, AssertResult::FAIL, "Float2_5->equal(ListEmpty)");
+    doOpReturningBoolAndCompareResult(Float2_5, ListEmpty2, OpReturningBool::equal, false, AssertResult::FAIL, "Float2_5->equal(ListEmpty2)");
+    doOpReturningBoolAndCompareResult(Float_23_74, None, OpReturningBool::equal, false, AssertResult::FAIL, "Float_23_74->equal(None)");
+    doOpReturningBoolAndCompareResult(Float_23_74, None2, OpReturningBool::equal, false, AssertResult::FAIL, "Float_23_74->equal(None2)");
+    doOpReturningBoolAndCompareResult(Float_23_74, False, OpReturningBool::equal, false, AssertResult::FAIL, "Float_23_74->equal(False)");
+    doOpReturningBoolAndCompareResult(Float_23_74, False2, OpReturningBool::equal, false, AssertResult::FAIL, "Float_23_74->equal(False2)");
+    doOpReturningBoolAndCompareResult(Float_23_74, True, OpReturningBool::equal, false, AssertResult::FAIL, "Float_23_74->equal(True)");
+    doOpReturningBoolAndCompareResult(Float_23_74, True2, OpReturningBool::equal, false, AssertResult::FAIL, "Float_23_74->equal(True2)");
+    doOpReturningBoolAndCompareResult(Float_23_74, IntZero, OpReturningBool::equal, false, AssertResult::FAIL, "Float_23_74->equal(IntZero)");
+    doOpReturningBoolAndCompareResult(Float_23_74, IntOne, OpReturningBool::equal, false, AssertResult::FAIL, "Float_23_74->equal(IntOne)");
+    doOpReturningBoolAndCompareResult(Float_23_74, IntTwo, OpReturningBool::equal, false, AssertResult::FAIL, "Float_23_74->equal(IntTwo)");
+    doOpReturningBoolAndCompareResult(Float_23_74, IntTwo2, OpReturningBool::equal, false, AssertResult::FAIL, "Float_23_74->equal(IntTwo2)");
+    doOpReturningBoolAndCompareResult(Float_23_74, Int8, OpReturningBool::equal, false, AssertResult::FAIL, "Float_23_74->equal(Int8)");
+    doOpReturningBoolAndCompareResult(Float_23_74, IntMinusOne, OpReturningBool::equal, false, AssertResult::FAIL, "Float_23_74->equal(IntMinusOne)");
+    doOpReturningBoolAndCompareResult(Float_23_74, IntMinusOne2, OpReturningBool::equal, false, AssertResult::FAIL, "Float_23_74->equal(IntMinusOne2)");
+    doOpReturningBoolAndCompareResult(Float_23_74, IntMinus12, OpReturningBool::equal, false, AssertResult::FAIL, "Float_23_74->equal(IntMinus12)");
+    doOpReturningBoolAndCompareResult(Float_23_74, IntMinus73, OpReturningBool::equal, false, AssertResult::FAIL, "Float_23_74->equal(IntMinus73)");
+    doOpReturningBoolAndCompareResult(Float_23_74, FloatMinusOne, OpReturningBool::equal, false, AssertResult::FAIL, "Float_23_74->equal(FloatMinusOne)");
+    doOpReturningBoolAndCompareResult(Float_23_74, FloatZero, OpReturningBool::equal, false, AssertResult::FAIL, "Float_23_74->equal(FloatZero)");
+    doOpReturningBoolAndCompareResult(Float_23_74, FloatOne, OpReturningBool::equal, false, AssertResult::FAIL, "Float_23_74->equal(FloatOne)");
+    doOpReturningBoolAndCompareResult(Float_23_74, FloatTwo, OpReturningBool::equal, false, AssertResult::FAIL, "Float_23_74->equal(FloatTwo)");
+    doOpReturningBoolAndCompareResult(Float_23_74, FloatTwo2, OpReturningBool::equal, false, AssertResult::FAIL, "Float_23_74->equal(FloatTwo2)");
+    doOpReturningBoolAndCompareResult(Float_23_74, Float2_5, OpReturningBool::equal, false, AssertResult::FAIL, "Float_23_74->equal(Float2_5)");
+    doOpReturningBoolAndCompareResult(Float_23_74, Float_23_74, OpReturningBool::equal, true, AssertResult::PASS, "Float_23_74->equal(Float_23_74)");
+    doOpReturningBoolAndCompareResult(Float_23_74, StrEmpty, OpReturningBool::equal, false, AssertResult::FAIL, "Float_23_74->equal(StrEmpty)");
+    doOpReturningBoolAndCompareResult(Float_23_74, StrEmpty2, OpReturningBool::equal, false, AssertResult::FAIL, "Float_23_74->equal(StrEmpty2)");
+    doOpReturningBoolAndCompareResult(Float_23_74, StrA, OpReturningBool::equal, false, AssertResult::FAIL, "Float_23_74->equal(StrA)");
+    doOpReturningBoolAndCompareResult(Float_23_74, StrA2, OpReturningBool::equal, false, AssertResult::FAIL, "Float_23_74->equal(StrA2)");
+    doOpReturningBoolAndCompareResult(Float_23_74, StrB, OpReturningBool::equal, false, AssertResult::FAIL, "Float_23_74->equal(StrB)");
+    doOpReturningBoolAndCompareResult(Float_23_74, ListEmpty, OpReturningBool::equal, false, AssertResult::FAIL, "Float_23_74->equal(ListEmpty)");
+    doOpReturningBoolAndCompareResult(Float_23_74, ListEmpty2, OpReturningBool::equal, false, AssertResult::FAIL, "Float_23_74->equal(ListEmpty2)");
+    doOpReturningBoolAndCompareResult(StrEmpty, None, OpReturningBool::equal, false, AssertResult::FAIL, "StrEmpty->equal(None)");
+    doOpReturningBoolAndCompareResult(StrEmpty, None2, OpReturningBool::equal, false, AssertResult::FAIL, "StrEmpty->equal(None2)");
+    doOpReturningBoolAndCompareResult(StrEmpty, False, OpReturningBool::equal, false, AssertResult::FAIL, "StrEmpty->equal(False)");
+    doOpReturningBoolAndCompareResult(StrEmpty, False2, OpReturningBool::equal, false, AssertResult::FAIL, "StrEmpty->equal(False2)");
+    doOpReturningBoolAndCompareResult(StrEmpty, True, OpReturningBool::equal, false, AssertResult::FAIL, "StrEmpty->equal(True)");
+    doOpReturningBoolAndCompareResult(StrEmpty, True2, OpReturningBool::equal, false, AssertResult::FAIL, "StrEmpty->equal(True2)");
+    doOpReturningBoolAndCompareResult(StrEmpty, IntZero, OpReturningBool::equal, false, AssertResult::FAIL, "StrEmpty->equal(IntZero)");
+    doOpReturningBoolAndCompareResult(StrEmpty, IntOne, OpReturningBool::equal, false, AssertResult::FAIL, "StrEmpty->equal(IntOne)");
+    doOpReturningBoolAndCompareResult(StrEmpty, IntTwo, OpReturningBool::equal, false, AssertResult::FAIL, "StrEmpty->equal(IntTwo)");
+    doOpReturningBoolAndCompareResult(StrEmpty, IntTwo2, OpReturningBool::equal, false, AssertResult::FAIL, "StrEmpty->equal(IntTwo2)");
+    doOpReturningBoolAndCompareResult(StrEmpty, Int8, OpReturningBool::equal, false, AssertResult::FAIL, "StrEmpty->equal(Int8)");
+    doOpReturningBoolAndCompareResult(StrEmpty, IntMinusOne, OpReturningBool::equal, false, AssertResult::FAIL, "StrEmpty->equal(IntMinusOne)");
+    doOpReturningBoolAndCompareResult(StrEmpty, IntMinusOne2, OpReturningBool::equal, false, AssertResult::FAIL, "StrEmpty->equal(IntMinusOne2)");
+    doOpReturningBoolAndCompareResult(StrEmpty, IntMinus12, OpReturningBool::equal, false, AssertResult::FAIL, "StrEmpty->equal(IntMinus12)");
+    doOpReturningBoolAndCompareResult(StrEmpty, IntMinus73, OpReturningBool::equal, false, AssertResult::FAIL, "StrEmpty->equal(IntMinus73)");
+    doOpReturningBoolAndCompareResult(StrEmpty, FloatMinusOne, OpReturningBool::equal, false, AssertResult::FAIL, "StrEmpty->equal(FloatMinusOne)");
+    doOpReturningBoolAndCompareResult(StrEmpty, FloatZero, OpReturningBool::equal, false, AssertResult::FAIL, "StrEmpty->equal(FloatZero)");
+    doOpReturningBoolAndCompareResult(StrEmpty, FloatOne, OpReturningBool::equal, false, AssertResult::FAIL, "StrEmpty->equal(FloatOne)");
+    doOpReturningBoolAndCompareResult(StrEmpty, FloatTwo, OpReturningBool::equal, false, AssertResult::FAIL, "StrEmpty->equal(FloatTwo)");
+    doOpReturningBoolAndCompareResult(StrEmpty, FloatTwo2, OpReturningBool::equal, false, AssertResult::FAIL, "StrEmpty->equal(FloatTwo2)");
+    doOpReturningBoolAndCompareResult(StrEmpty, Float2_5, OpReturningBool::equal, false, AssertResult::FAIL, "StrEmpty->equal(Float2_5)");
+    doOpReturningBoolAndCompareResult(StrEmpty, Float_23_74, OpReturningBool::equal, false, AssertResult::FAIL, "StrEmpty->equal(Float_23_74)");
+    doOpReturningBoolAndCompareResult(StrEmpty, StrEmpty, OpReturningBool::equal, true, AssertResult::PASS, "StrEmpty->equal(StrEmpty)");
+    doOpReturningBoolAndCompareResult(StrEmpty, StrEmpty2, OpReturningBool::equal, true, AssertResult::PASS, "StrEmpty->equal(StrEmpty2)");
+    doOpReturningBoolAndCompareResult(StrEmpty, StrA, OpReturningBool::equal, false, AssertResult::FAIL, "StrEmpty->equal(StrA)");
+    doOpReturningBoolAndCompareResult(StrEmpty, StrA2, OpReturningBool::equal, false, AssertResult::FAIL, "StrEmpty->equal(StrA2)");
+    doOpReturningBoolAndCompareResult(StrEmpty, StrB, OpReturningBool::equal, false, AssertResult::FAIL, "StrEmpty->equal(StrB)");
+    doOpReturningBoolAndCompareResult(StrEmpty, ListEmpty, OpReturningBool::equal, false, AssertResult::FAIL, "StrEmpty->equal(ListEmpty)");
+    doOpReturningBoolAndCompareResult(StrEmpty, ListEmpty2, OpReturningBool::equal, false, AssertResult::FAIL, "StrEmpty->equal(ListEmpty2)");
+    doOpReturningBoolAndCompareResult(StrEmpty2, None, OpReturningBool::equal, false, AssertResult::FAIL, "StrEmpty2->equal(None)");
+    doOpReturningBoolAndCompareResult(StrEmpty2, None2, OpReturningBool::equal, false, AssertResult::FAIL, "StrEmpty2->equal(None2)");
+    doOpReturningBoolAndCompareResult(StrEmpty2, False, OpReturningBool::equal, false, AssertResult::FAIL, "StrEmpty2->equal(False)");
+    doOpReturningBoolAndCompareResult(StrEmpty2, False2, OpReturningBool::equal, false, AssertResult::FAIL, "StrEmpty2->equal(False2)");
+    doOpReturningBoolAndCompareResult(StrEmpty2, True, OpReturningBool::equal, false, AssertResult::FAIL, "StrEmpty2->equal(True)");
+    doOpReturningBoolAndCompareResult(StrEmpty2, True2, OpReturningBool::equal, false, AssertResult::FAIL, "StrEmpty2->equal(True2)");
+    doOpReturningBoolAndCompareResult(StrEmpty2, IntZero, OpReturningBool::equal, false, AssertResult::FAIL, "StrEmpty2->equal(IntZero)");
+    doOpReturningBoolAndCompareResult(StrEmpty2, IntOne, OpReturningBool::equal, false, AssertResult::FAIL, "StrEmpty2->equal(IntOne)");
+    doOpReturningBoolAndCompareResult(StrEmpty2, IntTwo, OpReturningBool::equal, false, AssertResult::FAIL, "StrEmpty2->equal(IntTwo)");
+    doOpReturningBoolAndCompareResult(StrEmpty2, IntTwo2, OpReturningBool::equal, false, AssertResult::FAIL, "StrEmpty2->equal(IntTwo2)");
+    doOpReturningBoolAndCompareResult(StrEmpty2, Int8, OpReturningBool::equal, false, AssertResult::FAIL, "StrEmpty2->equal(Int8)");
+    doOpReturningBoolAndCompareResult(StrEmpty2, IntMinusOne, OpReturningBool::equal, false, AssertResult::FAIL, "StrEmpty2->equal(IntMinusOne)");
+    doOpReturningBoolAndCompareResult(StrEmpty2, IntMinusOne2, OpReturningBool::equal, false, AssertResult::FAIL, "StrEmpty2->equal(IntMinusOne2)");
+    doOpReturningBoolAndCompareResult(StrEmpty2, IntMinus12, OpReturningBool::equal, false, AssertResult::FAIL, "StrEmpty2->equal(IntMinus12)");
+    doOpReturningBoolAndCompareResult(StrEmpty2, IntMinus73, OpReturningBool::equal, false, AssertResult::FAIL, "StrEmpty2->equal(IntMinus73)");
+    doOpReturningBoolAndCompareResult(StrEmpty2, FloatMinusOne, OpReturningBool::equal, false, AssertResult::FAIL, "StrEmpty2->equal(FloatMinusOne)");
+    doOpReturningBoolAndCompareResult(StrEmpty2, FloatZero, OpReturningBool::equal, false, AssertResult::FAIL, "StrEmpty2->equal(FloatZero)");
+    doOpReturningBoolAndCompareResult(StrEmpty2, FloatOne, OpReturningBool::equal, false, AssertResult::FAIL, "StrEmpty2->equal(FloatOne)");
+    doOpReturningBoolAndCompareResult(StrEmpty2, FloatTwo, OpReturningBool::equal, false, AssertResult::FAIL, "StrEmpty2->equal(FloatTwo)");
+    doOpReturningBoolAndCompareResult(StrEmpty2, FloatTwo2, OpReturningBool::equal, false, AssertResult::FAIL, "StrEmpty2->equal(FloatTwo2)");
+    doOpReturningBoolAndCompareResult(StrEmpty2, Float2_5, OpReturningBool::equal, false, AssertResult::FAIL, "StrEmpty2->equal(Float2_5)");
+    doOpReturningBoolAndCompareResult(StrEmpty2, Float_23_74, OpReturningBool::equal, false, AssertResult::FAIL, "StrEmpty2->equal(Float_23_74)");
+    doOpReturningBoolAndCompareResult(StrEmpty2, StrEmpty, OpReturningBool::equal, true, AssertResult::PASS, "StrEmpty2->equal(StrEmpty)");
+    doOpReturningBoolAndCompareResult(StrEmpty2, StrEmpty2, OpReturningBool::equal, true, AssertResult::PASS, "StrEmpty2->equal(StrEmpty2)");
+    doOpReturningBoolAndCompareResult(StrEmpty2, StrA, OpReturningBool::equal, false, AssertResult::FAIL, "StrEmpty2->equal(StrA)");
+    doOpReturningBoolAndCompareResult(StrEmpty2, StrA2, OpReturningBool::equal, false, AssertResult::FAIL, "StrEmpty2->equal(StrA2)");
+    doOpReturningBoolAndCompareResult(StrEmpty2, StrB, OpReturningBool::equal, false, AssertResult::FAIL, "StrEmpty2->equal(StrB)");
+    doOpReturningBoolAndCompareResult(StrEmpty2, ListEmpty, OpReturningBool::equal, false, AssertResult::FAIL, "StrEmpty2->equal(ListEmpty)");
+    doOpReturningBoolAndCompareResult(StrEmpty2, ListEmpty2, OpReturningBool::equal, false, AssertResult::FAIL, "StrEmpty2->equal(ListEmpty2)");
+    doOpReturningBoolAndCompareResult(StrA, None, OpReturningBool::equal, false, AssertResult::FAIL, "StrA->equal(None)");
+    doOpReturningBoolAndCompareResult(StrA, None2, OpReturningBool::equal, false, AssertResult::FAIL, "StrA->equal(None2)");
+    doOpReturningBoolAndCompareResult(StrA, False, OpReturningBool::equal, false, AssertResult::FAIL, "StrA->equal(False)");
+    doOpReturningBoolAndCompareResult(StrA, False2, OpReturningBool::equal, false, AssertResult::FAIL, "StrA->equal(False2)");
+    doOpReturningBoolAndCompareResult(StrA, True, OpReturningBool::equal, false, AssertResult::FAIL, "StrA->equal(True)");
+    doOpReturningBoolAndCompareResult(StrA, True2, OpReturningBool::equal, false, AssertResult::FAIL, "StrA->equal(True2)");
+    doOpReturningBoolAndCompareResult(StrA, IntZero, OpReturningBool::equal, false, AssertResult::FAIL, "StrA->equal(IntZero)");
+    doOpReturningBoolAndCompareResult(StrA, IntOne, OpReturningBool::equal, false, AssertResult::FAIL, "StrA->equal(IntOne)");
+    doOpReturningBoolAndCompareResult(StrA, IntTwo, OpReturningBool::equal, false, AssertResult::FAIL, "StrA->equal(IntTwo)");
+    doOpReturningBoolAndCompareResult(StrA, IntTwo2, OpReturningBool::equal, false, AssertResult::FAIL, "StrA->equal(IntTwo2)");
+    doOpReturningBoolAndCompareResult(StrA, Int8, OpReturningBool::equal, false, AssertResult::FAIL, "StrA->equal(Int8)");
+    doOpReturningBoolAndCompareResult(StrA, IntMinusOne, OpReturningBool::equal, false, AssertResult::FAIL, "StrA->equal(IntMinusOne)");
+    doOpReturningBoolAndCompareResult(StrA, IntMinusOne2, OpReturningBool::equal, false, AssertResult::FAIL, "StrA->equal(IntMinusOne2)");
+    doOpReturningBoolAndCompareResult(StrA, IntMinus12, OpReturningBool::equal, false, AssertResult::FAIL, "StrA->equal(IntMinus12)");
+    doOpReturningBoolAndCompareResult(StrA, IntMinus73, OpReturningBool::equal, false, AssertResult::FAIL, "StrA->equal(IntMinus73)");
+    doOpReturningBoolAndCompareResult(StrA, FloatMinusOne, OpReturningBool::equal, false, AssertResult::FAIL, "StrA->equal(FloatMinusOne)");
+    doOpReturningBoolAndCompareResult(StrA, FloatZero, OpReturningBool::equal, false, AssertResult::FAIL, "StrA->equal(FloatZero)");
+    doOpReturningBoolAndCompareResult(StrA, FloatOne, OpReturningBool::equal, false, AssertResult::FAIL, "StrA->equal(FloatOne)");
+    doOpReturningBoolAndCompareResult(StrA, FloatTwo, OpReturningBool::equal, false, AssertResult::FAIL, "StrA->equal(FloatTwo)");
+    doOpReturningBoolAndCompareResult(StrA, FloatTwo2, OpReturningBool::equal, false, AssertResult::FAIL, "StrA->equal(FloatTwo2)");
+    doOpReturningBoolAndCompareResult(StrA, Float2_5, OpReturningBool::equal, false, AssertResult::FAIL, "StrA->equal(Float2_5)");
+    doOpReturningBoolAndCompareResult(StrA, Float_23_74, OpReturningBool::equal, false, AssertResult::FAIL, "StrA->equal(Float_23_74)");
+    doOpReturningBoolAndCompareResult(StrA, StrEmpty, OpReturningBool::equal, false, AssertResult::FAIL, "StrA->equal(StrEmpty)");
+    doOpReturningBoolAndCompareResult(StrA, StrEmpty2, OpReturningBool::equal, false, AssertResult::FAIL, "StrA->equal(StrEmpty2)");
+    doOpReturningBoolAndCompareResult(StrA, StrA, OpReturningBool::equal, true, AssertResult::PASS, "StrA->equal(StrA)");
+    doOpReturningBoolAndCompareResult(StrA, StrA2, OpReturningBool::equal, true, AssertResult::PASS, "StrA->equal(StrA2)");
+    doOpReturningBoolAndCompareResult(StrA, StrB, OpReturningBool::equal, false, AssertResult::FAIL, "StrA->equal(StrB)");
+    doOpReturningBoolAndCompareResult(StrA, ListEmpty, OpReturningBool::equal, false, AssertResult::FAIL, "StrA->equal(ListEmpty)");
+    doOpReturningBoolAndCompareResult(StrA, ListEmpty2, OpReturningBool::equal, false, AssertResult::FAIL, "StrA->equal(ListEmpty2)");
+    doOpReturningBoolAndCompareResult(StrA2, None, OpReturningBool::equal, false, AssertResult::FAIL, "StrA2->equal(None)");
+    doOpReturningBoolAndCompareResult(StrA2, None2, OpReturningBool::equal, false, AssertResult::FAIL, "StrA2->equal(None2)");
+    doOpReturningBoolAndCompareResult(StrA2, False, OpReturningBool::equal, false, AssertResult::FAIL, "StrA2->equal(False)");
+    doOpReturningBoolAndCompareResult(StrA2, False2, OpReturningBool::equal, false, AssertResult::FAIL, "StrA2->equal(False2)");
+    doOpReturningBoolAndCompareResult(StrA2, True, OpReturningBool::equal, false, AssertResult::FAIL, "StrA2->equal(True)");
+    doOpReturningBoolAndCompareResult(StrA2, True2, OpReturningBool::equal, false, AssertResult::FAIL, "StrA2->equal(True2)");
+    doOpReturningBoolAndCompareResult(StrA2, IntZero, OpReturningBool::equal, false, AssertResult::FAIL, "StrA2->equal(IntZero)");
+    doOpReturningBoolAndCompareResult(StrA2, IntOne, OpReturningBool::equal, false, AssertResult::FAIL, "StrA2->equal(IntOne)");
+    doOpReturningBoolAndCompareResult(StrA2, IntTwo, OpReturningBool::equal, false, AssertResult::FAIL, "StrA2->equal(IntTwo)");
+    doOpReturningBoolAndCompareResult(StrA2, IntTwo2, OpReturningBool::equal, false, AssertResult::FAIL, "StrA2->equal(IntTwo2)");
+    doOpReturningBoolAndCompareResult(StrA2, Int8, OpReturningBool::equal, false, AssertResult::FAIL, "StrA2->equal(Int8)");
+    doOpReturningBoolAndCompareResult(StrA2, IntMinusOne, OpReturningBool::equal, false, AssertResult::FAIL, "StrA2->equal(IntMinusOne)");
+    doOpReturningBoolAndCompareResult(StrA2, IntMinusOne2, OpReturningBool::equal, false, AssertResult::FAIL, "StrA2->equal(IntMinusOne2)");
+    doOpReturningBoolAndCompareResult(StrA2, IntMinus12, OpReturningBool::equal, false, AssertResult::FAIL, "StrA2->equal(IntMinus12)");
+    doOpReturningBoolAndCompareResult(StrA2, IntMinus73, OpReturningBool::equal, false, AssertResult::FAIL, "StrA2->equal(IntMinus73)");
+    doOpReturningBoolAndCompareResult(StrA2, FloatMinusOne, OpReturningBool::equal, false, AssertResult::FAIL, "StrA2->equal(FloatMinusOne)");
+    doOpReturningBoolAndCompareResult(StrA2, FloatZero, OpReturningBool::equal, false, AssertResult::FAIL, "StrA2->equal(FloatZero)");
+    doOpReturningBoolAndCompareResult(StrA2, FloatOne, OpReturningBool::equal, false, AssertResult::FAIL, "StrA2->equal(FloatOne)");
+    doOpReturningBoolAndCompareResult(StrA2, FloatTwo, OpReturningBool::equal, false, AssertResult::FAIL, "StrA2->equal(FloatTwo)");
+    doOpReturningBoolAndCompareResult(StrA2, FloatTwo2, OpReturningBool::equal, false, AssertResult::FAIL, "StrA2->equal(FloatTwo2)");
+    doOpReturningBoolAndCompareResult(StrA2, Float2_5, OpReturningBool::equal, false, AssertResult::FAIL, "StrA2->equal(Float2_5)");
+    doOpReturningBoolAndCompareResult(StrA2, Float_23_74, OpReturningBool::equal, false, AssertResult::FAIL, "StrA2->equal(Float_23_74)");
+    doOpReturningBoolAndCompareResult(StrA2, StrEmpty, OpReturningBool::equal, false, AssertResult::FAIL, "StrA2->equal(StrEmpty)");
+    doOpReturningBoolAndCompareResult(StrA2, StrEmpty2, OpReturningBool::equal, false, AssertResult::FAIL, "StrA2->equal(StrEmpty2)");
+    doOpReturningBoolAndCompareResult(StrA2, StrA, OpReturningBool::equal, true, AssertResult::PASS, "StrA2->equal(StrA)");
+    doOpReturningBoolAndCompareResult(StrA2, StrA2, OpReturningBool::equal, true, AssertResult::PASS, "StrA2->equal(StrA2)");
+    doOpReturningBoolAndCompareResult(StrA2, StrB, OpReturningBool::equal, false, AssertResult::FAIL, "StrA2->equal(StrB)");
+    doOpReturningBoolAndCompareResult(StrA2, ListEmpty, OpReturningBool::equal, false, AssertResult::FAIL, "StrA2->equal(ListEmpty)");
+    doOpReturningBoolAndCompareResult(StrA2, ListEmpty2, OpReturningBool::equal, false, AssertResult::FAIL, "StrA2->equal(ListEmpty2)");
+    doOpReturningBoolAndCompareResult(StrB, None, OpReturningBool::equal, false, AssertResult::FAIL, "StrB->equal(None)");
+    doOpReturningBoolAndCompareResult(StrB, None2, OpReturningBool::equal, false, AssertResult::FAIL, "StrB->equal(None2)");
+    doOpReturningBoolAndCompareResult(StrB, False, OpReturningBool::equal, false, AssertResult::FAIL, "StrB->equal(False)");
+    doOpReturningBoolAndCompareResult(StrB, False2, OpReturningBool::equal, false, AssertResult::FAIL, "StrB->equal(False2)");
+    doOpReturningBoolAndCompareResult(StrB, True, OpReturningBool::equal, false, AssertResult::FAIL, "StrB->equal(True)");
+    doOpReturningBoolAndCompareResult(StrB, True2, OpReturningBool::equal, false, AssertResult::FAIL, "StrB->equal(True2)");
+    doOpReturningBoolAndCompareResult(StrB, IntZero, OpReturningBool::equal, false, AssertResult::FAIL, "StrB->equal(IntZero)");
+    doOpReturningBoolAndCompareResult(StrB, IntOne, OpReturningBool::equal, false, AssertResult::FAIL, "StrB->equal(IntOne)");
+    doOpReturningBoolAndCompareResult(StrB, IntTwo, OpReturningBool::equal, false, AssertResult::FAIL, "StrB->equal(IntTwo)");
+    doOpReturningBoolAndCompareResult(StrB, IntTwo2, OpReturningBool::equal, false, AssertResult::FAIL, "StrB->equal(IntTwo2)");
+    doOpReturningBoolAndCompareResult(StrB, Int8, OpReturningBool::equal, false, AssertResult::FAIL, "StrB->equal(Int8)");
+    doOpReturningBoolAndCompareResult(StrB, IntMinusOne, OpReturningBool::equal, false, AssertResult::FAIL, "StrB->equal(IntMinusOne)");
+    doOpReturningBoolAndCompareResult(StrB, IntMinusOne2, OpReturningBool::equal, false, AssertResult::FAIL, "StrB->equal(IntMinusOne2)");
+    doOpReturningBoolAndCompareResult(StrB, IntMinus12, OpReturningBool::equal, false, AssertResult::FAIL, "StrB->equal(IntMinus12)");
+    doOpReturningBoolAndCompareResult(StrB, IntMinus73, OpReturningBool::equal, false, AssertResult::FAIL, "StrB->equal(IntMinus73)");
+    doOpReturningBoolAndCompareResult(StrB, FloatMinusOne, OpReturningBool::equal, false, AssertResult::FAIL, "StrB->equal(FloatMinusOne)");
+    doOpReturningBoolAndCompareResult(StrB, FloatZero, OpReturningBool::equal, false, AssertResult::FAIL, "StrB->equal(FloatZero)");
+    doOpReturningBoolAndCompareResult(StrB, FloatOne, OpReturningBool::equal, false, AssertResult::FAIL, "StrB->equal(FloatOne)");
+    doOpReturningBoolAndCompareResult(StrB, FloatTwo, OpReturningBool::equal, false, AssertResult::FAIL, "StrB->equal(FloatTwo)");
+    doOpReturningBoolAndCompareResult(StrB, FloatTwo2, OpReturningBool::equal, false, AssertResult::FAIL, "StrB->equal(FloatTwo2)");
+    doOpReturningBoolAndCompareResult(StrB, Float2_5, OpReturningBool::equal, false, AssertResult::FAIL, "StrB->equal(Float2_5)");
+    doOpReturningBoolAndCompareResult(StrB, Float_23_74, OpReturningBool::equal, false, AssertResult::FAIL, "StrB->equal(Float_23_74)");
+    doOpReturningBoolAndCompareResult(StrB, StrEmpty, OpReturningBool::equal, false, AssertResult::FAIL, "StrB->equal(StrEmpty)");
+    doOpReturningBoolAndCompareResult(StrB, StrEmpty2, OpReturningBool::equal, false, AssertResult::FAIL, "StrB->equal(StrEmpty2)");
+    doOpReturningBoolAndCompareResult(StrB, StrA, OpReturningBool::equal, false, AssertResult::FAIL, "StrB->equal(StrA)");
+    doOpReturningBoolAndCompareResult(StrB, StrA2, OpReturningBool::equal, false, AssertResult::FAIL, "StrB->equal(StrA2)");
+    doOpReturningBoolAndCompareResult(StrB, StrB, OpReturningBool::equal, true, AssertResult::PASS, "StrB->equal(StrB)");
+    doOpReturningBoolAndCompareResult(StrB, ListEmpty, OpReturningBool::equal, false, AssertResult::FAIL, "StrB->equal(ListEmpty)");
+    doOpReturningBoolAndCompareResult(StrB, ListEmpty2, OpReturningBool::equal, false, AssertResult::FAIL, "StrB->equal(ListEmpty2)");
+    doOpReturningBoolAndCompareResult(ListEmpty, None, OpReturningBool::equal, false, AssertResult::FAIL, "ListEmpty->equal(None)");
+    doOpReturningBoolAndCompareResult(ListEmpty, None2, OpReturningBool::equal, false, AssertResult::FAIL, "ListEmpty->equal(None2)");
+    doOpReturningBoolAndCompareResult(ListEmpty, False, OpReturningBool::equal, false, AssertResult::FAIL, "ListEmpty->equal(False)");
+    doOpReturningBoolAndCompareResult(ListEmpty, False2, OpReturningBool::equal, false, AssertResult::FAIL, "ListEmpty->equal(False2)");
+    doOpReturningBoolAndCompareResult(ListEmpty, True, OpReturningBool::equal, false, AssertResult::FAIL, "ListEmpty->equal(True)");
+    doOpReturningBoolAndCompareResult(ListEmpty, True2, OpReturningBool::equal, false, AssertResult::FAIL, "ListEmpty->equal(True2)");
+    doOpReturningBoolAndCompareResult(ListEmpty, IntZero, OpReturningBool::equal, false, AssertResult::FAIL, "ListEmpty->equal(IntZero)");
+    doOpReturningBoolAndCompareResult(ListEmpty, IntOne, OpReturningBool::equal, false, AssertResult::FAIL, "ListEmpty->equal(IntOne)");
+    doOpReturningBoolAndCompareResult(ListEmpty, IntTwo, OpReturningBool::equal, false, AssertResult::FAIL, "ListEmpty->equal(IntTwo)");
+    doOpReturningBoolAndCompareResult(ListEmpty, IntTwo2, OpReturningBool::equal, false, AssertResult::FAIL, "ListEmpty->equal(IntTwo2)");
+    doOpReturningBoolAndCompareResult(ListEmpty, Int8, OpReturningBool::equal, false, AssertResult::FAIL, "ListEmpty->equal(Int8)");
+    doOpReturningBoolAndCompareResult(ListEmpty, IntMinusOne, OpReturningBool::equal, false, AssertResult::FAIL, "ListEmpty->equal(IntMinusOne)");
+    doOpReturningBoolAndCompareResult(ListEmpty, IntMinusOne2, OpReturningBool::equal, false, AssertResult::FAIL, "ListEmpty->equal(IntMinusOne2)");
+    doOpReturningBoolAndCompareResult(ListEmpty, IntMinus12, OpReturningBool::equal, false, AssertResult::FAIL, "ListEmpty->equal(IntMinus12)");
+    doOpReturningBoolAndCompareResult(ListEmpty, IntMinus73, OpReturningBool::equal, false, AssertResult::FAIL, "ListEmpty->equal(IntMinus73)");
+    doOpReturningBoolAndCompareResult(ListEmpty, FloatMinusOne, OpReturningBool::equal, false, AssertResult::FAIL, "ListEmpty->equal(FloatMinusOne)");
+    doOpReturningBoolAndCompareResult(ListEmpty, FloatZero, OpReturningBool::equal, false, AssertResult::FAIL, "ListEmpty->equal(FloatZero)");
+    doOpReturningBoolAndCompareResult(ListEmpty, FloatOne, OpReturningBool::equal, false, AssertResult::FAIL, "ListEmpty->equal(FloatOne)");
+    doOpReturningBoolAndCompareResult(ListEmpty, FloatTwo, OpReturningBool::equal, false, AssertResult::FAIL, "ListEmpty->equal(FloatTwo)");
+    doOpReturningBoolAndCompareResult(ListEmpty, FloatTwo2, OpReturningBool::equal, false, AssertResult::FAIL, "ListEmpty->equal(FloatTwo2)");
+    doOpReturningBoolAndCompareResult(ListEmpty, Float2_5, OpReturningBool::equal, false, AssertResult::FAIL, "ListEmpty->equal(Float2_5)");
+    doOpReturningBoolAndCompareResult(ListEmpty, Float_23_74, OpReturningBool::equal, false, AssertResult::FAIL, "ListEmpty->equal(Float_23_74)");
+    doOpReturningBoolAndCompareResult(ListEmpty, StrEmpty, OpReturningBool::equal, false, AssertResult::FAIL, "ListEmpty->equal(StrEmpty)");
+    doOpReturningBoolAndCompareResult(ListEmpty, StrEmpty2, OpReturningBool::equal, false, AssertResult::FAIL, "ListEmpty->equal(StrEmpty2)");
+    doOpReturningBoolAndCompareResult(ListEmpty, StrA, OpReturningBool::equal, false, AssertResult::FAIL, "ListEmpty->equal(StrA)");
+    doOpReturningBoolAndCompareResult(ListEmpty, StrA2, OpReturningBool::equal, false, AssertResult::FAIL, "ListEmpty->equal(StrA2)");
+    doOpReturningBoolAndCompareResult(ListEmpty, StrB, OpReturningBool::equal, false, AssertResult::FAIL, "ListEmpty->equal(StrB)");
+    doOpReturningBoolAndCompareResult(ListEmpty, ListEmpty, OpReturningBool::equal, true, AssertResult::PASS, "ListEmpty->equal(ListEmpty)");
+    doOpReturningBoolAndCompareResult(ListEmpty, ListEmpty2, OpReturningBool::equal, true, AssertResult::PASS, "ListEmpty->equal(ListEmpty2)");
+    doOpReturningBoolAndCompareResult(ListEmpty2, None, OpReturningBool::equal, false, AssertResult::FAIL, "ListEmpty2->equal(None)");
+    doOpReturningBoolAndCompareResult(ListEmpty2, None2, OpReturningBool::equal, false, AssertResult::FAIL, "ListEmpty2->equal(None2)");
+    doOpReturningBoolAndCompareResult(ListEmpty2, False, OpReturningBool::equal, false, AssertResult::FAIL, "ListEmpty2->equal(False)");
+    doOpReturningBoolAndCompareResult(ListEmpty2, False2, OpReturningBool::equal, false, AssertResult::FAIL, "ListEmpty2->equal(False2)");
+    doOpReturningBoolAndCompareResult(ListEmpty2, True, OpReturningBool::equal, false, AssertResult::FAIL, "ListEmpty2->equal(True)");
+    doOpReturningBoolAndCompareResult(ListEmpty2, True2, OpReturningBool::equal, false, AssertResult::FAIL, "ListEmpty2->equal(True2)");
+    doOpReturningBoolAndCompareResult(ListEmpty2, IntZero, OpReturningBool::equal, false, AssertResult::FAIL, "ListEmpty2->equal(IntZero)");
+    doOpReturningBoolAndCompareResult(ListEmpty2, IntOne, OpReturningBool::equal, false, AssertResult::FAIL, "ListEmpty2->equal(IntOne)");
+    doOpReturningBoolAndCompareResult(ListEmpty2, IntTwo, OpReturningBool::equal, false, AssertResult::FAIL, "ListEmpty2->equal(IntTwo)");
+    doOpReturningBoolAndCompareResult(ListEmpty2, IntTwo2, OpReturningBool::equal, false, AssertResult::FAIL, "ListEmpty2->equal(IntTwo2)");
+    doOpReturningBoolAndCompareResult(ListEmpty2, Int8, OpReturningBool::equal, false, AssertResult::FAIL, "ListEmpty2->equal(Int8)");
+    doOpReturningBoolAndCompareResult(ListEmpty2, IntMinusOne, OpReturningBool::equal, false, AssertResult::FAIL, "ListEmpty2->equal(IntMinusOne)");
+    doOpReturningBoolAndCompareResult(ListEmpty2, IntMinusOne2, OpReturningBool::equal, false, AssertResult::FAIL, "ListEmpty2->equal(IntMinusOne2)");
+    doOpReturningBoolAndCompareResult(ListEmpty2, IntMinus12, OpReturningBool::equal, false, AssertResult::FAIL, "ListEmpty2->equal(IntMinus12)");
+    doOpReturningBoolAndCompareResult(ListEmpty2, IntMinus73, OpReturningBool::equal, false, AssertResult::FAIL, "ListEmpty2->equal(IntMinus73)");
+    doOpReturningBoolAndCompareResult(ListEmpty2, FloatMinusOne, OpReturningBool::equal, false, AssertResult::FAIL, "ListEmpty2->equal(FloatMinusOne)");
+    doOpReturningBoolAndCompareResult(ListEmpty2, FloatZero, OpReturningBool::equal, false, AssertResult::FAIL, "ListEmpty2->equal(FloatZero)");
+    doOpReturningBoolAndCompareResult(ListEmpty2, FloatOne, OpReturningBool::equal, false, AssertResult::FAIL, "ListEmpty2->equal(FloatOne)");
+    doOpReturningBoolAndCompareResult(ListEmpty2, FloatTwo, OpReturningBool::equal, false, AssertResult::FAIL, "ListEmpty2->equal(FloatTwo)");
+    doOpReturningBoolAndCompareResult(ListEmpty2, FloatTwo2, OpReturningBool::equal, false, AssertResult::FAIL, "ListEmpty2->equal(FloatTwo2)");
+    doOpReturningBoolAndCompareResult(ListEmpty2, Float2_5, OpReturningBool::equal, false, AssertResult::FAIL, "ListEmpty2->equal(Float2_5)");
+    doOpReturningBoolAndCompareResult(ListEmpty2, Float_23_74, OpReturningBool::equal, false, AssertResult::FAIL, "ListEmpty2->equal(Float_23_74)");
+    doOpReturningBoolAndCompareResult(ListEmpty2, StrEmpty, OpReturningBool::equal, false, AssertResult::FAIL, "ListEmpty2->equal(StrEmpty)");
+    doOpReturningBoolAndCompareResult(ListEmpty2, StrEmpty2, OpReturningBool::equal, false, AssertResult::FAIL, "ListEmpty2->equal(StrEmpty2)");
+    doOpReturningBoolAndCompareResult(ListEmpty2, StrA, OpReturningBool::equal, false, AssertResult::FAIL, "ListEmpty2->equal(StrA)");
+    doOpReturningBoolAndCompareResult(ListEmpty2, StrA2, OpReturningBool::equal, false, AssertResult::FAIL, "ListEmpty2->equal(StrA2)");
+    doOpReturningBoolAndCompareResult(ListEmpty2, StrB, OpReturningBool::equal, false, AssertResult::FAIL, "ListEmpty2->equal(StrB)");
+    doOpReturningBoolAndCompareResult(ListEmpty2, ListEmpty, OpReturningBool::equal, true, AssertResult::PASS, "ListEmpty2->equal(ListEmpty)");
+    doOpReturningBoolAndCompareResult(ListEmpty2, ListEmpty2, OpReturningBool::equal, true, AssertResult::PASS, "ListEmpty2->equal(ListEmpty2)");
+}
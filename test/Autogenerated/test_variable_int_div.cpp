@@ -0,0 +1,969 @@
+
+#include "variable/Variable.h"
+
+#include "Test.h"
+
+#define VAR(TYPE, VALUE) \
+    std::static_pointer_cast<GenericVariable>(std::make_shared<TYPE ## Variable>(VALUE))
+
+enum class OpReturningVar {
+    add,
+    sub,
+    mul,
+    div,
+    int_div,
+    pow,
+    mod,
+};
+
+enum class AssertResult {
+    PASS,
+    FAIL,
+    EXCEPTION,
+};
+
+static std::ostream& operator<< (std::ostream& os, AssertResult res) {
+    switch (res) {
+    case AssertResult::PASS:       os << "PASS";      break;
+    case AssertResult::FAIL:       os << "FAIL";      break;
+    case AssertResult::EXCEPTION:  os << "EXCEPTION"; break;
+    default:                       os << "???";
+    }
+    return os;
+}
+
+static Variable doOpReturningVar(Variable arg1, Variable arg2, OpReturningVar op) {
+    switch(op) {
+    case OpReturningVar::add: return arg1->add(arg2);
+    case OpReturningVar::sub: return arg1->sub(arg2);
+    case OpReturningVar::mul: return arg1->mul(arg2);
+    case OpReturningVar::div: return arg1->div(arg2);
+    case OpReturningVar::int_div: return arg1->int_div(arg2);
+    case OpReturningVar::mod: return arg1->mod(arg2);
+    case OpReturningVar::pow: return arg1->pow(arg2);
+    default: throw std::runtime_error("Bad op");
+    }
+}
+
+static void doOpReturningVarAndCompareResult(Variable arg1, Variable arg2, OpReturningVar op, Variable expected_res, AssertResult a_res, const char *descr) {
+    try {
+        auto res_var = doOpReturningVar(arg1, arg2, op);
+        auto assertion_result = res_var->strictly_equal(expected_res) ? AssertResult::PASS : AssertResult::FAIL;
+        if (assertion_result != a_res) {
+            std::cerr << descr << " returned " << assertion_result << " instead of " << a_res << "\n";
+        }
+    }
+    catch(...) {
+        if (a_res != AssertResult::EXCEPTION) {
+            std::cerr << descr << " returned EXCEPTION instead of " << a_res << "\n";
+        }
+    }
+}
+
+enum class OpReturningBool {
+    equal,
+    less,
+};
+
+static bool doOpReturningBool(Variable arg1, Variable arg2, OpReturningBool op) {
+    switch(op) {
+    case OpReturningBool::equal: return arg1->equal(arg2);
+    case OpReturningBool::less: return arg1->less(arg2);
+    default: throw std::runtime_error("Bad op");
+    }
+}
+
+static void doOpReturningBoolAndCompareResult(Variable arg1, Variable arg2, OpReturningBool op, bool expected_res, AssertResult a_res, const char *descr) {
+    try {
+        auto assertion_result = doOpReturningBool(arg1, arg2, op) ? AssertResult::PASS : AssertResult::FAIL;
+        if (assertion_result != a_res) {
+            std::cerr << descr << " returned " << assertion_result << " instead of " << a_res << "\n";
+        }
+    }
+    catch(...) {
+        if (a_res != AssertResult::EXCEPTION) {
+            std::cerr << descr << " returned EXCEPTION instead of " << a_res << "\n";
+        }
+    }
+}
+
+static auto None = std::static_pointer_cast<GenericVariable>(std::make_shared<NoneVariable>());
+static auto None2 = std::static_pointer_cast<GenericVariable>(std::make_shared<NoneVariable>());
+static auto False = VAR(Bool, false);
+static auto False2 = VAR(Bool, false);
+static auto True = VAR(Bool, true);
+static auto True2 = VAR(Bool, true);
+static auto IntZero = VAR(Int, 0);
+static auto IntOne = VAR(Int, 1);
+static auto IntTwo = VAR(Int, 2);
+static auto IntTwo2 = VAR(Int, 2);
+static auto Int8 = VAR(Int, 8);
+static auto IntMinusOne = VAR(Int, -1);
+static auto IntMinusOne2 = VAR(Int, -1);
+static auto IntMinus12 = VAR(Int, -12);
+static auto IntMinus73 = VAR(Int, -73);
+static auto FloatMinusOne = VAR(Float, -1);
+static auto FloatZero = VAR(Float, 0);
+static auto FloatOne = VAR(Float, 1);
+static auto FloatTwo = VAR(Float, 2);
+static auto FloatTwo2 = VAR(Float, 2);
+static auto Float2_5 = VAR(Float, 2.5);
+static auto Float_23_74 = VAR(Float, -23.74);
+static auto StrEmpty = VAR(String, "");
+static auto StrEmpty2 = VAR(String, "");
+static auto StrA = VAR(String, "some text");
+static auto StrA2 = VAR(String, "some text");
+static auto StrB = VAR(String, "other text");
+static auto ListEmpty = VAR(List, ListType());
+static auto ListEmpty2 = VAR(List, ListType());
+
+#include "variable/Variable.h"
+
+#include <gtest/gtest.h>
+
+class VariableInt_divTest: public testing::Test {
+};
+
+TEST_F(VariableInt_divTest, VariableInt_divTest) {
+    EXPECT_ANY_THROW(None->int_div(None));
+    EXPECT_ANY_THROW(None->int_div(None2));
+    EXPECT_ANY_THROW(None->int_div(False));
+    EXPECT_ANY_THROW(None->int_div(False2));
+    EXPECT_ANY_THROW(None->int_div(True));
+    EXPECT_ANY_THROW(None->int_div(True2));
+    EXPECT_ANY_THROW(None->int_div(IntZero));
+    EXPECT_ANY_THROW(None->int_div(IntOne));
+    EXPECT_ANY_THROW(None->int_div(IntTwo));
+    EXPECT_ANY_THROW(None->int_div(IntTwo2));
+    EXPECT_ANY_THROW(None->int_div(Int8));
+    EXPECT_ANY_THROW(None->int_div(IntMinusOne));
+    EXPECT_ANY_THROW(None->int_div(IntMinusOne2));
+    EXPECT_ANY_THROW(None->int_div(IntMinus12));
+    EXPECT_ANY_THROW(None->int_div(IntMinus73));
+    EXPECT_ANY_THROW(None->int_div(FloatMinusOne));
+    EXPECT_ANY_THROW(None->int_div(FloatZero));
+    EXPECT_ANY_THROW(None->int_div(FloatOne));
+    EXPECT_ANY_THROW(None->int_div(FloatTwo));
+    EXPECT_ANY_THROW(None->int_div(FloatTwo2));
+    EXPECT_ANY_THROW(None->int_div(Float2_5));
+    EXPECT_ANY_THROW(None->int_div(Float_23_74));
+    EXPECT_ANY_THROW(None->int_div(StrEmpty));
+    EXPECT_ANY_THROW(None->int_div(StrEmpty2));
+    EXPECT_ANY_THROW(None->int_div(StrA));
+    EXPECT_ANY_THROW(None->int_div(StrA2));
+    EXPECT_ANY_THROW(None->int_div(StrB));
+    EXPECT_ANY_THROW(None->int_div(ListEmpty));
+    EXPECT_ANY_THROW(None->int_div(ListEmpty2));
+    EXPECT_ANY_THROW(None2->int_div(None));
+    EXPECT_ANY_THROW(None2->int_div(None2));
+    EXPECT_ANY_THROW(None2->int_div(False));
+    EXPECT_ANY_THROW(None2->int_div(False2));
+    EXPECT_ANY_THROW(None2->int_div(True));
+    EXPECT_ANY_THROW(None2->int_div(True2));
+    EXPECT_ANY_THROW(None2->int_div(IntZero));
+    EXPECT_ANY_THROW(None2->int_div(IntOne));
+    EXPECT_ANY_THROW(None2->int_div(IntTwo));
+    EXPECT_ANY_THROW(None2->int_div(IntTwo2));
+    EXPECT_ANY_THROW(None2->int_div(Int8));
+    EXPECT_ANY_THROW(None2->int_div(IntMinusOne));
+    EXPECT_ANY_THROW(None2->int_div(IntMinusOne2));
+    EXPECT_ANY_THROW(None2->int_div(IntMinus12));
+    EXPECT_ANY_THROW(None2->int_div(IntMinus73));
+    EXPECT_ANY_THROW(None2->int_div(FloatMinusOne));
+    EXPECT_ANY_THROW(None2->int_div(FloatZero));
+    EXPECT_ANY_THROW(None2->int_div(FloatOne));
+    EXPECT_ANY_THROW(None2->int_div(FloatTwo));
+    EXPECT_ANY_THROW(None2->int_div(FloatTwo2));
+    EXPECT_ANY_THROW(None2->int_div(Float2_5));
+    EXPECT_ANY_THROW(None2->int_div(Float_23_74));
+    EXPECT_ANY_THROW(None2->int_div(StrEmpty));
+    EXPECT_ANY_THROW(None2->int_div(StrEmpty2));
+    EXPECT_ANY_THROW(None2->int_div(StrA));
+    EXPECT_ANY_THROW(None2->int_div(StrA2));
+    EXPECT_ANY_THROW(None2->int_div(StrB));
+    EXPECT_ANY_THROW(None2->int_div(ListEmpty));
+    EXPECT_ANY_THROW(None2->int_div(ListEmpty2));
+    EXPECT_ANY_THROW(False->int_div(None));
+    EXPECT_ANY_THROW(False->int_div(None2));
+    EXPECT_ANY_THROW(False->int_div(False));
+    EXPECT_ANY_THROW(False->int_div(False2));
+    EXPECT_TRUE(False->int_div(True)->strictly_equal(VAR(Int, 0)));
+    EXPECT_TRUE(False->int_div(True2)->strictly_equal(VAR(Int, 0)));
+    EXPECT_ANY_THROW(False->int_div(IntZero));
+    EXPECT_TRUE(False->int_div(IntOne)->strictly_equal(VAR(Int, 0)));
+    EXPECT_TRUE(False->int_div(IntTwo)->strictly_equal(VAR(Int, 0)));
+    EXPECT_TRUE(False->int_div(IntTwo2)->strictly_equal(VAR(Int, 0)));
+    EXPECT_TRUE(False->int_div(Int8)->strictly_equal(VAR(Int, 0)));
+    EXPECT_TRUE(False->int_div(IntMinusOne)->strictly_equal(VAR(Int, 0)));
+    EXPECT_TRUE(False->int_div(IntMinusOne2)->strictly_equal(VAR(Int, 0)));
+    EXPECT_TRUE(False->int_div(IntMinus12)->strictly_equal(VAR(Int, 0)));
+    EXPECT_TRUE(False->int_div(IntMinus73)->strictly_equal(VAR(Int, 0)));
+    EXPECT_TRUE(False->int_div(FloatMinusOne)->strictly_equal(VAR(Float, -0.0)));
+    EXPECT_ANY_THROW(False->int_div(FloatZero));
+    EXPECT_TRUE(False->int_div(FloatOne)->strictly_equal(VAR(Float, 0.0)));
+    EXPECT_TRUE(False->int_div(FloatTwo)->strictly_equal(VAR(Float, 0.0)));
+    EXPECT_TRUE(False->int_div(FloatTwo2)->strictly_equal(VAR(Float, 0.0)));
+    EXPECT_TRUE(False->int_div(Float2_5)->strictly_equal(VAR(Float, 0.0)));
+    EXPECT_TRUE(False->int_div(Float_23_74)->strictly_equal(VAR(Float, -0.0)));
+    EXPECT_ANY_THROW(False->int_div(StrEmpty));
+    EXPECT_ANY_THROW(False->int_div(StrEmpty2));
+    EXPECT_ANY_THROW(False->int_div(StrA));
+    EXPECT_ANY_THROW(False->int_div(StrA2));
+    EXPECT_ANY_THROW(False->int_div(StrB));
+    EXPECT_ANY_THROW(False->int_div(ListEmpty));
+    EXPECT_ANY_THROW(False->int_div(ListEmpty2));
+    EXPECT_ANY_THROW(False2->int_div(None));
+    EXPECT_ANY_THROW(False2->int_div(None2));
+    EXPECT_ANY_THROW(False2->int_div(False));
+    EXPECT_ANY_THROW(False2->int_div(False2));
+    EXPECT_TRUE(False2->int_div(True)->strictly_equal(VAR(Int, 0)));
+    EXPECT_TRUE(False2->int_div(True2)->strictly_equal(VAR(Int, 0)));
+    EXPECT_ANY_THROW(False2->int_div(IntZero));
+    EXPECT_TRUE(False2->int_div(IntOne)->strictly_equal(VAR(Int, 0)));
+    EXPECT_TRUE(False2->int_div(IntTwo)->strictly_equal(VAR(Int, 0)));
+    EXPECT_TRUE(False2->int_div(IntTwo2)->strictly_equal(VAR(Int, 0)));
+    EXPECT_TRUE(False2->int_div(Int8)->strictly_equal(VAR(Int, 0)));
+    EXPECT_TRUE(False2->int_div(IntMinusOne)->strictly_equal(VAR(Int, 0)));
+    EXPECT_TRUE(False2->int_div(IntMinusOne2)->strictly_equal(VAR(Int, 0)));
+    EXPECT_TRUE(False2->int_div(IntMinus12)->strictly_equal(VAR(Int, 0)));
+    EXPECT_TRUE(False2->int_div(IntMinus73)->strictly_equal(VAR(Int, 0)));
+    EXPECT_TRUE(False2->int_div(FloatMinusOne)->strictly_equal(VAR(Float, -0.0)));
+    EXPECT_ANY_THROW(False2->int_div(FloatZero));
+    EXPECT_TRUE(False2->int_div(FloatOne)->strictly_equal(VAR(Float, 0.0)));
+    EXPECT_TRUE(False2->int_div(FloatTwo)->strictly_equal(VAR(Float, 0.0)));
+    EXPECT_TRUE(False2->int_div(FloatTwo2)->strictly_equal(VAR(Float, 0.0)));
+    EXPECT_TRUE(False2->int_div(Float2_5)->strictly_equal(VAR(Float, 0.0)));
+    EXPECT_TRUE(False2->int_div(Float_23_74)->strictly_equal(VAR(Float, -0.0)));
+    EXPECT_ANY_THROW(False2->int_div(StrEmpty));
+    EXPECT_ANY_THROW(False2->int_div(StrEmpty2));
+    EXPECT_ANY_THROW(False2->int_div(StrA));
+    EXPECT_ANY_THROW(False2->int_div(StrA2));
+    EXPECT_ANY_THROW(False2->int_div(StrB));
+    EXPECT_ANY_THROW(False2->int_div(ListEmpty));
+    EXPECT_ANY_THROW(False2->int_div(ListEmpty2));
+    EXPECT_ANY_THROW(True->int_div(None));
+    EXPECT_ANY_THROW(True->int_div(None2));
+    EXPECT_ANY_THROW(True->int_div(False));
+    EXPECT_ANY_THROW(True->int_div(False2));
+    EXPECT_TRUE(True->int_div(True)->strictly_equal(VAR(Int, 1)));
+    EXPECT_TRUE(True->int_div(True2)->strictly_equal(VAR(Int, 1)));
+    EXPECT_ANY_THROW(True->int_div(IntZero));
+    EXPECT_TRUE(True->int_div(IntOne)->strictly_equal(VAR(Int, 1)));
+    EXPECT_TRUE(True->int_div(IntTwo)->strictly_equal(VAR(Int, 0)));
+    EXPECT_TRUE(True->int_div(IntTwo2)->strictly_equal(VAR(Int, 0)));
+    EXPECT_TRUE(True->int_div(Int8)->strictly_equal(VAR(Int, 0)));
+    EXPECT_TRUE(True->int_div(IntMinusOne)->strictly_equal(VAR(Int, -1)));
+    EXPECT_TRUE(True->int_div(IntMinusOne2)->strictly_equal(VAR(Int, -1)));
+    EXPECT_TRUE(True->int_div(IntMinus12)->strictly_equal(VAR(Int, -1)));
+    EXPECT_TRUE(True->int_div(IntMinus73)->strictly_equal(VAR(Int, -1)));
+    EXPECT_TRUE(True->int_div(FloatMinusOne)->strictly_equal(VAR(Float, -1.0)));
+    EXPECT_ANY_THROW(True->int_div(FloatZero));
+    EXPECT_TRUE(True->int_div(FloatOne)->strictly_equal(VAR(Float, 1.0)));
+    EXPECT_TRUE(True->int_div(FloatTwo)->strictly_equal(VAR(Float, 0.0)));
+    EXPECT_TRUE(True->int_div(FloatTwo2)->strictly_equal(VAR(Float, 0.0)));
+    EXPECT_TRUE(True->int_div(Float2_5)->strictly_equal(VAR(Float, 0.0)));
+    EXPECT_TRUE(True->int_div(Float_23_74)->strictly_equal(VAR(Float, -1.0)));
+    EXPECT_ANY_THROW(True->int_div(StrEmpty));
+    EXPECT_ANY_THROW(True->int_div(StrEmpty2));
+    EXPECT_ANY_THROW(True->int_div(StrA));
+    EXPECT_ANY_THROW(True->int_div(StrA2));
+    EXPECT_ANY_THROW(True->int_div(StrB));
+    EXPECT_ANY_THROW(True->int_div(ListEmpty));
+    EXPECT_ANY_THROW(True->int_div(ListEmpty2));
+    EXPECT_ANY_THROW(True2->int_div(None));
+    EXPECT_ANY_THROW(True2->int_div(None2));
+    EXPECT_ANY_THROW(True2->int_div(False));
+    EXPECT_ANY_THROW(True2->int_div(False2));
+    EXPECT_TRUE(True2->int_div(True)->strictly_equal(VAR(Int, 1)));
+    EXPECT_TRUE(True2->int_div(True2)->strictly_equal(VAR(Int, 1)));
+    EXPECT_ANY_THROW(True2->int_div(IntZero));
+    EXPECT_TRUE(True2->int_div(IntOne)->strictly_equal(VAR(Int, 1)));
+    EXPECT_TRUE(True2->int_div(IntTwo)->strictly_equal(VAR(Int, 0)));
+    EXPECT_TRUE(True2->int_div(IntTwo2)->strictly_equal(VAR(Int, 0)));
+    EXPECT_TRUE(True2->int_div(Int8)->strictly_equal(VAR(Int, 0)));
+    EXPECT_TRUE(True2->int_div(IntMinusOne)->strictly_equal(VAR(Int, -1)));
+    EXPECT_TRUE(True2->int_div(IntMinusOne2)->strictly_equal(VAR(Int, -1)));
+    EXPECT_TRUE(True2->int_div(IntMinus12)->strictly_equal(VAR(Int, -1)));
+    EXPECT_TRUE(True2->int_div(IntMinus73)->strictly_equal(VAR(Int, -1)));
+    EXPECT_TRUE(True2->int_div(FloatMinusOne)->strictly_equal(VAR(Float, -1.0)));
+    EXPECT_ANY_THROW(True2->int_div(FloatZero));
+    EXPECT_TRUE(True2->int_div(FloatOne)->strictly_equal(VAR(Float, 1.0)));
+    EXPECT_TRUE(True2->int_div(FloatTwo)->strictly_equal(VAR(Float, 0.0)));
+    EXPECT_TRUE(True2->int_div(FloatTwo2)->strictly_equal(VAR(Float, 0.0)));
+    EXPECT_TRUE(True2->int_div(Float2_5)->strictly_equal(VAR(Float, 0.0)));
+    EXPECT_TRUE(True2->int_div(Float_23_74)->strictly_equal(VAR(Float, -1.0)));
+    EXPECT_ANY_THROW(True2->int_div(StrEmpty));
+    EXPECT_ANY_THROW(True2->int_div(StrEmpty2));
+    EXPECT_ANY_THROW(True2->int_div(StrA));
+    EXPECT_ANY_THROW(True2->int_div(StrA2));
+    EXPECT_ANY_THROW(True2->int_div(StrB));
+    EXPECT_ANY_THROW(True2->int_div(ListEmpty));
+    EXPECT_ANY_THROW(True2->int_div(ListEmpty2));
+    EXPECT_ANY_THROW(IntZero->int_div(None));
+    EXPECT_ANY_THROW(IntZero->int_div(None2));
+    EXPECT_ANY_THROW(IntZero->int_div(False));
+    EXPECT_ANY_THROW(IntZero->int_div(False2));
+    EXPECT_TRUE(IntZero->int_div(True)->strictly_equal(VAR(Int, 0)));
+    EXPECT_TRUE(IntZero->int_div(True2)->strictly_equal(VAR(Int, 0)));
+    EXPECT_ANY_THROW(IntZero->int_div(IntZero));
+    EXPECT_TRUE(IntZero->int_div(IntOne)->strictly_equal(VAR(Int, 0)));
+    EXPECT_TRUE(IntZero->int_div(IntTwo)->strictly_equal(VAR(Int, 0)));
+    EXPECT_TRUE(IntZero->int_div(IntTwo2)->strictly_equal(VAR(Int, 0)));
+    EXPECT_TRUE(IntZero->int_div(Int8)->strictly_equal(VAR(Int, 0)));
+    EXPECT_TRUE(IntZero->int_div(IntMinusOne)->strictly_equal(VAR(Int, 0)));
+    EXPECT_TRUE(IntZero->int_div(IntMinusOne2)->strictly_equal(VAR(Int, 0)));
+    EXPECT_TRUE(IntZero->int_div(IntMinus12)->strictly_equal(VAR(Int, 0)));
+    EXPECT_TRUE(IntZero->int_div(IntMinus73)->strictly_equal(VAR(Int, 0)));
+    EXPECT_TRUE(IntZero->int_div(FloatMinusOne)->strictly_equal(VAR(Float, -0.0)));
+    EXPECT_ANY_THROW(IntZero->int_div(FloatZero));
+    EXPECT_TRUE(IntZero->int_div(FloatOne)->strictly_equal(VAR(Float, 0.0)));
+    EXPECT_TRUE(IntZero->int_div(FloatTwo)->strictly_equal(VAR(Float, 0.0)));
+    EXPECT_TRUE(IntZero->int_div(FloatTwo2)->strictly_equal(VAR(Float, 0.0)));
+    EXPECT_TRUE(IntZero->int_div(Float2_5)->strictly_equal(VAR(Float, 0.0)));
+    EXPECT_TRUE(IntZero->int_div(Float_23_74)->strictly_equal(VAR(Float, -0.0)));
+    EXPECT_ANY_THROW(IntZero->int_div(StrEmpty));
+    EXPECT_ANY_THROW(IntZero->int_div(StrEmpty2));
+    EXPECT_ANY_THROW(IntZero->int_div(StrA));
+    EXPECT_ANY_THROW(IntZero->int_div(StrA2));
+    EXPECT_ANY_THROW(IntZero->int_div(StrB));
+    EXPECT_ANY_THROW(IntZero->int_div(ListEmpty));
+    EXPECT_ANY_THROW(IntZero->int_div(ListEmpty2));
+    EXPECT_ANY_THROW(IntOne->int_div(None));
+    EXPECT_ANY_THROW(IntOne->int_div(None2));
+    EXPECT_ANY_THROW(IntOne->int_div(False));
+    EXPECT_ANY_THROW(IntOne->int_div(False2));
+    EXPECT_TRUE(IntOne->int_div(True)->strictly_equal(VAR(Int, 1)));
+    EXPECT_TRUE(IntOne->int_div(True2)->strictly_equal(VAR(Int, 1)));
+    EXPECT_ANY_THROW(IntOne->int_div(IntZero));
+    EXPECT_TRUE(IntOne->int_div(IntOne)->strictly_equal(VAR(Int, 1)));
+    EXPECT_TRUE(IntOne->int_div(IntTwo)->strictly_equal(VAR(Int, 0)));
+    EXPECT_TRUE(IntOne->int_div(IntTwo2)->strictly_equal(VAR(Int, 0)));
+    EXPECT_TRUE(IntOne->int_div(Int8)->strictly_equal(VAR(Int, 0)));
+    EXPECT_TRUE(IntOne->int_div(IntMinusOne)->strictly_equal(VAR(Int, -1)));
+    EXPECT_TRUE(IntOne->int_div(IntMinusOne2)->strictly_equal(VAR(Int, -1)));
+    EXPECT_TRUE(IntOne->int_div(IntMinus12)->strictly_equal(VAR(Int, -1)));
+    EXPECT_TRUE(IntOne->int_div(IntMinus73)->strictly_equal(VAR(Int, -1)));
+    EXPECT_TRUE(IntOne->int_div(FloatMinusOne)->strictly_equal(VAR(Float, -1.0)));
+    EXPECT_ANY_THROW(IntOne->int_div(FloatZero));
+    EXPECT_TRUE(IntOne->int_div(FloatOne)->strictly_equal(VAR(Float, 1.0)));
+    EXPECT_TRUE(IntOne->int_div(FloatTwo)->strictly_equal(VAR(Float, 0.0)));
+    EXPECT_TRUE(IntOne->int_div(FloatTwo2)->strictly_equal(VAR(Float, 0.0)));
+    EXPECT_TRUE(IntOne->int_div(Float2_5)->strictly_equal(VAR(Float, 0.0)));
+    EXPECT_TRUE(IntOne->int_div(Float_23_74)->strictly_equal(VAR(Float, -1.0)));
+    EXPECT_ANY_THROW(IntOne->int_div(StrEmpty));
+    EXPECT_ANY_THROW(IntOne->int_div(StrEmpty2));
+    EXPECT_ANY_THROW(IntOne->int_div(StrA));
+    EXPECT_ANY_THROW(IntOne->int_div(StrA2));
+    EXPECT_ANY_THROW(IntOne->int_div(StrB));
+    EXPECT_ANY_THROW(IntOne->int_div(ListEmpty));
+    EXPECT_ANY_THROW(IntOne->int_div(ListEmpty2));
+    EXPECT_ANY_THROW(IntTwo->int_div(None));
+    EXPECT_ANY_THROW(IntTwo->int_div(None2));
+    EXPECT_ANY_THROW(IntTwo->int_div(False));
+    EXPECT_ANY_THROW(IntTwo->int_div(False2));
+    EXPECT_TRUE(IntTwo->int_div(True)->strictly_equal(VAR(Int, 2)));
+    EXPECT_TRUE(IntTwo->int_div(True2)->strictly_equal(VAR(Int, 2)));
+    EXPECT_ANY_THROW(IntTwo->int_div(IntZero));
+    EXPECT_TRUE(IntTwo->int_div(IntOne)->strictly_equal(VAR(Int, 2)));
+    EXPECT_TRUE(IntTwo->int_div(IntTwo)->strictly_equal(VAR(Int, 1)));
+    EXPECT_TRUE(IntTwo->int_div(IntTwo2)->strictly_equal(VAR(Int, 1)));
+    EXPECT_TRUE(IntTwo->int_div(Int8)->strictly_equal(VAR(Int, 0)));
+    EXPECT_TRUE(IntTwo->int_div(IntMinusOne)->strictly_equal(VAR(Int, -2)));
+    EXPECT_TRUE(IntTwo->int_div(IntMinusOne2)->strictly_equal(VAR(Int, -2)));
+    EXPECT_TRUE(IntTwo->int_div(IntMinus12)->strictly_equal(VAR(Int, -1)));
+    EXPECT_TRUE(IntTwo->int_div(IntMinus73)->strictly_equal(VAR(Int, -1)));
+    EXPECT_TRUE(IntTwo->int_div(FloatMinusOne)->strictly_equal(VAR(Float, -2.0)));
+    EXPECT_ANY_THROW(IntTwo->int_div(FloatZero));
+    EXPECT_TRUE(IntTwo->int_div(FloatOne)->strictly_equal(VAR(Float, 2.0)));
+    EXPECT_TRUE(IntTwo->int_div(FloatTwo)->strictly_equal(VAR(Float, 1.0)));
+    EXPECT_TRUE(IntTwo->int_div(FloatTwo2)->strictly_equal(VAR(Float, 1.0)));
+    EXPECT_TRUE(IntTwo->int_div(Float2_5)->strictly_equal(VAR(Float, 0.0)));
+    EXPECT_TRUE(IntTwo->int_div(Float_23_74)->strictly_equal(VAR(Float, -1.0)));
+    EXPECT_ANY_THROW(IntTwo->int_div(StrEmpty));
+    EXPECT_ANY_THROW(IntTwo->int_div(StrEmpty2));
+    EXPECT_ANY_THROW(IntTwo->int_div(StrA));
+    EXPECT_ANY_THROW(IntTwo->int_div(StrA2));
+    EXPECT_ANY_THROW(IntTwo->int_div(StrB));
+    EXPECT_ANY_THROW(IntTwo->int_div(ListEmpty));
+    EXPECT_ANY_THROW(IntTwo->int_div(ListEmpty2));
+    EXPECT_ANY_THROW(IntTwo2->int_div(None));
+    EXPECT_ANY_THROW(IntTwo2->int_div(None2));
+    EXPECT_ANY_THROW(IntTwo2->int_div(False));
+    EXPECT_ANY_THROW(IntTwo2->int_div(False2));
+    EXPECT_TRUE(IntTwo2->int_div(True)->strictly_equal(VAR(Int, 2)));
+    EXPECT_TRUE(IntTwo2->int_div(True2)->strictly_equal(VAR(Int, 2)));
+    EXPECT_ANY_THROW(IntTwo2->int_div(IntZero));
+    EXPECT_TRUE(IntTwo2->int_div(IntOne)->strictly_equal(VAR(Int, 2)));
+    EXPECT_TRUE(IntTwo2->int_div(IntTwo)->strictly_equal(VAR(Int, 1)));
+    EXPECT_TRUE(IntTwo2->int_div(IntTwo2)->strictly_equal(VAR(Int, 1)));
+    EXPECT_TRUE(IntTwo2->int_div(Int8)->strictly_equal(VAR(Int, 0)));
+    EXPECT_TRUE(IntTwo2->int_div(IntMinusOne)->strictly_equal(VAR(Int, -2)));
+    EXPECT_TRUE(IntTwo2->int_div(IntMinusOne2)->strictly_equal(VAR(Int, -2)));
+    EXPECT_TRUE(IntTwo2->int_div(IntMinus12)->strictly_equal(VAR(Int, -1)));
+    EXPECT_TRUE(IntTwo2->int_div(IntMinus73)->strictly_equal(VAR(Int, -1)));
+    EXPECT_TRUE(IntTwo2->int_div(FloatMinusOne)->strictly_equal(VAR(Float, -2.0)));
+    EXPECT_ANY_THROW(IntTwo2->int_div(FloatZero));
+    EXPECT_TRUE(IntTwo2->int_div(FloatOne)->strictly_equal(VAR(Float, 2.0)));
+    EXPECT_TRUE(IntTwo2->int_div(FloatTwo)->strictly_equal(VAR(Float, 1.0)));
+    EXPECT_TRUE(IntTwo2->int_div(FloatTwo2)->strictly_equal(VAR(Float, 1.0)));
+    EXPECT_TRUE(IntTwo2->int_div(Float2_5)->strictly_equal(VAR(Float, 0.0)));
+    EXPECT_TRUE(IntTwo2->int_div(Float_23_74)->strictly_equal(VAR(Float, -1.0)));
+    EXPECT_ANY_THROW(IntTwo2->int_div(StrEmpty));
+    EXPECT_ANY_THROW(IntTwo2->int_div(StrEmpty2));
+    EXPECT_ANY_THROW(IntTwo2->int_div(StrA));
+    EXPECT_ANY_THROW(IntTwo2->int_div(StrA2));
+    EXPECT_ANY_THROW(IntTwo2->int_div(StrB));
+    EXPECT_ANY_THROW(IntTwo2->int_div(ListEmpty));
+    EXPECT_ANY_THROW(IntTwo2->int_div(ListEmpty2));
+    EXPECT_ANY_THROW(Int8->int_div(None));
+    EXPECT_ANY_THROW(Int8->int_div(None2));
+    EXPECT_ANY_THROW(Int8->int_div(False));
+    EXPECT_ANY_THROW(Int8->int_div(False2));
+    EXPECT_TRUE(Int8->int_div(True)->strictly_equal(VAR(Int, 8)));
+    EXPECT_TRUE(Int8->int_div(True2)->strictly_equal(VAR(Int, 8)));
+    EXPECT_ANY_THROW(Int8->int_div(IntZero));
+    EXPECT_TRUE(Int8->int_div(IntOne)->strictly_equal(VAR(Int, 8)));
+    EXPECT_TRUE(Int8->int_div(IntTwo)->strictly_equal(VAR(Int, 4)));
+    EXPECT_TRUE(Int8->int_div(IntTwo2)->strictly_equal(VAR(Int, 4)));
+    EXPECT_TRUE(Int8->int_div(Int8)->strictly_equal(VAR(Int, 1)));
+    EXPECT_TRUE(Int8->int_div(IntMinusOne)->strictly_equal(VAR(Int, -8)));
+    EXPECT_TRUE(Int8->int_div(IntMinusOne2)->strictly_equal(VAR(Int, -8)));
+    EXPECT_TRUE(Int8->int_div(IntMinus12)->strictly_equal(VAR(Int, -1)));
+    EXPECT_TRUE(Int8->int_div(IntMinus73)->strictly_equal(VAR(Int, -1)));
+    EXPECT_TRUE(Int8->int_div(FloatMinusOne)->strictly_equal(VAR(Float, -8.0)));
+    EXPECT_ANY_THROW(Int8->int_div(FloatZero));
+    EXPECT_TRUE(Int8->int_div(FloatOne)->strictly_equal(VAR(Float, 8.0)));
+    EXPECT_TRUE(Int8->int_div(FloatTwo)->strictly_equal(VAR(Float, 4.0)));
+    EXPECT_TRUE(Int8->int_div(FloatTwo2)->strictly_equal(VAR(Float, 4.0)));
+    EXPECT_TRUE(Int8->int_div(Float2_5)->strictly_equal(VAR(Float, 3.0)));
+    EXPECT_TRUE(Int8->int_div(Float_23_74)->strictly_equal(VAR(Float, -1.0)));
+    EXPECT_ANY_THROW(Int8->int_div(StrEmpty));
+    EXPECT_ANY_THROW(Int8->int_div(StrEmpty2));
+    EXPECT_ANY_THROW(Int8->int_div(StrA));
+    EXPECT_ANY_THROW(Int8->int_div(StrA2));
+    EXPECT_ANY_THROW(Int8->int_div(StrB));
+    EXPECT_ANY_THROW(Int8->int_div(ListEmpty));
+    EXPECT_ANY_THROW(Int8->int_div(ListEmpty2));
+    EXPECT_ANY_THROW(IntMinusOne->int_div(None));
+    EXPECT_ANY_THROW(IntMinusOne->int_div(None2));
+    EXPECT_ANY_THROW(IntMinusOne->int_div(False));
+    EXPECT_ANY_THROW(IntMinusOne->int_div(False2));
+    EXPECT_TRUE(IntMinusOne->int_div(True)->strictly_equal(VAR(Int, -1)));
+    EXPECT_TRUE(IntMinusOne->int_div(True2)->strictly_equal(VAR(Int, -1)));
+    EXPECT_ANY_THROW(IntMinusOne->int_div(IntZero));
+    EXPECT_TRUE(IntMinusOne->int_div(IntOne)->strictly_equal(VAR(Int, -1)));
+    EXPECT_TRUE(IntMinusOne->int_div(IntTwo)->strictly_equal(VAR(Int, -1)));
+    EXPECT_TRUE(IntMinusOne->int_div(IntTwo2)->strictly_equal(VAR(Int, -1)));
+    EXPECT_TRUE(IntMinusOne->int_div(Int8)->strictly_equal(VAR(Int, -1)));
+    EXPECT_TRUE(IntMinusOne->int_div(IntMinusOne)->strictly_equal(VAR(Int, 1)));
+    EXPECT_TRUE(IntMinusOne->int_div(IntMinusOne2)->strictly_equal(VAR(Int, 1)));
+    EXPECT_TRUE(IntMinusOne->int_div(IntMinus12)->strictly_equal(VAR(Int, 0)));
+    EXPECT_TRUE(IntMinusOne->int_div(IntMinus73)->strictly_equal(VAR(Int, 0)));
+    EXPECT_TRUE(IntMinusOne->int_div(FloatMinusOne)->strictly_equal(VAR(Float, 1.0)));
+    EXPECT_ANY_THROW(IntMinusOne->int_div(FloatZero));
+    EXPECT_TRUE(IntMinusOne->int_div(FloatOne)->strictly_equal(VAR(Float, -1.0)));
+    EXPECT_TRUE(IntMinusOne->int_div(FloatTwo)->strictly_equal(VAR(Float, -1.0)));
+    EXPECT_TRUE(IntMinusOne->int_div(FloatTwo2)->strictly_equal(VAR(Float, -1.0)));
+    EXPECT_TRUE(IntMinusOne->int_div(Float2_5)->strictly_equal(VAR(Float, -1.0)));
+    EXPECT_TRUE(IntMinusOne->int_div(Float_23_74)->strictly_equal(VAR(Float, 0.0)));
+    EXPECT_ANY_THROW(IntMinusOne->int_div(StrEmpty));
+    EXPECT_ANY_THROW(IntMinusOne->int_div(StrEmpty2));
+    EXPECT_ANY_THROW(IntMinusOne->int_div(StrA));
+    EXPECT_ANY_THROW(IntMinusOne->int_div(StrA2));
+    EXPECT_ANY_THROW(IntMinusOne->int_div(StrB));
+    EXPECT_ANY_THROW(IntMinusOne->int_div(ListEmpty));
+    EXPECT_ANY_THROW(IntMinusOne->int_div(ListEmpty2));
+    EXPECT_ANY_THROW(IntMinusOne2->int_div(None));
+    EXPECT_ANY_THROW(IntMinusOne2->int_div(None2));
+    EXPECT_ANY_THROW(IntMinusOne2->int_div(False));
+    EXPECT_ANY_THROW(IntMinusOne2->int_div(False2));
+    EXPECT_TRUE(IntMinusOne2->int_div(True)->strictly_equal(VAR(Int, -1)));
+    EXPECT_TRUE(IntMinusOne2->int_div(True2)->strictly_equal(VAR(Int, -1)));
+    EXPECT_ANY_THROW(IntMinusOne2->int_div(IntZero));
+    EXPECT_TRUE(IntMinusOne2->int_div(IntOne)->strictly_equal(VAR(Int, -1)));
+    EXPECT_TRUE(IntMinusOne2->int_div(IntTwo)->strictly_equal(VAR(Int, -1)));
+    EXPECT_TRUE(IntMinusOne2->int_div(IntTwo2)->strictly_equal(VAR(Int, -1)));
+    EXPECT_TRUE(IntMinusOne2->int_div(Int8)->strictly_equal(VAR(Int, -1)));
+    EXPECT_TRUE(IntMinusOne2->int_div(IntMinusOne)->strictly_equal(VAR(Int, 1)));
+    EXPECT_TRUE(IntMinusOne2->int_div(IntMinusOne2)->strictly_equal(VAR(Int, 1)));
+    EXPECT_TRUE(IntMinusOne2->int_div(IntMinus12)->strictly_equal(VAR(Int, 0)));
+    EXPECT_TRUE(IntMinusOne2->int_div(IntMinus73)->strictly_equal(VAR(Int, 0)));
+    EXPECT_TRUE(IntMinusOne2->int_div(FloatMinusOne)->strictly_equal(VAR(Float, 1.0)));
+    EXPECT_ANY_THROW(IntMinusOne2->int_div(FloatZero));
+    EXPECT_TRUE(IntMinusOne2->int_div(FloatOne)->strictly_equal(VAR(Float, -1.0)));
+    EXPECT_TRUE(IntMinusOne2->int_div(FloatTwo)->strictly_equal(VAR(Float, -1.0)));
+    EXPECT_TRUE(IntMinusOne2->int_div(FloatTwo2)->strictly_equal(VAR(Float, -1.0)));
+    EXPECT_TRUE(IntMinusOne2->int_div(Float2_5)->strictly_equal(VAR(Float, -1.0)));
+    EXPECT_TRUE(IntMinusOne2->int_div(Float_23_74)->strictly_equal(VAR(Float, 0.0)));
+    EXPECT_ANY_THROW(IntMinusOne2->int_div(StrEmpty));
+    EXPECT_ANY_THROW(IntMinusOne2->int_div(StrEmpty2));
+    EXPECT_ANY_THROW(IntMinusOne2->int_div(StrA));
+    EXPECT_ANY_THROW(IntMinusOne2->int_div(StrA2));
+    EXPECT_ANY_THROW(IntMinusOne2->int_div(StrB));
+    EXPECT_ANY_THROW(IntMinusOne2->int_div(ListEmpty));
+    EXPECT_ANY_THROW(IntMinusOne2->int_div(ListEmpty2));
+    EXPECT_ANY_THROW(IntMinus12->int_div(None));
+    EXPECT_ANY_THROW(IntMinus12->int_div(None2));
+    EXPECT_ANY_THROW(IntMinus12->int_div(False));
+    EXPECT_ANY_THROW(IntMinus12->int_div(False2));
+    EXPECT_TRUE(IntMinus12->int_div(True)->strictly_equal(VAR(Int, -12)));
+    EXPECT_TRUE(IntMinus12->int_div(True2)->strictly_equal(VAR(Int, -12)));
+    EXPECT_ANY_THROW(IntMinus12->int_div(IntZero));
+    EXPECT_TRUE(IntMinus12->int_div(IntOne)->strictly_equal(VAR(Int, -12)));
+    EXPECT_TRUE(IntMinus12->int_div(IntTwo)->strictly_equal(VAR(Int, -6)));
+    EXPECT_TRUE(IntMinus12->int_div(IntTwo2)->strictly_equal(VAR(Int, -6)));
+    EXPECT_TRUE(IntMinus12->int_div(Int8)->strictly_equal(VAR(Int, -2)));
+    EXPECT_TRUE(IntMinus12->int_div(IntMinusOne)->strictly_equal(VAR(Int, 12)));
+    EXPECT_TRUE(IntMinus12->int_div(IntMinusOne2)->strictly_equal(VAR(Int, 12)));
+    EXPECT_TRUE(IntMinus12->int_div(IntMinus12)->strictly_equal(VAR(Int, 1)));
+    EXPECT_TRUE(IntMinus12->int_div(IntMinus73)->strictly_equal(VAR(Int, 0)));
+    EXPECT_TRUE(IntMinus12->int_div(FloatMinusOne)->strictly_equal(VAR(Float, 12.0)));
+    EXPECT_ANY_THROW(IntMinus12->int_div(FloatZero));
+    EXPECT_TRUE(IntMinus12->int_div(FloatOne)->strictly_equal(VAR(Float, -12.0)));
+    EXPECT_TRUE(IntMinus12->int_div(FloatTwo)->strictly_equal(VAR(Float, -6.0)));
+    EXPECT_TRUE(IntMinus12->int_div(FloatTwo2)->strictly_equal(VAR(Float, -6.0)));
+    EXPECT_TRUE(IntMinus12->int_div(Float2_5)->strictly_equal(VAR(Float, -5.0)));
+    EXPECT_TRUE(IntMinus12->int_div(Float_23_74)->strictly_equal(VAR(Float, 0.0)));
+    EXPECT_ANY_THROW(IntMinus12->int_div(StrEmpty));
+    EXPECT_ANY_THROW(IntMinus12->int_div(StrEmpty2));
+    EXPECT_ANY_THROW(IntMinus12->int_div(StrA));
+    EXPECT_ANY_THROW(IntMinus12->int_div(StrA2));
+    EXPECT_ANY_THROW(IntMinus12->int_div(StrB));
+    EXPECT_ANY_THROW(IntMinus12->int_div(ListEmpty));
+    EXPECT_ANY_THROW(IntMinus12->int_div(ListEmpty2));
+    EXPECT_ANY_THROW(IntMinus73->int_div(None));
+    EXPECT_ANY_THROW(IntMinus73->int_div(None2));
+    EXPECT_ANY_THROW(IntMinus73->int_div(False));
+    EXPECT_ANY_THROW(IntMinus73->int_div(False2));
+    EXPECT_TRUE(IntMinus73->int_div(True)->strictly_equal(VAR(Int, -73)));
+    EXPECT_TRUE(IntMinus73->int_div(True2)->strictly_equal(VAR(Int, -73)));
+    EXPECT_ANY_THROW(IntMinus73->int_div(IntZero));
+    EXPECT_TRUE(IntMinus73->int_div(IntOne)->strictly_equal(VAR(Int, -73)));
+    EXPECT_TRUE(IntMinus73->int_div(IntTwo)->strictly_equal(VAR(Int, -37)));
+    EXPECT_TRUE(IntMinus73->int_div(IntTwo2)->strictly_equal(VAR(Int, -37)));
+    EXPECT_TRUE(IntMinus73->int_div(Int8)->strictly_equal(VAR(Int, -10)));
+    EXPECT_TRUE(IntMinus73->int_div(IntMinusOne)->strictly_equal(VAR(Int, 73)));
+    EXPECT_TRUE(IntMinus73->int_div(IntMinusOne2)->strictly_equal(VAR(Int, 73)));
+    EXPECT_TRUE(IntMinus73->int_div(IntMinus12)->strictly_equal(VAR(Int, 6)));
+    EXPECT_TRUE(IntMinus73->int_div(IntMinus73)->strictly_equal(VAR(Int, 1)));
+    EXPECT_TRUE(IntMinus73->int_div(FloatMinusOne)->strictly_equal(VAR(Float, 73.0)));
+    EXPECT_ANY_THROW(IntMinus73->int_div(FloatZero));
+    EXPECT_TRUE(IntMinus73->int_div(FloatOne)->strictly_equal(VAR(Float, -73.0)));
+    EXPECT_TRUE(IntMinus73->int_div(FloatTwo)->strictly_equal(VAR(Float, -37.0)));
+    EXPECT_TRUE(IntMinus73->int_div(FloatTwo2)->strictly_equal(VAR(Float, -37.0)));
+    EXPECT_TRUE(IntMinus73->int_div(Float2_5)->strictly_equal(VAR(Float, -30.0)));
+    EXPECT_TRUE(IntMinus73->int_div(Float_23_74)->strictly_equal(VAR(Float, 3.0)));
+    EXPECT_ANY_THROW(IntMinus73->int_div(StrEmpty));
+    EXPECT_ANY_THROW(IntMinus73->int_div(StrEmpty2));
+    EXPECT_ANY_THROW(IntMinus73->int_div(StrA));
+    EXPECT_ANY_THROW(IntMinus73->int_div(StrA2));
+    EXPECT_ANY_THROW(IntMinus73->int_div(StrB));
+    EXPECT_ANY_THROW(IntMinus73->int_div(ListEmpty));
+    EXPECT_ANY_THROW(IntMinus73->int_div(ListEmpty2));
+    EXPECT_ANY_THROW(FloatMinusOne->int_div(None));
+    EXPECT_ANY_THROW(FloatMinusOne->int_div(None2));
+    EXPECT_ANY_THROW(FloatMinusOne->int_div(False));
+    EXPECT_ANY_THROW(FloatMinusOne->int_div(False2));
+    EXPECT_TRUE(FloatMinusOne->int_div(True)->strictly_equal(VAR(Float, -1.0)));
+    EXPECT_TRUE(FloatMinusOne->int_div(True2)->strictly_equal(VAR(Float, -1.0)));
+    EXPECT_ANY_THROW(FloatMinusOne->int_div(IntZero));
+    EXPECT_TRUE(FloatMinusOne->int_div(IntOne)->strictly_equal(VAR(Float, -1.0)));
+    EXPECT_TRUE(FloatMinusOne->int_div(IntTwo)->strictly_equal(VAR(Float, -1.0)));
+    EXPECT_TRUE(FloatMinusOne->int_div(IntTwo2)->strictly_equal(VAR(Float, -1.0)));
+    EXPECT_TRUE(FloatMinusOne->int_div(Int8)->strictly_equal(VAR(Float, -1.0)));
+    EXPECT_TRUE(FloatMinusOne->int_div(IntMinusOne)->strictly_equal(VAR(Float, 1.0)));
+    EXPECT_TRUE(FloatMinusOne->int_div(IntMinusOne2)->strictly_equal(VAR(Float, 1.0)));
+    EXPECT_TRUE(FloatMinusOne->int_div(IntMinus12)->strictly_equal(VAR(Float, 0.0)));
+    EXPECT_TRUE(FloatMinusOne->int_div(IntMinus73)->strictly_equal(VAR(Float, 0.0)));
+    EXPECT_TRUE(FloatMinusOne->int_div(FloatMinusOne)->strictly_equal(VAR(Float, 1.0)));
+    EXPECT_ANY_THROW(FloatMinusOne->int_div(FloatZero));
+    EXPECT_TRUE(FloatMinusOne->int_div(FloatOne)->strictly_equal(VAR(Float, -1.0)));
+    EXPECT_TRUE(FloatMinusOne->int_div(FloatTwo)->strictly_equal(VAR(Float, -1.0)));
+    EXPECT_TRUE(FloatMinusOne->int_div(FloatTwo2)->strictly_equal(VAR(Float, -1.0)));
+    EXPECT_TRUE(FloatMinusOne->int_div(Float2_5)->strictly_equal(VAR(Float, -1.0)));
+    EXPECT_TRUE(FloatMinusOne->int_div(Float_23_74)->strictly_equal(VAR(Float, 0.0)));
+    EXPECT_ANY_THROW(FloatMinusOne->int_div(StrEmpty));
+    EXPECT_ANY_THROW(FloatMinusOne->int_div(StrEmpty2));
+    EXPECT_ANY_THROW(FloatMinusOne->int_div(StrA));
+    EXPECT_ANY_THROW(FloatMinusOne->int_div(StrA2));
+    EXPECT_ANY_THROW(FloatMinusOne->int_div(StrB));
+    EXPECT_ANY_THROW(FloatMinusOne->int_div(ListEmpty));
+    EXPECT_ANY_THROW(FloatMinusOne->int_div(ListEmpty2));
+    EXPECT_ANY_THROW(FloatZero->int_div(None));
+    EXPECT_ANY_THROW(FloatZero->int_div(None2));
+    EXPECT_ANY_THROW(FloatZero->int_div(False));
+    EXPECT_ANY_THROW(FloatZero->int_div(False2));
+    EXPECT_TRUE(FloatZero->int_div(True)->strictly_equal(VAR(Float, 0.0)));
+    EXPECT_TRUE(FloatZero->int_div(True2)->strictly_equal(VAR(Float, 0.0)));
+    EXPECT_ANY_THROW(FloatZero->int_div(IntZero));
+    EXPECT_TRUE(FloatZero->int_div(IntOne)->strictly_equal(VAR(Float, 0.0)));
+    EXPECT_TRUE(FloatZero->int_div(IntTwo)->strictly_equal(VAR(Float, 0.0)));
+    EXPECT_TRUE(FloatZero->int_div(IntTwo2)->strictly_equal(VAR(Float, 0.0)));
+    EXPECT_TRUE(FloatZero->int_div(Int8)->strictly_equal(VAR(Float, 0.0)));
+    EXPECT_TRUE(FloatZero->int_div(IntMinusOne)->strictly_equal(VAR(Float, -0.0)));
+    EXPECT_TRUE(FloatZero->int_div(IntMinusOne2)->strictly_equal(VAR(Float, -0.0)));
+    EXPECT_TRUE(FloatZero->int_div(IntMinus12)->strictly_equal(VAR(Float, -0.0)));
+    EXPECT_TRUE(FloatZero->int_div(IntMinus73)->strictly_equal(VAR(Float, -0.0)));
+    EXPECT_TRUE(FloatZero->int_div(FloatMinusOne)->strictly_equal(VAR(Float, -0.0)));
+    EXPECT_ANY_THROW(FloatZero->int_div(FloatZero));
+    EXPECT_TRUE(FloatZero->int_div(FloatOne)->strictly_equal(VAR(Float, 0.0)));
+    EXPECT_TRUE(FloatZero->int_div(FloatTwo)->strictly_equal(VAR(Float, 0.0)));
+    EXPECT_TRUE(FloatZero->int_div(FloatTwo2)->strictly_equal(VAR(Float, 0.0)));
+    EXPECT_TRUE(FloatZero->int_div(Float2_5)->strictly_equal(VAR(Float, 0.0)));
+    EXPECT_TRUE(FloatZero->int_div(Float_23_74)->strictly_equal(VAR(Float, -0.0)));
+    EXPECT_ANY_THROW(FloatZero->int_div(StrEmpty));
+    EXPECT_ANY_THROW(FloatZero->int_div(StrEmpty2));
+    EXPECT_ANY_THROW(FloatZero->int_div(StrA));
+    EXPECT_ANY_THROW(FloatZero->int_div(StrA2));
+    EXPECT_ANY_THROW(FloatZero->int_div(StrB));
+    EXPECT_ANY_THROW(FloatZero->int_div(ListEmpty));
+    EXPECT_ANY_THROW(FloatZero->int_div(ListEmpty2));
+    EXPECT_ANY_THROW(FloatOne->int_div(None));
+    EXPECT_ANY_THROW(FloatOne->int_div(None2));
+    EXPECT_ANY_THROW(FloatOne->int_div(False));
+    EXPECT_ANY_THROW(FloatOne->int_div(False2));
+    EXPECT_TRUE(FloatOne->int_div(True)->strictly_equal(VAR(Float, 1.0)));
+    EXPECT_TRUE(FloatOne->int_div(True2)->strictly_equal(VAR(Float, 1.0)));
+    EXPECT_ANY_THROW(FloatOne->int_div(IntZero));
+    EXPECT_TRUE(FloatOne->int_div(IntOne)->strictly_equal(VAR(Float, 1.0)));
+    EXPECT_TRUE(FloatOne->int_div(IntTwo)->strictly_equal(VAR(Float, 0.0)));
+    EXPECT_TRUE(FloatOne->int_div(IntTwo2)->strictly_equal(VAR(Float, 0.0)));
+    EXPECT_TRUE(FloatOne->int_div(Int8)->strictly_equal(VAR(Float, 0.0)));
+    EXPECT_TRUE(FloatOne->int_div(IntMinusOne)->strictly_equal(VAR(Float, -1.0)));
+    EXPECT_TRUE(FloatOne->int_div(IntMinusOne2)->strictly_equal(VAR(Float, -1.0)));
+    EXPECT_TRUE(FloatOne->int_div(IntMinus12)->strictly_equal(VAR(Float, -1.0)));
+    EXPECT_TRUE(FloatOne->int_div(IntMinus73)->strictly_equal(VAR(Float, -1.0)));
+    EXPECT_TRUE(FloatOne->int_div(FloatMinusOne)->strictly_equal(VAR(Float, -1.0)));
+    EXPECT_ANY_THROW(FloatOne->int_div(FloatZero));
+    EXPECT_TRUE(FloatOne->int_div(FloatOne)->strictly_equal(VAR(Float, 1.0)));
+    EXPECT_TRUE(FloatOne->int_div(FloatTwo)->strictly_equal(VAR(Float, 0.0)));
+    EXPECT_TRUE(FloatOne->int_div(FloatTwo2)->strictly_equal(VAR(Float, 0.0)));
+    EXPECT_TRUE(FloatOne->int_div(Float2_5)->strictly_equal(VAR(Float, 0.0)));
+    EXPECT_TRUE(FloatOne->int_div(Float_23_74)->strictly_equal(VAR(Float, -1.0)));
+    EXPECT_ANY_THROW(FloatOne->int_div(StrEmpty));
+    EXPECT_ANY_THROW(FloatOne->int_div(StrEmpty2));
+    EXPECT_ANY_THROW(FloatOne->int_div(StrA));
+    EXPECT_ANY_THROW(FloatOne->int_div(StrA2));
+    EXPECT_ANY_THROW(FloatOne->int_div(StrB));
+    EXPECT_ANY_THROW(FloatOne->int_div(ListEmpty));
+    EXPECT_ANY_THROW(FloatOne->int_div(ListEmpty2));
+    EXPECT_ANY_THROW(FloatTwo->int_div(None));
+    EXPECT_ANY_THROW(FloatTwo->int_div(None2));
+    EXPECT_ANY_THROW(FloatTwo->int_div(False));
+    EXPECT_ANY_THROW(FloatTwo->int_div(False2));
+    EXPECT_TRUE(FloatTwo->int_div(True)->strictly_equal(VAR(Float, 2.0)));
+    EXPECT_TRUE(FloatTwo->int_div(True2)->strictly_equal(VAR(Float, 2.0)));
+    EXPECT_ANY_THROW(FloatTwo->int_div(IntZero));
+    EXPECT_TRUE(FloatTwo->int_div(IntOne)->strictly_equal(VAR(Float, 2.0)));
+    EXPECT_TRUE(FloatTwo->int_div(IntTwo)->strictly_equal(VAR(Float, 1.0)));
+    EXPECT_TRUE(FloatTwo->int_div(IntTwo2)->strictly_equal(VAR(Float, 1.0)));
+    EXPECT_TRUE(FloatTwo->int_div(Int8)->strictly_equal(VAR(Float, 0.0)));
+    EXPECT_TRUE(FloatTwo->int_div(IntMinusOne)->strictly_equal(VAR(Float, -2.0)));
+    EXPECT_TRUE(FloatTwo->int_div(IntMinusOne2)->strictly_equal(VAR(Float, -2.0)));
+    EXPECT_TRUE(FloatTwo->int_div(IntMinus12)->strictly_equal(VAR(Float, -1.0)));
+    EXPECT_TRUE(FloatTwo->int_div(IntMinus73)->strictly_equal(VAR(Float, -1.0)));
+    EXPECT_TRUE(FloatTwo->int_div(FloatMinusOne)->strictly_equal(VAR(Float, -2.0)));
+    EXPECT_ANY_THROW(FloatTwo->int_div(FloatZero));
+    EXPECT_TRUE(FloatTwo->int_div(FloatOne)->strictly_equal(VAR(Float, 2.0)));
+    EXPECT_TRUE(FloatTwo->int_div(FloatTwo)->strictly_equal(VAR(Float, 1.0)));
+    EXPECT_TRUE(FloatTwo->int_div(FloatTwo2)->strictly_equal(VAR(Float, 1.0)));
+    EXPECT_TRUE(FloatTwo->int_div(Float2_5)->strictly_equal(VAR(Float, 0.0)));
+    EXPECT_TRUE(FloatTwo->int_div(Float_23_74)->strictly_equal(VAR(Float, -1.0)));
+    EXPECT_ANY_THROW(FloatTwo->int_div(StrEmpty));
+    EXPECT_ANY_THROW(FloatTwo->int_div(StrEmpty2));
+    EXPECT_ANY_THROW(FloatTwo->int_div(StrA));
+    EXPECT_ANY_THROW(FloatTwo->int_div(StrA2));
+    EXPECT_ANY_THROW(FloatTwo->int_div(StrB));
+    EXPECT_ANY_THROW(FloatTwo->int_div(ListEmpty));
+    EXPECT_ANY_THROW(FloatTwo->int_div(ListEmpty2));
+    EXPECT_ANY_THROW(FloatTwo2->int_div(None));
+    EXPECT_ANY_THROW(FloatTwo2->int_div(None2));
+    EXPECT_ANY_THROW(FloatTwo2->int_div(False));
+    EXPECT_ANY_THROW(FloatTwo2->int_div(False2));
+    EXPECT_TRUE(FloatTwo2->int_div(True)->strictly_equal(VAR(Float, 2.0)));
+    EXPECT_TRUE(FloatTwo2->int_div(True2)->strictly_equal(VAR(Float, 2.0)));
+    EXPECT_ANY_THROW(FloatTwo2->int_div(IntZero));
+    EXPECT_TRUE(FloatTwo2->int_div(IntOne)->strictly_equal(VAR(Float, 2.0)));
+    EXPECT_TRUE(FloatTwo2->int_div(IntTwo)->strictly_equal(VAR(Float, 1.0)));
+    EXPECT_TRUE(FloatTwo2->int_div(IntTwo2)->strictly_equal(VAR(Float, 1.0)));
+    EXPECT_TRUE(FloatTwo2->int_div(Int8)->strictly_equal(VAR(Float, 0.0)));
+    EXPECT_TRUE(FloatTwo2->int_div(IntMinusOne)->strictly_equal(VAR(Float, -2.0)));
+    EXPECT_TRUE(FloatTwo2->int_div(IntMinusOne2)->strictly_equal(VAR(Float, -2.0)));
+    EXPECT_TRUE(FloatTwo2->int_div(IntMinus12)->strictly_equal(VAR(Float, -1.0)));
+    EXPECT_TRUE(FloatTwo2->int_div(IntMinus73)->strictly_equal(VAR(Float, -1.0)));
+    EXPECT_TRUE(FloatTwo2->int_div(FloatMinusOne)->strictly_equal(VAR(Float, -2.0)));
+    EXPECT_ANY_THROW(FloatTwo2->int_div(FloatZero));
+    EXPECT_TRUE(FloatTwo2->int_div(FloatOne)->strictly_equal(VAR(Float, 2.0)));
+    EXPECT_TRUE(FloatTwo2->int_div(FloatTwo)->strictly_equal(VAR(Float, 1.0)));
+    EXPECT_TRUE(FloatTwo2->int_div(FloatTwo2)->strictly_equal(VAR(Float, 1.0)));
+    EXPECT_TRUE(FloatTwo2->int_div(Float2_5)->strictly_equal(VAR(Float, 0.0)));
+    EXPECT_TRUE(FloatTwo2->int_div(Float_23_74)->strictly_equal(VAR(Float, -1.0)));
+    EXPECT_ANY_THROW(FloatTwo2->int_div(StrEmpty));
+    EXPECT_ANY_THROW(FloatTwo2->int_div(StrEmpty2));
+    EXPECT_ANY_THROW(FloatTwo2->int_div(StrA));
+    EXPECT_ANY_THROW(FloatTwo2->int_div(StrA2));
+    EXPECT_ANY_THROW(FloatTwo2->int_div(StrB));
+    EXPECT_ANY_THROW(FloatTwo2->int_div(ListEmpty));
+    EXPECT_ANY_THROW(FloatTwo2->int_div(ListEmpty2));
+    EXPECT_ANY_THROW(Float2_5->int_div(None));
+    EXPECT_ANY_THROW(Float2_5->int_div(None2));
+    EXPECT_ANY_THROW(Float2_5->int_div(False));
+    EXPECT_ANY_THROW(Float2_5->int_div(False2));
+    EXPECT_TRUE(Float2_5->int_div(True)->strictly_equal(VAR(Float, 2.0)));
+    EXPECT_TRUE(Float2_5->int_div(True2)->strictly_equal(VAR(Float, 2.0)));
+    EXPECT_ANY_THROW(Float2_5->int_div(IntZero));
+    EXPECT_TRUE(Float2_5->int_div(IntOne)->strictly_equal(VAR(Float, 2.0)));
+    EXPECT_TRUE(Float2_5->int_div(IntTwo)->strictly_equal(VAR(Float, 1.0)));
+    EXPECT_TRUE(Float2_5->int_div(IntTwo2)->strictly_equal(VAR(Float, 1.0)));
+    EXPECT_TRUE(Float2_5->int_div(Int8)->strictly_equal(VAR(Float, 0.0)));
+    EXPECT_TRUE(Float2_5->int_div(IntMinusOne)->strictly_equal(VAR(Float, -3.0)));
+    EXPECT_TRUE(Float2_5->int_div(IntMinusOne2)->strictly_equal(VAR(Float, -3.0)));
+    EXPECT_TRUE(Float2_5->int_div(IntMinus12)->strictly_equal(VAR(Float, -1.0)));
+    EXPECT_TRUE(Float2_5->int_div(IntMinus73)->strictly_equal(VAR(Float, -1.0)));
+    EXPECT_TRUE(Float2_5->int_div(FloatMinusOne)->strictly_equal(VAR(Float, -3.0)));
+    EXPECT_ANY_THROW(Float2_5->int_div(FloatZero));
+    EXPECT_TRUE(Float2_5->int_div(FloatOne)->strictly_equal(VAR(Float, 2.0)));
+    EXPECT_TRUE(Float2_5->int_div(FloatTwo)->strictly_equal(VAR(Float, 1.0)));
+    EXPECT_TRUE(Float2_5->int_div(FloatTwo2)->strictly_equal(VAR(Float, 1.0)));
+    EXPECT_TRUE(Float2_5->int_div(Float2_5)->strictly_equal(VAR(Float, 1.0)));
+    EXPECT_TRUE(Float2_5->int_div(Float_23_74)->strictly_equal(VAR(Float, -1.0)));
+    EXPECT_ANY_THROW(Float2_5->int_div(StrEmpty));
+    EXPECT_ANY_THROW(Float2_5->int_div(StrEmpty2));
+    EXPECT_ANY_THROW(Float2_5->int_div(StrA));
+    EXPECT_ANY_THROW(Float2_5->int_div(StrA2));
+    EXPECT_ANY_THROW(Float2_5->int_div(StrB));
+    EXPECT_ANY_THROW(Float2_5->int_div(ListEmpty));
+    EXPECT_ANY_THROW(Float2_5->int_div(ListEmpty2));
+    EXPECT_ANY_THROW(Float_23_74->int_div(None));
+    EXPECT_ANY_THROW(Float_23_74->int_div(None2));
+    EXPECT_ANY_THROW(Float_23_74->int_div(False));
+    EXPECT_ANY_THROW(Float_23_74->int_div(False2));
+    EXPECT_TRUE(Float_23_74->int_div(True)->strictly_equal(VAR(Float, -24.0)));
+    EXPECT_TRUE(Float_23_74->int_div(True2)->strictly_equal(VAR(Float, -24.0)));
+    EXPECT_ANY_THROW(Float_23_74->int_div(IntZero));
+    EXPECT_TRUE(Float_23_74->int_div(IntOne)->strictly_equal(VAR(Float, -24.0)));
+    EXPECT_TRUE(Float_23_74->int_div(IntTwo)->strictly_equal(VAR(Float, -12.0)));
+    EXPECT_TRUE(Float_23_74->int_div(IntTwo2)->strictly_equal(VAR(Float, -12.0)));
+    EXPECT_TRUE(Float_23_74->int_div(Int8)->strictly_equal(VAR(Float, -3.0)));
+    EXPECT_TRUE(Float_23_74->int_div(IntMinusOne)->strictly_equal(VAR(Float, 23.0)));
+    EXPECT_TRUE(Float_23_74->int_div(IntMinusOne2)->strictly_equal(VAR(Float, 23.0)));
+    EXPECT_TRUE(Float_23_74->int_div(IntMinus12)->strictly_equal(VAR(Float, 1.0)));
+    EXPECT_TRUE(Float_23_74->int_div(IntMinus73)->strictly_equal(VAR(Float, 0.0)));
+    EXPECT_TRUE(Float_23_74->int_div(FloatMinusOne)->strictly_equal(VAR(Float, 23.0)));
+    EXPECT_ANY_THROW(Float_23_74->int_div(FloatZero));
+    EXPECT_TRUE(Float_23_74->int_div(FloatOne)->strictly_equal(VAR(Float, -24.0)));
+    EXPECT_TRUE(Float_23_74->int_div(FloatTwo)->strictly_equal(VAR(Float, -12.0)));
+    EXPECT_TRUE(Float_23_74->int_div(FloatTwo2)->strictly_equal(VAR(Float, -12.0)));
+    EXPECT_TRUE(Float_23_74->int_div(Float2_5)->strictly_equal(VAR(Float, -10.0)));
+    EXPECT_TRUE(Float_23_74->int_div(Float_23_74)->strictly_equal(VAR(Float, 1.0)));
+    EXPECT_ANY_THROW(Float_23_74->int_div(StrEmpty));
+    EXPECT_ANY_THROW(Float_23_74->int_div(StrEmpty2));
+    EXPECT_ANY_THROW(Float_23_74->int_div(StrA));
+    EXPECT_ANY_THROW(Float_23_74->int_div(StrA2));
+    EXPECT_ANY_THROW(Float_23_74->int_div(StrB));
+    EXPECT_ANY_THROW(Float_23_74->int_div(ListEmpty));
+    EXPECT_ANY_THROW(Float_23_74->int_div(ListEmpty2));
+    EXPECT_ANY_THROW(StrEmpty->int_div(None));
+    EXPECT_ANY_THROW(StrEmpty->int_div(None2));
+    EXPECT_ANY_THROW(StrEmpty->int_div(False));
+    EXPECT_ANY_THROW(StrEmpty->int_div(False2));
+    EXPECT_ANY_THROW(StrEmpty->int_div(True));
+    EXPECT_ANY_THROW(StrEmpty->int_div(True2));
+    EXPECT_ANY_THROW(StrEmpty->int_div(IntZero));
+    EXPECT_ANY_THROW(StrEmpty->int_div(IntOne));
+    EXPECT_ANY_THROW(StrEmpty->int_div(IntTwo));
+    EXPECT_ANY_THROW(StrEmpty->int_div(IntTwo2));
+    EXPECT_ANY_THROW(StrEmpty->int_div(Int8));
+    EXPECT_ANY_THROW(StrEmpty->int_div(IntMinusOne));
+    EXPECT_ANY_THROW(StrEmpty->int_div(IntMinusOne2));
+    EXPECT_ANY_THROW(StrEmpty->int_div(IntMinus12));
+    EXPECT_ANY_THROW(StrEmpty->int_div(IntMinus73));
+    EXPECT_ANY_THROW(StrEmpty->int_div(FloatMinusOne));
+    EXPECT_ANY_THROW(StrEmpty->int_div(FloatZero));
+    EXPECT_ANY_THROW(StrEmpty->int_div(FloatOne));
+    EXPECT_ANY_THROW(StrEmpty->int_div(FloatTwo));
+    EXPECT_ANY_THROW(StrEmpty->int_div(FloatTwo2));
+    EXPECT_ANY_THROW(StrEmpty->int_div(Float2_5));
+    EXPECT_ANY_THROW(StrEmpty->int_div(Float_23_74));
+    EXPECT_ANY_THROW(StrEmpty->int_div(StrEmpty));
+    EXPECT_ANY_THROW(StrEmpty->int_div(StrEmpty2));
+    EXPECT_ANY_THROW(StrEmpty->int_div(StrA));
+    EXPECT_ANY_THROW(StrEmpty->int_div(StrA2));
+    EXPECT_ANY_THROW(StrEmpty->int_div(StrB));
+    EXPECT_ANY_THROW(StrEmpty->int_div(ListEmpty));
+    EXPECT_ANY_THROW(StrEmpty->int_div(ListEmpty2));
+    EXPECT_ANY_THROW(StrEmpty2->int_div(None));
+    EXPECT_ANY_THROW(StrEmpty2->int_div(None2));
+    EXPECT_ANY_THROW(StrEmpty2->int_div(False));
+    EXPECT_ANY_THROW(StrEmpty2->int_div(False2));
+    EXPECT_ANY_THROW(StrEmpty2->int_div(True));
+    EXPECT_ANY_THROW(StrEmpty2->int_div(True2));
+    EXPECT_ANY_THROW(StrEmpty2->int_div(IntZero));
+    EXPECT_ANY_THROW(StrEmpty2->int_div(IntOne));
+    EXPECT_ANY_THROW(StrEmpty2->int_div(IntTwo));
+    EXPECT_ANY_THROW(StrEmpty2->int_div(IntTwo2));
+    EXPECT_ANY_THROW(StrEmpty2->int_div(Int8));
+    EXPECT_ANY_THROW(StrEmpty2->int_div(IntMinusOne));
+    EXPECT_ANY_THROW(StrEmpty2->int_div(IntMinusOne2));
+    EXPECT_ANY_THROW(StrEmpty2->int_div(IntMinus12));
+    EXPECT_ANY_THROW(StrEmpty2->int_div(IntMinus73));
+    EXPECT_ANY_THROW(StrEmpty2->int_div(FloatMinusOne));
+    EXPECT_ANY_THROW(StrEmpty2->int_div(FloatZero));
+    EXPECT_ANY_THROW(StrEmpty2->int_div(FloatOne));
+    EXPECT_ANY_THROW(StrEmpty2->int_div(FloatTwo));
+    EXPECT_ANY_THROW(StrEmpty2->int_div(FloatTwo2));
+    EXPECT_ANY_THROW(StrEmpty2->int_div(Float2_5));
+    EXPECT_ANY_THROW(StrEmpty2->int_div(Float_23_74));
+    EXPECT_ANY_THROW(StrEmpty2->int_div(StrEmpty));
+    EXPECT_ANY_THROW(StrEmpty2->int_div(StrEmpty2));
+    EXPECT_ANY_THROW(StrEmpty2->int_div(StrA));
+    EXPECT_ANY_THROW(StrEmpty2->int_div(StrA2));
+    EXPECT_ANY_THROW(StrEmpty2->int_div(StrB));
+    EXPECT_ANY_THROW(StrEmpty2->int_div(ListEmpty));
+    EXPECT_ANY_THROW(StrEmpty2->int_div(ListEmpty2));
+    EXPECT_ANY_THROW(StrA->int_div(None));
+    EXPECT_ANY_THROW(StrA->int_div(None2));
+    EXPECT_ANY_THROW(StrA->int_div(False));
+    EXPECT_ANY_THROW(StrA->int_div(False2));
+    EXPECT_ANY_THROW(StrA->int_div(True));
+    EXPECT_ANY_THROW(StrA->int_div(True2));
+    EXPECT_ANY_THROW(StrA->int_div(IntZero));
+    EXPECT_ANY_THROW(StrA->int_div(IntOne));
+    EXPECT_ANY_THROW(StrA->int_div(IntTwo));
+    EXPECT_ANY_THROW(StrA->int_div(IntTwo2));
+    EXPECT_ANY_THROW(StrA->int_div(Int8));
+    EXPECT_ANY_THROW(StrA->int_div(IntMinusOne));
+    EXPECT_ANY_THROW(StrA->int_div(IntMinusOne2));
+    EXPECT_ANY_THROW(StrA->int_div(IntMinus12));
+    EXPECT_ANY_THROW(StrA->int_div(IntMinus73));
+    EXPECT_ANY_THROW(StrA->int_div(FloatMinusOne));
+    EXPECT_ANY_THROW(StrA->int_div(FloatZero));
+    EXPECT_ANY_THROW(StrA->int_div(FloatOne));
+    EXPECT_ANY_THROW(StrA->int_div(FloatTwo));
+    EXPECT_ANY_THROW(StrA->int_div(FloatTwo2));
+    EXPECT_ANY_THROW(StrA->int_div(Float2_5));
+    EXPECT_ANY_THROW(StrA->int_div(Float_23_74));
+    EXPECT_ANY_THROW(StrA->int_div(StrEmpty));
+    EXPECT_ANY_THROW(StrA->int_div(StrEmpty2));
+    EXPECT_ANY_THROW(StrA->int_div(StrA));
+    EXPECT_ANY_THROW(StrA->int_div(StrA2));
+    EXPECT_ANY_THROW(StrA->int_div(StrB));
+    EXPECT_ANY_THROW(StrA->int_div(ListEmpty));
+    EXPECT_ANY_THROW(StrA->int_div(ListEmpty2));
+    EXPECT_ANY_THROW(StrA2->int_div(None));
+    EXPECT_ANY_THROW(StrA2->int_div(None2));
+    EXPECT_ANY_THROW(StrA2->int_div(False));
+    EXPECT_ANY_THROW(StrA2->int_div(False2));
+    EXPECT_ANY_THROW(StrA2->int_div(True));
+    EXPECT_ANY_THROW(StrA2->int_div(True2));
+    EXPECT_ANY_THROW(StrA2->int_div(IntZero));
+    EXPECT_ANY_THROW(StrA2->int_div(IntOne));
+    EXPECT_ANY_THROW(StrA2->int_div(IntTwo));
+    EXPECT_ANY_THROW(StrA2->int_div(IntTwo2));
+    EXPECT_ANY_THROW(StrA2->int_div(Int8));
+    EXPECT_ANY_THROW(StrA2->int_div(IntMinusOne));
+    EXPECT_ANY_THROW(StrA2->int_div(IntMinusOne2));
+    EXPECT_ANY_THROW(StrA2->int_div(IntMinus12));
+    EXPECT_ANY_THROW(StrA2->int_div(IntMinus73));
+    EXPECT_ANY_THROW(StrA2->int_div(FloatMinusOne));
+    EXPECT_ANY_THROW(StrA2->int_div(FloatZero));
+    EXPECT_ANY_THROW(StrA2->int_div(FloatOne));
+    EXPECT_ANY_THROW(StrA2->int_div(FloatTwo));
+    EXPECT_ANY_THROW(StrA2->int_div(FloatTwo2));
+    EXPECT_ANY_THROW(StrA2->int_div(Float2_5));
+    EXPECT_ANY_THROW(StrA2->int_div(Float_23_74));
+    EXPECT_ANY_THROW(StrA2->int_div(StrEmpty));
+    EXPECT_ANY_THROW(StrA2->int_div(StrEmpty2));
+    EXPECT_ANY_THROW(StrA2->int_div(StrA));
+    EXPECT_ANY_THROW(StrA2->int_div(StrA2));
+    EXPECT_ANY_THROW(StrA2->int_div(StrB));
+    EXPECT_ANY_THROW(StrA2->int_div(ListEmpty));
+    EXPECT_ANY_THROW(StrA2->int_div(ListEmpty2));
+    EXPECT_ANY_THROW(StrB->int_div(None));
+    EXPECT_ANY_THROW(StrB->int_div(None2));
+    EXPECT_ANY_THROW(StrB->int_div(False));
+    EXPECT_ANY_THROW(StrB->int_div(False2));
+    EXPECT_ANY_THROW(StrB->int_div(True));
+    EXPECT_ANY_THROW(StrB->int_div(True2));
+    EXPECT_ANY_THROW(StrB->int_div(IntZero));
+    EXPECT_ANY_THROW(StrB->int_div(IntOne));
+    EXPECT_ANY_THROW(StrB->int_div(IntTwo));
+    EXPECT_ANY_THROW(StrB->int_div(IntTwo2));
+    EXPECT_ANY_THROW(StrB->int_div(Int8));
+    EXPECT_ANY_THROW(StrB->int_div(IntMinusOne));
+    EXPECT_ANY_THROW(StrB->int_div(IntMinusOne2));
+    EXPECT_ANY_THROW(StrB->int_div(IntMinus12));
+    EXPECT_ANY_THROW(StrB->int_div(IntMinus73));
+    EXPECT_ANY_THROW(StrB->int_div(FloatMinusOne));
+    EXPECT_ANY_THROW(StrB->int_div(FloatZero));
+    EXPECT_ANY_THROW(StrB->int_div(FloatOne));
+    EXPECT_ANY_THROW(StrB->int_div(FloatTwo));
+    EXPECT_ANY_THROW(StrB->int_div(FloatTwo2));
+    EXPECT_ANY_THROW(StrB->int_div(Float2_5));
+    EXPECT_ANY_THROW(StrB->int_div(Float_23_74));
+    EXPECT_ANY_THROW(StrB->int_div(StrEmpty));
+    EXPECT_ANY_THROW(StrB->int_div(StrEmpty2));
+    EXPECT_ANY_THROW(StrB->int_div(StrA));
+    EXPECT_ANY_THROW(StrB->int_div(StrA2));
+    EXPECT_ANY_THROW(StrB->int_div(StrB));
+    EXPECT_ANY_THROW(StrB->int_div(ListEmpty));
+    EXPECT_ANY_THROW(StrB->int_div(ListEmpty2));
+    EXPECT_ANY_THROW(ListEmpty->int_div(None));
+    EXPECT_ANY_THROW(ListEmpty->int_div(None2));
+    EXPECT_ANY_THROW(ListEmpty->int_div(False));
+    EXPECT_ANY_THROW(ListEmpty->int_div(False2));
+    EXPECT_ANY_THROW(ListEmpty->int_div(True));
+    EXPECT_ANY_THROW(ListEmpty->int_div(True2));
+    EXPECT_ANY_THROW(ListEmpty->int_div(IntZero));
+    EXPECT_ANY_THROW(ListEmpty->int_div(IntOne));
+    EXPECT_ANY_THROW(ListEmpty->int_div(IntTwo));
+    EXPECT_ANY_THROW(ListEmpty->int_div(IntTwo2));
+    EXPECT_ANY_THROW(ListEmpty->int_div(Int8));
+    EXPECT_ANY_THROW(ListEmpty->int_div(IntMinusOne));
+    EXPECT_ANY_THROW(ListEmpty->int_div(IntMinusOne2));
+    EXPECT_ANY_THROW(ListEmpty->int_div(IntMinus12));
+    EXPECT_ANY_THROW(ListEmpty->int_div(IntMinus73));
+    EXPECT_ANY_THROW(ListEmpty->int_div(FloatMinusOne));
+    EXPECT_ANY_THROW(ListEmpty->int_div(FloatZero));
+    EXPECT_ANY_THROW(ListEmpty->int_div(FloatOne));
+    EXPECT_ANY_THROW(ListEmpty->int_div(FloatTwo));
+    EXPECT_ANY_THROW(ListEmpty->int_div(FloatTwo2));
+    EXPECT_ANY_THROW(ListEmpty->int_div(Float2_5));
+    EXPECT_ANY_THROW(ListEmpty->int_div(Float_23_74));
+    EXPECT_ANY_THROW(ListEmpty->int_div(StrEmpty));
+    EXPECT_ANY_THROW(ListEmpty->int_div(StrEmpty2));
+    EXPECT_ANY_THROW(ListEmpty->int_div(StrA));
+    EXPECT_ANY_THROW(ListEmpty->int_div(StrA2));
+    EXPECT_ANY_THROW(ListEmpty->int_div(StrB));
+    EXPECT_ANY_THROW(ListEmpty->int_div(ListEmpty));
+    EXPECT_ANY_THROW(ListEmpty->int_div(ListEmpty2));
+    EXPECT_ANY_THROW(ListEmpty2->int_div(None));
+    EXPECT_ANY_THROW(ListEmpty2->int_div(None2));
+    EXPECT_ANY_THROW(ListEmpty2->int_div(False));
+    EXPECT_ANY_THROW(ListEmpty2->int_div(False2));
+    EXPECT_ANY_THROW(ListEmpty2->int_div(True));
+    EXPECT_ANY_THROW(ListEmpty2->int_div(True2));
+    EXPECT_ANY_THROW(ListEmpty2->int_div(IntZero));
+    EXPECT_ANY_THROW(ListEmpty2->int_div(IntOne));
+    EXPECT_ANY_THROW(ListEmpty2->int_div(IntTwo));
+    EXPECT_ANY_THROW(ListEmpty2->int_div(IntTwo2));
+    EXPECT_ANY_THROW(ListEmpty2->int_div(Int8));
+    EXPECT_ANY_THROW(ListEmpty2->int_div(IntMinusOne));
+    EXPECT_ANY_THROW(ListEmpty2->int_div(IntMinusOne2));
+    EXPECT_ANY_THROW(ListEmpty2->int_div(IntMinus12));
+    EXPECT_ANY_THROW(ListEmpty2->int_div(IntMinus73));
+    EXPECT_ANY_THROW(ListEmpty2->int_div(FloatMinusOne));
+    EXPECT_ANY_THROW(ListEmpty2->int_div(FloatZero));
+    EXPECT_ANY_THROW(ListEmpty2->int_div(FloatOne));
+    EXPECT_ANY_THROW(ListEmpty2->int_div(FloatTwo));
+    EXPECT_ANY_THROW(ListEmpty2->int_div(FloatTwo2));
+    EXPECT_ANY_THROW(ListEmpty2->int_div(Float2_5));
+    EXPECT_ANY_THROW(ListEmpty2->int_div(Float_23_74));
+    EXPECT_ANY_THROW(ListEmpty2->int_div(StrEmpty));
+    EXPECT_ANY_THROW(ListEmpty2->int_div(StrEmpty2));
+    EXPECT_ANY_THROW(ListEmpty2->int_div(StrA));
+    EXPECT_ANY_THROW(ListEmpty2->int_div(StrA2));
+    EXPECT_ANY_THROW(ListEmpty2->int_div(StrB));
+    EXPECT_ANY_THROW(ListEmpty2->int_div(ListEmpty));
+    EXPECT_ANY_THROW(ListEmpty2->int_div(ListEmpty2));
+}
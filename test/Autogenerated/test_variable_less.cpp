@@ -0,0 +1,962 @@
+
+#include "variable/Variable.h"
+
+#include "Test.h"
+
+#define VAR(TYPE, VALUE) \
+    std::static_pointer_cast<GenericVariable>(std::make_shared<TYPE ## Variable>(VALUE))
+
+enum class OpReturningVar {
+    add,
+    sub,
+    mul,
+    div,
+    int_div,
+    pow,
+    mod,
+};
+
+enum class AssertResult {
+    PASS,
+    FAIL,
+    EXCEPTION,
+};
+
+static std::ostream& operator<< (std::ostream& os, AssertResult res) {
+    switch (res) {
+    case AssertResult::PASS:       os << "PASS";      break;
+    case AssertResult::FAIL:       os << "FAIL";      break;
+    case AssertResult::EXCEPTION:  os << "EXCEPTION"; break;
+    default:                       os << "???";
+    }
+    return os;
+}
+
+static Variable doOpReturningVar(Variable arg1, Variable arg2, OpReturningVar op) {
+    switch(op) {
+    case OpReturningVar::add: return arg1->add(arg2);
+    case OpReturningVar::sub: return arg1->sub(arg2);
+    case OpReturningVar::mul: return arg1->mul(arg2);
+    case OpReturningVar::div: return arg1->div(arg2);
+    case OpReturningVar::int_div: return arg1->int_div(arg2);
+    case OpReturningVar::mod: return arg1->mod(arg2);
+    case OpReturningVar::pow: return arg1->pow(arg2);
+    default: throw std::runtime_error("Bad op");
+    }
+}
+
+static void doOpReturningVarAndCompareResult(Variable arg1, Variable arg2, OpReturningVar op, Variable expected_res, AssertResult a_res, const char *descr) {
+    try {
+        auto res_var = doOpReturningVar(arg1, arg2, op);
+        auto assertion_result = res_var->strictly_equal(expected_res) ? AssertResult::PASS : AssertResult::FAIL;
+        if (assertion_result != a_res) {
+            std::cerr << descr << " returned " << assertion_result << " instead of " << a_res << "\n";
+        }
+    }
+    catch(...) {
+        if (a_res != AssertResult::EXCEPTION) {
+            std::cerr << descr << " returned EXCEPTION instead of " << a_res << "\n";
+        }
+    }
+}
+
+enum class OpReturningBool {
+    equal,
+    less,
+};
+
+static bool doOpReturningBool(Variable arg1, Variable arg2, OpReturningBool op) {
+    switch(op) {
+    case OpReturningBool::equal: return arg1->equal(arg2);
+    case OpReturningBool::less: return arg1->less(arg2);
+    default: throw std::runtime_error("Bad op");
+    }
+}
+
+static void doOpReturningBoolAndCompareResult(Variable arg1, Variable arg2, OpReturningBool op, bool expected_res, AssertResult a_res, const char *descr) {
+    try {
+        auto assertion_result = doOpReturningBool(arg1, arg2, op) ? AssertResult::PASS : AssertResult::FAIL;
+        if (assertion_result != a_res) {
+            std::cerr << descr << " returned " << assertion_result << " instead of " << a_res << "\n";
+        }
+    }
+    catch(...) {
+        if (a_res != AssertResult::EXCEPTION) {
+            std::cerr << descr << " returned EXCEPTION instead of " << a_res << "\n";
+        }
+    }
+}
+
+static auto None = std::static_pointer_cast<GenericVariable>(std::make_shared<NoneVariable>());
+static auto None2 = std::static_pointer_cast<GenericVariable>(std::make_shared<NoneVariable>());
+static auto False = VAR(Bool, false);
+static auto False2 = VAR(Bool, false);
+static auto True = VAR(Bool, true);
+static auto True2 = VAR(Bool, true);
+static auto IntZero = VAR(Int, 0);
+static auto IntOne = VAR(Int, 1);
+static auto IntTwo = VAR(Int, 2);
+static auto IntTwo2 = VAR(Int, 2);
+static auto Int8 = VAR(Int, 8);
+static auto IntMinusOne = VAR(Int, -1);
+static auto IntMinusOne2 = VAR(Int, -1);
+static auto IntMinus12 = VAR(Int, -12);
+static auto IntMinus73 = VAR(Int, -73);
+static auto FloatMinusOne = VAR(Float, -1);
+static auto FloatZero = VAR(Float, 0);
+static auto FloatOne = VAR(Float, 1);
+static auto FloatTwo = VAR(Float, 2);
+static auto FloatTwo2 = VAR(Float, 2);
+static auto Float2_5 = VAR(Float, 2.5);
+static auto Float_23_74 = VAR(Float, -23.74);
+static auto StrEmpty = VAR(String, "");
+static auto StrEmpty2 = VAR(String, "");
+static auto StrA = VAR(String, "some text");
+static auto StrA2 = VAR(String, "some text");
+static auto StrB = VAR(String, "other text");
+static auto ListEmpty = VAR(List, ListType());
+static auto ListEmpty2 = VAR(List, ListType());
+
+void test_variable_less() {
+    doOpReturningBoolAndCompareResult(None, None, OpReturningBool::less, false, AssertResult::EXCEPTION, "None->less(None)");
+    doOpReturningBoolAndCompareResult(None, None2, OpReturningBool::less, false, AssertResult::EXCEPTION, "None->less(None2)");
+    doOpReturningBoolAndCompareResult(None, False, OpReturningBool::less, false, AssertResult::EXCEPTION, "None->less(False)");
+    doOpReturningBoolAndCompareResult(None, False2, OpReturningBool::less, false, AssertResult::EXCEPTION, "None->less(False2)");
+    doOpReturningBoolAndCompareResult(None, True, OpReturningBool::less, false, AssertResult::EXCEPTION, "None->less(True)");
+    doOpReturningBoolAndCompareResult(None, True2, OpReturningBool::less, false, AssertResult::EXCEPTION, "None->less(True2)");
+    doOpReturningBoolAndCompareResult(None, IntZero, OpReturningBool::less, false, AssertResult::EXCEPTION, "None->less(IntZero)");
+    doOpReturningBoolAndCompareResult(None, IntOne, OpReturningBool::less, false, AssertResult::EXCEPTION, "None->less(IntOne)");
+    doOpReturningBoolAndCompareResult(None, IntTwo, OpReturningBool::less, false, AssertResult::EXCEPTION, "None->less(IntTwo)");
+    doOpReturningBoolAndCompareResult(None, IntTwo2, OpReturningBool::less, false, AssertResult::EXCEPTION, "None->less(IntTwo2)");
+    doOpReturningBoolAndCompareResult(None, Int8, OpReturningBool::less, false, AssertResult::EXCEPTION, "None->less(Int8)");
+    doOpReturningBoolAndCompareResult(None, IntMinusOne, OpReturningBool::less, false, AssertResult::EXCEPTION, "None->less(IntMinusOne)");
+    doOpReturningBoolAndCompareResult(None, IntMinusOne2, OpReturningBool::less, false, AssertResult::EXCEPTION, "None->less(IntMinusOne2)");
+    doOpReturningBoolAndCompareResult(None, IntMinus12, OpReturningBool::less, false, AssertResult::EXCEPTION, "None->less(IntMinus12)");
+    doOpReturningBoolAndCompareResult(None, IntMinus73, OpReturningBool::less, false, AssertResult::EXCEPTION, "None->less(IntMinus73)");
+    doOpReturningBoolAndCompareResult(None, FloatMinusOne, OpReturningBool::less, false, AssertResult::EXCEPTION, "None->less(FloatMinusOne)");
+    doOpReturningBoolAndCompareResult(None, FloatZero, OpReturningBool::less, false, AssertResult::EXCEPTION, "None->less(FloatZero)");
+    doOpReturningBoolAndCompareResult(None, FloatOne, OpReturningBool::less, false, AssertResult::EXCEPTION, "None->less(FloatOne)");
+    doOpReturningBoolAndCompareResult(None, FloatTwo, OpReturningBool::less, false, AssertResult::EXCEPTION, "None->less(FloatTwo)");
+    doOpReturningBoolAndCompareResult(None, FloatTwo2, OpReturningBool::less, false, AssertResult::EXCEPTION, "None->less(FloatTwo2)");
+    doOpReturningBoolAndCompareResult(None, Float2_5, OpReturningBool::less, false, AssertResult::EXCEPTION, "None->less(Float2_5)");
+    doOpReturningBoolAndCompareResult(None, Float_23_74, OpReturningBool::less, false, AssertResult::EXCEPTION, "None->less(Float_23_74)");
+    doOpReturningBoolAndCompareResult(None, StrEmpty, OpReturningBool::less, false, AssertResult::EXCEPTION, "None->less(StrEmpty)");
+    doOpReturningBoolAndCompareResult(None, StrEmpty2, OpReturningBool::less, false, AssertResult::EXCEPTION, "None->less(StrEmpty2)");
+    doOpReturningBoolAndCompareResult(None, StrA, OpReturningBool::less, false, AssertResult::EXCEPTION, "None->less(StrA)");
+    doOpReturningBoolAndCompareResult(None, StrA2, OpReturningBool::less, false, AssertResult::EXCEPTION, "None->less(StrA2)");
+    doOpReturningBoolAndCompareResult(None, StrB, OpReturningBool::less, false, AssertResult::EXCEPTION, "None->less(StrB)");
+    doOpReturningBoolAndCompareResult(None, ListEmpty, OpReturningBool::less, false, AssertResult::EXCEPTION, "None->less(ListEmpty)");
+    doOpReturningBoolAndCompareResult(None, ListEmpty2, OpReturningBool::less, false, AssertResult::EXCEPTION, "None->less(ListEmpty2)");
+    doOpReturningBoolAndCompareResult(None2, None, OpReturningBool::less, false, AssertResult::EXCEPTION, "None2->less(None)");
+    doOpReturningBoolAndCompareResult(None2, None2, OpReturningBool::less, false, AssertResult::EXCEPTION, "None2->less(None2)");
+    doOpReturningBoolAndCompareResult(None2, False, OpReturningBool::less, false, AssertResult::EXCEPTION, "None2->less(False)");
+    doOpReturningBoolAndCompareResult(None2, False2, OpReturningBool::less, false, AssertResult::EXCEPTION, "None2->less(False2)");
+    doOpReturningBoolAndCompareResult(None2, True, OpReturningBool::less, false, AssertResult::EXCEPTION, "None2->less(True)");
+    doOpReturningBoolAndCompareResult(None2, True2, OpReturningBool::less, false, AssertResult::EXCEPTION, "None2->less(True2)");
+    doOpReturningBoolAndCompareResult(None2, IntZero, OpReturningBool::less, false, AssertResult::EXCEPTION, "None2->less(IntZero)");
+    doOpReturningBoolAndCompareResult(None2, IntOne, OpReturningBool::less, false, AssertResult::EXCEPTION, "None2->less(IntOne)");
+    doOpReturningBoolAndCompareResult(None2, IntTwo, OpReturningBool::less, false, AssertResult::EXCEPTION, "None2->less(IntTwo)");
+    doOpReturningBoolAndCompareResult(None2, IntTwo2, OpReturningBool::less, false, AssertResult::EXCEPTION, "None2->less(IntTwo2)");
+    doOpReturningBoolAndCompareResult(None2, Int8, OpReturningBool::less, false, AssertResult::EXCEPTION, "None2->less(Int8)");
+    doOpReturningBoolAndCompareResult(None2, IntMinusOne, OpReturningBool::less, false, AssertResult::EXCEPTION, "None2->less(IntMinusOne)");
+    doOpReturningBoolAndCompareResult(None2, IntMinusOne2, OpReturningBool::less, false, AssertResult::EXCEPTION, "None2->less(IntMinusOne2)");
+    doOpReturningBoolAndCompareResult(None2, IntMinus12, OpReturningBool::less, false, AssertResult::EXCEPTION, "None2->less(IntMinus12)");
+    doOpReturningBoolAndCompareResult(None2, IntMinus73, OpReturningBool::less, false, AssertResult::EXCEPTION, "None2->less(IntMinus73)");
+    doOpReturningBoolAndCompareResult(None2, FloatMinusOne, OpReturningBool::less, false, AssertResult::EXCEPTION, "None2->less(FloatMinusOne)");
+    doOpReturningBoolAndCompareResult(None2, FloatZero, OpReturningBool::less, false, AssertResult::EXCEPTION, "None2->less(FloatZero)");
+    doOpReturningBoolAndCompareResult(None2, FloatOne, OpReturningBool::less, false, AssertResult::EXCEPTION, "None2->less(FloatOne)");
+    doOpReturningBoolAndCompareResult(None2, FloatTwo, OpReturningBool::less, false, AssertResult::EXCEPTION, "None2->less(FloatTwo)");
+    doOpReturningBoolAndCompareResult(None2, FloatTwo2, OpReturningBool::less, false, AssertResult::EXCEPTION, "None2->less(FloatTwo2)");
+    doOpReturningBoolAndCompareResult(None2, Float2_5, OpReturningBool::less, false, AssertResult::EXCEPTION, "None2->less(Float2_5)");
+    doOpReturningBoolAndCompareResult(None2, Float_23_74, OpReturningBool::less, false, AssertResult::EXCEPTION, "None2->less(Float_23_74)");
+    doOpReturningBoolAndCompareResult(None2, StrEmpty, OpReturningBool::less, false, AssertResult::EXCEPTION, "None2->less(StrEmpty)");
+    doOpReturningBoolAndCompareResult(None2, StrEmpty2, OpReturningBool::less, false, AssertResult::EXCEPTION, "None2->less(StrEmpty2)");
+    doOpReturningBoolAndCompareResult(None2, StrA, OpReturningBool::less, false, AssertResult::EXCEPTION, "None2->less(StrA)");
+    doOpReturningBoolAndCompareResult(None2, StrA2, OpReturningBool::less, false, AssertResult::EXCEPTION, "None2->less(StrA2)");
+    doOpReturningBoolAndCompareResult(None2, StrB, OpReturningBool::less, false, AssertResult::EXCEPTION, "None2->less(StrB)");
+    doOpReturningBoolAndCompareResult(None2, ListEmpty, OpReturningBool::less, false, AssertResult::EXCEPTION, "None2->less(ListEmpty)");
+    doOpReturningBoolAndCompareResult(None2, ListEmpty2, OpReturningBool::less, false, AssertResult::EXCEPTION, "None2->less(ListEmpty2)");
+    doOpReturningBoolAndCompareResult(False, None, OpReturningBool::less, false, AssertResult::EXCEPTION, "False->less(None)");
+    doOpReturningBoolAndCompareResult(False, None2, OpReturningBool::less, false, AssertResult::EXCEPTION, "False->less(None2)");
+    doOpReturningBoolAndCompareResult(False, False, OpReturningBool::less, false, AssertResult::FAIL, "False->less(False)");
+    doOpReturningBoolAndCompareResult(False, False2, OpReturningBool::less, false, AssertResult::FAIL, "False->less(False2)");
+    doOpReturningBoolAndCompareResult(False, True, OpReturningBool::less, true, AssertResult::PASS, "False->less(True)");
+    doOpReturningBoolAndCompareResult(False, True2, OpReturningBool::less, true, AssertResult::PASS, "False->less(True2)");
+    doOpReturningBoolAndCompareResult(False, IntZero, OpReturningBool::less, false, AssertResult::FAIL, "False->less(IntZero)");
+    doOpReturningBoolAndCompareResult(False, IntOne, OpReturningBool::less, true, AssertResult::PASS, "False->less(IntOne)");
+    doOpReturningBoolAndCompareResult(False, IntTwo, OpReturningBool::less, true, AssertResult::PASS, "False->less(IntTwo)");
+    doOpReturningBoolAndCompareResult(False, IntTwo2, OpReturningBool::less, true, AssertResult::PASS, "False->less(IntTwo2)");
+    doOpReturningBoolAndCompareResult(False, Int8, OpReturningBool::less, true, AssertResult::PASS, "False->less(Int8)");
+    doOpReturningBoolAndCompareResult(False, IntMinusOne, OpReturningBool::less, false, AssertResult::FAIL, "False->less(IntMinusOne)");
+    doOpReturningBoolAndCompareResult(False, IntMinusOne2, OpReturningBool::less, false, AssertResult::FAIL, "False->less(IntMinusOne2)");
+    doOpReturningBoolAndCompareResult(False, IntMinus12, OpReturningBool::less, false, AssertResult::FAIL, "False->less(IntMinus12)");
+    doOpReturningBoolAndCompareResult(False, IntMinus73, OpReturningBool::less, false, AssertResult::FAIL, "False->less(IntMinus73)");
+    doOpReturningBoolAndCompareResult(False, FloatMinusOne, OpReturningBool::less, false, AssertResult::FAIL, "False->less(FloatMinusOne)");
+    doOpReturningBoolAndCompareResult(False, FloatZero, OpReturningBool::less, false, AssertResult::FAIL, "False->less(FloatZero)");
+    doOpReturningBoolAndCompareResult(False, FloatOne, OpReturningBool::less, true, AssertResult::PASS, "False->less(FloatOne)");
+    doOpReturningBoolAndCompareResult(False, FloatTwo, OpReturningBool::less, true, AssertResult::PASS, "False->less(FloatTwo)");
+    doOpReturningBoolAndCompareResult(False, FloatTwo2, OpReturningBool::less, true, AssertResult::PASS, "False->less(FloatTwo2)");
+    doOpReturningBoolAndCompareResult(False, Float2_5, OpReturningBool::less, true, AssertResult::PASS, "False->less(Float2_5)");
+    doOpReturningBoolAndCompareResult(False, Float_23_74, OpReturningBool::less, false, AssertResult::FAIL, "False->less(Float_23_74)");
+    doOpReturningBoolAndCompareResult(False, StrEmpty, OpReturningBool::less, false, AssertResult::EXCEPTION, "False->less(StrEmpty)");
+    doOpReturningBoolAndCompareResult(False, StrEmpty2, OpReturningBool::less, false, AssertResult::EXCEPTION, "False->less(StrEmpty2)");
+    doOpReturningBoolAndCompareResult(False, StrA, OpReturningBool::less, false, AssertResult::EXCEPTION, "False->less(StrA)");
+    doOpReturningBoolAndCompareResult(False, StrA2, OpReturningBool::less, false, AssertResult::EXCEPTION, "False->less(StrA2)");
+    doOpReturningBoolAndCompareResult(False, StrB, OpReturningBool::less, false, AssertResult::EXCEPTION, "False->less(StrB)");
+    doOpReturningBoolAndCompareResult(False, ListEmpty, OpReturningBool::less, false, AssertResult::EXCEPTION, "False->less(ListEmpty)");
+    doOpReturningBoolAndCompareResult(False, ListEmpty2, OpReturningBool::less, false, AssertResult::EXCEPTION, "False->less(ListEmpty2)");
+    doOpReturningBoolAndCompareResult(False2, None, OpReturningBool::less, false, AssertResult::EXCEPTION, "False2->less(None)");
+    doOpReturningBoolAndCompareResult(False2, None2, OpReturningBool::less, false, AssertResult::EXCEPTION, "False2->less(None2)");
+    doOpReturningBoolAndCompareResult(False2, False, OpReturningBool::less, false, AssertResult::FAIL, "False2->less(False)");
+    doOpReturningBoolAndCompareResult(False2, False2, OpReturningBool::less, false, AssertResult::FAIL, "False2->less(False2)");
+    doOpReturningBoolAndCompareResult(False2, True, OpReturningBool::less, true, AssertResult::PASS, "False2->less(True)");
+    doOpReturningBoolAndCompareResult(False2, True2, OpReturningBool::less, true, AssertResult::PASS, "False2->less(True2)");
+    doOpReturningBoolAndCompareResult(False2, IntZero, OpReturningBool::less, false, AssertResult::FAIL, "False2->less(IntZero)");
+    doOpReturningBoolAndCompareResult(False2, IntOne, OpReturningBool::less, true, AssertResult::PASS, "False2->less(IntOne)");
+    doOpReturningBoolAndCompareResult(False2, IntTwo, OpReturningBool::less, true, AssertResult::PASS, "False2->less(IntTwo)");
+    doOpReturningBoolAndCompareResult(False2, IntTwo2, OpReturningBool::less, true, AssertResult::PASS, "False2->less(IntTwo2)");
+    doOpReturningBoolAndCompareResult(False2, Int8, OpReturningBool::less, true, AssertResult::PASS, "False2->less(Int8)");
+    doOpReturningBoolAndCompareResult(False2, IntMinusOne, OpReturningBool::less, false, AssertResult::FAIL, "False2->less(IntMinusOne)");
+    doOpReturningBoolAndCompareResult(False2, IntMinusOne2, OpReturningBool::less, false, AssertResult::FAIL, "False2->less(IntMinusOne2)");
+    doOpReturningBoolAndCompareResult(False2, IntMinus12, OpReturningBool::less, false, AssertResult::FAIL, "False2->less(IntMinus12)");
+    doOpReturningBoolAndCompareResult(False2, IntMinus73, OpReturningBool::less, false, AssertResult::FAIL, "False2->less(IntMinus73)");
+    doOpReturningBoolAndCompareResult(False2, FloatMinusOne, OpReturningBool::less, false, AssertResult::FAIL, "False2->less(FloatMinusOne)");
+    doOpReturningBoolAndCompareResult(False2, FloatZero, OpReturningBool::less, false, AssertResult::FAIL, "False2->less(FloatZero)");
+    doOpReturningBoolAndCompareResult(False2, FloatOne, OpReturningBool::less, true, AssertResult::PASS, "False2->less(FloatOne)");
+    doOpReturningBoolAndCompareResult(False2, FloatTwo, OpReturningBool::less, true, AssertResult::PASS, "False2->less(FloatTwo)");
+    doOpReturningBoolAndCompareResult(False2, FloatTwo2, OpReturningBool::less, true, AssertResult::PASS, "False2->less(FloatTwo2)");
+    doOpReturningBoolAndCompareResult(False2, Float2_5, OpReturningBool::less, true, AssertResult::PASS, "False2->less(Float2_5)");
+    doOpReturningBoolAndCompareResult(False2, Float_23_74, OpReturningBool::less, false, AssertResult::FAIL, "False2->less(Float_23_74)");
+    doOpReturningBoolAndCompareResult(False2, StrEmpty, OpReturningBool::less, false, AssertResult::EXCEPTION, "False2->less(StrEmpty)");
+    doOpReturningBoolAndCompareResult(False2, StrEmpty2, OpReturningBool::less, false, AssertResult::EXCEPTION, "False2->less(StrEmpty2)");
+    doOpReturningBoolAndCompareResult(False2, StrA, OpReturningBool::less, false, AssertResult::EXCEPTION, "False2->less(StrA)");
+    doOpReturningBoolAndCompareResult(False2, StrA2, OpReturningBool::less, false, AssertResult::EXCEPTION, "False2->less(StrA2)");
+    doOpReturningBoolAndCompareResult(False2, StrB, OpReturningBool::less, false, AssertResult::EXCEPTION, "False2->less(StrB)");
+    doOpReturningBoolAndCompareResult(False2, ListEmpty, OpReturningBool::less, false, AssertResult::EXCEPTION, "False2->less(ListEmpty)");
+    doOpReturningBoolAndCompareResult(False2, ListEmpty2, OpReturningBool::less, false, AssertResult::EXCEPTION, "False2->less(ListEmpty2)");
+    doOpReturningBoolAndCompareResult(True, None, OpReturningBool::less, false, AssertResult::EXCEPTION, "True->less(None)");
+    doOpReturningBoolAndCompareResult(True, None2, OpReturningBool::less, false, AssertResult::EXCEPTION, "True->less(None2)");
+    doOpReturningBoolAndCompareResult(True, False, OpReturningBool::less, false, AssertResult::FAIL, "True->less(False)");
+    doOpReturningBoolAndCompareResult(True, False2, OpReturningBool::less, false, AssertResult::FAIL, "True->less(False2)");
+    doOpReturningBoolAndCompareResult(True, True, OpReturningBool::less, false, AssertResult::FAIL, "True->less(True)");
+    doOpReturningBoolAndCompareResult(True, True2, OpReturningBool::less, false, AssertResult::FAIL, "True->less(True2)");
+    doOpReturningBoolAndCompareResult(True, IntZero, OpReturningBool::less, false, AssertResult::FAIL, "True->less(IntZero)");
+    doOpReturningBoolAndCompareResult(True, IntOne, OpReturningBool::less, false, AssertResult::FAIL, "True->less(IntOne)");
+    doOpReturningBoolAndCompareResult(True, IntTwo, OpReturningBool::less, true, AssertResult::PASS, "True->less(IntTwo)");
+    doOpReturningBoolAndCompareResult(True, IntTwo2, OpReturningBool::less, true, AssertResult::PASS, "True->less(IntTwo2)");
+    doOpReturningBoolAndCompareResult(True, Int8, OpReturningBool::less, true, AssertResult::PASS, "True->less(Int8)");
+    doOpReturningBoolAndCompareResult(True, IntMinusOne, OpReturningBool::less, false, AssertResult::FAIL, "True->less(IntMinusOne)");
+    doOpReturningBoolAndCompareResult(True, IntMinusOne2, OpReturningBool::less, false, AssertResult::FAIL, "True->less(IntMinusOne2)");
+    doOpReturningBoolAndCompareResult(True, IntMinus12, OpReturningBool::less, false, AssertResult::FAIL, "True->less(IntMinus12)");
+    doOpReturningBoolAndCompareResult(True, IntMinus73, OpReturningBool::less, false, AssertResult::FAIL, "True->less(IntMinus73)");
+    doOpReturningBoolAndCompareResult(True, FloatMinusOne, OpReturningBool::less, false, AssertResult::FAIL, "True->less(FloatMinusOne)");
+    doOpReturningBoolAndCompareResult(True, FloatZero, OpReturningBool::less, false, AssertResult::FAIL, "True->less(FloatZero)");
+    doOpReturningBoolAndCompareResult(True, FloatOne, OpReturningBool::less, false, AssertResult::FAIL, "True->less(FloatOne)");
+    doOpReturningBoolAndCompareResult(True, FloatTwo, OpReturningBool::less, true, AssertResult::PASS, "True->less(FloatTwo)");
+    doOpReturningBoolAndCompareResult(True, FloatTwo2, OpReturningBool::less, true, AssertResult::PASS, "True->less(FloatTwo2)");
+    doOpReturningBoolAndCompareResult(True, Float2_5, OpReturningBool::less, true, AssertResult::PASS, "True->less(Float2_5)");
+    doOpReturningBoolAndCompareResult(True, Float_23_74, OpReturningBool::less, false, AssertResult::FAIL, "True->less(Float_23_74)");
+    doOpReturningBoolAndCompareResult(True, StrEmpty, OpReturningBool::less, false, AssertResult::EXCEPTION, "True->less(StrEmpty)");
+    doOpReturningBoolAndCompareResult(True, StrEmpty2, OpReturningBool::less, false, AssertResult::EXCEPTION, "True->less(StrEmpty2)");
+    doOpReturningBoolAndCompareResult(True, StrA, OpReturningBool::less, false, AssertResult::EXCEPTION, "True->less(StrA)");
+    doOpReturningBoolAndCompareResult(True, StrA2, OpReturningBool::less, false, AssertResult::EXCEPTION, "True->less(StrA2)");
+    doOpReturningBoolAndCompareResult(True, StrB, OpReturningBool::less, false, AssertResult::EXCEPTION, "True->less(StrB)");
+    doOpReturningBoolAndCompareResult(True, ListEmpty, OpReturningBool::less, false, AssertResult::EXCEPTION, "True->less(ListEmpty)");
+    doOpReturningBoolAndCompareResult(True, ListEmpty2, OpReturningBool::less, false, AssertResult::EXCEPTION, "True->less(ListEmpty2)");
+    doOpReturningBoolAndCompareResult(True2, None, OpReturningBool::less, false, AssertResult::EXCEPTION, "True2->less(None)");
+    doOpReturningBoolAndCompareResult(True2, None2, OpReturningBool::less, false, AssertResult::EXCEPTION, "True2->less(None2)");
+    doOpReturningBoolAndCompareResult(True2, False, OpReturningBool::less, false, AssertResult::FAIL, "True2->less(False)");
+    doOpReturningBoolAndCompareResult(True2, False2, OpReturningBool::less, false, AssertResult::FAIL, "True2->less(False2)");
+    doOpReturningBoolAndCompareResult(True2, True, OpReturningBool::less, false, AssertResult::FAIL, "True2->less(True)");
+    doOpReturningBoolAndCompareResult(True2, True2, OpReturningBool::less, false, AssertResult::FAIL, "True2->less(True2)");
+    doOpReturningBoolAndCompareResult(True2, IntZero, OpReturningBool::less, false, AssertResult::FAIL, "True2->less(IntZero)");
+    doOpReturningBoolAndCompareResult(True2, IntOne, OpReturningBool::less, false, AssertResult::FAIL, "True2->less(IntOne)");
+    doOpReturningBoolAndCompareResult(True2, IntTwo, OpReturningBool::less, true, AssertResult::PASS, "True2->less(IntTwo)");
+    doOpReturningBoolAndCompareResult(True2, IntTwo2, OpReturningBool::less, true, AssertResult::PASS, "True2->less(IntTwo2)");
+    doOpReturningBoolAndCompareResult(True2, Int8, OpReturningBool::less, true, AssertResult::PASS, "True2->less(Int8)");
+    doOpReturningBoolAndCompareResult(True2, IntMinusOne, OpReturningBool::less, false, AssertResult::FAIL, "True2->less(IntMinusOne)");
+    doOpReturningBoolAndCompareResult(True2, IntMinusOne2, OpReturningBool::less, false, AssertResult::FAIL, "True2->less(IntMinusOne2)");
+    doOpReturningBoolAndCompareResult(True2, IntMinus12, OpReturningBool::less, false, AssertResult::FAIL, "True2->less(IntMinus12)");
+    doOpReturningBoolAndCompareResult(True2, IntMinus73, OpReturningBool::less, false, AssertResult::FAIL, "True2->less(IntMinus73)");
+    doOpReturningBoolAndCompareResult(True2, FloatMinusOne, OpReturningBool::less, false, AssertResult::FAIL, "True2->less(FloatMinusOne)");
+    doOpReturningBoolAndCompareResult(True2, FloatZero, OpReturningBool::less, false, AssertResult::FAIL, "True2->less(FloatZero)");
+    doOpReturningBoolAndCompareResult(True2, FloatOne, OpReturningBool::less, false, AssertResult::FAIL, "True2->less(FloatOne)");
+    doOpReturningBoolAndCompareResult(True2, FloatTwo, OpReturningBool::less, true, AssertResult::PASS, "True2->less(FloatTwo)");
+    doOpReturningBoolAndCompareResult(True2, FloatTwo2, OpReturningBool::less, true, AssertResult::PASS, "True2->less(FloatTwo2)");
+    doOpReturningBoolAndCompareResult(True2, Float2_5, OpReturningBool::less, true, AssertResult::PASS, "True2->less(Float2_5)");
+    doOpReturningBoolAndCompareResult(True2, Float_23_74, OpReturningBool::less, false, AssertResult::FAIL, "True2->less(Float_23_74)");
+    doOpReturningBoolAndCompareResult(True2, StrEmpty, OpReturningBool::less, false, AssertResult::EXCEPTION, "True2->less(StrEmpty)");
+    doOpReturningBoolAndCompareResult(True2, StrEmpty2, OpReturningBool::less, false, AssertResult::EXCEPTION, "True2->less(StrEmpty2)");
+    doOpReturningBoolAndCompareResult(True2, StrA, OpReturningBool::less, false, AssertResult::EXCEPTION, "True2->less(StrA)");
+    doOpReturningBoolAndCompareResult(True2, StrA2, OpReturningBool::less, false, AssertResult::EXCEPTION, "True2->less(StrA2)");
+    doOpReturningBoolAndCompareResult(True2, StrB, OpReturningBool::less, false, AssertResult::EXCEPTION, "True2->less(StrB)");
+    doOpReturningBoolAndCompareResult(True2, ListEmpty, OpReturningBool::less, false, AssertResult::EXCEPTION, "True2->less(ListEmpty)");
+    doOpReturningBoolAndCompareResult(True2, ListEmpty2, OpReturningBool::less, false, AssertResult::EXCEPTION, "True2->less(ListEmpty2)");
+    doOpReturningBoolAndCompareResult(IntZero, None, OpReturningBool::less, false, AssertResult::EXCEPTION, "IntZero->less(None)");
+    doOpReturningBoolAndCompareResult(IntZero, None2, OpReturningBool::less, false, AssertResult::EXCEPTION, "IntZero->less(None2)");
+    doOpReturningBoolAndCompareResult(IntZero, False, OpReturningBool::less, false, AssertResult::FAIL, "IntZero->less(False)");
+    doOpReturningBoolAndCompareResult(IntZero, False2, OpReturningBool::less, false, AssertResult::FAIL, "IntZero->less(False2)");
+    doOpReturningBoolAndCompareResult(IntZero, True, OpReturningBool::less, true, AssertResult::PASS, "IntZero->less(True)");
+    doOpReturningBoolAndCompareResult(IntZero, True2, OpReturningBool::less, true, AssertResult::PASS, "IntZero->less(True2)");
+    doOpReturningBoolAndCompareResult(IntZero, IntZero, OpReturningBool::less, false, AssertResult::FAIL, "IntZero->less(IntZero)");
+    doOpReturningBoolAndCompareResult(IntZero, IntOne, OpReturningBool::less, true, AssertResult::PASS, "IntZero->less(IntOne)");
+    doOpReturningBoolAndCompareResult(IntZero, IntTwo, OpReturningBool::less, true, AssertResult::PASS, "IntZero->less(IntTwo)");
+    doOpReturningBoolAndCompareResult(IntZero, IntTwo2, OpReturningBool::less, true, AssertResult::PASS, "IntZero->less(IntTwo2)");
+    doOpReturningBoolAndCompareResult(IntZero, Int8, OpReturningBool::less, true, AssertResult::PASS, "IntZero->less(Int8)");
+    doOpReturningBoolAndCompareResult(IntZero, IntMinusOne, OpReturningBool::less, false, AssertResult::FAIL, "IntZero->less(IntMinusOne)");
+    doOpReturningBoolAndCompareResult(IntZero, IntMinusOne2, OpReturningBool::less, false, AssertResult::FAIL, "IntZero->less(IntMinusOne2)");
+    doOpReturningBoolAndCompareResult(IntZero, IntMinus12, OpReturningBool::less, false, AssertResult::FAIL, "IntZero->less(IntMinus12)");
+    doOpReturningBoolAndCompareResult(IntZero, IntMinus73, OpReturningBool::less, false, AssertResult::FAIL, "IntZero->less(IntMinus73)");
+    doOpReturningBoolAndCompareResult(IntZero, FloatMinusOne, OpReturningBool::less, false, AssertResult::FAIL, "IntZero->less(FloatMinusOne)");
+    doOpReturningBoolAndCompareResult(IntZero, FloatZero, OpReturningBool::less, false, AssertResult::FAIL, "IntZero->less(FloatZero)");
+    doOpReturningBoolAndCompareResult(IntZero, FloatOne, OpReturningBool::less, true, AssertResult::PASS, "IntZero->less(FloatOne)");
+    doOpReturningBoolAndCompareResult(IntZero, FloatTwo, OpReturningBool::less, true, AssertResult::PASS, "IntZero->less(FloatTwo)");
+    doOpReturningBoolAndCompareResult(IntZero, FloatTwo2, OpReturningBool::less, true, AssertResult::PASS, "IntZero->less(FloatTwo2)");
+    doOpReturningBoolAndCompareResult(IntZero, Float2_5, OpReturningBool::less, true, AssertResult::PASS, "IntZero->less(Float2_5)");
+    doOpReturningBoolAndCompareResult(IntZero, Float_23_74, OpReturningBool::less, false, AssertResult::FAIL, "IntZero->less(Float_23_74)");
+    doOpReturningBoolAndCompareResult(IntZero, StrEmpty, OpReturningBool::less, false, AssertResult::EXCEPTION, "IntZero->less(StrEmpty)");
+    doOpReturningBoolAndCompareResult(IntZero, StrEmpty2, OpReturningBool::less, false, AssertResult::EXCEPTION, "IntZero->less(StrEmpty2)");
+    doOpReturningBoolAndCompareResult(IntZero, StrA, OpReturningBool::less, false, AssertResult::EXCEPTION, "IntZero->less(StrA)");
+    doOpReturningBoolAndCompareResult(IntZero, StrA2, OpReturningBool::less, false, AssertResult::EXCEPTION, "IntZero->less(StrA2)");
+    doOpReturningBoolAndCompareResult(IntZero, StrB, OpReturningBool::less, false, AssertResult::EXCEPTION, "IntZero->less(StrB)");
+    doOpReturningBoolAndCompareResult(IntZero, ListEmpty, OpReturningBool::less, false, AssertResult::EXCEPTION, "IntZero->less(ListEmpty)");
+    doOpReturningBoolAndCompareResult(IntZero, ListEmpty2, OpReturningBool::less, false, AssertResult::EXCEPTION, "IntZero->less(ListEmpty2)");
+    doOpReturningBoolAndCompareResult(IntOne, None, OpReturningBool::less, false, AssertResult::EXCEPTION, "IntOne->less(None)");
+    doOpReturningBoolAndCompareResult(IntOne, None2, OpReturningBool::less, false, AssertResult::EXCEPTION, "IntOne->less(None2)");
+    doOpReturningBoolAndCompareResult(IntOne, False, OpReturningBool::less, false, AssertResult::FAIL, "IntOne->less(False)");
+    doOpReturningBoolAndCompareResult(IntOne, False2, OpReturningBool::less, false, AssertResult::FAIL, "IntOne->less(False2)");
+    doOpReturningBoolAndCompareResult(IntOne, True, OpReturningBool::less, false, AssertResult::FAIL, "IntOne->less(True)");
+    doOpReturningBoolAndCompareResult(IntOne, True2, OpReturningBool::less, false, AssertResult::FAIL, "IntOne->less(True2)");
+    doOpReturningBoolAndCompareResult(IntOne, IntZero, OpReturningBool::less, false, AssertResult::FAIL, "IntOne->less(IntZero)");
+    doOpReturningBoolAndCompareResult(IntOne, IntOne, OpReturningBool::less, false, AssertResult::FAIL, "IntOne->less(IntOne)");
+    doOpReturningBoolAndCompareResult(IntOne, IntTwo, OpReturningBool::less, true, AssertResult::PASS, "IntOne->less(IntTwo)");
+    doOpReturningBoolAndCompareResult(IntOne, IntTwo2, OpReturningBool::less, true, AssertResult::PASS, "IntOne->less(IntTwo2)");
+    doOpReturningBoolAndCompareResult(IntOne, Int8, OpReturningBool::less, true, AssertResult::PASS, "IntOne->less(Int8)");
+    doOpReturningBoolAndCompareResult(IntOne, IntMinusOne, OpReturningBool::less, false, AssertResult::FAIL, "IntOne->less(IntMinusOne)");
+    doOpReturningBoolAndCompareResult(IntOne, IntMinusOne2, OpReturningBool::less, false, AssertResult::FAIL, "IntOne->less(IntMinusOne2)");
+    doOpReturningBoolAndCompareResult(IntOne, IntMinus12, OpReturningBool::less, false, AssertResult::FAIL, "IntOne->less(IntMinus12)");
+    doOpReturningBoolAndCompareResult(IntOne, IntMinus73, OpReturningBool::less, false, AssertResult::FAIL, "IntOne->less(IntMinus73)");
+    doOpReturningBoolAndCompareResult(IntOne, FloatMinusOne, OpReturningBool::less, false, AssertResult::FAIL, "IntOne->less(FloatMinusOne)");
+    doOpReturningBoolAndCompareResult(IntOne, FloatZero, OpReturningBool::less, false, AssertResult::FAIL, "IntOne->less(FloatZero)");
+    doOpReturningBoolAndCompareResult(IntOne, FloatOne, OpReturningBool::less, false, AssertResult::FAIL, "IntOne->less(FloatOne)");
+    doOpReturningBoolAndCompareResult(IntOne, FloatTwo, OpReturningBool::less, true, AssertResult::PASS, "IntOne->less(FloatTwo)");
+    doOpReturningBoolAndCompareResult(IntOne, FloatTwo2, OpReturningBool::less, true, AssertResult::PASS, "IntOne->less(FloatTwo2)");
+    doOpReturningBoolAndCompareResult(IntOne, Float2_5, OpReturningBool::less, true, AssertResult::PASS, "IntOne->less(Float2_5)");
+    doOpReturningBoolAndCompareResult(IntOne, Float_23_74, OpReturningBool::less, false, AssertResult::FAIL, "IntOne->less(Float_23_74)");
+    doOpReturningBoolAndCompareResult(IntOne, StrEmpty, OpReturningBool::less, false, AssertResult::EXCEPTION, "IntOne->less(StrEmpty)");
+    doOpReturningBoolAndCompareResult(IntOne, StrEmpty2, OpReturningBool::less, false, AssertResult::EXCEPTION, "IntOne->less(StrEmpty2)");
+    doOpReturningBoolAndCompareResult(IntOne, StrA, OpReturningBool::less, false, AssertResult::EXCEPTION, "IntOne->less(StrA)");
+    doOpReturningBoolAndCompareResult(IntOne, StrA2, OpReturningBool::less, false, AssertResult::EXCEPTION, "IntOne->less(StrA2)");
+    doOpReturningBoolAndCompareResult(IntOne, StrB, OpReturningBool::less, false, AssertResult::EXCEPTION, "IntOne->less(StrB)");
+    doOpReturningBoolAndCompareResult(IntOne, ListEmpty, OpReturningBool::less, false, AssertResult::EXCEPTION, "IntOne->less(ListEmpty)");
+    doOpReturningBoolAndCompareResult(IntOne, ListEmpty2, OpReturningBool::less, false, AssertResult::EXCEPTION, "IntOne->less(ListEmpty2)");
+    doOpReturningBoolAndCompareResult(IntTwo, None, OpReturningBool::less, false, AssertResult::EXCEPTION, "IntTwo->less(None)");
+    doOpReturningBoolAndCompareResult(IntTwo, None2, OpReturningBool::less, false, AssertResult::EXCEPTION, "IntTwo->less(None2)");
+    doOpReturningBoolAndCompareResult(IntTwo, False, OpReturningBool::less, false, AssertResult::FAIL, "IntTwo->less(False)");
+    doOpReturningBoolAndCompareResult(IntTwo, False2, OpReturningBool::less, false, AssertResult::FAIL, "IntTwo->less(False2)");
+    doOpReturningBoolAndCompareResult(IntTwo, True, OpReturningBool::less, false, AssertResult::FAIL, "IntTwo->less(True)");
+    doOpReturningBoolAndCompareResult(IntTwo, True2, OpReturningBool::less, false, AssertResult::FAIL, "IntTwo->less(True2)");
+    doOpReturningBoolAndCompareResult(IntTwo, IntZero, OpReturningBool::less, false, AssertResult::FAIL, "IntTwo->less(IntZero)");
+    doOpReturningBoolAndCompareResult(IntTwo, IntOne, OpReturningBool::less, false, AssertResult::FAIL, "IntTwo->less(IntOne)");
+    doOpReturningBoolAndCompareResult(IntTwo, IntTwo, OpReturningBool::less, false, AssertResult::FAIL, "IntTwo->less(IntTwo)");
+    doOpReturningBoolAndCompareResult(IntTwo, IntTwo2, OpReturningBool::less, false, AssertResult::FAIL, "IntTwo->less(IntTwo2)");
+    doOpReturningBoolAndCompareResult(IntTwo, Int8, OpReturningBool::less, true, AssertResult::PASS, "IntTwo->less(Int8)");
+    doOpReturningBoolAndCompareResult(IntTwo, IntMinusOne, OpReturningBool::less, false, AssertResult::FAIL, "IntTwo->less(IntMinusOne)");
+    doOpReturningBoolAndCompareResult(IntTwo, IntMinusOne2, OpReturningBool::less, false, AssertResult::FAIL, "IntTwo->less(IntMinusOne2)");
+    doOpReturningBoolAndCompareResult(IntTwo, IntMinus12, OpReturningBool::less, false, AssertResult::FAIL, "IntTwo->less(IntMinus12)");
+    doOpReturningBoolAndCompareResult(IntTwo, IntMinus73, OpReturningBool::less, false, AssertResult::FAIL, "IntTwo->less(IntMinus73)");
+    doOpReturningBoolAndCompareResult(IntTwo, FloatMinusOne, OpReturningBool::less, false, AssertResult::FAIL, "IntTwo->less(FloatMinusOne)");
+    doOpReturningBoolAndCompareResult(IntTwo, FloatZero, OpReturningBool::less, false, AssertResult::FAIL, "IntTwo->less(FloatZero)");
+    doOpReturningBoolAndCompareResult(IntTwo, FloatOne, OpReturningBool::less, false, AssertResult::FAIL, "IntTwo->less(FloatOne)");
+    doOpReturningBoolAndCompareResult(IntTwo, FloatTwo, OpReturningBool::less, false, AssertResult::FAIL, "IntTwo->less(FloatTwo)");
+    doOpReturningBoolAndCompareResult(IntTwo, FloatTwo2, OpReturningBool::less, false, AssertResult::FAIL, "IntTwo->less(FloatTwo2)");
+    doOpReturningBoolAndCompareResult(IntTwo, Float2_5, OpReturningBool::less, true, AssertResult::PASS, "IntTwo->less(Float2_5)");
+    doOpReturningBoolAndCompareResult(IntTwo, Float_23_74, OpReturningBool::less, false, AssertResult::FAIL, "IntTwo->less(Float_23_74)");
+    doOpReturningBoolAndCompareResult(IntTwo, StrEmpty, OpReturningBool::less, false, AssertResult::EXCEPTION, "IntTwo->less(StrEmpty)");
+    doOpReturningBoolAndCompareResult(IntTwo, StrEmpty2, OpReturningBool::less, false, AssertResult::EXCEPTION, "IntTwo->less(StrEmpty2)");
+    doOpReturningBoolAndCompareResult(IntTwo, StrA, OpReturningBool::less, false, AssertResult::EXCEPTION, "IntTwo->less(StrA)");
+    doOpReturningBoolAndCompareResult(IntTwo, StrA2, OpReturningBool::less, false, AssertResult::EXCEPTION, "IntTwo->less(StrA2)");
+    doOpReturningBoolAndCompareResult(IntTwo, StrB, OpReturningBool::less, false, AssertResult::EXCEPTION, "IntTwo->less(StrB)");
+    doOpReturningBoolAndCompareResult(IntTwo, ListEmpty, OpReturningBool::less, false, AssertResult::EXCEPTION, "IntTwo->less(ListEmpty)");
+    doOpReturningBoolAndCompareResult(IntTwo, ListEmpty2, OpReturningBool::less, false, AssertResult::EXCEPTION, "IntTwo->less(ListEmpty2)");
+    doOpReturningBoolAndCompareResult(IntTwo2, None, OpReturningBool::less, false, AssertResult::EXCEPTION, "IntTwo2->less(None)");
+    doOpReturningBoolAndCompareResult(IntTwo2, None2, OpReturningBool::less, false, AssertResult::EXCEPTION, "IntTwo2->less(None2)");
+    doOpReturningBoolAndCompareResult(IntTwo2, False, OpReturningBool::less, false, AssertResult::FAIL, "IntTwo2->less(False)");
+    doOpReturningBoolAndCompareResult(IntTwo2, False2, OpReturningBool::less, false, AssertResult::FAIL, "IntTwo2->less(False2)");
+    doOpReturningBoolAndCompareResult(IntTwo2, True, OpReturningBool::less, false, AssertResult::FAIL, "IntTwo2->less(True)");
+    doOpReturningBoolAndCompareResult(IntTwo2, True2, OpReturningBool::less, false, AssertResult::FAIL, "IntTwo2->less(True2)");
+    doOpReturningBoolAndCompareResult(IntTwo2, IntZero, OpReturningBool::less, false, AssertResult::FAIL, "IntTwo2->less(IntZero)");
+    doOpReturningBoolAndCompareResult(IntTwo2, IntOne, OpReturningBool::less, false, AssertResult::FAIL, "IntTwo2->less(IntOne)");
+    doOpReturningBoolAndCompareResult(IntTwo2, IntTwo, OpReturningBool::less, false, AssertResult::FAIL, "IntTwo2->less(IntTwo)");
+    doOpReturningBoolAndCompareResult(IntTwo2, IntTwo2, OpReturningBool::less, false, AssertResult::FAIL, "IntTwo2->less(IntTwo2)");
+    doOpReturningBoolAndCompareResult(IntTwo2, Int8, OpReturningBool::less, true, AssertResult::PASS, "IntTwo2->less(Int8)");
+    doOpReturningBoolAndCompareResult(IntTwo2, IntMinusOne, OpReturningBool::less, false, AssertResult::FAIL, "IntTwo2->less(IntMinusOne)");
+    doOpReturningBoolAndCompareResult(IntTwo2, IntMinusOne2, OpReturningBool::less, false, AssertResult::FAIL, "IntTwo2->less(IntMinusOne2)");
+    doOpReturningBoolAndCompareResult(IntTwo2, IntMinus12, OpReturningBool::less, false, AssertResult::FAIL, "IntTwo2->less(IntMinus12)");
+    doOpReturningBoolAndCompareResult(IntTwo2, IntMinus73, OpReturningBool::less, false, AssertResult::FAIL, "IntTwo2->less(IntMinus73)");
+    doOpReturningBoolAndCompareResult(IntTwo2, FloatMinusOne, OpReturningBool::less, false, AssertResult::FAIL, "IntTwo2->less(FloatMinusOne)");
+    doOpReturningBoolAndCompareResult(IntTwo2, FloatZero, OpReturningBool::less, false, AssertResult::FAIL, "IntTwo2->less(FloatZero)");
+    doOpReturningBoolAndCompareResult(IntTwo2, FloatOne, OpReturningBool::less, false, AssertResult::FAIL, "IntTwo2->less(FloatOne)");
+    doOpReturningBoolAndCompareResult(IntTwo2, FloatTwo, OpReturningBool::less, false, AssertResult::FAIL, "IntTwo2->less(FloatTwo)");
+    doOpReturningBoolAndCompareResult(IntTwo2, FloatTwo2, OpReturningBool::less, false, AssertResult::FAIL, "IntTwo2->less(FloatTwo2)");
+    doOpReturningBoolAndCompareResult(IntTwo2, Float2_5, OpReturningBool::less, true, AssertResult::PASS, "IntTwo2->less(Float2_5)");
+    doOpReturningBoolAndCompareResult(IntTwo2, Float_23_74, OpReturningBool::less, false, AssertResult::FAIL, "IntTwo2->less(Float_23_74)");
+    doOpReturningBoolAndCompareResult(IntTwo2, StrEmpty, OpReturningBool::less, false, AssertResult::EXCEPTION, "IntTwo2->less(StrEmpty)");
+    doOpReturningBoolAndCompareResult(IntTwo2, StrEmpty2, OpReturningBool::less, false, AssertResult::EXCEPTION, "IntTwo2->less(StrEmpty2)");
+    doOpReturningBoolAndCompareResult(IntTwo2, StrA, OpReturningBool::less, false, AssertResult::EXCEPTION, "IntTwo2->less(StrA)");
+    doOpReturningBoolAndCompareResult(IntTwo2, StrA2, OpReturningBool::less, false, AssertResult::EXCEPTION, "IntTwo2->less(StrA2)");
+    doOpReturningBoolAndCompareResult(IntTwo2, StrB, OpReturningBool::less, false, AssertResult::EXCEPTION, "IntTwo2->less(StrB)");
+    doOpReturningBoolAndCompareResult(IntTwo2, ListEmpty, OpReturningBool::less, false, AssertResult::EXCEPTION, "IntTwo2->less(ListEmpty)");
+    doOpReturningBoolAndCompareResult(IntTwo2, ListEmpty2, OpReturningBool::less, false, AssertResult::EXCEPTION, "IntTwo2->less(ListEmpty2)");
+    doOpReturningBoolAndCompareResult(Int8, None, OpReturningBool::less, false, AssertResult::EXCEPTION, "Int8->less(None)");
+    doOpReturningBoolAndCompareResult(Int8, None2, OpReturningBool::less, false, AssertResult::EXCEPTION, "Int8->less(None2)");
+    doOpReturningBoolAndCompareResult(Int8, False, OpReturningBool::less, false, AssertResult::FAIL, "Int8->less(False)");
+    doOpReturningBoolAndCompareResult(Int8, False2, OpReturningBool::less, false, AssertResult::FAIL, "Int8->less(False2)");
+    doOpReturningBoolAndCompareResult(Int8, True, OpReturningBool::less, false, AssertResult::FAIL, "Int8->less(True)");
+    doOpReturningBoolAndCompareResult(Int8, True2, OpReturningBool::less, false, AssertResult::FAIL, "Int8->less(True2)");
+    doOpReturningBoolAndCompareResult(Int8, IntZero, OpReturningBool::less, false, AssertResult::FAIL, "Int8->less(IntZero)");
+    doOpReturningBoolAndCompareResult(Int8, IntOne, OpReturningBool::less, false, AssertResult::FAIL, "Int8->less(IntOne)");
+    doOpReturningBoolAndCompareResult(Int8, IntTwo, OpReturningBool::less, false, AssertResult::FAIL, "Int8->less(IntTwo)");
+    doOpReturningBoolAndCompareResult(Int8, IntTwo2, OpReturningBool::less, false, AssertResult::FAIL, "Int8->less(IntTwo2)");
+    doOpReturningBoolAndCompareResult(Int8, Int8, OpReturningBool::less, false, AssertResult::FAIL, "Int8->less(Int8)");
+    doOpReturningBoolAndCompareResult(Int8, IntMinusOne, OpReturningBool::less, false, AssertResult::FAIL, "Int8->less(IntMinusOne)");
+    doOpReturningBoolAndCompareResult(Int8, IntMinusOne2, OpReturningBool::less, false, AssertResult::FAIL, "Int8->less(IntMinusOne2)");
+    doOpReturningBoolAndCompareResult(Int8, IntMinus12, OpReturningBool::less, false, AssertResult::FAIL, "Int8->less(IntMinus12)");
+    doOpReturningBoolAndCompareResult(Int8, IntMinus73, OpReturningBool::less, false, AssertResult::FAIL, "Int8->less(IntMinus73)");
+    doOpReturningBoolAndCompareResult(Int8, FloatMinusOne, OpReturningBool::less, false, AssertResult::FAIL, "Int8->less(FloatMinusOne)");
+    doOpReturningBoolAndCompareResult(Int8, FloatZero, OpReturningBool::less, false, AssertResult::FAIL, "Int8->less(FloatZero)");
+    doOpReturningBoolAndCompareResult(Int8, FloatOne, OpReturningBool::less, false, AssertResult::FAIL, "Int8->less(FloatOne)");
+    doOpReturningBoolAndCompareResult(Int8, FloatTwo, OpReturningBool::less, false, AssertResult::FAIL, "Int8->less(FloatTwo)");
+    doOpReturningBoolAndCompareResult(Int8, FloatTwo2, OpReturningBool::less, false, AssertResult::FAIL, "Int8->less(FloatTwo2)");
+    doOpReturningBoolAndCompareResult(Int8, Float2_5, OpReturningBool::less, false, AssertResult::FAIL, "Int8->less(Float2_5)");
+    doOpReturningBoolAndCompareResult(Int8, Float_23_74, OpReturningBool::less, false, AssertResult::FAIL, "Int8->less(Float_23_74)");
+    doOpReturningBoolAndCompareResult(Int8, StrEmpty, OpReturningBool::less, false, AssertResult::EXCEPTION, "Int8->less(StrEmpty)");
+    doOpReturningBoolAndCompareResult(Int8, StrEmpty2, OpReturningBool::less, false, AssertResult::EXCEPTION, "Int8->less(StrEmpty2)");
+    doOpReturningBoolAndCompareResult(Int8, StrA, OpReturningBool::less, false, AssertResult::EXCEPTION, "Int8->less(StrA)");
+    doOpReturningBoolAndCompareResult(Int8, StrA2, OpReturningBool::less, false, AssertResult::EXCEPTION, "Int8->less(StrA2)");
+    doOpReturningBoolAndCompareResult(Int8, StrB, OpReturningBool::less, false, AssertResult::EXCEPTION, "Int8->less(StrB)");
+    doOpReturningBoolAndCompareResult(Int8, ListEmpty, OpReturningBool::less, false, AssertResult::EXCEPTION, "Int8->less(ListEmpty)");
+    doOpReturningBoolAndCompareResult(Int8, ListEmpty2, OpReturningBool::less, false, AssertResult::EXCEPTION, "Int8->less(ListEmpty2)");
+    doOpReturningBoolAndCompareResult(IntMinusOne, None, OpReturningBool::less, false, AssertResult::EXCEPTION, "IntMinusOne->less(None)");
+    doOpReturningBoolAndCompareResult(IntMinusOne, None2, OpReturningBool::less, false, AssertResult::EXCEPTION, "IntMinusOne->less(None2)");
+    doOpReturningBoolAndCompareResult(IntMinusOne, False, OpReturningBool::less, true, AssertResult::PASS, "IntMinusOne->less(False)");
+    doOpReturningBoolAndCompareResult(IntMinusOne, False2, OpReturningBool::less, true, AssertResult::PASS, "IntMinusOne->less(False2)");
+    doOpReturningBoolAndCompareResult(IntMinusOne, True, OpReturningBool::less, true, AssertResult::PASS, "IntMinusOne->less(True)");
+    doOpReturningBoolAndCompareResult(IntMinusOne, True2, OpReturningBool::less, true, AssertResult::PASS, "IntMinusOne->less(True2)");
+    doOpReturningBoolAndCompareResult(IntMinusOne, IntZero, OpReturningBool::less, true, AssertResult::PASS, "IntMinusOne->less(IntZero)");
+    doOpReturningBoolAndCompareResult(IntMinusOne, IntOne, OpReturningBool::less, true, AssertResult::PASS, "IntMinusOne->less(IntOne)");
+    doOpReturningBoolAndCompareResult(IntMinusOne, IntTwo, OpReturningBool::less, true, AssertResult::PASS, "IntMinusOne->less(IntTwo)");
+    doOpReturningBoolAndCompareResult(IntMinusOne, IntTwo2, OpReturningBool::less, true, AssertResult::PASS, "IntMinusOne->less(IntTwo2)");
+    doOpReturningBoolAndCompareResult(IntMinusOne, Int8, OpReturningBool::less, true, AssertResult::PASS, "IntMinusOne->less(Int8)");
+    doOpReturningBoolAndCompareResult(IntMinusOne, IntMinusOne, OpReturningBool::less, false, AssertResult::FAIL, "IntMinusOne->less(IntMinusOne)");
+    doOpReturningBoolAndCompareResult(IntMinusOne, IntMinusOne2, OpReturningBool::less, false, AssertResult::FAIL, "IntMinusOne->less(IntMinusOne2)");
+    doOpReturningBoolAndCompareResult(IntMinusOne, IntMinus12, OpReturningBool::less, false, AssertResult::FAIL, "IntMinusOne->less(IntMinus12)");
+    doOpReturningBoolAndCompareResult(IntMinusOne, IntMinus73, OpReturningBool::less, false, AssertResult::FAIL, "IntMinusOne->less(IntMinus73)");
+    doOpReturningBoolAndCompareResult(IntMinusOne, FloatMinusOne, OpReturningBool::less, false, AssertResult::FAIL, "IntMinusOne->less(FloatMinusOne)");
+    doOpReturningBoolAndCompareResult(IntMinusOne, FloatZero, OpReturningBool::less, true, AssertResult::PASS, "IntMinusOne->less(FloatZero)");
+    doOpReturningBoolAndCompareResult(IntMinusOne, FloatOne, OpReturningBool::less, true, AssertResult::PASS, "IntMinusOne->less(FloatOne)");
+    doOpReturningBoolAndCompareResult(IntMinusOne, FloatTwo, OpReturningBool::less, true, AssertResult::PASS, "IntMinusOne->less(FloatTwo)");
+    doOpReturningBoolAndCompareResult(IntMinusOne, FloatTwo2, OpReturningBool::less, true, AssertResult::PASS, "IntMinusOne->less(FloatTwo2)");
+    doOpReturningBoolAndCompareResult(IntMinusOne, Float2_5, OpReturningBool::less, true, AssertResult::PASS, "IntMinusOne->less(Float2_5)");
+    doOpReturningBoolAndCompareResult(IntMinusOne, Float_23_74, OpReturningBool::less, false, AssertResult::FAIL, "IntMinusOne->less(Float_23_74)");
+    doOpReturningBoolAndCompareResult(IntMinusOne, StrEmpty, OpReturningBool::less, false, AssertResult::EXCEPTION, "IntMinusOne->less(StrEmpty)");
+    doOpReturningBoolAndCompareResult(IntMinusOne, StrEmpty2, OpReturningBool::less, false, AssertResult::EXCEPTION, "IntMinusOne->less(StrEmpty2)");
+    doOpReturningBoolAndCompareResult(IntMinusOne, StrA, OpReturningBool::less, false, AssertResult::EXCEPTION, "IntMinusOne->less(StrA)");
+    doOpReturningBoolAndCompareResult(IntMinusOne, StrA2, OpReturningBool::less, false, AssertResult::EXCEPTION, "IntMinusOne->less(StrA2)");
+    doOpReturningBoolAndCompareResult(IntMinusOne, StrB, OpReturningBool::less, false, AssertResult::EXCEPTION, "IntMinusOne->less(StrB)");
+    doOpReturningBoolAndCompareResult(IntMinusOne, ListEmpty, OpReturningBool::less, false, AssertResult::EXCEPTION, "IntMinusOne->less(ListEmpty)");
+    doOpReturningBoolAndCompareResult(IntMinusOne, ListEmpty2, OpReturningBool::less, false, AssertResult::EXCEPTION, "IntMinusOne->less(ListEmpty2)");
+    doOpReturningBoolAndCompareResult(IntMinusOne2, None, OpReturningBool::less, false, AssertResult::EXCEPTION, "IntMinusOne2->less(None)");
+    doOpReturningBoolAndCompareResult(IntMinusOne2, None2, OpReturningBool::less, false, AssertResult::EXCEPTION, "IntMinusOne2->less(None2)");
+    doOpReturningBoolAndCompareResult(IntMinusOne2, False, OpReturningBool::less, true, AssertResult::PASS, "IntMinusOne2->less(False)");
+    doOpReturningBoolAndCompareResult(IntMinusOne2, False2, OpReturningBool::less, true, AssertResult::PASS, "IntMinusOne2->less(False2)");
+    doOpReturningBoolAndCompareResult(IntMinusOne2, True, OpReturningBool::less, true, AssertResult::PASS, "IntMinusOne2->less(True)");
+    doOpReturningBoolAndCompareResult(IntMinusOne2, True2, OpReturningBool::less, true, AssertResult::PASS, "IntMinusOne2->less(True2)");
+    doOpReturningBoolAndCompareResult(IntMinusOne2, IntZero, OpReturningBool::less, true, AssertResult::PASS, "IntMinusOne2->less(IntZero)");
+    doOpReturningBoolAndCompareResult(IntMinusOne2, IntOne, OpReturningBool::less, true, AssertResult::PASS, "IntMinusOne2->less(IntOne)");
+    doOpReturningBoolAndCompareResult(IntMinusOne2, IntTwo, OpReturningBool::less, true, AssertResult::PASS, "IntMinusOne2->less(IntTwo)");
+    doOpReturningBoolAndCompareResult(IntMinusOne2, IntTwo2, OpReturningBool::less, true, AssertResult::PASS, "IntMinusOne2->less(IntTwo2)");
+    doOpReturningBoolAndCompareResult(IntMinusOne2, Int8, OpReturningBool::less, true, AssertResult::PASS, "IntMinusOne2->less(Int8)");
+    doOpReturningBoolAndCompareResult(IntMinusOne2, IntMinusOne, OpReturningBool::less, false, AssertResult::FAIL, "IntMinusOne2->less(IntMinusOne)");
+    doOpReturningBoolAndCompareResult(IntMinusOne2, IntMinusOne2, OpReturningBool::less, false, AssertResult::FAIL, "IntMinusOne2->less(IntMinusOne2)");
+    doOpReturningBoolAndCompareResult(IntMinusOne2, IntMinus12, OpReturningBool::less, false, AssertResult::FAIL, "IntMinusOne2->less(IntMinus12)");
+    doOpReturningBoolAndCompareResult(IntMinusOne2, IntMinus73, OpReturningBool::less, false, AssertResult::FAIL, "IntMinusOne2->less(IntMinus73)");
+    doOpReturningBoolAndCompareResult(IntMinusOne2, FloatMinusOne, OpReturningBool::less, false, AssertResult::FAIL, "IntMinusOne2->less(FloatMinusOne)");
+    doOpReturningBoolAndCompareResult(IntMinusOne2, FloatZero, OpReturningBool::less, true, AssertResult::PASS, "IntMinusOne2->less(FloatZero)");
+    doOpReturningBoolAndCompareResult(IntMinusOne2, FloatOne, OpReturningBool::less, true, AssertResult::PASS, "IntMinusOne2->less(FloatOne)");
+    doOpReturningBoolAndCompareResult(IntMinusOne2, FloatTwo, OpReturningBool::less, true, AssertResult::PASS, "IntMinusOne2->less(FloatTwo)");
+    doOpReturningBoolAndCompareResult(IntMinusOne2, FloatTwo2, OpReturningBool::less, true, AssertResult::PASS, "IntMinusOne2->less(FloatTwo2)");
+    doOpReturningBoolAndCompareResult(IntMinusOne2, Float2_5, OpReturningBool::less, true, AssertResult::PASS, "IntMinusOne2->less(Float2_5)");
+    doOpReturningBoolAndCompareResult(IntMinusOne2, Float_23_74, OpReturningBool::less, false, AssertResult::FAIL, "IntMinusOne2->less(Float_23_74)");
+    doOpReturningBoolAndCompareResult(IntMinusOne2, StrEmpty, OpReturningBool::less, false, AssertResult::EXCEPTION, "IntMinusOne2->less(StrEmpty)");
+    doOpReturningBoolAndCompareResult(IntMinusOne2, StrEmpty2, OpReturningBool::less, false, AssertResult::EXCEPTION, "IntMinusOne2->less(StrEmpty2)");
+    doOpReturningBoolAndCompareResult(IntMinusOne2, StrA, OpReturningBool::less, false, AssertResult::EXCEPTION, "IntMinusOne2->less(StrA)");
+    doOpReturningBoolAndCompareResult(IntMinusOne2, StrA2, OpReturningBool::less, false, AssertResult::EXCEPTION, "IntMinusOne2->less(StrA2)");
+    doOpReturningBoolAndCompareResult(IntMinusOne2, StrB, OpReturningBool::less, false, AssertResult::EXCEPTION, "IntMinusOne2->less(StrB)");
+    doOpReturningBoolAndCompareResult(IntMinusOne2, ListEmpty, OpReturningBool::less, false, AssertResult::EXCEPTION, "IntMinusOne2->less(ListEmpty)");
+    doOpReturningBoolAndCompareResult(IntMinusOne2, ListEmpty2, OpReturningBool::less, false, AssertResult::EXCEPTION, "IntMinusOne2->less(ListEmpty2)");
+    doOpReturningBoolAndCompareResult(IntMinus12, None, OpReturningBool::less, false, AssertResult::EXCEPTION, "IntMinus12->less(None)");
+    doOpReturningBoolAndCompareResult(IntMinus12, None2, OpReturningBool::less, false, AssertResult::EXCEPTION, "IntMinus12->less(None2)");
+    doOpReturningBoolAndCompareResult(IntMinus12, False, OpReturningBool::less, true, AssertResult::PASS, "IntMinus12->less(False)");
+    doOpReturningBoolAndCompareResult(IntMinus12, False2, OpReturningBool::less, true, AssertResult::PASS, "IntMinus12->less(False2)");
+    doOpReturningBoolAndCompareResult(IntMinus12, True, OpReturningBool::less, true, AssertResult::PASS, "IntMinus12->less(True)");
+    doOpReturningBoolAndCompareResult(IntMinus12, True2, OpReturningBool::less, true, AssertResult::PASS, "IntMinus12->less(True2)");
+    doOpReturningBoolAndCompareResult(IntMinus12, IntZero, OpReturningBool::less, true, AssertResult::PASS, "IntMinus12->less(IntZero)");
+    doOpReturningBoolAndCompareResult(IntMinus12, IntOne, OpReturningBool::less, true, AssertResult::PASS, "IntMinus12->less(IntOne)");
+    doOpReturningBoolAndCompareResult(IntMinus12, IntTwo, OpReturningBool::less, true, AssertResult::PASS, "IntMinus12->less(IntTwo)");
+    doOpReturningBoolAndCompareResult(IntMinus12, IntTwo2, OpReturningBool::less, true, AssertResult::PASS, "IntMinus12->less(IntTwo2)");
+    doOpReturningBoolAndCompareResult(IntMinus12, Int8, OpReturningBool::less, true, AssertResult::PASS, "IntMinus12->less(Int8)");
+    doOpReturningBoolAndCompareResult(IntMinus12, IntMinusOne, OpReturningBool::less, true, AssertResult::PASS, "IntMinus12->less(IntMinusOne)");
+    doOpReturningBoolAndCompareResult(IntMinus12, IntMinusOne2, OpReturningBool::less, true, AssertResult::PASS, "IntMinus12->less(IntMinusOne2)");
+    doOpReturningBoolAndCompareResult(IntMinus12, IntMinus12, OpReturningBool::less, false, AssertResult::FAIL, "IntMinus12->less(IntMinus12)");
+    doOpReturningBoolAndCompareResult(IntMinus12, IntMinus73, OpReturningBool::less, false, AssertResult::FAIL, "IntMinus12->less(IntMinus73)");
+    doOpReturningBoolAndCompareResult(IntMinus12, FloatMinusOne, OpReturningBool::less, true, AssertResult::PASS, "IntMinus12->less(FloatMinusOne)");
+    doOpReturningBoolAndCompareResult(IntMinus12, FloatZero, OpReturningBool::less, true, AssertResult::PASS, "IntMinus12->less(FloatZero)");
+    doOpReturningBoolAndCompareResult(IntMinus12, FloatOne, OpReturningBool::less, true, AssertResult::PASS, "IntMinus12->less(FloatOne)");
+    doOpReturningBoolAndCompareResult(IntMinus12, FloatTwo, OpReturningBool::less, true, AssertResult::PASS, "IntMinus12->less(FloatTwo)");
+    doOpReturningBoolAndCompareResult(IntMinus12, FloatTwo2, OpReturningBool::less, true, AssertResult::PASS, "IntMinus12->less(FloatTwo2)");
+    doOpReturningBoolAndCompareResult(IntMinus12, Float2_5, OpReturningBool::less, true, AssertResult::PASS, "IntMinus12->less(Float2_5)");
+    doOpReturningBoolAndCompareResult(IntMinus12, Float_23_74, OpReturningBool::less, false, AssertResult::FAIL, "IntMinus12->less(Float_23_74)");
+    doOpReturningBoolAndCompareResult(IntMinus12, StrEmpty, OpReturningBool::less, false, AssertResult::EXCEPTION, "IntMinus12->less(StrEmpty)");
+    doOpReturningBoolAndCompareResult(IntMinus12, StrEmpty2, OpReturningBool::less, false, AssertResult::EXCEPTION, "IntMinus12->less(StrEmpty2)");
+    doOpReturningBoolAndCompareResult(IntMinus12, StrA, OpReturningBool::less, false, AssertResult::EXCEPTION, "IntMinus12->less(StrA)");
+    doOpReturningBoolAndCompareResult(IntMinus12, StrA2, OpReturningBool::less, false, AssertResult::EXCEPTION, "IntMinus12->less(StrA2)");
+    doOpReturningBoolAndCompareResult(IntMinus12, StrB, OpReturningBool::less, false, AssertResult::EXCEPTION, "IntMinus12->less(StrB)");
+    doOpReturningBoolAndCompareResult(IntMinus12, ListEmpty, OpReturningBool::less, false, AssertResult::EXCEPTION, "IntMinus12->less(ListEmpty)");
+    doOpReturningBoolAndCompareResult(IntMinus12, ListEmpty2, OpReturningBool::less, false, AssertResult::EXCEPTION, "IntMinus12->less(ListEmpty2)");
+    doOpReturningBoolAndCompareResult(IntMinus73, None, OpReturningBool::less, false, AssertResult::EXCEPTION, "IntMinus73->less(None)");
+    doOpReturningBoolAndCompareResult(IntMinus73, None2, OpReturningBool::less, false, AssertResult::EXCEPTION, "IntMinus73->less(None2)");
+    doOpReturningBoolAndCompareResult(IntMinus73, False, OpReturningBool::less, true, AssertResult::PASS, "IntMinus73->less(False)");
+    doOpReturningBoolAndCompareResult(IntMinus73, False2, OpReturningBool::less, true, AssertResult::PASS, "IntMinus73->less(False2)");
+    doOpReturningBoolAndCompareResult(IntMinus73, True, OpReturningBool::less, true, AssertResult::PASS, "IntMinus73->less(True)");
+    doOpReturningBoolAndCompareResult(IntMinus73, True2, OpReturningBool::less, true, AssertResult::PASS, "IntMinus73->less(True2)");
+    doOpReturningBoolAndCompareResult(IntMinus73, IntZero, OpReturningBool::less, true, AssertResult::PASS, "IntMinus73->less(IntZero)");
+    doOpReturningBoolAndCompareResult(IntMinus73, IntOne, OpReturningBool::less, true, AssertResult::PASS, "IntMinus73->less(IntOne)");
+    doOpReturningBoolAndCompareResult(IntMinus73, IntTwo, OpReturningBool::less, true, AssertResult::PASS, "IntMinus73->less(IntTwo)");
+    doOpReturningBoolAndCompareResult(IntMinus73, IntTwo2, OpReturningBool::less, true, AssertResult::PASS, "IntMinus73->less(IntTwo2)");
+    doOpReturningBoolAndCompareResult(IntMinus73, Int8, OpReturningBool::less, true, AssertResult::PASS, "IntMinus73->less(Int8)");
+    doOpReturningBoolAndCompareResult(IntMinus73, IntMinusOne, OpReturningBool::less, true, AssertResult::PASS, "IntMinus73->less(IntMinusOne)");
+    doOpReturningBoolAndCompareResult(IntMinus73, IntMinusOne2, OpReturningBool::less, true, AssertResult::PASS, "IntMinus73->less(IntMinusOne2)");
+    doOpReturningBoolAndCompareResult(IntMinus73, IntMinus12, OpReturningBool::less, true, AssertResult::PASS, "IntMinus73->less(IntMinus12)");
+    doOpReturningBoolAndCompareResult(IntMinus73, IntMinus73, OpReturningBool::less, false, AssertResult::FAIL, "IntMinus73->less(IntMinus73)");
+    doOpReturningBoolAndCompareResult(IntMinus73, FloatMinusOne, OpReturningBool::less, true, AssertResult::PASS, "IntMinus73->less(FloatMinusOne)");
+    doOpReturningBoolAndCompareResult(IntMinus73, FloatZero, OpReturningBool::less, true, AssertResult::PASS, "IntMinus73->less(FloatZero)");
+    doOpReturningBoolAndCompareResult(IntMinus73, FloatOne, OpReturningBool::less, true, AssertResult::PASS, "IntMinus73->less(FloatOne)");
+    doOpReturningBoolAndCompareResult(IntMinus73, FloatTwo, OpReturningBool::less, true, AssertResult::PASS, "IntMinus73->less(FloatTwo)");
+    doOpReturningBoolAndCompareResult(IntMinus73, FloatTwo2, OpReturningBool::less, true, AssertResult::PASS, "IntMinus73->less(FloatTwo2)");
+    doOpReturningBoolAndCompareResult(IntMinus73, Float2_5, OpReturningBool::less, true, AssertResult::PASS, "IntMinus73->less(Float2_5)");
+    doOpReturningBoolAndCompareResult(IntMinus73, Float_23_74, OpReturningBool::less, true, AssertResult::PASS, "IntMinus73->less(Float_23_74)");
+    doOpReturningBoolAndCompareResult(IntMinus73, StrEmpty, OpReturningBool::less, false, AssertResult::EXCEPTION, "IntMinus73->less(StrEmpty)");
+    doOpReturningBoolAndCompareResult(IntMinus73, StrEmpty2, OpReturningBool::less, false, AssertResult::EXCEPTION, "IntMinus73->less(StrEmpty2)");
+    doOpReturningBoolAndCompareResult(IntMinus73, StrA, OpReturningBool::less, false, AssertResult::EXCEPTION, "IntMinus73->less(StrA)");
+    doOpReturningBoolAndCompareResult(IntMinus73, StrA2, OpReturningBool::less, false, AssertResult::EXCEPTION, "IntMinus73->less(StrA2)");
+    doOpReturningBoolAndCompareResult(IntMinus73, StrB, OpReturningBool::less, false, AssertResult::EXCEPTION, "IntMinus73->less(StrB)");
+    doOpReturningBoolAndCompareResult(IntMinus73, ListEmpty, OpReturningBool::less, false, AssertResult::EXCEPTION, "IntMinus73->less(ListEmpty)");
+    doOpReturningBoolAndCompareResult(IntMinus73, ListEmpty2, OpReturningBool::less, false, AssertResult::EXCEPTION, "IntMinus73->less(ListEmpty2)");
+    doOpReturningBoolAndCompareResult(FloatMinusOne, None, OpReturningBool::less, false, AssertResult::EXCEPTION, "FloatMinusOne->less(None)");
+    doOpReturningBoolAndCompareResult(FloatMinusOne, None2, OpReturningBool::less, false, AssertResult::EXCEPTION, "FloatMinusOne->less(None2)");
+    doOpReturningBoolAndCompareResult(FloatMinusOne, False, OpReturningBool::less, true, AssertResult::PASS, "FloatMinusOne->less(False)");
+    doOpReturningBoolAndCompareResult(FloatMinusOne, False2, OpReturningBool::less, true, AssertResult::PASS, "FloatMinusOne->less(False2)");
+    doOpReturningBoolAndCompareResult(FloatMinusOne, True, OpReturningBool::less, true, AssertResult::PASS, "FloatMinusOne->less(True)");
+    doOpReturningBoolAndCompareResult(FloatMinusOne, True2, OpReturningBool::less, true, AssertResult::PASS, "FloatMinusOne->less(True2)");
+    doOpReturningBoolAndCompareResult(FloatMinusOne, IntZero, OpReturningBool::less, true, AssertResult::PASS, "FloatMinusOne->less(IntZero)");
+    doOpReturningBoolAndCompareResult(FloatMinusOne, IntOne, OpReturningBool::less, true, AssertResult::PASS, "FloatMinusOne->less(IntOne)");
+    doOpReturningBoolAndCompareResult(FloatMinusOne, IntTwo, OpReturningBool::less, true, AssertResult::PASS, "FloatMinusOne->less(IntTwo)");
+    doOpReturningBoolAndCompareResult(FloatMinusOne, IntTwo2, OpReturningBool::less, true, AssertResult::PASS, "FloatMinusOne->less(IntTwo2)");
+    doOpReturningBoolAndCompareResult(FloatMinusOne, Int8, OpReturningBool::less, true, AssertResult::PASS, "FloatMinusOne->less(Int8)");
+    doOpReturningBoolAndCompareResult(FloatMinusOne, IntMinusOne, OpReturningBool::less, false, AssertResult::FAIL, "FloatMinusOne->less(IntMinusOne)");
+    doOpReturningBoolAndCompareResult(FloatMinusOne, IntMinusOne2, OpReturningBool::less, false, AssertResult::FAIL, "FloatMinusOne->less(IntMinusOne2)");
+    doOpReturningBoolAndCompareResult(FloatMinusOne, IntMinus12, OpReturningBool::less, false, AssertResult::FAIL, "FloatMinusOne->less(IntMinus12)");
+    doOpReturningBoolAndCompareResult(FloatMinusOne, IntMinus73, OpReturningBool::less, false, AssertResult::FAIL, "FloatMinusOne->less(IntMinus73)");
+    doOpReturningBoolAndCompareResult(FloatMinusOne, FloatMinusOne, OpReturningBool::less, false, AssertResult::FAIL, "FloatMinusOne->less(FloatMinusOne)");
+    doOpReturningBoolAndCompareResult(FloatMinusOne, FloatZero, OpReturningBool::less, true, AssertResult::PASS, "FloatMinusOne->less(FloatZero)");
+    doOpReturningBoolAndCompareResult(FloatMinusOne, FloatOne, OpReturningBool::less, true, AssertResult::PASS, "FloatMinusOne->less(FloatOne)");
+    doOpReturningBoolAndCompareResult(FloatMinusOne, FloatTwo, OpReturningBool::less, true, AssertResult::PASS, "FloatMinusOne->less(FloatTwo)");
+    doOpReturningBoolAndCompareResult(FloatMinusOne, FloatTwo2, OpReturningBool::less, true, AssertResult::PASS, "FloatMinusOne->less(FloatTwo2)");
+    doOpReturningBoolAndCompareResult(FloatMinusOne, Float2_5, OpReturningBool::less, true, AssertResult::PASS, "FloatMinusOne->less(Float2_5)");
+    doOpReturningBoolAndCompareResult(FloatMinusOne, Float_23_74, OpReturningBool::less, false, AssertResult::FAIL, "FloatMinusOne->less(Float_23_74)");
+    doOpReturningBoolAndCompareResult(FloatMinusOne, StrEmpty, OpReturningBool::less, false, AssertResult::EXCEPTION, "FloatMinusOne->less(StrEmpty)");
+    doOpReturningBoolAndCompareResult(FloatMinusOne, StrEmpty2, OpReturningBool::less, false, AssertResult::EXCEPTION, "FloatMinusOne->less(StrEmpty2)");
+    doOpReturningBoolAndCompareResult(FloatMinusOne, StrA, OpReturningBool::less, false, AssertResult::EXCEPTION, "FloatMinusOne->less(StrA)");
+    doOpReturningBoolAndCompareResult(FloatMinusOne, StrA2, OpReturningBool::less, false, AssertResult::EXCEPTION, "FloatMinusOne->less(StrA2)");
+    doOpReturningBoolAndCompareResult(FloatMinusOne, StrB, OpReturningBool::less, false, AssertResult::EXCEPTION, "FloatMinusOne->less(StrB)");
+    doOpReturningBoolAndCompareResult(FloatMinusOne, ListEmpty, OpReturningBool::less, false, AssertResult::EXCEPTION, "FloatMinusOne->less(ListEmpty)");
+    doOpReturningBoolAndCompareResult(FloatMinusOne, ListEmpty2, OpReturningBool::less, false, AssertResult::EXCEPTION, "FloatMinusOne->less(ListEmpty2)");
+    doOpReturningBoolAndCompareResult(FloatZero, None, OpReturningBool::less, false, AssertResult::EXCEPTION, "FloatZero->less(None)");
+    doOpReturningBoolAndCompareResult(FloatZero, None2, OpReturningBool::less, false, AssertResult::EXCEPTION, "FloatZero->less(None2)");
+    doOpReturningBoolAndCompareResult(FloatZero, False, OpReturningBool::less, false, AssertResult::FAIL, "FloatZero->less(False)");
+    doOpReturningBoolAndCompareResult(FloatZero, False2, OpReturningBool::less, false, AssertResult::FAIL, "FloatZero->less(False2)");
+    doOpReturningBoolAndCompareResult(FloatZero, True, OpReturningBool::less, true, AssertResult::PASS, "FloatZero->less(True)");
+    doOpReturningBoolAndCompareResult(FloatZero, True2, OpReturningBool::less, true, AssertResult::PASS, "FloatZero->less(True2)");
+    doOpReturningBoolAndCompareResult(FloatZero, IntZero, OpReturningBool::less, false, AssertResult::FAIL, "FloatZero->less(IntZero)");
+    doOpReturningBoolAndCompareResult(FloatZero, IntOne, OpReturningBool::less, true, AssertResult::PASS, "FloatZero->less(IntOne)");
+    doOpReturningBoolAndCompareResult(FloatZero, IntTwo, OpReturningBool::less, true, AssertResult::PASS, "FloatZero->less(IntTwo)");
+    doOpReturningBoolAndCompareResult(FloatZero, IntTwo2, OpReturningBool::less, true, AssertResult::PASS, "FloatZero->less(IntTwo2)");
+    doOpReturningBoolAndCompareResult(FloatZero, Int8, OpReturningBool::less, true, AssertResult::PASS, "FloatZero->less(Int8)");
+    doOpReturningBoolAndCompareResult(FloatZero, IntMinusOne, OpReturningBool::less, false, AssertResult::FAIL, "FloatZero->less(IntMinusOne)");
+    doOpReturningBoolAndCompareResult(FloatZero, IntMinusOne2, OpReturningBool::less, false, AssertResult::FAIL, "FloatZero->less(IntMinusOne2)");
+    doOpReturningBoolAndCompareResult(FloatZero, IntMinus12, OpReturningBool::less, false, AssertResult::FAIL, "FloatZero->less(IntMinus12)");
+    doOpReturningBoolAndCompareResult(FloatZero, IntMinus73, OpReturningBool::less, false, AssertResult::FAIL, "FloatZero->less(IntMinus73)");
+    doOpReturningBoolAndCompareResult(FloatZero, FloatMinusOne, OpReturningBool::less, false, AssertResult::FAIL, "FloatZero->less(FloatMinusOne)");
+    doOpReturningBoolAndCompareResult(FloatZero, FloatZero, OpReturningBool::less, false, AssertResult::FAIL, "FloatZero->less(FloatZero)");
+    doOpReturningBoolAndCompareResult(FloatZero, FloatOne, OpReturningBool::less, true, AssertResult::PASS, "FloatZero->less(FloatOne)");
+    doOpReturningBoolAndCompareResult(FloatZero, FloatTwo, OpReturningBool::less, true, AssertResult::PASS, "FloatZero->less(FloatTwo)");
+    doOpReturningBoolAndCompareResult(FloatZero, FloatTwo2, OpReturningBool::less, true, AssertResult::PASS, "FloatZero->less(FloatTwo2)");
+    doOpReturningBoolAndCompareResult(FloatZero, Float2_5, OpReturningBool::less, true, AssertResult::PASS, "FloatZero->less(Float2_5)");
+    doOpReturningBoolAndCompareResult(FloatZero, Float_23_74, OpReturningBool::less, false, AssertResult::FAIL, "FloatZero->less(Float_23_74)");
+    doOpReturningBoolAndCompareResult(FloatZero, StrEmpty, OpReturningBool::less, false, AssertResult::EXCEPTION, "FloatZero->less(StrEmpty)");
+    doOpReturningBoolAndCompareResult(FloatZero, StrEmpty2, OpReturningBool::less, false, AssertResult::EXCEPTION, "FloatZero->less(StrEmpty2)");
+    doOpReturningBoolAndCompareResult(FloatZero, StrA, OpReturningBool::less, false, AssertResult::EXCEPTION, "FloatZero->less(StrA)");
+    doOpReturningBoolAndCompareResult(FloatZero, StrA2, OpReturningBool::less, false, AssertResult::EXCEPTION, "FloatZero->less(StrA2)");
+    doOpReturningBoolAndCompareResult(FloatZero, StrB, OpReturningBool::less, false, AssertResult::EXCEPTION, "FloatZero->less(StrB)");
+    doOpReturningBoolAndCompareResult(FloatZero, ListEmpty, OpReturningBool::less, false, AssertResult::EXCEPTION, "FloatZero->less(ListEmpty)");
+    doOpReturningBoolAndCompareResult(FloatZero, ListEmpty2, OpReturningBool::less, false, AssertResult::EXCEPTION, "FloatZero->less(ListEmpty2)");
+    doOpReturningBoolAndCompareResult(FloatOne, None, OpReturningBool::less, false, AssertResult::EXCEPTION, "FloatOne->less(None)");
+    doOpReturningBoolAndCompareResult(FloatOne, None2, OpReturningBool::less, false, AssertResult::EXCEPTION, "FloatOne->less(None2)");
+    doOpReturningBoolAndCompareResult(FloatOne, False, OpReturningBool::less, false, AssertResult::FAIL, "FloatOne->less(False)");
+    doOpReturningBoolAndCompareResult(FloatOne, False2, OpReturningBool::less, false, AssertResult::FAIL, "FloatOne->less(False2)");
+    doOpReturningBoolAndCompareResult(FloatOne, True, OpReturningBool::less, false, AssertResult::FAIL, "FloatOne->less(True)");
+    doOpReturningBoolAndCompareResult(FloatOne, True2, OpReturningBool::less, false, AssertResult::FAIL, "FloatOne->less(True2)");
+    doOpReturningBoolAndCompareResult(FloatOne, IntZero, OpReturningBool::less, false, AssertResult::FAIL, "FloatOne->less(IntZero)");
+    doOpReturningBoolAndCompareResult(FloatOne, IntOne, OpReturningBool::less, false, AssertResult::FAIL, "FloatOne->less(IntOne)");
+    doOpReturningBoolAndCompareResult(FloatOne, IntTwo, OpReturningBool::less, true, AssertResult::PASS, "FloatOne->less(IntTwo)");
+    doOpReturningBoolAndCompareResult(FloatOne, IntTwo2, OpReturningBool::less, true, AssertResult::PASS, "FloatOne->less(IntTwo2)");
+    doOpReturningBoolAndCompareResult(FloatOne, Int8, OpReturningBool::less, true, AssertResult::PASS, "FloatOne->less(Int8)");
+    doOpReturningBoolAndCompareResult(FloatOne, IntMinusOne, OpReturningBool::less, false, AssertResult::FAIL, "FloatOne->less(IntMinusOne)");
+    doOpReturningBoolAndCompareResult(FloatOne, IntMinusOne2, OpReturningBool::less, false, AssertResult::FAIL, "FloatOne->less(IntMinusOne2)");
+    doOpReturningBoolAndCompareResult(FloatOne, IntMinus12, OpReturningBool::less, false, AssertResult::FAIL, "FloatOne->less(IntMinus12)");
+    doOpReturningBoolAndCompareResult(FloatOne, IntMinus73, OpReturningBool::less, false, AssertResult::FAIL, "FloatOne->less(IntMinus73)");
+    doOpReturningBoolAndCompareResult(FloatOne, FloatMinusOne, OpReturningBool::less, false, AssertResult::FAIL, "FloatOne->less(FloatMinusOne)");
+    doOpReturningBoolAndCompareResult(FloatOne, FloatZero, OpReturningBool::less, false, AssertResult::FAIL, "FloatOne->less(FloatZero)");
+    doOpReturningBoolAndCompareResult(FloatOne, FloatOne, OpReturningBool::less, false, AssertResult::FAIL, "FloatOne->less(FloatOne)");
+    doOpReturningBoolAndCompareResult(FloatOne, FloatTwo, OpReturningBool::less, true, AssertResult::PASS, "FloatOne->less(FloatTwo)");
+    doOpReturningBoolAndCompareResult(FloatOne, FloatTwo2, OpReturningBool::less, true, AssertResult::PASS, "FloatOne->less(FloatTwo2)");
+    doOpReturningBoolAndCompareResult(FloatOne, Float2_5, OpReturningBool::less, true, AssertResult::PASS, "FloatOne->less(Float2_5)");
+    doOpReturningBoolAndCompareResult(FloatOne, Float_23_74, OpReturningBool::less, false, AssertResult::FAIL, "FloatOne->less(Float_23_74)");
+    doOpReturningBoolAndCompareResult(FloatOne, StrEmpty, OpReturningBool::less, false, AssertResult::EXCEPTION, "FloatOne->less(StrEmpty)");
+    doOpReturningBoolAndCompareResult(FloatOne, StrEmpty2, OpReturningBool::less, false, AssertResult::EXCEPTION, "FloatOne->less(StrEmpty2)");
+    doOpReturningBoolAndCompareResult(FloatOne, StrA, OpReturningBool::less, false, AssertResult::EXCEPTION, "FloatOne->less(StrA)");
+    doOpReturningBoolAndCompareResult(FloatOne, StrA2, OpReturningBool::less, false, AssertResult::EXCEPTION, "FloatOne->less(StrA2)");
+    doOpReturningBoolAndCompareResult(FloatOne, StrB, OpReturningBool::less, false, AssertResult::EXCEPTION, "FloatOne->less(StrB)");
+    doOpReturningBoolAndCompareResult(FloatOne, ListEmpty, OpReturningBool::less, false, AssertResult::EXCEPTION, "FloatOne->less(ListEmpty)");
+    doOpReturningBoolAndCompareResult(FloatOne, ListEmpty2, OpReturningBool::less, false, AssertResult::EXCEPTION, "FloatOne->less(ListEmpty2)");
+    doOpReturningBoolAndCompareResult(FloatTwo, None, OpReturningBool::less, false, AssertResult::EXCEPTION, "FloatTwo->less(None)");
+    doOpReturningBoolAndCompareResult(FloatTwo, None2, OpReturningBool::less, false, AssertResult::EXCEPTION, "FloatTwo->less(None2)");
+    doOpReturningBoolAndCompareResult(FloatTwo, False, OpReturningBool::less, false, AssertResult::FAIL, "FloatTwo->less(False)");
+    doOpReturningBoolAndCompareResult(FloatTwo, False2, OpReturningBool::less, false, AssertResult::FAIL, "FloatTwo->less(False2)");
+    doOpReturningBoolAndCompareResult(FloatTwo, True, OpReturningBool::less, false, AssertResult::FAIL, "FloatTwo->less(True)");
+    doOpReturningBoolAndCompareResult(FloatTwo, True2, OpReturningBool::less, false, AssertResult::FAIL, "FloatTwo->less(True2)");
+    doOpReturningBoolAndCompareResult(FloatTwo, IntZero, OpReturningBool::less, false, AssertResult::FAIL, "FloatTwo->less(IntZero)");
+    doOpReturningBoolAndCompareResult(FloatTwo, IntOne, OpReturningBool::less, false, AssertResult::FAIL, "FloatTwo->less(IntOne)");
+    doOpReturningBoolAndCompareResult(FloatTwo, IntTwo, OpReturningBool::less, false, AssertResult::FAIL, "FloatTwo->less(IntTwo)");
+    doOpReturningBoolAndCompareResult(FloatTwo, IntTwo2, OpReturningBool::less, false, AssertResult::FAIL, "FloatTwo->less(IntTwo2)");
+    doOpReturningBoolAndCompareResult(FloatTwo, Int8, OpReturningBool::less, true, AssertResult::PASS, "FloatTwo->less(Int8)");
+    doOpReturningBoolAndCompareResult(FloatTwo, IntMinusOne, OpReturningBool::less, false, AssertResult::FAIL, "FloatTwo->less(IntMinusOne)");
+    doOpReturningBoolAndCompareResult(FloatTwo, IntMinusOne2, OpReturningBool::less, false, AssertResult::FAIL, "FloatTwo->less(IntMinusOne2)");
+    doOpReturningBoolAndCompareResult(FloatTwo, IntMinus12, OpReturningBool::less, false, AssertResult::FAIL, "FloatTwo->less(IntMinus12)");
+    doOpReturningBoolAndCompareResult(FloatTwo, IntMinus73, OpReturningBool::less, false, AssertResult::FAIL, "FloatTwo->less(IntMinus73)");
+    doOpReturningBoolAndCompareResult(FloatTwo, FloatMinusOne, OpReturningBool::less, false, AssertResult::FAIL, "FloatTwo->less(FloatMinusOne)");
+    doOpReturningBoolAndCompareResult(FloatTwo, FloatZero, OpReturningBool::less, false, AssertResult::FAIL, "FloatTwo->less(FloatZero)");
+    doOpReturningBoolAndCompareResult(FloatTwo, FloatOne, OpReturningBool::less, false, AssertResult::FAIL, "FloatTwo->less(FloatOne)");
+    doOpReturningBoolAndCompareResult(FloatTwo, FloatTwo, OpReturningBool::less, false, AssertResult::FAIL, "FloatTwo->less(FloatTwo)");
+    doOpReturningBoolAndCompareResult(FloatTwo, FloatTwo2, OpReturningBool::less, false, AssertResult::FAIL, "FloatTwo->less(FloatTwo2)");
+    doOpReturningBoolAndCompareResult(FloatTwo, Float2_5, OpReturningBool::less, true, AssertResult::PASS, "FloatTwo->less(Float2_5)");
+    doOpReturningBoolAndCompareResult(FloatTwo, Float_23_74, OpReturningBool::less, false, AssertResult::FAIL, "FloatTwo->less(Float_23_74)");
+    doOpReturningBoolAndCompareResult(FloatTwo, StrEmpty, OpReturningBool::less, false, AssertResult::EXCEPTION, "FloatTwo->less(StrEmpty)");
+    doOpReturningBoolAndCompareResult(FloatTwo, StrEmpty2, OpReturningBool::less, false, AssertResult::EXCEPTION, "FloatTwo->less(StrEmpty2)");
+    doOpReturningBoolAndCompareResult(FloatTwo, StrA, OpReturningBool::less, false, AssertResult::EXCEPTION, "FloatTwo->less(StrA)");
+    doOpReturningBoolAndCompareResult(FloatTwo, StrA2, OpReturningBool::less, false, AssertResult::EXCEPTION, "FloatTwo->less(StrA2)");
+    doOpReturningBoolAndCompareResult(FloatTwo, StrB, OpReturningBool::less, false, AssertResult::EXCEPTION, "FloatTwo->less(StrB)");
+    doOpReturningBoolAndCompareResult(FloatTwo, ListEmpty, OpReturningBool::less, false, AssertResult::EXCEPTION, "FloatTwo->less(ListEmpty)");
+    doOpReturningBoolAndCompareResult(FloatTwo, ListEmpty2, OpReturningBool::less, false, AssertResult::EXCEPTION, "FloatTwo->less(ListEmpty2)");
+    doOpReturningBoolAndCompareResult(FloatTwo2, None, OpReturningBool::less, false, AssertResult::EXCEPTION, "FloatTwo2->less(None)");
+    doOpReturningBoolAndCompareResult(FloatTwo2, None2, OpReturningBool::less, false, AssertResult::EXCEPTION, "FloatTwo2->less(None2)");
+    doOpReturningBoolAndCompareResult(FloatTwo2, False, OpReturningBool::less, false, AssertResult::FAIL, "FloatTwo2->less(False)");
+    doOpReturningBoolAndCompareResult(FloatTwo2, False2, OpReturningBool::less, false, AssertResult::FAIL, "FloatTwo2->less(False2)");
+    doOpReturningBoolAndCompareResult(FloatTwo2, True, OpReturningBool::less, false, AssertResult::FAIL, "FloatTwo2->less(True)");
+    doOpReturningBoolAndCompareResult(FloatTwo2, True2, OpReturningBool::less, false, AssertResult::FAIL, "FloatTwo2->less(True2)");
+    doOpReturningBoolAndCompareResult(FloatTwo2, IntZero, OpReturningBool::less, false, AssertResult::FAIL, "FloatTwo2->less(IntZero)");
+    doOpReturningBoolAndCompareResult(FloatTwo2, IntOne, OpReturningBool::less, false, AssertResult::FAIL, "FloatTwo2->less(IntOne)");
+    doOpReturningBoolAndCompareResult(FloatTwo2, IntTwo, OpReturningBool::less, false, AssertResult::FAIL, "FloatTwo2->less(IntTwo)");
+    doOpReturningBoolAndCompareResult(FloatTwo2, IntTwo2, OpReturningBool::less, false, AssertResult::FAIL, "FloatTwo2->less(IntTwo2)");
+    doOpReturningBoolAndCompareResult(FloatTwo2, Int8, OpReturningBool::less, true, AssertResult::PASS, "FloatTwo2->less(Int8)");
+    doOpReturningBoolAndCompareResult(FloatTwo2, IntMinusOne, OpReturningBool::less, false, AssertResult::FAIL, "FloatTwo2->less(IntMinusOne)");
+    doOpReturningBoolAndCompareResult(FloatTwo2, IntMinusOne2, OpReturningBool::less, false, AssertResult::FAIL, "FloatTwo2->less(IntMinusOne2)");
+    doOpReturningBoolAndCompareResult(FloatTwo2, IntMinus12, OpReturningBool::less, false, AssertResult::FAIL, "FloatTwo2->less(IntMinus12)");
+    doOpReturningBoolAndCompareResult(FloatTwo2, IntMinus73, OpReturningBool::less, false, AssertResult::FAIL, "FloatTwo2->less(IntMinus73)");
+    doOpReturningBoolAndCompareResult(FloatTwo2, FloatMinusOne, OpReturningBool::less, false, AssertResult::FAIL, "FloatTwo2->less(FloatMinusOne)");
+    doOpReturningBoolAndCompareResult(FloatTwo2, FloatZero, OpReturningBool::less, false, AssertResult::FAIL, "FloatTwo2->less(FloatZero)");
+    doOpReturningBoolAndCompareResult(FloatTwo2, FloatOne, OpReturningBool::less, false, AssertResult::FAIL, "FloatTwo2->less(FloatOne)");
+    doOpReturningBoolAndCompareResult(FloatTwo2, FloatTwo, OpReturningBool::less, false, AssertResult::FAIL, "FloatTwo2->less(FloatTwo)");
+    doOpReturningBoolAndCompareResult(FloatTwo2, FloatTwo2, OpReturningBool::less, false, AssertResult::FAIL, "FloatTwo2->less(FloatTwo2)");
+    doOpReturningBoolAndCompareResult(FloatTwo2, Float2_5, OpReturningBool::less, true, AssertResult::PASS, "FloatTwo2->less(Float2_5)");
+    doOpReturningBoolAndCompareResult(FloatTwo2, Float_23_74, OpReturningBool::less, false, AssertResult::FAIL, "FloatTwo2->less(Float_23_74)");
+    doOpReturningBoolAndCompareResult(FloatTwo2, StrEmpty, OpReturningBool::less, false, AssertResult::EXCEPTION, "FloatTwo2->less(StrEmpty)");
+    doOpReturningBoolAndCompareResult(FloatTwo2, StrEmpty2, OpReturningBool::less, false, AssertResult::EXCEPTION, "FloatTwo2->less(StrEmpty2)");
+    doOpReturningBoolAndCompareResult(FloatTwo2, StrA, OpReturningBool::less, false, AssertResult::EXCEPTION, "FloatTwo2->less(StrA)");
+    doOpReturningBoolAndCompareResult(FloatTwo2, StrA2, OpReturningBool::less, false, AssertResult::EXCEPTION, "FloatTwo2->less(StrA2)");
+    doOpReturningBoolAndCompareResult(FloatTwo2, StrB, OpReturningBool::less, false, AssertResult::EXCEPTION, "FloatTwo2->less(StrB)");
+    doOpReturningBoolAndCompareResult(FloatTwo2, ListEmpty, OpReturningBool::less, false, AssertResult::EXCEPTION, "FloatTwo2->less(ListEmpty)");
+    doOpReturningBoolAndCompareResult(FloatTwo2, ListEmpty2, OpReturningBool::less, false, AssertResult::EXCEPTION, "FloatTwo2->less(ListEmpty2)");
+    doOpReturningBoolAndCompareResult(Float2_5, None, OpReturningBool::less, false, AssertResult::EXCEPTION, "Float2_5->less(None)");
+    doOpReturningBoolAndCompareResult(Float2_5, None2, OpReturningBool::less, false, AssertResult::EXCEPTION, "Float2_5->less(None2)");
+    doOpReturningBoolAndCompareResult(Float2_5, False, OpReturningBool::less, false, AssertResult::FAIL, "Float2_5->less(False)");
+    doOpReturningBoolAndCompareResult(Float2_5, False2, OpReturningBool::less, false, AssertResult::FAIL, "Float2_5->less(False2)");
+    doOpReturningBoolAndCompareResult(Float2_5, True, OpReturningBool::less, false, AssertResult::FAIL, "Float2_5->less(True)");
+    doOpReturningBoolAndCompareResult(Float2_5, True2, OpReturningBool::less, false, AssertResult::FAIL, "Float2_5->less(True2)");
+    doOpReturningBoolAndCompareResult(Float2_5, IntZero, OpReturningBool::less, false, AssertResult::FAIL, "Float2_5->less(IntZero)");
+    doOpReturningBoolAndCompareResult(Float2_5, IntOne, OpReturningBool::less, false, AssertResult::FAIL, "Float2_5->less(IntOne)");
+    doOpReturningBoolAndCompareResult(Float2_5, IntTwo, OpReturningBool::less, false, AssertResult::FAIL, "Float2_5->less(IntTwo)");
+    doOpReturningBoolAndCompareResult(Float2_5, IntTwo2, OpReturningBool::less, false, AssertResult::FAIL, "Float2_5->less(IntTwo2)");
+    doOpReturningBoolAndCompareResult(Float2_5, Int8, OpReturningBool::less, true, AssertResult::PASS, "Float2_5->less(Int8)");
+    doOpReturningBoolAndCompareResult(Float2_5, IntMinusOne, OpReturningBool::less, false, AssertResult::FAIL, "Float2_5->less(IntMinusOne)");
+    doOpReturningBoolAndCompareResult(Float2_5, IntMinusOne2, OpReturningBool::less, false, AssertResult::FAIL, "Float2_5->less(IntMinusOne2)");
+    doOpReturningBoolAndCompareResult(Float2_5, IntMinus12, OpReturningBool::less, false, AssertResult::FAIL, "Float2_5->less(IntMinus12)");
+    doOpReturningBoolAndCompareResult(Float2_5, IntMinus73, OpReturningBool::less, false, AssertResult::FAIL, "Float2_5->less(IntMinus73)");
+    doOpReturningBoolAndCompareResult(Float2_5, FloatMinusOne, OpReturningBool::less, false, AssertResult::FAIL, "Float2_5->less(FloatMinusOne)");
+    doOpReturningBoolAndCompareResult(Float2_5, FloatZero, OpReturningBool::less, false, AssertResult::FAIL, "Float2_5->less(FloatZero)");
+    doOpReturningBoolAndCompareResult(Float2_5, FloatOne, OpReturningBool::less, false, AssertResult::FAIL, "Float2_5->less(FloatOne)");
+    doOpReturningBoolAndCompareResult(Float2_5, FloatTwo, OpReturningBool::less, false, AssertResult::FAIL, "Float2_5->less(FloatTwo)");
+    doOpReturningBoolAndCompareResult(Float2_5, FloatTwo2, OpReturningBool::less, false, AssertResult::FAIL, "Float2_5->less(FloatTwo2)");
+    doOpReturningBoolAndCompareResult(Float2_5, Float2_5, OpReturningBool::less, false, AssertResult::FAIL, "Float2_5->less(Float2_5)");
+    doOpReturningBoolAndCompareResult(Float2_5, Float_23_74, OpReturningBool::less, false, AssertResult::FAIL, "Float2_5->less(Float_23_74)");
+    doOpReturningBoolAndCompareResult(Float2_5, StrEmpty, OpReturningBool::less, false, AssertResult::EXCEPTION, "Float2_5->less(StrEmpty)");
+    doOpReturningBoolAndCompareResult(Float2_5, StrEmpty2, OpReturningBool::less, false, AssertResult::EXCEPTION, "Float2_5->less(StrEmpty2)");
+    doOpReturningBoolAndCompareResult(Float2_5, StrA, OpReturningBool::less, false, AssertResult::EXCEPTION, "Float2_5->less(StrA)");
+    doOpReturningBoolAndCompareResult(Float2_5, StrA2, OpReturningBool::less, false, AssertResult::EXCEPTION, "Float2_5->less(StrA2)");
+    doOpReturningBoolAndCompareResult(Float2_5, StrB, OpReturningBool::less, false, AssertResult::EXCEPTION, "Float2_5->less(StrB)");
+    doOpReturningBoolAndCompareResult(Float2_5, ListEmpty, OpReturningBool::less, false, AssertResult::EXCEPTION, "Float2_5->less(ListEmpty)");
+    doOpReturningBoolAndCompareResult(Float2_5, ListEmpty2, OpReturningBool::less, false, AssertResult::EXCEPTION, "Float2_5->less(ListEmpty2)");
+    doOpReturningBoolAndCompareResult(Float_23_74, None, OpReturningBool::less, false, AssertResult::EXCEPTION, "Float_23_74->less(None)");
+    doOpReturningBoolAndCompareResult(Float_23_74, None2, OpReturningBool::less, false, AssertResult::EXCEPTION, "Float_23_74->less(None2)");
+    doOpReturningBoolAndCompareResult(Float_23_74, False, OpReturningBool::less, true, AssertResult::PASS, "Float_23_74->less(False)");
+    doOpReturningBoolAndCompareResult(Float_23_74, False2, OpReturningBool::less, true, AssertResult::PASS, "Float_23_74->less(False2)");
+    doOpReturningBoolAndCompareResult(Float_23_74, True, OpReturningBool::less, true, AssertResult::PASS, "Float_23_74->less(True)");
+    doOpReturningBoolAndCompareResult(Float_23_74, True2, OpReturningBool::less, true, AssertResult::PASS, "Float_23_74->less(True2)");
+    doOpReturningBoolAndCompareResult(Float_23_74, IntZero, OpReturningBool::less, true, AssertResult::PASS, "Float_23_74->less(IntZero)");
+    doOpReturningBoolAndCompareResult(Float_23_74, IntOne, OpReturningBool::less, true, AssertResult::PASS, "Float_23_74->less(IntOne)");
+    doOpReturningBoolAndCompareResult(Float_23_74, IntTwo, OpReturningBool::less, true, AssertResult::PASS, "Float_23_74->less(IntTwo)");
+    doOpReturningBoolAndCompareResult(Float_23_74, IntTwo2, OpReturningBool::less, true, AssertResult::PASS, "Float_23_74->less(IntTwo2)");
+    doOpReturningBoolAndCompareResult(Float_23_74, Int8, OpReturningBool::less, true, AssertResult::PASS, "Float_23_74->less(Int8)");
+    doOpReturningBoolAndCompareResult(Float_23_74, IntMinusOne, OpReturningBool::less, true, AssertResult::PASS, "Float_23_74->less(IntMinusOne)");
+    doOpReturningBoolAndCompareResult(Float_23_74, IntMinusOne2, OpReturningBool::less, true, AssertResult::PASS, "Float_23_74->less(IntMinusOne2)");
+    doOpReturningBoolAndCompareResult(Float_23_74, IntMinus12, OpReturningBool::less, true, AssertResult::PASS, "Float_23_74->less(IntMinus12)");
+    doOpReturningBoolAndCompareResult(Float_23_74, IntMinus73, OpReturningBool::less, false, AssertResult::FAIL, "Float_23_74->less(IntMinus73)");
+    doOpReturningBoolAndCompareResult(Float_23_74, FloatMinusOne, OpReturningBool::less, true, AssertResult::PASS, "Float_23_74->less(FloatMinusOne)");
+    doOpReturningBoolAndCompareResult(Float_23_74, FloatZero, OpReturningBool::less, true, AssertResult::PASS, "Float_23_74->less(FloatZero)");
+    doOpReturningBoolAndCompareResult(Float_23_74, FloatOne, OpReturningBool::less, true, AssertResult::PASS, "Float_23_74->less(FloatOne)");
+    doOpReturningBoolAndCompareResult(Float_23_74, FloatTwo, OpReturningBool::less, true, AssertResult::PASS, "Float_23_74->less(FloatTwo)");
+    doOpReturningBoolAndCompareResult(Float_23_74, FloatTwo2, OpReturningBool::less, true, AssertResult::PASS, "Float_23_74->less(FloatTwo2)");
+    doOpReturningBoolAndCompareResult(Float_23_74, Float2_5, OpReturningBool::less, true, AssertResult::PASS, "Float_23_74->less(Float2_5)");
+    doOpReturningBoolAndCompareResult(Float_23_74, Float_23_74, OpReturningBool::less, false, AssertResult::FAIL, "Float_23_74->less(Float_23_74)");
+    doOpReturningBoolAndCompareResult(Float_23_74, StrEmpty, OpReturningBool::less, false, AssertResult::EXCEPTION, "Float_23_74->less(StrEmpty)");
+    doOpReturningBoolAndCompareResult(Float_23_74, StrEmpty2, OpReturningBool::less, false, AssertResult::EXCEPTION, "Float_23_74->less(StrEmpty2)");
+    doOpReturningBoolAndCompareResult(Float_23_74, StrA, OpReturningBool::less, false, AssertResult::EXCEPTION, "Float_23_74->less(StrA)");
+    doOpReturningBoolAndCompareResult(Float_23_74, StrA2, OpReturningBool::less, false, AssertResult::EXCEPTION, "Float_23_74->less(StrA2)");
+    doOpReturningBoolAndCompareResult(Float_23_74, StrB, OpReturningBool::less, false, AssertResult::EXCEPTION, "Float_23_74->less(StrB)");
+    doOpReturningBoolAndCompareResult(Float_23_74, ListEmpty, OpReturningBool::less, false, AssertResult::EXCEPTION, "Float_23_74->less(ListEmpty)");
+    doOpReturningBoolAndCompareResult(Float_23_74, ListEmpty2, OpReturningBool::less, false, AssertResult::EXCEPTION, "Float_23_74->less(ListEmpty2)");
+    doOpReturningBoolAndCompareResult(StrEmpty, None, OpReturningBool::less, false, AssertResult::EXCEPTION, "StrEmpty->less(None)");
+    doOpReturningBoolAndCompareResult(StrEmpty, None2, OpReturningBool::less, false, AssertResult::EXCEPTION, "StrEmpty->less(None2)");
+    doOpReturningBoolAndCompareResult(StrEmpty, False, OpReturningBool::less, false, AssertResult::EXCEPTION, "StrEmpty->less(False)");
+    doOpReturningBoolAndCompareResult(StrEmpty, False2, OpReturningBool::less, false, AssertResult::EXCEPTION, "StrEmpty->less(False2)");
+    doOpReturningBoolAndCompareResult(StrEmpty, True, OpReturningBool::less, false, AssertResult::EXCEPTION, "StrEmpty->less(True)");
+    doOpReturningBoolAndCompareResult(StrEmpty, True2, OpReturningBool::less, false, AssertResult::EXCEPTION, "StrEmpty->less(True2)");
+    doOpReturningBoolAndCompareResult(StrEmpty, IntZero, OpReturningBool::less, false, AssertResult::EXCEPTION, "StrEmpty->less(IntZero)");
+    doOpReturningBoolAndCompareResult(StrEmpty, IntOne, OpReturningBool::less, false, AssertResult::EXCEPTION, "StrEmpty->less(IntOne)");
+    doOpReturningBoolAndCompareResult(StrEmpty, IntTwo, OpReturningBool::less, false, AssertResult::EXCEPTION, "StrEmpty->less(IntTwo)");
+    doOpReturningBoolAndCompareResult(StrEmpty, IntTwo2, OpReturningBool::less, false, AssertResult::EXCEPTION, "StrEmpty->less(IntTwo2)");
+    doOpReturningBoolAndCompareResult(StrEmpty, Int8, OpReturningBool::less, false, AssertResult::EXCEPTION, "StrEmpty->less(Int8)");
+    doOpReturningBoolAndCompareResult(StrEmpty, IntMinusOne, OpReturningBool::less, false, AssertResult::EXCEPTION, "StrEmpty->less(IntMinusOne)");
+    doOpReturningBoolAndCompareResult(StrEmpty, IntMinusOne2, OpReturningBool::less, false, AssertResult::EXCEPTION, "StrEmpty->less(IntMinusOne2)");
+    doOpReturningBoolAndCompareResult(StrEmpty, IntMinus12, OpReturningBool::less, false, AssertResult::EXCEPTION, "StrEmpty->less(IntMinus12)");
+    doOpReturningBoolAndCompareResult(StrEmpty, IntMinus73, OpReturningBool::less, false, AssertResult::EXCEPTION, "StrEmpty->less(IntMinus73)");
+    doOpReturningBoolAndCompareResult(StrEmpty, FloatMinusOne, OpReturningBool::less, false, AssertResult::EXCEPTION, "StrEmpty->less(FloatMinusOne)");
+    doOpReturningBoolAndCompareResult(StrEmpty, FloatZero, OpReturningBool::less, false, AssertResult::EXCEPTION, "StrEmpty->less(FloatZero)");
+    doOpReturningBoolAndCompareResult(StrEmpty, FloatOne, OpReturningBool::less, false, AssertResult::EXCEPTION, "StrEmpty->less(FloatOne)");
+    doOpReturningBoolAndCompareResult(StrEmpty, FloatTwo, OpReturningBool::less, false, AssertResult::EXCEPTION, "StrEmpty->less(FloatTwo)");
+    doOpReturningBoolAndCompareResult(StrEmpty, FloatTwo2, OpReturningBool::less, false, AssertResult::EXCEPTION, "StrEmpty->less(FloatTwo2)");
+    doOpReturningBoolAndCompareResult(StrEmpty, Float2_5, OpReturningBool::less, false, AssertResult::EXCEPTION, "StrEmpty->less(Float2_5)");
+    doOpReturningBoolAndCompareResult(StrEmpty, Float_23_74, OpReturningBool::less, false, AssertResult::EXCEPTION, "StrEmpty->less(Float_23_74)");
+    doOpReturningBoolAndCompareResult(StrEmpty, StrEmpty, OpReturningBool::less, false, AssertResult::FAIL, "StrEmpty->less(StrEmpty)");
+    doOpReturningBoolAndCompareResult(StrEmpty, StrEmpty2, OpReturningBool::less, false, AssertResult::FAIL, "StrEmpty->less(StrEmpty2)");
+    doOpReturningBoolAndCompareResult(StrEmpty, StrA, OpReturningBool::less, true, AssertResult::PASS, "StrEmpty->less(StrA)");
+    doOpReturningBoolAndCompareResult(StrEmpty, StrA2, OpReturningBool::less, true, AssertResult::PASS, "StrEmpty->less(StrA2)");
+    doOpReturningBoolAndCompareResult(StrEmpty, StrB, OpReturningBool::less, true, AssertResult::PASS, "StrEmpty->less(StrB)");
+    doOpReturningBoolAndCompareResult(StrEmpty, ListEmpty, OpReturningBool::less, false, AssertResult::EXCEPTION, "StrEmpty->less(ListEmpty)");
+    doOpReturningBoolAndCompareResult(StrEmpty, ListEmpty2, OpReturningBool::less, false, AssertResult::EXCEPTION, "StrEmpty->less(ListEmpty2)");
+    doOpReturningBoolAndCompareResult(StrEmpty2, None, OpReturningBool::less, false, AssertResult::EXCEPTION, "StrEmpty2->less(None)");
+    doOpReturningBoolAndCompareResult(StrEmpty2, None2, OpReturningBool::less, false, AssertResult::EXCEPTION, "StrEmpty2->less(None2)");
+    doOpReturningBoolAndCompareResult(StrEmpty2, False, OpReturningBool::less, false, AssertResult::EXCEPTION, "StrEmpty2->less(False)");
+    doOpReturningBoolAndCompareResult(StrEmpty2, False2, OpReturningBool::less, false, AssertResult::EXCEPTION, "StrEmpty2->less(False2)");
+    doOpReturningBoolAndCompareResult(StrEmpty2, True, OpReturningBool::less, false, AssertResult::EXCEPTION, "StrEmpty2->less(True)");
+    doOpReturningBoolAndCompareResult(StrEmpty2, True2, OpReturningBool::less, false, AssertResult::EXCEPTION, "StrEmpty2->less(True2)");
+    doOpReturningBoolAndCompareResult(StrEmpty2, IntZero, OpReturningBool::less, false, AssertResult::EXCEPTION, "StrEmpty2->less(IntZero)");
+    doOpReturningBoolAndCompareResult(StrEmpty2, IntOne, OpReturningBool::less, false, AssertResult::EXCEPTION, "StrEmpty2->less(IntOne)");
+    doOpReturningBoolAndCompareResult(StrEmpty2, IntTwo, OpReturningBool::less, false, AssertResult::EXCEPTION, "StrEmpty2->less(IntTwo)");
+    doOpReturningBoolAndCompareResult(StrEmpty2, IntTwo2, OpReturningBool::less, false, AssertResult::EXCEPTION, "StrEmpty2->less(IntTwo2)");
+    doOpReturningBoolAndCompareResult(StrEmpty2, Int8, OpReturningBool::less, false, AssertResult::EXCEPTION, "StrEmpty2->less(Int8)");
+    doOpReturningBoolAndCompareResult(StrEmpty2, IntMinusOne, OpReturningBool::less, false, AssertResult::EXCEPTION, "StrEmpty2->less(IntMinusOne)");
+    doOpReturningBoolAndCompareResult(StrEmpty2, IntMinusOne2, OpReturningBool::less, false, AssertResult::EXCEPTION, "StrEmpty2->less(IntMinusOne2)");
+    doOpReturningBoolAndCompareResult(StrEmpty2, IntMinus12, OpReturningBool::less, false, AssertResult::EXCEPTION, "StrEmpty2->less(IntMinus12)");
+    doOpReturningBoolAndCompareResult(StrEmpty2, IntMinus73, OpReturningBool::less, false, AssertResult::EXCEPTION, "StrEmpty2->less(IntMinus73)");
+    doOpReturningBoolAndCompareResult(StrEmpty2, FloatMinusOne, OpReturningBool::less, false, AssertResult::EXCEPTION, "StrEmpty2->less(FloatMinusOne)");
+    doOpReturningBoolAndCompareResult(StrEmpty2, FloatZero, OpReturningBool::less, false, AssertResult::EXCEPTION, "StrEmpty2->less(FloatZero)");
+    doOpReturningBoolAndCompareResult(StrEmpty2, FloatOne, OpReturningBool::less, false, AssertResult::EXCEPTION, "StrEmpty2->less(FloatOne)");
+    doOpReturningBoolAndCompareResult(StrEmpty2, FloatTwo, OpReturningBool::less, false, AssertResult::EXCEPTION, "StrEmpty2->less(FloatTwo)");
+    doOpReturningBoolAndCompareResult(StrEmpty2, FloatTwo2, OpReturningBool::less, false, AssertResult::EXCEPTION, "StrEmpty2->less(FloatTwo2)");
+    doOpReturningBoolAndCompareResult(StrEmpty2, Float2_5, OpReturningBool::less, false, AssertResult::EXCEPTION, "StrEmpty2->less(Float2_5)");
+    doOpReturningBoolAndCompareResult(StrEmpty2, Float_23_74, OpReturningBool::less, false, AssertResult::EXCEPTION, "StrEmpty2->less(Float_23_74)");
+    doOpReturningBoolAndCompareResult(StrEmpty2, StrEmpty, OpReturningBool::less, false, AssertResult::FAIL, "StrEmpty2->less(StrEmpty)");
+    doOpReturningBoolAndCompareResult(StrEmpty2, StrEmpty2, OpReturningBool::less, false, AssertResult::FAIL, "StrEmpty2->less(StrEmpty2)");
+    doOpReturningBoolAndCompareResult(StrEmpty2, StrA, OpReturningBool::less, true, AssertResult::PASS, "StrEmpty2->less(StrA)");
+    doOpReturningBoolAndCompareResult(StrEmpty2, StrA2, OpReturningBool::less, true, AssertResult::PASS, "StrEmpty2->less(StrA2)");
+    doOpReturningBoolAndCompareResult(StrEmpty2, StrB, OpReturningBool::less, true, AssertResult::PASS, "StrEmpty2->less(StrB)");
+    doOpReturningBoolAndCompareResult(StrEmpty2, ListEmpty, OpReturningBool::less, false, AssertResult::EXCEPTION, "StrEmpty2->less(ListEmpty)");
+    doOpReturningBoolAndCompareResult(StrEmpty2, ListEmpty2, OpReturningBool::less, false, AssertResult::EXCEPTION, "StrEmpty2->less(ListEmpty2)");
+    doOpReturningBoolAndCompareResult(StrA, None, OpReturningBool::less, false, AssertResult::EXCEPTION, "StrA->less(None)");
+    doOpReturningBoolAndCompareResult(StrA, None2, OpReturningBool::less, false, AssertResult::EXCEPTION, "StrA->less(None2)");
+    doOpReturningBoolAndCompareResult(StrA, False, OpReturningBool::less, false, AssertResult::EXCEPTION, "StrA->less(False)");
+    doOpReturningBoolAndCompareResult(StrA, False2, OpReturningBool::less, false, AssertResult::EXCEPTION, "StrA->less(False2)");
+    doOpReturningBoolAndCompareResult(StrA, True, OpReturningBool::less, false, AssertResult::EXCEPTION, "StrA->less(True)");
+    doOpReturningBoolAndCompareResult(StrA, True2, OpReturningBool::less, false, AssertResult::EXCEPTION, "StrA->less(True2)");
+    doOpReturningBoolAndCompareResult(StrA, IntZero, OpReturningBool::less, false, AssertResult::EXCEPTION, "StrA->less(IntZero)");
+    doOpReturningBoolAndCompareResult(StrA, IntOne, OpReturningBool::less, false, AssertResult::EXCEPTION, "StrA->less(IntOne)");
+    doOpReturningBoolAndCompareResult(StrA, IntTwo, OpReturningBool::less, false, AssertResult::EXCEPTION, "StrA->less(IntTwo)");
+    doOpReturningBoolAndCompareResult(StrA, IntTwo2, OpReturningBool::less, false, AssertResult::EXCEPTION, "StrA->less(IntTwo2)");
+    doOpReturningBoolAndCompareResult(StrA, Int8, OpReturningBool::less, false, AssertResult::EXCEPTION, "StrA->less(Int8)");
+    doOpReturningBoolAndCompareResult(StrA, IntMinusOne, OpReturningBool::less, false, AssertResult::EXCEPTION, "StrA->less(IntMinusOne)");
+    doOpReturningBoolAndCompareResult(StrA, IntMinusOne2, OpReturningBool::less, false, AssertResult::EXCEPTION, "StrA->less(IntMinusOne2)");
+    doOpReturningBoolAndCompareResult(StrA, IntMinus12, OpReturningBool::less, false, AssertResult::EXCEPTION, "StrA->less(IntMinus12)");
+    doOpReturningBoolAndCompareResult(StrA, IntMinus73, OpReturningBool::less, false, AssertResult::EXCEPTION, "StrA->less(IntMinus73)");
+    doOpReturningBoolAndCompareResult(StrA, FloatMinusOne, OpReturningBool::less, false, AssertResult::EXCEPTION, "StrA->less(FloatMinusOne)");
+    doOpReturningBoolAndCompareResult(StrA, FloatZero, OpReturningBool::less, false, AssertResult::EXCEPTION, "StrA->less(FloatZero)");
+    doOpReturningBoolAndCompareResult(StrA, FloatOne, OpReturningBool::less, false, AssertResult::EXCEPTION, "StrA->less(FloatOne)");
+    doOpReturningBoolAndCompareResult(StrA, FloatTwo, OpReturningBool::less, false, AssertResult::EXCEPTION, "StrA->less(FloatTwo)");
+    doOpReturningBoolAndCompareResult(StrA, FloatTwo2, OpReturningBool::less, false, AssertResult::EXCEPTION, "StrA->less(FloatTwo2)");
+    doOpReturningBoolAndCompareResult(StrA, Float2_5, OpReturningBool::less, false, AssertResult::EXCEPTION, "StrA->less(Float2_5)");
+    doOpReturningBoolAndCompareResult(StrA, Float_23_74, OpReturningBool::less, false, AssertResult::EXCEPTION, "StrA->less(Float_23_74)");
+    doOpReturningBoolAndCompareResult(StrA, StrEmpty, OpReturningBool::less, false, AssertResult::FAIL, "StrA->less(StrEmpty)");
+    doOpReturningBoolAndCompareResult(StrA, StrEmpty2, OpReturningBool::less, false, AssertResult::FAIL, "StrA->less(StrEmpty2)");
+    doOpReturningBoolAndCompareResult(StrA, StrA, OpReturningBool::less, false, AssertResult::FAIL, "StrA->less(StrA)");
+    doOpReturningBoolAndCompareResult(StrA, StrA2, OpReturningBool::less, false, AssertResult::FAIL, "StrA->less(StrA2)");
+    doOpReturningBoolAndCompareResult(StrA, StrB, OpReturningBool::less, false, AssertResult::FAIL, "StrA->less(StrB)");
+    doOpReturningBoolAndCompareResult(StrA, ListEmpty, OpReturningBool::less, false, AssertResult::EXCEPTION, "StrA->less(ListEmpty)");
+    doOpReturningBoolAndCompareResult(StrA, ListEmpty2, OpReturningBool::less, false, AssertResult::EXCEPTION, "StrA->less(ListEmpty2)");
+    doOpReturningBoolAndCompareResult(StrA2, None, OpReturningBool::less, false, AssertResult::EXCEPTION, "StrA2->less(None)");
+    doOpReturningBoolAndCompareResult(StrA2, None2, OpReturningBool::less, false, AssertResult::EXCEPTION, "StrA2->less(None2)");
+    doOpReturningBoolAndCompareResult(StrA2, False, OpReturningBool::less, false, AssertResult::EXCEPTION, "StrA2->less(False)");
+    doOpReturningBoolAndCompareResult(StrA2, False2, OpReturningBool::less, false, AssertResult::EXCEPTION, "StrA2->less(False2)");
+    doOpReturningBoolAndCompareResult(StrA2, True, OpReturningBool::less, false, AssertResult::EXCEPTION, "StrA2->less(True)");
+    doOpReturningBoolAndCompareResult(StrA2, True2, OpReturningBool::less, false, AssertResult::EXCEPTION, "StrA2->less(True2)");
+    doOpReturningBoolAndCompareResult(StrA2, IntZero, OpReturningBool::less, false, AssertResult::EXCEPTION, "StrA2->less(IntZero)");
+    doOpReturningBoolAndCompareResult(StrA2, IntOne, OpReturningBool::less, false, AssertResult::EXCEPTION, "StrA2->less(IntOne)");
+    doOpReturningBoolAndCompareResult(StrA2, IntTwo, OpReturningBool::less, false, AssertResult::EXCEPTION, "StrA2->less(IntTwo)");
+    doOpReturningBoolAndCompareResult(StrA2, IntTwo2, OpReturningBool::less, false, AssertResult::EXCEPTION, "StrA2->less(IntTwo2)");
+    doOpReturningBoolAndCompareResult(StrA2, Int8, OpReturningBool::less, false, AssertResult::EXCEPTION, "StrA2->less(Int8)");
+    doOpReturningBoolAndCompareResult(StrA2, IntMinusOne, OpReturningBool::less, false, AssertResult::EXCEPTION, "StrA2->less(IntMinusOne)");
+    doOpReturningBoolAndCompareResult(StrA2, IntMinusOne2, OpReturningBool::less, false, AssertResult::EXCEPTION, "StrA2->less(IntMinusOne2)");
+    doOpReturningBoolAndCompareResult(StrA2, IntMinus12, OpReturningBool::less, false, AssertResult::EXCEPTION, "StrA2->less(IntMinus12)");
+    doOpReturningBoolAndCompareResult(StrA2, IntMinus73, OpReturningBool::less, false, AssertResult::EXCEPTION, "StrA2->less(IntMinus73)");
+    doOpReturningBoolAndCompareResult(StrA2, FloatMinusOne, OpReturningBool::less, false, AssertResult::EXCEPTION, "StrA2->less(FloatMinusOne)");
+    doOpReturningBoolAndCompareResult(StrA2, FloatZero, OpReturningBool::less, false, AssertResult::EXCEPTION, "StrA2->less(FloatZero)");
+    doOpReturningBoolAndCompareResult(StrA2, FloatOne, OpReturningBool::less, false, AssertResult::EXCEPTION, "StrA2->less(FloatOne)");
+    doOpReturningBoolAndCompareResult(StrA2, FloatTwo, OpReturningBool::less, false, AssertResult::EXCEPTION, "StrA2->less(FloatTwo)");
+    doOpReturningBoolAndCompareResult(StrA2, FloatTwo2, OpReturningBool::less, false, AssertResult::EXCEPTION, "StrA2->less(FloatTwo2)");
+    doOpReturningBoolAndCompareResult(StrA2, Float2_5, OpReturningBool::less, false, AssertResult::EXCEPTION, "StrA2->less(Float2_5)");
+    doOpReturningBoolAndCompareResult(StrA2, Float_23_74, OpReturningBool::less, false, AssertResult::EXCEPTION, "StrA2->less(Float_23_74)");
+    doOpReturningBoolAndCompareResult(StrA2, StrEmpty, OpReturningBool::less, false, AssertResult::FAIL, "StrA2->less(StrEmpty)");
+    doOpReturningBoolAndCompareResult(StrA2, StrEmpty2, OpReturningBool::less, false, AssertResult::FAIL, "StrA2->less(StrEmpty2)");
+    doOpReturningBoolAndCompareResult(StrA2, StrA, OpReturningBool::less, false, AssertResult::FAIL, "StrA2->less(StrA)");
+    doOpReturningBoolAndCompareResult(StrA2, StrA2, OpReturningBool::less, false, AssertResult::FAIL, "StrA2->less(StrA2)");
+    doOpReturningBoolAndCompareResult(StrA2, StrB, OpReturningBool::less, false, AssertResult::FAIL, "StrA2->less(StrB)");
+    doOpReturningBoolAndCompareResult(StrA2, ListEmpty, OpReturningBool::less, false, AssertResult::EXCEPTION, "StrA2->less(ListEmpty)");
+    doOpReturningBoolAndCompareResult(StrA2, ListEmpty2, OpReturningBool::less, false, AssertResult::EXCEPTION, "StrA2->less(ListEmpty2)");
+    doOpReturningBoolAndCompareResult(StrB, None, OpReturningBool::less, false, AssertResult::EXCEPTION, "StrB->less(None)");
+    doOpReturningBoolAndCompareResult(StrB, None2, OpReturningBool::less, false, AssertResult::EXCEPTION, "StrB->less(None2)");
+    doOpReturningBoolAndCompareResult(StrB, False, OpReturningBool::less, false, AssertResult::EXCEPTION, "StrB->less(False)");
+    doOpReturningBoolAndCompareResult(StrB, False2, OpReturningBool::less, false, AssertResult::EXCEPTION, "StrB->less(False2)");
+    doOpReturningBoolAndCompareResult(StrB, True, OpReturningBool::less, false, AssertResult::EXCEPTION, "StrB->less(True)");
+    doOpReturningBoolAndCompareResult(StrB, True2, OpReturningBool::less, false, AssertResult::EXCEPTION, "StrB->less(True2)");
+    doOpReturningBoolAndCompareResult(StrB, IntZero, OpReturningBool::less, false, AssertResult::EXCEPTION, "StrB->less(IntZero)");
+    doOpReturningBoolAndCompareResult(StrB, IntOne, OpReturningBool::less, false, AssertResult::EXCEPTION, "StrB->less(IntOne)");
+    doOpReturningBoolAndCompareResult(StrB, IntTwo, OpReturningBool::less, false, AssertResult::EXCEPTION, "StrB->less(IntTwo)");
+    doOpReturningBoolAndCompareResult(StrB, IntTwo2, OpReturningBool::less, false, AssertResult::EXCEPTION, "StrB->less(IntTwo2)");
+    doOpReturningBoolAndCompareResult(StrB, Int8, OpReturningBool::less, false, AssertResult::EXCEPTION, "StrB->less(Int8)");
+    doOpReturningBoolAndCompareResult(StrB, IntMinusOne, OpReturningBool::less, false, AssertResult::EXCEPTION, "StrB->less(IntMinusOne)");
+    doOpReturningBoolAndCompareResult(StrB, IntMinusOne2, OpReturningBool::less, false, AssertResult::EXCEPTION, "StrB->less(IntMinusOne2)");
+    doOpReturningBoolAndCompareResult(StrB, IntMinus12, OpReturningBool::less, false, AssertResult::EXCEPTION, "StrB->less(IntMinus12)");
+    doOpReturningBoolAndCompareResult(StrB, IntMinus73, OpReturningBool::less, false, AssertResult::EXCEPTION, "StrB->less(IntMinus73)");
+    doOpReturningBoolAndCompareResult(StrB, FloatMinusOne, OpReturningBool::less, false, AssertResult::EXCEPTION, "StrB->less(FloatMinusOne)");
+    doOpReturningBoolAndCompareResult(StrB, FloatZero, OpReturningBool::less, false, AssertResult::EXCEPTION, "StrB->less(FloatZero)");
+    doOpReturningBoolAndCompareResult(StrB, FloatOne, OpReturningBool::less, false, AssertResult::EXCEPTION, "StrB->less(FloatOne)");
+    doOpReturningBoolAndCompareResult(StrB, FloatTwo, OpReturningBool::less, false, AssertResult::EXCEPTION, "StrB->less(FloatTwo)");
+    doOpReturningBoolAndCompareResult(StrB, FloatTwo2, OpReturningBool::less, false, AssertResult::EXCEPTION, "StrB->less(FloatTwo2)");
+    doOpReturningBoolAndCompareResult(StrB, Float2_5, OpReturningBool::less, false, AssertResult::EXCEPTION, "StrB->less(Float2_5)");
+    doOpReturningBoolAndCompareResult(StrB, Float_23_74, OpReturningBool::less, false, AssertResult::EXCEPTION, "StrB->less(Float_23_74)");
+    doOpReturningBoolAndCompareResult(StrB, StrEmpty, OpReturningBool::less, false, AssertResult::FAIL, "StrB->less(StrEmpty)");
+    doOpReturningBoolAndCompareResult(StrB, StrEmpty2, OpReturningBool::less, false, AssertResult::FAIL, "StrB->less(StrEmpty2)");
+    doOpReturningBoolAndCompareResult(StrB, StrA, OpReturningBool::less, true, AssertResult::PASS, "StrB->less(StrA)");
+    doOpReturningBoolAndCompareResult(StrB, StrA2, OpReturningBool::less, true, AssertResult::PASS, "StrB->less(StrA2)");
+    doOpReturningBoolAndCompareResult(StrB, StrB, OpReturningBool::less, false, AssertResult::FAIL, "StrB->less(StrB)");
+    doOpReturningBoolAndCompareResult(StrB, ListEmpty, OpReturningBool::less, false, AssertResult::EXCEPTION, "StrB->less(ListEmpty)");
+    doOpReturningBoolAndCompareResult(StrB, ListEmpty2, OpReturningBool::less, false, AssertResult::EXCEPTION, "StrB->less(ListEmpty2)");
+    doOpReturningBoolAndCompareResult(ListEmpty, None, OpReturningBool::less, false, AssertResult::EXCEPTION, "ListEmpty->less(None)");
+    doOpReturningBoolAndCompareResult(ListEmpty, None2, OpReturningBool::less, false, AssertResult::EXCEPTION, "ListEmpty->less(None2)");
+    doOpReturningBoolAndCompareResult(ListEmpty, False, OpReturningBool::less, false, AssertResult::EXCEPTION, "ListEmpty->less(False)");
+    doOpReturningBoolAndCompareResult(ListEmpty, False2, OpReturningBool::less, false, AssertResult::EXCEPTION, "ListEmpty->less(False2)");
+    doOpReturningBoolAndCompareResult(ListEmpty, True, OpReturningBool::less, false, AssertResult::EXCEPTION, "ListEmpty->less(True)");
+    doOpReturningBoolAndCompareResult(ListEmpty, True2, OpReturningBool::less, false, AssertResult::EXCEPTION, "ListEmpty->less(True2)");
+    doOpReturningBoolAndCompareResult(ListEmpty, IntZero, OpReturningBool::less, false, AssertResult::EXCEPTION, "ListEmpty->less(IntZero)");
+    doOpReturningBoolAndCompareResult(ListEmpty, IntOne, OpReturningBool::less, false, AssertResult::EXCEPTION, "ListEmpty->less(IntOne)");
+    doOpReturningBoolAndCompareResult(ListEmpty, IntTwo, OpReturningBool::less, false, AssertResult::EXCEPTION, "ListEmpty->less(IntTwo)");
+    doOpReturningBoolAndCompareResult(ListEmpty, IntTwo2, OpReturningBool::less, false, AssertResult::EXCEPTION, "ListEmpty->less(IntTwo2)");
+    doOpReturningBoolAndCompareResult(ListEmpty, Int8, OpReturningBool::less, false, AssertResult::EXCEPTION, "ListEmpty->less(Int8)");
+    doOpReturningBoolAndCompareResult(ListEmpty, IntMinusOne, OpReturningBool::less, false, AssertResult::EXCEPTION, "ListEmpty->less(IntMinusOne)");
+    doOpReturningBoolAndCompareResult(ListEmpty, IntMinusOne2, OpReturningBool::less, false, AssertResult::EXCEPTION, "ListEmpty->less(IntMinusOne2)");
+    doOpReturningBoolAndCompareResult(ListEmpty, IntMinus12, OpReturningBool::less, false, AssertResult::EXCEPTION, "ListEmpty->less(IntMinus12)");
+    doOpReturningBoolAndCompareResult(ListEmpty, IntMinus73, OpReturningBool::less, false, AssertResult::EXCEPTION, "ListEmpty->less(IntMinus73)");
+    doOpReturningBoolAndCompareResult(ListEmpty, FloatMinusOne, OpReturningBool::less, false, AssertResult::EXCEPTION, "ListEmpty->less(FloatMinusOne)");
+    doOpReturningBoolAndCompareResult(ListEmpty, FloatZero, OpReturningBool::less, false, AssertResult::EXCEPTION, "ListEmpty->less(FloatZero)");
+    doOpReturningBoolAndCompareResult(ListEmpty, FloatOne, OpReturningBool::less, false, AssertResult::EXCEPTION, "ListEmpty->less(FloatOne)");
+    doOpReturningBoolAndCompareResult(ListEmpty, FloatTwo, OpReturningBool::less, false, AssertResult::EXCEPTION, "ListEmpty->less(FloatTwo)");
+    doOpReturningBoolAndCompareResult(ListEmpty, FloatTwo2, OpReturningBool::less, false, AssertResult::EXCEPTION, "ListEmpty->less(FloatTwo2)");
+    doOpReturningBoolAndCompareResult(ListEmpty, Float2_5, OpReturningBool::less, false, AssertResult::EXCEPTION, "ListEmpty->less(Float2_5)");
+    doOpReturningBoolAndCompareResult(ListEmpty, Float_23_74, OpReturningBool::less, false, AssertResult::EXCEPTION, "ListEmpty->less(Float_23_74)");
+    doOpReturningBoolAndCompareResult(ListEmpty, StrEmpty, OpReturningBool::less, false, AssertResult::EXCEPTION, "ListEmpty->less(StrEmpty)");
+    doOpReturningBoolAndCompareResult(ListEmpty, StrEmpty2, OpReturningBool::less, false, AssertResult::EXCEPTION, "ListEmpty->less(StrEmpty2)");
+    doOpReturningBoolAndCompareResult(ListEmpty, StrA, OpReturningBool::less, false, AssertResult::EXCEPTION, "ListEmpty->less(StrA)");
+    doOpReturningBoolAndCompareResult(ListEmpty, StrA2, OpReturningBool::less, false, AssertResult::EXCEPTION, "ListEmpty->less(StrA2)");
+    doOpReturningBoolAndCompareResult(ListEmpty, StrB, OpReturningBool::less, false, AssertResult::EXCEPTION, "ListEmpty->less(StrB)");
+    doOpReturningBoolAndCompareResult(ListEmpty, ListEmpty, OpReturningBool::less, false, AssertResult::FAIL, "ListEmpty->less(ListEmpty)");
+    doOpReturningBoolAndCompareResult(ListEmpty, ListEmpty2, OpReturningBool::less, false, AssertResult::FAIL, "ListEmpty->less(ListEmpty2)");
+    doOpReturningBoolAndCompareResult(ListEmpty2, None, OpReturningBool::less, false, AssertResult::EXCEPTION, "ListEmpty2->less(None)");
+    doOpReturningBoolAndCompareResult(ListEmpty2, None2, OpReturningBool::less, false, AssertResult::EXCEPTION, "ListEmpty2->less(None2)");
+    doOpReturningBoolAndCompareResult(ListEmpty2, False, OpReturningBool::less, false, AssertResult::EXCEPTION, "ListEmpty2->less(False)");
+    doOpReturningBoolAndCompareResult(ListEmpty2, False2, OpReturningBool::less, false, AssertResult::EXCEPTION, "ListEmpty2->less(False2)");
+    doOpReturningBoolAndCompareResult(ListEmpty2, True, OpReturningBool::less, false, AssertResult::EXCEPTION, "ListEmpty2->less(True)");
+    doOpReturningBoolAndCompareResult(ListEmpty2, True2, OpReturningBool::less, false, AssertResult::EXCEPTION, "ListEmpty2->less(True2)");
+    doOpReturningBoolAndCompareResult(ListEmpty2, IntZero, OpReturningBool::less, false, AssertResult::EXCEPTION, "ListEmpty2->less(IntZero)");
+    doOpReturningBoolAndCompareResult(ListEmpty2, IntOne, OpReturningBool::less, false, AssertResult::EXCEPTION, "ListEmpty2->less(IntOne)");
+    doOpReturningBoolAndCompareResult(ListEmpty2, IntTwo, OpReturningBool::less, false, AssertResult::EXCEPTION, "ListEmpty2->less(IntTwo)");
+    doOpReturningBoolAndCompareResult(ListEmpty2, IntTwo2, OpReturningBool::less, false, AssertResult::EXCEPTION, "ListEmpty2->less(IntTwo2)");
+    doOpReturningBoolAndCompareResult(ListEmpty2, Int8, OpReturningBool::less, false, AssertResult::EXCEPTION, "ListEmpty2->less(Int8)");
+    doOpReturningBoolAndCompareResult(ListEmpty2, IntMinusOne, OpReturningBool::less, false, AssertResult::EXCEPTION, "ListEmpty2->less(IntMinusOne)");
+    doOpReturningBoolAndCompareResult(ListEmpty2, IntMinusOne2, OpReturningBool::less, false, AssertResult::EXCEPTION, "ListEmpty2->less(IntMinusOne2)");
+    doOpReturningBoolAndCompareResult(ListEmpty2, IntMinus12, OpReturningBool::less, false, AssertResult::EXCEPTION, "ListEmpty2->less(IntMinus12)");
+    doOpReturningBoolAndCompareResult(ListEmpty2, IntMinus73, OpReturningBool::less, false, AssertResult::EXCEPTION, "ListEmpty2->less(IntMinus73)");
+    doOpReturningBoolAndCompareResult(ListEmpty2, FloatMinusOne, OpReturningBool::less, false, AssertResult::EXCEPTION, "ListEmpty2->less(FloatMinusOne)");
+    doOpReturningBoolAndCompareResult(ListEmpty2, FloatZero, OpReturningBool::less, false, AssertResult::EXCEPTION, "ListEmpty2->less(FloatZero)");
+    doOpReturningBoolAndCompareResult(ListEmpty2, FloatOne, OpReturningBool::less, false, AssertResult::EXCEPTION, "ListEmpty2->less(FloatOne)");
+    doOpReturningBoolAndCompareResult(ListEmpty2, FloatTwo, OpReturningBool::less, false, AssertResult::EXCEPTION, "ListEmpty2->less(FloatTwo)");
+    doOpReturningBoolAndCompareResult(ListEmpty2, FloatTwo2, OpReturningBool::less, false, AssertResult::EXCEPTION, "ListEmpty2->less(FloatTwo2)");
+    doOpReturningBoolAndCompareResult(ListEmpty2, Float2_5, OpReturningBool::less, false, AssertResult::EXCEPTION, "ListEmpty2->less(Float2_5)");
+    doOpReturningBoolAndCompareResult(ListEmpty2, Float_23_74, OpReturningBool::less, false, AssertResult::EXCEPTION, "ListEmpty2->less(Float_23_74)");
+    doOpReturningBoolAndCompareResult(ListEmpty2, StrEmpty, OpReturningBool::less, false, AssertResult::EXCEPTION, "ListEmpty2->less(StrEmpty)");
+    doOpReturningBoolAndCompareResult(ListEmpty2, StrEmpty2, OpReturningBool::less, false, AssertResult::EXCEPTION, "ListEmpty2->less(StrEmpty2)");
+    doOpReturningBoolAndCompareResult(ListEmpty2, StrA, OpReturningBool::less, false, AssertResult::EXCEPTION, "ListEmpty2->less(StrA)");
+    doOpReturningBoolAndCompareResult(ListEmpty2, StrA2, OpReturningBool::less, false, AssertResult::EXCEPTION, "ListEmpty2->less(StrA2)");
+    doOpReturningBoolAndCompareResult(ListEmpty2, StrB, OpReturningBool::less, false, AssertResult::EXCEPTION, "ListEmpty2->less(StrB)");
+    doOpReturningBoolAndCompareResult(ListEmpty2, ListEmpty, OpReturningBool::less, false, AssertResult::FAIL, "ListEmpty2->less(ListEmpty)");
+    doOpReturningBoolAndCompareResult(ListEmpty2, ListEmpty2, OpReturningBool::less, false, AssertResult::FAIL, "ListEmpty2->less(ListEmpty2)");
+}
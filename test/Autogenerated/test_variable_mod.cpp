@@ -0,0 +1,969 @@
+
+#include "variable/Variable.h"
+
+#include "Test.h"
+
+#define VAR(TYPE, VALUE) \
+    std::static_pointer_cast<GenericVariable>(std::make_shared<TYPE ## Variable>(VALUE))
+
+enum class OpReturningVar {
+    add,
+    sub,
+    mul,
+    div,
+    int_div,
+    pow,
+    mod,
+};
+
+enum class AssertResult {
+    PASS,
+    FAIL,
+    EXCEPTION,
+};
+
+static std::ostream& operator<< (std::ostream& os, AssertResult res) {
+    switch (res) {
+    case AssertResult::PASS:       os << "PASS";      break;
+    case AssertResult::FAIL:       os << "FAIL";      break;
+    case AssertResult::EXCEPTION:  os << "EXCEPTION"; break;
+    default:                       os << "???";
+    }
+    return os;
+}
+
+static Variable doOpReturningVar(Variable arg1, Variable arg2, OpReturningVar op) {
+    switch(op) {
+    case OpReturningVar::add: return arg1->add(arg2);
+    case OpReturningVar::sub: return arg1->sub(arg2);
+    case OpReturningVar::mul: return arg1->mul(arg2);
+    case OpReturningVar::div: return arg1->div(arg2);
+    case OpReturningVar::int_div: return arg1->int_div(arg2);
+    case OpReturningVar::mod: return arg1->mod(arg2);
+    case OpReturningVar::pow: return arg1->pow(arg2);
+    default: throw std::runtime_error("Bad op");
+    }
+}
+
+static void doOpReturningVarAndCompareResult(Variable arg1, Variable arg2, OpReturningVar op, Variable expected_res, AssertResult a_res, const char *descr) {
+    try {
+        auto res_var = doOpReturningVar(arg1, arg2, op);
+        auto assertion_result = res_var->strictly_equal(expected_res) ? AssertResult::PASS : AssertResult::FAIL;
+        if (assertion_result != a_res) {
+            std::cerr << descr << " returned " << assertion_result << " instead of " << a_res << "\n";
+        }
+    }
+    catch(...) {
+        if (a_res != AssertResult::EXCEPTION) {
+            std::cerr << descr << " returned EXCEPTION instead of " << a_res << "\n";
+        }
+    }
+}
+
+enum class OpReturningBool {
+    equal,
+    less,
+};
+
+static bool doOpReturningBool(Variable arg1, Variable arg2, OpReturningBool op) {
+    switch(op) {
+    case OpReturningBool::equal: return arg1->equal(arg2);
+    case OpReturningBool::less: return arg1->less(arg2);
+    default: throw std::runtime_error("Bad op");
+    }
+}
+
+static void doOpReturningBoolAndCompareResult(Variable arg1, Variable arg2, OpReturningBool op, bool expected_res, AssertResult a_res, const char *descr) {
+    try {
+        auto assertion_result = doOpReturningBool(arg1, arg2, op) ? AssertResult::PASS : AssertResult::FAIL;
+        if (assertion_result != a_res) {
+            std::cerr << descr << " returned " << assertion_result << " instead of " << a_res << "\n";
+        }
+    }
+    catch(...) {
+        if (a_res != AssertResult::EXCEPTION) {
+            std::cerr << descr << " returned EXCEPTION instead of " << a_res << "\n";
+        }
+    }
+}
+
+static auto None = std::static_pointer_cast<GenericVariable>(std::make_shared<NoneVariable>());
+static auto None2 = std::static_pointer_cast<GenericVariable>(std::make_shared<NoneVariable>());
+static auto False = VAR(Bool, false);
+static auto False2 = VAR(Bool, false);
+static auto True = VAR(Bool, true);
+static auto True2 = VAR(Bool, true);
+static auto IntZero = VAR(Int, 0);
+static auto IntOne = VAR(Int, 1);
+static auto IntTwo = VAR(Int, 2);
+static auto IntTwo2 = VAR(Int, 2);
+static auto Int8 = VAR(Int, 8);
+static auto IntMinusOne = VAR(Int, -1);
+static auto IntMinusOne2 = VAR(Int, -1);
+static auto IntMinus12 = VAR(Int, -12);
+static auto IntMinus73 = VAR(Int, -73);
+static auto FloatMinusOne = VAR(Float, -1);
+static auto FloatZero = VAR(Float, 0);
+static auto FloatOne = VAR(Float, 1);
+static auto FloatTwo = VAR(Float, 2);
+static auto FloatTwo2 = VAR(Float, 2);
+static auto Float2_5 = VAR(Float, 2.5);
+static auto Float_23_74 = VAR(Float, -23.74);
+static auto StrEmpty = VAR(String, "");
+static auto StrEmpty2 = VAR(String, "");
+static auto StrA = VAR(String, "some text");
+static auto StrA2 = VAR(String, "some text");
+static auto StrB = VAR(String, "other text");
+static auto ListEmpty = VAR(List, ListType());
+static auto ListEmpty2 = VAR(List, ListType());
+
+#include "variable/Variable.h"
+
+#include <gtest/gtest.h>
+
+class VariableModTest: public testing::Test {
+};
+
+TEST_F(VariableModTest, VariableModTest) {
+    EXPECT_ANY_THROW(None->mod(None));
+    EXPECT_ANY_THROW(None->mod(None2));
+    EXPECT_ANY_THROW(None->mod(False));
+    EXPECT_ANY_THROW(None->mod(False2));
+    EXPECT_ANY_THROW(None->mod(True));
+    EXPECT_ANY_THROW(None->mod(True2));
+    EXPECT_ANY_THROW(None->mod(IntZero));
+    EXPECT_ANY_THROW(None->mod(IntOne));
+    EXPECT_ANY_THROW(None->mod(IntTwo));
+    EXPECT_ANY_THROW(None->mod(IntTwo2));
+    EXPECT_ANY_THROW(None->mod(Int8));
+    EXPECT_ANY_THROW(None->mod(IntMinusOne));
+    EXPECT_ANY_THROW(None->mod(IntMinusOne2));
+    EXPECT_ANY_THROW(None->mod(IntMinus12));
+    EXPECT_ANY_THROW(None->mod(IntMinus73));
+    EXPECT_ANY_THROW(None->mod(FloatMinusOne));
+    EXPECT_ANY_THROW(None->mod(FloatZero));
+    EXPECT_ANY_THROW(None->mod(FloatOne));
+    EXPECT_ANY_THROW(None->mod(FloatTwo));
+    EXPECT_ANY_THROW(None->mod(FloatTwo2));
+    EXPECT_ANY_THROW(None->mod(Float2_5));
+    EXPECT_ANY_THROW(None->mod(Float_23_74));
+    EXPECT_ANY_THROW(None->mod(StrEmpty));
+    EXPECT_ANY_THROW(None->mod(StrEmpty2));
+    EXPECT_ANY_THROW(None->mod(StrA));
+    EXPECT_ANY_THROW(None->mod(StrA2));
+    EXPECT_ANY_THROW(None->mod(StrB));
+    EXPECT_ANY_THROW(None->mod(ListEmpty));
+    EXPECT_ANY_THROW(None->mod(ListEmpty2));
+    EXPECT_ANY_THROW(None2->mod(None));
+    EXPECT_ANY_THROW(None2->mod(None2));
+    EXPECT_ANY_THROW(None2->mod(False));
+    EXPECT_ANY_THROW(None2->mod(False2));
+    EXPECT_ANY_THROW(None2->mod(True));
+    EXPECT_ANY_THROW(None2->mod(True2));
+    EXPECT_ANY_THROW(None2->mod(IntZero));
+    EXPECT_ANY_THROW(None2->mod(IntOne));
+    EXPECT_ANY_THROW(None2->mod(IntTwo));
+    EXPECT_ANY_THROW(None2->mod(IntTwo2));
+    EXPECT_ANY_THROW(None2->mod(Int8));
+    EXPECT_ANY_THROW(None2->mod(IntMinusOne));
+    EXPECT_ANY_THROW(None2->mod(IntMinusOne2));
+    EXPECT_ANY_THROW(None2->mod(IntMinus12));
+    EXPECT_ANY_THROW(None2->mod(IntMinus73));
+    EXPECT_ANY_THROW(None2->mod(FloatMinusOne));
+    EXPECT_ANY_THROW(None2->mod(FloatZero));
+    EXPECT_ANY_THROW(None2->mod(FloatOne));
+    EXPECT_ANY_THROW(None2->mod(FloatTwo));
+    EXPECT_ANY_THROW(None2->mod(FloatTwo2));
+    EXPECT_ANY_THROW(None2->mod(Float2_5));
+    EXPECT_ANY_THROW(None2->mod(Float_23_74));
+    EXPECT_ANY_THROW(None2->mod(StrEmpty));
+    EXPECT_ANY_THROW(None2->mod(StrEmpty2));
+    EXPECT_ANY_THROW(None2->mod(StrA));
+    EXPECT_ANY_THROW(None2->mod(StrA2));
+    EXPECT_ANY_THROW(None2->mod(StrB));
+    EXPECT_ANY_THROW(None2->mod(ListEmpty));
+    EXPECT_ANY_THROW(None2->mod(ListEmpty2));
+    EXPECT_ANY_THROW(False->mod(None));
+    EXPECT_ANY_THROW(False->mod(None2));
+    EXPECT_ANY_THROW(False->mod(False));
+    EXPECT_ANY_THROW(False->mod(False2));
+    EXPECT_TRUE(False->mod(True)->strictly_equal(VAR(Int, 0)));
+    EXPECT_TRUE(False->mod(True2)->strictly_equal(VAR(Int, 0)));
+    EXPECT_ANY_THROW(False->mod(IntZero));
+    EXPECT_TRUE(False->mod(IntOne)->strictly_equal(VAR(Int, 0)));
+    EXPECT_TRUE(False->mod(IntTwo)->strictly_equal(VAR(Int, 0)));
+    EXPECT_TRUE(False->mod(IntTwo2)->strictly_equal(VAR(Int, 0)));
+    EXPECT_TRUE(False->mod(Int8)->strictly_equal(VAR(Int, 0)));
+    EXPECT_TRUE(False->mod(IntMinusOne)->strictly_equal(VAR(Int, 0)));
+    EXPECT_TRUE(False->mod(IntMinusOne2)->strictly_equal(VAR(Int, 0)));
+    EXPECT_TRUE(False->mod(IntMinus12)->strictly_equal(VAR(Int, 0)));
+    EXPECT_TRUE(False->mod(IntMinus73)->strictly_equal(VAR(Int, 0)));
+    EXPECT_TRUE(False->mod(FloatMinusOne)->strictly_equal(VAR(Float, -0.0)));
+    EXPECT_ANY_THROW(False->mod(FloatZero));
+    EXPECT_TRUE(False->mod(FloatOne)->strictly_equal(VAR(Float, 0.0)));
+    EXPECT_TRUE(False->mod(FloatTwo)->strictly_equal(VAR(Float, 0.0)));
+    EXPECT_TRUE(False->mod(FloatTwo2)->strictly_equal(VAR(Float, 0.0)));
+    EXPECT_TRUE(False->mod(Float2_5)->strictly_equal(VAR(Float, 0.0)));
+    EXPECT_TRUE(False->mod(Float_23_74)->strictly_equal(VAR(Float, -0.0)));
+    EXPECT_ANY_THROW(False->mod(StrEmpty));
+    EXPECT_ANY_THROW(False->mod(StrEmpty2));
+    EXPECT_ANY_THROW(False->mod(StrA));
+    EXPECT_ANY_THROW(False->mod(StrA2));
+    EXPECT_ANY_THROW(False->mod(StrB));
+    EXPECT_ANY_THROW(False->mod(ListEmpty));
+    EXPECT_ANY_THROW(False->mod(ListEmpty2));
+    EXPECT_ANY_THROW(False2->mod(None));
+    EXPECT_ANY_THROW(False2->mod(None2));
+    EXPECT_ANY_THROW(False2->mod(False));
+    EXPECT_ANY_THROW(False2->mod(False2));
+    EXPECT_TRUE(False2->mod(True)->strictly_equal(VAR(Int, 0)));
+    EXPECT_TRUE(False2->mod(True2)->strictly_equal(VAR(Int, 0)));
+    EXPECT_ANY_THROW(False2->mod(IntZero));
+    EXPECT_TRUE(False2->mod(IntOne)->strictly_equal(VAR(Int, 0)));
+    EXPECT_TRUE(False2->mod(IntTwo)->strictly_equal(VAR(Int, 0)));
+    EXPECT_TRUE(False2->mod(IntTwo2)->strictly_equal(VAR(Int, 0)));
+    EXPECT_TRUE(False2->mod(Int8)->strictly_equal(VAR(Int, 0)));
+    EXPECT_TRUE(False2->mod(IntMinusOne)->strictly_equal(VAR(Int, 0)));
+    EXPECT_TRUE(False2->mod(IntMinusOne2)->strictly_equal(VAR(Int, 0)));
+    EXPECT_TRUE(False2->mod(IntMinus12)->strictly_equal(VAR(Int, 0)));
+    EXPECT_TRUE(False2->mod(IntMinus73)->strictly_equal(VAR(Int, 0)));
+    EXPECT_TRUE(False2->mod(FloatMinusOne)->strictly_equal(VAR(Float, -0.0)));
+    EXPECT_ANY_THROW(False2->mod(FloatZero));
+    EXPECT_TRUE(False2->mod(FloatOne)->strictly_equal(VAR(Float, 0.0)));
+    EXPECT_TRUE(False2->mod(FloatTwo)->strictly_equal(VAR(Float, 0.0)));
+    EXPECT_TRUE(False2->mod(FloatTwo2)->strictly_equal(VAR(Float, 0.0)));
+    EXPECT_TRUE(False2->mod(Float2_5)->strictly_equal(VAR(Float, 0.0)));
+    EXPECT_TRUE(False2->mod(Float_23_74)->strictly_equal(VAR(Float, -0.0)));
+    EXPECT_ANY_THROW(False2->mod(StrEmpty));
+    EXPECT_ANY_THROW(False2->mod(StrEmpty2));
+    EXPECT_ANY_THROW(False2->mod(StrA));
+    EXPECT_ANY_THROW(False2->mod(StrA2));
+    EXPECT_ANY_THROW(False2->mod(StrB));
+    EXPECT_ANY_THROW(False2->mod(ListEmpty));
+    EXPECT_ANY_THROW(False2->mod(ListEmpty2));
+    EXPECT_ANY_THROW(True->mod(None));
+    EXPECT_ANY_THROW(True->mod(None2));
+    EXPECT_ANY_THROW(True->mod(False));
+    EXPECT_ANY_THROW(True->mod(False2));
+    EXPECT_TRUE(True->mod(True)->strictly_equal(VAR(Int, 0)));
+    EXPECT_TRUE(True->mod(True2)->strictly_equal(VAR(Int, 0)));
+    EXPECT_ANY_THROW(True->mod(IntZero));
+    EXPECT_TRUE(True->mod(IntOne)->strictly_equal(VAR(Int, 0)));
+    EXPECT_TRUE(True->mod(IntTwo)->strictly_equal(VAR(Int, 1)));
+    EXPECT_TRUE(True->mod(IntTwo2)->strictly_equal(VAR(Int, 1)));
+    EXPECT_TRUE(True->mod(Int8)->strictly_equal(VAR(Int, 1)));
+    EXPECT_TRUE(True->mod(IntMinusOne)->strictly_equal(VAR(Int, 0)));
+    EXPECT_TRUE(True->mod(IntMinusOne2)->strictly_equal(VAR(Int, 0)));
+    EXPECT_TRUE(True->mod(IntMinus12)->strictly_equal(VAR(Int, -11)));
+    EXPECT_TRUE(True->mod(IntMinus73)->strictly_equal(VAR(Int, -72)));
+    EXPECT_TRUE(True->mod(FloatMinusOne)->strictly_equal(VAR(Float, -0.0)));
+    EXPECT_ANY_THROW(True->mod(FloatZero));
+    EXPECT_TRUE(True->mod(FloatOne)->strictly_equal(VAR(Float, 0.0)));
+    EXPECT_TRUE(True->mod(FloatTwo)->strictly_equal(VAR(Float, 1.0)));
+    EXPECT_TRUE(True->mod(FloatTwo2)->strictly_equal(VAR(Float, 1.0)));
+    EXPECT_TRUE(True->mod(Float2_5)->strictly_equal(VAR(Float, 1.0)));
+    EXPECT_TRUE(True->mod(Float_23_74)->strictly_equal(VAR(Float, -22.74)));
+    EXPECT_ANY_THROW(True->mod(StrEmpty));
+    EXPECT_ANY_THROW(True->mod(StrEmpty2));
+    EXPECT_ANY_THROW(True->mod(StrA));
+    EXPECT_ANY_THROW(True->mod(StrA2));
+    EXPECT_ANY_THROW(True->mod(StrB));
+    EXPECT_ANY_THROW(True->mod(ListEmpty));
+    EXPECT_ANY_THROW(True->mod(ListEmpty2));
+    EXPECT_ANY_THROW(True2->mod(None));
+    EXPECT_ANY_THROW(True2->mod(None2));
+    EXPECT_ANY_THROW(True2->mod(False));
+    EXPECT_ANY_THROW(True2->mod(False2));
+    EXPECT_TRUE(True2->mod(True)->strictly_equal(VAR(Int, 0)));
+    EXPECT_TRUE(True2->mod(True2)->strictly_equal(VAR(Int, 0)));
+    EXPECT_ANY_THROW(True2->mod(IntZero));
+    EXPECT_TRUE(True2->mod(IntOne)->strictly_equal(VAR(Int, 0)));
+    EXPECT_TRUE(True2->mod(IntTwo)->strictly_equal(VAR(Int, 1)));
+    EXPECT_TRUE(True2->mod(IntTwo2)->strictly_equal(VAR(Int, 1)));
+    EXPECT_TRUE(True2->mod(Int8)->strictly_equal(VAR(Int, 1)));
+    EXPECT_TRUE(True2->mod(IntMinusOne)->strictly_equal(VAR(Int, 0)));
+    EXPECT_TRUE(True2->mod(IntMinusOne2)->strictly_equal(VAR(Int, 0)));
+    EXPECT_TRUE(True2->mod(IntMinus12)->strictly_equal(VAR(Int, -11)));
+    EXPECT_TRUE(True2->mod(IntMinus73)->strictly_equal(VAR(Int, -72)));
+    EXPECT_TRUE(True2->mod(FloatMinusOne)->strictly_equal(VAR(Float, -0.0)));
+    EXPECT_ANY_THROW(True2->mod(FloatZero));
+    EXPECT_TRUE(True2->mod(FloatOne)->strictly_equal(VAR(Float, 0.0)));
+    EXPECT_TRUE(True2->mod(FloatTwo)->strictly_equal(VAR(Float, 1.0)));
+    EXPECT_TRUE(True2->mod(FloatTwo2)->strictly_equal(VAR(Float, 1.0)));
+    EXPECT_TRUE(True2->mod(Float2_5)->strictly_equal(VAR(Float, 1.0)));
+    EXPECT_TRUE(True2->mod(Float_23_74)->strictly_equal(VAR(Float, -22.74)));
+    EXPECT_ANY_THROW(True2->mod(StrEmpty));
+    EXPECT_ANY_THROW(True2->mod(StrEmpty2));
+    EXPECT_ANY_THROW(True2->mod(StrA));
+    EXPECT_ANY_THROW(True2->mod(StrA2));
+    EXPECT_ANY_THROW(True2->mod(StrB));
+    EXPECT_ANY_THROW(True2->mod(ListEmpty));
+    EXPECT_ANY_THROW(True2->mod(ListEmpty2));
+    EXPECT_ANY_THROW(IntZero->mod(None));
+    EXPECT_ANY_THROW(IntZero->mod(None2));
+    EXPECT_ANY_THROW(IntZero->mod(False));
+    EXPECT_ANY_THROW(IntZero->mod(False2));
+    EXPECT_TRUE(IntZero->mod(True)->strictly_equal(VAR(Int, 0)));
+    EXPECT_TRUE(IntZero->mod(True2)->strictly_equal(VAR(Int, 0)));
+    EXPECT_ANY_THROW(IntZero->mod(IntZero));
+    EXPECT_TRUE(IntZero->mod(IntOne)->strictly_equal(VAR(Int, 0)));
+    EXPECT_TRUE(IntZero->mod(IntTwo)->strictly_equal(VAR(Int, 0)));
+    EXPECT_TRUE(IntZero->mod(IntTwo2)->strictly_equal(VAR(Int, 0)));
+    EXPECT_TRUE(IntZero->mod(Int8)->strictly_equal(VAR(Int, 0)));
+    EXPECT_TRUE(IntZero->mod(IntMinusOne)->strictly_equal(VAR(Int, 0)));
+    EXPECT_TRUE(IntZero->mod(IntMinusOne2)->strictly_equal(VAR(Int, 0)));
+    EXPECT_TRUE(IntZero->mod(IntMinus12)->strictly_equal(VAR(Int, 0)));
+    EXPECT_TRUE(IntZero->mod(IntMinus73)->strictly_equal(VAR(Int, 0)));
+    EXPECT_TRUE(IntZero->mod(FloatMinusOne)->strictly_equal(VAR(Float, -0.0)));
+    EXPECT_ANY_THROW(IntZero->mod(FloatZero));
+    EXPECT_TRUE(IntZero->mod(FloatOne)->strictly_equal(VAR(Float, 0.0)));
+    EXPECT_TRUE(IntZero->mod(FloatTwo)->strictly_equal(VAR(Float, 0.0)));
+    EXPECT_TRUE(IntZero->mod(FloatTwo2)->strictly_equal(VAR(Float, 0.0)));
+    EXPECT_TRUE(IntZero->mod(Float2_5)->strictly_equal(VAR(Float, 0.0)));
+    EXPECT_TRUE(IntZero->mod(Float_23_74)->strictly_equal(VAR(Float, -0.0)));
+    EXPECT_ANY_THROW(IntZero->mod(StrEmpty));
+    EXPECT_ANY_THROW(IntZero->mod(StrEmpty2));
+    EXPECT_ANY_THROW(IntZero->mod(StrA));
+    EXPECT_ANY_THROW(IntZero->mod(StrA2));
+    EXPECT_ANY_THROW(IntZero->mod(StrB));
+    EXPECT_ANY_THROW(IntZero->mod(ListEmpty));
+    EXPECT_ANY_THROW(IntZero->mod(ListEmpty2));
+    EXPECT_ANY_THROW(IntOne->mod(None));
+    EXPECT_ANY_THROW(IntOne->mod(None2));
+    EXPECT_ANY_THROW(IntOne->mod(False));
+    EXPECT_ANY_THROW(IntOne->mod(False2));
+    EXPECT_TRUE(IntOne->mod(True)->strictly_equal(VAR(Int, 0)));
+    EXPECT_TRUE(IntOne->mod(True2)->strictly_equal(VAR(Int, 0)));
+    EXPECT_ANY_THROW(IntOne->mod(IntZero));
+    EXPECT_TRUE(IntOne->mod(IntOne)->strictly_equal(VAR(Int, 0)));
+    EXPECT_TRUE(IntOne->mod(IntTwo)->strictly_equal(VAR(Int, 1)));
+    EXPECT_TRUE(IntOne->mod(IntTwo2)->strictly_equal(VAR(Int, 1)));
+    EXPECT_TRUE(IntOne->mod(Int8)->strictly_equal(VAR(Int, 1)));
+    EXPECT_TRUE(IntOne->mod(IntMinusOne)->strictly_equal(VAR(Int, 0)));
+    EXPECT_TRUE(IntOne->mod(IntMinusOne2)->strictly_equal(VAR(Int, 0)));
+    EXPECT_TRUE(IntOne->mod(IntMinus12)->strictly_equal(VAR(Int, -11)));
+    EXPECT_TRUE(IntOne->mod(IntMinus73)->strictly_equal(VAR(Int, -72)));
+    EXPECT_TRUE(IntOne->mod(FloatMinusOne)->strictly_equal(VAR(Float, -0.0)));
+    EXPECT_ANY_THROW(IntOne->mod(FloatZero));
+    EXPECT_TRUE(IntOne->mod(FloatOne)->strictly_equal(VAR(Float, 0.0)));
+    EXPECT_TRUE(IntOne->mod(FloatTwo)->strictly_equal(VAR(Float, 1.0)));
+    EXPECT_TRUE(IntOne->mod(FloatTwo2)->strictly_equal(VAR(Float, 1.0)));
+    EXPECT_TRUE(IntOne->mod(Float2_5)->strictly_equal(VAR(Float, 1.0)));
+    EXPECT_TRUE(IntOne->mod(Float_23_74)->strictly_equal(VAR(Float, -22.74)));
+    EXPECT_ANY_THROW(IntOne->mod(StrEmpty));
+    EXPECT_ANY_THROW(IntOne->mod(StrEmpty2));
+    EXPECT_ANY_THROW(IntOne->mod(StrA));
+    EXPECT_ANY_THROW(IntOne->mod(StrA2));
+    EXPECT_ANY_THROW(IntOne->mod(StrB));
+    EXPECT_ANY_THROW(IntOne->mod(ListEmpty));
+    EXPECT_ANY_THROW(IntOne->mod(ListEmpty2));
+    EXPECT_ANY_THROW(IntTwo->mod(None));
+    EXPECT_ANY_THROW(IntTwo->mod(None2));
+    EXPECT_ANY_THROW(IntTwo->mod(False));
+    EXPECT_ANY_THROW(IntTwo->mod(False2));
+    EXPECT_TRUE(IntTwo->mod(True)->strictly_equal(VAR(Int, 0)));
+    EXPECT_TRUE(IntTwo->mod(True2)->strictly_equal(VAR(Int, 0)));
+    EXPECT_ANY_THROW(IntTwo->mod(IntZero));
+    EXPECT_TRUE(IntTwo->mod(IntOne)->strictly_equal(VAR(Int, 0)));
+    EXPECT_TRUE(IntTwo->mod(IntTwo)->strictly_equal(VAR(Int, 0)));
+    EXPECT_TRUE(IntTwo->mod(IntTwo2)->strictly_equal(VAR(Int, 0)));
+    EXPECT_TRUE(IntTwo->mod(Int8)->strictly_equal(VAR(Int, 2)));
+    EXPECT_TRUE(IntTwo->mod(IntMinusOne)->strictly_equal(VAR(Int, 0)));
+    EXPECT_TRUE(IntTwo->mod(IntMinusOne2)->strictly_equal(VAR(Int, 0)));
+    EXPECT_TRUE(IntTwo->mod(IntMinus12)->strictly_equal(VAR(Int, -10)));
+    EXPECT_TRUE(IntTwo->mod(IntMinus73)->strictly_equal(VAR(Int, -71)));
+    EXPECT_TRUE(IntTwo->mod(FloatMinusOne)->strictly_equal(VAR(Float, -0.0)));
+    EXPECT_ANY_THROW(IntTwo->mod(FloatZero));
+    EXPECT_TRUE(IntTwo->mod(FloatOne)->strictly_equal(VAR(Float, 0.0)));
+    EXPECT_TRUE(IntTwo->mod(FloatTwo)->strictly_equal(VAR(Float, 0.0)));
+    EXPECT_TRUE(IntTwo->mod(FloatTwo2)->strictly_equal(VAR(Float, 0.0)));
+    EXPECT_TRUE(IntTwo->mod(Float2_5)->strictly_equal(VAR(Float, 2.0)));
+    EXPECT_TRUE(IntTwo->mod(Float_23_74)->strictly_equal(VAR(Float, -21.74)));
+    EXPECT_ANY_THROW(IntTwo->mod(StrEmpty));
+    EXPECT_ANY_THROW(IntTwo->mod(StrEmpty2));
+    EXPECT_ANY_THROW(IntTwo->mod(StrA));
+    EXPECT_ANY_THROW(IntTwo->mod(StrA2));
+    EXPECT_ANY_THROW(IntTwo->mod(StrB));
+    EXPECT_ANY_THROW(IntTwo->mod(ListEmpty));
+    EXPECT_ANY_THROW(IntTwo->mod(ListEmpty2));
+    EXPECT_ANY_THROW(IntTwo2->mod(None));
+    EXPECT_ANY_THROW(IntTwo2->mod(None2));
+    EXPECT_ANY_THROW(IntTwo2->mod(False));
+    EXPECT_ANY_THROW(IntTwo2->mod(False2));
+    EXPECT_TRUE(IntTwo2->mod(True)->strictly_equal(VAR(Int, 0)));
+    EXPECT_TRUE(IntTwo2->mod(True2)->strictly_equal(VAR(Int, 0)));
+    EXPECT_ANY_THROW(IntTwo2->mod(IntZero));
+    EXPECT_TRUE(IntTwo2->mod(IntOne)->strictly_equal(VAR(Int, 0)));
+    EXPECT_TRUE(IntTwo2->mod(IntTwo)->strictly_equal(VAR(Int, 0)));
+    EXPECT_TRUE(IntTwo2->mod(IntTwo2)->strictly_equal(VAR(Int, 0)));
+    EXPECT_TRUE(IntTwo2->mod(Int8)->strictly_equal(VAR(Int, 2)));
+    EXPECT_TRUE(IntTwo2->mod(IntMinusOne)->strictly_equal(VAR(Int, 0)));
+    EXPECT_TRUE(IntTwo2->mod(IntMinusOne2)->strictly_equal(VAR(Int, 0)));
+    EXPECT_TRUE(IntTwo2->mod(IntMinus12)->strictly_equal(VAR(Int, -10)));
+    EXPECT_TRUE(IntTwo2->mod(IntMinus73)->strictly_equal(VAR(Int, -71)));
+    EXPECT_TRUE(IntTwo2->mod(FloatMinusOne)->strictly_equal(VAR(Float, -0.0)));
+    EXPECT_ANY_THROW(IntTwo2->mod(FloatZero));
+    EXPECT_TRUE(IntTwo2->mod(FloatOne)->strictly_equal(VAR(Float, 0.0)));
+    EXPECT_TRUE(IntTwo2->mod(FloatTwo)->strictly_equal(VAR(Float, 0.0)));
+    EXPECT_TRUE(IntTwo2->mod(FloatTwo2)->strictly_equal(VAR(Float, 0.0)));
+    EXPECT_TRUE(IntTwo2->mod(Float2_5)->strictly_equal(VAR(Float, 2.0)));
+    EXPECT_TRUE(IntTwo2->mod(Float_23_74)->strictly_equal(VAR(Float, -21.74)));
+    EXPECT_ANY_THROW(IntTwo2->mod(StrEmpty));
+    EXPECT_ANY_THROW(IntTwo2->mod(StrEmpty2));
+    EXPECT_ANY_THROW(IntTwo2->mod(StrA));
+    EXPECT_ANY_THROW(IntTwo2->mod(StrA2));
+    EXPECT_ANY_THROW(IntTwo2->mod(StrB));
+    EXPECT_ANY_THROW(IntTwo2->mod(ListEmpty));
+    EXPECT_ANY_THROW(IntTwo2->mod(ListEmpty2));
+    EXPECT_ANY_THROW(Int8->mod(None));
+    EXPECT_ANY_THROW(Int8->mod(None2));
+    EXPECT_ANY_THROW(Int8->mod(False));
+    EXPECT_ANY_THROW(Int8->mod(False2));
+    EXPECT_TRUE(Int8->mod(True)->strictly_equal(VAR(Int, 0)));
+    EXPECT_TRUE(Int8->mod(True2)->strictly_equal(VAR(Int, 0)));
+    EXPECT_ANY_THROW(Int8->mod(IntZero));
+    EXPECT_TRUE(Int8->mod(IntOne)->strictly_equal(VAR(Int, 0)));
+    EXPECT_TRUE(Int8->mod(IntTwo)->strictly_equal(VAR(Int, 0)));
+    EXPECT_TRUE(Int8->mod(IntTwo2)->strictly_equal(VAR(Int, 0)));
+    EXPECT_TRUE(Int8->mod(Int8)->strictly_equal(VAR(Int, 0)));
+    EXPECT_TRUE(Int8->mod(IntMinusOne)->strictly_equal(VAR(Int, 0)));
+    EXPECT_TRUE(Int8->mod(IntMinusOne2)->strictly_equal(VAR(Int, 0)));
+    EXPECT_TRUE(Int8->mod(IntMinus12)->strictly_equal(VAR(Int, -4)));
+    EXPECT_TRUE(Int8->mod(IntMinus73)->strictly_equal(VAR(Int, -65)));
+    EXPECT_TRUE(Int8->mod(FloatMinusOne)->strictly_equal(VAR(Float, -0.0)));
+    EXPECT_ANY_THROW(Int8->mod(FloatZero));
+    EXPECT_TRUE(Int8->mod(FloatOne)->strictly_equal(VAR(Float, 0.0)));
+    EXPECT_TRUE(Int8->mod(FloatTwo)->strictly_equal(VAR(Float, 0.0)));
+    EXPECT_TRUE(Int8->mod(FloatTwo2)->strictly_equal(VAR(Float, 0.0)));
+    EXPECT_TRUE(Int8->mod(Float2_5)->strictly_equal(VAR(Float, 0.5)));
+    EXPECT_TRUE(Int8->mod(Float_23_74)->strictly_equal(VAR(Float, -15.739999999999998)));
+    EXPECT_ANY_THROW(Int8->mod(StrEmpty));
+    EXPECT_ANY_THROW(Int8->mod(StrEmpty2));
+    EXPECT_ANY_THROW(Int8->mod(StrA));
+    EXPECT_ANY_THROW(Int8->mod(StrA2));
+    EXPECT_ANY_THROW(Int8->mod(StrB));
+    EXPECT_ANY_THROW(Int8->mod(ListEmpty));
+    EXPECT_ANY_THROW(Int8->mod(ListEmpty2));
+    EXPECT_ANY_THROW(IntMinusOne->mod(None));
+    EXPECT_ANY_THROW(IntMinusOne->mod(None2));
+    EXPECT_ANY_THROW(IntMinusOne->mod(False));
+    EXPECT_ANY_THROW(IntMinusOne->mod(False2));
+    EXPECT_TRUE(IntMinusOne->mod(True)->strictly_equal(VAR(Int, 0)));
+    EXPECT_TRUE(IntMinusOne->mod(True2)->strictly_equal(VAR(Int, 0)));
+    EXPECT_ANY_THROW(IntMinusOne->mod(IntZero));
+    EXPECT_TRUE(IntMinusOne->mod(IntOne)->strictly_equal(VAR(Int, 0)));
+    EXPECT_TRUE(IntMinusOne->mod(IntTwo)->strictly_equal(VAR(Int, 1)));
+    EXPECT_TRUE(IntMinusOne->mod(IntTwo2)->strictly_equal(VAR(Int, 1)));
+    EXPECT_TRUE(IntMinusOne->mod(Int8)->strictly_equal(VAR(Int, 7)));
+    EXPECT_TRUE(IntMinusOne->mod(IntMinusOne)->strictly_equal(VAR(Int, 0)));
+    EXPECT_TRUE(IntMinusOne->mod(IntMinusOne2)->strictly_equal(VAR(Int, 0)));
+    EXPECT_TRUE(IntMinusOne->mod(IntMinus12)->strictly_equal(VAR(Int, -1)));
+    EXPECT_TRUE(IntMinusOne->mod(IntMinus73)->strictly_equal(VAR(Int, -1)));
+    EXPECT_TRUE(IntMinusOne->mod(FloatMinusOne)->strictly_equal(VAR(Float, -0.0)));
+    EXPECT_ANY_THROW(IntMinusOne->mod(FloatZero));
+    EXPECT_TRUE(IntMinusOne->mod(FloatOne)->strictly_equal(VAR(Float, 0.0)));
+    EXPECT_TRUE(IntMinusOne->mod(FloatTwo)->strictly_equal(VAR(Float, 1.0)));
+    EXPECT_TRUE(IntMinusOne->mod(FloatTwo2)->strictly_equal(VAR(Float, 1.0)));
+    EXPECT_TRUE(IntMinusOne->mod(Float2_5)->strictly_equal(VAR(Float, 1.5)));
+    EXPECT_TRUE(IntMinusOne->mod(Float_23_74)->strictly_equal(VAR(Float, -1.0)));
+    EXPECT_ANY_THROW(IntMinusOne->mod(StrEmpty));
+    EXPECT_ANY_THROW(IntMinusOne->mod(StrEmpty2));
+    EXPECT_ANY_THROW(IntMinusOne->mod(StrA));
+    EXPECT_ANY_THROW(IntMinusOne->mod(StrA2));
+    EXPECT_ANY_THROW(IntMinusOne->mod(StrB));
+    EXPECT_ANY_THROW(IntMinusOne->mod(ListEmpty));
+    EXPECT_ANY_THROW(IntMinusOne->mod(ListEmpty2));
+    EXPECT_ANY_THROW(IntMinusOne2->mod(None));
+    EXPECT_ANY_THROW(IntMinusOne2->mod(None2));
+    EXPECT_ANY_THROW(IntMinusOne2->mod(False));
+    EXPECT_ANY_THROW(IntMinusOne2->mod(False2));
+    EXPECT_TRUE(IntMinusOne2->mod(True)->strictly_equal(VAR(Int, 0)));
+    EXPECT_TRUE(IntMinusOne2->mod(True2)->strictly_equal(VAR(Int, 0)));
+    EXPECT_ANY_THROW(IntMinusOne2->mod(IntZero));
+    EXPECT_TRUE(IntMinusOne2->mod(IntOne)->strictly_equal(VAR(Int, 0)));
+    EXPECT_TRUE(IntMinusOne2->mod(IntTwo)->strictly_equal(VAR(Int, 1)));
+    EXPECT_TRUE(IntMinusOne2->mod(IntTwo2)->strictly_equal(VAR(Int, 1)));
+    EXPECT_TRUE(IntMinusOne2->mod(Int8)->strictly_equal(VAR(Int, 7)));
+    EXPECT_TRUE(IntMinusOne2->mod(IntMinusOne)->strictly_equal(VAR(Int, 0)));
+    EXPECT_TRUE(IntMinusOne2->mod(IntMinusOne2)->strictly_equal(VAR(Int, 0)));
+    EXPECT_TRUE(IntMinusOne2->mod(IntMinus12)->strictly_equal(VAR(Int, -1)));
+    EXPECT_TRUE(IntMinusOne2->mod(IntMinus73)->strictly_equal(VAR(Int, -1)));
+    EXPECT_TRUE(IntMinusOne2->mod(FloatMinusOne)->strictly_equal(VAR(Float, -0.0)));
+    EXPECT_ANY_THROW(IntMinusOne2->mod(FloatZero));
+    EXPECT_TRUE(IntMinusOne2->mod(FloatOne)->strictly_equal(VAR(Float, 0.0)));
+    EXPECT_TRUE(IntMinusOne2->mod(FloatTwo)->strictly_equal(VAR(Float, 1.0)));
+    EXPECT_TRUE(IntMinusOne2->mod(FloatTwo2)->strictly_equal(VAR(Float, 1.0)));
+    EXPECT_TRUE(IntMinusOne2->mod(Float2_5)->strictly_equal(VAR(Float, 1.5)));
+    EXPECT_TRUE(IntMinusOne2->mod(Float_23_74)->strictly_equal(VAR(Float, -1.0)));
+    EXPECT_ANY_THROW(IntMinusOne2->mod(StrEmpty));
+    EXPECT_ANY_THROW(IntMinusOne2->mod(StrEmpty2));
+    EXPECT_ANY_THROW(IntMinusOne2->mod(StrA));
+    EXPECT_ANY_THROW(IntMinusOne2->mod(StrA2));
+    EXPECT_ANY_THROW(IntMinusOne2->mod(StrB));
+    EXPECT_ANY_THROW(IntMinusOne2->mod(ListEmpty));
+    EXPECT_ANY_THROW(IntMinusOne2->mod(ListEmpty2));
+    EXPECT_ANY_THROW(IntMinus12->mod(None));
+    EXPECT_ANY_THROW(IntMinus12->mod(None2));
+    EXPECT_ANY_THROW(IntMinus12->mod(False));
+    EXPECT_ANY_THROW(IntMinus12->mod(False2));
+    EXPECT_TRUE(IntMinus12->mod(True)->strictly_equal(VAR(Int, 0)));
+    EXPECT_TRUE(IntMinus12->mod(True2)->strictly_equal(VAR(Int, 0)));
+    EXPECT_ANY_THROW(IntMinus12->mod(IntZero));
+    EXPECT_TRUE(IntMinus12->mod(IntOne)->strictly_equal(VAR(Int, 0)));
+    EXPECT_TRUE(IntMinus12->mod(IntTwo)->strictly_equal(VAR(Int, 0)));
+    EXPECT_TRUE(IntMinus12->mod(IntTwo2)->strictly_equal(VAR(Int, 0)));
+    EXPECT_TRUE(IntMinus12->mod(Int8)->strictly_equal(VAR(Int, 4)));
+    EXPECT_TRUE(IntMinus12->mod(IntMinusOne)->strictly_equal(VAR(Int, 0)));
+    EXPECT_TRUE(IntMinus12->mod(IntMinusOne2)->strictly_equal(VAR(Int, 0)));
+    EXPECT_TRUE(IntMinus12->mod(IntMinus12)->strictly_equal(VAR(Int, 0)));
+    EXPECT_TRUE(IntMinus12->mod(IntMinus73)->strictly_equal(VAR(Int, -12)));
+    EXPECT_TRUE(IntMinus12->mod(FloatMinusOne)->strictly_equal(VAR(Float, -0.0)));
+    EXPECT_ANY_THROW(IntMinus12->mod(FloatZero));
+    EXPECT_TRUE(IntMinus12->mod(FloatOne)->strictly_equal(VAR(Float, 0.0)));
+    EXPECT_TRUE(IntMinus12->mod(FloatTwo)->strictly_equal(VAR(Float, 0.0)));
+    EXPECT_TRUE(IntMinus12->mod(FloatTwo2)->strictly_equal(VAR(Float, 0.0)));
+    EXPECT_TRUE(IntMinus12->mod(Float2_5)->strictly_equal(VAR(Float, 0.5)));
+    EXPECT_TRUE(IntMinus12->mod(Float_23_74)->strictly_equal(VAR(Float, -12.0)));
+    EXPECT_ANY_THROW(IntMinus12->mod(StrEmpty));
+    EXPECT_ANY_THROW(IntMinus12->mod(StrEmpty2));
+    EXPECT_ANY_THROW(IntMinus12->mod(StrA));
+    EXPECT_ANY_THROW(IntMinus12->mod(StrA2));
+    EXPECT_ANY_THROW(IntMinus12->mod(StrB));
+    EXPECT_ANY_THROW(IntMinus12->mod(ListEmpty));
+    EXPECT_ANY_THROW(IntMinus12->mod(ListEmpty2));
+    EXPECT_ANY_THROW(IntMinus73->mod(None));
+    EXPECT_ANY_THROW(IntMinus73->mod(None2));
+    EXPECT_ANY_THROW(IntMinus73->mod(False));
+    EXPECT_ANY_THROW(IntMinus73->mod(False2));
+    EXPECT_TRUE(IntMinus73->mod(True)->strictly_equal(VAR(Int, 0)));
+    EXPECT_TRUE(IntMinus73->mod(True2)->strictly_equal(VAR(Int, 0)));
+    EXPECT_ANY_THROW(IntMinus73->mod(IntZero));
+    EXPECT_TRUE(IntMinus73->mod(IntOne)->strictly_equal(VAR(Int, 0)));
+    EXPECT_TRUE(IntMinus73->mod(IntTwo)->strictly_equal(VAR(Int, 1)));
+    EXPECT_TRUE(IntMinus73->mod(IntTwo2)->strictly_equal(VAR(Int, 1)));
+    EXPECT_TRUE(IntMinus73->mod(Int8)->strictly_equal(VAR(Int, 7)));
+    EXPECT_TRUE(IntMinus73->mod(IntMinusOne)->strictly_equal(VAR(Int, 0)));
+    EXPECT_TRUE(IntMinus73->mod(IntMinusOne2)->strictly_equal(VAR(Int, 0)));
+    EXPECT_TRUE(IntMinus73->mod(IntMinus12)->strictly_equal(VAR(Int, -1)));
+    EXPECT_TRUE(IntMinus73->mod(IntMinus73)->strictly_equal(VAR(Int, 0)));
+    EXPECT_TRUE(IntMinus73->mod(FloatMinusOne)->strictly_equal(VAR(Float, -0.0)));
+    EXPECT_ANY_THROW(IntMinus73->mod(FloatZero));
+    EXPECT_TRUE(IntMinus73->mod(FloatOne)->strictly_equal(VAR(Float, 0.0)));
+    EXPECT_TRUE(IntMinus73->mod(FloatTwo)->strictly_equal(VAR(Float, 1.0)));
+    EXPECT_TRUE(IntMinus73->mod(FloatTwo2)->strictly_equal(VAR(Float, 1.0)));
+    EXPECT_TRUE(IntMinus73->mod(Float2_5)->strictly_equal(VAR(Float, 2.0)));
+    EXPECT_TRUE(IntMinus73->mod(Float_23_74)->strictly_equal(VAR(Float, -1.7800000000000047)));
+    EXPECT_ANY_THROW(IntMinus73->mod(StrEmpty));
+    EXPECT_ANY_THROW(IntMinus73->mod(StrEmpty2));
+    EXPECT_ANY_THROW(IntMinus73->mod(StrA));
+    EXPECT_ANY_THROW(IntMinus73->mod(StrA2));
+    EXPECT_ANY_THROW(IntMinus73->mod(StrB));
+    EXPECT_ANY_THROW(IntMinus73->mod(ListEmpty));
+    EXPECT_ANY_THROW(IntMinus73->mod(ListEmpty2));
+    EXPECT_ANY_THROW(FloatMinusOne->mod(None));
+    EXPECT_ANY_THROW(FloatMinusOne->mod(None2));
+    EXPECT_ANY_THROW(FloatMinusOne->mod(False));
+    EXPECT_ANY_THROW(FloatMinusOne->mod(False2));
+    EXPECT_TRUE(FloatMinusOne->mod(True)->strictly_equal(VAR(Float, 0.0)));
+    EXPECT_TRUE(FloatMinusOne->mod(True2)->strictly_equal(VAR(Float, 0.0)));
+    EXPECT_ANY_THROW(FloatMinusOne->mod(IntZero));
+    EXPECT_TRUE(FloatMinusOne->mod(IntOne)->strictly_equal(VAR(Float, 0.0)));
+    EXPECT_TRUE(FloatMinusOne->mod(IntTwo)->strictly_equal(VAR(Float, 1.0)));
+    EXPECT_TRUE(FloatMinusOne->mod(IntTwo2)->strictly_equal(VAR(Float, 1.0)));
+    EXPECT_TRUE(FloatMinusOne->mod(Int8)->strictly_equal(VAR(Float, 7.0)));
+    EXPECT_TRUE(FloatMinusOne->mod(IntMinusOne)->strictly_equal(VAR(Float, -0.0)));
+    EXPECT_TRUE(FloatMinusOne->mod(IntMinusOne2)->strictly_equal(VAR(Float, -0.0)));
+    EXPECT_TRUE(FloatMinusOne->mod(IntMinus12)->strictly_equal(VAR(Float, -1.0)));
+    EXPECT_TRUE(FloatMinusOne->mod(IntMinus73)->strictly_equal(VAR(Float, -1.0)));
+    EXPECT_TRUE(FloatMinusOne->mod(FloatMinusOne)->strictly_equal(VAR(Float, -0.0)));
+    EXPECT_ANY_THROW(FloatMinusOne->mod(FloatZero));
+    EXPECT_TRUE(FloatMinusOne->mod(FloatOne)->strictly_equal(VAR(Float, 0.0)));
+    EXPECT_TRUE(FloatMinusOne->mod(FloatTwo)->strictly_equal(VAR(Float, 1.0)));
+    EXPECT_TRUE(FloatMinusOne->mod(FloatTwo2)->strictly_equal(VAR(Float, 1.0)));
+    EXPECT_TRUE(FloatMinusOne->mod(Float2_5)->strictly_equal(VAR(Float, 1.5)));
+    EXPECT_TRUE(FloatMinusOne->mod(Float_23_74)->strictly_equal(VAR(Float, -1.0)));
+    EXPECT_ANY_THROW(FloatMinusOne->mod(StrEmpty));
+    EXPECT_ANY_THROW(FloatMinusOne->mod(StrEmpty2));
+    EXPECT_ANY_THROW(FloatMinusOne->mod(StrA));
+    EXPECT_ANY_THROW(FloatMinusOne->mod(StrA2));
+    EXPECT_ANY_THROW(FloatMinusOne->mod(StrB));
+    EXPECT_ANY_THROW(FloatMinusOne->mod(ListEmpty));
+    EXPECT_ANY_THROW(FloatMinusOne->mod(ListEmpty2));
+    EXPECT_ANY_THROW(FloatZero->mod(None));
+    EXPECT_ANY_THROW(FloatZero->mod(None2));
+    EXPECT_ANY_THROW(FloatZero->mod(False));
+    EXPECT_ANY_THROW(FloatZero->mod(False2));
+    EXPECT_TRUE(FloatZero->mod(True)->strictly_equal(VAR(Float, 0.0)));
+    EXPECT_TRUE(FloatZero->mod(True2)->strictly_equal(VAR(Float, 0.0)));
+    EXPECT_ANY_THROW(FloatZero->mod(IntZero));
+    EXPECT_TRUE(FloatZero->mod(IntOne)->strictly_equal(VAR(Float, 0.0)));
+    EXPECT_TRUE(FloatZero->mod(IntTwo)->strictly_equal(VAR(Float, 0.0)));
+    EXPECT_TRUE(FloatZero->mod(IntTwo2)->strictly_equal(VAR(Float, 0.0)));
+    EXPECT_TRUE(FloatZero->mod(Int8)->strictly_equal(VAR(Float, 0.0)));
+    EXPECT_TRUE(FloatZero->mod(IntMinusOne)->strictly_equal(VAR(Float, -0.0)));
+    EXPECT_TRUE(FloatZero->mod(IntMinusOne2)->strictly_equal(VAR(Float, -0.0)));
+    EXPECT_TRUE(FloatZero->mod(IntMinus12)->strictly_equal(VAR(Float, -0.0)));
+    EXPECT_TRUE(FloatZero->mod(IntMinus73)->strictly_equal(VAR(Float, -0.0)));
+    EXPECT_TRUE(FloatZero->mod(FloatMinusOne)->strictly_equal(VAR(Float, -0.0)));
+    EXPECT_ANY_THROW(FloatZero->mod(FloatZero));
+    EXPECT_TRUE(FloatZero->mod(FloatOne)->strictly_equal(VAR(Float, 0.0)));
+    EXPECT_TRUE(FloatZero->mod(FloatTwo)->strictly_equal(VAR(Float, 0.0)));
+    EXPECT_TRUE(FloatZero->mod(FloatTwo2)->strictly_equal(VAR(Float, 0.0)));
+    EXPECT_TRUE(FloatZero->mod(Float2_5)->strictly_equal(VAR(Float, 0.0)));
+    EXPECT_TRUE(FloatZero->mod(Float_23_74)->strictly_equal(VAR(Float, -0.0)));
+    EXPECT_ANY_THROW(FloatZero->mod(StrEmpty));
+    EXPECT_ANY_THROW(FloatZero->mod(StrEmpty2));
+    EXPECT_ANY_THROW(FloatZero->mod(StrA));
+    EXPECT_ANY_THROW(FloatZero->mod(StrA2));
+    EXPECT_ANY_THROW(FloatZero->mod(StrB));
+    EXPECT_ANY_THROW(FloatZero->mod(ListEmpty));
+    EXPECT_ANY_THROW(FloatZero->mod(ListEmpty2));
+    EXPECT_ANY_THROW(FloatOne->mod(None));
+    EXPECT_ANY_THROW(FloatOne->mod(None2));
+    EXPECT_ANY_THROW(FloatOne->mod(False));
+    EXPECT_ANY_THROW(FloatOne->mod(False2));
+    EXPECT_TRUE(FloatOne->mod(True)->strictly_equal(VAR(Float, 0.0)));
+    EXPECT_TRUE(FloatOne->mod(True2)->strictly_equal(VAR(Float, 0.0)));
+    EXPECT_ANY_THROW(FloatOne->mod(IntZero));
+    EXPECT_TRUE(FloatOne->mod(IntOne)->strictly_equal(VAR(Float, 0.0)));
+    EXPECT_TRUE(FloatOne->mod(IntTwo)->strictly_equal(VAR(Float, 1.0)));
+    EXPECT_TRUE(FloatOne->mod(IntTwo2)->strictly_equal(VAR(Float, 1.0)));
+    EXPECT_TRUE(FloatOne->mod(Int8)->strictly_equal(VAR(Float, 1.0)));
+    EXPECT_TRUE(FloatOne->mod(IntMinusOne)->strictly_equal(VAR(Float, -0.0)));
+    EXPECT_TRUE(FloatOne->mod(IntMinusOne2)->strictly_equal(VAR(Float, -0.0)));
+    EXPECT_TRUE(FloatOne->mod(IntMinus12)->strictly_equal(VAR(Float, -11.0)));
+    EXPECT_TRUE(FloatOne->mod(IntMinus73)->strictly_equal(VAR(Float, -72.0)));
+    EXPECT_TRUE(FloatOne->mod(FloatMinusOne)->strictly_equal(VAR(Float, -0.0)));
+    EXPECT_ANY_THROW(FloatOne->mod(FloatZero));
+    EXPECT_TRUE(FloatOne->mod(FloatOne)->strictly_equal(VAR(Float, 0.0)));
+    EXPECT_TRUE(FloatOne->mod(FloatTwo)->strictly_equal(VAR(Float, 1.0)));
+    EXPECT_TRUE(FloatOne->mod(FloatTwo2)->strictly_equal(VAR(Float, 1.0)));
+    EXPECT_TRUE(FloatOne->mod(Float2_5)->strictly_equal(VAR(Float, 1.0)));
+    EXPECT_TRUE(FloatOne->mod(Float_23_74)->strictly_equal(VAR(Float, -22.74)));
+    EXPECT_ANY_THROW(FloatOne->mod(StrEmpty));
+    EXPECT_ANY_THROW(FloatOne->mod(StrEmpty2));
+    EXPECT_ANY_THROW(FloatOne->mod(StrA));
+    EXPECT_ANY_THROW(FloatOne->mod(StrA2));
+    EXPECT_ANY_THROW(FloatOne->mod(StrB));
+    EXPECT_ANY_THROW(FloatOne->mod(ListEmpty));
+    EXPECT_ANY_THROW(FloatOne->mod(ListEmpty2));
+    EXPECT_ANY_THROW(FloatTwo->mod(None));
+    EXPECT_ANY_THROW(FloatTwo->mod(None2));
+    EXPECT_ANY_THROW(FloatTwo->mod(False));
+    EXPECT_ANY_THROW(FloatTwo->mod(False2));
+    EXPECT_TRUE(FloatTwo->mod(True)->strictly_equal(VAR(Float, 0.0)));
+    EXPECT_TRUE(FloatTwo->mod(True2)->strictly_equal(VAR(Float, 0.0)));
+    EXPECT_ANY_THROW(FloatTwo->mod(IntZero));
+    EXPECT_TRUE(FloatTwo->mod(IntOne)->strictly_equal(VAR(Float, 0.0)));
+    EXPECT_TRUE(FloatTwo->mod(IntTwo)->strictly_equal(VAR(Float, 0.0)));
+    EXPECT_TRUE(FloatTwo->mod(IntTwo2)->strictly_equal(VAR(Float, 0.0)));
+    EXPECT_TRUE(FloatTwo->mod(Int8)->strictly_equal(VAR(Float, 2.0)));
+    EXPECT_TRUE(FloatTwo->mod(IntMinusOne)->strictly_equal(VAR(Float, -0.0)));
+    EXPECT_TRUE(FloatTwo->mod(IntMinusOne2)->strictly_equal(VAR(Float, -0.0)));
+    EXPECT_TRUE(FloatTwo->mod(IntMinus12)->strictly_equal(VAR(Float, -10.0)));
+    EXPECT_TRUE(FloatTwo->mod(IntMinus73)->strictly_equal(VAR(Float, -71.0)));
+    EXPECT_TRUE(FloatTwo->mod(FloatMinusOne)->strictly_equal(VAR(Float, -0.0)));
+    EXPECT_ANY_THROW(FloatTwo->mod(FloatZero));
+    EXPECT_TRUE(FloatTwo->mod(FloatOne)->strictly_equal(VAR(Float, 0.0)));
+    EXPECT_TRUE(FloatTwo->mod(FloatTwo)->strictly_equal(VAR(Float, 0.0)));
+    EXPECT_TRUE(FloatTwo->mod(FloatTwo2)->strictly_equal(VAR(Float, 0.0)));
+    EXPECT_TRUE(FloatTwo->mod(Float2_5)->strictly_equal(VAR(Float, 2.0)));
+    EXPECT_TRUE(FloatTwo->mod(Float_23_74)->strictly_equal(VAR(Float, -21.74)));
+    EXPECT_ANY_THROW(FloatTwo->mod(StrEmpty));
+    EXPECT_ANY_THROW(FloatTwo->mod(StrEmpty2));
+    EXPECT_ANY_THROW(FloatTwo->mod(StrA));
+    EXPECT_ANY_THROW(FloatTwo->mod(StrA2));
+    EXPECT_ANY_THROW(FloatTwo->mod(StrB));
+    EXPECT_ANY_THROW(FloatTwo->mod(ListEmpty));
+    EXPECT_ANY_THROW(FloatTwo->mod(ListEmpty2));
+    EXPECT_ANY_THROW(FloatTwo2->mod(None));
+    EXPECT_ANY_THROW(FloatTwo2->mod(None2));
+    EXPECT_ANY_THROW(FloatTwo2->mod(False));
+    EXPECT_ANY_THROW(FloatTwo2->mod(False2));
+    EXPECT_TRUE(FloatTwo2->mod(True)->strictly_equal(VAR(Float, 0.0)));
+    EXPECT_TRUE(FloatTwo2->mod(True2)->strictly_equal(VAR(Float, 0.0)));
+    EXPECT_ANY_THROW(FloatTwo2->mod(IntZero));
+    EXPECT_TRUE(FloatTwo2->mod(IntOne)->strictly_equal(VAR(Float, 0.0)));
+    EXPECT_TRUE(FloatTwo2->mod(IntTwo)->strictly_equal(VAR(Float, 0.0)));
+    EXPECT_TRUE(FloatTwo2->mod(IntTwo2)->strictly_equal(VAR(Float, 0.0)));
+    EXPECT_TRUE(FloatTwo2->mod(Int8)->strictly_equal(VAR(Float, 2.0)));
+    EXPECT_TRUE(FloatTwo2->mod(IntMinusOne)->strictly_equal(VAR(Float, -0.0)));
+    EXPECT_TRUE(FloatTwo2->mod(IntMinusOne2)->strictly_equal(VAR(Float, -0.0)));
+    EXPECT_TRUE(FloatTwo2->mod(IntMinus12)->strictly_equal(VAR(Float, -10.0)));
+    EXPECT_TRUE(FloatTwo2->mod(IntMinus73)->strictly_equal(VAR(Float, -71.0)));
+    EXPECT_TRUE(FloatTwo2->mod(FloatMinusOne)->strictly_equal(VAR(Float, -0.0)));
+    EXPECT_ANY_THROW(FloatTwo2->mod(FloatZero));
+    EXPECT_TRUE(FloatTwo2->mod(FloatOne)->strictly_equal(VAR(Float, 0.0)));
+    EXPECT_TRUE(FloatTwo2->mod(FloatTwo)->strictly_equal(VAR(Float, 0.0)));
+    EXPECT_TRUE(FloatTwo2->mod(FloatTwo2)->strictly_equal(VAR(Float, 0.0)));
+    EXPECT_TRUE(FloatTwo2->mod(Float2_5)->strictly_equal(VAR(Float, 2.0)));
+    EXPECT_TRUE(FloatTwo2->mod(Float_23_74)->strictly_equal(VAR(Float, -21.74)));
+    EXPECT_ANY_THROW(FloatTwo2->mod(StrEmpty));
+    EXPECT_ANY_THROW(FloatTwo2->mod(StrEmpty2));
+    EXPECT_ANY_THROW(FloatTwo2->mod(StrA));
+    EXPECT_ANY_THROW(FloatTwo2->mod(StrA2));
+    EXPECT_ANY_THROW(FloatTwo2->mod(StrB));
+    EXPECT_ANY_THROW(FloatTwo2->mod(ListEmpty));
+    EXPECT_ANY_THROW(FloatTwo2->mod(ListEmpty2));
+    EXPECT_ANY_THROW(Float2_5->mod(None));
+    EXPECT_ANY_THROW(Float2_5->mod(None2));
+    EXPECT_ANY_THROW(Float2_5->mod(False));
+    EXPECT_ANY_THROW(Float2_5->mod(False2));
+    EXPECT_TRUE(Float2_5->mod(True)->strictly_equal(VAR(Float, 0.5)));
+    EXPECT_TRUE(Float2_5->mod(True2)->strictly_equal(VAR(Float, 0.5)));
+    EXPECT_ANY_THROW(Float2_5->mod(IntZero));
+    EXPECT_TRUE(Float2_5->mod(IntOne)->strictly_equal(VAR(Float, 0.5)));
+    EXPECT_TRUE(Float2_5->mod(IntTwo)->strictly_equal(VAR(Float, 0.5)));
+    EXPECT_TRUE(Float2_5->mod(IntTwo2)->strictly_equal(VAR(Float, 0.5)));
+    EXPECT_TRUE(Float2_5->mod(Int8)->strictly_equal(VAR(Float, 2.5)));
+    EXPECT_TRUE(Float2_5->mod(IntMinusOne)->strictly_equal(VAR(Float, -0.5)));
+    EXPECT_TRUE(Float2_5->mod(IntMinusOne2)->strictly_equal(VAR(Float, -0.5)));
+    EXPECT_TRUE(Float2_5->mod(IntMinus12)->strictly_equal(VAR(Float, -9.5)));
+    EXPECT_TRUE(Float2_5->mod(IntMinus73)->strictly_equal(VAR(Float, -70.5)));
+    EXPECT_TRUE(Float2_5->mod(FloatMinusOne)->strictly_equal(VAR(Float, -0.5)));
+    EXPECT_ANY_THROW(Float2_5->mod(FloatZero));
+    EXPECT_TRUE(Float2_5->mod(FloatOne)->strictly_equal(VAR(Float, 0.5)));
+    EXPECT_TRUE(Float2_5->mod(FloatTwo)->strictly_equal(VAR(Float, 0.5)));
+    EXPECT_TRUE(Float2_5->mod(FloatTwo2)->strictly_equal(VAR(Float, 0.5)));
+    EXPECT_TRUE(Float2_5->mod(Float2_5)->strictly_equal(VAR(Float, 0.0)));
+    EXPECT_TRUE(Float2_5->mod(Float_23_74)->strictly_equal(VAR(Float, -21.24)));
+    EXPECT_ANY_THROW(Float2_5->mod(StrEmpty));
+    EXPECT_ANY_THROW(Float2_5->mod(StrEmpty2));
+    EXPECT_ANY_THROW(Float2_5->mod(StrA));
+    EXPECT_ANY_THROW(Float2_5->mod(StrA2));
+    EXPECT_ANY_THROW(Float2_5->mod(StrB));
+    EXPECT_ANY_THROW(Float2_5->mod(ListEmpty));
+    EXPECT_ANY_THROW(Float2_5->mod(ListEmpty2));
+    EXPECT_ANY_THROW(Float_23_74->mod(None));
+    EXPECT_ANY_THROW(Float_23_74->mod(None2));
+    EXPECT_ANY_THROW(Float_23_74->mod(False));
+    EXPECT_ANY_THROW(Float_23_74->mod(False2));
+    EXPECT_TRUE(Float_23_74->mod(True)->strictly_equal(VAR(Float, 0.26000000000000156)));
+    EXPECT_TRUE(Float_23_74->mod(True2)->strictly_equal(VAR(Float, 0.26000000000000156)));
+    EXPECT_ANY_THROW(Float_23_74->mod(IntZero));
+    EXPECT_TRUE(Float_23_74->mod(IntOne)->strictly_equal(VAR(Float, 0.26000000000000156)));
+    EXPECT_TRUE(Float_23_74->mod(IntTwo)->strictly_equal(VAR(Float, 0.26000000000000156)));
+    EXPECT_TRUE(Float_23_74->mod(IntTwo2)->strictly_equal(VAR(Float, 0.26000000000000156)));
+    EXPECT_TRUE(Float_23_74->mod(Int8)->strictly_equal(VAR(Float, 0.26000000000000156)));
+    EXPECT_TRUE(Float_23_74->mod(IntMinusOne)->strictly_equal(VAR(Float, -0.7399999999999984)));
+    EXPECT_TRUE(Float_23_74->mod(IntMinusOne2)->strictly_equal(VAR(Float, -0.7399999999999984)));
+    EXPECT_TRUE(Float_23_74->mod(IntMinus12)->strictly_equal(VAR(Float, -11.739999999999998)));
+    EXPECT_TRUE(Float_23_74->mod(IntMinus73)->strictly_equal(VAR(Float, -23.74)));
+    EXPECT_TRUE(Float_23_74->mod(FloatMinusOne)->strictly_equal(VAR(Float, -0.7399999999999984)));
+    EXPECT_ANY_THROW(Float_23_74->mod(FloatZero));
+    EXPECT_TRUE(Float_23_74->mod(FloatOne)->strictly_equal(VAR(Float, 0.26000000000000156)));
+    EXPECT_TRUE(Float_23_74->mod(FloatTwo)->strictly_equal(VAR(Float, 0.26000000000000156)));
+    EXPECT_TRUE(Float_23_74->mod(FloatTwo2)->strictly_equal(VAR(Float, 0.26000000000000156)));
+    EXPECT_TRUE(Float_23_74->mod(Float2_5)->strictly_equal(VAR(Float, 1.2600000000000016)));
+    EXPECT_TRUE(Float_23_74->mod(Float_23_74)->strictly_equal(VAR(Float, -0.0)));
+    EXPECT_ANY_THROW(Float_23_74->mod(StrEmpty));
+    EXPECT_ANY_THROW(Float_23_74->mod(StrEmpty2));
+    EXPECT_ANY_THROW(Float_23_74->mod(StrA));
+    EXPECT_ANY_THROW(Float_23_74->mod(StrA2));
+    EXPECT_ANY_THROW(Float_23_74->mod(StrB));
+    EXPECT_ANY_THROW(Float_23_74->mod(ListEmpty));
+    EXPECT_ANY_THROW(Float_23_74->mod(ListEmpty2));
+    EXPECT_ANY_THROW(StrEmpty->mod(None));
+    EXPECT_ANY_THROW(StrEmpty->mod(None2));
+    EXPECT_ANY_THROW(StrEmpty->mod(False));
+    EXPECT_ANY_THROW(StrEmpty->mod(False2));
+    EXPECT_ANY_THROW(StrEmpty->mod(True));
+    EXPECT_ANY_THROW(StrEmpty->mod(True2));
+    EXPECT_ANY_THROW(StrEmpty->mod(IntZero));
+    EXPECT_ANY_THROW(StrEmpty->mod(IntOne));
+    EXPECT_ANY_THROW(StrEmpty->mod(IntTwo));
+    EXPECT_ANY_THROW(StrEmpty->mod(IntTwo2));
+    EXPECT_ANY_THROW(StrEmpty->mod(Int8));
+    EXPECT_ANY_THROW(StrEmpty->mod(IntMinusOne));
+    EXPECT_ANY_THROW(StrEmpty->mod(IntMinusOne2));
+    EXPECT_ANY_THROW(StrEmpty->mod(IntMinus12));
+    EXPECT_ANY_THROW(StrEmpty->mod(IntMinus73));
+    EXPECT_ANY_THROW(StrEmpty->mod(FloatMinusOne));
+    EXPECT_ANY_THROW(StrEmpty->mod(FloatZero));
+    EXPECT_ANY_THROW(StrEmpty->mod(FloatOne));
+    EXPECT_ANY_THROW(StrEmpty->mod(FloatTwo));
+    EXPECT_ANY_THROW(StrEmpty->mod(FloatTwo2));
+    EXPECT_ANY_THROW(StrEmpty->mod(Float2_5));
+    EXPECT_ANY_THROW(StrEmpty->mod(Float_23_74));
+    EXPECT_ANY_THROW(StrEmpty->mod(StrEmpty));
+    EXPECT_ANY_THROW(StrEmpty->mod(StrEmpty2));
+    EXPECT_ANY_THROW(StrEmpty->mod(StrA));
+    EXPECT_ANY_THROW(StrEmpty->mod(StrA2));
+    EXPECT_ANY_THROW(StrEmpty->mod(StrB));
+    EXPECT_TRUE(StrEmpty->mod(ListEmpty)->strictly_equal(VAR(String, "")));
+    EXPECT_TRUE(StrEmpty->mod(ListEmpty2)->strictly_equal(VAR(String, "")));
+    EXPECT_ANY_THROW(StrEmpty2->mod(None));
+    EXPECT_ANY_THROW(StrEmpty2->mod(None2));
+    EXPECT_ANY_THROW(StrEmpty2->mod(False));
+    EXPECT_ANY_THROW(StrEmpty2->mod(False2));
+    EXPECT_ANY_THROW(StrEmpty2->mod(True));
+    EXPECT_ANY_THROW(StrEmpty2->mod(True2));
+    EXPECT_ANY_THROW(StrEmpty2->mod(IntZero));
+    EXPECT_ANY_THROW(StrEmpty2->mod(IntOne));
+    EXPECT_ANY_THROW(StrEmpty2->mod(IntTwo));
+    EXPECT_ANY_THROW(StrEmpty2->mod(IntTwo2));
+    EXPECT_ANY_THROW(StrEmpty2->mod(Int8));
+    EXPECT_ANY_THROW(StrEmpty2->mod(IntMinusOne));
+    EXPECT_ANY_THROW(StrEmpty2->mod(IntMinusOne2));
+    EXPECT_ANY_THROW(StrEmpty2->mod(IntMinus12));
+    EXPECT_ANY_THROW(StrEmpty2->mod(IntMinus73));
+    EXPECT_ANY_THROW(StrEmpty2->mod(FloatMinusOne));
+    EXPECT_ANY_THROW(StrEmpty2->mod(FloatZero));
+    EXPECT_ANY_THROW(StrEmpty2->mod(FloatOne));
+    EXPECT_ANY_THROW(StrEmpty2->mod(FloatTwo));
+    EXPECT_ANY_THROW(StrEmpty2->mod(FloatTwo2));
+    EXPECT_ANY_THROW(StrEmpty2->mod(Float2_5));
+    EXPECT_ANY_THROW(StrEmpty2->mod(Float_23_74));
+    EXPECT_ANY_THROW(StrEmpty2->mod(StrEmpty));
+    EXPECT_ANY_THROW(StrEmpty2->mod(StrEmpty2));
+    EXPECT_ANY_THROW(StrEmpty2->mod(StrA));
+    EXPECT_ANY_THROW(StrEmpty2->mod(StrA2));
+    EXPECT_ANY_THROW(StrEmpty2->mod(StrB));
+    EXPECT_TRUE(StrEmpty2->mod(ListEmpty)->strictly_equal(VAR(String, "")));
+    EXPECT_TRUE(StrEmpty2->mod(ListEmpty2)->strictly_equal(VAR(String, "")));
+    EXPECT_ANY_THROW(StrA->mod(None));
+    EXPECT_ANY_THROW(StrA->mod(None2));
+    EXPECT_ANY_THROW(StrA->mod(False));
+    EXPECT_ANY_THROW(StrA->mod(False2));
+    EXPECT_ANY_THROW(StrA->mod(True));
+    EXPECT_ANY_THROW(StrA->mod(True2));
+    EXPECT_ANY_THROW(StrA->mod(IntZero));
+    EXPECT_ANY_THROW(StrA->mod(IntOne));
+    EXPECT_ANY_THROW(StrA->mod(IntTwo));
+    EXPECT_ANY_THROW(StrA->mod(IntTwo2));
+    EXPECT_ANY_THROW(StrA->mod(Int8));
+    EXPECT_ANY_THROW(StrA->mod(IntMinusOne));
+    EXPECT_ANY_THROW(StrA->mod(IntMinusOne2));
+    EXPECT_ANY_THROW(StrA->mod(IntMinus12));
+    EXPECT_ANY_THROW(StrA->mod(IntMinus73));
+    EXPECT_ANY_THROW(StrA->mod(FloatMinusOne));
+    EXPECT_ANY_THROW(StrA->mod(FloatZero));
+    EXPECT_ANY_THROW(StrA->mod(FloatOne));
+    EXPECT_ANY_THROW(StrA->mod(FloatTwo));
+    EXPECT_ANY_THROW(StrA->mod(FloatTwo2));
+    EXPECT_ANY_THROW(StrA->mod(Float2_5));
+    EXPECT_ANY_THROW(StrA->mod(Float_23_74));
+    EXPECT_ANY_THROW(StrA->mod(StrEmpty));
+    EXPECT_ANY_THROW(StrA->mod(StrEmpty2));
+    EXPECT_ANY_THROW(StrA->mod(StrA));
+    EXPECT_ANY_THROW(StrA->mod(StrA2));
+    EXPECT_ANY_THROW(StrA->mod(StrB));
+    EXPECT_TRUE(StrA->mod(ListEmpty)->strictly_equal(VAR(String, "some text")));
+    EXPECT_TRUE(StrA->mod(ListEmpty2)->strictly_equal(VAR(String, "some text")));
+    EXPECT_ANY_THROW(StrA2->mod(None));
+    EXPECT_ANY_THROW(StrA2->mod(None2));
+    EXPECT_ANY_THROW(StrA2->mod(False));
+    EXPECT_ANY_THROW(StrA2->mod(False2));
+    EXPECT_ANY_THROW(StrA2->mod(True));
+    EXPECT_ANY_THROW(StrA2->mod(True2));
+    EXPECT_ANY_THROW(StrA2->mod(IntZero));
+    EXPECT_ANY_THROW(StrA2->mod(IntOne));
+    EXPECT_ANY_THROW(StrA2->mod(IntTwo));
+    EXPECT_ANY_THROW(StrA2->mod(IntTwo2));
+    EXPECT_ANY_THROW(StrA2->mod(Int8));
+    EXPECT_ANY_THROW(StrA2->mod(IntMinusOne));
+    EXPECT_ANY_THROW(StrA2->mod(IntMinusOne2));
+    EXPECT_ANY_THROW(StrA2->mod(IntMinus12));
+    EXPECT_ANY_THROW(StrA2->mod(IntMinus73));
+    EXPECT_ANY_THROW(StrA2->mod(FloatMinusOne));
+    EXPECT_ANY_THROW(StrA2->mod(FloatZero));
+    EXPECT_ANY_THROW(StrA2->mod(FloatOne));
+    EXPECT_ANY_THROW(StrA2->mod(FloatTwo));
+    EXPECT_ANY_THROW(StrA2->mod(FloatTwo2));
+    EXPECT_ANY_THROW(StrA2->mod(Float2_5));
+    EXPECT_ANY_THROW(StrA2->mod(Float_23_74));
+    EXPECT_ANY_THROW(StrA2->mod(StrEmpty));
+    EXPECT_ANY_THROW(StrA2->mod(StrEmpty2));
+    EXPECT_ANY_THROW(StrA2->mod(StrA));
+    EXPECT_ANY_THROW(StrA2->mod(StrA2));
+    EXPECT_ANY_THROW(StrA2->mod(StrB));
+    EXPECT_TRUE(StrA2->mod(ListEmpty)->strictly_equal(VAR(String, "some text")));
+    EXPECT_TRUE(StrA2->mod(ListEmpty2)->strictly_equal(VAR(String, "some text")));
+    EXPECT_ANY_THROW(StrB->mod(None));
+    EXPECT_ANY_THROW(StrB->mod(None2));
+    EXPECT_ANY_THROW(StrB->mod(False));
+    EXPECT_ANY_THROW(StrB->mod(False2));
+    EXPECT_ANY_THROW(StrB->mod(True));
+    EXPECT_ANY_THROW(StrB->mod(True2));
+    EXPECT_ANY_THROW(StrB->mod(IntZero));
+    EXPECT_ANY_THROW(StrB->mod(IntOne));
+    EXPECT_ANY_THROW(StrB->mod(IntTwo));
+    EXPECT_ANY_THROW(StrB->mod(IntTwo2));
+    EXPECT_ANY_THROW(StrB->mod(Int8));
+    EXPECT_ANY_THROW(StrB->mod(IntMinusOne));
+    EXPECT_ANY_THROW(StrB->mod(IntMinusOne2));
+    EXPECT_ANY_THROW(StrB->mod(IntMinus12));
+    EXPECT_ANY_THROW(StrB->mod(IntMinus73));
+    EXPECT_ANY_THROW(StrB->mod(FloatMinusOne));
+    EXPECT_ANY_THROW(StrB->mod(FloatZero));
+    EXPECT_ANY_THROW(StrB->mod(FloatOne));
+    EXPECT_ANY_THROW(StrB->mod(FloatTwo));
+    EXPECT_ANY_THROW(StrB->mod(FloatTwo2));
+    EXPECT_ANY_THROW(StrB->mod(Float2_5));
+    EXPECT_ANY_THROW(StrB->mod(Float_23_74));
+    EXPECT_ANY_THROW(StrB->mod(StrEmpty));
+    EXPECT_ANY_THROW(StrB->mod(StrEmpty2));
+    EXPECT_ANY_THROW(StrB->mod(StrA));
+    EXPECT_ANY_THROW(StrB->mod(StrA2));
+    EXPECT_ANY_THROW(StrB->mod(StrB));
+    EXPECT_TRUE(StrB->mod(ListEmpty)->strictly_equal(VAR(String, "other text")));
+    EXPECT_TRUE(StrB->mod(ListEmpty2)->strictly_equal(VAR(String, "other text")));
+    EXPECT_ANY_THROW(ListEmpty->mod(None));
+    EXPECT_ANY_THROW(ListEmpty->mod(None2));
+    EXPECT_ANY_THROW(ListEmpty->mod(False));
+    EXPECT_ANY_THROW(ListEmpty->mod(False2));
+    EXPECT_ANY_THROW(ListEmpty->mod(True));
+    EXPECT_ANY_THROW(ListEmpty->mod(True2));
+    EXPECT_ANY_THROW(ListEmpty->mod(IntZero));
+    EXPECT_ANY_THROW(ListEmpty->mod(IntOne));
+    EXPECT_ANY_THROW(ListEmpty->mod(IntTwo));
+    EXPECT_ANY_THROW(ListEmpty->mod(IntTwo2));
+    EXPECT_ANY_THROW(ListEmpty->mod(Int8));
+    EXPECT_ANY_THROW(ListEmpty->mod(IntMinusOne));
+    EXPECT_ANY_THROW(ListEmpty->mod(IntMinusOne2));
+    EXPECT_ANY_THROW(ListEmpty->mod(IntMinus12));
+    EXPECT_ANY_THROW(ListEmpty->mod(IntMinus73));
+    EXPECT_ANY_THROW(ListEmpty->mod(FloatMinusOne));
+    EXPECT_ANY_THROW(ListEmpty->mod(FloatZero));
+    EXPECT_ANY_THROW(ListEmpty->mod(FloatOne));
+    EXPECT_ANY_THROW(ListEmpty->mod(FloatTwo));
+    EXPECT_ANY_THROW(ListEmpty->mod(FloatTwo2));
+    EXPECT_ANY_THROW(ListEmpty->mod(Float2_5));
+    EXPECT_ANY_THROW(ListEmpty->mod(Float_23_74));
+    EXPECT_ANY_THROW(ListEmpty->mod(StrEmpty));
+    EXPECT_ANY_THROW(ListEmpty->mod(StrEmpty2));
+    EXPECT_ANY_THROW(ListEmpty->mod(StrA));
+    EXPECT_ANY_THROW(ListEmpty->mod(StrA2));
+    EXPECT_ANY_THROW(ListEmpty->mod(StrB));
+    EXPECT_ANY_THROW(ListEmpty->mod(ListEmpty));
+    EXPECT_ANY_THROW(ListEmpty->mod(ListEmpty2));
+    EXPECT_ANY_THROW(ListEmpty2->mod(None));
+    EXPECT_ANY_THROW(ListEmpty2->mod(None2));
+    EXPECT_ANY_THROW(ListEmpty2->mod(False));
+    EXPECT_ANY_THROW(ListEmpty2->mod(False2));
+    EXPECT_ANY_THROW(ListEmpty2->mod(True));
+    EXPECT_ANY_THROW(ListEmpty2->mod(True2));
+    EXPECT_ANY_THROW(ListEmpty2->mod(IntZero));
+    EXPECT_ANY_THROW(ListEmpty2->mod(IntOne));
+    EXPECT_ANY_THROW(ListEmpty2->mod(IntTwo));
+    EXPECT_ANY_THROW(ListEmpty2->mod(IntTwo2));
+    EXPECT_ANY_THROW(ListEmpty2->mod(Int8));
+    EXPECT_ANY_THROW(ListEmpty2->mod(IntMinusOne));
+    EXPECT_ANY_THROW(ListEmpty2->mod(IntMinusOne2));
+    EXPECT_ANY_THROW(ListEmpty2->mod(IntMinus12));
+    EXPECT_ANY_THROW(ListEmpty2->mod(IntMinus73));
+    EXPECT_ANY_THROW(ListEmpty2->mod(FloatMinusOne));
+    EXPECT_ANY_THROW(ListEmpty2->mod(FloatZero));
+    EXPECT_ANY_THROW(ListEmpty2->mod(FloatOne));
+    EXPECT_ANY_THROW(ListEmpty2->mod(FloatTwo));
+    EXPECT_ANY_THROW(ListEmpty2->mod(FloatTwo2));
+    EXPECT_ANY_THROW(ListEmpty2->mod(Float2_5));
+    EXPECT_ANY_THROW(ListEmpty2->mod(Float_23_74));
+    EXPECT_ANY_THROW(ListEmpty2->mod(StrEmpty));
+    EXPECT_ANY_THROW(ListEmpty2->mod(StrEmpty2));
+    EXPECT_ANY_THROW(ListEmpty2->mod(StrA));
+    EXPECT_ANY_THROW(ListEmpty2->mod(StrA2));
+    EXPECT_ANY_THROW(ListEmpty2->mod(StrB));
+    EXPECT_ANY_THROW(ListEmpty2->mod(ListEmpty));
+    EXPECT_ANY_THROW(ListEmpty2->mod(ListEmpty2));
+}
@@ -0,0 +1,969 @@
+
+#include "variable/Variable.h"
+
+#include "Test.h"
+
+#define VAR(TYPE, VALUE) \
+    std::static_pointer_cast<GenericVariable>(std::make_shared<TYPE ## Variable>(VALUE))
+
+enum class OpReturningVar {
+    add,
+    sub,
+    mul,
+    div,
+    int_div,
+    pow,
+    mod,
+};
+
+enum class AssertResult {
+    PASS,
+    FAIL,
+    EXCEPTION,
+};
+
+static std::ostream& operator<< (std::ostream& os, AssertResult res) {
+    switch (res) {
+    case AssertResult::PASS:       os << "PASS";      break;
+    case AssertResult::FAIL:       os << "FAIL";      break;
+    case AssertResult::EXCEPTION:  os << "EXCEPTION"; break;
+    default:                       os << "???";
+    }
+    return os;
+}
+
+static Variable doOpReturningVar(Variable arg1, Variable arg2, OpReturningVar op) {
+    switch(op) {
+    case OpReturningVar::add: return arg1->add(arg2);
+    case OpReturningVar::sub: return arg1->sub(arg2);
+    case OpReturningVar::mul: return arg1->mul(arg2);
+    case OpReturningVar::div: return arg1->div(arg2);
+    case OpReturningVar::int_div: return arg1->int_div(arg2);
+    case OpReturningVar::mod: return arg1->mod(arg2);
+    case OpReturningVar::pow: return arg1->pow(arg2);
+    default: throw std::runtime_error("Bad op");
+    }
+}
+
+static void doOpReturningVarAndCompareResult(Variable arg1, Variable arg2, OpReturningVar op, Variable expected_res, AssertResult a_res, const char *descr) {
+    try {
+        auto res_var = doOpReturningVar(arg1, arg2, op);
+        auto assertion_result = res_var->strictly_equal(expected_res) ? AssertResult::PASS : AssertResult::FAIL;
+        if (assertion_result != a_res) {
+            std::cerr << descr << " returned " << assertion_result << " instead of " << a_res << "\n";
+        }
+    }
+    catch(...) {
+        if (a_res != AssertResult::EXCEPTION) {
+            std::cerr << descr << " returned EXCEPTION instead of " << a_res << "\n";
+        }
+    }
+}
+
+enum class OpReturningBool {
+    equal,
+    less,
+};
+
+static bool doOpReturningBool(Variable arg1, Variable arg2, OpReturningBool op) {
+    switch(op) {
+    case OpReturningBool::equal: return arg1->equal(arg2);
+    case OpReturningBool::less: return arg1->less(arg2);
+    default: throw std::runtime_error("Bad op");
+    }
+}
+
+static void doOpReturningBoolAndCompareResult(Variable arg1, Variable arg2, OpReturningBool op, bool expected_res, AssertResult a_res, const char *descr) {
+    try {
+        auto assertion_result = doOpReturningBool(arg1, arg2, op) ? AssertResult::PASS : AssertResult::FAIL;
+        if (assertion_result != a_res) {
+            std::cerr << descr << " returned " << assertion_result << " instead of " << a_res << "\n";
+        }
+    }
+    catch(...) {
+        if (a_res != AssertResult::EXCEPTION) {
+            std::cerr << descr << " returned EXCEPTION instead of " << a_res << "\n";
+        }
+    }
+}
+
+static auto None = std::static_pointer_cast<GenericVariable>(std::make_shared<NoneVariable>());
+static auto None2 = std::static_pointer_cast<GenericVariable>(std::make_shared<NoneVariable>());
+static auto False = VAR(Bool, false);
+static auto False2 = VAR(Bool, false);
+static auto True = VAR(Bool, true);
+static auto True2 = VAR(Bool, true);
+static auto IntZero = VAR(Int, 0);
+static auto IntOne = VAR(Int, 1);
+static auto IntTwo = VAR(Int, 2);
+static auto IntTwo2 = VAR(Int, 2);
+static auto Int8 = VAR(Int, 8);
+static auto IntMinusOne = VAR(Int, -1);
+static auto IntMinusOne2 = VAR(Int, -1);
+static auto IntMinus12 = VAR(Int, -12);
+static auto IntMinus73 = VAR(Int, -73);
+static auto FloatMinusOne = VAR(Float, -1);
+static auto FloatZero = VAR(Float, 0);
+static auto FloatOne = VAR(Float, 1);
+static auto FloatTwo = VAR(Float, 2);
+static auto FloatTwo2 = VAR(Float, 2);
+static auto Float2_5 = VAR(Float, 2.5);
+static auto Float_23_74 = VAR(Float, -23.74);
+static auto StrEmpty = VAR(String, "");
+static auto StrEmpty2 = VAR(String, "");
+static auto StrA = VAR(String, "some text");
+static auto StrA2 = VAR(String, "some text");
+static auto StrB = VAR(String, "other text");
+static auto ListEmpty = VAR(List, ListType());
+static auto ListEmpty2 = VAR(List, ListType());
+
+#include "variable/Variable.h"
+
+#include <gtest/gtest.h>
+
+class VariableMulTest: public testing::Test {
+};
+
+TEST_F(VariableMulTest, VariableMulTest) {
+    EXPECT_ANY_THROW(None->mul(None));
+    EXPECT_ANY_THROW(None->mul(None2));
+    EXPECT_ANY_THROW(None->mul(False));
+    EXPECT_ANY_THROW(None->mul(False2));
+    EXPECT_ANY_THROW(None->mul(True));
+    EXPECT_ANY_THROW(None->mul(True2));
+    EXPECT_ANY_THROW(None->mul(IntZero));
+    EXPECT_ANY_THROW(None->mul(IntOne));
+    EXPECT_ANY_THROW(None->mul(IntTwo));
+    EXPECT_ANY_THROW(None->mul(IntTwo2));
+    EXPECT_ANY_THROW(None->mul(Int8));
+    EXPECT_ANY_THROW(None->mul(IntMinusOne));
+    EXPECT_ANY_THROW(None->mul(IntMinusOne2));
+    EXPECT_ANY_THROW(None->mul(IntMinus12));
+    EXPECT_ANY_THROW(None->mul(IntMinus73));
+    EXPECT_ANY_THROW(None->mul(FloatMinusOne));
+    EXPECT_ANY_THROW(None->mul(FloatZero));
+    EXPECT_ANY_THROW(None->mul(FloatOne));
+    EXPECT_ANY_THROW(None->mul(FloatTwo));
+    EXPECT_ANY_THROW(None->mul(FloatTwo2));
+    EXPECT_ANY_THROW(None->mul(Float2_5));
+    EXPECT_ANY_THROW(None->mul(Float_23_74));
+    EXPECT_ANY_THROW(None->mul(StrEmpty));
+    EXPECT_ANY_THROW(None->mul(StrEmpty2));
+    EXPECT_ANY_THROW(None->mul(StrA));
+    EXPECT_ANY_THROW(None->mul(StrA2));
+    EXPECT_ANY_THROW(None->mul(StrB));
+    EXPECT_ANY_THROW(None->mul(ListEmpty));
+    EXPECT_ANY_THROW(None->mul(ListEmpty2));
+    EXPECT_ANY_THROW(None2->mul(None));
+    EXPECT_ANY_THROW(None2->mul(None2));
+    EXPECT_ANY_THROW(None2->mul(False));
+    EXPECT_ANY_THROW(None2->mul(False2));
+    EXPECT_ANY_THROW(None2->mul(True));
+    EXPECT_ANY_THROW(None2->mul(True2));
+    EXPECT_ANY_THROW(None2->mul(IntZero));
+    EXPECT_ANY_THROW(None2->mul(IntOne));
+    EXPECT_ANY_THROW(None2->mul(IntTwo));
+    EXPECT_ANY_THROW(None2->mul(IntTwo2));
+    EXPECT_ANY_THROW(None2->mul(Int8));
+    EXPECT_ANY_THROW(None2->mul(IntMinusOne));
+    EXPECT_ANY_THROW(None2->mul(IntMinusOne2));
+    EXPECT_ANY_THROW(None2->mul(IntMinus12));
+    EXPECT_ANY_THROW(None2->mul(IntMinus73));
+    EXPECT_ANY_THROW(None2->mul(FloatMinusOne));
+    EXPECT_ANY_THROW(None2->mul(FloatZero));
+    EXPECT_ANY_THROW(None2->mul(FloatOne));
+    EXPECT_ANY_THROW(None2->mul(FloatTwo));
+    EXPECT_ANY_THROW(None2->mul(FloatTwo2));
+    EXPECT_ANY_THROW(None2->mul(Float2_5));
+    EXPECT_ANY_THROW(None2->mul(Float_23_74));
+    EXPECT_ANY_THROW(None2->mul(StrEmpty));
+    EXPECT_ANY_THROW(None2->mul(StrEmpty2));
+    EXPECT_ANY_THROW(None2->mul(StrA));
+    EXPECT_ANY_THROW(None2->mul(StrA2));
+    EXPECT_ANY_THROW(None2->mul(StrB));
+    EXPECT_ANY_THROW(None2->mul(ListEmpty));
+    EXPECT_ANY_THROW(None2->mul(ListEmpty2));
+    EXPECT_ANY_THROW(False->mul(None));
+    EXPECT_ANY_THROW(False->mul(None2));
+    EXPECT_TRUE(False->mul(False)->strictly_equal(VAR(Int, 0)));
+    EXPECT_TRUE(False->mul(False2)->strictly_equal(VAR(Int, 0)));
+    EXPECT_TRUE(False->mul(True)->strictly_equal(VAR(Int, 0)));
+    EXPECT_TRUE(False->mul(True2)->strictly_equal(VAR(Int, 0)));
+    EXPECT_TRUE(False->mul(IntZero)->strictly_equal(VAR(Int, 0)));
+    EXPECT_TRUE(False->mul(IntOne)->strictly_equal(VAR(Int, 0)));
+    EXPECT_TRUE(False->mul(IntTwo)->strictly_equal(VAR(Int, 0)));
+    EXPECT_TRUE(False->mul(IntTwo2)->strictly_equal(VAR(Int, 0)));
+    EXPECT_TRUE(False->mul(Int8)->strictly_equal(VAR(Int, 0)));
+    EXPECT_TRUE(False->mul(IntMinusOne)->strictly_equal(VAR(Int, 0)));
+    EXPECT_TRUE(False->mul(IntMinusOne2)->strictly_equal(VAR(Int, 0)));
+    EXPECT_TRUE(False->mul(IntMinus12)->strictly_equal(VAR(Int, 0)));
+    EXPECT_TRUE(False->mul(IntMinus73)->strictly_equal(VAR(Int, 0)));
+    EXPECT_TRUE(False->mul(FloatMinusOne)->strictly_equal(VAR(Float, -0.0)));
+    EXPECT_TRUE(False->mul(FloatZero)->strictly_equal(VAR(Float, 0.0)));
+    EXPECT_TRUE(False->mul(FloatOne)->strictly_equal(VAR(Float, 0.0)));
+    EXPECT_TRUE(False->mul(FloatTwo)->strictly_equal(VAR(Float, 0.0)));
+    EXPECT_TRUE(False->mul(FloatTwo2)->strictly_equal(VAR(Float, 0.0)));
+    EXPECT_TRUE(False->mul(Float2_5)->strictly_equal(VAR(Float, 0.0)));
+    EXPECT_TRUE(False->mul(Float_23_74)->strictly_equal(VAR(Float, -0.0)));
+    EXPECT_TRUE(False->mul(StrEmpty)->strictly_equal(VAR(String, "")));
+    EXPECT_TRUE(False->mul(StrEmpty2)->strictly_equal(VAR(String, "")));
+    EXPECT_TRUE(False->mul(StrA)->strictly_equal(VAR(String, "")));
+    EXPECT_TRUE(False->mul(StrA2)->strictly_equal(VAR(String, "")));
+    EXPECT_TRUE(False->mul(StrB)->strictly_equal(VAR(String, "")));
+    EXPECT_TRUE(False->mul(ListEmpty)->strictly_equal(VAR(List, ListType())));
+    EXPECT_TRUE(False->mul(ListEmpty2)->strictly_equal(VAR(List, ListType())));
+    EXPECT_ANY_THROW(False2->mul(None));
+    EXPECT_ANY_THROW(False2->mul(None2));
+    EXPECT_TRUE(False2->mul(False)->strictly_equal(VAR(Int, 0)));
+    EXPECT_TRUE(False2->mul(False2)->strictly_equal(VAR(Int, 0)));
+    EXPECT_TRUE(False2->mul(True)->strictly_equal(VAR(Int, 0)));
+    EXPECT_TRUE(False2->mul(True2)->strictly_equal(VAR(Int, 0)));
+    EXPECT_TRUE(False2->mul(IntZero)->strictly_equal(VAR(Int, 0)));
+    EXPECT_TRUE(False2->mul(IntOne)->strictly_equal(VAR(Int, 0)));
+    EXPECT_TRUE(False2->mul(IntTwo)->strictly_equal(VAR(Int, 0)));
+    EXPECT_TRUE(False2->mul(IntTwo2)->strictly_equal(VAR(Int, 0)));
+    EXPECT_TRUE(False2->mul(Int8)->strictly_equal(VAR(Int, 0)));
+    EXPECT_TRUE(False2->mul(IntMinusOne)->strictly_equal(VAR(Int, 0)));
+    EXPECT_TRUE(False2->mul(IntMinusOne2)->strictly_equal(VAR(Int, 0)));
+    EXPECT_TRUE(False2->mul(IntMinus12)->strictly_equal(VAR(Int, 0)));
+    EXPECT_TRUE(False2->mul(IntMinus73)->strictly_equal(VAR(Int, 0)));
+    EXPECT_TRUE(False2->mul(FloatMinusOne)->strictly_equal(VAR(Float, -0.0)));
+    EXPECT_TRUE(False2->mul(FloatZero)->strictly_equal(VAR(Float, 0.0)));
+    EXPECT_TRUE(False2->mul(FloatOne)->strictly_equal(VAR(Float, 0.0)));
+    EXPECT_TRUE(False2->mul(FloatTwo)->strictly_equal(VAR(Float, 0.0)));
+    EXPECT_TRUE(False2->mul(FloatTwo2)->strictly_equal(VAR(Float, 0.0)));
+    EXPECT_TRUE(False2->mul(Float2_5)->strictly_equal(VAR(Float, 0.0)));
+    EXPECT_TRUE(False2->mul(Float_23_74)->strictly_equal(VAR(Float, -0.0)));
+    EXPECT_TRUE(False2->mul(StrEmpty)->strictly_equal(VAR(String, "")));
+    EXPECT_TRUE(False2->mul(StrEmpty2)->strictly_equal(VAR(String, "")));
+    EXPECT_TRUE(False2->mul(StrA)->strictly_equal(VAR(String, "")));
+    EXPECT_TRUE(False2->mul(StrA2)->strictly_equal(VAR(String, "")));
+    EXPECT_TRUE(False2->mul(StrB)->strictly_equal(VAR(String, "")));
+    EXPECT_TRUE(False2->mul(ListEmpty)->strictly_equal(VAR(List, ListType())));
+    EXPECT_TRUE(False2->mul(ListEmpty2)->strictly_equal(VAR(List, ListType())));
+    EXPECT_ANY_THROW(True->mul(None));
+    EXPECT_ANY_THROW(True->mul(None2));
+    EXPECT_TRUE(True->mul(False)->strictly_equal(VAR(Int, 0)));
+    EXPECT_TRUE(True->mul(False2)->strictly_equal(VAR(Int, 0)));
+    EXPECT_TRUE(True->mul(True)->strictly_equal(VAR(Int, 1)));
+    EXPECT_TRUE(True->mul(True2)->strictly_equal(VAR(Int, 1)));
+    EXPECT_TRUE(True->mul(IntZero)->strictly_equal(VAR(Int, 0)));
+    EXPECT_TRUE(True->mul(IntOne)->strictly_equal(VAR(Int, 1)));
+    EXPECT_TRUE(True->mul(IntTwo)->strictly_equal(VAR(Int, 2)));
+    EXPECT_TRUE(True->mul(IntTwo2)->strictly_equal(VAR(Int, 2)));
+    EXPECT_TRUE(True->mul(Int8)->strictly_equal(VAR(Int, 8)));
+    EXPECT_TRUE(True->mul(IntMinusOne)->strictly_equal(VAR(Int, -1)));
+    EXPECT_TRUE(True->mul(IntMinusOne2)->strictly_equal(VAR(Int, -1)));
+    EXPECT_TRUE(True->mul(IntMinus12)->strictly_equal(VAR(Int, -12)));
+    EXPECT_TRUE(True->mul(IntMinus73)->strictly_equal(VAR(Int, -73)));
+    EXPECT_TRUE(True->mul(FloatMinusOne)->strictly_equal(VAR(Float, -1.0)));
+    EXPECT_TRUE(True->mul(FloatZero)->strictly_equal(VAR(Float, 0.0)));
+    EXPECT_TRUE(True->mul(FloatOne)->strictly_equal(VAR(Float, 1.0)));
+    EXPECT_TRUE(True->mul(FloatTwo)->strictly_equal(VAR(Float, 2.0)));
+    EXPECT_TRUE(True->mul(FloatTwo2)->strictly_equal(VAR(Float, 2.0)));
+    EXPECT_TRUE(True->mul(Float2_5)->strictly_equal(VAR(Float, 2.5)));
+    EXPECT_TRUE(True->mul(Float_23_74)->strictly_equal(VAR(Float, -23.74)));
+    EXPECT_TRUE(True->mul(StrEmpty)->strictly_equal(VAR(String, "")));
+    EXPECT_TRUE(True->mul(StrEmpty2)->strictly_equal(VAR(String, "")));
+    EXPECT_TRUE(True->mul(StrA)->strictly_equal(VAR(String, "some text")));
+    EXPECT_TRUE(True->mul(StrA2)->strictly_equal(VAR(String, "some text")));
+    EXPECT_TRUE(True->mul(StrB)->strictly_equal(VAR(String, "other text")));
+    EXPECT_TRUE(True->mul(ListEmpty)->strictly_equal(VAR(List, ListType())));
+    EXPECT_TRUE(True->mul(ListEmpty2)->strictly_equal(VAR(List, ListType())));
+    EXPECT_ANY_THROW(True2->mul(None));
+    EXPECT_ANY_THROW(True2->mul(None2));
+    EXPECT_TRUE(True2->mul(False)->strictly_equal(VAR(Int, 0)));
+    EXPECT_TRUE(True2->mul(False2)->strictly_equal(VAR(Int, 0)));
+    EXPECT_TRUE(True2->mul(True)->strictly_equal(VAR(Int, 1)));
+    EXPECT_TRUE(True2->mul(True2)->strictly_equal(VAR(Int, 1)));
+    EXPECT_TRUE(True2->mul(IntZero)->strictly_equal(VAR(Int, 0)));
+    EXPECT_TRUE(True2->mul(IntOne)->strictly_equal(VAR(Int, 1)));
+    EXPECT_TRUE(True2->mul(IntTwo)->strictly_equal(VAR(Int, 2)));
+    EXPECT_TRUE(True2->mul(IntTwo2)->strictly_equal(VAR(Int, 2)));
+    EXPECT_TRUE(True2->mul(Int8)->strictly_equal(VAR(Int, 8)));
+    EXPECT_TRUE(True2->mul(IntMinusOne)->strictly_equal(VAR(Int, -1)));
+    EXPECT_TRUE(True2->mul(IntMinusOne2)->strictly_equal(VAR(Int, -1)));
+    EXPECT_TRUE(True2->mul(IntMinus12)->strictly_equal(VAR(Int, -12)));
+    EXPECT_TRUE(True2->mul(IntMinus73)->strictly_equal(VAR(Int, -73)));
+    EXPECT_TRUE(True2->mul(FloatMinusOne)->strictly_equal(VAR(Float, -1.0)));
+    EXPECT_TRUE(True2->mul(FloatZero)->strictly_equal(VAR(Float, 0.0)));
+    EXPECT_TRUE(True2->mul(FloatOne)->strictly_equal(VAR(Float, 1.0)));
+    EXPECT_TRUE(True2->mul(FloatTwo)->strictly_equal(VAR(Float, 2.0)));
+    EXPECT_TRUE(True2->mul(FloatTwo2)->strictly_equal(VAR(Float, 2.0)));
+    EXPECT_TRUE(True2->mul(Float2_5)->strictly_equal(VAR(Float, 2.5)));
+    EXPECT_TRUE(True2->mul(Float_23_74)->strictly_equal(VAR(Float, -23.74)));
+    EXPECT_TRUE(True2->mul(StrEmpty)->strictly_equal(VAR(String, "")));
+    EXPECT_TRUE(True2->mul(StrEmpty2)->strictly_equal(VAR(String, "")));
+    EXPECT_TRUE(True2->mul(StrA)->strictly_equal(VAR(String, "some text")));
+    EXPECT_TRUE(True2->mul(StrA2)->strictly_equal(VAR(String, "some text")));
+    EXPECT_TRUE(True2->mul(StrB)->strictly_equal(VAR(String, "other text")));
+    EXPECT_TRUE(True2->mul(ListEmpty)->strictly_equal(VAR(List, ListType())));
+    EXPECT_TRUE(True2->mul(ListEmpty2)->strictly_equal(VAR(List, ListType())));
+    EXPECT_ANY_THROW(IntZero->mul(None));
+    EXPECT_ANY_THROW(IntZero->mul(None2));
+    EXPECT_TRUE(IntZero->mul(False)->strictly_equal(VAR(Int, 0)));
+    EXPECT_TRUE(IntZero->mul(False2)->strictly_equal(VAR(Int, 0)));
+    EXPECT_TRUE(IntZero->mul(True)->strictly_equal(VAR(Int, 0)));
+    EXPECT_TRUE(IntZero->mul(True2)->strictly_equal(VAR(Int, 0)));
+    EXPECT_TRUE(IntZero->mul(IntZero)->strictly_equal(VAR(Int, 0)));
+    EXPECT_TRUE(IntZero->mul(IntOne)->strictly_equal(VAR(Int, 0)));
+    EXPECT_TRUE(IntZero->mul(IntTwo)->strictly_equal(VAR(Int, 0)));
+    EXPECT_TRUE(IntZero->mul(IntTwo2)->strictly_equal(VAR(Int, 0)));
+    EXPECT_TRUE(IntZero->mul(Int8)->strictly_equal(VAR(Int, 0)));
+    EXPECT_TRUE(IntZero->mul(IntMinusOne)->strictly_equal(VAR(Int, 0)));
+    EXPECT_TRUE(IntZero->mul(IntMinusOne2)->strictly_equal(VAR(Int, 0)));
+    EXPECT_TRUE(IntZero->mul(IntMinus12)->strictly_equal(VAR(Int, 0)));
+    EXPECT_TRUE(IntZero->mul(IntMinus73)->strictly_equal(VAR(Int, 0)));
+    EXPECT_TRUE(IntZero->mul(FloatMinusOne)->strictly_equal(VAR(Float, -0.0)));
+    EXPECT_TRUE(IntZero->mul(FloatZero)->strictly_equal(VAR(Float, 0.0)));
+    EXPECT_TRUE(IntZero->mul(FloatOne)->strictly_equal(VAR(Float, 0.0)));
+    EXPECT_TRUE(IntZero->mul(FloatTwo)->strictly_equal(VAR(Float, 0.0)));
+    EXPECT_TRUE(IntZero->mul(FloatTwo2)->strictly_equal(VAR(Float, 0.0)));
+    EXPECT_TRUE(IntZero->mul(Float2_5)->strictly_equal(VAR(Float, 0.0)));
+    EXPECT_TRUE(IntZero->mul(Float_23_74)->strictly_equal(VAR(Float, -0.0)));
+    EXPECT_TRUE(IntZero->mul(StrEmpty)->strictly_equal(VAR(String, "")));
+    EXPECT_TRUE(IntZero->mul(StrEmpty2)->strictly_equal(VAR(String, "")));
+    EXPECT_TRUE(IntZero->mul(StrA)->strictly_equal(VAR(String, "")));
+    EXPECT_TRUE(IntZero->mul(StrA2)->strictly_equal(VAR(String, "")));
+    EXPECT_TRUE(IntZero->mul(StrB)->strictly_equal(VAR(String, "")));
+    EXPECT_TRUE(IntZero->mul(ListEmpty)->strictly_equal(VAR(List, ListType())));
+    EXPECT_TRUE(IntZero->mul(ListEmpty2)->strictly_equal(VAR(List, ListType())));
+    EXPECT_ANY_THROW(IntOne->mul(None));
+    EXPECT_ANY_THROW(IntOne->mul(None2));
+    EXPECT_TRUE(IntOne->mul(False)->strictly_equal(VAR(Int, 0)));
+    EXPECT_TRUE(IntOne->mul(False2)->strictly_equal(VAR(Int, 0)));
+    EXPECT_TRUE(IntOne->mul(True)->strictly_equal(VAR(Int, 1)));
+    EXPECT_TRUE(IntOne->mul(True2)->strictly_equal(VAR(Int, 1)));
+    EXPECT_TRUE(IntOne->mul(IntZero)->strictly_equal(VAR(Int, 0)));
+    EXPECT_TRUE(IntOne->mul(IntOne)->strictly_equal(VAR(Int, 1)));
+    EXPECT_TRUE(IntOne->mul(IntTwo)->strictly_equal(VAR(Int, 2)));
+    EXPECT_TRUE(IntOne->mul(IntTwo2)->strictly_equal(VAR(Int, 2)));
+    EXPECT_TRUE(IntOne->mul(Int8)->strictly_equal(VAR(Int, 8)));
+    EXPECT_TRUE(IntOne->mul(IntMinusOne)->strictly_equal(VAR(Int, -1)));
+    EXPECT_TRUE(IntOne->mul(IntMinusOne2)->strictly_equal(VAR(Int, -1)));
+    EXPECT_TRUE(IntOne->mul(IntMinus12)->strictly_equal(VAR(Int, -12)));
+    EXPECT_TRUE(IntOne->mul(IntMinus73)->strictly_equal(VAR(Int, -73)));
+    EXPECT_TRUE(IntOne->mul(FloatMinusOne)->strictly_equal(VAR(Float, -1.0)));
+    EXPECT_TRUE(IntOne->mul(FloatZero)->strictly_equal(VAR(Float, 0.0)));
+    EXPECT_TRUE(IntOne->mul(FloatOne)->strictly_equal(VAR(Float, 1.0)));
+    EXPECT_TRUE(IntOne->mul(FloatTwo)->strictly_equal(VAR(Float, 2.0)));
+    EXPECT_TRUE(IntOne->mul(FloatTwo2)->strictly_equal(VAR(Float, 2.0)));
+    EXPECT_TRUE(IntOne->mul(Float2_5)->strictly_equal(VAR(Float, 2.5)));
+    EXPECT_TRUE(IntOne->mul(Float_23_74)->strictly_equal(VAR(Float, -23.74)));
+    EXPECT_TRUE(IntOne->mul(StrEmpty)->strictly_equal(VAR(String, "")));
+    EXPECT_TRUE(IntOne->mul(StrEmpty2)->strictly_equal(VAR(String, "")));
+    EXPECT_TRUE(IntOne->mul(StrA)->strictly_equal(VAR(String, "some text")));
+    EXPECT_TRUE(IntOne->mul(StrA2)->strictly_equal(VAR(String, "some text")));
+    EXPECT_TRUE(IntOne->mul(StrB)->strictly_equal(VAR(String, "other text")));
+    EXPECT_TRUE(IntOne->mul(ListEmpty)->strictly_equal(VAR(List, ListType())));
+    EXPECT_TRUE(IntOne->mul(ListEmpty2)->strictly_equal(VAR(List, ListType())));
+    EXPECT_ANY_THROW(IntTwo->mul(None));
+    EXPECT_ANY_THROW(IntTwo->mul(None2));
+    EXPECT_TRUE(IntTwo->mul(False)->strictly_equal(VAR(Int, 0)));
+    EXPECT_TRUE(IntTwo->mul(False2)->strictly_equal(VAR(Int, 0)));
+    EXPECT_TRUE(IntTwo->mul(True)->strictly_equal(VAR(Int, 2)));
+    EXPECT_TRUE(IntTwo->mul(True2)->strictly_equal(VAR(Int, 2)));
+    EXPECT_TRUE(IntTwo->mul(IntZero)->strictly_equal(VAR(Int, 0)));
+    EXPECT_TRUE(IntTwo->mul(IntOne)->strictly_equal(VAR(Int, 2)));
+    EXPECT_TRUE(IntTwo->mul(IntTwo)->strictly_equal(VAR(Int, 4)));
+    EXPECT_TRUE(IntTwo->mul(IntTwo2)->strictly_equal(VAR(Int, 4)));
+    EXPECT_TRUE(IntTwo->mul(Int8)->strictly_equal(VAR(Int, 16)));
+    EXPECT_TRUE(IntTwo->mul(IntMinusOne)->strictly_equal(VAR(Int, -2)));
+    EXPECT_TRUE(IntTwo->mul(IntMinusOne2)->strictly_equal(VAR(Int, -2)));
+    EXPECT_TRUE(IntTwo->mul(IntMinus12)->strictly_equal(VAR(Int, -24)));
+    EXPECT_TRUE(IntTwo->mul(IntMinus73)->strictly_equal(VAR(Int, -146)));
+    EXPECT_TRUE(IntTwo->mul(FloatMinusOne)->strictly_equal(VAR(Float, -2.0)));
+    EXPECT_TRUE(IntTwo->mul(FloatZero)->strictly_equal(VAR(Float, 0.0)));
+    EXPECT_TRUE(IntTwo->mul(FloatOne)->strictly_equal(VAR(Float, 2.0)));
+    EXPECT_TRUE(IntTwo->mul(FloatTwo)->strictly_equal(VAR(Float, 4.0)));
+    EXPECT_TRUE(IntTwo->mul(FloatTwo2)->strictly_equal(VAR(Float, 4.0)));
+    EXPECT_TRUE(IntTwo->mul(Float2_5)->strictly_equal(VAR(Float, 5.0)));
+    EXPECT_TRUE(IntTwo->mul(Float_23_74)->strictly_equal(VAR(Float, -47.48)));
+    EXPECT_TRUE(IntTwo->mul(StrEmpty)->strictly_equal(VAR(String, "")));
+    EXPECT_TRUE(IntTwo->mul(StrEmpty2)->strictly_equal(VAR(String, "")));
+    EXPECT_TRUE(IntTwo->mul(StrA)->strictly_equal(VAR(String, "some textsome text")));
+    EXPECT_TRUE(IntTwo->mul(StrA2)->strictly_equal(VAR(String, "some textsome text")));
+    EXPECT_TRUE(IntTwo->mul(StrB)->strictly_equal(VAR(String, "other textother text")));
+    EXPECT_TRUE(IntTwo->mul(ListEmpty)->strictly_equal(VAR(List, ListType())));
+    EXPECT_TRUE(IntTwo->mul(ListEmpty2)->strictly_equal(VAR(List, ListType())));
+    EXPECT_ANY_THROW(IntTwo2->mul(None));
+    EXPECT_ANY_THROW(IntTwo2->mul(None2));
+    EXPECT_TRUE(IntTwo2->mul(False)->strictly_equal(VAR(Int, 0)));
+    EXPECT_TRUE(IntTwo2->mul(False2)->strictly_equal(VAR(Int, 0)));
+    EXPECT_TRUE(IntTwo2->mul(True)->strictly_equal(VAR(Int, 2)));
+    EXPECT_TRUE(IntTwo2->mul(True2)->strictly_equal(VAR(Int, 2)));
+    EXPECT_TRUE(IntTwo2->mul(IntZero)->strictly_equal(VAR(Int, 0)));
+    EXPECT_TRUE(IntTwo2->mul(IntOne)->strictly_equal(VAR(Int, 2)));
+    EXPECT_TRUE(IntTwo2->mul(IntTwo)->strictly_equal(VAR(Int, 4)));
+    EXPECT_TRUE(IntTwo2->mul(IntTwo2)->strictly_equal(VAR(Int, 4)));
+    EXPECT_TRUE(IntTwo2->mul(Int8)->strictly_equal(VAR(Int, 16)));
+    EXPECT_TRUE(IntTwo2->mul(IntMinusOne)->strictly_equal(VAR(Int, -2)));
+    EXPECT_TRUE(IntTwo2->mul(IntMinusOne2)->strictly_equal(VAR(Int, -2)));
+    EXPECT_TRUE(IntTwo2->mul(IntMinus12)->strictly_equal(VAR(Int, -24)));
+    EXPECT_TRUE(IntTwo2->mul(IntMinus73)->strictly_equal(VAR(Int, -146)));
+    EXPECT_TRUE(IntTwo2->mul(FloatMinusOne)->strictly_equal(VAR(Float, -2.0)));
+    EXPECT_TRUE(IntTwo2->mul(FloatZero)->strictly_equal(VAR(Float, 0.0)));
+    EXPECT_TRUE(IntTwo2->mul(FloatOne)->strictly_equal(VAR(Float, 2.0)));
+    EXPECT_TRUE(IntTwo2->mul(FloatTwo)->strictly_equal(VAR(Float, 4.0)));
+    EXPECT_TRUE(IntTwo2->mul(FloatTwo2)->strictly_equal(VAR(Float, 4.0)));
+    EXPECT_TRUE(IntTwo2->mul(Float2_5)->strictly_equal(VAR(Float, 5.0)));
+    EXPECT_TRUE(IntTwo2->mul(Float_23_74)->strictly_equal(VAR(Float, -47.48)));
+    EXPECT_TRUE(IntTwo2->mul(StrEmpty)->strictly_equal(VAR(String, "")));
+    EXPECT_TRUE(IntTwo2->mul(StrEmpty2)->strictly_equal(VAR(String, "")));
+    EXPECT_TRUE(IntTwo2->mul(StrA)->strictly_equal(VAR(String, "some textsome text")));
+    EXPECT_TRUE(IntTwo2->mul(StrA2)->strictly_equal(VAR(String, "some textsome text")));
+    EXPECT_TRUE(IntTwo2->mul(StrB)->strictly_equal(VAR(String, "other textother text")));
+    EXPECT_TRUE(IntTwo2->mul(ListEmpty)->strictly_equal(VAR(List, ListType())));
+    EXPECT_TRUE(IntTwo2->mul(ListEmpty2)->strictly_equal(VAR(List, ListType())));
+    EXPECT_ANY_THROW(Int8->mul(None));
+    EXPECT_ANY_THROW(Int8->mul(None2));
+    EXPECT_TRUE(Int8->mul(False)->strictly_equal(VAR(Int, 0)));
+    EXPECT_TRUE(Int8->mul(False2)->strictly_equal(VAR(Int, 0)));
+    EXPECT_TRUE(Int8->mul(True)->strictly_equal(VAR(Int, 8)));
+    EXPECT_TRUE(Int8->mul(True2)->strictly_equal(VAR(Int, 8)));
+    EXPECT_TRUE(Int8->mul(IntZero)->strictly_equal(VAR(Int, 0)));
+    EXPECT_TRUE(Int8->mul(IntOne)->strictly_equal(VAR(Int, 8)));
+    EXPECT_TRUE(Int8->mul(IntTwo)->strictly_equal(VAR(Int, 16)));
+    EXPECT_TRUE(Int8->mul(IntTwo2)->strictly_equal(VAR(Int, 16)));
+    EXPECT_TRUE(Int8->mul(Int8)->strictly_equal(VAR(Int, 64)));
+    EXPECT_TRUE(Int8->mul(IntMinusOne)->strictly_equal(VAR(Int, -8)));
+    EXPECT_TRUE(Int8->mul(IntMinusOne2)->strictly_equal(VAR(Int, -8)));
+    EXPECT_TRUE(Int8->mul(IntMinus12)->strictly_equal(VAR(Int, -96)));
+    EXPECT_TRUE(Int8->mul(IntMinus73)->strictly_equal(VAR(Int, -584)));
+    EXPECT_TRUE(Int8->mul(FloatMinusOne)->strictly_equal(VAR(Float, -8.0)));
+    EXPECT_TRUE(Int8->mul(FloatZero)->strictly_equal(VAR(Float, 0.0)));
+    EXPECT_TRUE(Int8->mul(FloatOne)->strictly_equal(VAR(Float, 8.0)));
+    EXPECT_TRUE(Int8->mul(FloatTwo)->strictly_equal(VAR(Float, 16.0)));
+    EXPECT_TRUE(Int8->mul(FloatTwo2)->strictly_equal(VAR(Float, 16.0)));
+    EXPECT_TRUE(Int8->mul(Float2_5)->strictly_equal(VAR(Float, 20.0)));
+    EXPECT_TRUE(Int8->mul(Float_23_74)->strictly_equal(VAR(Float, -189.92)));
+    EXPECT_TRUE(Int8->mul(StrEmpty)->strictly_equal(VAR(String, "")));
+    EXPECT_TRUE(Int8->mul(StrEmpty2)->strictly_equal(VAR(String, "")));
+    EXPECT_TRUE(Int8->mul(StrA)->strictly_equal(VAR(String, "some textsome textsome textsome textsome textsome textsome textsome text")));
+    EXPECT_TRUE(Int8->mul(StrA2)->strictly_equal(VAR(String, "some textsome textsome textsome textsome textsome textsome textsome text")));
+    EXPECT_TRUE(Int8->mul(StrB)->strictly_equal(VAR(String, "other textother textother textother textother textother textother textother text")));
+    EXPECT_TRUE(Int8->mul(ListEmpty)->strictly_equal(VAR(List, ListType())));
+    EXPECT_TRUE(Int8->mul(ListEmpty2)->strictly_equal(VAR(List, ListType())));
+    EXPECT_ANY_THROW(IntMinusOne->mul(None));
+    EXPECT_ANY_THROW(IntMinusOne->mul(None2));
+    EXPECT_TRUE(IntMinusOne->mul(False)->strictly_equal(VAR(Int, 0)));
+    EXPECT_TRUE(IntMinusOne->mul(False2)->strictly_equal(VAR(Int, 0)));
+    EXPECT_TRUE(IntMinusOne->mul(True)->strictly_equal(VAR(Int, -1)));
+    EXPECT_TRUE(IntMinusOne->mul(True2)->strictly_equal(VAR(Int, -1)));
+    EXPECT_TRUE(IntMinusOne->mul(IntZero)->strictly_equal(VAR(Int, 0)));
+    EXPECT_TRUE(IntMinusOne->mul(IntOne)->strictly_equal(VAR(Int, -1)));
+    EXPECT_TRUE(IntMinusOne->mul(IntTwo)->strictly_equal(VAR(Int, -2)));
+    EXPECT_TRUE(IntMinusOne->mul(IntTwo2)->strictly_equal(VAR(Int, -2)));
+    EXPECT_TRUE(IntMinusOne->mul(Int8)->strictly_equal(VAR(Int, -8)));
+    EXPECT_TRUE(IntMinusOne->mul(IntMinusOne)->strictly_equal(VAR(Int, 1)));
+    EXPECT_TRUE(IntMinusOne->mul(IntMinusOne2)->strictly_equal(VAR(Int, 1)));
+    EXPECT_TRUE(IntMinusOne->mul(IntMinus12)->strictly_equal(VAR(Int, 12)));
+    EXPECT_TRUE(IntMinusOne->mul(IntMinus73)->strictly_equal(VAR(Int, 73)));
+    EXPECT_TRUE(IntMinusOne->mul(FloatMinusOne)->strictly_equal(VAR(Float, 1.0)));
+    EXPECT_TRUE(IntMinusOne->mul(FloatZero)->strictly_equal(VAR(Float, -0.0)));
+    EXPECT_TRUE(IntMinusOne->mul(FloatOne)->strictly_equal(VAR(Float, -1.0)));
+    EXPECT_TRUE(IntMinusOne->mul(FloatTwo)->strictly_equal(VAR(Float, -2.0)));
+    EXPECT_TRUE(IntMinusOne->mul(FloatTwo2)->strictly_equal(VAR(Float, -2.0)));
+    EXPECT_TRUE(IntMinusOne->mul(Float2_5)->strictly_equal(VAR(Float, -2.5)));
+    EXPECT_TRUE(IntMinusOne->mul(Float_23_74)->strictly_equal(VAR(Float, 23.74)));
+    EXPECT_TRUE(IntMinusOne->mul(StrEmpty)->strictly_equal(VAR(String, "")));
+    EXPECT_TRUE(IntMinusOne->mul(StrEmpty2)->strictly_equal(VAR(String, "")));
+    EXPECT_TRUE(IntMinusOne->mul(StrA)->strictly_equal(VAR(String, "")));
+    EXPECT_TRUE(IntMinusOne->mul(StrA2)->strictly_equal(VAR(String, "")));
+    EXPECT_TRUE(IntMinusOne->mul(StrB)->strictly_equal(VAR(String, "")));
+    EXPECT_TRUE(IntMinusOne->mul(ListEmpty)->strictly_equal(VAR(List, ListType())));
+    EXPECT_TRUE(IntMinusOne->mul(ListEmpty2)->strictly_equal(VAR(List, ListType())));
+    EXPECT_ANY_THROW(IntMinusOne2->mul(None));
+    EXPECT_ANY_THROW(IntMinusOne2->mul(None2));
+    EXPECT_TRUE(IntMinusOne2->mul(False)->strictly_equal(VAR(Int, 0)));
+    EXPECT_TRUE(IntMinusOne2->mul(False2)->strictly_equal(VAR(Int, 0)));
+    EXPECT_TRUE(IntMinusOne2->mul(True)->strictly_equal(VAR(Int, -1)));
+    EXPECT_TRUE(IntMinusOne2->mul(True2)->strictly_equal(VAR(Int, -1)));
+    EXPECT_TRUE(IntMinusOne2->mul(IntZero)->strictly_equal(VAR(Int, 0)));
+    EXPECT_TRUE(IntMinusOne2->mul(IntOne)->strictly_equal(VAR(Int, -1)));
+    EXPECT_TRUE(IntMinusOne2->mul(IntTwo)->strictly_equal(VAR(Int, -2)));
+    EXPECT_TRUE(IntMinusOne2->mul(IntTwo2)->strictly_equal(VAR(Int, -2)));
+    EXPECT_TRUE(IntMinusOne2->mul(Int8)->strictly_equal(VAR(Int, -8)));
+    EXPECT_TRUE(IntMinusOne2->mul(IntMinusOne)->strictly_equal(VAR(Int, 1)));
+    EXPECT_TRUE(IntMinusOne2->mul(IntMinusOne2)->strictly_equal(VAR(Int, 1)));
+    EXPECT_TRUE(IntMinusOne2->mul(IntMinus12)->strictly_equal(VAR(Int, 12)));
+    EXPECT_TRUE(IntMinusOne2->mul(IntMinus73)->strictly_equal(VAR(Int, 73)));
+    EXPECT_TRUE(IntMinusOne2->mul(FloatMinusOne)->strictly_equal(VAR(Float, 1.0)));
+    EXPECT_TRUE(IntMinusOne2->mul(FloatZero)->strictly_equal(VAR(Float, -0.0)));
+    EXPECT_TRUE(IntMinusOne2->mul(FloatOne)->strictly_equal(VAR(Float, -1.0)));
+    EXPECT_TRUE(IntMinusOne2->mul(FloatTwo)->strictly_equal(VAR(Float, -2.0)));
+    EXPECT_TRUE(IntMinusOne2->mul(FloatTwo2)->strictly_equal(VAR(Float, -2.0)));
+    EXPECT_TRUE(IntMinusOne2->mul(Float2_5)->strictly_equal(VAR(Float, -2.5)));
+    EXPECT_TRUE(IntMinusOne2->mul(Float_23_74)->strictly_equal(VAR(Float, 23.74)));
+    EXPECT_TRUE(IntMinusOne2->mul(StrEmpty)->strictly_equal(VAR(String, "")));
+    EXPECT_TRUE(IntMinusOne2->mul(StrEmpty2)->strictly_equal(VAR(String, "")));
+    EXPECT_TRUE(IntMinusOne2->mul(StrA)->strictly_equal(VAR(String, "")));
+    EXPECT_TRUE(IntMinusOne2->mul(StrA2)->strictly_equal(VAR(String, "")));
+    EXPECT_TRUE(IntMinusOne2->mul(StrB)->strictly_equal(VAR(String, "")));
+    EXPECT_TRUE(IntMinusOne2->mul(ListEmpty)->strictly_equal(VAR(List, ListType())));
+    EXPECT_TRUE(IntMinusOne2->mul(ListEmpty2)->strictly_equal(VAR(List, ListType())));
+    EXPECT_ANY_THROW(IntMinus12->mul(None));
+    EXPECT_ANY_THROW(IntMinus12->mul(None2));
+    EXPECT_TRUE(IntMinus12->mul(False)->strictly_equal(VAR(Int, 0)));
+    EXPECT_TRUE(IntMinus12->mul(False2)->strictly_equal(VAR(Int, 0)));
+    EXPECT_TRUE(IntMinus12->mul(True)->strictly_equal(VAR(Int, -12)));
+    EXPECT_TRUE(IntMinus12->mul(True2)->strictly_equal(VAR(Int, -12)));
+    EXPECT_TRUE(IntMinus12->mul(IntZero)->strictly_equal(VAR(Int, 0)));
+    EXPECT_TRUE(IntMinus12->mul(IntOne)->strictly_equal(VAR(Int, -12)));
+    EXPECT_TRUE(IntMinus12->mul(IntTwo)->strictly_equal(VAR(Int, -24)));
+    EXPECT_TRUE(IntMinus12->mul(IntTwo2)->strictly_equal(VAR(Int, -24)));
+    EXPECT_TRUE(IntMinus12->mul(Int8)->strictly_equal(VAR(Int, -96)));
+    EXPECT_TRUE(IntMinus12->mul(IntMinusOne)->strictly_equal(VAR(Int, 12)));
+    EXPECT_TRUE(IntMinus12->mul(IntMinusOne2)->strictly_equal(VAR(Int, 12)));
+    EXPECT_TRUE(IntMinus12->mul(IntMinus12)->strictly_equal(VAR(Int, 144)));
+    EXPECT_TRUE(IntMinus12->mul(IntMinus73)->strictly_equal(VAR(Int, 876)));
+    EXPECT_TRUE(IntMinus12->mul(FloatMinusOne)->strictly_equal(VAR(Float, 12.0)));
+    EXPECT_TRUE(IntMinus12->mul(FloatZero)->strictly_equal(VAR(Float, -0.0)));
+    EXPECT_TRUE(IntMinus12->mul(FloatOne)->strictly_equal(VAR(Float, -12.0)));
+    EXPECT_TRUE(IntMinus12->mul(FloatTwo)->strictly_equal(VAR(Float, -24.0)));
+    EXPECT_TRUE(IntMinus12->mul(FloatTwo2)->strictly_equal(VAR(Float, -24.0)));
+    EXPECT_TRUE(IntMinus12->mul(Float2_5)->strictly_equal(VAR(Float, -30.0)));
+    EXPECT_TRUE(IntMinus12->mul(Float_23_74)->strictly_equal(VAR(Float, 284.88)));
+    EXPECT_TRUE(IntMinus12->mul(StrEmpty)->strictly_equal(VAR(String, "")));
+    EXPECT_TRUE(IntMinus12->mul(StrEmpty2)->strictly_equal(VAR(String, "")));
+    EXPECT_TRUE(IntMinus12->mul(StrA)->strictly_equal(VAR(String, "")));
+    EXPECT_TRUE(IntMinus12->mul(StrA2)->strictly_equal(VAR(String, "")));
+    EXPECT_TRUE(IntMinus12->mul(StrB)->strictly_equal(VAR(String, "")));
+    EXPECT_TRUE(IntMinus12->mul(ListEmpty)->strictly_equal(VAR(List, ListType())));
+    EXPECT_TRUE(IntMinus12->mul(ListEmpty2)->strictly_equal(VAR(List, ListType())));
+    EXPECT_ANY_THROW(IntMinus73->mul(None));
+    EXPECT_ANY_THROW(IntMinus73->mul(None2));
+    EXPECT_TRUE(IntMinus73->mul(False)->strictly_equal(VAR(Int, 0)));
+    EXPECT_TRUE(IntMinus73->mul(False2)->strictly_equal(VAR(Int, 0)));
+    EXPECT_TRUE(IntMinus73->mul(True)->strictly_equal(VAR(Int, -73)));
+    EXPECT_TRUE(IntMinus73->mul(True2)->strictly_equal(VAR(Int, -73)));
+    EXPECT_TRUE(IntMinus73->mul(IntZero)->strictly_equal(VAR(Int, 0)));
+    EXPECT_TRUE(IntMinus73->mul(IntOne)->strictly_equal(VAR(Int, -73)));
+    EXPECT_TRUE(IntMinus73->mul(IntTwo)->strictly_equal(VAR(Int, -146)));
+    EXPECT_TRUE(IntMinus73->mul(IntTwo2)->strictly_equal(VAR(Int, -146)));
+    EXPECT_TRUE(IntMinus73->mul(Int8)->strictly_equal(VAR(Int, -584)));
+    EXPECT_TRUE(IntMinus73->mul(IntMinusOne)->strictly_equal(VAR(Int, 73)));
+    EXPECT_TRUE(IntMinus73->mul(IntMinusOne2)->strictly_equal(VAR(Int, 73)));
+    EXPECT_TRUE(IntMinus73->mul(IntMinus12)->strictly_equal(VAR(Int, 876)));
+    EXPECT_TRUE(IntMinus73->mul(IntMinus73)->strictly_equal(VAR(Int, 5329)));
+    EXPECT_TRUE(IntMinus73->mul(FloatMinusOne)->strictly_equal(VAR(Float, 73.0)));
+    EXPECT_TRUE(IntMinus73->mul(FloatZero)->strictly_equal(VAR(Float, -0.0)));
+    EXPECT_TRUE(IntMinus73->mul(FloatOne)->strictly_equal(VAR(Float, -73.0)));
+    EXPECT_TRUE(IntMinus73->mul(FloatTwo)->strictly_equal(VAR(Float, -146.0)));
+    EXPECT_TRUE(IntMinus73->mul(FloatTwo2)->strictly_equal(VAR(Float, -146.0)));
+    EXPECT_TRUE(IntMinus73->mul(Float2_5)->strictly_equal(VAR(Float, -182.5)));
+    EXPECT_TRUE(IntMinus73->mul(Float_23_74)->strictly_equal(VAR(Float, 1733.02)));
+    EXPECT_TRUE(IntMinus73->mul(StrEmpty)->strictly_equal(VAR(String, "")));
+    EXPECT_TRUE(IntMinus73->mul(StrEmpty2)->strictly_equal(VAR(String, "")));
+    EXPECT_TRUE(IntMinus73->mul(StrA)->strictly_equal(VAR(String, "")));
+    EXPECT_TRUE(IntMinus73->mul(StrA2)->strictly_equal(VAR(String, "")));
+    EXPECT_TRUE(IntMinus73->mul(StrB)->strictly_equal(VAR(String, "")));
+    EXPECT_TRUE(IntMinus73->mul(ListEmpty)->strictly_equal(VAR(List, ListType())));
+    EXPECT_TRUE(IntMinus73->mul(ListEmpty2)->strictly_equal(VAR(List, ListType())));
+    EXPECT_ANY_THROW(FloatMinusOne->mul(None));
+    EXPECT_ANY_THROW(FloatMinusOne->mul(None2));
+    EXPECT_TRUE(FloatMinusOne->mul(False)->strictly_equal(VAR(Float, -0.0)));
+    EXPECT_TRUE(FloatMinusOne->mul(False2)->strictly_equal(VAR(Float, -0.0)));
+    EXPECT_TRUE(FloatMinusOne->mul(True)->strictly_equal(VAR(Float, -1.0)));
+    EXPECT_TRUE(FloatMinusOne->mul(True2)->strictly_equal(VAR(Float, -1.0)));
+    EXPECT_TRUE(FloatMinusOne->mul(IntZero)->strictly_equal(VAR(Float, -0.0)));
+    EXPECT_TRUE(FloatMinusOne->mul(IntOne)->strictly_equal(VAR(Float, -1.0)));
+    EXPECT_TRUE(FloatMinusOne->mul(IntTwo)->strictly_equal(VAR(Float, -2.0)));
+    EXPECT_TRUE(FloatMinusOne->mul(IntTwo2)->strictly_equal(VAR(Float, -2.0)));
+    EXPECT_TRUE(FloatMinusOne->mul(Int8)->strictly_equal(VAR(Float, -8.0)));
+    EXPECT_TRUE(FloatMinusOne->mul(IntMinusOne)->strictly_equal(VAR(Float, 1.0)));
+    EXPECT_TRUE(FloatMinusOne->mul(IntMinusOne2)->strictly_equal(VAR(Float, 1.0)));
+    EXPECT_TRUE(FloatMinusOne->mul(IntMinus12)->strictly_equal(VAR(Float, 12.0)));
+    EXPECT_TRUE(FloatMinusOne->mul(IntMinus73)->strictly_equal(VAR(Float, 73.0)));
+    EXPECT_TRUE(FloatMinusOne->mul(FloatMinusOne)->strictly_equal(VAR(Float, 1.0)));
+    EXPECT_TRUE(FloatMinusOne->mul(FloatZero)->strictly_equal(VAR(Float, -0.0)));
+    EXPECT_TRUE(FloatMinusOne->mul(FloatOne)->strictly_equal(VAR(Float, -1.0)));
+    EXPECT_TRUE(FloatMinusOne->mul(FloatTwo)->strictly_equal(VAR(Float, -2.0)));
+    EXPECT_TRUE(FloatMinusOne->mul(FloatTwo2)->strictly_equal(VAR(Float, -2.0)));
+    EXPECT_TRUE(FloatMinusOne->mul(Float2_5)->strictly_equal(VAR(Float, -2.5)));
+    EXPECT_TRUE(FloatMinusOne->mul(Float_23_74)->strictly_equal(VAR(Float, 23.74)));
+    EXPECT_ANY_THROW(FloatMinusOne->mul(StrEmpty));
+    EXPECT_ANY_THROW(FloatMinusOne->mul(StrEmpty2));
+    EXPECT_ANY_THROW(FloatMinusOne->mul(StrA));
+    EXPECT_ANY_THROW(FloatMinusOne->mul(StrA2));
+    EXPECT_ANY_THROW(FloatMinusOne->mul(StrB));
+    EXPECT_ANY_THROW(FloatMinusOne->mul(ListEmpty));
+    EXPECT_ANY_THROW(FloatMinusOne->mul(ListEmpty2));
+    EXPECT_ANY_THROW(FloatZero->mul(None));
+    EXPECT_ANY_THROW(FloatZero->mul(None2));
+    EXPECT_TRUE(FloatZero->mul(False)->strictly_equal(VAR(Float, 0.0)));
+    EXPECT_TRUE(FloatZero->mul(False2)->strictly_equal(VAR(Float, 0.0)));
+    EXPECT_TRUE(FloatZero->mul(True)->strictly_equal(VAR(Float, 0.0)));
+    EXPECT_TRUE(FloatZero->mul(True2)->strictly_equal(VAR(Float, 0.0)));
+    EXPECT_TRUE(FloatZero->mul(IntZero)->strictly_equal(VAR(Float, 0.0)));
+    EXPECT_TRUE(FloatZero->mul(IntOne)->strictly_equal(VAR(Float, 0.0)));
+    EXPECT_TRUE(FloatZero->mul(IntTwo)->strictly_equal(VAR(Float, 0.0)));
+    EXPECT_TRUE(FloatZero->mul(IntTwo2)->strictly_equal(VAR(Float, 0.0)));
+    EXPECT_TRUE(FloatZero->mul(Int8)->strictly_equal(VAR(Float, 0.0)));
+    EXPECT_TRUE(FloatZero->mul(IntMinusOne)->strictly_equal(VAR(Float, -0.0)));
+    EXPECT_TRUE(FloatZero->mul(IntMinusOne2)->strictly_equal(VAR(Float, -0.0)));
+    EXPECT_TRUE(FloatZero->mul(IntMinus12)->strictly_equal(VAR(Float, -0.0)));
+    EXPECT_TRUE(FloatZero->mul(IntMinus73)->strictly_equal(VAR(Float, -0.0)));
+    EXPECT_TRUE(FloatZero->mul(FloatMinusOne)->strictly_equal(VAR(Float, -0.0)));
+    EXPECT_TRUE(FloatZero->mul(FloatZero)->strictly_equal(VAR(Float, 0.0)));
+    EXPECT_TRUE(FloatZero->mul(FloatOne)->strictly_equal(VAR(Float, 0.0)));
+    EXPECT_TRUE(FloatZero->mul(FloatTwo)->strictly_equal(VAR(Float, 0.0)));
+    EXPECT_TRUE(FloatZero->mul(FloatTwo2)->strictly_equal(VAR(Float, 0.0)));
+    EXPECT_TRUE(FloatZero->mul(Float2_5)->strictly_equal(VAR(Float, 0.0)));
+    EXPECT_TRUE(FloatZero->mul(Float_23_74)->strictly_equal(VAR(Float, -0.0)));
+    EXPECT_ANY_THROW(FloatZero->mul(StrEmpty));
+    EXPECT_ANY_THROW(FloatZero->mul(StrEmpty2));
+    EXPECT_ANY_THROW(FloatZero->mul(StrA));
+    EXPECT_ANY_THROW(FloatZero->mul(StrA2));
+    EXPECT_ANY_THROW(FloatZero->mul(StrB));
+    EXPECT_ANY_THROW(FloatZero->mul(ListEmpty));
+    EXPECT_ANY_THROW(FloatZero->mul(ListEmpty2));
+    EXPECT_ANY_THROW(FloatOne->mul(None));
+    EXPECT_ANY_THROW(FloatOne->mul(None2));
+    EXPECT_TRUE(FloatOne->mul(False)->strictly_equal(VAR(Float, 0.0)));
+    EXPECT_TRUE(FloatOne->mul(False2)->strictly_equal(VAR(Float, 0.0)));
+    EXPECT_TRUE(FloatOne->mul(True)->strictly_equal(VAR(Float, 1.0)));
+    EXPECT_TRUE(FloatOne->mul(True2)->strictly_equal(VAR(Float, 1.0)));
+    EXPECT_TRUE(FloatOne->mul(IntZero)->strictly_equal(VAR(Float, 0.0)));
+    EXPECT_TRUE(FloatOne->mul(IntOne)->strictly_equal(VAR(Float, 1.0)));
+    EXPECT_TRUE(FloatOne->mul(IntTwo)->strictly_equal(VAR(Float, 2.0)));
+    EXPECT_TRUE(FloatOne->mul(IntTwo2)->strictly_equal(VAR(Float, 2.0)));
+    EXPECT_TRUE(FloatOne->mul(Int8)->strictly_equal(VAR(Float, 8.0)));
+    EXPECT_TRUE(FloatOne->mul(IntMinusOne)->strictly_equal(VAR(Float, -1.0)));
+    EXPECT_TRUE(FloatOne->mul(IntMinusOne2)->strictly_equal(VAR(Float, -1.0)));
+    EXPECT_TRUE(FloatOne->mul(IntMinus12)->strictly_equal(VAR(Float, -12.0)));
+    EXPECT_TRUE(FloatOne->mul(IntMinus73)->strictly_equal(VAR(Float, -73.0)));
+    EXPECT_TRUE(FloatOne->mul(FloatMinusOne)->strictly_equal(VAR(Float, -1.0)));
+    EXPECT_TRUE(FloatOne->mul(FloatZero)->strictly_equal(VAR(Float, 0.0)));
+    EXPECT_TRUE(FloatOne->mul(FloatOne)->strictly_equal(VAR(Float, 1.0)));
+    EXPECT_TRUE(FloatOne->mul(FloatTwo)->strictly_equal(VAR(Float, 2.0)));
+    EXPECT_TRUE(FloatOne->mul(FloatTwo2)->strictly_equal(VAR(Float, 2.0)));
+    EXPECT_TRUE(FloatOne->mul(Float2_5)->strictly_equal(VAR(Float, 2.5)));
+    EXPECT_TRUE(FloatOne->mul(Float_23_74)->strictly_equal(VAR(Float, -23.74)));
+    EXPECT_ANY_THROW(FloatOne->mul(StrEmpty));
+    EXPECT_ANY_THROW(FloatOne->mul(StrEmpty2));
+    EXPECT_ANY_THROW(FloatOne->mul(StrA));
+    EXPECT_ANY_THROW(FloatOne->mul(StrA2));
+    EXPECT_ANY_THROW(FloatOne->mul(StrB));
+    EXPECT_ANY_THROW(FloatOne->mul(ListEmpty));
+    EXPECT_ANY_THROW(FloatOne->mul(ListEmpty2));
+    EXPECT_ANY_THROW(FloatTwo->mul(None));
+    EXPECT_ANY_THROW(FloatTwo->mul(None2));
+    EXPECT_TRUE(FloatTwo->mul(False)->strictly_equal(VAR(Float, 0.0)));
+    EXPECT_TRUE(FloatTwo->mul(False2)->strictly_equal(VAR(Float, 0.0)));
+    EXPECT_TRUE(FloatTwo->mul(True)->strictly_equal(VAR(Float, 2.0)));
+    EXPECT_TRUE(FloatTwo->mul(True2)->strictly_equal(VAR(Float, 2.0)));
+    EXPECT_TRUE(FloatTwo->mul(IntZero)->strictly_equal(VAR(Float, 0.0)));
+    EXPECT_TRUE(FloatTwo->mul(IntOne)->strictly_equal(VAR(Float, 2.0)));
+    EXPECT_TRUE(FloatTwo->mul(IntTwo)->strictly_equal(VAR(Float, 4.0)));
+    EXPECT_TRUE(FloatTwo->mul(IntTwo2)->strictly_equal(VAR(Float, 4.0)));
+    EXPECT_TRUE(FloatTwo->mul(Int8)->strictly_equal(VAR(Float, 16.0)));
+    EXPECT_TRUE(FloatTwo->mul(IntMinusOne)->strictly_equal(VAR(Float, -2.0)));
+    EXPECT_TRUE(FloatTwo->mul(IntMinusOne2)->strictly_equal(VAR(Float, -2.0)));
+    EXPECT_TRUE(FloatTwo->mul(IntMinus12)->strictly_equal(VAR(Float, -24.0)));
+    EXPECT_TRUE(FloatTwo->mul(IntMinus73)->strictly_equal(VAR(Float, -146.0)));
+    EXPECT_TRUE(FloatTwo->mul(FloatMinusOne)->strictly_equal(VAR(Float, -2.0)));
+    EXPECT_TRUE(FloatTwo->mul(FloatZero)->strictly_equal(VAR(Float, 0.0)));
+    EXPECT_TRUE(FloatTwo->mul(FloatOne)->strictly_equal(VAR(Float, 2.0)));
+    EXPECT_TRUE(FloatTwo->mul(FloatTwo)->strictly_equal(VAR(Float, 4.0)));
+    EXPECT_TRUE(FloatTwo->mul(FloatTwo2)->strictly_equal(VAR(Float, 4.0)));
+    EXPECT_TRUE(FloatTwo->mul(Float2_5)->strictly_equal(VAR(Float, 5.0)));
+    EXPECT_TRUE(FloatTwo->mul(Float_23_74)->strictly_equal(VAR(Float, -47.48)));
+    EXPECT_ANY_THROW(FloatTwo->mul(StrEmpty));
+    EXPECT_ANY_THROW(FloatTwo->mul(StrEmpty2));
+    EXPECT_ANY_THROW(FloatTwo->mul(StrA));
+    EXPECT_ANY_THROW(FloatTwo->mul(StrA2));
+    EXPECT_ANY_THROW(FloatTwo->mul(StrB));
+    EXPECT_ANY_THROW(FloatTwo->mul(ListEmpty));
+    EXPECT_ANY_THROW(FloatTwo->mul(ListEmpty2));
+    EXPECT_ANY_THROW(FloatTwo2->mul(None));
+    EXPECT_ANY_THROW(FloatTwo2->mul(None2));
+    EXPECT_TRUE(FloatTwo2->mul(False)->strictly_equal(VAR(Float, 0.0)));
+    EXPECT_TRUE(FloatTwo2->mul(False2)->strictly_equal(VAR(Float, 0.0)));
+    EXPECT_TRUE(FloatTwo2->mul(True)->strictly_equal(VAR(Float, 2.0)));
+    EXPECT_TRUE(FloatTwo2->mul(True2)->strictly_equal(VAR(Float, 2.0)));
+    EXPECT_TRUE(FloatTwo2->mul(IntZero)->strictly_equal(VAR(Float, 0.0)));
+    EXPECT_TRUE(FloatTwo2->mul(IntOne)->strictly_equal(VAR(Float, 2.0)));
+    EXPECT_TRUE(FloatTwo2->mul(IntTwo)->strictly_equal(VAR(Float, 4.0)));
+    EXPECT_TRUE(FloatTwo2->mul(IntTwo2)->strictly_equal(VAR(Float, 4.0)));
+    EXPECT_TRUE(FloatTwo2->mul(Int8)->strictly_equal(VAR(Float, 16.0)));
+    EXPECT_TRUE(FloatTwo2->mul(IntMinusOne)->strictly_equal(VAR(Float, -2.0)));
+    EXPECT_TRUE(FloatTwo2->mul(IntMinusOne2)->strictly_equal(VAR(Float, -2.0)));
+    EXPECT_TRUE(FloatTwo2->mul(IntMinus12)->strictly_equal(VAR(Float, -24.0)));
+    EXPECT_TRUE(FloatTwo2->mul(IntMinus73)->strictly_equal(VAR(Float, -146.0)));
+    EXPECT_TRUE(FloatTwo2->mul(FloatMinusOne)->strictly_equal(VAR(Float, -2.0)));
+    EXPECT_TRUE(FloatTwo2->mul(FloatZero)->strictly_equal(VAR(Float, 0.0)));
+    EXPECT_TRUE(FloatTwo2->mul(FloatOne)->strictly_equal(VAR(Float, 2.0)));
+    EXPECT_TRUE(FloatTwo2->mul(FloatTwo)->strictly_equal(VAR(Float, 4.0)));
+    EXPECT_TRUE(FloatTwo2->mul(FloatTwo2)->strictly_equal(VAR(Float, 4.0)));
+    EXPECT_TRUE(FloatTwo2->mul(Float2_5)->strictly_equal(VAR(Float, 5.0)));
+    EXPECT_TRUE(FloatTwo2->mul(Float_23_74)->strictly_equal(VAR(Float, -47.48)));
+    EXPECT_ANY_THROW(FloatTwo2->mul(StrEmpty));
+    EXPECT_ANY_THROW(FloatTwo2->mul(StrEmpty2));
+    EXPECT_ANY_THROW(FloatTwo2->mul(StrA));
+    EXPECT_ANY_THROW(FloatTwo2->mul(StrA2));
+    EXPECT_ANY_THROW(FloatTwo2->mul(StrB));
+    EXPECT_ANY_THROW(FloatTwo2->mul(ListEmpty));
+    EXPECT_ANY_THROW(FloatTwo2->mul(ListEmpty2));
+    EXPECT_ANY_THROW(Float2_5->mul(None));
+    EXPECT_ANY_THROW(Float2_5->mul(None2));
+    EXPECT_TRUE(Float2_5->mul(False)->strictly_equal(VAR(Float, 0.0)));
+    EXPECT_TRUE(Float2_5->mul(False2)->strictly_equal(VAR(Float, 0.0)));
+    EXPECT_TRUE(Float2_5->mul(True)->strictly_equal(VAR(Float, 2.5)));
+    EXPECT_TRUE(Float2_5->mul(True2)->strictly_equal(VAR(Float, 2.5)));
+    EXPECT_TRUE(Float2_5->mul(IntZero)->strictly_equal(VAR(Float, 0.0)));
+    EXPECT_TRUE(Float2_5->mul(IntOne)->strictly_equal(VAR(Float, 2.5)));
+    EXPECT_TRUE(Float2_5->mul(IntTwo)->strictly_equal(VAR(Float, 5.0)));
+    EXPECT_TRUE(Float2_5->mul(IntTwo2)->strictly_equal(VAR(Float, 5.0)));
+    EXPECT_TRUE(Float2_5->mul(Int8)->strictly_equal(VAR(Float, 20.0)));
+    EXPECT_TRUE(Float2_5->mul(IntMinusOne)->strictly_equal(VAR(Float, -2.5)));
+    EXPECT_TRUE(Float2_5->mul(IntMinusOne2)->strictly_equal(VAR(Float, -2.5)));
+    EXPECT_TRUE(Float2_5->mul(IntMinus12)->strictly_equal(VAR(Float, -30.0)));
+    EXPECT_TRUE(Float2_5->mul(IntMinus73)->strictly_equal(VAR(Float, -182.5)));
+    EXPECT_TRUE(Float2_5->mul(FloatMinusOne)->strictly_equal(VAR(Float, -2.5)));
+    EXPECT_TRUE(Float2_5->mul(FloatZero)->strictly_equal(VAR(Float, 0.0)));
+    EXPECT_TRUE(Float2_5->mul(FloatOne)->strictly_equal(VAR(Float, 2.5)));
+    EXPECT_TRUE(Float2_5->mul(FloatTwo)->strictly_equal(VAR(Float, 5.0)));
+    EXPECT_TRUE(Float2_5->mul(FloatTwo2)->strictly_equal(VAR(Float, 5.0)));
+    EXPECT_TRUE(Float2_5->mul(Float2_5)->strictly_equal(VAR(Float, 6.25)));
+    EXPECT_TRUE(Float2_5->mul(Float_23_74)->strictly_equal(VAR(Float, -59.349999999999994)));
+    EXPECT_ANY_THROW(Float2_5->mul(StrEmpty));
+    EXPECT_ANY_THROW(Float2_5->mul(StrEmpty2));
+    EXPECT_ANY_THROW(Float2_5->mul(StrA));
+    EXPECT_ANY_THROW(Float2_5->mul(StrA2));
+    EXPECT_ANY_THROW(Float2_5->mul(StrB));
+    EXPECT_ANY_THROW(Float2_5->mul(ListEmpty));
+    EXPECT_ANY_THROW(Float2_5->mul(ListEmpty2));
+    EXPECT_ANY_THROW(Float_23_74->mul(None));
+    EXPECT_ANY_THROW(Float_23_74->mul(None2));
+    EXPECT_TRUE(Float_23_74->mul(False)->strictly_equal(VAR(Float, -0.0)));
+    EXPECT_TRUE(Float_23_74->mul(False2)->strictly_equal(VAR(Float, -0.0)));
+    EXPECT_TRUE(Float_23_74->mul(True)->strictly_equal(VAR(Float, -23.74)));
+    EXPECT_TRUE(Float_23_74->mul(True2)->strictly_equal(VAR(Float, -23.74)));
+    EXPECT_TRUE(Float_23_74->mul(IntZero)->strictly_equal(VAR(Float, -0.0)));
+    EXPECT_TRUE(Float_23_74->mul(IntOne)->strictly_equal(VAR(Float, -23.74)));
+    EXPECT_TRUE(Float_23_74->mul(IntTwo)->strictly_equal(VAR(Float, -47.48)));
+    EXPECT_TRUE(Float_23_74->mul(IntTwo2)->strictly_equal(VAR(Float, -47.48)));
+    EXPECT_TRUE(Float_23_74->mul(Int8)->strictly_equal(VAR(Float, -189.92)));
+    EXPECT_TRUE(Float_23_74->mul(IntMinusOne)->strictly_equal(VAR(Float, 23.74)));
+    EXPECT_TRUE(Float_23_74->mul(IntMinusOne2)->strictly_equal(VAR(Float, 23.74)));
+    EXPECT_TRUE(Float_23_74->mul(IntMinus12)->strictly_equal(VAR(Float, 284.88)));
+    EXPECT_TRUE(Float_23_74->mul(IntMinus73)->strictly_equal(VAR(Float, 1733.02)));
+    EXPECT_TRUE(Float_23_74->mul(FloatMinusOne)->strictly_equal(VAR(Float, 23.74)));
+    EXPECT_TRUE(Float_23_74->mul(FloatZero)->strictly_equal(VAR(Float, -0.0)));
+    EXPECT_TRUE(Float_23_74->mul(FloatOne)->strictly_equal(VAR(Float, -23.74)));
+    EXPECT_TRUE(Float_23_74->mul(FloatTwo)->strictly_equal(VAR(Float, -47.48)));
+    EXPECT_TRUE(Float_23_74->mul(FloatTwo2)->strictly_equal(VAR(Float, -47.48)));
+    EXPECT_TRUE(Float_23_74->mul(Float2_5)->strictly_equal(VAR(Float, -59.349999999999994)));
+    EXPECT_TRUE(Float_23_74->mul(Float_23_74)->strictly_equal(VAR(Float, 563.5876)));
+    EXPECT_ANY_THROW(Float_23_74->mul(StrEmpty));
+    EXPECT_ANY_THROW(Float_23_74->mul(StrEmpty2));
+    EXPECT_ANY_THROW(Float_23_74->mul(StrA));
+    EXPECT_ANY_THROW(Float_23_74->mul(StrA2));
+    EXPECT_ANY_THROW(Float_23_74->mul(StrB));
+    EXPECT_ANY_THROW(Float_23_74->mul(ListEmpty));
+    EXPECT_ANY_THROW(Float_23_74->mul(ListEmpty2));
+    EXPECT_ANY_THROW(StrEmpty->mul(None));
+    EXPECT_ANY_THROW(StrEmpty->mul(None2));
+    EXPECT_TRUE(StrEmpty->mul(False)->strictly_equal(VAR(String, "")));
+    EXPECT_TRUE(StrEmpty->mul(False2)->strictly_equal(VAR(String, "")));
+    EXPECT_TRUE(StrEmpty->mul(True)->strictly_equal(VAR(String, "")));
+    EXPECT_TRUE(StrEmpty->mul(True2)->strictly_equal(VAR(String, "")));
+    EXPECT_TRUE(StrEmpty->mul(IntZero)->strictly_equal(VAR(String, "")));
+    EXPECT_TRUE(StrEmpty->mul(IntOne)->strictly_equal(VAR(String, "")));
+    EXPECT_TRUE(StrEmpty->mul(IntTwo)->strictly_equal(VAR(String, "")));
+    EXPECT_TRUE(StrEmpty->mul(IntTwo2)->strictly_equal(VAR(String, "")));
+    EXPECT_TRUE(StrEmpty->mul(Int8)->strictly_equal(VAR(String, "")));
+    EXPECT_TRUE(StrEmpty->mul(IntMinusOne)->strictly_equal(VAR(String, "")));
+    EXPECT_TRUE(StrEmpty->mul(IntMinusOne2)->strictly_equal(VAR(String, "")));
+    EXPECT_TRUE(StrEmpty->mul(IntMinus12)->strictly_equal(VAR(String, "")));
+    EXPECT_TRUE(StrEmpty->mul(IntMinus73)->strictly_equal(VAR(String, "")));
+    EXPECT_ANY_THROW(StrEmpty->mul(FloatMinusOne));
+    EXPECT_ANY_THROW(StrEmpty->mul(FloatZero));
+    EXPECT_ANY_THROW(StrEmpty->mul(FloatOne));
+    EXPECT_ANY_THROW(StrEmpty->mul(FloatTwo));
+    EXPECT_ANY_THROW(StrEmpty->mul(FloatTwo2));
+    EXPECT_ANY_THROW(StrEmpty->mul(Float2_5));
+    EXPECT_ANY_THROW(StrEmpty->mul(Float_23_74));
+    EXPECT_ANY_THROW(StrEmpty->mul(StrEmpty));
+    EXPECT_ANY_THROW(StrEmpty->mul(StrEmpty2));
+    EXPECT_ANY_THROW(StrEmpty->mul(StrA));
+    EXPECT_ANY_THROW(StrEmpty->mul(StrA2));
+    EXPECT_ANY_THROW(StrEmpty->mul(StrB));
+    EXPECT_ANY_THROW(StrEmpty->mul(ListEmpty));
+    EXPECT_ANY_THROW(StrEmpty->mul(ListEmpty2));
+    EXPECT_ANY_THROW(StrEmpty2->mul(None));
+    EXPECT_ANY_THROW(StrEmpty2->mul(None2));
+    EXPECT_TRUE(StrEmpty2->mul(False)->strictly_equal(VAR(String, "")));
+    EXPECT_TRUE(StrEmpty2->mul(False2)->strictly_equal(VAR(String, "")));
+    EXPECT_TRUE(StrEmpty2->mul(True)->strictly_equal(VAR(String, "")));
+    EXPECT_TRUE(StrEmpty2->mul(True2)->strictly_equal(VAR(String, "")));
+    EXPECT_TRUE(StrEmpty2->mul(IntZero)->strictly_equal(VAR(String, "")));
+    EXPECT_TRUE(StrEmpty2->mul(IntOne)->strictly_equal(VAR(String, "")));
+    EXPECT_TRUE(StrEmpty2->mul(IntTwo)->strictly_equal(VAR(String, "")));
+    EXPECT_TRUE(StrEmpty2->mul(IntTwo2)->strictly_equal(VAR(String, "")));
+    EXPECT_TRUE(StrEmpty2->mul(Int8)->strictly_equal(VAR(String, "")));
+    EXPECT_TRUE(StrEmpty2->mul(IntMinusOne)->strictly_equal(VAR(String, "")));
+    EXPECT_TRUE(StrEmpty2->mul(IntMinusOne2)->strictly_equal(VAR(String, "")));
+    EXPECT_TRUE(StrEmpty2->mul(IntMinus12)->strictly_equal(VAR(String, "")));
+    EXPECT_TRUE(StrEmpty2->mul(IntMinus73)->strictly_equal(VAR(String, "")));
+    EXPECT_ANY_THROW(StrEmpty2->mul(FloatMinusOne));
+    EXPECT_ANY_THROW(StrEmpty2->mul(FloatZero));
+    EXPECT_ANY_THROW(StrEmpty2->mul(FloatOne));
+    EXPECT_ANY_THROW(StrEmpty2->mul(FloatTwo));
+    EXPECT_ANY_THROW(StrEmpty2->mul(FloatTwo2));
+    EXPECT_ANY_THROW(StrEmpty2->mul(Float2_5));
+    EXPECT_ANY_THROW(StrEmpty2->mul(Float_23_74));
+    EXPECT_ANY_THROW(StrEmpty2->mul(StrEmpty));
+    EXPECT_ANY_THROW(StrEmpty2->mul(StrEmpty2));
+    EXPECT_ANY_THROW(StrEmpty2->mul(StrA));
+    EXPECT_ANY_THROW(StrEmpty2->mul(StrA2));
+    EXPECT_ANY_THROW(StrEmpty2->mul(StrB));
+    EXPECT_ANY_THROW(StrEmpty2->mul(ListEmpty));
+    EXPECT_ANY_THROW(StrEmpty2->mul(ListEmpty2));
+    EXPECT_ANY_THROW(StrA->mul(None));
+    EXPECT_ANY_THROW(StrA->mul(None2));
+    EXPECT_TRUE(StrA->mul(False)->strictly_equal(VAR(String, "")));
+    EXPECT_TRUE(StrA->mul(False2)->strictly_equal(VAR(String, "")));
+    EXPECT_TRUE(StrA->mul(True)->strictly_equal(VAR(String, "some text")));
+    EXPECT_TRUE(StrA->mul(True2)->strictly_equal(VAR(String, "some text")));
+    EXPECT_TRUE(StrA->mul(IntZero)->strictly_equal(VAR(String, "")));
+    EXPECT_TRUE(StrA->mul(IntOne)->strictly_equal(VAR(String, "some text")));
+    EXPECT_TRUE(StrA->mul(IntTwo)->strictly_equal(VAR(String, "some textsome text")));
+    EXPECT_TRUE(StrA->mul(IntTwo2)->strictly_equal(VAR(String, "some textsome text")));
+    EXPECT_TRUE(StrA->mul(Int8)->strictly_equal(VAR(String, "some textsome textsome textsome textsome textsome textsome textsome text")));
+    EXPECT_TRUE(StrA->mul(IntMinusOne)->strictly_equal(VAR(String, "")));
+    EXPECT_TRUE(StrA->mul(IntMinusOne2)->strictly_equal(VAR(String, "")));
+    EXPECT_TRUE(StrA->mul(IntMinus12)->strictly_equal(VAR(String, "")));
+    EXPECT_TRUE(StrA->mul(IntMinus73)->strictly_equal(VAR(String, "")));
+    EXPECT_ANY_THROW(StrA->mul(FloatMinusOne));
+    EXPECT_ANY_THROW(StrA->mul(FloatZero));
+    EXPECT_ANY_THROW(StrA->mul(FloatOne));
+    EXPECT_ANY_THROW(StrA->mul(FloatTwo));
+    EXPECT_ANY_THROW(StrA->mul(FloatTwo2));
+    EXPECT_ANY_THROW(StrA->mul(Float2_5));
+    EXPECT_ANY_THROW(StrA->mul(Float_23_74));
+    EXPECT_ANY_THROW(StrA->mul(StrEmpty));
+    EXPECT_ANY_THROW(StrA->mul(StrEmpty2));
+    EXPECT_ANY_THROW(StrA->mul(StrA));
+    EXPECT_ANY_THROW(StrA->mul(StrA2));
+    EXPECT_ANY_THROW(StrA->mul(StrB));
+    EXPECT_ANY_THROW(StrA->mul(ListEmpty));
+    EXPECT_ANY_THROW(StrA->mul(ListEmpty2));
+    EXPECT_ANY_THROW(StrA2->mul(None));
+    EXPECT_ANY_THROW(StrA2->mul(None2));
+    EXPECT_TRUE(StrA2->mul(False)->strictly_equal(VAR(String, "")));
+    EXPECT_TRUE(StrA2->mul(False2)->strictly_equal(VAR(String, "")));
+    EXPECT_TRUE(StrA2->mul(True)->strictly_equal(VAR(String, "some text")));
+    EXPECT_TRUE(StrA2->mul(True2)->strictly_equal(VAR(String, "some text")));
+    EXPECT_TRUE(StrA2->mul(IntZero)->strictly_equal(VAR(String, "")));
+    EXPECT_TRUE(StrA2->mul(IntOne)->strictly_equal(VAR(String, "some text")));
+    EXPECT_TRUE(StrA2->mul(IntTwo)->strictly_equal(VAR(String, "some textsome text")));
+    EXPECT_TRUE(StrA2->mul(IntTwo2)->strictly_equal(VAR(String, "some textsome text")));
+    EXPECT_TRUE(StrA2->mul(Int8)->strictly_equal(VAR(String, "some textsome textsome textsome textsome textsome textsome textsome text")));
+    EXPECT_TRUE(StrA2->mul(IntMinusOne)->strictly_equal(VAR(String, "")));
+    EXPECT_TRUE(StrA2->mul(IntMinusOne2)->strictly_equal(VAR(String, "")));
+    EXPECT_TRUE(StrA2->mul(IntMinus12)->strictly_equal(VAR(String, "")));
+    EXPECT_TRUE(StrA2->mul(IntMinus73)->strictly_equal(VAR(String, "")));
+    EXPECT_ANY_THROW(StrA2->mul(FloatMinusOne));
+    EXPECT_ANY_THROW(StrA2->mul(FloatZero));
+    EXPECT_ANY_THROW(StrA2->mul(FloatOne));
+    EXPECT_ANY_THROW(StrA2->mul(FloatTwo));
+    EXPECT_ANY_THROW(StrA2->mul(FloatTwo2));
+    EXPECT_ANY_THROW(StrA2->mul(Float2_5));
+    EXPECT_ANY_THROW(StrA2->mul(Float_23_74));
+    EXPECT_ANY_THROW(StrA2->mul(StrEmpty));
+    EXPECT_ANY_THROW(StrA2->mul(StrEmpty2));
+    EXPECT_ANY_THROW(StrA2->mul(StrA));
+    EXPECT_ANY_THROW(StrA2->mul(StrA2));
+    EXPECT_ANY_THROW(StrA2->mul(StrB));
+    EXPECT_ANY_THROW(StrA2->mul(ListEmpty));
+    EXPECT_ANY_THROW(StrA2->mul(ListEmpty2));
+    EXPECT_ANY_THROW(StrB->mul(None));
+    EXPECT_ANY_THROW(StrB->mul(None2));
+    EXPECT_TRUE(StrB->mul(False)->strictly_equal(VAR(String, "")));
+    EXPECT_TRUE(StrB->mul(False2)->strictly_equal(VAR(String, "")));
+    EXPECT_TRUE(StrB->mul(True)->strictly_equal(VAR(String, "other text")));
+    EXPECT_TRUE(StrB->mul(True2)->strictly_equal(VAR(String, "other text")));
+    EXPECT_TRUE(StrB->mul(IntZero)->strictly_equal(VAR(String, "")));
+    EXPECT_TRUE(StrB->mul(IntOne)->strictly_equal(VAR(String, "other text")));
+    EXPECT_TRUE(StrB->mul(IntTwo)->strictly_equal(VAR(String, "other textother text")));
+    EXPECT_TRUE(StrB->mul(IntTwo2)->strictly_equal(VAR(String, "other textother text")));
+    EXPECT_TRUE(StrB->mul(Int8)->strictly_equal(VAR(String, "other textother textother textother textother textother textother textother text")));
+    EXPECT_TRUE(StrB->mul(IntMinusOne)->strictly_equal(VAR(String, "")));
+    EXPECT_TRUE(StrB->mul(IntMinusOne2)->strictly_equal(VAR(String, "")));
+    EXPECT_TRUE(StrB->mul(IntMinus12)->strictly_equal(VAR(String, "")));
+    EXPECT_TRUE(StrB->mul(IntMinus73)->strictly_equal(VAR(String, "")));
+    EXPECT_ANY_THROW(StrB->mul(FloatMinusOne));
+    EXPECT_ANY_THROW(StrB->mul(FloatZero));
+    EXPECT_ANY_THROW(StrB->mul(FloatOne));
+    EXPECT_ANY_THROW(StrB->mul(FloatTwo));
+    EXPECT_ANY_THROW(StrB->mul(FloatTwo2));
+    EXPECT_ANY_THROW(StrB->mul(Float2_5));
+    EXPECT_ANY_THROW(StrB->mul(Float_23_74));
+    EXPECT_ANY_THROW(StrB->mul(StrEmpty));
+    EXPECT_ANY_THROW(StrB->mul(StrEmpty2));
+    EXPECT_ANY_THROW(StrB->mul(StrA));
+    EXPECT_ANY_THROW(StrB->mul(StrA2));
+    EXPECT_ANY_THROW(StrB->mul(StrB));
+    EXPECT_ANY_THROW(StrB->mul(ListEmpty));
+    EXPECT_ANY_THROW(StrB->mul(ListEmpty2));
+    EXPECT_ANY_THROW(ListEmpty->mul(None));
+    EXPECT_ANY_THROW(ListEmpty->mul(None2));
+    EXPECT_TRUE(ListEmpty->mul(False)->strictly_equal(VAR(List, ListType())));
+    EXPECT_TRUE(ListEmpty->mul(False2)->strictly_equal(VAR(List, ListType())));
+    EXPECT_TRUE(ListEmpty->mul(True)->strictly_equal(VAR(List, ListType())));
+    EXPECT_TRUE(ListEmpty->mul(True2)->strictly_equal(VAR(List, ListType())));
+    EXPECT_TRUE(ListEmpty->mul(IntZero)->strictly_equal(VAR(List, ListType())));
+    EXPECT_TRUE(ListEmpty->mul(IntOne)->strictly_equal(VAR(List, ListType())));
+    EXPECT_TRUE(ListEmpty->mul(IntTwo)->strictly_equal(VAR(List, ListType())));
+    EXPECT_TRUE(ListEmpty->mul(IntTwo2)->strictly_equal(VAR(List, ListType())));
+    EXPECT_TRUE(ListEmpty->mul(Int8)->strictly_equal(VAR(List, ListType())));
+    EXPECT_TRUE(ListEmpty->mul(IntMinusOne)->strictly_equal(VAR(List, ListType())));
+    EXPECT_TRUE(ListEmpty->mul(IntMinusOne2)->strictly_equal(VAR(List, ListType())));
+    EXPECT_TRUE(ListEmpty->mul(IntMinus12)->strictly_equal(VAR(List, ListType())));
+    EXPECT_TRUE(ListEmpty->mul(IntMinus73)->strictly_equal(VAR(List, ListType())));
+    EXPECT_ANY_THROW(ListEmpty->mul(FloatMinusOne));
+    EXPECT_ANY_THROW(ListEmpty->mul(FloatZero));
+    EXPECT_ANY_THROW(ListEmpty->mul(FloatOne));
+    EXPECT_ANY_THROW(ListEmpty->mul(FloatTwo));
+    EXPECT_ANY_THROW(ListEmpty->mul(FloatTwo2));
+    EXPECT_ANY_THROW(ListEmpty->mul(Float2_5));
+    EXPECT_ANY_THROW(ListEmpty->mul(Float_23_74));
+    EXPECT_ANY_THROW(ListEmpty->mul(StrEmpty));
+    EXPECT_ANY_THROW(ListEmpty->mul(StrEmpty2));
+    EXPECT_ANY_THROW(ListEmpty->mul(StrA));
+    EXPECT_ANY_THROW(ListEmpty->mul(StrA2));
+    EXPECT_ANY_THROW(ListEmpty->mul(StrB));
+    EXPECT_ANY_THROW(ListEmpty->mul(ListEmpty));
+    EXPECT_ANY_THROW(ListEmpty->mul(ListEmpty2));
+    EXPECT_ANY_THROW(ListEmpty2->mul(None));
+    EXPECT_ANY_THROW(ListEmpty2->mul(None2));
+    EXPECT_TRUE(ListEmpty2->mul(False)->strictly_equal(VAR(List, ListType())));
+    EXPECT_TRUE(ListEmpty2->mul(False2)->strictly_equal(VAR(List, ListType())));
+    EXPECT_TRUE(ListEmpty2->mul(True)->strictly_equal(VAR(List, ListType())));
+    EXPECT_TRUE(ListEmpty2->mul(True2)->strictly_equal(VAR(List, ListType())));
+    EXPECT_TRUE(ListEmpty2->mul(IntZero)->strictly_equal(VAR(List, ListType())));
+    EXPECT_TRUE(ListEmpty2->mul(IntOne)->strictly_equal(VAR(List, ListType())));
+    EXPECT_TRUE(ListEmpty2->mul(IntTwo)->strictly_equal(VAR(List, ListType())));
+    EXPECT_TRUE(ListEmpty2->mul(IntTwo2)->strictly_equal(VAR(List, ListType())));
+    EXPECT_TRUE(ListEmpty2->mul(Int8)->strictly_equal(VAR(List, ListType())));
+    EXPECT_TRUE(ListEmpty2->mul(IntMinusOne)->strictly_equal(VAR(List, ListType())));
+    EXPECT_TRUE(ListEmpty2->mul(IntMinusOne2)->strictly_equal(VAR(List, ListType())));
+    EXPECT_TRUE(ListEmpty2->mul(IntMinus12)->strictly_equal(VAR(List, ListType())));
+    EXPECT_TRUE(ListEmpty2->mul(IntMinus73)->strictly_equal(VAR(List, ListType())));
+    EXPECT_ANY_THROW(ListEmpty2->mul(FloatMinusOne));
+    EXPECT_ANY_THROW(ListEmpty2->mul(FloatZero));
+    EXPECT_ANY_THROW(ListEmpty2->mul(FloatOne));
+    EXPECT_ANY_THROW(ListEmpty2->mul(FloatTwo));
+    EXPECT_ANY_THROW(ListEmpty2->mul(FloatTwo2));
+    EXPECT_ANY_THROW(ListEmpty2->mul(Float2_5));
+    EXPECT_ANY_THROW(ListEmpty2->mul(Float_23_74));
+    EXPECT_ANY_THROW(ListEmpty2->mul(StrEmpty));
+    EXPECT_ANY_THROW(ListEmpty2->mul(StrEmpty2));
+    EXPECT_ANY_THROW(ListEmpty2->mul(StrA));
+    EXPECT_ANY_THROW(ListEmpty2->mul(StrA2));
+    EXPECT_ANY_THROW(ListEmpty2->mul(StrB));
+    EXPECT_ANY_THROW(ListEmpty2->mul(ListEmpty));
+    EXPECT_ANY_THROW(ListEmpty2->mul(ListEmpty2));
+}
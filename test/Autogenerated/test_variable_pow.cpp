@@ -0,0 +1,957 @@
+
+#include "variable/Variable.h"
+
+#include "Test.h"
+
+#define VAR(TYPE, VALUE) \
+    std::static_pointer_cast<GenericVariable>(std::make_shared<TYPE ## Variable>(VALUE))
+
+enum class OpReturningVar {
+    add,
+    sub,
+    mul,
+    div,
+    int_div,
+    pow,
+    mod,
+};
+
+enum class AssertResult {
+    PASS,
+    FAIL,
+    EXCEPTION,
+};
+
+static std::ostream& operator<< (std::ostream& os, AssertResult res) {
+    switch (res) {
+    case AssertResult::PASS:       os << "PASS";      break;
+    case AssertResult::FAIL:       os << "FAIL";      break;
+    case AssertResult::EXCEPTION:  os << "EXCEPTION"; break;
+    default:                       os << "???";
+    }
+    return os;
+}
+
+static Variable doOpReturningVar(Variable arg1, Variable arg2, OpReturningVar op) {
+    switch(op) {
+    case OpReturningVar::add: return arg1->add(arg2);
+    case OpReturningVar::sub: return arg1->sub(arg2);
+    case OpReturningVar::mul: return arg1->mul(arg2);
+    case OpReturningVar::div: return arg1->div(arg2);
+    case OpReturningVar::int_div: return arg1->int_div(arg2);
+    case OpReturningVar::mod: return arg1->mod(arg2);
+    case OpReturningVar::pow: return arg1->pow(arg2);
+    default: throw std::runtime_error("Bad op");
+    }
+}
+
+static void doOpReturningVarAndCompareResult(Variable arg1, Variable arg2, OpReturningVar op, Variable expected_res, AssertResult a_res, const char *descr) {
+    try {
+        auto res_var = doOpReturningVar(arg1, arg2, op);
+        auto assertion_result = res_var->strictly_equal(expected_res) ? AssertResult::PASS : AssertResult::FAIL;
+        if (assertion_result != a_res) {
+            std::cerr << descr << " returned " << assertion_result << " instead of " << a_res << "\n";
+        }
+    }
+    catch(...) {
+        if (a_res != AssertResult::EXCEPTION) {
+            std::cerr << descr << " returned EXCEPTION instead of " << a_res << "\n";
+        }
+    }
+}
+
+enum class OpReturningBool {
+    equal,
+    less,
+};
+
+static bool doOpReturningBool(Variable arg1, Variable arg2, OpReturningBool op) {
+    switch(op) {
+    case OpReturningBool::equal: return arg1->equal(arg2);
+    case OpReturningBool::less: return arg1->less(arg2);
+    default: throw std::runtime_error("Bad op");
+    }
+}
+
+static void doOpReturningBoolAndCompareResult(Variable arg1, Variable arg2, OpReturningBool op, bool expected_res, AssertResult a_res, const char *descr) {
+    try {
+        auto assertion_result = doOpReturningBool(arg1, arg2, op) ? AssertResult::PASS : AssertResult::FAIL;
+        if (assertion_result != a_res) {
+            std::cerr << descr << " returned " << assertion_result << " instead of " << a_res << "\n";
+        }
+    }
+    catch(...) {
+        if (a_res != AssertResult::EXCEPTION) {
+            std::cerr << descr << " returned EXCEPTION instead of " << a_res << "\n";
+        }
+    }
+}
+
+static auto None = std::static_pointer_cast<GenericVariable>(std::make_shared<NoneVariable>());
+static auto None2 = std::static_pointer_cast<GenericVariable>(std::make_shared<NoneVariable>());
+static auto False = VAR(Bool, false);
+static auto False2 = VAR(Bool, false);
+static auto True = VAR(Bool, true);
+static auto True2 = VAR(Bool, true);
+static auto IntZero = VAR(Int, 0);
+static auto IntOne = VAR(Int, 1);
+static auto IntTwo = VAR(Int, 2);
+static auto IntTwo2 = VAR(Int, 2);
+static auto Int8 = VAR(Int, 8);
+static auto IntMinusOne = VAR(Int, -1);
+static auto IntMinusOne2 = VAR(Int, -1);
+static auto IntMinus12 = VAR(Int, -12);
+static auto IntMinus73 = VAR(Int, -73);
+static auto FloatMinusOne = VAR(Float, -1);
+static auto FloatZero = VAR(Float, 0);
+static auto FloatOne = VAR(Float, 1);
+static auto FloatTwo = VAR(Float, 2);
+static auto FloatTwo2 = VAR(Float, 2);
+static auto Float2_5 = VAR(Float, 2.5);
+static auto Float_23_74 = VAR(Float, -23.74);
+static auto StrEmpty = VAR(String, "");
+static auto StrEmpty2 = VAR(String, "");
+static auto StrA = VAR(String, "some text");
+static auto StrA2 = VAR(String, "some text");
+static auto StrB = VAR(String, "other text");
+static auto ListEmpty = VAR(List, ListType());
+static auto ListEmpty2 = VAR(List, ListType());
+
+#include "variable/Variable.h"
+
+#include <gtest/gtest.h>
+
+class VariablePowTest: public testing::Test {
+};
+
+TEST_F(VariablePowTest, VariablePowTest) {
+    EXPECT_ANY_THROW(None->pow(None));
+    EXPECT_ANY_THROW(None->pow(None2));
+    EXPECT_ANY_THROW(None->pow(False));
+    EXPECT_ANY_THROW(None->pow(False2));
+    EXPECT_ANY_THROW(None->pow(True));
+    EXPECT_ANY_THROW(None->pow(True2));
+    EXPECT_ANY_THROW(None->pow(IntZero));
+    EXPECT_ANY_THROW(None->pow(IntOne));
+    EXPECT_ANY_THROW(None->pow(IntTwo));
+    EXPECT_ANY_THROW(None->pow(IntTwo2));
+    EXPECT_ANY_THROW(None->pow(Int8));
+    EXPECT_ANY_THROW(None->pow(IntMinusOne));
+    EXPECT_ANY_THROW(None->pow(IntMinusOne2));
+    EXPECT_ANY_THROW(None->pow(IntMinus12));
+    EXPECT_ANY_THROW(None->pow(IntMinus73));
+    EXPECT_ANY_THROW(None->pow(FloatMinusOne));
+    EXPECT_ANY_THROW(None->pow(FloatZero));
+    EXPECT_ANY_THROW(None->pow(FloatOne));
+    EXPECT_ANY_THROW(None->pow(FloatTwo));
+    EXPECT_ANY_THROW(None->pow(FloatTwo2));
+    EXPECT_ANY_THROW(None->pow(Float2_5));
+    EXPECT_ANY_THROW(None->pow(Float_23_74));
+    EXPECT_ANY_THROW(None->pow(StrEmpty));
+    EXPECT_ANY_THROW(None->pow(StrEmpty2));
+    EXPECT_ANY_THROW(None->pow(StrA));
+    EXPECT_ANY_THROW(None->pow(StrA2));
+    EXPECT_ANY_THROW(None->pow(StrB));
+    EXPECT_ANY_THROW(None->pow(ListEmpty));
+    EXPECT_ANY_THROW(None->pow(ListEmpty2));
+    EXPECT_ANY_THROW(None2->pow(None));
+    EXPECT_ANY_THROW(None2->pow(None2));
+    EXPECT_ANY_THROW(None2->pow(False));
+    EXPECT_ANY_THROW(None2->pow(False2));
+    EXPECT_ANY_THROW(None2->pow(True));
+    EXPECT_ANY_THROW(None2->pow(True2));
+    EXPECT_ANY_THROW(None2->pow(IntZero));
+    EXPECT_ANY_THROW(None2->pow(IntOne));
+    EXPECT_ANY_THROW(None2->pow(IntTwo));
+    EXPECT_ANY_THROW(None2->pow(IntTwo2));
+    EXPECT_ANY_THROW(None2->pow(Int8));
+    EXPECT_ANY_THROW(None2->pow(IntMinusOne));
+    EXPECT_ANY_THROW(None2->pow(IntMinusOne2));
+    EXPECT_ANY_THROW(None2->pow(IntMinus12));
+    EXPECT_ANY_THROW(None2->pow(IntMinus73));
+    EXPECT_ANY_THROW(None2->pow(FloatMinusOne));
+    EXPECT_ANY_THROW(None2->pow(FloatZero));
+    EXPECT_ANY_THROW(None2->pow(FloatOne));
+    EXPECT_ANY_THROW(None2->pow(FloatTwo));
+    EXPECT_ANY_THROW(None2->pow(FloatTwo2));
+    EXPECT_ANY_THROW(None2->pow(Float2_5));
+    EXPECT_ANY_THROW(None2->pow(Float_23_74));
+    EXPECT_ANY_THROW(None2->pow(StrEmpty));
+    EXPECT_ANY_THROW(None2->pow(StrEmpty2));
+    EXPECT_ANY_THROW(None2->pow(StrA));
+    EXPECT_ANY_THROW(None2->pow(StrA2));
+    EXPECT_ANY_THROW(None2->pow(StrB));
+    EXPECT_ANY_THROW(None2->pow(ListEmpty));
+    EXPECT_ANY_THROW(None2->pow(ListEmpty2));
+    EXPECT_ANY_THROW(False->pow(None));
+    EXPECT_ANY_THROW(False->pow(None2));
+    EXPECT_TRUE(False->pow(False)->strictly_equal(VAR(Int, 1)));
+    EXPECT_TRUE(False->pow(False2)->strictly_equal(VAR(Int, 1)));
+    EXPECT_TRUE(False->pow(True)->strictly_equal(VAR(Int, 0)));
+    EXPECT_TRUE(False->pow(True2)->strictly_equal(VAR(Int, 0)));
+    EXPECT_TRUE(False->pow(IntZero)->strictly_equal(VAR(Int, 1)));
+    EXPECT_TRUE(False->pow(IntOne)->strictly_equal(VAR(Int, 0)));
+    EXPECT_TRUE(False->pow(IntTwo)->strictly_equal(VAR(Int, 0)));
+    EXPECT_TRUE(False->pow(IntTwo2)->strictly_equal(VAR(Int, 0)));
+    EXPECT_TRUE(False->pow(Int8)->strictly_equal(VAR(Int, 0)));
+    EXPECT_ANY_THROW(False->pow(IntMinusOne));
+    EXPECT_ANY_THROW(False->pow(IntMinusOne2));
+    EXPECT_ANY_THROW(False->pow(IntMinus12));
+    EXPECT_ANY_THROW(False->pow(IntMinus73));
+    EXPECT_ANY_THROW(False->pow(FloatMinusOne));
+    EXPECT_TRUE(False->pow(FloatZero)->strictly_equal(VAR(Float, 1.0)));
+    EXPECT_TRUE(False->pow(FloatOne)->strictly_equal(VAR(Float, 0.0)));
+    EXPECT_TRUE(False->pow(FloatTwo)->strictly_equal(VAR(Float, 0.0)));
+    EXPECT_TRUE(False->pow(FloatTwo2)->strictly_equal(VAR(Float, 0.0)));
+    EXPECT_TRUE(False->pow(Float2_5)->strictly_equal(VAR(Float, 0.0)));
+    EXPECT_ANY_THROW(False->pow(Float_23_74));
+    EXPECT_ANY_THROW(False->pow(StrEmpty));
+    EXPECT_ANY_THROW(False->pow(StrEmpty2));
+    EXPECT_ANY_THROW(False->pow(StrA));
+    EXPECT_ANY_THROW(False->pow(StrA2));
+    EXPECT_ANY_THROW(False->pow(StrB));
+    EXPECT_ANY_THROW(False->pow(ListEmpty));
+    EXPECT_ANY_THROW(False->pow(ListEmpty2));
+    EXPECT_ANY_THROW(False2->pow(None));
+    EXPECT_ANY_THROW(False2->pow(None2));
+    EXPECT_TRUE(False2->pow(False)->strictly_equal(VAR(Int, 1)));
+    EXPECT_TRUE(False2->pow(False2)->strictly_equal(VAR(Int, 1)));
+    EXPECT_TRUE(False2->pow(True)->strictly_equal(VAR(Int, 0)));
+    EXPECT_TRUE(False2->pow(True2)->strictly_equal(VAR(Int, 0)));
+    EXPECT_TRUE(False2->pow(IntZero)->strictly_equal(VAR(Int, 1)));
+    EXPECT_TRUE(False2->pow(IntOne)->strictly_equal(VAR(Int, 0)));
+    EXPECT_TRUE(False2->pow(IntTwo)->strictly_equal(VAR(Int, 0)));
+    EXPECT_TRUE(False2->pow(IntTwo2)->strictly_equal(VAR(Int, 0)));
+    EXPECT_TRUE(False2->pow(Int8)->strictly_equal(VAR(Int, 0)));
+    EXPECT_ANY_THROW(False2->pow(IntMinusOne));
+    EXPECT_ANY_THROW(False2->pow(IntMinusOne2));
+    EXPECT_ANY_THROW(False2->pow(IntMinus12));
+    EXPECT_ANY_THROW(False2->pow(IntMinus73));
+    EXPECT_ANY_THROW(False2->pow(FloatMinusOne));
+    EXPECT_TRUE(False2->pow(FloatZero)->strictly_equal(VAR(Float, 1.0)));
+    EXPECT_TRUE(False2->pow(FloatOne)->strictly_equal(VAR(Float, 0.0)));
+    EXPECT_TRUE(False2->pow(FloatTwo)->strictly_equal(VAR(Float, 0.0)));
+    EXPECT_TRUE(False2->pow(FloatTwo2)->strictly_equal(VAR(Float, 0.0)));
+    EXPECT_TRUE(False2->pow(Float2_5)->strictly_equal(VAR(Float, 0.0)));
+    EXPECT_ANY_THROW(False2->pow(Float_23_74));
+    EXPECT_ANY_THROW(False2->pow(StrEmpty));
+    EXPECT_ANY_THROW(False2->pow(StrEmpty2));
+    EXPECT_ANY_THROW(False2->pow(StrA));
+    EXPECT_ANY_THROW(False2->pow(StrA2));
+    EXPECT_ANY_THROW(False2->pow(StrB));
+    EXPECT_ANY_THROW(False2->pow(ListEmpty));
+    EXPECT_ANY_THROW(False2->pow(ListEmpty2));
+    EXPECT_ANY_THROW(True->pow(None));
+    EXPECT_ANY_THROW(True->pow(None2));
+    EXPECT_TRUE(True->pow(False)->strictly_equal(VAR(Int, 1)));
+    EXPECT_TRUE(True->pow(False2)->strictly_equal(VAR(Int, 1)));
+    EXPECT_TRUE(True->pow(True)->strictly_equal(VAR(Int, 1)));
+    EXPECT_TRUE(True->pow(True2)->strictly_equal(VAR(Int, 1)));
+    EXPECT_TRUE(True->pow(IntZero)->strictly_equal(VAR(Int, 1)));
+    EXPECT_TRUE(True->pow(IntOne)->strictly_equal(VAR(Int, 1)));
+    EXPECT_TRUE(True->pow(IntTwo)->strictly_equal(VAR(Int, 1)));
+    EXPECT_TRUE(True->pow(IntTwo2)->strictly_equal(VAR(Int, 1)));
+    EXPECT_TRUE(True->pow(Int8)->strictly_equal(VAR(Int, 1)));
+    EXPECT_TRUE(True->pow(IntMinusOne)->strictly_equal(VAR(Float, 1.0)));
+    EXPECT_TRUE(True->pow(IntMinusOne2)->strictly_equal(VAR(Float, 1.0)));
+    EXPECT_TRUE(True->pow(IntMinus12)->strictly_equal(VAR(Float, 1.0)));
+    EXPECT_TRUE(True->pow(IntMinus73)->strictly_equal(VAR(Float, 1.0)));
+    EXPECT_TRUE(True->pow(FloatMinusOne)->strictly_equal(VAR(Float, 1.0)));
+    EXPECT_TRUE(True->pow(FloatZero)->strictly_equal(VAR(Float, 1.0)));
+    EXPECT_TRUE(True->pow(FloatOne)->strictly_equal(VAR(Float, 1.0)));
+    EXPECT_TRUE(True->pow(FloatTwo)->strictly_equal(VAR(Float, 1.0)));
+    EXPECT_TRUE(True->pow(FloatTwo2)->strictly_equal(VAR(Float, 1.0)));
+    EXPECT_TRUE(True->pow(Float2_5)->strictly_equal(VAR(Float, 1.0)));
+    EXPECT_TRUE(True->pow(Float_23_74)->strictly_equal(VAR(Float, 1.0)));
+    EXPECT_ANY_THROW(True->pow(StrEmpty));
+    EXPECT_ANY_THROW(True->pow(StrEmpty2));
+    EXPECT_ANY_THROW(True->pow(StrA));
+    EXPECT_ANY_THROW(True->pow(StrA2));
+    EXPECT_ANY_THROW(True->pow(StrB));
+    EXPECT_ANY_THROW(True->pow(ListEmpty));
+    EXPECT_ANY_THROW(True->pow(ListEmpty2));
+    EXPECT_ANY_THROW(True2->pow(None));
+    EXPECT_ANY_THROW(True2->pow(None2));
+    EXPECT_TRUE(True2->pow(False)->strictly_equal(VAR(Int, 1)));
+    EXPECT_TRUE(True2->pow(False2)->strictly_equal(VAR(Int, 1)));
+    EXPECT_TRUE(True2->pow(True)->strictly_equal(VAR(Int, 1)));
+    EXPECT_TRUE(True2->pow(True2)->strictly_equal(VAR(Int, 1)));
+    EXPECT_TRUE(True2->pow(IntZero)->strictly_equal(VAR(Int, 1)));
+    EXPECT_TRUE(True2->pow(IntOne)->strictly_equal(VAR(Int, 1)));
+    EXPECT_TRUE(True2->pow(IntTwo)->strictly_equal(VAR(Int, 1)));
+    EXPECT_TRUE(True2->pow(IntTwo2)->strictly_equal(VAR(Int, 1)));
+    EXPECT_TRUE(True2->pow(Int8)->strictly_equal(VAR(Int, 1)));
+    EXPECT_TRUE(True2->pow(IntMinusOne)->strictly_equal(VAR(Float, 1.0)));
+    EXPECT_TRUE(True2->pow(IntMinusOne2)->strictly_equal(VAR(Float, 1.0)));
+    EXPECT_TRUE(True2->pow(IntMinus12)->strictly_equal(VAR(Float, 1.0)));
+    EXPECT_TRUE(True2->pow(IntMinus73)->strictly_equal(VAR(Float, 1.0)));
+    EXPECT_TRUE(True2->pow(FloatMinusOne)->strictly_equal(VAR(Float, 1.0)));
+    EXPECT_TRUE(True2->pow(FloatZero)->strictly_equal(VAR(Float, 1.0)));
+    EXPECT_TRUE(True2->pow(FloatOne)->strictly_equal(VAR(Float, 1.0)));
+    EXPECT_TRUE(True2->pow(FloatTwo)->strictly_equal(VAR(Float, 1.0)));
+    EXPECT_TRUE(True2->pow(FloatTwo2)->strictly_equal(VAR(Float, 1.0)));
+    EXPECT_TRUE(True2->pow(Float2_5)->strictly_equal(VAR(Float, 1.0)));
+    EXPECT_TRUE(True2->pow(Float_23_74)->strictly_equal(VAR(Float, 1.0)));
+    EXPECT_ANY_THROW(True2->pow(StrEmpty));
+    EXPECT_ANY_THROW(True2->pow(StrEmpty2));
+    EXPECT_ANY_THROW(True2->pow(StrA));
+    EXPECT_ANY_THROW(True2->pow(StrA2));
+    EXPECT_ANY_THROW(True2->pow(StrB));
+    EXPECT_ANY_THROW(True2->pow(ListEmpty));
+    EXPECT_ANY_THROW(True2->pow(ListEmpty2));
+    EXPECT_ANY_THROW(IntZero->pow(None));
+    EXPECT_ANY_THROW(IntZero->pow(None2));
+    EXPECT_TRUE(IntZero->pow(False)->strictly_equal(VAR(Int, 1)));
+    EXPECT_TRUE(IntZero->pow(False2)->strictly_equal(VAR(Int, 1)));
+    EXPECT_TRUE(IntZero->pow(True)->strictly_equal(VAR(Int, 0)));
+    EXPECT_TRUE(IntZero->pow(True2)->strictly_equal(VAR(Int, 0)));
+    EXPECT_TRUE(IntZero->pow(IntZero)->strictly_equal(VAR(Int, 1)));
+    EXPECT_TRUE(IntZero->pow(IntOne)->strictly_equal(VAR(Int, 0)));
+    EXPECT_TRUE(IntZero->pow(IntTwo)->strictly_equal(VAR(Int, 0)));
+    EXPECT_TRUE(IntZero->pow(IntTwo2)->strictly_equal(VAR(Int, 0)));
+    EXPECT_TRUE(IntZero->pow(Int8)->strictly_equal(VAR(Int, 0)));
+    EXPECT_ANY_THROW(IntZero->pow(IntMinusOne));
+    EXPECT_ANY_THROW(IntZero->pow(IntMinusOne2));
+    EXPECT_ANY_THROW(IntZero->pow(IntMinus12));
+    EXPECT_ANY_THROW(IntZero->pow(IntMinus73));
+    EXPECT_ANY_THROW(IntZero->pow(FloatMinusOne));
+    EXPECT_TRUE(IntZero->pow(FloatZero)->strictly_equal(VAR(Float, 1.0)));
+    EXPECT_TRUE(IntZero->pow(FloatOne)->strictly_equal(VAR(Float, 0.0)));
+    EXPECT_TRUE(IntZero->pow(FloatTwo)->strictly_equal(VAR(Float, 0.0)));
+    EXPECT_TRUE(IntZero->pow(FloatTwo2)->strictly_equal(VAR(Float, 0.0)));
+    EXPECT_TRUE(IntZero->pow(Float2_5)->strictly_equal(VAR(Float, 0.0)));
+    EXPECT_ANY_THROW(IntZero->pow(Float_23_74));
+    EXPECT_ANY_THROW(IntZero->pow(StrEmpty));
+    EXPECT_ANY_THROW(IntZero->pow(StrEmpty2));
+    EXPECT_ANY_THROW(IntZero->pow(StrA));
+    EXPECT_ANY_THROW(IntZero->pow(StrA2));
+    EXPECT_ANY_THROW(IntZero->pow(StrB));
+    EXPECT_ANY_THROW(IntZero->pow(ListEmpty));
+    EXPECT_ANY_THROW(IntZero->pow(ListEmpty2));
+    EXPECT_ANY_THROW(IntOne->pow(None));
+    EXPECT_ANY_THROW(IntOne->pow(None2));
+    EXPECT_TRUE(IntOne->pow(False)->strictly_equal(VAR(Int, 1)));
+    EXPECT_TRUE(IntOne->pow(False2)->strictly_equal(VAR(Int, 1)));
+    EXPECT_TRUE(IntOne->pow(True)->strictly_equal(VAR(Int, 1)));
+    EXPECT_TRUE(IntOne->pow(True2)->strictly_equal(VAR(Int, 1)));
+    EXPECT_TRUE(IntOne->pow(IntZero)->strictly_equal(VAR(Int, 1)));
+    EXPECT_TRUE(IntOne->pow(IntOne)->strictly_equal(VAR(Int, 1)));
+    EXPECT_TRUE(IntOne->pow(IntTwo)->strictly_equal(VAR(Int, 1)));
+    EXPECT_TRUE(IntOne->pow(IntTwo2)->strictly_equal(VAR(Int, 1)));
+    EXPECT_TRUE(IntOne->pow(Int8)->strictly_equal(VAR(Int, 1)));
+    EXPECT_TRUE(IntOne->pow(IntMinusOne)->strictly_equal(VAR(Float, 1.0)));
+    EXPECT_TRUE(IntOne->pow(IntMinusOne2)->strictly_equal(VAR(Float, 1.0)));
+    EXPECT_TRUE(IntOne->pow(IntMinus12)->strictly_equal(VAR(Float, 1.0)));
+    EXPECT_TRUE(IntOne->pow(IntMinus73)->strictly_equal(VAR(Float, 1.0)));
+    EXPECT_TRUE(IntOne->pow(FloatMinusOne)->strictly_equal(VAR(Float, 1.0)));
+    EXPECT_TRUE(IntOne->pow(FloatZero)->strictly_equal(VAR(Float, 1.0)));
+    EXPECT_TRUE(IntOne->pow(FloatOne)->strictly_equal(VAR(Float, 1.0)));
+    EXPECT_TRUE(IntOne->pow(FloatTwo)->strictly_equal(VAR(Float, 1.0)));
+    EXPECT_TRUE(IntOne->pow(FloatTwo2)->strictly_equal(VAR(Float, 1.0)));
+    EXPECT_TRUE(IntOne->pow(Float2_5)->strictly_equal(VAR(Float, 1.0)));
+    EXPECT_TRUE(IntOne->pow(Float_23_74)->strictly_equal(VAR(Float, 1.0)));
+    EXPECT_ANY_THROW(IntOne->pow(StrEmpty));
+    EXPECT_ANY_THROW(IntOne->pow(StrEmpty2));
+    EXPECT_ANY_THROW(IntOne->pow(StrA));
+    EXPECT_ANY_THROW(IntOne->pow(StrA2));
+    EXPECT_ANY_THROW(IntOne->pow(StrB));
+    EXPECT_ANY_THROW(IntOne->pow(ListEmpty));
+    EXPECT_ANY_THROW(IntOne->pow(ListEmpty2));
+    EXPECT_ANY_THROW(IntTwo->pow(None));
+    EXPECT_ANY_THROW(IntTwo->pow(None2));
+    EXPECT_TRUE(IntTwo->pow(False)->strictly_equal(VAR(Int, 1)));
+    EXPECT_TRUE(IntTwo->pow(False2)->strictly_equal(VAR(Int, 1)));
+    EXPECT_TRUE(IntTwo->pow(True)->strictly_equal(VAR(Int, 2)));
+    EXPECT_TRUE(IntTwo->pow(True2)->strictly_equal(VAR(Int, 2)));
+    EXPECT_TRUE(IntTwo->pow(IntZero)->strictly_equal(VAR(Int, 1)));
+    EXPECT_TRUE(IntTwo->pow(IntOne)->strictly_equal(VAR(Int, 2)));
+    EXPECT_TRUE(IntTwo->pow(IntTwo)->strictly_equal(VAR(Int, 4)));
+    EXPECT_TRUE(IntTwo->pow(IntTwo2)->strictly_equal(VAR(Int, 4)));
+    EXPECT_TRUE(IntTwo->pow(Int8)->strictly_equal(VAR(Int, 256)));
+    EXPECT_TRUE(IntTwo->pow(IntMinusOne)->strictly_equal(VAR(Float, 0.5)));
+    EXPECT_TRUE(IntTwo->pow(IntMinusOne2)->strictly_equal(VAR(Float, 0.5)));
+    EXPECT_TRUE(IntTwo->pow(IntMinus12)->strictly_equal(VAR(Float, 0.000244140625)));
+    EXPECT_TRUE(IntTwo->pow(IntMinus73)->strictly_equal(VAR(Float, 1.0587911840678754e-22)));
+    EXPECT_TRUE(IntTwo->pow(FloatMinusOne)->strictly_equal(VAR(Float, 0.5)));
+    EXPECT_TRUE(IntTwo->pow(FloatZero)->strictly_equal(VAR(Float, 1.0)));
+    EXPECT_TRUE(IntTwo->pow(FloatOne)->strictly_equal(VAR(Float, 2.0)));
+    EXPECT_TRUE(IntTwo->pow(FloatTwo)->strictly_equal(VAR(Float, 4.0)));
+    EXPECT_TRUE(IntTwo->pow(FloatTwo2)->strictly_equal(VAR(Float, 4.0)));
+    EXPECT_TRUE(IntTwo->pow(Float2_5)->strictly_equal(VAR(Float, 5.656854249492381)));
+    EXPECT_TRUE(IntTwo->pow(Float_23_74)->strictly_equal(VAR(Float, 7.137529281490623e-08)));
+    EXPECT_ANY_THROW(IntTwo->pow(StrEmpty));
+    EXPECT_ANY_THROW(IntTwo->pow(StrEmpty2));
+    EXPECT_ANY_THROW(IntTwo->pow(StrA));
+    EXPECT_ANY_THROW(IntTwo->pow(StrA2));
+    EXPECT_ANY_THROW(IntTwo->pow(StrB));
+    EXPECT_ANY_THROW(IntTwo->pow(ListEmpty));
+    EXPECT_ANY_THROW(IntTwo->pow(ListEmpty2));
+    EXPECT_ANY_THROW(IntTwo2->pow(None));
+    EXPECT_ANY_THROW(IntTwo2->pow(None2));
+    EXPECT_TRUE(IntTwo2->pow(False)->strictly_equal(VAR(Int, 1)));
+    EXPECT_TRUE(IntTwo2->pow(False2)->strictly_equal(VAR(Int, 1)));
+    EXPECT_TRUE(IntTwo2->pow(True)->strictly_equal(VAR(Int, 2)));
+    EXPECT_TRUE(IntTwo2->pow(True2)->strictly_equal(VAR(Int, 2)));
+    EXPECT_TRUE(IntTwo2->pow(IntZero)->strictly_equal(VAR(Int, 1)));
+    EXPECT_TRUE(IntTwo2->pow(IntOne)->strictly_equal(VAR(Int, 2)));
+    EXPECT_TRUE(IntTwo2->pow(IntTwo)->strictly_equal(VAR(Int, 4)));
+    EXPECT_TRUE(IntTwo2->pow(IntTwo2)->strictly_equal(VAR(Int, 4)));
+    EXPECT_TRUE(IntTwo2->pow(Int8)->strictly_equal(VAR(Int, 256)));
+    EXPECT_TRUE(IntTwo2->pow(IntMinusOne)->strictly_equal(VAR(Float, 0.5)));
+    EXPECT_TRUE(IntTwo2->pow(IntMinusOne2)->strictly_equal(VAR(Float, 0.5)));
+    EXPECT_TRUE(IntTwo2->pow(IntMinus12)->strictly_equal(VAR(Float, 0.000244140625)));
+    EXPECT_TRUE(IntTwo2->pow(IntMinus73)->strictly_equal(VAR(Float, 1.0587911840678754e-22)));
+    EXPECT_TRUE(IntTwo2->pow(FloatMinusOne)->strictly_equal(VAR(Float, 0.5)));
+    EXPECT_TRUE(IntTwo2->pow(FloatZero)->strictly_equal(VAR(Float, 1.0)));
+    EXPECT_TRUE(IntTwo2->pow(FloatOne)->strictly_equal(VAR(Float, 2.0)));
+    EXPECT_TRUE(IntTwo2->pow(FloatTwo)->strictly_equal(VAR(Float, 4.0)));
+    EXPECT_TRUE(IntTwo2->pow(FloatTwo2)->strictly_equal(VAR(Float, 4.0)));
+    EXPECT_TRUE(IntTwo2->pow(Float2_5)->strictly_equal(VAR(Float, 5.656854249492381)));
+    EXPECT_TRUE(IntTwo2->pow(Float_23_74)->strictly_equal(VAR(Float, 7.137529281490623e-08)));
+    EXPECT_ANY_THROW(IntTwo2->pow(StrEmpty));
+    EXPECT_ANY_THROW(IntTwo2->pow(StrEmpty2));
+    EXPECT_ANY_THROW(IntTwo2->pow(StrA));
+    EXPECT_ANY_THROW(IntTwo2->pow(StrA2));
+    EXPECT_ANY_THROW(IntTwo2->pow(StrB));
+    EXPECT_ANY_THROW(IntTwo2->pow(ListEmpty));
+    EXPECT_ANY_THROW(IntTwo2->pow(ListEmpty2));
+    EXPECT_ANY_THROW(Int8->pow(None));
+    EXPECT_ANY_THROW(Int8->pow(None2));
+    EXPECT_TRUE(Int8->pow(False)->strictly_equal(VAR(Int, 1)));
+    EXPECT_TRUE(Int8->pow(False2)->strictly_equal(VAR(Int, 1)));
+    EXPECT_TRUE(Int8->pow(True)->strictly_equal(VAR(Int, 8)));
+    EXPECT_TRUE(Int8->pow(True2)->strictly_equal(VAR(Int, 8)));
+    EXPECT_TRUE(Int8->pow(IntZero)->strictly_equal(VAR(Int, 1)));
+    EXPECT_TRUE(Int8->pow(IntOne)->strictly_equal(VAR(Int, 8)));
+    EXPECT_TRUE(Int8->pow(IntTwo)->strictly_equal(VAR(Int, 64)));
+    EXPECT_TRUE(Int8->pow(IntTwo2)->strictly_equal(VAR(Int, 64)));
+    EXPECT_TRUE(Int8->pow(Int8)->strictly_equal(VAR(Int, 16777216)));
+    EXPECT_TRUE(Int8->pow(IntMinusOne)->strictly_equal(VAR(Float, 0.125)));
+    EXPECT_TRUE(Int8->pow(IntMinusOne2)->strictly_equal(VAR(Float, 0.125)));
+    EXPECT_TRUE(Int8->pow(IntMinus12)->strictly_equal(VAR(Float, 1.4551915228366852e-11)));
+    EXPECT_TRUE(Int8->pow(IntMinus73)->strictly_equal(VAR(Float, 1.1869459682199748e-66)));
+    EXPECT_TRUE(Int8->pow(FloatMinusOne)->strictly_equal(VAR(Float, 0.125)));
+    EXPECT_TRUE(Int8->pow(FloatZero)->strictly_equal(VAR(Float, 1.0)));
+    EXPECT_TRUE(Int8->pow(FloatOne)->strictly_equal(VAR(Float, 8.0)));
+    EXPECT_TRUE(Int8->pow(FloatTwo)->strictly_equal(VAR(Float, 64.0)));
+    EXPECT_TRUE(Int8->pow(FloatTwo2)->strictly_equal(VAR(Float, 64.0)));
+    EXPECT_TRUE(Int8->pow(Float2_5)->strictly_equal(VAR(Float, 181.01933598375618)));
+    EXPECT_TRUE(Int8->pow(Float_23_74)->strictly_equal(VAR(Float, 3.636166060182738e-22)));
+    EXPECT_ANY_THROW(Int8->pow(StrEmpty));
+    EXPECT_ANY_THROW(Int8->pow(StrEmpty2));
+    EXPECT_ANY_THROW(Int8->pow(StrA));
+    EXPECT_ANY_THROW(Int8->pow(StrA2));
+    EXPECT_ANY_THROW(Int8->pow(StrB));
+    EXPECT_ANY_THROW(Int8->pow(ListEmpty));
+    EXPECT_ANY_THROW(Int8->pow(ListEmpty2));
+    EXPECT_ANY_THROW(IntMinusOne->pow(None));
+    EXPECT_ANY_THROW(IntMinusOne->pow(None2));
+    EXPECT_TRUE(IntMinusOne->pow(False)->strictly_equal(VAR(Int, 1)));
+    EXPECT_TRUE(IntMinusOne->pow(False2)->strictly_equal(VAR(Int, 1)));
+    EXPECT_TRUE(IntMinusOne->pow(True)->strictly_equal(VAR(Int, -1)));
+    EXPECT_TRUE(IntMinusOne->pow(True2)->strictly_equal(VAR(Int, -1)));
+    EXPECT_TRUE(IntMinusOne->pow(IntZero)->strictly_equal(VAR(Int, 1)));
+    EXPECT_TRUE(IntMinusOne->pow(IntOne)->strictly_equal(VAR(Int, -1)));
+    EXPECT_TRUE(IntMinusOne->pow(IntTwo)->strictly_equal(VAR(Int, 1)));
+    EXPECT_TRUE(IntMinusOne->pow(IntTwo2)->strictly_equal(VAR(Int, 1)));
+    EXPECT_TRUE(IntMinusOne->pow(Int8)->strictly_equal(VAR(Int, 1)));
+    EXPECT_TRUE(IntMinusOne->pow(IntMinusOne)->strictly_equal(VAR(Float, -1.0)));
+    EXPECT_TRUE(IntMinusOne->pow(IntMinusOne2)->strictly_equal(VAR(Float, -1.0)));
+    EXPECT_TRUE(IntMinusOne->pow(IntMinus12)->strictly_equal(VAR(Float, 1.0)));
+    EXPECT_TRUE(IntMinusOne->pow(IntMinus73)->strictly_equal(VAR(Float, -1.0)));
+    EXPECT_TRUE(IntMinusOne->pow(FloatMinusOne)->strictly_equal(VAR(Float, -1.0)));
+    EXPECT_TRUE(IntMinusOne->pow(FloatZero)->strictly_equal(VAR(Float, 1.0)));
+    EXPECT_TRUE(IntMinusOne->pow(FloatOne)->strictly_equal(VAR(Float, -1.0)));
+    EXPECT_TRUE(IntMinusOne->pow(FloatTwo)->strictly_equal(VAR(Float, 1.0)));
+    EXPECT_TRUE(IntMinusOne->pow(FloatTwo2)->strictly_equal(VAR(Float, 1.0)));
+    EXPECT_ANY_THROW(IntMinusOne->pow(StrEmpty));
+    EXPECT_ANY_THROW(IntMinusOne->pow(StrEmpty2));
+    EXPECT_ANY_THROW(IntMinusOne->pow(StrA));
+    EXPECT_ANY_THROW(IntMinusOne->pow(StrA2));
+    EXPECT_ANY_THROW(IntMinusOne->pow(StrB));
+    EXPECT_ANY_THROW(IntMinusOne->pow(ListEmpty));
+    EXPECT_ANY_THROW(IntMinusOne->pow(ListEmpty2));
+    EXPECT_ANY_THROW(IntMinusOne2->pow(None));
+    EXPECT_ANY_THROW(IntMinusOne2->pow(None2));
+    EXPECT_TRUE(IntMinusOne2->pow(False)->strictly_equal(VAR(Int, 1)));
+    EXPECT_TRUE(IntMinusOne2->pow(False2)->strictly_equal(VAR(Int, 1)));
+    EXPECT_TRUE(IntMinusOne2->pow(True)->strictly_equal(VAR(Int, -1)));
+    EXPECT_TRUE(IntMinusOne2->pow(True2)->strictly_equal(VAR(Int, -1)));
+    EXPECT_TRUE(IntMinusOne2->pow(IntZero)->strictly_equal(VAR(Int, 1)));
+    EXPECT_TRUE(IntMinusOne2->pow(IntOne)->strictly_equal(VAR(Int, -1)));
+    EXPECT_TRUE(IntMinusOne2->pow(IntTwo)->strictly_equal(VAR(Int, 1)));
+    EXPECT_TRUE(IntMinusOne2->pow(IntTwo2)->strictly_equal(VAR(Int, 1)));
+    EXPECT_TRUE(IntMinusOne2->pow(Int8)->strictly_equal(VAR(Int, 1)));
+    EXPECT_TRUE(IntMinusOne2->pow(IntMinusOne)->strictly_equal(VAR(Float, -1.0)));
+    EXPECT_TRUE(IntMinusOne2->pow(IntMinusOne2)->strictly_equal(VAR(Float, -1.0)));
+    EXPECT_TRUE(IntMinusOne2->pow(IntMinus12)->strictly_equal(VAR(Float, 1.0)));
+    EXPECT_TRUE(IntMinusOne2->pow(IntMinus73)->strictly_equal(VAR(Float, -1.0)));
+    EXPECT_TRUE(IntMinusOne2->pow(FloatMinusOne)->strictly_equal(VAR(Float, -1.0)));
+    EXPECT_TRUE(IntMinusOne2->pow(FloatZero)->strictly_equal(VAR(Float, 1.0)));
+    EXPECT_TRUE(IntMinusOne2->pow(FloatOne)->strictly_equal(VAR(Float, -1.0)));
+    EXPECT_TRUE(IntMinusOne2->pow(FloatTwo)->strictly_equal(VAR(Float, 1.0)));
+    EXPECT_TRUE(IntMinusOne2->pow(FloatTwo2)->strictly_equal(VAR(Float, 1.0)));
+    EXPECT_ANY_THROW(IntMinusOne2->pow(StrEmpty));
+    EXPECT_ANY_THROW(IntMinusOne2->pow(StrEmpty2));
+    EXPECT_ANY_THROW(IntMinusOne2->pow(StrA));
+    EXPECT_ANY_THROW(IntMinusOne2->pow(StrA2));
+    EXPECT_ANY_THROW(IntMinusOne2->pow(StrB));
+    EXPECT_ANY_THROW(IntMinusOne2->pow(ListEmpty));
+    EXPECT_ANY_THROW(IntMinusOne2->pow(ListEmpty2));
+    EXPECT_ANY_THROW(IntMinus12->pow(None));
+    EXPECT_ANY_THROW(IntMinus12->pow(None2));
+    EXPECT_TRUE(IntMinus12->pow(False)->strictly_equal(VAR(Int, 1)));
+    EXPECT_TRUE(IntMinus12->pow(False2)->strictly_equal(VAR(Int, 1)));
+    EXPECT_TRUE(IntMinus12->pow(True)->strictly_equal(VAR(Int, -12)));
+    EXPECT_TRUE(IntMinus12->pow(True2)->strictly_equal(VAR(Int, -12)));
+    EXPECT_TRUE(IntMinus12->pow(IntZero)->strictly_equal(VAR(Int, 1)));
+    EXPECT_TRUE(IntMinus12->pow(IntOne)->strictly_equal(VAR(Int, -12)));
+    EXPECT_TRUE(IntMinus12->pow(IntTwo)->strictly_equal(VAR(Int, 144)));
+    EXPECT_TRUE(IntMinus12->pow(IntTwo2)->strictly_equal(VAR(Int, 144)));
+    EXPECT_TRUE(IntMinus12->pow(Int8)->strictly_equal(VAR(Int, 429981696)));
+    EXPECT_TRUE(IntMinus12->pow(IntMinusOne)->strictly_equal(VAR(Float, -0.08333333333333333)));
+    EXPECT_TRUE(IntMinus12->pow(IntMinusOne2)->strictly_equal(VAR(Float, -0.08333333333333333)));
+    EXPECT_TRUE(IntMinus12->pow(IntMinus12)->strictly_equal(VAR(Float, 1.1215665478461509e-13)));
+    EXPECT_TRUE(IntMinus12->pow(IntMinus73)->strictly_equal(VAR(Float, -1.658704559732305e-79)));
+    EXPECT_TRUE(IntMinus12->pow(FloatMinusOne)->strictly_equal(VAR(Float, -0.08333333333333333)));
+    EXPECT_TRUE(IntMinus12->pow(FloatZero)->strictly_equal(VAR(Float, 1.0)));
+    EXPECT_TRUE(IntMinus12->pow(FloatOne)->strictly_equal(VAR(Float, -12.0)));
+    EXPECT_TRUE(IntMinus12->pow(FloatTwo)->strictly_equal(VAR(Float, 144.0)));
+    EXPECT_TRUE(IntMinus12->pow(FloatTwo2)->strictly_equal(VAR(Float, 144.0)));
+    EXPECT_ANY_THROW(IntMinus12->pow(StrEmpty));
+    EXPECT_ANY_THROW(IntMinus12->pow(StrEmpty2));
+    EXPECT_ANY_THROW(IntMinus12->pow(StrA));
+    EXPECT_ANY_THROW(IntMinus12->pow(StrA2));
+    EXPECT_ANY_THROW(IntMinus12->pow(StrB));
+    EXPECT_ANY_THROW(IntMinus12->pow(ListEmpty));
+    EXPECT_ANY_THROW(IntMinus12->pow(ListEmpty2));
+    EXPECT_ANY_THROW(IntMinus73->pow(None));
+    EXPECT_ANY_THROW(IntMinus73->pow(None2));
+    EXPECT_TRUE(IntMinus73->pow(False)->strictly_equal(VAR(Int, 1)));
+    EXPECT_TRUE(IntMinus73->pow(False2)->strictly_equal(VAR(Int, 1)));
+    EXPECT_TRUE(IntMinus73->pow(True)->strictly_equal(VAR(Int, -73)));
+    EXPECT_TRUE(IntMinus73->pow(True2)->strictly_equal(VAR(Int, -73)));
+    EXPECT_TRUE(IntMinus73->pow(IntZero)->strictly_equal(VAR(Int, 1)));
+    EXPECT_TRUE(IntMinus73->pow(IntOne)->strictly_equal(VAR(Int, -73)));
+    EXPECT_TRUE(IntMinus73->pow(IntTwo)->strictly_equal(VAR(Int, 5329)));
+    EXPECT_TRUE(IntMinus73->pow(IntTwo2)->strictly_equal(VAR(Int, 5329)));
+    EXPECT_TRUE(IntMinus73->pow(Int8)->strictly_equal(VAR(Int, 806460091894081)));
+    EXPECT_TRUE(IntMinus73->pow(IntMinusOne)->strictly_equal(VAR(Float, -0.0136986301369863)));
+    EXPECT_TRUE(IntMinus73->pow(IntMinusOne2)->strictly_equal(VAR(Float, -0.0136986301369863)));
+    EXPECT_TRUE(IntMinus73->pow(IntMinus12)->strictly_equal(VAR(Float, 4.366421719009755e-23)));
+    EXPECT_TRUE(IntMinus73->pow(IntMinus73)->strictly_equal(VAR(Float, -9.493606161186191e-137)));
+    EXPECT_TRUE(IntMinus73->pow(FloatMinusOne)->strictly_equal(VAR(Float, -0.0136986301369863)));
+    EXPECT_TRUE(IntMinus73->pow(FloatZero)->strictly_equal(VAR(Float, 1.0)));
+    EXPECT_TRUE(IntMinus73->pow(FloatOne)->strictly_equal(VAR(Float, -73.0)));
+    EXPECT_TRUE(IntMinus73->pow(FloatTwo)->strictly_equal(VAR(Float, 5329.0)));
+    EXPECT_TRUE(IntMinus73->pow(FloatTwo2)->strictly_equal(VAR(Float, 5329.0)));
+    EXPECT_ANY_THROW(IntMinus73->pow(StrEmpty));
+    EXPECT_ANY_THROW(IntMinus73->pow(StrEmpty2));
+    EXPECT_ANY_THROW(IntMinus73->pow(StrA));
+    EXPECT_ANY_THROW(IntMinus73->pow(StrA2));
+    EXPECT_ANY_THROW(IntMinus73->pow(StrB));
+    EXPECT_ANY_THROW(IntMinus73->pow(ListEmpty));
+    EXPECT_ANY_THROW(IntMinus73->pow(ListEmpty2));
+    EXPECT_ANY_THROW(FloatMinusOne->pow(None));
+    EXPECT_ANY_THROW(FloatMinusOne->pow(None2));
+    EXPECT_TRUE(FloatMinusOne->pow(False)->strictly_equal(VAR(Float, 1.0)));
+    EXPECT_TRUE(FloatMinusOne->pow(False2)->strictly_equal(VAR(Float, 1.0)));
+    EXPECT_TRUE(FloatMinusOne->pow(True)->strictly_equal(VAR(Float, -1.0)));
+    EXPECT_TRUE(FloatMinusOne->pow(True2)->strictly_equal(VAR(Float, -1.0)));
+    EXPECT_TRUE(FloatMinusOne->pow(IntZero)->strictly_equal(VAR(Float, 1.0)));
+    EXPECT_TRUE(FloatMinusOne->pow(IntOne)->strictly_equal(VAR(Float, -1.0)));
+    EXPECT_TRUE(FloatMinusOne->pow(IntTwo)->strictly_equal(VAR(Float, 1.0)));
+    EXPECT_TRUE(FloatMinusOne->pow(IntTwo2)->strictly_equal(VAR(Float, 1.0)));
+    EXPECT_TRUE(FloatMinusOne->pow(Int8)->strictly_equal(VAR(Float, 1.0)));
+    EXPECT_TRUE(FloatMinusOne->pow(IntMinusOne)->strictly_equal(VAR(Float, -1.0)));
+    EXPECT_TRUE(FloatMinusOne->pow(IntMinusOne2)->strictly_equal(VAR(Float, -1.0)));
+    EXPECT_TRUE(FloatMinusOne->pow(IntMinus12)->strictly_equal(VAR(Float, 1.0)));
+    EXPECT_TRUE(FloatMinusOne->pow(IntMinus73)->strictly_equal(VAR(Float, -1.0)));
+    EXPECT_TRUE(FloatMinusOne->pow(FloatMinusOne)->strictly_equal(VAR(Float, -1.0)));
+    EXPECT_TRUE(FloatMinusOne->pow(FloatZero)->strictly_equal(VAR(Float, 1.0)));
+    EXPECT_TRUE(FloatMinusOne->pow(FloatOne)->strictly_equal(VAR(Float, -1.0)));
+    EXPECT_TRUE(FloatMinusOne->pow(FloatTwo)->strictly_equal(VAR(Float, 1.0)));
+    EXPECT_TRUE(FloatMinusOne->pow(FloatTwo2)->strictly_equal(VAR(Float, 1.0)));
+    EXPECT_ANY_THROW(FloatMinusOne->pow(StrEmpty));
+    EXPECT_ANY_THROW(FloatMinusOne->pow(StrEmpty2));
+    EXPECT_ANY_THROW(FloatMinusOne->pow(StrA));
+    EXPECT_ANY_THROW(FloatMinusOne->pow(StrA2));
+    EXPECT_ANY_THROW(FloatMinusOne->pow(StrB));
+    EXPECT_ANY_THROW(FloatMinusOne->pow(ListEmpty));
+    EXPECT_ANY_THROW(FloatMinusOne->pow(ListEmpty2));
+    EXPECT_ANY_THROW(FloatZero->pow(None));
+    EXPECT_ANY_THROW(FloatZero->pow(None2));
+    EXPECT_TRUE(FloatZero->pow(False)->strictly_equal(VAR(Float, 1.0)));
+    EXPECT_TRUE(FloatZero->pow(False2)->strictly_equal(VAR(Float, 1.0)));
+    EXPECT_TRUE(FloatZero->pow(True)->strictly_equal(VAR(Float, 0.0)));
+    EXPECT_TRUE(FloatZero->pow(True2)->strictly_equal(VAR(Float, 0.0)));
+    EXPECT_TRUE(FloatZero->pow(IntZero)->strictly_equal(VAR(Float, 1.0)));
+    EXPECT_TRUE(FloatZero->pow(IntOne)->strictly_equal(VAR(Float, 0.0)));
+    EXPECT_TRUE(FloatZero->pow(IntTwo)->strictly_equal(VAR(Float, 0.0)));
+    EXPECT_TRUE(FloatZero->pow(IntTwo2)->strictly_equal(VAR(Float, 0.0)));
+    EXPECT_TRUE(FloatZero->pow(Int8)->strictly_equal(VAR(Float, 0.0)));
+    EXPECT_ANY_THROW(FloatZero->pow(IntMinusOne));
+    EXPECT_ANY_THROW(FloatZero->pow(IntMinusOne2));
+    EXPECT_ANY_THROW(FloatZero->pow(IntMinus12));
+    EXPECT_ANY_THROW(FloatZero->pow(IntMinus73));
+    EXPECT_ANY_THROW(FloatZero->pow(FloatMinusOne));
+    EXPECT_TRUE(FloatZero->pow(FloatZero)->strictly_equal(VAR(Float, 1.0)));
+    EXPECT_TRUE(FloatZero->pow(FloatOne)->strictly_equal(VAR(Float, 0.0)));
+    EXPECT_TRUE(FloatZero->pow(FloatTwo)->strictly_equal(VAR(Float, 0.0)));
+    EXPECT_TRUE(FloatZero->pow(FloatTwo2)->strictly_equal(VAR(Float, 0.0)));
+    EXPECT_TRUE(FloatZero->pow(Float2_5)->strictly_equal(VAR(Float, 0.0)));
+    EXPECT_ANY_THROW(FloatZero->pow(Float_23_74));
+    EXPECT_ANY_THROW(FloatZero->pow(StrEmpty));
+    EXPECT_ANY_THROW(FloatZero->pow(StrEmpty2));
+    EXPECT_ANY_THROW(FloatZero->pow(StrA));
+    EXPECT_ANY_THROW(FloatZero->pow(StrA2));
+    EXPECT_ANY_THROW(FloatZero->pow(StrB));
+    EXPECT_ANY_THROW(FloatZero->pow(ListEmpty));
+    EXPECT_ANY_THROW(FloatZero->pow(ListEmpty2));
+    EXPECT_ANY_THROW(FloatOne->pow(None));
+    EXPECT_ANY_THROW(FloatOne->pow(None2));
+    EXPECT_TRUE(FloatOne->pow(False)->strictly_equal(VAR(Float, 1.0)));
+    EXPECT_TRUE(FloatOne->pow(False2)->strictly_equal(VAR(Float, 1.0)));
+    EXPECT_TRUE(FloatOne->pow(True)->strictly_equal(VAR(Float, 1.0)));
+    EXPECT_TRUE(FloatOne->pow(True2)->strictly_equal(VAR(Float, 1.0)));
+    EXPECT_TRUE(FloatOne->pow(IntZero)->strictly_equal(VAR(Float, 1.0)));
+    EXPECT_TRUE(FloatOne->pow(IntOne)->strictly_equal(VAR(Float, 1.0)));
+    EXPECT_TRUE(FloatOne->pow(IntTwo)->strictly_equal(VAR(Float, 1.0)));
+    EXPECT_TRUE(FloatOne->pow(IntTwo2)->strictly_equal(VAR(Float, 1.0)));
+    EXPECT_TRUE(FloatOne->pow(Int8)->strictly_equal(VAR(Float, 1.0)));
+    EXPECT_TRUE(FloatOne->pow(IntMinusOne)->strictly_equal(VAR(Float, 1.0)));
+    EXPECT_TRUE(FloatOne->pow(IntMinusOne2)->strictly_equal(VAR(Float, 1.0)));
+    EXPECT_TRUE(FloatOne->pow(IntMinus12)->strictly_equal(VAR(Float, 1.0)));
+    EXPECT_TRUE(FloatOne->pow(IntMinus73)->strictly_equal(VAR(Float, 1.0)));
+    EXPECT_TRUE(FloatOne->pow(FloatMinusOne)->strictly_equal(VAR(Float, 1.0)));
+    EXPECT_TRUE(FloatOne->pow(FloatZero)->strictly_equal(VAR(Float, 1.0)));
+    EXPECT_TRUE(FloatOne->pow(FloatOne)->strictly_equal(VAR(Float, 1.0)));
+    EXPECT_TRUE(FloatOne->pow(FloatTwo)->strictly_equal(VAR(Float, 1.0)));
+    EXPECT_TRUE(FloatOne->pow(FloatTwo2)->strictly_equal(VAR(Float, 1.0)));
+    EXPECT_TRUE(FloatOne->pow(Float2_5)->strictly_equal(VAR(Float, 1.0)));
+    EXPECT_TRUE(FloatOne->pow(Float_23_74)->strictly_equal(VAR(Float, 1.0)));
+    EXPECT_ANY_THROW(FloatOne->pow(StrEmpty));
+    EXPECT_ANY_THROW(FloatOne->pow(StrEmpty2));
+    EXPECT_ANY_THROW(FloatOne->pow(StrA));
+    EXPECT_ANY_THROW(FloatOne->pow(StrA2));
+    EXPECT_ANY_THROW(FloatOne->pow(StrB));
+    EXPECT_ANY_THROW(FloatOne->pow(ListEmpty));
+    EXPECT_ANY_THROW(FloatOne->pow(ListEmpty2));
+    EXPECT_ANY_THROW(FloatTwo->pow(None));
+    EXPECT_ANY_THROW(FloatTwo->pow(None2));
+    EXPECT_TRUE(FloatTwo->pow(False)->strictly_equal(VAR(Float, 1.0)));
+    EXPECT_TRUE(FloatTwo->pow(False2)->strictly_equal(VAR(Float, 1.0)));
+    EXPECT_TRUE(FloatTwo->pow(True)->strictly_equal(VAR(Float, 2.0)));
+    EXPECT_TRUE(FloatTwo->pow(True2)->strictly_equal(VAR(Float, 2.0)));
+    EXPECT_TRUE(FloatTwo->pow(IntZero)->strictly_equal(VAR(Float, 1.0)));
+    EXPECT_TRUE(FloatTwo->pow(IntOne)->strictly_equal(VAR(Float, 2.0)));
+    EXPECT_TRUE(FloatTwo->pow(IntTwo)->strictly_equal(VAR(Float, 4.0)));
+    EXPECT_TRUE(FloatTwo->pow(IntTwo2)->strictly_equal(VAR(Float, 4.0)));
+    EXPECT_TRUE(FloatTwo->pow(Int8)->strictly_equal(VAR(Float, 256.0)));
+    EXPECT_TRUE(FloatTwo->pow(IntMinusOne)->strictly_equal(VAR(Float, 0.5)));
+    EXPECT_TRUE(FloatTwo->pow(IntMinusOne2)->strictly_equal(VAR(Float, 0.5)));
+    EXPECT_TRUE(FloatTwo->pow(IntMinus12)->strictly_equal(VAR(Float, 0.000244140625)));
+    EXPECT_TRUE(FloatTwo->pow(IntMinus73)->strictly_equal(VAR(Float, 1.0587911840678754e-22)));
+    EXPECT_TRUE(FloatTwo->pow(FloatMinusOne)->strictly_equal(VAR(Float, 0.5)));
+    EXPECT_TRUE(FloatTwo->pow(FloatZero)->strictly_equal(VAR(Float, 1.0)));
+    EXPECT_TRUE(FloatTwo->pow(FloatOne)->strictly_equal(VAR(Float, 2.0)));
+    EXPECT_TRUE(FloatTwo->pow(FloatTwo)->strictly_equal(VAR(Float, 4.0)));
+    EXPECT_TRUE(FloatTwo->pow(FloatTwo2)->strictly_equal(VAR(Float, 4.0)));
+    EXPECT_TRUE(FloatTwo->pow(Float2_5)->strictly_equal(VAR(Float, 5.656854249492381)));
+    EXPECT_TRUE(FloatTwo->pow(Float_23_74)->strictly_equal(VAR(Float, 7.137529281490623e-08)));
+    EXPECT_ANY_THROW(FloatTwo->pow(StrEmpty));
+    EXPECT_ANY_THROW(FloatTwo->pow(StrEmpty2));
+    EXPECT_ANY_THROW(FloatTwo->pow(StrA));
+    EXPECT_ANY_THROW(FloatTwo->pow(StrA2));
+    EXPECT_ANY_THROW(FloatTwo->pow(StrB));
+    EXPECT_ANY_THROW(FloatTwo->pow(ListEmpty));
+    EXPECT_ANY_THROW(FloatTwo->pow(ListEmpty2));
+    EXPECT_ANY_THROW(FloatTwo2->pow(None));
+    EXPECT_ANY_THROW(FloatTwo2->pow(None2));
+    EXPECT_TRUE(FloatTwo2->pow(False)->strictly_equal(VAR(Float, 1.0)));
+    EXPECT_TRUE(FloatTwo2->pow(False2)->strictly_equal(VAR(Float, 1.0)));
+    EXPECT_TRUE(FloatTwo2->pow(True)->strictly_equal(VAR(Float, 2.0)));
+    EXPECT_TRUE(FloatTwo2->pow(True2)->strictly_equal(VAR(Float, 2.0)));
+    EXPECT_TRUE(FloatTwo2->pow(IntZero)->strictly_equal(VAR(Float, 1.0)));
+    EXPECT_TRUE(FloatTwo2->pow(IntOne)->strictly_equal(VAR(Float, 2.0)));
+    EXPECT_TRUE(FloatTwo2->pow(IntTwo)->strictly_equal(VAR(Float, 4.0)));
+    EXPECT_TRUE(FloatTwo2->pow(IntTwo2)->strictly_equal(VAR(Float, 4.0)));
+    EXPECT_TRUE(FloatTwo2->pow(Int8)->strictly_equal(VAR(Float, 256.0)));
+    EXPECT_TRUE(FloatTwo2->pow(IntMinusOne)->strictly_equal(VAR(Float, 0.5)));
+    EXPECT_TRUE(FloatTwo2->pow(IntMinusOne2)->strictly_equal(VAR(Float, 0.5)));
+    EXPECT_TRUE(FloatTwo2->pow(IntMinus12)->strictly_equal(VAR(Float, 0.000244140625)));
+    EXPECT_TRUE(FloatTwo2->pow(IntMinus73)->strictly_equal(VAR(Float, 1.0587911840678754e-22)));
+    EXPECT_TRUE(FloatTwo2->pow(FloatMinusOne)->strictly_equal(VAR(Float, 0.5)));
+    EXPECT_TRUE(FloatTwo2->pow(FloatZero)->strictly_equal(VAR(Float, 1.0)));
+    EXPECT_TRUE(FloatTwo2->pow(FloatOne)->strictly_equal(VAR(Float, 2.0)));
+    EXPECT_TRUE(FloatTwo2->pow(FloatTwo)->strictly_equal(VAR(Float, 4.0)));
+    EXPECT_TRUE(FloatTwo2->pow(FloatTwo2)->strictly_equal(VAR(Float, 4.0)));
+    EXPECT_TRUE(FloatTwo2->pow(Float2_5)->strictly_equal(VAR(Float, 5.656854249492381)));
+    EXPECT_TRUE(FloatTwo2->pow(Float_23_74)->strictly_equal(VAR(Float, 7.137529281490623e-08)));
+    EXPECT_ANY_THROW(FloatTwo2->pow(StrEmpty));
+    EXPECT_ANY_THROW(FloatTwo2->pow(StrEmpty2));
+    EXPECT_ANY_THROW(FloatTwo2->pow(StrA));
+    EXPECT_ANY_THROW(FloatTwo2->pow(StrA2));
+    EXPECT_ANY_THROW(FloatTwo2->pow(StrB));
+    EXPECT_ANY_THROW(FloatTwo2->pow(ListEmpty));
+    EXPECT_ANY_THROW(FloatTwo2->pow(ListEmpty2));
+    EXPECT_ANY_THROW(Float2_5->pow(None));
+    EXPECT_ANY_THROW(Float2_5->pow(None2));
+    EXPECT_TRUE(Float2_5->pow(False)->strictly_equal(VAR(Float, 1.0)));
+    EXPECT_TRUE(Float2_5->pow(False2)->strictly_equal(VAR(Float, 1.0)));
+    EXPECT_TRUE(Float2_5->pow(True)->strictly_equal(VAR(Float, 2.5)));
+    EXPECT_TRUE(Float2_5->pow(True2)->strictly_equal(VAR(Float, 2.5)));
+    EXPECT_TRUE(Float2_5->pow(IntZero)->strictly_equal(VAR(Float, 1.0)));
+    EXPECT_TRUE(Float2_5->pow(IntOne)->strictly_equal(VAR(Float, 2.5)));
+    EXPECT_TRUE(Float2_5->pow(IntTwo)->strictly_equal(VAR(Float, 6.25)));
+    EXPECT_TRUE(Float2_5->pow(IntTwo2)->strictly_equal(VAR(Float, 6.25)));
+    EXPECT_TRUE(Float2_5->pow(Int8)->strictly_equal(VAR(Float, 1525.87890625)));
+    EXPECT_TRUE(Float2_5->pow(IntMinusOne)->strictly_equal(VAR(Float, 0.4)));
+    EXPECT_TRUE(Float2_5->pow(IntMinusOne2)->strictly_equal(VAR(Float, 0.4)));
+    EXPECT_TRUE(Float2_5->pow(IntMinus12)->strictly_equal(VAR(Float, 1.6777216e-05)));
+    EXPECT_TRUE(Float2_5->pow(IntMinus73)->strictly_equal(VAR(Float, 8.920298079412249e-30)));
+    EXPECT_TRUE(Float2_5->pow(FloatMinusOne)->strictly_equal(VAR(Float, 0.4)));
+    EXPECT_TRUE(Float2_5->pow(FloatZero)->strictly_equal(VAR(Float, 1.0)));
+    EXPECT_TRUE(Float2_5->pow(FloatOne)->strictly_equal(VAR(Float, 2.5)));
+    EXPECT_TRUE(Float2_5->pow(FloatTwo)->strictly_equal(VAR(Float, 6.25)));
+    EXPECT_TRUE(Float2_5->pow(FloatTwo2)->strictly_equal(VAR(Float, 6.25)));
+    EXPECT_TRUE(Float2_5->pow(Float2_5)->strictly_equal(VAR(Float, 9.882117688026186)));
+    EXPECT_TRUE(Float2_5->pow(Float_23_74)->strictly_equal(VAR(Float, 3.5719403203575647e-10)));
+    EXPECT_ANY_THROW(Float2_5->pow(StrEmpty));
+    EXPECT_ANY_THROW(Float2_5->pow(StrEmpty2));
+    EXPECT_ANY_THROW(Float2_5->pow(StrA));
+    EXPECT_ANY_THROW(Float2_5->pow(StrA2));
+    EXPECT_ANY_THROW(Float2_5->pow(StrB));
+    EXPECT_ANY_THROW(Float2_5->pow(ListEmpty));
+    EXPECT_ANY_THROW(Float2_5->pow(ListEmpty2));
+    EXPECT_ANY_THROW(Float_23_74->pow(None));
+    EXPECT_ANY_THROW(Float_23_74->pow(None2));
+    EXPECT_TRUE(Float_23_74->pow(False)->strictly_equal(VAR(Float, 1.0)));
+    EXPECT_TRUE(Float_23_74->pow(False2)->strictly_equal(VAR(Float, 1.0)));
+    EXPECT_TRUE(Float_23_74->pow(True)->strictly_equal(VAR(Float, -23.74)));
+    EXPECT_TRUE(Float_23_74->pow(True2)->strictly_equal(VAR(Float, -23.74)));
+    EXPECT_TRUE(Float_23_74->pow(IntZero)->strictly_equal(VAR(Float, 1.0)));
+    EXPECT_TRUE(Float_23_74->pow(IntOne)->strictly_equal(VAR(Float, -23.74)));
+    EXPECT_TRUE(Float_23_74->pow(IntTwo)->strictly_equal(VAR(Float, 563.5876)));
+    EXPECT_TRUE(Float_23_74->pow(IntTwo2)->strictly_equal(VAR(Float, 563.5876)));
+    EXPECT_TRUE(Float_23_74->pow(Int8)->strictly_equal(VAR(Float, 100889441281.35077)));
+    EXPECT_TRUE(Float_23_74->pow(IntMinusOne)->strictly_equal(VAR(Float, -0.04212299915754002)));
+    EXPECT_TRUE(Float_23_74->pow(IntMinusOne2)->strictly_equal(VAR(Float, -0.04212299915754002)));
+    EXPECT_TRUE(Float_23_74->pow(IntMinus12)->strictly_equal(VAR(Float, 3.120552004591085e-17)));
+    EXPECT_TRUE(Float_23_74->pow(IntMinus73)->strictly_equal(VAR(Float, -3.889625895361886e-101)));
+    EXPECT_TRUE(Float_23_74->pow(FloatMinusOne)->strictly_equal(VAR(Float, -0.04212299915754002)));
+    EXPECT_TRUE(Float_23_74->pow(FloatZero)->strictly_equal(VAR(Float, 1.0)));
+    EXPECT_TRUE(Float_23_74->pow(FloatOne)->strictly_equal(VAR(Float, -23.74)));
+    EXPECT_TRUE(Float_23_74->pow(FloatTwo)->strictly_equal(VAR(Float, 563.5876)));
+    EXPECT_TRUE(Float_23_74->pow(FloatTwo2)->strictly_equal(VAR(Float, 563.5876)));
+    EXPECT_ANY_THROW(Float_23_74->pow(StrEmpty));
+    EXPECT_ANY_THROW(Float_23_74->pow(StrEmpty2));
+    EXPECT_ANY_THROW(Float_23_74->pow(StrA));
+    EXPECT_ANY_THROW(Float_23_74->pow(StrA2));
+    EXPECT_ANY_THROW(Float_23_74->pow(StrB));
+    EXPECT_ANY_THROW(Float_23_74->pow(ListEmpty));
+    EXPECT_ANY_THROW(Float_23_74->pow(ListEmpty2));
+    EXPECT_ANY_THROW(StrEmpty->pow(None));
+    EXPECT_ANY_THROW(StrEmpty->pow(None2));
+    EXPECT_ANY_THROW(StrEmpty->pow(False));
+    EXPECT_ANY_THROW(StrEmpty->pow(False2));
+    EXPECT_ANY_THROW(StrEmpty->pow(True));
+    EXPECT_ANY_THROW(StrEmpty->pow(True2));
+    EXPECT_ANY_THROW(StrEmpty->pow(IntZero));
+    EXPECT_ANY_THROW(StrEmpty->pow(IntOne));
+    EXPECT_ANY_THROW(StrEmpty->pow(IntTwo));
+    EXPECT_ANY_THROW(StrEmpty->pow(IntTwo2));
+    EXPECT_ANY_THROW(StrEmpty->pow(Int8));
+    EXPECT_ANY_THROW(StrEmpty->pow(IntMinusOne));
+    EXPECT_ANY_THROW(StrEmpty->pow(IntMinusOne2));
+    EXPECT_ANY_THROW(StrEmpty->pow(IntMinus12));
+    EXPECT_ANY_THROW(StrEmpty->pow(IntMinus73));
+    EXPECT_ANY_THROW(StrEmpty->pow(FloatMinusOne));
+    EXPECT_ANY_THROW(StrEmpty->pow(FloatZero));
+    EXPECT_ANY_THROW(StrEmpty->pow(FloatOne));
+    EXPECT_ANY_THROW(StrEmpty->pow(FloatTwo));
+    EXPECT_ANY_THROW(StrEmpty->pow(FloatTwo2));
+    EXPECT_ANY_THROW(StrEmpty->pow(Float2_5));
+    EXPECT_ANY_THROW(StrEmpty->pow(Float_23_74));
+    EXPECT_ANY_THROW(StrEmpty->pow(StrEmpty));
+    EXPECT_ANY_THROW(StrEmpty->pow(StrEmpty2));
+    EXPECT_ANY_THROW(StrEmpty->pow(StrA));
+    EXPECT_ANY_THROW(StrEmpty->pow(StrA2));
+    EXPECT_ANY_THROW(StrEmpty->pow(StrB));
+    EXPECT_ANY_THROW(StrEmpty->pow(ListEmpty));
+    EXPECT_ANY_THROW(StrEmpty->pow(ListEmpty2));
+    EXPECT_ANY_THROW(StrEmpty2->pow(None));
+    EXPECT_ANY_THROW(StrEmpty2->pow(None2));
+    EXPECT_ANY_THROW(StrEmpty2->pow(False));
+    EXPECT_ANY_THROW(StrEmpty2->pow(False2));
+    EXPECT_ANY_THROW(StrEmpty2->pow(True));
+    EXPECT_ANY_THROW(StrEmpty2->pow(True2));
+    EXPECT_ANY_THROW(StrEmpty2->pow(IntZero));
+    EXPECT_ANY_THROW(StrEmpty2->pow(IntOne));
+    EXPECT_ANY_THROW(StrEmpty2->pow(IntTwo));
+    EXPECT_ANY_THROW(StrEmpty2->pow(IntTwo2));
+    EXPECT_ANY_THROW(StrEmpty2->pow(Int8));
+    EXPECT_ANY_THROW(StrEmpty2->pow(IntMinusOne));
+    EXPECT_ANY_THROW(StrEmpty2->pow(IntMinusOne2));
+    EXPECT_ANY_THROW(StrEmpty2->pow(IntMinus12));
+    EXPECT_ANY_THROW(StrEmpty2->pow(IntMinus73));
+    EXPECT_ANY_THROW(StrEmpty2->pow(FloatMinusOne));
+    EXPECT_ANY_THROW(StrEmpty2->pow(FloatZero));
+    EXPECT_ANY_THROW(StrEmpty2->pow(FloatOne));
+    EXPECT_ANY_THROW(StrEmpty2->pow(FloatTwo));
+    EXPECT_ANY_THROW(StrEmpty2->pow(FloatTwo2));
+    EXPECT_ANY_THROW(StrEmpty2->pow(Float2_5));
+    EXPECT_ANY_THROW(StrEmpty2->pow(Float_23_74));
+    EXPECT_ANY_THROW(StrEmpty2->pow(StrEmpty));
+    EXPECT_ANY_THROW(StrEmpty2->pow(StrEmpty2));
+    EXPECT_ANY_THROW(StrEmpty2->pow(StrA));
+    EXPECT_ANY_THROW(StrEmpty2->pow(StrA2));
+    EXPECT_ANY_THROW(StrEmpty2->pow(StrB));
+    EXPECT_ANY_THROW(StrEmpty2->pow(ListEmpty));
+    EXPECT_ANY_THROW(StrEmpty2->pow(ListEmpty2));
+    EXPECT_ANY_THROW(StrA->pow(None));
+    EXPECT_ANY_THROW(StrA->pow(None2));
+    EXPECT_ANY_THROW(StrA->pow(False));
+    EXPECT_ANY_THROW(StrA->pow(False2));
+    EXPECT_ANY_THROW(StrA->pow(True));
+    EXPECT_ANY_THROW(StrA->pow(True2));
+    EXPECT_ANY_THROW(StrA->pow(IntZero));
+    EXPECT_ANY_THROW(StrA->pow(IntOne));
+    EXPECT_ANY_THROW(StrA->pow(IntTwo));
+    EXPECT_ANY_THROW(StrA->pow(IntTwo2));
+    EXPECT_ANY_THROW(StrA->pow(Int8));
+    EXPECT_ANY_THROW(StrA->pow(IntMinusOne));
+    EXPECT_ANY_THROW(StrA->pow(IntMinusOne2));
+    EXPECT_ANY_THROW(StrA->pow(IntMinus12));
+    EXPECT_ANY_THROW(StrA->pow(IntMinus73));
+    EXPECT_ANY_THROW(StrA->pow(FloatMinusOne));
+    EXPECT_ANY_THROW(StrA->pow(FloatZero));
+    EXPECT_ANY_THROW(StrA->pow(FloatOne));
+    EXPECT_ANY_THROW(StrA->pow(FloatTwo));
+    EXPECT_ANY_THROW(StrA->pow(FloatTwo2));
+    EXPECT_ANY_THROW(StrA->pow(Float2_5));
+    EXPECT_ANY_THROW(StrA->pow(Float_23_74));
+    EXPECT_ANY_THROW(StrA->pow(StrEmpty));
+    EXPECT_ANY_THROW(StrA->pow(StrEmpty2));
+    EXPECT_ANY_THROW(StrA->pow(StrA));
+    EXPECT_ANY_THROW(StrA->pow(StrA2));
+    EXPECT_ANY_THROW(StrA->pow(StrB));
+    EXPECT_ANY_THROW(StrA->pow(ListEmpty));
+    EXPECT_ANY_THROW(StrA->pow(ListEmpty2));
+    EXPECT_ANY_THROW(StrA2->pow(None));
+    EXPECT_ANY_THROW(StrA2->pow(None2));
+    EXPECT_ANY_THROW(StrA2->pow(False));
+    EXPECT_ANY_THROW(StrA2->pow(False2));
+    EXPECT_ANY_THROW(StrA2->pow(True));
+    EXPECT_ANY_THROW(StrA2->pow(True2));
+    EXPECT_ANY_THROW(StrA2->pow(IntZero));
+    EXPECT_ANY_THROW(StrA2->pow(IntOne));
+    EXPECT_ANY_THROW(StrA2->pow(IntTwo));
+    EXPECT_ANY_THROW(StrA2->pow(IntTwo2));
+    EXPECT_ANY_THROW(StrA2->pow(Int8));
+    EXPECT_ANY_THROW(StrA2->pow(IntMinusOne));
+    EXPECT_ANY_THROW(StrA2->pow(IntMinusOne2));
+    EXPECT_ANY_THROW(StrA2->pow(IntMinus12));
+    EXPECT_ANY_THROW(StrA2->pow(IntMinus73));
+    EXPECT_ANY_THROW(StrA2->pow(FloatMinusOne));
+    EXPECT_ANY_THROW(StrA2->pow(FloatZero));
+    EXPECT_ANY_THROW(StrA2->pow(FloatOne));
+    EXPECT_ANY_THROW(StrA2->pow(FloatTwo));
+    EXPECT_ANY_THROW(StrA2->pow(FloatTwo2));
+    EXPECT_ANY_THROW(StrA2->pow(Float2_5));
+    EXPECT_ANY_THROW(StrA2->pow(Float_23_74));
+    EXPECT_ANY_THROW(StrA2->pow(StrEmpty));
+    EXPECT_ANY_THROW(StrA2->pow(StrEmpty2));
+    EXPECT_ANY_THROW(StrA2->pow(StrA));
+    EXPECT_ANY_THROW(StrA2->pow(StrA2));
+    EXPECT_ANY_THROW(StrA2->pow(StrB));
+    EXPECT_ANY_THROW(StrA2->pow(ListEmpty));
+    EXPECT_ANY_THROW(StrA2->pow(ListEmpty2));
+    EXPECT_ANY_THROW(StrB->pow(None));
+    EXPECT_ANY_THROW(StrB->pow(None2));
+    EXPECT_ANY_THROW(StrB->pow(False));
+    EXPECT_ANY_THROW(StrB->pow(False2));
+    EXPECT_ANY_THROW(StrB->pow(True));
+    EXPECT_ANY_THROW(StrB->pow(True2));
+    EXPECT_ANY_THROW(StrB->pow(IntZero));
+    EXPECT_ANY_THROW(StrB->pow(IntOne));
+    EXPECT_ANY_THROW(StrB->pow(IntTwo));
+    EXPECT_ANY_THROW(StrB->pow(IntTwo2));
+    EXPECT_ANY_THROW(StrB->pow(Int8));
+    EXPECT_ANY_THROW(StrB->pow(IntMinusOne));
+    EXPECT_ANY_THROW(StrB->pow(IntMinusOne2));
+    EXPECT_ANY_THROW(StrB->pow(IntMinus12));
+    EXPECT_ANY_THROW(StrB->pow(IntMinus73));
+    EXPECT_ANY_THROW(StrB->pow(FloatMinusOne));
+    EXPECT_ANY_THROW(StrB->pow(FloatZero));
+    EXPECT_ANY_THROW(StrB->pow(FloatOne));
+    EXPECT_ANY_THROW(StrB->pow(FloatTwo));
+    EXPECT_ANY_THROW(StrB->pow(FloatTwo2));
+    EXPECT_ANY_THROW(StrB->pow(Float2_5));
+    EXPECT_ANY_THROW(StrB->pow(Float_23_74));
+    EXPECT_ANY_THROW(StrB->pow(StrEmpty));
+    EXPECT_ANY_THROW(StrB->pow(StrEmpty2));
+    EXPECT_ANY_THROW(StrB->pow(StrA));
+    EXPECT_ANY_THROW(StrB->pow(StrA2));
+    EXPECT_ANY_THROW(StrB->pow(StrB));
+    EXPECT_ANY_THROW(StrB->pow(ListEmpty));
+    EXPECT_ANY_THROW(StrB->pow(ListEmpty2));
+    EXPECT_ANY_THROW(ListEmpty->pow(None));
+    EXPECT_ANY_THROW(ListEmpty->pow(None2));
+    EXPECT_ANY_THROW(ListEmpty->pow(False));
+    EXPECT_ANY_THROW(ListEmpty->pow(False2));
+    EXPECT_ANY_THROW(ListEmpty->pow(True));
+    EXPECT_ANY_THROW(ListEmpty->pow(True2));
+    EXPECT_ANY_THROW(ListEmpty->pow(IntZero));
+    EXPECT_ANY_THROW(ListEmpty->pow(IntOne));
+    EXPECT_ANY_THROW(ListEmpty->pow(IntTwo));
+    EXPECT_ANY_THROW(ListEmpty->pow(IntTwo2));
+    EXPECT_ANY_THROW(ListEmpty->pow(Int8));
+    EXPECT_ANY_THROW(ListEmpty->pow(IntMinusOne));
+    EXPECT_ANY_THROW(ListEmpty->pow(IntMinusOne2));
+    EXPECT_ANY_THROW(ListEmpty->pow(IntMinus12));
+    EXPECT_ANY_THROW(ListEmpty->pow(IntMinus73));
+    EXPECT_ANY_THROW(ListEmpty->pow(FloatMinusOne));
+    EXPECT_ANY_THROW(ListEmpty->pow(FloatZero));
+    EXPECT_ANY_THROW(ListEmpty->pow(FloatOne));
+    EXPECT_ANY_THROW(ListEmpty->pow(FloatTwo));
+    EXPECT_ANY_THROW(ListEmpty->pow(FloatTwo2));
+    EXPECT_ANY_THROW(ListEmpty->pow(Float2_5));
+    EXPECT_ANY_THROW(ListEmpty->pow(Float_23_74));
+    EXPECT_ANY_THROW(ListEmpty->pow(StrEmpty));
+    EXPECT_ANY_THROW(ListEmpty->pow(StrEmpty2));
+    EXPECT_ANY_THROW(ListEmpty->pow(StrA));
+    EXPECT_ANY_THROW(ListEmpty->pow(StrA2));
+    EXPECT_ANY_THROW(ListEmpty->pow(StrB));
+    EXPECT_ANY_THROW(ListEmpty->pow(ListEmpty));
+    EXPECT_ANY_THROW(ListEmpty->pow(ListEmpty2));
+    EXPECT_ANY_THROW(ListEmpty2->pow(None));
+    EXPECT_ANY_THROW(ListEmpty2->pow(None2));
+    EXPECT_ANY_THROW(ListEmpty2->pow(False));
+    EXPECT_ANY_THROW(ListEmpty2->pow(False2));
+    EXPECT_ANY_THROW(ListEmpty2->pow(True));
+    EXPECT_ANY_THROW(ListEmpty2->pow(True2));
+    EXPECT_ANY_THROW(ListEmpty2->pow(IntZero));
+    EXPECT_ANY_THROW(ListEmpty2->pow(IntOne));
+    EXPECT_ANY_THROW(ListEmpty2->pow(IntTwo));
+    EXPECT_ANY_THROW(ListEmpty2->pow(IntTwo2));
+    EXPECT_ANY_THROW(ListEmpty2->pow(Int8));
+    EXPECT_ANY_THROW(ListEmpty2->pow(IntMinusOne));
+    EXPECT_ANY_THROW(ListEmpty2->pow(IntMinusOne2));
+    EXPECT_ANY_THROW(ListEmpty2->pow(IntMinus12));
+    EXPECT_ANY_THROW(ListEmpty2->pow(IntMinus73));
+    EXPECT_ANY_THROW(ListEmpty2->pow(FloatMinusOne));
+    EXPECT_ANY_THROW(ListEmpty2->pow(FloatZero));
+    EXPECT_ANY_THROW(ListEmpty2->pow(FloatOne));
+    EXPECT_ANY_THROW(ListEmpty2->pow(FloatTwo));
+    EXPECT_ANY_THROW(ListEmpty2->pow(FloatTwo2));
+    EXPECT_ANY_THROW(ListEmpty2->pow(Float2_5));
+    EXPECT_ANY_THROW(ListEmpty2->pow(Float_23_74));
+    EXPECT_ANY_THROW(ListEmpty2->pow(StrEmpty));
+    EXPECT_ANY_THROW(ListEmpty2->pow(StrEmpty2));
+    EXPECT_ANY_THROW(ListEmpty2->pow(StrA));
+    EXPECT_ANY_THROW(ListEmpty2->pow(StrA2));
+    EXPECT_ANY_THROW(ListEmpty2->pow(StrB));
+    EXPECT_ANY_THROW(ListEmpty2->pow(ListEmpty));
+    EXPECT_ANY_THROW(ListEmpty2->pow(ListEmpty2));
+}
@@ -0,0 +1,969 @@
+
+#include "variable/Variable.h"
+
+#include "Test.h"
+
+#define VAR(TYPE, VALUE) \
+    std::static_pointer_cast<GenericVariable>(std::make_shared<TYPE ## Variable>(VALUE))
+
+enum class OpReturningVar {
+    add,
+    sub,
+    mul,
+    div,
+    int_div,
+    pow,
+    mod,
+};
+
+enum class AssertResult {
+    PASS,
+    FAIL,
+    EXCEPTION,
+};
+
+static std::ostream& operator<< (std::ostream& os, AssertResult res) {
+    switch (res) {
+    case AssertResult::PASS:       os << "PASS";      break;
+    case AssertResult::FAIL:       os << "FAIL";      break;
+    case AssertResult::EXCEPTION:  os << "EXCEPTION"; break;
+    default:                       os << "???";
+    }
+    return os;
+}
+
+static Variable doOpReturningVar(Variable arg1, Variable arg2, OpReturningVar op) {
+    switch(op) {
+    case OpReturningVar::add: return arg1->add(arg2);
+    case OpReturningVar::sub: return arg1->sub(arg2);
+    case OpReturningVar::mul: return arg1->mul(arg2);
+    case OpReturningVar::div: return arg1->div(arg2);
+    case OpReturningVar::int_div: return arg1->int_div(arg2);
+    case OpReturningVar::mod: return arg1->mod(arg2);
+    case OpReturningVar::pow: return arg1->pow(arg2);
+    default: throw std::runtime_error("Bad op");
+    }
+}
+
+static void doOpReturningVarAndCompareResult(Variable arg1, Variable arg2, OpReturningVar op, Variable expected_res, AssertResult a_res, const char *descr) {
+    try {
+        auto res_var = doOpReturningVar(arg1, arg2, op);
+        auto assertion_result = res_var->strictly_equal(expected_res) ? AssertResult::PASS : AssertResult::FAIL;
+        if (assertion_result != a_res) {
+            std::cerr << descr << " returned " << assertion_result << " instead of " << a_res << "\n";
+        }
+    }
+    catch(...) {
+        if (a_res != AssertResult::EXCEPTION) {
+            std::cerr << descr << " returned EXCEPTION instead of " << a_res << "\n";
+        }
+    }
+}
+
+enum class OpReturningBool {
+    equal,
+    less,
+};
+
+static bool doOpReturningBool(Variable arg1, Variable arg2, OpReturningBool op) {
+    switch(op) {
+    case OpReturningBool::equal: return arg1->equal(arg2);
+    case OpReturningBool::less: return arg1->less(arg2);
+    default: throw std::runtime_error("Bad op");
+    }
+}
+
+static void doOpReturningBoolAndCompareResult(Variable arg1, Variable arg2, OpReturningBool op, bool expected_res, AssertResult a_res, const char *descr) {
+    try {
+        auto assertion_result = doOpReturningBool(arg1, arg2, op) ? AssertResult::PASS : AssertResult::FAIL;
+        if (assertion_result != a_res) {
+            std::cerr << descr << " returned " << assertion_result << " instead of " << a_res << "\n";
+        }
+    }
+    catch(...) {
+        if (a_res != AssertResult::EXCEPTION) {
+            std::cerr << descr << " returned EXCEPTION instead of " << a_res << "\n";
+        }
+    }
+}
+
+static auto None = std::static_pointer_cast<GenericVariable>(std::make_shared<NoneVariable>());
+static auto None2 = std::static_pointer_cast<GenericVariable>(std::make_shared<NoneVariable>());
+static auto False = VAR(Bool, false);
+static auto False2 = VAR(Bool, false);
+static auto True = VAR(Bool, true);
+static auto True2 = VAR(Bool, true);
+static auto IntZero = VAR(Int, 0);
+static auto IntOne = VAR(Int, 1);
+static auto IntTwo = VAR(Int, 2);
+static auto IntTwo2 = VAR(Int, 2);
+static auto Int8 = VAR(Int, 8);
+static auto IntMinusOne = VAR(Int, -1);
+static auto IntMinusOne2 = VAR(Int, -1);
+static auto IntMinus12 = VAR(Int, -12);
+static auto IntMinus73 = VAR(Int, -73);
+static auto FloatMinusOne = VAR(Float, -1);
+static auto FloatZero = VAR(Float, 0);
+static auto FloatOne = VAR(Float, 1);
+static auto FloatTwo = VAR(Float, 2);
+static auto FloatTwo2 = VAR(Float, 2);
+static auto Float2_5 = VAR(Float, 2.5);
+static auto Float_23_74 = VAR(Float, -23.74);
+static auto StrEmpty = VAR(String, "");
+static auto StrEmpty2 = VAR(String, "");
+static auto StrA = VAR(String, "some text");
+static auto StrA2 = VAR(String, "some text");
+static auto StrB = VAR(String, "other text");
+static auto ListEmpty = VAR(List, ListType());
+static auto ListEmpty2 = VAR(List, ListType());
+
+#include "variable/Variable.h"
+
+#include <gtest/gtest.h>
+
+class VariableSubTest: public testing::Test {
+};
+
+TEST_F(VariableSubTest, VariableSubTest) {
+    EXPECT_ANY_THROW(None->sub(None));
+    EXPECT_ANY_THROW(None->sub(None2));
+    EXPECT_ANY_THROW(None->sub(False));
+    EXPECT_ANY_THROW(None->sub(False2));
+    EXPECT_ANY_THROW(None->sub(True));
+    EXPECT_ANY_THROW(None->sub(True2));
+    EXPECT_ANY_THROW(None->sub(IntZero));
+    EXPECT_ANY_THROW(None->sub(IntOne));
+    EXPECT_ANY_THROW(None->sub(IntTwo));
+    EXPECT_ANY_THROW(None->sub(IntTwo2));
+    EXPECT_ANY_THROW(None->sub(Int8));
+    EXPECT_ANY_THROW(None->sub(IntMinusOne));
+    EXPECT_ANY_THROW(None->sub(IntMinusOne2));
+    EXPECT_ANY_THROW(None->sub(IntMinus12));
+    EXPECT_ANY_THROW(None->sub(IntMinus73));
+    EXPECT_ANY_THROW(None->sub(FloatMinusOne));
+    EXPECT_ANY_THROW(None->sub(FloatZero));
+    EXPECT_ANY_THROW(None->sub(FloatOne));
+    EXPECT_ANY_THROW(None->sub(FloatTwo));
+    EXPECT_ANY_THROW(None->sub(FloatTwo2));
+    EXPECT_ANY_THROW(None->sub(Float2_5));
+    EXPECT_ANY_THROW(None->sub(Float_23_74));
+    EXPECT_ANY_THROW(None->sub(StrEmpty));
+    EXPECT_ANY_THROW(None->sub(StrEmpty2));
+    EXPECT_ANY_THROW(None->sub(StrA));
+    EXPECT_ANY_THROW(None->sub(StrA2));
+    EXPECT_ANY_THROW(None->sub(StrB));
+    EXPECT_ANY_THROW(None->sub(ListEmpty));
+    EXPECT_ANY_THROW(None->sub(ListEmpty2));
+    EXPECT_ANY_THROW(None2->sub(None));
+    EXPECT_ANY_THROW(None2->sub(None2));
+    EXPECT_ANY_THROW(None2->sub(False));
+    EXPECT_ANY_THROW(None2->sub(False2));
+    EXPECT_ANY_THROW(None2->sub(True));
+    EXPECT_ANY_THROW(None2->sub(True2));
+    EXPECT_ANY_THROW(None2->sub(IntZero));
+    EXPECT_ANY_THROW(None2->sub(IntOne));
+    EXPECT_ANY_THROW(None2->sub(IntTwo));
+    EXPECT_ANY_THROW(None2->sub(IntTwo2));
+    EXPECT_ANY_THROW(None2->sub(Int8));
+    EXPECT_ANY_THROW(None2->sub(IntMinusOne));
+    EXPECT_ANY_THROW(None2->sub(IntMinusOne2));
+    EXPECT_ANY_THROW(None2->sub(IntMinus12));
+    EXPECT_ANY_THROW(None2->sub(IntMinus73));
+    EXPECT_ANY_THROW(None2->sub(FloatMinusOne));
+    EXPECT_ANY_THROW(None2->sub(FloatZero));
+    EXPECT_ANY_THROW(None2->sub(FloatOne));
+    EXPECT_ANY_THROW(None2->sub(FloatTwo));
+    EXPECT_ANY_THROW(None2->sub(FloatTwo2));
+    EXPECT_ANY_THROW(None2->sub(Float2_5));
+    EXPECT_ANY_THROW(None2->sub(Float_23_74));
+    EXPECT_ANY_THROW(None2->sub(StrEmpty));
+    EXPECT_ANY_THROW(None2->sub(StrEmpty2));
+    EXPECT_ANY_THROW(None2->sub(StrA));
+    EXPECT_ANY_THROW(None2->sub(StrA2));
+    EXPECT_ANY_THROW(None2->sub(StrB));
+    EXPECT_ANY_THROW(None2->sub(ListEmpty));
+    EXPECT_ANY_THROW(None2->sub(ListEmpty2));
+    EXPECT_ANY_THROW(False->sub(None));
+    EXPECT_ANY_THROW(False->sub(None2));
+    EXPECT_TRUE(False->sub(False)->strictly_equal(VAR(Int, 0)));
+    EXPECT_TRUE(False->sub(False2)->strictly_equal(VAR(Int, 0)));
+    EXPECT_TRUE(False->sub(True)->strictly_equal(VAR(Int, -1)));
+    EXPECT_TRUE(False->sub(True2)->strictly_equal(VAR(Int, -1)));
+    EXPECT_TRUE(False->sub(IntZero)->strictly_equal(VAR(Int, 0)));
+    EXPECT_TRUE(False->sub(IntOne)->strictly_equal(VAR(Int, -1)));
+    EXPECT_TRUE(False->sub(IntTwo)->strictly_equal(VAR(Int, -2)));
+    EXPECT_TRUE(False->sub(IntTwo2)->strictly_equal(VAR(Int, -2)));
+    EXPECT_TRUE(False->sub(Int8)->strictly_equal(VAR(Int, -8)));
+    EXPECT_TRUE(False->sub(IntMinusOne)->strictly_equal(VAR(Int, 1)));
+    EXPECT_TRUE(False->sub(IntMinusOne2)->strictly_equal(VAR(Int, 1)));
+    EXPECT_TRUE(False->sub(IntMinus12)->strictly_equal(VAR(Int, 12)));
+    EXPECT_TRUE(False->sub(IntMinus73)->strictly_equal(VAR(Int, 73)));
+    EXPECT_TRUE(False->sub(FloatMinusOne)->strictly_equal(VAR(Float, 1.0)));
+    EXPECT_TRUE(False->sub(FloatZero)->strictly_equal(VAR(Float, 0.0)));
+    EXPECT_TRUE(False->sub(FloatOne)->strictly_equal(VAR(Float, -1.0)));
+    EXPECT_TRUE(False->sub(FloatTwo)->strictly_equal(VAR(Float, -2.0)));
+    EXPECT_TRUE(False->sub(FloatTwo2)->strictly_equal(VAR(Float, -2.0)));
+    EXPECT_TRUE(False->sub(Float2_5)->strictly_equal(VAR(Float, -2.5)));
+    EXPECT_TRUE(False->sub(Float_23_74)->strictly_equal(VAR(Float, 23.74)));
+    EXPECT_ANY_THROW(False->sub(StrEmpty));
+    EXPECT_ANY_THROW(False->sub(StrEmpty2));
+    EXPECT_ANY_THROW(False->sub(StrA));
+    EXPECT_ANY_THROW(False->sub(StrA2));
+    EXPECT_ANY_THROW(False->sub(StrB));
+    EXPECT_ANY_THROW(False->sub(ListEmpty));
+    EXPECT_ANY_THROW(False->sub(ListEmpty2));
+    EXPECT_ANY_THROW(False2->sub(None));
+    EXPECT_ANY_THROW(False2->sub(None2));
+    EXPECT_TRUE(False2->sub(False)->strictly_equal(VAR(Int, 0)));
+    EXPECT_TRUE(False2->sub(False2)->strictly_equal(VAR(Int, 0)));
+    EXPECT_TRUE(False2->sub(True)->strictly_equal(VAR(Int, -1)));
+    EXPECT_TRUE(False2->sub(True2)->strictly_equal(VAR(Int, -1)));
+    EXPECT_TRUE(False2->sub(IntZero)->strictly_equal(VAR(Int, 0)));
+    EXPECT_TRUE(False2->sub(IntOne)->strictly_equal(VAR(Int, -1)));
+    EXPECT_TRUE(False2->sub(IntTwo)->strictly_equal(VAR(Int, -2)));
+    EXPECT_TRUE(False2->sub(IntTwo2)->strictly_equal(VAR(Int, -2)));
+    EXPECT_TRUE(False2->sub(Int8)->strictly_equal(VAR(Int, -8)));
+    EXPECT_TRUE(False2->sub(IntMinusOne)->strictly_equal(VAR(Int, 1)));
+    EXPECT_TRUE(False2->sub(IntMinusOne2)->strictly_equal(VAR(Int, 1)));
+    EXPECT_TRUE(False2->sub(IntMinus12)->strictly_equal(VAR(Int, 12)));
+    EXPECT_TRUE(False2->sub(IntMinus73)->strictly_equal(VAR(Int, 73)));
+    EXPECT_TRUE(False2->sub(FloatMinusOne)->strictly_equal(VAR(Float, 1.0)));
+    EXPECT_TRUE(False2->sub(FloatZero)->strictly_equal(VAR(Float, 0.0)));
+    EXPECT_TRUE(False2->sub(FloatOne)->strictly_equal(VAR(Float, -1.0)));
+    EXPECT_TRUE(False2->sub(FloatTwo)->strictly_equal(VAR(Float, -2.0)));
+    EXPECT_TRUE(False2->sub(FloatTwo2)->strictly_equal(VAR(Float, -2.0)));
+    EXPECT_TRUE(False2->sub(Float2_5)->strictly_equal(VAR(Float, -2.5)));
+    EXPECT_TRUE(False2->sub(Float_23_74)->strictly_equal(VAR(Float, 23.74)));
+    EXPECT_ANY_THROW(False2->sub(StrEmpty));
+    EXPECT_ANY_THROW(False2->sub(StrEmpty2));
+    EXPECT_ANY_THROW(False2->sub(StrA));
+    EXPECT_ANY_THROW(False2->sub(StrA2));
+    EXPECT_ANY_THROW(False2->sub(StrB));
+    EXPECT_ANY_THROW(False2->sub(ListEmpty));
+    EXPECT_ANY_THROW(False2->sub(ListEmpty2));
+    EXPECT_ANY_THROW(True->sub(None));
+    EXPECT_ANY_THROW(True->sub(None2));
+    EXPECT_TRUE(True->sub(False)->strictly_equal(VAR(Int, 1)));
+    EXPECT_TRUE(True->sub(False2)->strictly_equal(VAR(Int, 1)));
+    EXPECT_TRUE(True->sub(True)->strictly_equal(VAR(Int, 0)));
+    EXPECT_TRUE(True->sub(True2)->strictly_equal(VAR(Int, 0)));
+    EXPECT_TRUE(True->sub(IntZero)->strictly_equal(VAR(Int, 1)));
+    EXPECT_TRUE(True->sub(IntOne)->strictly_equal(VAR(Int, 0)));
+    EXPECT_TRUE(True->sub(IntTwo)->strictly_equal(VAR(Int, -1)));
+    EXPECT_TRUE(True->sub(IntTwo2)->strictly_equal(VAR(Int, -1)));
+    EXPECT_TRUE(True->sub(Int8)->strictly_equal(VAR(Int, -7)));
+    EXPECT_TRUE(True->sub(IntMinusOne)->strictly_equal(VAR(Int, 2)));
+    EXPECT_TRUE(True->sub(IntMinusOne2)->strictly_equal(VAR(Int, 2)));
+    EXPECT_TRUE(True->sub(IntMinus12)->strictly_equal(VAR(Int, 13)));
+    EXPECT_TRUE(True->sub(IntMinus73)->strictly_equal(VAR(Int, 74)));
+    EXPECT_TRUE(True->sub(FloatMinusOne)->strictly_equal(VAR(Float, 2.0)));
+    EXPECT_TRUE(True->sub(FloatZero)->strictly_equal(VAR(Float, 1.0)));
+    EXPECT_TRUE(True->sub(FloatOne)->strictly_equal(VAR(Float, 0.0)));
+    EXPECT_TRUE(True->sub(FloatTwo)->strictly_equal(VAR(Float, -1.0)));
+    EXPECT_TRUE(True->sub(FloatTwo2)->strictly_equal(VAR(Float, -1.0)));
+    EXPECT_TRUE(True->sub(Float2_5)->strictly_equal(VAR(Float, -1.5)));
+    EXPECT_TRUE(True->sub(Float_23_74)->strictly_equal(VAR(Float, 24.74)));
+    EXPECT_ANY_THROW(True->sub(StrEmpty));
+    EXPECT_ANY_THROW(True->sub(StrEmpty2));
+    EXPECT_ANY_THROW(True->sub(StrA));
+    EXPECT_ANY_THROW(True->sub(StrA2));
+    EXPECT_ANY_THROW(True->sub(StrB));
+    EXPECT_ANY_THROW(True->sub(ListEmpty));
+    EXPECT_ANY_THROW(True->sub(ListEmpty2));
+    EXPECT_ANY_THROW(True2->sub(None));
+    EXPECT_ANY_THROW(True2->sub(None2));
+    EXPECT_TRUE(True2->sub(False)->strictly_equal(VAR(Int, 1)));
+    EXPECT_TRUE(True2->sub(False2)->strictly_equal(VAR(Int, 1)));
+    EXPECT_TRUE(True2->sub(True)->strictly_equal(VAR(Int, 0)));
+    EXPECT_TRUE(True2->sub(True2)->strictly_equal(VAR(Int, 0)));
+    EXPECT_TRUE(True2->sub(IntZero)->strictly_equal(VAR(Int, 1)));
+    EXPECT_TRUE(True2->sub(IntOne)->strictly_equal(VAR(Int, 0)));
+    EXPECT_TRUE(True2->sub(IntTwo)->strictly_equal(VAR(Int, -1)));
+    EXPECT_TRUE(True2->sub(IntTwo2)->strictly_equal(VAR(Int, -1)));
+    EXPECT_TRUE(True2->sub(Int8)->strictly_equal(VAR(Int, -7)));
+    EXPECT_TRUE(True2->sub(IntMinusOne)->strictly_equal(VAR(Int, 2)));
+    EXPECT_TRUE(True2->sub(IntMinusOne2)->strictly_equal(VAR(Int, 2)));
+    EXPECT_TRUE(True2->sub(IntMinus12)->strictly_equal(VAR(Int, 13)));
+    EXPECT_TRUE(True2->sub(IntMinus73)->strictly_equal(VAR(Int, 74)));
+    EXPECT_TRUE(True2->sub(FloatMinusOne)->strictly_equal(VAR(Float, 2.0)));
+    EXPECT_TRUE(True2->sub(FloatZero)->strictly_equal(VAR(Float, 1.0)));
+    EXPECT_TRUE(True2->sub(FloatOne)->strictly_equal(VAR(Float, 0.0)));
+    EXPECT_TRUE(True2->sub(FloatTwo)->strictly_equal(VAR(Float, -1.0)));
+    EXPECT_TRUE(True2->sub(FloatTwo2)->strictly_equal(VAR(Float, -1.0)));
+    EXPECT_TRUE(True2->sub(Float2_5)->strictly_equal(VAR(Float, -1.5)));
+    EXPECT_TRUE(True2->sub(Float_23_74)->strictly_equal(VAR(Float, 24.74)));
+    EXPECT_ANY_THROW(True2->sub(StrEmpty));
+    EXPECT_ANY_THROW(True2->sub(StrEmpty2));
+    EXPECT_ANY_THROW(True2->sub(StrA));
+    EXPECT_ANY_THROW(True2->sub(StrA2));
+    EXPECT_ANY_THROW(True2->sub(StrB));
+    EXPECT_ANY_THROW(True2->sub(ListEmpty));
+    EXPECT_ANY_THROW(True2->sub(ListEmpty2));
+    EXPECT_ANY_THROW(IntZero->sub(None));
+    EXPECT_ANY_THROW(IntZero->sub(None2));
+    EXPECT_TRUE(IntZero->sub(False)->strictly_equal(VAR(Int, 0)));
+    EXPECT_TRUE(IntZero->sub(False2)->strictly_equal(VAR(Int, 0)));
+    EXPECT_TRUE(IntZero->sub(True)->strictly_equal(VAR(Int, -1)));
+    EXPECT_TRUE(IntZero->sub(True2)->strictly_equal(VAR(Int, -1)));
+    EXPECT_TRUE(IntZero->sub(IntZero)->strictly_equal(VAR(Int, 0)));
+    EXPECT_TRUE(IntZero->sub(IntOne)->strictly_equal(VAR(Int, -1)));
+    EXPECT_TRUE(IntZero->sub(IntTwo)->strictly_equal(VAR(Int, -2)));
+    EXPECT_TRUE(IntZero->sub(IntTwo2)->strictly_equal(VAR(Int, -2)));
+    EXPECT_TRUE(IntZero->sub(Int8)->strictly_equal(VAR(Int, -8)));
+    EXPECT_TRUE(IntZero->sub(IntMinusOne)->strictly_equal(VAR(Int, 1)));
+    EXPECT_TRUE(IntZero->sub(IntMinusOne2)->strictly_equal(VAR(Int, 1)));
+    EXPECT_TRUE(IntZero->sub(IntMinus12)->strictly_equal(VAR(Int, 12)));
+    EXPECT_TRUE(IntZero->sub(IntMinus73)->strictly_equal(VAR(Int, 73)));
+    EXPECT_TRUE(IntZero->sub(FloatMinusOne)->strictly_equal(VAR(Float, 1.0)));
+    EXPECT_TRUE(IntZero->sub(FloatZero)->strictly_equal(VAR(Float, 0.0)));
+    EXPECT_TRUE(IntZero->sub(FloatOne)->strictly_equal(VAR(Float, -1.0)));
+    EXPECT_TRUE(IntZero->sub(FloatTwo)->strictly_equal(VAR(Float, -2.0)));
+    EXPECT_TRUE(IntZero->sub(FloatTwo2)->strictly_equal(VAR(Float, -2.0)));
+    EXPECT_TRUE(IntZero->sub(Float2_5)->strictly_equal(VAR(Float, -2.5)));
+    EXPECT_TRUE(IntZero->sub(Float_23_74)->strictly_equal(VAR(Float, 23.74)));
+    EXPECT_ANY_THROW(IntZero->sub(StrEmpty));
+    EXPECT_ANY_THROW(IntZero->sub(StrEmpty2));
+    EXPECT_ANY_THROW(IntZero->sub(StrA));
+    EXPECT_ANY_THROW(IntZero->sub(StrA2));
+    EXPECT_ANY_THROW(IntZero->sub(StrB));
+    EXPECT_ANY_THROW(IntZero->sub(ListEmpty));
+    EXPECT_ANY_THROW(IntZero->sub(ListEmpty2));
+    EXPECT_ANY_THROW(IntOne->sub(None));
+    EXPECT_ANY_THROW(IntOne->sub(None2));
+    EXPECT_TRUE(IntOne->sub(False)->strictly_equal(VAR(Int, 1)));
+    EXPECT_TRUE(IntOne->sub(False2)->strictly_equal(VAR(Int, 1)));
+    EXPECT_TRUE(IntOne->sub(True)->strictly_equal(VAR(Int, 0)));
+    EXPECT_TRUE(IntOne->sub(True2)->strictly_equal(VAR(Int, 0)));
+    EXPECT_TRUE(IntOne->sub(IntZero)->strictly_equal(VAR(Int, 1)));
+    EXPECT_TRUE(IntOne->sub(IntOne)->strictly_equal(VAR(Int, 0)));
+    EXPECT_TRUE(IntOne->sub(IntTwo)->strictly_equal(VAR(Int, -1)));
+    EXPECT_TRUE(IntOne->sub(IntTwo2)->strictly_equal(VAR(Int, -1)));
+    EXPECT_TRUE(IntOne->sub(Int8)->strictly_equal(VAR(Int, -7)));
+    EXPECT_TRUE(IntOne->sub(IntMinusOne)->strictly_equal(VAR(Int, 2)));
+    EXPECT_TRUE(IntOne->sub(IntMinusOne2)->strictly_equal(VAR(Int, 2)));
+    EXPECT_TRUE(IntOne->sub(IntMinus12)->strictly_equal(VAR(Int, 13)));
+    EXPECT_TRUE(IntOne->sub(IntMinus73)->strictly_equal(VAR(Int, 74)));
+    EXPECT_TRUE(IntOne->sub(FloatMinusOne)->strictly_equal(VAR(Float, 2.0)));
+    EXPECT_TRUE(IntOne->sub(FloatZero)->strictly_equal(VAR(Float, 1.0)));
+    EXPECT_TRUE(IntOne->sub(FloatOne)->strictly_equal(VAR(Float, 0.0)));
+    EXPECT_TRUE(IntOne->sub(FloatTwo)->strictly_equal(VAR(Float, -1.0)));
+    EXPECT_TRUE(IntOne->sub(FloatTwo2)->strictly_equal(VAR(Float, -1.0)));
+    EXPECT_TRUE(IntOne->sub(Float2_5)->strictly_equal(VAR(Float, -1.5)));
+    EXPECT_TRUE(IntOne->sub(Float_23_74)->strictly_equal(VAR(Float, 24.74)));
+    EXPECT_ANY_THROW(IntOne->sub(StrEmpty));
+    EXPECT_ANY_THROW(IntOne->sub(StrEmpty2));
+    EXPECT_ANY_THROW(IntOne->sub(StrA));
+    EXPECT_ANY_THROW(IntOne->sub(StrA2));
+    EXPECT_ANY_THROW(IntOne->sub(StrB));
+    EXPECT_ANY_THROW(IntOne->sub(ListEmpty));
+    EXPECT_ANY_THROW(IntOne->sub(ListEmpty2));
+    EXPECT_ANY_THROW(IntTwo->sub(None));
+    EXPECT_ANY_THROW(IntTwo->sub(None2));
+    EXPECT_TRUE(IntTwo->sub(False)->strictly_equal(VAR(Int, 2)));
+    EXPECT_TRUE(IntTwo->sub(False2)->strictly_equal(VAR(Int, 2)));
+    EXPECT_TRUE(IntTwo->sub(True)->strictly_equal(VAR(Int, 1)));
+    EXPECT_TRUE(IntTwo->sub(True2)->strictly_equal(VAR(Int, 1)));
+    EXPECT_TRUE(IntTwo->sub(IntZero)->strictly_equal(VAR(Int, 2)));
+    EXPECT_TRUE(IntTwo->sub(IntOne)->strictly_equal(VAR(Int, 1)));
+    EXPECT_TRUE(IntTwo->sub(IntTwo)->strictly_equal(VAR(Int, 0)));
+    EXPECT_TRUE(IntTwo->sub(IntTwo2)->strictly_equal(VAR(Int, 0)));
+    EXPECT_TRUE(IntTwo->sub(Int8)->strictly_equal(VAR(Int, -6)));
+    EXPECT_TRUE(IntTwo->sub(IntMinusOne)->strictly_equal(VAR(Int, 3)));
+    EXPECT_TRUE(IntTwo->sub(IntMinusOne2)->strictly_equal(VAR(Int, 3)));
+    EXPECT_TRUE(IntTwo->sub(IntMinus12)->strictly_equal(VAR(Int, 14)));
+    EXPECT_TRUE(IntTwo->sub(IntMinus73)->strictly_equal(VAR(Int, 75)));
+    EXPECT_TRUE(IntTwo->sub(FloatMinusOne)->strictly_equal(VAR(Float, 3.0)));
+    EXPECT_TRUE(IntTwo->sub(FloatZero)->strictly_equal(VAR(Float, 2.0)));
+    EXPECT_TRUE(IntTwo->sub(FloatOne)->strictly_equal(VAR(Float, 1.0)));
+    EXPECT_TRUE(IntTwo->sub(FloatTwo)->strictly_equal(VAR(Float, 0.0)));
+    EXPECT_TRUE(IntTwo->sub(FloatTwo2)->strictly_equal(VAR(Float, 0.0)));
+    EXPECT_TRUE(IntTwo->sub(Float2_5)->strictly_equal(VAR(Float, -0.5)));
+    EXPECT_TRUE(IntTwo->sub(Float_23_74)->strictly_equal(VAR(Float, 25.74)));
+    EXPECT_ANY_THROW(IntTwo->sub(StrEmpty));
+    EXPECT_ANY_THROW(IntTwo->sub(StrEmpty2));
+    EXPECT_ANY_THROW(IntTwo->sub(StrA));
+    EXPECT_ANY_THROW(IntTwo->sub(StrA2));
+    EXPECT_ANY_THROW(IntTwo->sub(StrB));
+    EXPECT_ANY_THROW(IntTwo->sub(ListEmpty));
+    EXPECT_ANY_THROW(IntTwo->sub(ListEmpty2));
+    EXPECT_ANY_THROW(IntTwo2->sub(None));
+    EXPECT_ANY_THROW(IntTwo2->sub(None2));
+    EXPECT_TRUE(IntTwo2->sub(False)->strictly_equal(VAR(Int, 2)));
+    EXPECT_TRUE(IntTwo2->sub(False2)->strictly_equal(VAR(Int, 2)));
+    EXPECT_TRUE(IntTwo2->sub(True)->strictly_equal(VAR(Int, 1)));
+    EXPECT_TRUE(IntTwo2->sub(True2)->strictly_equal(VAR(Int, 1)));
+    EXPECT_TRUE(IntTwo2->sub(IntZero)->strictly_equal(VAR(Int, 2)));
+    EXPECT_TRUE(IntTwo2->sub(IntOne)->strictly_equal(VAR(Int, 1)));
+    EXPECT_TRUE(IntTwo2->sub(IntTwo)->strictly_equal(VAR(Int, 0)));
+    EXPECT_TRUE(IntTwo2->sub(IntTwo2)->strictly_equal(VAR(Int, 0)));
+    EXPECT_TRUE(IntTwo2->sub(Int8)->strictly_equal(VAR(Int, -6)));
+    EXPECT_TRUE(IntTwo2->sub(IntMinusOne)->strictly_equal(VAR(Int, 3)));
+    EXPECT_TRUE(IntTwo2->sub(IntMinusOne2)->strictly_equal(VAR(Int, 3)));
+    EXPECT_TRUE(IntTwo2->sub(IntMinus12)->strictly_equal(VAR(Int, 14)));
+    EXPECT_TRUE(IntTwo2->sub(IntMinus73)->strictly_equal(VAR(Int, 75)));
+    EXPECT_TRUE(IntTwo2->sub(FloatMinusOne)->strictly_equal(VAR(Float, 3.0)));
+    EXPECT_TRUE(IntTwo2->sub(FloatZero)->strictly_equal(VAR(Float, 2.0)));
+    EXPECT_TRUE(IntTwo2->sub(FloatOne)->strictly_equal(VAR(Float, 1.0)));
+    EXPECT_TRUE(IntTwo2->sub(FloatTwo)->strictly_equal(VAR(Float, 0.0)));
+    EXPECT_TRUE(IntTwo2->sub(FloatTwo2)->strictly_equal(VAR(Float, 0.0)));
+    EXPECT_TRUE(IntTwo2->sub(Float2_5)->strictly_equal(VAR(Float, -0.5)));
+    EXPECT_TRUE(IntTwo2->sub(Float_23_74)->strictly_equal(VAR(Float, 25.74)));
+    EXPECT_ANY_THROW(IntTwo2->sub(StrEmpty));
+    EXPECT_ANY_THROW(IntTwo2->sub(StrEmpty2));
+    EXPECT_ANY_THROW(IntTwo2->sub(StrA));
+    EXPECT_ANY_THROW(IntTwo2->sub(StrA2));
+    EXPECT_ANY_THROW(IntTwo2->sub(StrB));
+    EXPECT_ANY_THROW(IntTwo2->sub(ListEmpty));
+    EXPECT_ANY_THROW(IntTwo2->sub(ListEmpty2));
+    EXPECT_ANY_THROW(Int8->sub(None));
+    EXPECT_ANY_THROW(Int8->sub(None2));
+    EXPECT_TRUE(Int8->sub(False)->strictly_equal(VAR(Int, 8)));
+    EXPECT_TRUE(Int8->sub(False2)->strictly_equal(VAR(Int, 8)));
+    EXPECT_TRUE(Int8->sub(True)->strictly_equal(VAR(Int, 7)));
+    EXPECT_TRUE(Int8->sub(True2)->strictly_equal(VAR(Int, 7)));
+    EXPECT_TRUE(Int8->sub(IntZero)->strictly_equal(VAR(Int, 8)));
+    EXPECT_TRUE(Int8->sub(IntOne)->strictly_equal(VAR(Int, 7)));
+    EXPECT_TRUE(Int8->sub(IntTwo)->strictly_equal(VAR(Int, 6)));
+    EXPECT_TRUE(Int8->sub(IntTwo2)->strictly_equal(VAR(Int, 6)));
+    EXPECT_TRUE(Int8->sub(Int8)->strictly_equal(VAR(Int, 0)));
+    EXPECT_TRUE(Int8->sub(IntMinusOne)->strictly_equal(VAR(Int, 9)));
+    EXPECT_TRUE(Int8->sub(IntMinusOne2)->strictly_equal(VAR(Int, 9)));
+    EXPECT_TRUE(Int8->sub(IntMinus12)->strictly_equal(VAR(Int, 20)));
+    EXPECT_TRUE(Int8->sub(IntMinus73)->strictly_equal(VAR(Int, 81)));
+    EXPECT_TRUE(Int8->sub(FloatMinusOne)->strictly_equal(VAR(Float, 9.0)));
+    EXPECT_TRUE(Int8->sub(FloatZero)->strictly_equal(VAR(Float, 8.0)));
+    EXPECT_TRUE(Int8->sub(FloatOne)->strictly_equal(VAR(Float, 7.0)));
+    EXPECT_TRUE(Int8->sub(FloatTwo)->strictly_equal(VAR(Float, 6.0)));
+    EXPECT_TRUE(Int8->sub(FloatTwo2)->strictly_equal(VAR(Float, 6.0)));
+    EXPECT_TRUE(Int8->sub(Float2_5)->strictly_equal(VAR(Float, 5.5)));
+    EXPECT_TRUE(Int8->sub(Float_23_74)->strictly_equal(VAR(Float, 31.74)));
+    EXPECT_ANY_THROW(Int8->sub(StrEmpty));
+    EXPECT_ANY_THROW(Int8->sub(StrEmpty2));
+    EXPECT_ANY_THROW(Int8->sub(StrA));
+    EXPECT_ANY_THROW(Int8->sub(StrA2));
+    EXPECT_ANY_THROW(Int8->sub(StrB));
+    EXPECT_ANY_THROW(Int8->sub(ListEmpty));
+    EXPECT_ANY_THROW(Int8->sub(ListEmpty2));
+    EXPECT_ANY_THROW(IntMinusOne->sub(None));
+    EXPECT_ANY_THROW(IntMinusOne->sub(None2));
+    EXPECT_TRUE(IntMinusOne->sub(False)->strictly_equal(VAR(Int, -1)));
+    EXPECT_TRUE(IntMinusOne->sub(False2)->strictly_equal(VAR(Int, -1)));
+    EXPECT_TRUE(IntMinusOne->sub(True)->strictly_equal(VAR(Int, -2)));
+    EXPECT_TRUE(IntMinusOne->sub(True2)->strictly_equal(VAR(Int, -2)));
+    EXPECT_TRUE(IntMinusOne->sub(IntZero)->strictly_equal(VAR(Int, -1)));
+    EXPECT_TRUE(IntMinusOne->sub(IntOne)->strictly_equal(VAR(Int, -2)));
+    EXPECT_TRUE(IntMinusOne->sub(IntTwo)->strictly_equal(VAR(Int, -3)));
+    EXPECT_TRUE(IntMinusOne->sub(IntTwo2)->strictly_equal(VAR(Int, -3)));
+    EXPECT_TRUE(IntMinusOne->sub(Int8)->strictly_equal(VAR(Int, -9)));
+    EXPECT_TRUE(IntMinusOne->sub(IntMinusOne)->strictly_equal(VAR(Int, 0)));
+    EXPECT_TRUE(IntMinusOne->sub(IntMinusOne2)->strictly_equal(VAR(Int, 0)));
+    EXPECT_TRUE(IntMinusOne->sub(IntMinus12)->strictly_equal(VAR(Int, 11)));
+    EXPECT_TRUE(IntMinusOne->sub(IntMinus73)->strictly_equal(VAR(Int, 72)));
+    EXPECT_TRUE(IntMinusOne->sub(FloatMinusOne)->strictly_equal(VAR(Float, 0.0)));
+    EXPECT_TRUE(IntMinusOne->sub(FloatZero)->strictly_equal(VAR(Float, -1.0)));
+    EXPECT_TRUE(IntMinusOne->sub(FloatOne)->strictly_equal(VAR(Float, -2.0)));
+    EXPECT_TRUE(IntMinusOne->sub(FloatTwo)->strictly_equal(VAR(Float, -3.0)));
+    EXPECT_TRUE(IntMinusOne->sub(FloatTwo2)->strictly_equal(VAR(Float, -3.0)));
+    EXPECT_TRUE(IntMinusOne->sub(Float2_5)->strictly_equal(VAR(Float, -3.5)));
+    EXPECT_TRUE(IntMinusOne->sub(Float_23_74)->strictly_equal(VAR(Float, 22.74)));
+    EXPECT_ANY_THROW(IntMinusOne->sub(StrEmpty));
+    EXPECT_ANY_THROW(IntMinusOne->sub(StrEmpty2));
+    EXPECT_ANY_THROW(IntMinusOne->sub(StrA));
+    EXPECT_ANY_THROW(IntMinusOne->sub(StrA2));
+    EXPECT_ANY_THROW(IntMinusOne->sub(StrB));
+    EXPECT_ANY_THROW(IntMinusOne->sub(ListEmpty));
+    EXPECT_ANY_THROW(IntMinusOne->sub(ListEmpty2));
+    EXPECT_ANY_THROW(IntMinusOne2->sub(None));
+    EXPECT_ANY_THROW(IntMinusOne2->sub(None2));
+    EXPECT_TRUE(IntMinusOne2->sub(False)->strictly_equal(VAR(Int, -1)));
+    EXPECT_TRUE(IntMinusOne2->sub(False2)->strictly_equal(VAR(Int, -1)));
+    EXPECT_TRUE(IntMinusOne2->sub(True)->strictly_equal(VAR(Int, -2)));
+    EXPECT_TRUE(IntMinusOne2->sub(True2)->strictly_equal(VAR(Int, -2)));
+    EXPECT_TRUE(IntMinusOne2->sub(IntZero)->strictly_equal(VAR(Int, -1)));
+    EXPECT_TRUE(IntMinusOne2->sub(IntOne)->strictly_equal(VAR(Int, -2)));
+    EXPECT_TRUE(IntMinusOne2->sub(IntTwo)->strictly_equal(VAR(Int, -3)));
+    EXPECT_TRUE(IntMinusOne2->sub(IntTwo2)->strictly_equal(VAR(Int, -3)));
+    EXPECT_TRUE(IntMinusOne2->sub(Int8)->strictly_equal(VAR(Int, -9)));
+    EXPECT_TRUE(IntMinusOne2->sub(IntMinusOne)->strictly_equal(VAR(Int, 0)));
+    EXPECT_TRUE(IntMinusOne2->sub(IntMinusOne2)->strictly_equal(VAR(Int, 0)));
+    EXPECT_TRUE(IntMinusOne2->sub(IntMinus12)->strictly_equal(VAR(Int, 11)));
+    EXPECT_TRUE(IntMinusOne2->sub(IntMinus73)->strictly_equal(VAR(Int, 72)));
+    EXPECT_TRUE(IntMinusOne2->sub(FloatMinusOne)->strictly_equal(VAR(Float, 0.0)));
+    EXPECT_TRUE(IntMinusOne2->sub(FloatZero)->strictly_equal(VAR(Float, -1.0)));
+    EXPECT_TRUE(IntMinusOne2->sub(FloatOne)->strictly_equal(VAR(Float, -2.0)));
+    EXPECT_TRUE(IntMinusOne2->sub(FloatTwo)->strictly_equal(VAR(Float, -3.0)));
+    EXPECT_TRUE(IntMinusOne2->sub(FloatTwo2)->strictly_equal(VAR(Float, -3.0)));
+    EXPECT_TRUE(IntMinusOne2->sub(Float2_5)->strictly_equal(VAR(Float, -3.5)));
+    EXPECT_TRUE(IntMinusOne2->sub(Float_23_74)->strictly_equal(VAR(Float, 22.74)));
+    EXPECT_ANY_THROW(IntMinusOne2->sub(StrEmpty));
+    EXPECT_ANY_THROW(IntMinusOne2->sub(StrEmpty2));
+    EXPECT_ANY_THROW(IntMinusOne2->sub(StrA));
+    EXPECT_ANY_THROW(IntMinusOne2->sub(StrA2));
+    EXPECT_ANY_THROW(IntMinusOne2->sub(StrB));
+    EXPECT_ANY_THROW(IntMinusOne2->sub(ListEmpty));
+    EXPECT_ANY_THROW(IntMinusOne2->sub(ListEmpty2));
+    EXPECT_ANY_THROW(IntMinus12->sub(None));
+    EXPECT_ANY_THROW(IntMinus12->sub(None2));
+    EXPECT_TRUE(IntMinus12->sub(False)->strictly_equal(VAR(Int, -12)));
+    EXPECT_TRUE(IntMinus12->sub(False2)->strictly_equal(VAR(Int, -12)));
+    EXPECT_TRUE(IntMinus12->sub(True)->strictly_equal(VAR(Int, -13)));
+    EXPECT_TRUE(IntMinus12->sub(True2)->strictly_equal(VAR(Int, -13)));
+    EXPECT_TRUE(IntMinus12->sub(IntZero)->strictly_equal(VAR(Int, -12)));
+    EXPECT_TRUE(IntMinus12->sub(IntOne)->strictly_equal(VAR(Int, -13)));
+    EXPECT_TRUE(IntMinus12->sub(IntTwo)->strictly_equal(VAR(Int, -14)));
+    EXPECT_TRUE(IntMinus12->sub(IntTwo2)->strictly_equal(VAR(Int, -14)));
+    EXPECT_TRUE(IntMinus12->sub(Int8)->strictly_equal(VAR(Int, -20)));
+    EXPECT_TRUE(IntMinus12->sub(IntMinusOne)->strictly_equal(VAR(Int, -11)));
+    EXPECT_TRUE(IntMinus12->sub(IntMinusOne2)->strictly_equal(VAR(Int, -11)));
+    EXPECT_TRUE(IntMinus12->sub(IntMinus12)->strictly_equal(VAR(Int, 0)));
+    EXPECT_TRUE(IntMinus12->sub(IntMinus73)->strictly_equal(VAR(Int, 61)));
+    EXPECT_TRUE(IntMinus12->sub(FloatMinusOne)->strictly_equal(VAR(Float, -11.0)));
+    EXPECT_TRUE(IntMinus12->sub(FloatZero)->strictly_equal(VAR(Float, -12.0)));
+    EXPECT_TRUE(IntMinus12->sub(FloatOne)->strictly_equal(VAR(Float, -13.0)));
+    EXPECT_TRUE(IntMinus12->sub(FloatTwo)->strictly_equal(VAR(Float, -14.0)));
+    EXPECT_TRUE(IntMinus12->sub(FloatTwo2)->strictly_equal(VAR(Float, -14.0)));
+    EXPECT_TRUE(IntMinus12->sub(Float2_5)->strictly_equal(VAR(Float, -14.5)));
+    EXPECT_TRUE(IntMinus12->sub(Float_23_74)->strictly_equal(VAR(Float, 11.739999999999998)));
+    EXPECT_ANY_THROW(IntMinus12->sub(StrEmpty));
+    EXPECT_ANY_THROW(IntMinus12->sub(StrEmpty2));
+    EXPECT_ANY_THROW(IntMinus12->sub(StrA));
+    EXPECT_ANY_THROW(IntMinus12->sub(StrA2));
+    EXPECT_ANY_THROW(IntMinus12->sub(StrB));
+    EXPECT_ANY_THROW(IntMinus12->sub(ListEmpty));
+    EXPECT_ANY_THROW(IntMinus12->sub(ListEmpty2));
+    EXPECT_ANY_THROW(IntMinus73->sub(None));
+    EXPECT_ANY_THROW(IntMinus73->sub(None2));
+    EXPECT_TRUE(IntMinus73->sub(False)->strictly_equal(VAR(Int, -73)));
+    EXPECT_TRUE(IntMinus73->sub(False2)->strictly_equal(VAR(Int, -73)));
+    EXPECT_TRUE(IntMinus73->sub(True)->strictly_equal(VAR(Int, -74)));
+    EXPECT_TRUE(IntMinus73->sub(True2)->strictly_equal(VAR(Int, -74)));
+    EXPECT_TRUE(IntMinus73->sub(IntZero)->strictly_equal(VAR(Int, -73)));
+    EXPECT_TRUE(IntMinus73->sub(IntOne)->strictly_equal(VAR(Int, -74)));
+    EXPECT_TRUE(IntMinus73->sub(IntTwo)->strictly_equal(VAR(Int, -75)));
+    EXPECT_TRUE(IntMinus73->sub(IntTwo2)->strictly_equal(VAR(Int, -75)));
+    EXPECT_TRUE(IntMinus73->sub(Int8)->strictly_equal(VAR(Int, -81)));
+    EXPECT_TRUE(IntMinus73->sub(IntMinusOne)->strictly_equal(VAR(Int, -72)));
+    EXPECT_TRUE(IntMinus73->sub(IntMinusOne2)->strictly_equal(VAR(Int, -72)));
+    EXPECT_TRUE(IntMinus73->sub(IntMinus12)->strictly_equal(VAR(Int, -61)));
+    EXPECT_TRUE(IntMinus73->sub(IntMinus73)->strictly_equal(VAR(Int, 0)));
+    EXPECT_TRUE(IntMinus73->sub(FloatMinusOne)->strictly_equal(VAR(Float, -72.0)));
+    EXPECT_TRUE(IntMinus73->sub(FloatZero)->strictly_equal(VAR(Float, -73.0)));
+    EXPECT_TRUE(IntMinus73->sub(FloatOne)->strictly_equal(VAR(Float, -74.0)));
+    EXPECT_TRUE(IntMinus73->sub(FloatTwo)->strictly_equal(VAR(Float, -75.0)));
+    EXPECT_TRUE(IntMinus73->sub(FloatTwo2)->strictly_equal(VAR(Float, -75.0)));
+    EXPECT_TRUE(IntMinus73->sub(Float2_5)->strictly_equal(VAR(Float, -75.5)));
+    EXPECT_TRUE(IntMinus73->sub(Float_23_74)->strictly_equal(VAR(Float, -49.260000000000005)));
+    EXPECT_ANY_THROW(IntMinus73->sub(StrEmpty));
+    EXPECT_ANY_THROW(IntMinus73->sub(StrEmpty2));
+    EXPECT_ANY_THROW(IntMinus73->sub(StrA));
+    EXPECT_ANY_THROW(IntMinus73->sub(StrA2));
+    EXPECT_ANY_THROW(IntMinus73->sub(StrB));
+    EXPECT_ANY_THROW(IntMinus73->sub(ListEmpty));
+    EXPECT_ANY_THROW(IntMinus73->sub(ListEmpty2));
+    EXPECT_ANY_THROW(FloatMinusOne->sub(None));
+    EXPECT_ANY_THROW(FloatMinusOne->sub(None2));
+    EXPECT_TRUE(FloatMinusOne->sub(False)->strictly_equal(VAR(Float, -1.0)));
+    EXPECT_TRUE(FloatMinusOne->sub(False2)->strictly_equal(VAR(Float, -1.0)));
+    EXPECT_TRUE(FloatMinusOne->sub(True)->strictly_equal(VAR(Float, -2.0)));
+    EXPECT_TRUE(FloatMinusOne->sub(True2)->strictly_equal(VAR(Float, -2.0)));
+    EXPECT_TRUE(FloatMinusOne->sub(IntZero)->strictly_equal(VAR(Float, -1.0)));
+    EXPECT_TRUE(FloatMinusOne->sub(IntOne)->strictly_equal(VAR(Float, -2.0)));
+    EXPECT_TRUE(FloatMinusOne->sub(IntTwo)->strictly_equal(VAR(Float, -3.0)));
+    EXPECT_TRUE(FloatMinusOne->sub(IntTwo2)->strictly_equal(VAR(Float, -3.0)));
+    EXPECT_TRUE(FloatMinusOne->sub(Int8)->strictly_equal(VAR(Float, -9.0)));
+    EXPECT_TRUE(FloatMinusOne->sub(IntMinusOne)->strictly_equal(VAR(Float, 0.0)));
+    EXPECT_TRUE(FloatMinusOne->sub(IntMinusOne2)->strictly_equal(VAR(Float, 0.0)));
+    EXPECT_TRUE(FloatMinusOne->sub(IntMinus12)->strictly_equal(VAR(Float, 11.0)));
+    EXPECT_TRUE(FloatMinusOne->sub(IntMinus73)->strictly_equal(VAR(Float, 72.0)));
+    EXPECT_TRUE(FloatMinusOne->sub(FloatMinusOne)->strictly_equal(VAR(Float, 0.0)));
+    EXPECT_TRUE(FloatMinusOne->sub(FloatZero)->strictly_equal(VAR(Float, -1.0)));
+    EXPECT_TRUE(FloatMinusOne->sub(FloatOne)->strictly_equal(VAR(Float, -2.0)));
+    EXPECT_TRUE(FloatMinusOne->sub(FloatTwo)->strictly_equal(VAR(Float, -3.0)));
+    EXPECT_TRUE(FloatMinusOne->sub(FloatTwo2)->strictly_equal(VAR(Float, -3.0)));
+    EXPECT_TRUE(FloatMinusOne->sub(Float2_5)->strictly_equal(VAR(Float, -3.5)));
+    EXPECT_TRUE(FloatMinusOne->sub(Float_23_74)->strictly_equal(VAR(Float, 22.74)));
+    EXPECT_ANY_THROW(FloatMinusOne->sub(StrEmpty));
+    EXPECT_ANY_THROW(FloatMinusOne->sub(StrEmpty2));
+    EXPECT_ANY_THROW(FloatMinusOne->sub(StrA));
+    EXPECT_ANY_THROW(FloatMinusOne->sub(StrA2));
+    EXPECT_ANY_THROW(FloatMinusOne->sub(StrB));
+    EXPECT_ANY_THROW(FloatMinusOne->sub(ListEmpty));
+    EXPECT_ANY_THROW(FloatMinusOne->sub(ListEmpty2));
+    EXPECT_ANY_THROW(FloatZero->sub(None));
+    EXPECT_ANY_THROW(FloatZero->sub(None2));
+    EXPECT_TRUE(FloatZero->sub(False)->strictly_equal(VAR(Float, 0.0)));
+    EXPECT_TRUE(FloatZero->sub(False2)->strictly_equal(VAR(Float, 0.0)));
+    EXPECT_TRUE(FloatZero->sub(True)->strictly_equal(VAR(Float, -1.0)));
+    EXPECT_TRUE(FloatZero->sub(True2)->strictly_equal(VAR(Float, -1.0)));
+    EXPECT_TRUE(FloatZero->sub(IntZero)->strictly_equal(VAR(Float, 0.0)));
+    EXPECT_TRUE(FloatZero->sub(IntOne)->strictly_equal(VAR(Float, -1.0)));
+    EXPECT_TRUE(FloatZero->sub(IntTwo)->strictly_equal(VAR(Float, -2.0)));
+    EXPECT_TRUE(FloatZero->sub(IntTwo2)->strictly_equal(VAR(Float, -2.0)));
+    EXPECT_TRUE(FloatZero->sub(Int8)->strictly_equal(VAR(Float, -8.0)));
+    EXPECT_TRUE(FloatZero->sub(IntMinusOne)->strictly_equal(VAR(Float, 1.0)));
+    EXPECT_TRUE(FloatZero->sub(IntMinusOne2)->strictly_equal(VAR(Float, 1.0)));
+    EXPECT_TRUE(FloatZero->sub(IntMinus12)->strictly_equal(VAR(Float, 12.0)));
+    EXPECT_TRUE(FloatZero->sub(IntMinus73)->strictly_equal(VAR(Float, 73.0)));
+    EXPECT_TRUE(FloatZero->sub(FloatMinusOne)->strictly_equal(VAR(Float, 1.0)));
+    EXPECT_TRUE(FloatZero->sub(FloatZero)->strictly_equal(VAR(Float, 0.0)));
+    EXPECT_TRUE(FloatZero->sub(FloatOne)->strictly_equal(VAR(Float, -1.0)));
+    EXPECT_TRUE(FloatZero->sub(FloatTwo)->strictly_equal(VAR(Float, -2.0)));
+    EXPECT_TRUE(FloatZero->sub(FloatTwo2)->strictly_equal(VAR(Float, -2.0)));
+    EXPECT_TRUE(FloatZero->sub(Float2_5)->strictly_equal(VAR(Float, -2.5)));
+    EXPECT_TRUE(FloatZero->sub(Float_23_74)->strictly_equal(VAR(Float, 23.74)));
+    EXPECT_ANY_THROW(FloatZero->sub(StrEmpty));
+    EXPECT_ANY_THROW(FloatZero->sub(StrEmpty2));
+    EXPECT_ANY_THROW(FloatZero->sub(StrA));
+    EXPECT_ANY_THROW(FloatZero->sub(StrA2));
+    EXPECT_ANY_THROW(FloatZero->sub(StrB));
+    EXPECT_ANY_THROW(FloatZero->sub(ListEmpty));
+    EXPECT_ANY_THROW(FloatZero->sub(ListEmpty2));
+    EXPECT_ANY_THROW(FloatOne->sub(None));
+    EXPECT_ANY_THROW(FloatOne->sub(None2));
+    EXPECT_TRUE(FloatOne->sub(False)->strictly_equal(VAR(Float, 1.0)));
+    EXPECT_TRUE(FloatOne->sub(False2)->strictly_equal(VAR(Float, 1.0)));
+    EXPECT_TRUE(FloatOne->sub(True)->strictly_equal(VAR(Float, 0.0)));
+    EXPECT_TRUE(FloatOne->sub(True2)->strictly_equal(VAR(Float, 0.0)));
+    EXPECT_TRUE(FloatOne->sub(IntZero)->strictly_equal(VAR(Float, 1.0)));
+    EXPECT_TRUE(FloatOne->sub(IntOne)->strictly_equal(VAR(Float, 0.0)));
+    EXPECT_TRUE(FloatOne->sub(IntTwo)->strictly_equal(VAR(Float, -1.0)));
+    EXPECT_TRUE(FloatOne->sub(IntTwo2)->strictly_equal(VAR(Float, -1.0)));
+    EXPECT_TRUE(FloatOne->sub(Int8)->strictly_equal(VAR(Float, -7.0)));
+    EXPECT_TRUE(FloatOne->sub(IntMinusOne)->strictly_equal(VAR(Float, 2.0)));
+    EXPECT_TRUE(FloatOne->sub(IntMinusOne2)->strictly_equal(VAR(Float, 2.0)));
+    EXPECT_TRUE(FloatOne->sub(IntMinus12)->strictly_equal(VAR(Float, 13.0)));
+    EXPECT_TRUE(FloatOne->sub(IntMinus73)->strictly_equal(VAR(Float, 74.0)));
+    EXPECT_TRUE(FloatOne->sub(FloatMinusOne)->strictly_equal(VAR(Float, 2.0)));
+    EXPECT_TRUE(FloatOne->sub(FloatZero)->strictly_equal(VAR(Float, 1.0)));
+    EXPECT_TRUE(FloatOne->sub(FloatOne)->strictly_equal(VAR(Float, 0.0)));
+    EXPECT_TRUE(FloatOne->sub(FloatTwo)->strictly_equal(VAR(Float, -1.0)));
+    EXPECT_TRUE(FloatOne->sub(FloatTwo2)->strictly_equal(VAR(Float, -1.0)));
+    EXPECT_TRUE(FloatOne->sub(Float2_5)->strictly_equal(VAR(Float, -1.5)));
+    EXPECT_TRUE(FloatOne->sub(Float_23_74)->strictly_equal(VAR(Float, 24.74)));
+    EXPECT_ANY_THROW(FloatOne->sub(StrEmpty));
+    EXPECT_ANY_THROW(FloatOne->sub(StrEmpty2));
+    EXPECT_ANY_THROW(FloatOne->sub(StrA));
+    EXPECT_ANY_THROW(FloatOne->sub(StrA2));
+    EXPECT_ANY_THROW(FloatOne->sub(StrB));
+    EXPECT_ANY_THROW(FloatOne->sub(ListEmpty));
+    EXPECT_ANY_THROW(FloatOne->sub(ListEmpty2));
+    EXPECT_ANY_THROW(FloatTwo->sub(None));
+    EXPECT_ANY_THROW(FloatTwo->sub(None2));
+    EXPECT_TRUE(FloatTwo->sub(False)->strictly_equal(VAR(Float, 2.0)));
+    EXPECT_TRUE(FloatTwo->sub(False2)->strictly_equal(VAR(Float, 2.0)));
+    EXPECT_TRUE(FloatTwo->sub(True)->strictly_equal(VAR(Float, 1.0)));
+    EXPECT_TRUE(FloatTwo->sub(True2)->strictly_equal(VAR(Float, 1.0)));
+    EXPECT_TRUE(FloatTwo->sub(IntZero)->strictly_equal(VAR(Float, 2.0)));
+    EXPECT_TRUE(FloatTwo->sub(IntOne)->strictly_equal(VAR(Float, 1.0)));
+    EXPECT_TRUE(FloatTwo->sub(IntTwo)->strictly_equal(VAR(Float, 0.0)));
+    EXPECT_TRUE(FloatTwo->sub(IntTwo2)->strictly_equal(VAR(Float, 0.0)));
+    EXPECT_TRUE(FloatTwo->sub(Int8)->strictly_equal(VAR(Float, -6.0)));
+    EXPECT_TRUE(FloatTwo->sub(IntMinusOne)->strictly_equal(VAR(Float, 3.0)));
+    EXPECT_TRUE(FloatTwo->sub(IntMinusOne2)->strictly_equal(VAR(Float, 3.0)));
+    EXPECT_TRUE(FloatTwo->sub(IntMinus12)->strictly_equal(VAR(Float, 14.0)));
+    EXPECT_TRUE(FloatTwo->sub(IntMinus73)->strictly_equal(VAR(Float, 75.0)));
+    EXPECT_TRUE(FloatTwo->sub(FloatMinusOne)->strictly_equal(VAR(Float, 3.0)));
+    EXPECT_TRUE(FloatTwo->sub(FloatZero)->strictly_equal(VAR(Float, 2.0)));
+    EXPECT_TRUE(FloatTwo->sub(FloatOne)->strictly_equal(VAR(Float, 1.0)));
+    EXPECT_TRUE(FloatTwo->sub(FloatTwo)->strictly_equal(VAR(Float, 0.0)));
+    EXPECT_TRUE(FloatTwo->sub(FloatTwo2)->strictly_equal(VAR(Float, 0.0)));
+    EXPECT_TRUE(FloatTwo->sub(Float2_5)->strictly_equal(VAR(Float, -0.5)));
+    EXPECT_TRUE(FloatTwo->sub(Float_23_74)->strictly_equal(VAR(Float, 25.74)));
+    EXPECT_ANY_THROW(FloatTwo->sub(StrEmpty));
+    EXPECT_ANY_THROW(FloatTwo->sub(StrEmpty2));
+    EXPECT_ANY_THROW(FloatTwo->sub(StrA));
+    EXPECT_ANY_THROW(FloatTwo->sub(StrA2));
+    EXPECT_ANY_THROW(FloatTwo->sub(StrB));
+    EXPECT_ANY_THROW(FloatTwo->sub(ListEmpty));
+    EXPECT_ANY_THROW(FloatTwo->sub(ListEmpty2));
+    EXPECT_ANY_THROW(FloatTwo2->sub(None));
+    EXPECT_ANY_THROW(FloatTwo2->sub(None2));
+    EXPECT_TRUE(FloatTwo2->sub(False)->strictly_equal(VAR(Float, 2.0)));
+    EXPECT_TRUE(FloatTwo2->sub(False2)->strictly_equal(VAR(Float, 2.0)));
+    EXPECT_TRUE(FloatTwo2->sub(True)->strictly_equal(VAR(Float, 1.0)));
+    EXPECT_TRUE(FloatTwo2->sub(True2)->strictly_equal(VAR(Float, 1.0)));
+    EXPECT_TRUE(FloatTwo2->sub(IntZero)->strictly_equal(VAR(Float, 2.0)));
+    EXPECT_TRUE(FloatTwo2->sub(IntOne)->strictly_equal(VAR(Float, 1.0)));
+    EXPECT_TRUE(FloatTwo2->sub(IntTwo)->strictly_equal(VAR(Float, 0.0)));
+    EXPECT_TRUE(FloatTwo2->sub(IntTwo2)->strictly_equal(VAR(Float, 0.0)));
+    EXPECT_TRUE(FloatTwo2->sub(Int8)->strictly_equal(VAR(Float, -6.0)));
+    EXPECT_TRUE(FloatTwo2->sub(IntMinusOne)->strictly_equal(VAR(Float, 3.0)));
+    EXPECT_TRUE(FloatTwo2->sub(IntMinusOne2)->strictly_equal(VAR(Float, 3.0)));
+    EXPECT_TRUE(FloatTwo2->sub(IntMinus12)->strictly_equal(VAR(Float, 14.0)));
+    EXPECT_TRUE(FloatTwo2->sub(IntMinus73)->strictly_equal(VAR(Float, 75.0)));
+    EXPECT_TRUE(FloatTwo2->sub(FloatMinusOne)->strictly_equal(VAR(Float, 3.0)));
+    EXPECT_TRUE(FloatTwo2->sub(FloatZero)->strictly_equal(VAR(Float, 2.0)));
+    EXPECT_TRUE(FloatTwo2->sub(FloatOne)->strictly_equal(VAR(Float, 1.0)));
+    EXPECT_TRUE(FloatTwo2->sub(FloatTwo)->strictly_equal(VAR(Float, 0.0)));
+    EXPECT_TRUE(FloatTwo2->sub(FloatTwo2)->strictly_equal(VAR(Float, 0.0)));
+    EXPECT_TRUE(FloatTwo2->sub(Float2_5)->strictly_equal(VAR(Float, -0.5)));
+    EXPECT_TRUE(FloatTwo2->sub(Float_23_74)->strictly_equal(VAR(Float, 25.74)));
+    EXPECT_ANY_THROW(FloatTwo2->sub(StrEmpty));
+    EXPECT_ANY_THROW(FloatTwo2->sub(StrEmpty2));
+    EXPECT_ANY_THROW(FloatTwo2->sub(StrA));
+    EXPECT_ANY_THROW(FloatTwo2->sub(StrA2));
+    EXPECT_ANY_THROW(FloatTwo2->sub(StrB));
+    EXPECT_ANY_THROW(FloatTwo2->sub(ListEmpty));
+    EXPECT_ANY_THROW(FloatTwo2->sub(ListEmpty2));
+    EXPECT_ANY_THROW(Float2_5->sub(None));
+    EXPECT_ANY_THROW(Float2_5->sub(None2));
+    EXPECT_TRUE(Float2_5->sub(False)->strictly_equal(VAR(Float, 2.5)));
+    EXPECT_TRUE(Float2_5->sub(False2)->strictly_equal(VAR(Float, 2.5)));
+    EXPECT_TRUE(Float2_5->sub(True)->strictly_equal(VAR(Float, 1.5)));
+    EXPECT_TRUE(Float2_5->sub(True2)->strictly_equal(VAR(Float, 1.5)));
+    EXPECT_TRUE(Float2_5->sub(IntZero)->strictly_equal(VAR(Float, 2.5)));
+    EXPECT_TRUE(Float2_5->sub(IntOne)->strictly_equal(VAR(Float, 1.5)));
+    EXPECT_TRUE(Float2_5->sub(IntTwo)->strictly_equal(VAR(Float, 0.5)));
+    EXPECT_TRUE(Float2_5->sub(IntTwo2)->strictly_equal(VAR(Float, 0.5)));
+    EXPECT_TRUE(Float2_5->sub(Int8)->strictly_equal(VAR(Float, -5.5)));
+    EXPECT_TRUE(Float2_5->sub(IntMinusOne)->strictly_equal(VAR(Float, 3.5)));
+    EXPECT_TRUE(Float2_5->sub(IntMinusOne2)->strictly_equal(VAR(Float, 3.5)));
+    EXPECT_TRUE(Float2_5->sub(IntMinus12)->strictly_equal(VAR(Float, 14.5)));
+    EXPECT_TRUE(Float2_5->sub(IntMinus73)->strictly_equal(VAR(Float, 75.5)));
+    EXPECT_TRUE(Float2_5->sub(FloatMinusOne)->strictly_equal(VAR(Float, 3.5)));
+    EXPECT_TRUE(Float2_5->sub(FloatZero)->strictly_equal(VAR(Float, 2.5)));
+    EXPECT_TRUE(Float2_5->sub(FloatOne)->strictly_equal(VAR(Float, 1.5)));
+    EXPECT_TRUE(Float2_5->sub(FloatTwo)->strictly_equal(VAR(Float, 0.5)));
+    EXPECT_TRUE(Float2_5->sub(FloatTwo2)->strictly_equal(VAR(Float, 0.5)));
+    EXPECT_TRUE(Float2_5->sub(Float2_5)->strictly_equal(VAR(Float, 0.0)));
+    EXPECT_TRUE(Float2_5->sub(Float_23_74)->strictly_equal(VAR(Float, 26.24)));
+    EXPECT_ANY_THROW(Float2_5->sub(StrEmpty));
+    EXPECT_ANY_THROW(Float2_5->sub(StrEmpty2));
+    EXPECT_ANY_THROW(Float2_5->sub(StrA));
+    EXPECT_ANY_THROW(Float2_5->sub(StrA2));
+    EXPECT_ANY_THROW(Float2_5->sub(StrB));
+    EXPECT_ANY_THROW(Float2_5->sub(ListEmpty));
+    EXPECT_ANY_THROW(Float2_5->sub(ListEmpty2));
+    EXPECT_ANY_THROW(Float_23_74->sub(None));
+    EXPECT_ANY_THROW(Float_23_74->sub(None2));
+    EXPECT_TRUE(Float_23_74->sub(False)->strictly_equal(VAR(Float, -23.74)));
+    EXPECT_TRUE(Float_23_74->sub(False2)->strictly_equal(VAR(Float, -23.74)));
+    EXPECT_TRUE(Float_23_74->sub(True)->strictly_equal(VAR(Float, -24.74)));
+    EXPECT_TRUE(Float_23_74->sub(True2)->strictly_equal(VAR(Float, -24.74)));
+    EXPECT_TRUE(Float_23_74->sub(IntZero)->strictly_equal(VAR(Float, -23.74)));
+    EXPECT_TRUE(Float_23_74->sub(IntOne)->strictly_equal(VAR(Float, -24.74)));
+    EXPECT_TRUE(Float_23_74->sub(IntTwo)->strictly_equal(VAR(Float, -25.74)));
+    EXPECT_TRUE(Float_23_74->sub(IntTwo2)->strictly_equal(VAR(Float, -25.74)));
+    EXPECT_TRUE(Float_23_74->sub(Int8)->strictly_equal(VAR(Float, -31.74)));
+    EXPECT_TRUE(Float_23_74->sub(IntMinusOne)->strictly_equal(VAR(Float, -22.74)));
+    EXPECT_TRUE(Float_23_74->sub(IntMinusOne2)->strictly_equal(VAR(Float, -22.74)));
+    EXPECT_TRUE(Float_23_74->sub(IntMinus12)->strictly_equal(VAR(Float, -11.739999999999998)));
+    EXPECT_TRUE(Float_23_74->sub(IntMinus73)->strictly_equal(VAR(Float, 49.260000000000005)));
+    EXPECT_TRUE(Float_23_74->sub(FloatMinusOne)->strictly_equal(VAR(Float, -22.74)));
+    EXPECT_TRUE(Float_23_74->sub(FloatZero)->strictly_equal(VAR(Float, -23.74)));
+    EXPECT_TRUE(Float_23_74->sub(FloatOne)->strictly_equal(VAR(Float, -24.74)));
+    EXPECT_TRUE(Float_23_74->sub(FloatTwo)->strictly_equal(VAR(Float, -25.74)));
+    EXPECT_TRUE(Float_23_74->sub(FloatTwo2)->strictly_equal(VAR(Float, -25.74)));
+    EXPECT_TRUE(Float_23_74->sub(Float2_5)->strictly_equal(VAR(Float, -26.24)));
+    EXPECT_TRUE(Float_23_74->sub(Float_23_74)->strictly_equal(VAR(Float, 0.0)));
+    EXPECT_ANY_THROW(Float_23_74->sub(StrEmpty));
+    EXPECT_ANY_THROW(Float_23_74->sub(StrEmpty2));
+    EXPECT_ANY_THROW(Float_23_74->sub(StrA));
+    EXPECT_ANY_THROW(Float_23_74->sub(StrA2));
+    EXPECT_ANY_THROW(Float_23_74->sub(StrB));
+    EXPECT_ANY_THROW(Float_23_74->sub(ListEmpty));
+    EXPECT_ANY_THROW(Float_23_74->sub(ListEmpty2));
+    EXPECT_ANY_THROW(StrEmpty->sub(None));
+    EXPECT_ANY_THROW(StrEmpty->sub(None2));
+    EXPECT_ANY_THROW(StrEmpty->sub(False));
+    EXPECT_ANY_THROW(StrEmpty->sub(False2));
+    EXPECT_ANY_THROW(StrEmpty->sub(True));
+    EXPECT_ANY_THROW(StrEmpty->sub(True2));
+    EXPECT_ANY_THROW(StrEmpty->sub(IntZero));
+    EXPECT_ANY_THROW(StrEmpty->sub(IntOne));
+    EXPECT_ANY_THROW(StrEmpty->sub(IntTwo));
+    EXPECT_ANY_THROW(StrEmpty->sub(IntTwo2));
+    EXPECT_ANY_THROW(StrEmpty->sub(Int8));
+    EXPECT_ANY_THROW(StrEmpty->sub(IntMinusOne));
+    EXPECT_ANY_THROW(StrEmpty->sub(IntMinusOne2));
+    EXPECT_ANY_THROW(StrEmpty->sub(IntMinus12));
+    EXPECT_ANY_THROW(StrEmpty->sub(IntMinus73));
+    EXPECT_ANY_THROW(StrEmpty->sub(FloatMinusOne));
+    EXPECT_ANY_THROW(StrEmpty->sub(FloatZero));
+    EXPECT_ANY_THROW(StrEmpty->sub(FloatOne));
+    EXPECT_ANY_THROW(StrEmpty->sub(FloatTwo));
+    EXPECT_ANY_THROW(StrEmpty->sub(FloatTwo2));
+    EXPECT_ANY_THROW(StrEmpty->sub(Float2_5));
+    EXPECT_ANY_THROW(StrEmpty->sub(Float_23_74));
+    EXPECT_ANY_THROW(StrEmpty->sub(StrEmpty));
+    EXPECT_ANY_THROW(StrEmpty->sub(StrEmpty2));
+    EXPECT_ANY_THROW(StrEmpty->sub(StrA));
+    EXPECT_ANY_THROW(StrEmpty->sub(StrA2));
+    EXPECT_ANY_THROW(StrEmpty->sub(StrB));
+    EXPECT_ANY_THROW(StrEmpty->sub(ListEmpty));
+    EXPECT_ANY_THROW(StrEmpty->sub(ListEmpty2));
+    EXPECT_ANY_THROW(StrEmpty2->sub(None));
+    EXPECT_ANY_THROW(StrEmpty2->sub(None2));
+    EXPECT_ANY_THROW(StrEmpty2->sub(False));
+    EXPECT_ANY_THROW(StrEmpty2->sub(False2));
+    EXPECT_ANY_THROW(StrEmpty2->sub(True));
+    EXPECT_ANY_THROW(StrEmpty2->sub(True2));
+    EXPECT_ANY_THROW(StrEmpty2->sub(IntZero));
+    EXPECT_ANY_THROW(StrEmpty2->sub(IntOne));
+    EXPECT_ANY_THROW(StrEmpty2->sub(IntTwo));
+    EXPECT_ANY_THROW(StrEmpty2->sub(IntTwo2));
+    EXPECT_ANY_THROW(StrEmpty2->sub(Int8));
+    EXPECT_ANY_THROW(StrEmpty2->sub(IntMinusOne));
+    EXPECT_ANY_THROW(StrEmpty2->sub(IntMinusOne2));
+    EXPECT_ANY_THROW(StrEmpty2->sub(IntMinus12));
+    EXPECT_ANY_THROW(StrEmpty2->sub(IntMinus73));
+    EXPECT_ANY_THROW(StrEmpty2->sub(FloatMinusOne));
+    EXPECT_ANY_THROW(StrEmpty2->sub(FloatZero));
+    EXPECT_ANY_THROW(StrEmpty2->sub(FloatOne));
+    EXPECT_ANY_THROW(StrEmpty2->sub(FloatTwo));
+    EXPECT_ANY_THROW(StrEmpty2->sub(FloatTwo2));
+    EXPECT_ANY_THROW(StrEmpty2->sub(Float2_5));
+    EXPECT_ANY_THROW(StrEmpty2->sub(Float_23_74));
+    EXPECT_ANY_THROW(StrEmpty2->sub(StrEmpty));
+    EXPECT_ANY_THROW(StrEmpty2->sub(StrEmpty2));
+    EXPECT_ANY_THROW(StrEmpty2->sub(StrA));
+    EXPECT_ANY_THROW(StrEmpty2->sub(StrA2));
+    EXPECT_ANY_THROW(StrEmpty2->sub(StrB));
+    EXPECT_ANY_THROW(StrEmpty2->sub(ListEmpty));
+    EXPECT_ANY_THROW(StrEmpty2->sub(ListEmpty2));
+    EXPECT_ANY_THROW(StrA->sub(None));
+    EXPECT_ANY_THROW(StrA->sub(None2));
+    EXPECT_ANY_THROW(StrA->sub(False));
+    EXPECT_ANY_THROW(StrA->sub(False2));
+    EXPECT_ANY_THROW(StrA->sub(True));
+    EXPECT_ANY_THROW(StrA->sub(True2));
+    EXPECT_ANY_THROW(StrA->sub(IntZero));
+    EXPECT_ANY_THROW(StrA->sub(IntOne));
+    EXPECT_ANY_THROW(StrA->sub(IntTwo));
+    EXPECT_ANY_THROW(StrA->sub(IntTwo2));
+    EXPECT_ANY_THROW(StrA->sub(Int8));
+    EXPECT_ANY_THROW(StrA->sub(IntMinusOne));
+    EXPECT_ANY_THROW(StrA->sub(IntMinusOne2));
+    EXPECT_ANY_THROW(StrA->sub(IntMinus12));
+    EXPECT_ANY_THROW(StrA->sub(IntMinus73));
+    EXPECT_ANY_THROW(StrA->sub(FloatMinusOne));
+    EXPECT_ANY_THROW(StrA->sub(FloatZero));
+    EXPECT_ANY_THROW(StrA->sub(FloatOne));
+    EXPECT_ANY_THROW(StrA->sub(FloatTwo));
+    EXPECT_ANY_THROW(StrA->sub(FloatTwo2));
+    EXPECT_ANY_THROW(StrA->sub(Float2_5));
+    EXPECT_ANY_THROW(StrA->sub(Float_23_74));
+    EXPECT_ANY_THROW(StrA->sub(StrEmpty));
+    EXPECT_ANY_THROW(StrA->sub(StrEmpty2));
+    EXPECT_ANY_THROW(StrA->sub(StrA));
+    EXPECT_ANY_THROW(StrA->sub(StrA2));
+    EXPECT_ANY_THROW(StrA->sub(StrB));
+    EXPECT_ANY_THROW(StrA->sub(ListEmpty));
+    EXPECT_ANY_THROW(StrA->sub(ListEmpty2));
+    EXPECT_ANY_THROW(StrA2->sub(None));
+    EXPECT_ANY_THROW(StrA2->sub(None2));
+    EXPECT_ANY_THROW(StrA2->sub(False));
+    EXPECT_ANY_THROW(StrA2->sub(False2));
+    EXPECT_ANY_THROW(StrA2->sub(True));
+    EXPECT_ANY_THROW(StrA2->sub(True2));
+    EXPECT_ANY_THROW(StrA2->sub(IntZero));
+    EXPECT_ANY_THROW(StrA2->sub(IntOne));
+    EXPECT_ANY_THROW(StrA2->sub(IntTwo));
+    EXPECT_ANY_THROW(StrA2->sub(IntTwo2));
+    EXPECT_ANY_THROW(StrA2->sub(Int8));
+    EXPECT_ANY_THROW(StrA2->sub(IntMinusOne));
+    EXPECT_ANY_THROW(StrA2->sub(IntMinusOne2));
+    EXPECT_ANY_THROW(StrA2->sub(IntMinus12));
+    EXPECT_ANY_THROW(StrA2->sub(IntMinus73));
+    EXPECT_ANY_THROW(StrA2->sub(FloatMinusOne));
+    EXPECT_ANY_THROW(StrA2->sub(FloatZero));
+    EXPECT_ANY_THROW(StrA2->sub(FloatOne));
+    EXPECT_ANY_THROW(StrA2->sub(FloatTwo));
+    EXPECT_ANY_THROW(StrA2->sub(FloatTwo2));
+    EXPECT_ANY_THROW(StrA2->sub(Float2_5));
+    EXPECT_ANY_THROW(StrA2->sub(Float_23_74));
+    EXPECT_ANY_THROW(StrA2->sub(StrEmpty));
+    EXPECT_ANY_THROW(StrA2->sub(StrEmpty2));
+    EXPECT_ANY_THROW(StrA2->sub(StrA));
+    EXPECT_ANY_THROW(StrA2->sub(StrA2));
+    EXPECT_ANY_THROW(StrA2->sub(StrB));
+    EXPECT_ANY_THROW(StrA2->sub(ListEmpty));
+    EXPECT_ANY_THROW(StrA2->sub(ListEmpty2));
+    EXPECT_ANY_THROW(StrB->sub(None));
+    EXPECT_ANY_THROW(StrB->sub(None2));
+    EXPECT_ANY_THROW(StrB->sub(False));
+    EXPECT_ANY_THROW(StrB->sub(False2));
+    EXPECT_ANY_THROW(StrB->sub(True));
+    EXPECT_ANY_THROW(StrB->sub(True2));
+    EXPECT_ANY_THROW(StrB->sub(IntZero));
+    EXPECT_ANY_THROW(StrB->sub(IntOne));
+    EXPECT_ANY_THROW(StrB->sub(IntTwo));
+    EXPECT_ANY_THROW(StrB->sub(IntTwo2));
+    EXPECT_ANY_THROW(StrB->sub(Int8));
+    EXPECT_ANY_THROW(StrB->sub(IntMinusOne));
+    EXPECT_ANY_THROW(StrB->sub(IntMinusOne2));
+    EXPECT_ANY_THROW(StrB->sub(IntMinus12));
+    EXPECT_ANY_THROW(StrB->sub(IntMinus73));
+    EXPECT_ANY_THROW(StrB->sub(FloatMinusOne));
+    EXPECT_ANY_THROW(StrB->sub(FloatZero));
+    EXPECT_ANY_THROW(StrB->sub(FloatOne));
+    EXPECT_ANY_THROW(StrB->sub(FloatTwo));
+    EXPECT_ANY_THROW(StrB->sub(FloatTwo2));
+    EXPECT_ANY_THROW(StrB->sub(Float2_5));
+    EXPECT_ANY_THROW(StrB->sub(Float_23_74));
+    EXPECT_ANY_THROW(StrB->sub(StrEmpty));
+    EXPECT_ANY_THROW(StrB->sub(StrEmpty2));
+    EXPECT_ANY_THROW(StrB->sub(StrA));
+    EXPECT_ANY_THROW(StrB->sub(StrA2));
+    EXPECT_ANY_THROW(StrB->sub(StrB));
+    EXPECT_ANY_THROW(StrB->sub(ListEmpty));
+    EXPECT_ANY_THROW(StrB->sub(ListEmpty2));
+    EXPECT_ANY_THROW(ListEmpty->sub(None));
+    EXPECT_ANY_THROW(ListEmpty->sub(None2));
+    EXPECT_ANY_THROW(ListEmpty->sub(False));
+    EXPECT_ANY_THROW(ListEmpty->sub(False2));
+    EXPECT_ANY_THROW(ListEmpty->sub(True));
+    EXPECT_ANY_THROW(ListEmpty->sub(True2));
+    EXPECT_ANY_THROW(ListEmpty->sub(IntZero));
+    EXPECT_ANY_THROW(ListEmpty->sub(IntOne));
+    EXPECT_ANY_THROW(ListEmpty->sub(IntTwo));
+    EXPECT_ANY_THROW(ListEmpty->sub(IntTwo2));
+    EXPECT_ANY_THROW(ListEmpty->sub(Int8));
+    EXPECT_ANY_THROW(ListEmpty->sub(IntMinusOne));
+    EXPECT_ANY_THROW(ListEmpty->sub(IntMinusOne2));
+    EXPECT_ANY_THROW(ListEmpty->sub(IntMinus12));
+    EXPECT_ANY_THROW(ListEmpty->sub(IntMinus73));
+    EXPECT_ANY_THROW(ListEmpty->sub(FloatMinusOne));
+    EXPECT_ANY_THROW(ListEmpty->sub(FloatZero));
+    EXPECT_ANY_THROW(ListEmpty->sub(FloatOne));
+    EXPECT_ANY_THROW(ListEmpty->sub(FloatTwo));
+    EXPECT_ANY_THROW(ListEmpty->sub(FloatTwo2));
+    EXPECT_ANY_THROW(ListEmpty->sub(Float2_5));
+    EXPECT_ANY_THROW(ListEmpty->sub(Float_23_74));
+    EXPECT_ANY_THROW(ListEmpty->sub(StrEmpty));
+    EXPECT_ANY_THROW(ListEmpty->sub(StrEmpty2));
+    EXPECT_ANY_THROW(ListEmpty->sub(StrA));
+    EXPECT_ANY_THROW(ListEmpty->sub(StrA2));
+    EXPECT_ANY_THROW(ListEmpty->sub(StrB));
+    EXPECT_ANY_THROW(ListEmpty->sub(ListEmpty));
+    EXPECT_ANY_THROW(ListEmpty->sub(ListEmpty2));
+    EXPECT_ANY_THROW(ListEmpty2->sub(None));
+    EXPECT_ANY_THROW(ListEmpty2->sub(None2));
+    EXPECT_ANY_THROW(ListEmpty2->sub(False));
+    EXPECT_ANY_THROW(ListEmpty2->sub(False2));
+    EXPECT_ANY_THROW(ListEmpty2->sub(True));
+    EXPECT_ANY_THROW(ListEmpty2->sub(True2));
+    EXPECT_ANY_THROW(ListEmpty2->sub(IntZero));
+    EXPECT_ANY_THROW(ListEmpty2->sub(IntOne));
+    EXPECT_ANY_THROW(ListEmpty2->sub(IntTwo));
+    EXPECT_ANY_THROW(ListEmpty2->sub(IntTwo2));
+    EXPECT_ANY_THROW(ListEmpty2->sub(Int8));
+    EXPECT_ANY_THROW(ListEmpty2->sub(IntMinusOne));
+    EXPECT_ANY_THROW(ListEmpty2->sub(IntMinusOne2));
+    EXPECT_ANY_THROW(ListEmpty2->sub(IntMinus12));
+    EXPECT_ANY_THROW(ListEmpty2->sub(IntMinus73));
+    EXPECT_ANY_THROW(ListEmpty2->sub(FloatMinusOne));
+    EXPECT_ANY_THROW(ListEmpty2->sub(FloatZero));
+    EXPECT_ANY_THROW(ListEmpty2->sub(FloatOne));
+    EXPECT_ANY_THROW(ListEmpty2->sub(FloatTwo));
+    EXPECT_ANY_THROW(ListEmpty2->sub(FloatTwo2));
+    EXPECT_ANY_THROW(ListEmpty2->sub(Float2_5));
+    EXPECT_ANY_THROW(ListEmpty2->sub(Float_23_74));
+    EXPECT_ANY_THROW(ListEmpty2->sub(StrEmpty));
+    EXPECT_ANY_THROW(ListEmpty2->sub(StrEmpty2));
+    EXPECT_ANY_THROW(ListEmpty2->sub(StrA));
+    EXPECT_ANY_THROW(ListEmpty2->sub(StrA2));
+    EXPECT_ANY_THROW(ListEmpty2->sub(StrB));
+    EXPECT_ANY_THROW(ListEmpty2->sub(ListEmpty));
+    EXPECT_ANY_THROW(ListEmpty2->sub(ListEmpty2));
+}
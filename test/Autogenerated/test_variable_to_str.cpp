@@ -0,0 +1,150 @@
+
+#include "variable/Variable.h"
+
+#include "Test.h"
+
+#define VAR(TYPE, VALUE) \
+    std::static_pointer_cast<GenericVariable>(std::make_shared<TYPE ## Variable>(VALUE))
+
+enum class OpReturningVar {
+    add,
+    sub,
+    mul,
+    div,
+    int_div,
+    pow,
+    mod,
+};
+
+enum class AssertResult {
+    PASS,
+    FAIL,
+    EXCEPTION,
+};
+
+static std::ostream& operator<< (std::ostream& os, AssertResult res) {
+    switch (res) {
+    case AssertResult::PASS:       os << "PASS";      break;
+    case AssertResult::FAIL:       os << "FAIL";      break;
+    case AssertResult::EXCEPTION:  os << "EXCEPTION"; break;
+    default:                       os << "???";
+    }
+    return os;
+}
+
+static Variable doOpReturningVar(Variable arg1, Variable arg2, OpReturningVar op) {
+    switch(op) {
+    case OpReturningVar::add: return arg1->add(arg2);
+    case OpReturningVar::sub: return arg1->sub(arg2);
+    case OpReturningVar::mul: return arg1->mul(arg2);
+    case OpReturningVar::div: return arg1->div(arg2);
+    case OpReturningVar::int_div: return arg1->int_div(arg2);
+    case OpReturningVar::mod: return arg1->mod(arg2);
+    case OpReturningVar::pow: return arg1->pow(arg2);
+    default: throw std::runtime_error("Bad op");
+    }
+}
+
+static void doOpReturningVarAndCompareResult(Variable arg1, Variable arg2, OpReturningVar op, Variable expected_res, AssertResult a_res, const char *descr) {
+    try {
+        auto res_var = doOpReturningVar(arg1, arg2, op);
+        auto assertion_result = res_var->strictly_equal(expected_res) ? AssertResult::PASS : AssertResult::FAIL;
+        if (assertion_result != a_res) {
+            std::cerr << descr << " returned " << assertion_result << " instead of " << a_res << "\n";
+        }
+    }
+    catch(...) {
+        if (a_res != AssertResult::EXCEPTION) {
+            std::cerr << descr << " returned EXCEPTION instead of " << a_res << "\n";
+        }
+    }
+}
+
+enum class OpReturningBool {
+    equal,
+    less,
+};
+
+static bool doOpReturningBool(Variable arg1, Variable arg2, OpReturningBool op) {
+    switch(op) {
+    case OpReturningBool::equal: return arg1->equal(arg2);
+    case OpReturningBool::less: return arg1->less(arg2);
+    default: throw std::runtime_error("Bad op");
+    }
+}
+
+static void doOpReturningBoolAndCompareResult(Variable arg1, Variable arg2, OpReturningBool op, bool expected_res, AssertResult a_res, const char *descr) {
+    try {
+        auto assertion_result = doOpReturningBool(arg1, arg2, op) ? AssertResult::PASS : AssertResult::FAIL;
+        if (assertion_result != a_res) {
+            std::cerr << descr << " returned " << assertion_result << " instead of " << a_res << "\n";
+        }
+    }
+    catch(...) {
+        if (a_res != AssertResult::EXCEPTION) {
+            std::cerr << descr << " returned EXCEPTION instead of " << a_res << "\n";
+        }
+    }
+}
+
+static auto None = std::static_pointer_cast<GenericVariable>(std::make_shared<NoneVariable>());
+static auto None2 = std::static_pointer_cast<GenericVariable>(std::make_shared<NoneVariable>());
+static auto False = VAR(Bool, false);
+static auto False2 = VAR(Bool, false);
+static auto True = VAR(Bool, true);
+static auto True2 = VAR(Bool, true);
+static auto IntZero = VAR(Int, 0);
+static auto IntOne = VAR(Int, 1);
+static auto IntTwo = VAR(Int, 2);
+static auto IntTwo2 = VAR(Int, 2);
+static auto Int8 = VAR(Int, 8);
+static auto IntMinusOne = VAR(Int, -1);
+static auto IntMinusOne2 = VAR(Int, -1);
+static auto IntMinus12 = VAR(Int, -12);
+static auto IntMinus73 = VAR(Int, -73);
+static auto FloatMinusOne = VAR(Float, -1);
+static auto FloatZero = VAR(Float, 0);
+static auto FloatOne = VAR(Float, 1);
+static auto FloatTwo = VAR(Float, 2);
+static auto FloatTwo2 = VAR(Float, 2);
+static auto Float2_5 = VAR(Float, 2.5);
+static auto Float_23_74 = VAR(Float, -23.74);
+static auto StrEmpty = VAR(String, "");
+static auto StrEmpty2 = VAR(String, "");
+static auto StrA = VAR(String, "some text");
+static auto StrA2 = VAR(String, "some text");
+static auto StrB = VAR(String, "other text");
+static auto ListEmpty = VAR(List, ListType());
+static auto ListEmpty2 = VAR(List, ListType());
+
+void test_variable_to_str () {
+    MY_ASSERT_EQUAL(None->to_str(), "None");
+    MY_ASSERT_EQUAL(None2->to_str(), "None");
+    MY_ASSERT_EQUAL(False->to_str(), "False");
+    MY_ASSERT_EQUAL(False2->to_str(), "False");
+    MY_ASSERT_EQUAL(True->to_str(), "True");
+    MY_ASSERT_EQUAL(True2->to_str(), "True");
+    MY_ASSERT_EQUAL(IntZero->to_str(), "0");
+    MY_ASSERT_EQUAL(IntOne->to_str(), "1");
+    MY_ASSERT_EQUAL(IntTwo->to_str(), "2");
+    MY_ASSERT_EQUAL(IntTwo2->to_str(), "2");
+    MY_ASSERT_EQUAL(Int8->to_str(), "8");
+    MY_ASSERT_EQUAL(IntMinusOne->to_str(), "-1");
+    MY_ASSERT_EQUAL(IntMinusOne2->to_str(), "-1");
+    MY_ASSERT_EQUAL(IntMinus12->to_str(), "-12");
+    MY_ASSERT_EQUAL(IntMinus73->to_str(), "-73");
+    MY_ASSERT_EQUAL(FloatMinusOne->to_str(), "-1.0");
+    MY_ASSERT_EQUAL(FloatZero->to_str(), "0.0");
+    MY_ASSERT_EQUAL(FloatOne->to_str(), "1.0");
+    MY_ASSERT_EQUAL(FloatTwo->to_str(), "2.0");
+    MY_ASSERT_EQUAL(FloatTwo2->to_str(), "2.0");
+    MY_ASSERT_EQUAL(Float2_5->to_str(), "2.5");
+    MY_ASSERT_EQUAL(Float_23_74->to_str(), "-23.74");
+    MY_ASSERT_EQUAL(StrEmpty->to_str(), "");
+    MY_ASSERT_EQUAL(StrEmpty2->to_str(), "");
+    MY_ASSERT_EQUAL(StrA->to_str(), "some text");
+    MY_ASSERT_EQUAL(StrA2->to_str(), "some text");
+    MY_ASSERT_EQUAL(StrB->to_str(), "other text");
+    MY_ASSERT_EQUAL(ListEmpty->to_str(), "[]");
+    MY_ASSERT_EQUAL(ListEmpty2->to_str(), "[]");
+}
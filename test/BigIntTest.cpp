@@ -0,0 +1,132 @@
+#include "variable/BigInt.h"
+#include "variable/Variable.h"
+
+#include <gtest/gtest.h>
+
+#include <random>
+
+using namespace MiniPython;
+
+class BigIntTest: public testing::Test {
+};
+
+static std::string random_digits(std::mt19937 &generator, size_t count) {
+    std::string digits(1, '1' + generator() % 9);
+    while (digits.size() < count) {
+        digits += '0' + generator() % 10;
+    }
+    return digits;
+}
+
+TEST_F(BigIntTest, int64_limits) {
+    EXPECT_TRUE(BigInt(INT64_MAX).fits_int64());
+    EXPECT_TRUE(BigInt(INT64_MIN).fits_int64());
+    EXPECT_EQ(BigInt(INT64_MIN).to_int64(), INT64_MIN);
+    EXPECT_FALSE((BigInt(INT64_MAX) + 1).fits_int64());
+    EXPECT_FALSE((BigInt(INT64_MIN) - 1).fits_int64());
+    EXPECT_EQ((BigInt(INT64_MAX) + 1).to_string(), "9223372036854775808");
+    EXPECT_EQ((BigInt(INT64_MIN) - 1).to_string(), "-9223372036854775809");
+}
+
+TEST_F(BigIntTest, string_round_trip) {
+    std::mt19937 generator(1);
+    // Crosses the size where conversions switch to splitting in halves
+    for (size_t digits: {1, 9, 10, 100, 288, 289, 1000, 5000, 20000}) {
+        auto str = random_digits(generator, digits);
+        EXPECT_EQ(BigInt::from_string(str).to_string(), str);
+        EXPECT_EQ(BigInt::from_string("-" + str).to_string(), "-" + str);
+    }
+    EXPECT_EQ(BigInt::from_string("1" + std::string(3000, '0')).to_string(), "1" + std::string(3000, '0'));
+    EXPECT_EQ(BigInt::from_string("ff", 16).to_string(), "255");
+    EXPECT_EQ(BigInt::from_string("1_000_000").to_string(), "1000000");
+}
+
+TEST_F(BigIntTest, power_of_two_bases) {
+    auto value = BigInt::pow(2, 70);
+    EXPECT_EQ(value.to_string(16), "400000000000000000");
+    EXPECT_EQ(value.to_string(8), "2" + std::string(23, '0'));
+    EXPECT_EQ(value.to_string(2), "1" + std::string(70, '0'));
+    EXPECT_EQ((-value - 1).to_string(16), "-400000000000000001");
+    EXPECT_EQ(BigInt(0).to_string(2), "0");
+
+    // Octal digits straddle the limbs
+    std::mt19937 generator(2);
+    for (size_t digits: {1, 10, 11, 33, 100, 1000}) {
+        for (int base: {2, 8, 16}) {
+            std::uniform_int_distribution<int> digit(0, base - 1);
+            std::string str = "1";
+            for (size_t i = 1; i < digits; ++i) {
+                str += "0123456789abcdef"[digit(generator)];
+            }
+            EXPECT_EQ(BigInt::from_string(str, base).to_string(base), str);
+        }
+    }
+}
+
+TEST_F(BigIntTest, multiplication_and_division) {
+    std::mt19937 generator(2);
+    // Sizes for schoolbook, Karatsuba, Toom-3 and Newton division
+    for (size_t digits: {5, 50, 400, 1000, 3000, 10000}) {
+        auto a = BigInt::from_string(random_digits(generator, digits));
+        auto b = BigInt::from_string(random_digits(generator, digits / 2 + 1));
+        auto c = BigInt::from_string(random_digits(generator, digits / 3 + 1));
+
+        // (a + b) * c == a * c + b * c
+        EXPECT_EQ((a + b) * c, a * c + b * c);
+
+        BigInt quotient, remainder;
+        BigInt::floor_divmod(a * b + c, b, quotient, remainder);
+        if (c < b) {
+            EXPECT_EQ(quotient, a);
+            EXPECT_EQ(remainder, c);
+        }
+        EXPECT_EQ(quotient * b + remainder, a * b + c);
+        EXPECT_TRUE(remainder < b);
+    }
+}
+
+TEST_F(BigIntTest, newton_division_divisors) {
+    // Divisors with all limbs full, with a single high limb and with a large
+    // size: the reciprocal recurses down several halvings of these
+    auto two_32 = BigInt::pow(2, 32);
+    std::vector<BigInt> divisors = {
+        BigInt::pow(two_32, 300) - 1,
+        BigInt::pow(two_32, 299) + 1,
+        BigInt::pow(10, 20000) + 12345,
+    };
+    for (const auto &d: divisors) {
+        for (const auto &a: {d * d - 1, d * d * 3 + d - 1, d * BigInt::pow(7, 3000)}) {
+            BigInt quotient, remainder;
+            BigInt::floor_divmod(a, d, quotient, remainder);
+            EXPECT_EQ(quotient * d + remainder, a);
+            EXPECT_TRUE(remainder < d);
+            EXPECT_FALSE(remainder < 0);
+        }
+    }
+}
+
+TEST_F(BigIntTest, floor_division_signs) {
+    BigInt quotient, remainder;
+    auto a = BigInt::from_string("100000000000000000000007");
+    auto b = BigInt::from_string("10000000000000000000000");
+
+    BigInt::floor_divmod(-a, b, quotient, remainder);
+    EXPECT_EQ(quotient.to_string(), "-11");
+    EXPECT_EQ(remainder.to_string(), "9999999999999999999993");
+
+    BigInt::floor_divmod(a, -b, quotient, remainder);
+    EXPECT_EQ(quotient.to_string(), "-11");
+    EXPECT_EQ(remainder.to_string(), "-9999999999999999999993");
+
+    BigInt::floor_divmod(-a, -b, quotient, remainder);
+    EXPECT_EQ(quotient.to_string(), "10");
+    EXPECT_EQ(remainder.to_string(), "-7");
+}
+
+TEST_F(BigIntTest, sequence_repetition) {
+    // Only the low 64 bits of 2**64 + 3 would be 3
+    auto big = NEW_INT(BigInt::from_string("18446744073709551619"));
+    EXPECT_THROW(big->mul(NEW_STRING("ab")), std::runtime_error);
+    EXPECT_THROW(big->mul(std::make_shared<ListVariable>()), std::runtime_error);
+    EXPECT_EQ(NEW_INT(3)->mul(NEW_STRING("ab"))->to_str(), "ababab");
+}
@@ -0,0 +1,90 @@
+#include "src/Checksums.h"
+#include "test/TestUtils.h"
+
+#include <gtest/gtest.h>
+
+#include <string>
+
+using namespace MiniPython;
+
+class ChecksumsTest: public testing::Test {
+};
+
+// Bit at a time, straight from the definitions
+static uint32_t reference_crc32(std::string_view data, uint32_t crc) {
+    crc = ~crc;
+    for (unsigned char ch: data) {
+        crc ^= ch;
+        for (int bit = 0; bit < 8; ++bit) {
+            crc = (crc >> 1) ^ ((crc & 1) ? 0xedb88320 : 0);
+        }
+    }
+    return ~crc;
+}
+
+static uint16_t reference_crc_hqx(std::string_view data, uint16_t crc) {
+    for (unsigned char ch: data) {
+        crc ^= ch << 8;
+        for (int bit = 0; bit < 8; ++bit) {
+            crc = (crc << 1) ^ ((crc & 0x8000) ? 0x1021 : 0);
+        }
+    }
+    return crc;
+}
+
+static uint32_t reference_adler32(std::string_view data, uint32_t adler) {
+    uint32_t a = adler & 0xffff, b = adler >> 16;
+    for (unsigned char ch: data) {
+        a = (a + ch) % 65521;
+        b = (b + a) % 65521;
+    }
+    return (b << 16) | a;
+}
+
+TEST_F(ChecksumsTest, known_values) {
+    EXPECT_EQ(Checksums::crc32("123456789"), 0xcbf43926u);
+    EXPECT_EQ(Checksums::crc32(""), 0u);
+    EXPECT_EQ(Checksums::crc_hqx("123456789", 0), 0x31c3);
+    EXPECT_EQ(Checksums::crc_hqx("123456789", 0xffff), 0x29b1);
+    EXPECT_EQ(Checksums::adler32("Wikipedia"), 0x11e60398u);
+    EXPECT_EQ(Checksums::adler32(""), 1u);
+}
+
+TEST_F(ChecksumsTest, all_lengths) {
+    // Every vector width, the folding loops and the tails, at every alignment
+    std::string data = random_bytes(600);
+    for (size_t offset = 0; offset < 16; ++offset) {
+        for (size_t length = 0; offset + length <= 300; ++length) {
+            std::string_view view = std::string_view(data).substr(offset, length);
+            EXPECT_EQ(Checksums::crc32(view, 0x12345678), reference_crc32(view, 0x12345678)) << offset << " " << length;
+            EXPECT_EQ(Checksums::crc_hqx(view, 0x1234), reference_crc_hqx(view, 0x1234)) << offset << " " << length;
+            EXPECT_EQ(Checksums::adler32(view, 0x00420007), reference_adler32(view, 0x00420007)) << offset << " " << length;
+        }
+    }
+}
+
+TEST_F(ChecksumsTest, long_input) {
+    // Crosses the adler32 reduction interval several times, with sums close to overflowing
+    std::string ones(100000, '\xff');
+    EXPECT_EQ(Checksums::adler32(ones), reference_adler32(ones, 1));
+    EXPECT_EQ(Checksums::adler32(ones, 0xfff0fff0), reference_adler32(ones, 0xfff0fff0));
+
+    std::string data = random_bytes(100003);
+    EXPECT_EQ(Checksums::crc32(data), reference_crc32(data, 0));
+    EXPECT_EQ(Checksums::adler32(data), reference_adler32(data, 1));
+}
+
+TEST_F(ChecksumsTest, chunked) {
+    std::string data = random_bytes(1000);
+    std::string_view view = data;
+    uint32_t crc = 0, adler = 1;
+    uint16_t hqx = 0;
+    for (size_t i = 0; i < data.size(); i += 77) {
+        crc = Checksums::crc32(view.substr(i, 77), crc);
+        hqx = Checksums::crc_hqx(view.substr(i, 77), hqx);
+        adler = Checksums::adler32(view.substr(i, 77), adler);
+    }
+    EXPECT_EQ(crc, Checksums::crc32(data));
+    EXPECT_EQ(hqx, Checksums::crc_hqx(data, 0));
+    EXPECT_EQ(adler, Checksums::adler32(data));
+}
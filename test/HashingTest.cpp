@@ -0,0 +1,161 @@
+#include "src/Hashing.h"
+#include "src/Utils.h"
+
+#include <gtest/gtest.h>
+
+#include <string>
+#include <utility>
+#include <vector>
+
+using namespace MiniPython;
+
+class HashingTest: public testing::Test {
+protected:
+    using Vectors = std::vector<std::pair<size_t, std::string>>;
+
+    static std::string data(size_t size) {
+        std::string result(size, '\0');
+        for (size_t i = 0; i < size; ++i) {
+            result[i] = static_cast<char>(i * 7 % 251);
+        }
+        return result;
+    }
+
+    // Around the padding boundaries, hashed at once and byte by byte
+    static void check(std::unique_ptr<Hashing::Hash> (*constructor)(), const Vectors &vectors) {
+        for (auto &[size, expected]: vectors) {
+            auto input = data(size);
+            auto hash = constructor();
+            hash->update(input);
+            EXPECT_EQ(hex_encode(hash->digest()), expected) << hash->name() << " " << size;
+
+            auto chunked = constructor();
+            for (char ch: input) {
+                chunked->update(std::string_view(&ch, 1));
+            }
+            EXPECT_EQ(hex_encode(chunked->digest()), expected) << chunked->name() << " " << size;
+        }
+    }
+};
+
+TEST_F(HashingTest, md5) {
+    check(Hashing::md5, {
+        {0, "d41d8cd98f00b204e9800998ecf8427e"},
+        {1, "93b885adfe0da089cdf634904fd59f71"},
+        {3, "ed41c1aca5ad5feb033df37822dae4b7"},
+        {55, "a3c81137436036ad8b477da25301a150"},
+        {56, "64c7901679c62fee89dae9fdc90f6cdc"},
+        {63, "ca2a2c51613f550d77bfa700fa71b2f3"},
+        {64, "c1e181645d10867b9810b9ab454f39fd"},
+        {65, "8ce7034cd47c2e5766f920d9f6cd25b2"},
+        {111, "2b60d439cbc769d009545e421fe67d0f"},
+        {112, "f0c433855caf8bb978bab9475116badf"},
+        {127, "5fb11d06c9273fdf705c65afd0a39694"},
+        {128, "3eba58a155f6aa0ef467626f0e78d53b"},
+        {129, "a80321e4a33967fbffb1b55d8a9382a3"},
+        {1000, "4b2f37fc49a134b17c7275fd04a1b7ac"},
+    });
+}
+
+TEST_F(HashingTest, sha1) {
+    check(Hashing::sha1, {
+        {0, "da39a3ee5e6b4b0d3255bfef95601890afd80709"},
+        {1, "5ba93c9db0cff93f52b521d7420e43f6eda2784f"},
+        {3, "75550941124b46eb4161d17ac200c05c4fc03ce7"},
+        {55, "a83f94113f5292bb7ed9d7df07178ad7d931341a"},
+        {56, "372e1b20329e0b2862472089ac00c55505116275"},
+        {63, "6944938dc131b6453b7d9637cfcbad8a3db28104"},
+        {64, "aec4b7f13a2b75ec13bc0c3f13fa55caf97e621d"},
+        {65, "29a20455c2f21fa85c66014ff3b75bfcce5aaba5"},
+        {111, "bc4bd1d43a2f77b0b800569fdcca14d79026f068"},
+        {112, "6493717e791a3f85a4f539a2cd6b35ab29750c8f"},
+        {127, "66ac6c2e5cd910ce898e7bd293ed6851b716b8c1"},
+        {128, "ddde2e96d57b78eda0da1151110a11eaa1d21d7b"},
+        {129, "8101d2f29d6595918892dc4a9792dc43fb08a506"},
+        {1000, "33f233c97a803d84a0db9f3dbc05b63ff2045d92"},
+    });
+}
+
+TEST_F(HashingTest, sha256) {
+    check(Hashing::sha256, {
+        {0, "e3b0c44298fc1c149afbf4c8996fb92427ae41e4649b934ca495991b7852b855"},
+        {1, "6e340b9cffb37a989ca544e6bb780a2c78901d3fb33738768511a30617afa01d"},
+        {3, "b361d0f9a938a2bb4fbdc9c21dc5a859788041b0040919d8a811c1888184f4df"},
+        {55, "8af594de0e003fdee5c8bb088216c824349b4137070f559574f4a4bddd27b714"},
+        {56, "db81bc2bfd43620591df192139062da77d4c376f1888ea3d2190bd07c8d901f9"},
+        {63, "bd535b38bf0d0d1a09d370b7e34b2696cea3767801a45d5611a4aaa6954e8527"},
+        {64, "292be91abe8c0909fe3d26575af5755eee74d23816dc68c3ba41765136967654"},
+        {65, "ba65aedf7884642499a59ae124894611d986cf429e69f569488048af3a99e25a"},
+        {111, "8e2fd1aa2d84835ec4d8c415fdcddff613de1c716daaf658078f10474736e639"},
+        {112, "6636edfe65fc8ecc85cf96ef838fc95086867aef6123859e9b9f20805b247cbc"},
+        {127, "770cba7b80c7615a327db5812ccd3f80895d801b587448fcd0b2c1a10f5c88a3"},
+        {128, "cb5311e1d7aa8e11d6af7081f3ffc3e4efa008c7483a1a791fe170bf37546ba7"},
+        {129, "b9e17b1020711e1a6f25633f677a750b3d54399773eb191acac2cb8c7c8b2541"},
+        {1000, "59425e4412e296fc74736673ce067027f384203f59c0d2c3e6be7b13347b3ffc"},
+    });
+}
+
+static std::unique_ptr<Hashing::Hash> default_blake2b() {
+    return Hashing::blake2b();
+}
+
+TEST_F(HashingTest, blake2b) {
+    check(default_blake2b, {
+        {0, "786a02f742015903c6c6fd852552d272912f4740e15847618a86e217f71f5419"
+              "d25e1031afee585313896444934eb04b903a685b1448b755d56f701afe9be2ce"},
+        {1, "2fa3f686df876995167e7c2e5d74c4c7b6e48f8068fe0e44208344d480f7904c"
+              "36963e44115fe3eb2a3ac8694c28bcb4f5a0f3276f2e79487d8219057a506e4b"},
+        {3, "fed14d4674b95b8f01131200012dea8038f0527549cf3a4b7a9479e3d31cef17"
+              "1de96eca5ba7037ab0c4ab9a409c316da23f4587cc9d37af686edf712ddc73cc"},
+        {55, "c64a085a37cc594df232e249b19f8a3fe60fca54d326201164d6f5ac409a1520"
+              "4a20d8a997663b5c23b65ea074309cd57673ebda80d913e659bcff88bc5b601a"},
+        {56, "e6ee19538f0cf9f6780fe182adc3f689679873c45b4031b529f26877d4e6b240"
+              "f11e254f130cba6e9db5f400624253b8d1658f1d0311e1a9e5cb6170366976f8"},
+        {63, "6672eec62f1ab4cbff898e0864b2d56ea4f1fbd0a0c7700377d391b411f4989d"
+              "ae44c82a36cf72c16553ac5e045de141cb128cc2607bd64070fac5bcc969dd64"},
+        {64, "92f27f12b0e0171f4e6aec16f31f3865397e7dcdee8f72091d52be2e16af7e06"
+              "0b0de35ae33a4f5d98f7ddbb5ecb5979c7e00aab585ed8f9eee371704984d3d6"},
+        {65, "798f4faee1547f633b2b37973e2e1540b808568f22ee463c0a81a32fcfe4e394"
+              "5b6031f325f33055d6f52c8e01d6a8fac9a725a55b6dc93cb3e5142dff843a5b"},
+        {111, "4fc575deb327c821abac87ad24707cb53b6582bb6c8553902248b60c032cdaca"
+              "783e360cda302bcf750838757def3f3ec0e5223a92718896323562811c9f08a1"},
+        {112, "9f60ea99c0da3863be46e02dafc355b7e0b498dc7d5a5a3c229b358cb7b7c041"
+              "75801e68c5f4db6bab1db7ab2205897e33867723a9d201d11fa17145a8465534"},
+        {127, "ec2b4ebd83459a83ba49bdfaea2cf0df796dfa2ecd38c826ea407c6e6f655405"
+              "b42d21eac642d131b866a14fce46de8adbf0341a35d79c3f0a54a54095330291"},
+        {128, "3c2d4866bfb0691d821b7c8ff0bca5550132168058d777cddf8674b896aa2c34"
+              "a98f340aa52cab29464bdeb22e0a0c889ccc35456e1ea350ea157ff5b5ebc27d"},
+        {129, "2298fdc7acc41f58a2833279c6e4439aef2fe12c161891cb6568163732d079f1"
+              "090e994da16838874ba0adc784091deeda825bb8dc9a99b1c711579700d4c3bf"},
+        {1000, "b611add97bcaee5ccef087e5afe33b18a680ada1bc8fbd70da5664e54dec31b1"
+              "18fbca4ea5ab704f61802c952d74679bdd9b210b77740955c872c23504c9c5f9"},
+    });
+}
+
+TEST_F(HashingTest, blake2b_parameters) {
+    auto hash = Hashing::blake2b(16, "secret");
+    hash->update("abc");
+    EXPECT_EQ(hash->digest_size(), 16u);
+    EXPECT_EQ(hex_encode(hash->digest()), "b728f0c8cb10089e9c7b3549c0cdea97");
+
+    auto long_key = Hashing::blake2b(64, std::string(64, 'k'));
+    EXPECT_EQ(hex_encode(long_key->digest()), "5caefa9818315414d0d763300fc08c4c7c434a259b75c5ed814e97c313ab1b15"
+                                               "7276e5456967794c810cdbd0b5c5266503067a4a499d29615693e063b1b6afb9");
+}
+
+TEST_F(HashingTest, digest_keeps_state) {
+    auto hash = Hashing::sha256();
+    hash->update("hello ");
+    auto copy = hash->copy();
+    EXPECT_EQ(hex_encode(hash->digest()), "5e3235a8346e5a4585f8c58562f5052b8fe26a3bb122e1e96c76784964dfc461");
+    hash->update("world");
+    EXPECT_EQ(hex_encode(hash->digest()), "b94d27b9934d3e08a52e52d7da7dabfac484efe37a5380ee9088f7ace2efcde9");
+    EXPECT_EQ(hex_encode(copy->digest()), "5e3235a8346e5a4585f8c58562f5052b8fe26a3bb122e1e96c76784964dfc461");
+}
+
+TEST_F(HashingTest, by_name) {
+    EXPECT_STREQ(Hashing::by_name("sha1")->name(), "sha1");
+    EXPECT_EQ(Hashing::by_name("blake2b")->block_size(), 128u);
+    EXPECT_EQ(Hashing::by_name("md5")->digest_size(), 16u);
+    EXPECT_EQ(Hashing::by_name("sha3_256"), nullptr);
+}
@@ -243,3 +243,12 @@ TEST_F(InstructionTest, method_call) {
     EXPECT_EQ(instr.params[1]->params[0]->params[1]->params.size(), 1);
     EXPECT_IS_VAR(instr.params[1]->params[0]->params[1]->params[0], "c");
 }
+
+TEST_F(InstructionTest, percent_format_literal) {
+    // The format of a literal is compiled with the line, an invalid one raises when the line runs
+    auto instr = Instruction::fromTokenList(tokenizeLine("a = '%d items' % b"));
+    EXPECT_IS_BINARY_OP(instr.params[1], Operation::MOD);
+    EXPECT_NE(instr.params[1]->percent, nullptr);
+    EXPECT_EQ(Instruction::fromTokenList(tokenizeLine("a = b % c")).params[1]->percent, nullptr);
+    EXPECT_EQ(Instruction::fromTokenList(tokenizeLine("a = '%y' % b")).params[1]->percent, nullptr);
+}
@@ -0,0 +1,130 @@
+#include "src/MathKernels.h"
+
+#include <gtest/gtest.h>
+
+#include <cmath>
+#include <cstring>
+#include <limits>
+#include <random>
+#include <vector>
+
+using namespace MiniPython;
+
+class MathKernelsTest: public testing::Test {
+};
+
+static int64_t ulp_distance(double a, double b) {
+    if (std::isnan(a) || std::isnan(b)) {
+        return std::isnan(a) && std::isnan(b) ? 0 : INT64_MAX;
+    }
+    int64_t x, y;
+    std::memcpy(&x, &a, sizeof(x));
+    std::memcpy(&y, &b, sizeof(y));
+    // Map to a monotonic integer scale
+    x = x < 0 ? INT64_MIN - x : x;
+    y = y < 0 ? INT64_MIN - y : y;
+    return x > y ? x - y : y - x;
+}
+
+static void expect_close(MathKernels::Kernel kernel, double (*reference)(double), const std::vector<double> &in) {
+    std::vector<double> out(in.size());
+    kernel(in.data(), out.data(), in.size());
+    for (size_t i = 0; i < in.size(); ++i) {
+        EXPECT_LE(ulp_distance(out[i], reference(in[i])), 2) << "x = " << in[i];
+    }
+}
+
+static std::vector<double> random_values(double low, double high, size_t count) {
+    std::mt19937 generator(42);
+    std::uniform_real_distribution<double> distribution(low, high);
+    std::vector<double> values(count);
+    for (auto &value: values) {
+        value = distribution(generator);
+    }
+    return values;
+}
+
+static double std_sqrt(double x) { return std::sqrt(x); }
+static double std_exp(double x) { return std::exp(x); }
+static double std_log(double x) { return std::log(x); }
+static double std_sin(double x) { return std::sin(x); }
+static double std_cos(double x) { return std::cos(x); }
+static double std_tan(double x) { return std::tan(x); }
+
+TEST_F(MathKernelsTest, sqrt) {
+    std::vector<double> in = random_values(0, 1e6, 1001);
+    std::vector<double> out(in.size());
+    MathKernels::sqrt(in.data(), out.data(), in.size());
+    for (size_t i = 0; i < in.size(); ++i) {
+        EXPECT_EQ(out[i], std::sqrt(in[i]));
+    }
+    expect_close(MathKernels::sqrt, std_sqrt, {0.0, -0.0, 1.0, 4.0, -1.0, INFINITY, NAN});
+}
+
+TEST_F(MathKernelsTest, exp) {
+    expect_close(MathKernels::exp, std_exp, random_values(-700, 700, 1001));
+    expect_close(MathKernels::exp, std_exp, random_values(-1, 1, 1001));
+    // Blocks with values outside the vector range
+    expect_close(MathKernels::exp, std_exp, {0.0, 1.0, 710.0, -1.0, -745.0, INFINITY, -INFINITY, NAN, 0.5});
+}
+
+TEST_F(MathKernelsTest, log) {
+    expect_close(MathKernels::log, std_log, random_values(1e-300, 1e300, 1001));
+    expect_close(MathKernels::log, std_log, random_values(0.5, 2, 1001));
+    expect_close(MathKernels::log, std_log, {1.0, 2.0, 0.0, -1.0, 5e-324, INFINITY, NAN, 10.0, 3.0});
+}
+
+TEST_F(MathKernelsTest, trigonometry) {
+    for (auto values: {random_values(-10, 10, 1001), random_values(-1e5, 1e5, 1001)}) {
+        expect_close(MathKernels::sin, std_sin, values);
+        expect_close(MathKernels::cos, std_cos, values);
+        expect_close(MathKernels::tan, std_tan, values);
+    }
+    // Blocks of 4 go to the vector code only when all of their values are in range
+    std::vector<double> special = {0.0, -0.0, 1e300, INFINITY, M_PI, 2 * M_PI, 100 * M_PI, 3 * M_PI_2,
+                                   1.0, 2.0, 3.0, 4.0, NAN};
+    expect_close(MathKernels::sin, std_sin, special);
+    expect_close(MathKernels::cos, std_cos, special);
+    expect_close(MathKernels::tan, std_tan, special);
+}
+
+TEST_F(MathKernelsTest, near_multiples_of_pi_2) {
+    // Cancellation in the range reduction is largest next to k*pi/2
+    std::vector<double> values;
+    for (int k = -63000; k <= 63000; k += 7) {
+        double x = k * M_PI_2;
+        values.insert(values.end(), {std::nextafter(x, -INFINITY), x, std::nextafter(x, INFINITY)});
+    }
+    expect_close(MathKernels::sin, std_sin, values);
+    expect_close(MathKernels::cos, std_cos, values);
+    expect_close(MathKernels::tan, std_tan, values);
+}
+
+TEST_F(MathKernelsTest, in_place) {
+    std::vector<double> values = {1, 4, 9, 16, 25};
+    MathKernels::sqrt(values.data(), values.data(), values.size());
+    EXPECT_EQ(values, std::vector<double>({1, 2, 3, 4, 5}));
+}
+
+TEST_F(MathKernelsTest, fsum) {
+    std::vector<double> tenths(10, 0.1);
+    EXPECT_EQ(MathKernels::fsum(tenths.data(), tenths.size()), 1.0);
+
+    std::vector<double> cancelling = {1e100, 1.0, -1e100, 1e-100, 1e50, -1.0, -1e50};
+    EXPECT_EQ(MathKernels::fsum(cancelling.data(), cancelling.size()), 1e-100);
+
+    // Half-way case rounded to even
+    std::vector<double> half = {1.0, 1e-16, 1e-16};
+    EXPECT_EQ(MathKernels::fsum(half.data(), half.size()), 1.0000000000000002);
+
+    EXPECT_EQ(MathKernels::fsum(nullptr, 0), 0.0);
+
+    std::vector<double> infinite = {1.0, INFINITY, 2.0};
+    EXPECT_EQ(MathKernels::fsum(infinite.data(), infinite.size()), INFINITY);
+    std::vector<double> not_a_number = {1.0, NAN, INFINITY};
+    EXPECT_TRUE(std::isnan(MathKernels::fsum(not_a_number.data(), not_a_number.size())));
+    std::vector<double> opposite = {INFINITY, -INFINITY};
+    EXPECT_THROW(MathKernels::fsum(opposite.data(), opposite.size()), std::runtime_error);
+    std::vector<double> overflow = {1e308, 1e308, -1e308};
+    EXPECT_THROW(MathKernels::fsum(overflow.data(), overflow.size()), std::runtime_error);
+}
@@ -0,0 +1,98 @@
+#include "variable/Variable.h"
+#include "variable/File.h"
+#include "src/Instruction.h"
+#include "src/Scope.h"
+#include "test/TestUtils.h"
+
+#include <gtest/gtest.h>
+
+#include <cstdio>
+
+using namespace MiniPython;
+
+class MemoryViewTest: public CallFixture {
+};
+
+TEST_F(MemoryViewTest, shares_exporter_memory) {
+    Variable bytes = NEW_BYTES("hello world");
+    auto view = std::make_shared<MemoryView>(bytes);
+    EXPECT_EQ(view->buffer().data(), get_buffer(bytes).data());
+    EXPECT_EQ(view->buffer(), "hello world");
+    EXPECT_EQ(VAR_TO_INT(view->get_attr("nbytes")), 11);
+    EXPECT_TRUE(view->get_attr("readonly")->to_bool());
+}
+
+TEST_F(MemoryViewTest, slice_without_copy) {
+    Variable bytes = NEW_BYTES("hello world");
+    auto view = std::make_shared<MemoryView>(bytes);
+
+    auto world = view->slice(6, 11);
+    EXPECT_EQ(world->buffer(), "world");
+    EXPECT_EQ(world->buffer().data(), get_buffer(bytes).data() + 6);
+
+    EXPECT_EQ(world->slice(1, -1)->buffer(), "orl");
+    EXPECT_EQ(view->slice(-5, 100)->buffer(), "world");
+    EXPECT_EQ(view->slice(5, 2)->buffer(), "");
+
+    // A view of a slice keeps the offset
+    auto nested = std::make_shared<MemoryView>(world);
+    EXPECT_EQ(nested->buffer(), "world");
+}
+
+TEST_F(MemoryViewTest, array_exporter) {
+    auto array = std::make_shared<ArrayVariable>(NEW_STRING("h"), ListType({NEW_INT(1), NEW_INT(2)}));
+    auto view = std::make_shared<MemoryView>(array);
+    EXPECT_FALSE(view->get_attr("readonly")->to_bool());
+    EXPECT_EQ(view->to_list().size(), 4);
+
+    // Writes through the array are visible in the view
+    array->set_item(0, NEW_INT(0x0403));
+    EXPECT_EQ(view->buffer(), std::string("\x03\x04\x02\x00", 4));
+
+    array->resize(1);
+    EXPECT_THROW(view->buffer(), std::runtime_error);
+}
+
+TEST_F(MemoryViewTest, methods) {
+    auto view = std::make_shared<MemoryView>(NEW_BYTES("\x01\xff"));
+    EXPECT_EQ(call_method(view, "hex")->to_str(), "01ff");
+    EXPECT_EQ(call_method(view, "tolist")->to_str(), "[1, 255]");
+    auto bytes = call_method(view, "tobytes");
+    EXPECT_EQ(bytes->get_type(), VariableType::BYTES);
+    EXPECT_EQ(VAR_TO_BYTES(bytes), "\x01\xff");
+}
+
+TEST_F(MemoryViewTest, not_a_buffer) {
+    EXPECT_THROW(std::make_shared<MemoryView>(NEW_STRING("text")), std::runtime_error);
+    EXPECT_THROW(get_buffer(NEW_INT(1)), std::runtime_error);
+}
+
+TEST_F(MemoryViewTest, bytes_concatenation) {
+    auto result = NEW_BYTES("ab")->add(std::make_shared<MemoryView>(NEW_BYTES("cd")));
+    EXPECT_EQ(result->get_type(), VariableType::BYTES);
+    EXPECT_EQ(VAR_TO_BYTES(result), "abcd");
+}
+
+TEST_F(MemoryViewTest, binary_file_write_and_read) {
+    std::string filename = testing::TempDir() + "memoryview_test.bin";
+    auto array = std::make_shared<ArrayVariable>(NEW_STRING("B"), ListType({NEW_INT(0), NEW_INT(1), NEW_INT(255)}));
+    {
+        auto file = std::make_shared<FileVariable>(filename, "wb");
+        Variable view = std::make_shared<MemoryView>(array);
+        EXPECT_EQ(VAR_TO_INT(call_method(file, "write", {std::make_shared<Instruction>(view)})), 3);
+        call_method(file, "close");
+        EXPECT_THROW(call_method(file, "tell"), std::runtime_error);
+    }
+
+    auto file = std::make_shared<FileVariable>(filename, "rb");
+    auto content = call_method(file, "read");
+    EXPECT_EQ(content->get_type(), VariableType::BYTES);
+    EXPECT_EQ(VAR_TO_BYTES(content), std::string("\x00\x01\xff", 3));
+
+    auto text = std::make_shared<FileVariable>(filename, "r");
+    Variable bytes = NEW_BYTES("x");
+    EXPECT_THROW(call_method(text, "write", {std::make_shared<Instruction>(bytes)}), std::runtime_error);
+
+    std::remove(filename.c_str());
+    EXPECT_THROW(std::make_shared<FileVariable>(filename, "r"), std::runtime_error);
+}
@@ -0,0 +1,199 @@
+#include "export/mini-python.h"
+#include "src/Scope.h"
+
+#include <gtest/gtest.h>
+
+#include <thread>
+
+using namespace MiniPython;
+
+class ProgramTest: public testing::Test {
+};
+
+TEST_F(ProgramTest, run_with_provided_globals) {
+    auto program = Program::fromString("x = y + 1\nz = x * 2\n");
+
+    Interpreter interpreter;
+
+    auto globals = interpreter.makeGlobals();
+    globals->setVariable("y", NEW_INT(41));
+    program.run(globals);
+    EXPECT_EQ(VAR_TO_INT(globals->getVariable("x")), 42);
+    EXPECT_EQ(VAR_TO_INT(globals->getVariable("z")), 84);
+
+    auto other_globals = interpreter.makeGlobals();
+    other_globals->setVariable("y", NEW_INT(1));
+    program.run(other_globals);
+    EXPECT_EQ(VAR_TO_INT(other_globals->getVariable("z")), 4);
+
+    // the first run is not affected by the second one
+    EXPECT_EQ(VAR_TO_INT(globals->getVariable("z")), 84);
+}
+
+TEST_F(ProgramTest, run_from_several_threads) {
+    auto program = Program::fromString("x = y * y\n");
+
+    std::vector<std::thread> threads;
+    std::vector<IntType> results(4);
+    for (size_t i = 0; i < results.size(); ++i) {
+        threads.emplace_back([&, i]() {
+            Interpreter interpreter;
+            for (int j = 0; j < 1000; ++j) {
+                auto globals = interpreter.makeGlobals();
+                globals->setVariable("y", NEW_INT(i + j));
+                program.run(globals);
+                results[i] = VAR_TO_INT(globals->getVariable("x"));
+            }
+        });
+    }
+    for (auto &thread: threads) {
+        thread.join();
+    }
+
+    for (size_t i = 0; i < results.size(); ++i) {
+        EXPECT_EQ(results[i], (i + 999) * (i + 999));
+    }
+}
+
+TEST_F(ProgramTest, globals_shadow_builtins) {
+    Interpreter interpreter;
+
+    auto globals = interpreter.makeGlobals();
+    Program::fromString("len = 5\n").run(globals);
+    EXPECT_EQ(VAR_TO_INT(globals->getVariable("len")), 5);
+
+    // builtins of the interpreter are not modified
+    auto other_globals = interpreter.makeGlobals();
+    EXPECT_EQ(other_globals->getVariable("len")->get_type(), VariableType::FUNCTION);
+}
+
+TEST_F(ProgramTest, interpreters_have_separate_environment) {
+    Interpreter interpreter1;
+    Interpreter interpreter2;
+
+    auto globals1 = interpreter1.makeGlobals();
+    auto globals2 = interpreter2.makeGlobals();
+
+    Program::fromString("os.putenv('MINI_PYTHON_TEST_VAR', 'abc')\n").run(globals1);
+
+    auto program = Program::fromString("env = os.environ\n");
+    program.run(globals1);
+    program.run(globals2);
+
+    auto env1 = std::dynamic_pointer_cast<DictVariable>(globals1->getVariable("env"));
+    auto env2 = std::dynamic_pointer_cast<DictVariable>(globals2->getVariable("env"));
+    EXPECT_EQ(env1->get(NEW_STRING("MINI_PYTHON_TEST_VAR"), NONE)->to_str(), "abc");
+    EXPECT_EQ(env2->get(NEW_STRING("MINI_PYTHON_TEST_VAR"), NONE)->get_type(), VariableType::NONE);
+}
+
+TEST_F(ProgramTest, reset_interpreter) {
+    Interpreter interpreter;
+
+    interpreter.run(Program::fromString("x = 1\nos.putenv('MINI_PYTHON_TEST_VAR', 'abc')\n"));
+    EXPECT_EQ(VAR_TO_INT(interpreter.globals()->getVariable("x")), 1);
+
+    interpreter.reset();
+    EXPECT_ANY_THROW(interpreter.globals()->getVariable("x"));
+
+    interpreter.run(Program::fromString("env = os.environ\n"));
+    auto env = std::dynamic_pointer_cast<DictVariable>(interpreter.globals()->getVariable("env"));
+    EXPECT_EQ(env->get(NEW_STRING("MINI_PYTHON_TEST_VAR"), NONE)->get_type(), VariableType::NONE);
+}
+
+TEST_F(ProgramTest, reset_modules) {
+    Interpreter interpreter;
+    auto os = interpreter.globals()->getBuiltin("os");
+    auto sep = os->get_attr("sep");
+
+    // Changes made by the host to attributes, functions and the environment
+    os->set_attr("sep", NEW_STRING("|"));
+    os->set_attr("extra", NEW_INT(1));
+    os->set_attr("getcwd", NEW_INT(2));
+    auto env = std::dynamic_pointer_cast<DictVariable>(os->get_attr("environ"));
+    env->set_item(NEW_STRING("MINI_PYTHON_TEST_VAR"), NEW_STRING("abc"));
+
+    interpreter.reset();
+    EXPECT_EQ(os->get_attr("sep"), sep);
+    EXPECT_FALSE(os->has_attr("extra"));
+    EXPECT_EQ(os->get_attr("getcwd")->get_type(), VariableType::FUNCTION);
+    env = std::dynamic_pointer_cast<DictVariable>(os->get_attr("environ"));
+    EXPECT_EQ(env->get(NEW_STRING("MINI_PYTHON_TEST_VAR"), NONE)->get_type(), VariableType::NONE);
+}
+
+TEST_F(ProgramTest, interpreter_pool) {
+    InterpreterPool pool(2);
+    auto program = Program::fromString("x = y * 2\n");
+
+    std::vector<std::thread> threads;
+    std::vector<IntType> results(4);
+    for (size_t i = 0; i < results.size(); ++i) {
+        threads.emplace_back([&, i]() {
+            for (int j = 0; j < 1000; ++j) {
+                auto interpreter = pool.acquire();
+                EXPECT_ANY_THROW(interpreter->globals()->getVariable("x"));
+                interpreter->globals()->setVariable("y", NEW_INT(i + j));
+                interpreter->run(program);
+                results[i] = VAR_TO_INT(interpreter->globals()->getVariable("x"));
+            }
+        });
+    }
+    for (auto &thread: threads) {
+        thread.join();
+    }
+
+    for (size_t i = 0; i < results.size(); ++i) {
+        EXPECT_EQ(results[i], (i + 999) * 2);
+    }
+}
+
+TEST_F(ProgramTest, string_append_in_place) {
+    auto program = Program::fromString("s = s + 'b'\ns = s + 'c'\n");
+
+    Interpreter interpreter;
+    auto globals = interpreter.makeGlobals();
+    Variable initial = NEW_STRING("a");
+    globals->setVariable("s", initial);
+    program.run(globals);
+
+    // The initial object is also held here, so it must not change
+    EXPECT_EQ(VAR_TO_STR(initial), "a");
+    auto result = globals->getVariable("s");
+    EXPECT_EQ(VAR_TO_STR(result), "abc");
+
+    // Only the variable holds the result now: appended without a new object
+    auto *address = result.get();
+    result.reset();
+    program.run(globals);
+    EXPECT_EQ(globals->getVariable("s").get(), address);
+    EXPECT_EQ(VAR_TO_STR(globals->getVariable("s")), "abcbc");
+
+    // The literal pieces of the shared program are untouched
+    auto other_globals = interpreter.makeGlobals();
+    other_globals->setVariable("s", NEW_STRING(""));
+    program.run(other_globals);
+    EXPECT_EQ(VAR_TO_STR(other_globals->getVariable("s")), "bc");
+}
+
+TEST_F(ProgramTest, attribute_names_from_strings) {
+    auto program = Program::fromString(
+        "import os\n"
+        "a = (hasattr(os, 'program_test_missing'))\n"
+        "b = (getattr(os, 'program_test_missing', 5))\n"
+        "c = (hasattr(os, 'getcwd'))\n"
+        "d = (getattr('ab', 'upper'))\n"
+        "e = (eval('len'))\n");
+    Interpreter interpreter;
+    auto globals = interpreter.makeGlobals();
+    program.run(globals);
+
+    EXPECT_FALSE(globals->getVariable("a")->to_bool());
+    EXPECT_EQ(globals->getVariable("b")->to_int(), 5);
+    EXPECT_TRUE(globals->getVariable("c")->to_bool());
+    EXPECT_EQ(globals->getVariable("d")->get_type(), VariableType::FUNCTION);
+    EXPECT_EQ(globals->getVariable("e")->get_type(), VariableType::FUNCTION);
+    // Looked up, not interned
+    EXPECT_FALSE(Atom::find("program_test_missing").has_value());
+
+    auto missing = Program::fromString("import os\nx = (getattr(os, 'program_test_missing'))\n");
+    EXPECT_THROW(missing.run(interpreter.makeGlobals()), std::runtime_error);
+}
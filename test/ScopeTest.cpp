@@ -73,7 +73,7 @@ TEST_F(ScopeTest, parsing_test) {
 
     EXPECT_EQ(scope->impl->children[0]->impl->type, ScopeType::ORDINARY_LINE);
     EXPECT_EQ(scope->impl->children[0]->impl->children.size(), 0);
-    EXPECT_EQ(scope->impl->children[0]->impl->instruction.op, Operation::ASSIGN);
+    EXPECT_EQ(scope->impl->children[0]->impl->instruction->op, Operation::ASSIGN);
 
     EXPECT_EQ(scope->impl->children[1]->impl->type, ScopeType::IF);
     EXPECT_EQ(scope->impl->children[1]->impl->children.size(), 2);
@@ -89,5 +89,5 @@ TEST_F(ScopeTest, function_call_one_arg) {
     EXPECT_EQ(scope->impl->children.size(), 1);
 
     EXPECT_EQ(scope->impl->children[0]->impl->type, ScopeType::ORDINARY_LINE);
-    EXPECT_EQ(scope->impl->children[0]->impl->instruction.op, Operation::CALL);
+    EXPECT_EQ(scope->impl->children[0]->impl->instruction->op, Operation::CALL);
 }
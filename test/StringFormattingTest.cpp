@@ -2,6 +2,8 @@
 #include "src/StringFormatting.h"
 #include "src/Scope.h"
 
+#include <cmath>
+
 using namespace MiniPython;
 
 class ParsedFormatTest: public testing::Test {
@@ -89,6 +91,49 @@ TEST_F(InterpolateStringTest, interpolate) {
     EXPECT_EQ(interpolate_value("%s", NEW_STRING("")), "");
 }
 
+TEST_F(InterpolateStringTest, interpolate_numbers) {
+    EXPECT_EQ(interpolate_value("%f", NEW_FLOAT(3.14159)), "3.141590");
+    EXPECT_EQ(interpolate_value("%.2f", NEW_FLOAT(3.14159)), "3.14");
+    EXPECT_EQ(interpolate_value("%.0f", NEW_FLOAT(2.5)), "2");
+    EXPECT_EQ(interpolate_value("%.1f", NEW_INT(7)), "7.0");
+    EXPECT_EQ(interpolate_value("%+.1f", NEW_FLOAT(0.25)), "+0.2");
+    EXPECT_EQ(interpolate_value("%d", NEW_INT(-42)), "-42");
+    EXPECT_EQ(interpolate_value("%d", NEW_FLOAT(-3.99)), "-3");
+    EXPECT_EQ(interpolate_value("%d", NEW_FLOAT(-0.5)), "0");
+    EXPECT_EQ(interpolate_value("%d", NEW_FLOAT(1e20)), "100000000000000000000");
+    EXPECT_THROW(interpolate_value("%f", NEW_STRING("3")), std::runtime_error);
+}
+
+TEST_F(InterpolateStringTest, interpolate_other_letters) {
+    EXPECT_EQ(interpolate_value("%e", NEW_FLOAT(1234.5)), "1.234500e+03");
+    EXPECT_EQ(interpolate_value("%.1E", NEW_INT(-1234)), "-1.2E+03");
+    EXPECT_EQ(interpolate_value("%g", NEW_FLOAT(0.00001)), "1e-05");
+    EXPECT_EQ(interpolate_value("%.3G", NEW_FLOAT(1234.5)), "1.23E+03");
+    EXPECT_EQ(interpolate_value("%c", NEW_INT(0x20ac)), "\u20ac");
+    EXPECT_EQ(interpolate_value("%c", NEW_STRING("\u20ac")), "\u20ac");
+    EXPECT_THROW(interpolate_value("%c", NEW_STRING("ab")), std::runtime_error);
+    EXPECT_EQ(interpolate_value("%r", NEW_STRING("a\tb\\'")), "\"a\\tb\\\\'\"");
+    EXPECT_EQ(interpolate_value("%r", NEW_STRING("\x01\"")), "'\\x01\"'");
+    EXPECT_EQ(interpolate_value("%r", NEW_INT(5)), "5");
+}
+
+TEST_F(InterpolateStringTest, interpolate_min_digits) {
+    EXPECT_EQ(interpolate_value("%.3d", NEW_INT(7)), "007");
+    EXPECT_EQ(interpolate_value("%.3d", NEW_INT(-7)), "-007");
+    EXPECT_EQ(interpolate_value("%+.3i", NEW_INT(7)), "+007");
+    EXPECT_EQ(interpolate_value("%6.3u", NEW_INT(7)), "   007");
+    EXPECT_EQ(interpolate_value("%-6.3d", NEW_INT(-7)), "-007  ");
+    EXPECT_EQ(interpolate_value("%.2d", NEW_INT(12345)), "12345");
+    EXPECT_EQ(interpolate_value("%.4x", NEW_INT(255)), "00ff");
+    EXPECT_EQ(interpolate_value("%#.4X", NEW_INT(255)), "0X00FF");
+    EXPECT_EQ(interpolate_value("%#8.4x", NEW_INT(-255)), " -0x00ff");
+    EXPECT_EQ(interpolate_value("%#.4o", NEW_INT(8)), "0o0010");
+    EXPECT_EQ(interpolate_value("%.0d", NEW_INT(0)), "0");
+    EXPECT_EQ(interpolate_value("%.3d", NEW_FLOAT(-7.9)), "-007");
+    EXPECT_EQ(interpolate_value("%.3d", NEW_FLOAT(-0.5)), "000");
+    EXPECT_EQ(interpolate_value("%.22d", NEW_FLOAT(1e20)), "0100000000000000000000");
+}
+
 TEST_F(InterpolateStringTest, interpolate_vars) {
     EXPECT_EQ(NEW_STRING("%+#21.3s")->mod(NEW_FLOAT(3456.78))->to_str(), "                  345");
     EXPECT_EQ(NEW_STRING("%#21.3sdef")->mod(NEW_FLOAT(3456.78))->to_str(), "                  345def");
@@ -96,6 +141,125 @@ TEST_F(InterpolateStringTest, interpolate_vars) {
     EXPECT_EQ(NEW_STRING("abc%#21.3sdef")->mod(NEW_FLOAT(3456.78))->to_str(), "abc                  345def");
 }
 
+TEST_F(ParsedFormatTest, test_flags_and_width) {
+    ParsedFormat f("%-08.3ld");
+    EXPECT_EQ(f.minus, true);
+    EXPECT_EQ(f.zero, true);
+    EXPECT_EQ(f.width, 8);
+    EXPECT_EQ(f.after_octothorp, 0);
+    EXPECT_EQ(f.after_dot, 3);
+    EXPECT_EQ(f.letter, "d");
+}
+
+class PercentFormatterTest: public testing::Test {
+};
+
+TEST_F(PercentFormatterTest, format) {
+    PercentFormatter formatter("%s=%5d (%.1f%%)");
+    EXPECT_EQ(formatter.format({NEW_STRING("a"), NEW_INT(7), NEW_FLOAT(12.34)}), "a=    7 (12.3%)");
+    EXPECT_EQ(formatter.format({NEW_STRING("bc"), NEW_INT(-12345678), NEW_FLOAT(0)}), "bc=-12345678 (0.0%)");
+    EXPECT_EQ(PercentFormatter("%d|%x").format({NEW_INT(INT64_MIN), NEW_INT(-255)}), "-9223372036854775808|-ff");
+    EXPECT_EQ(PercentFormatter("no conversions").format({NEW_LIST(ListType())}), "no conversions");
+    EXPECT_EQ(PercentFormatter("%s").format({NEW_BYTES("ab")}), "b'ab'");
+    EXPECT_EQ(PercentFormatter("%s", true).format({NEW_BYTES("ab")}), "ab");
+
+    EXPECT_THROW(formatter.format({NEW_STRING("a")}), std::runtime_error);
+    EXPECT_THROW(PercentFormatter("%d").format({NEW_INT(1), NEW_INT(2)}), std::runtime_error);
+    EXPECT_THROW(PercentFormatter("%d %"), std::runtime_error);
+    EXPECT_THROW(PercentFormatter("%y"), std::runtime_error);
+}
+
+TEST_F(PercentFormatterTest, mod) {
+    auto tuple = std::make_shared<ListVariable>(ListType{NEW_STRING("k"), NEW_INT(1)});
+    tuple->is_tuple = true;
+    EXPECT_EQ(PercentFormatter("%s:%d").mod(tuple)->to_str(), "k:1");
+    EXPECT_EQ(PercentFormatter("[%s]").mod(NEW_INT(5))->to_str(), "[5]");
+    EXPECT_EQ(PercentFormatter("%s", true).mod(NEW_BYTES("ab"))->get_type(), VariableType::BYTES);
+}
+
+class FormatSpecTest: public testing::Test {
+};
+
+TEST_F(FormatSpecTest, parse) {
+    FormatSpec spec("\xc2\xb7^+#012_.3f");
+    EXPECT_EQ(spec.fill, "\xc2\xb7");
+    EXPECT_EQ(spec.align, '^');
+    EXPECT_EQ(spec.sign, '+');
+    EXPECT_TRUE(spec.alternate);
+    EXPECT_TRUE(spec.zero);
+    EXPECT_EQ(spec.width, 12);
+    EXPECT_EQ(spec.grouping, '_');
+    EXPECT_EQ(spec.precision, 3);
+    EXPECT_EQ(spec.type, 'f');
+
+    EXPECT_TRUE(FormatSpec("").is_default());
+    EXPECT_EQ(FormatSpec("05").fill, "0");
+    EXPECT_EQ(FormatSpec("<").fill, " ");
+    EXPECT_THROW(FormatSpec(".f"), std::runtime_error);
+    EXPECT_THROW(FormatSpec("10dd"), std::runtime_error);
+}
+
+TEST_F(FormatSpecTest, format_value) {
+    EXPECT_EQ(format_value(NEW_INT(INT64_MIN), ","), "-9,223,372,036,854,775,808");
+    EXPECT_EQ(format_value(NEW_INT(BigInt::from_string("123456789012345678901234567890")), ","),
+              "123,456,789,012,345,678,901,234,567,890");
+    EXPECT_EQ(format_value(NEW_INT(-BigInt::pow(2, 70) - 255), "#_X"), "-0X40_0000_0000_0000_00FF");
+    EXPECT_EQ(format_value(NEW_INT(1234), "09,"), "0,001,234");
+    EXPECT_EQ(format_value(NEW_INT(255), "#010_x"), "0x000_00ff");
+    EXPECT_EQ(format_value(NEW_INT(0x1f600), "c"), "\xf0\x9f\x98\x80");
+    EXPECT_EQ(format_value(NEW_FLOAT(INFINITY), "010f"), "0000000inf");
+    EXPECT_EQ(format_value(NEW_FLOAT(-INFINITY), "F"), "-INF");
+    EXPECT_EQ(format_value(NEW_FLOAT(NAN), "=+8"), "+    nan");
+    EXPECT_EQ(format_value(NEW_FLOAT(-0.0), ""), "-0.0");
+    EXPECT_EQ(format_value(NEW_FLOAT(1e300), ".2f").size(), 304);
+    EXPECT_EQ(format_value(NEW_FLOAT(1.5), "#.0e"), "2.e+00");
+    EXPECT_EQ(format_value(NEW_STRING("\xc3\xa9t\xc3\xa9"), "-^7.2"), "--\xc3\xa9t---");
+    EXPECT_EQ(format_value(NEW_STRING("ab"), ""), "ab");
+
+    EXPECT_THROW(format_value(NEW_INT(1), ".2"), std::runtime_error);
+    EXPECT_THROW(format_value(NEW_INT(1), ",x"), std::runtime_error);
+    EXPECT_THROW(format_value(NEW_STRING("a"), "+"), std::runtime_error);
+    EXPECT_THROW(format_value(NEW_STRING("a"), "d"), std::runtime_error);
+    EXPECT_THROW(format_value(NEW_FLOAT(1), "x"), std::runtime_error);
+    EXPECT_THROW(format_value(NONE, ">3"), std::runtime_error);
+    EXPECT_EQ(format_value(NONE, ""), "None");
+}
+
+TEST_F(FormatSpecTest, format_fields) {
+    std::vector<Variable> args = {NEW_STRING("a"), NEW_INT(2)};
+    std::vector<std::pair<std::string_view, Variable>> kwargs = {{"x", NEW_FLOAT(0.5)}};
+    EXPECT_EQ(format_fields("{}{}|{x:.2f}|{{}}", args, kwargs), "a2|0.50|{}");
+    EXPECT_EQ(format_fields("{1:>3}{0}{1}", args, kwargs), "  2a2");
+    EXPECT_THROW(format_fields("{}{}{}", args, kwargs), std::runtime_error);
+    EXPECT_THROW(format_fields("{0}{}", args, kwargs), std::runtime_error);
+    EXPECT_THROW(format_fields("{y}", args, kwargs), std::runtime_error);
+    EXPECT_THROW(format_fields("{", args, kwargs), std::runtime_error);
+    EXPECT_THROW(format_fields("}", args, kwargs), std::runtime_error);
+}
+
+TEST_F(FormatSpecTest, format_fields_conversions) {
+    std::vector<Variable> args = {NEW_STRING("a"), NEW_INT(2)};
+    std::vector<std::pair<std::string_view, Variable>> kwargs = {{"x", NEW_FLOAT(0.5)}};
+    EXPECT_EQ(format_fields("{!r:>6}|{!s}|{x!a}", args, kwargs), "   'a'|2|0.5");
+    EXPECT_EQ(format_fields("{0!r:}", args, kwargs), "'a'");
+    std::vector<Variable> text = {NEW_STRING("\u00e9\u20ac\U0001f600")};
+    EXPECT_EQ(format_fields("{0!r}{0!a}", text, {}), "'\u00e9\u20ac\U0001f600''\\xe9\\u20ac\\U0001f600'");
+    EXPECT_THROW(format_fields("{!x}", args, kwargs), std::runtime_error);
+    EXPECT_THROW(format_fields("{!rr}", args, kwargs), std::runtime_error);
+    EXPECT_THROW(format_fields("{!}", args, kwargs), std::runtime_error);
+}
+
+TEST_F(FormatSpecTest, format_fields_nested) {
+    std::vector<Variable> args = {NEW_STRING("a"), NEW_INT(3), NEW_FLOAT(3.14159), NEW_INT(8), NEW_INT(2)};
+    EXPECT_EQ(format_fields("{:{}}|{:{}.{}f}", args, {}), "a  |    3.14");
+    std::vector<Variable> numbered = {NEW_INT(7), NEW_STRING(">"), NEW_INT(4)};
+    EXPECT_EQ(format_fields("{0:{1}{2}}", numbered, {}), "   7");
+    std::vector<std::pair<std::string_view, Variable>> kwargs = {{"x", NEW_INT(1)}, {"w", NEW_INT(3)}};
+    EXPECT_EQ(format_fields("{x:{w}}", {}, kwargs), "  1");
+    EXPECT_THROW(format_fields("{x:{w:{w}}}", {}, kwargs), std::runtime_error);
+    EXPECT_THROW(format_fields("{x:{w}", {}, kwargs), std::runtime_error);
+}
+
 class FStringFormatterTest: public testing::Test {
 };
 
@@ -104,3 +268,39 @@ TEST_F(FStringFormatterTest, format) {
     scope.setVariable("str", NEW_STRING("abcdef"));
     EXPECT_EQ(FStringFormatter("{str}").format(&scope), "abcdef");
 }
+
+TEST_F(FStringFormatterTest, compiled_once) {
+    Scope scope;
+    scope.setVariable("x", NEW_INT(2));
+    scope.setVariable("name", NEW_STRING("ab"));
+    FStringFormatter formatter("x={x}, {{x}}, {x * 3 + 1}, {name.upper()}!");
+    EXPECT_EQ(formatter.format(&scope), "x=2, {x}, 7, AB!");
+    scope.setVariable("x", NEW_INT(10));
+    EXPECT_EQ(formatter.format(&scope), "x=10, {x}, 31, AB!");
+
+    EXPECT_EQ(FStringFormatter("").format(&scope), "");
+    EXPECT_EQ(FStringFormatter("}}{{").format(&scope), "}{");
+    EXPECT_EQ(FStringFormatter("{x}{x}").format(&scope), "1010");
+}
+
+TEST_F(FStringFormatterTest, nested_fields) {
+    Scope scope;
+    scope.setVariable("x", NEW_FLOAT(3.14159));
+    scope.setVariable("w", NEW_INT(8));
+    scope.setVariable("p", NEW_INT(2));
+    scope.setVariable("fill", NEW_STRING("*"));
+    FStringFormatter formatter("[{x:>{w}.{p}f}] [{x:{fill}^{w + 2}.{p - 1}f}] [{'ab':<{w:d}}]");
+    EXPECT_EQ(formatter.format(&scope), "[    3.14] [***3.1****] [ab      ]");
+    scope.setVariable("w", NEW_INT(6));
+    EXPECT_EQ(formatter.format(&scope), "[  3.14] [**3.1***] [ab    ]");
+    EXPECT_EQ(FStringFormatter("{x:.3}").format(&scope), "3.14");
+}
+
+TEST_F(FStringFormatterTest, syntax_errors) {
+    EXPECT_THROW(FStringFormatter("{x"), std::runtime_error);
+    EXPECT_THROW(FStringFormatter("x}"), std::runtime_error);
+    EXPECT_THROW(FStringFormatter("{ }"), std::runtime_error);
+    EXPECT_THROW(FStringFormatter("{x:{w}"), std::runtime_error);
+    EXPECT_THROW(FStringFormatter("{x:{w:{p}}}"), std::runtime_error);
+    EXPECT_THROW(FStringFormatter("{x:{}}"), std::runtime_error);
+}
@@ -0,0 +1,88 @@
+#include "src/StringSearch.h"
+
+#include <gtest/gtest.h>
+
+#include <random>
+#include <string>
+
+using namespace MiniPython;
+
+class StringSearchTest: public testing::Test {
+};
+
+// Small alphabet so that partial matches are frequent
+static std::string random_text(std::mt19937 &generator, size_t count) {
+    std::uniform_int_distribution<int> distribution('a', 'c');
+    std::string result(count, '\0');
+    for (auto &ch: result) {
+        ch = static_cast<char>(distribution(generator));
+    }
+    return result;
+}
+
+static size_t reference_count(const std::string &haystack, const std::string &needle) {
+    size_t result = 0;
+    for (size_t position = haystack.find(needle); position != std::string::npos;
+         position = haystack.find(needle, position + needle.size())) {
+        ++result;
+    }
+    return result;
+}
+
+TEST_F(StringSearchTest, find_matches_std_string) {
+    std::mt19937 generator(7);
+    for (size_t needle_size: {1, 2, 3, 5, 16, 17, 33, 64, 65, 100}) {
+        for (int round = 0; round < 50; ++round) {
+            std::string haystack = random_text(generator, 300);
+            // Take the needle from the text half of the time, so it is found
+            std::string needle = (round % 2) ? haystack.substr(round * 3, needle_size)
+                                             : random_text(generator, needle_size);
+            StringSearch::Searcher searcher(needle);
+            for (size_t from: {0, 1, 15, 100, 299, 300}) {
+                EXPECT_EQ(searcher.find(haystack, from), haystack.find(needle, from)) << needle << " from " << from;
+            }
+            EXPECT_EQ(searcher.rfind(haystack), haystack.rfind(needle)) << needle;
+        }
+    }
+}
+
+TEST_F(StringSearchTest, find_at_edges) {
+    std::string haystack(200, 'a');
+    haystack += "ab";
+    EXPECT_EQ(StringSearch::find(haystack, "ab"), 200);
+    EXPECT_EQ(StringSearch::find(haystack, std::string(100, 'a') + "b"), 101);
+    EXPECT_EQ(StringSearch::find(haystack, "b"), 201);
+    EXPECT_EQ(StringSearch::find(haystack, "ba"), StringSearch::npos);
+    EXPECT_EQ(StringSearch::find(haystack, ""), 0);
+    EXPECT_EQ(StringSearch::find("", ""), 0);
+    EXPECT_EQ(StringSearch::find("a", "aa"), StringSearch::npos);
+    EXPECT_EQ(StringSearch::Searcher("").rfind("abc"), 3);
+    EXPECT_EQ(StringSearch::Searcher("ab").find(haystack, 203), StringSearch::npos);
+}
+
+TEST_F(StringSearchTest, count) {
+    std::mt19937 generator(11);
+    for (size_t needle_size: {1, 2, 4, 70}) {
+        for (int round = 0; round < 20; ++round) {
+            std::string haystack = random_text(generator, 500);
+            std::string needle = random_text(generator, needle_size);
+            EXPECT_EQ(StringSearch::count(haystack, needle), reference_count(haystack, needle)) << needle;
+        }
+    }
+    EXPECT_EQ(StringSearch::count("aaaa", "aa"), 2);
+    EXPECT_EQ(StringSearch::count("aaaa", "a", 3), 3);
+    EXPECT_EQ(StringSearch::count("abc", ""), 4);
+    EXPECT_EQ(StringSearch::count("", ""), 1);
+}
+
+TEST_F(StringSearchTest, replace) {
+    EXPECT_EQ(StringSearch::replace("a.b.c", ".", "::"), "a::b::c");
+    EXPECT_EQ(StringSearch::replace("a.b.c", ".", ""), "abc");
+    EXPECT_EQ(StringSearch::replace("a.b.c", ".", "-", 1), "a-b.c");
+    EXPECT_EQ(StringSearch::replace("a.b.c", "x", "-"), "a.b.c");
+    EXPECT_EQ(StringSearch::replace("aaa", "aa", "b"), "ba");
+    EXPECT_EQ(StringSearch::replace("ab", "", "-"), "-a-b-");
+    EXPECT_EQ(StringSearch::replace("ab", "", "-", 2), "-a-b");
+    EXPECT_EQ(StringSearch::replace("", "", "-"), "-");
+    EXPECT_EQ(StringSearch::replace("abc", "abc", ""), "");
+}
@@ -0,0 +1,110 @@
+#include "export/mini-python.h"
+#include "src/Scope.h"
+#include "variable/Variable.h"
+
+#include <gtest/gtest.h>
+#include <gmock/gmock.h>
+
+using namespace MiniPython;
+using testing::ElementsAre;
+
+class StringVariableTest: public testing::Test {
+};
+
+TEST_F(StringVariableTest, cached_hash) {
+    auto a = std::make_shared<StringVariable>("key");
+    auto b = std::make_shared<StringVariable>("key");
+    auto c = std::make_shared<StringVariable>("kez");
+    EXPECT_EQ(a->hash(), std::hash<std::string_view>()("key"));
+    EXPECT_EQ(a->hash(), b->hash());
+    c->hash();
+    EXPECT_TRUE(a->equal(b));
+    EXPECT_FALSE(a->equal(c));
+
+    // Modified in place: the hash is computed again
+    c->value = "key";
+    c->value_changed();
+    EXPECT_EQ(c->hash(), a->hash());
+    EXPECT_TRUE(a->equal(c));
+
+    // Comparison only looks at the values, never at a cached hash
+    b->value = "kez";
+    auto d = std::make_shared<StringVariable>("kez");
+    d->hash();
+    EXPECT_FALSE(a->equal(b));
+    EXPECT_TRUE(b->equal(d));
+}
+
+TEST_F(StringVariableTest, cached_ascii) {
+    auto str = std::make_shared<StringVariable>("plain");
+    EXPECT_TRUE(str->is_ascii());
+    str->value += "\xc3\xa9";
+    str->value_changed();
+    EXPECT_FALSE(str->is_ascii());
+    EXPECT_FALSE(str->is_ascii());
+}
+
+TEST_F(StringVariableTest, attributes) {
+    // The attribute table is only created by set_attr()
+    auto str = std::make_shared<StringVariable>("text");
+    EXPECT_FALSE(str->has_attr("x"));
+    EXPECT_ANY_THROW(str->get_attr("x"));
+    str->set_attr("x", NEW_INT(1));
+    EXPECT_TRUE(str->has_attr("x"));
+    EXPECT_EQ(str->get_attr("x")->to_int(), 1);
+}
+
+TEST_F(StringVariableTest, bound_methods) {
+    // Bound with the caller's pointer: a string doesn't keep one to itself
+    EXPECT_LE(sizeof(StringVariable), 64);
+    Variable str = NEW_STRING("text");
+    auto upper = std::dynamic_pointer_cast<FunctionVariable>(get_bound_attr(str, "upper"));
+    ASSERT_TRUE(upper);
+    InstructionParams no_params;
+    EXPECT_EQ(upper->call(no_params, nullptr)->to_str(), "TEXT");
+    EXPECT_EQ(get_bound_attr(NEW_BYTES("ab"), "upper")->get_type(), VariableType::FUNCTION);
+    EXPECT_ANY_THROW(get_bound_attr(str, "no_such_method"));
+}
+
+// The items of r after running code with s set to value
+static std::vector<std::string> run_method(const std::string &code, Variable value) {
+    static Interpreter interpreter;
+    auto globals = interpreter.makeGlobals();
+    globals->setVariable("s", value);
+    // The parser doesn't take a method call right after = without parentheses
+    Program::fromString("r = (" + code + ")\n").run(globals);
+    std::vector<std::string> result;
+    for (auto &item: VAR_TO_LIST(globals->getVariable("r"))) {
+        result.push_back(std::static_pointer_cast<StringVariable>(item)->value);
+    }
+    return result;
+}
+
+TEST_F(StringVariableTest, split) {
+    auto text = NEW_STRING(" a b\tc  ");
+    EXPECT_THAT(run_method("s.split()", text), ElementsAre("a", "b", "c"));
+    // The rest keeps its trailing whitespace
+    EXPECT_THAT(run_method("s.split(None, 1)", text), ElementsAre("a", "b\tc  "));
+    EXPECT_THAT(run_method("s.split(None, 0)", text), ElementsAre("a b\tc  "));
+    EXPECT_THAT(run_method("s.split(None, 5)", text), ElementsAre("a", "b", "c"));
+    EXPECT_THAT(run_method("s.split()", NEW_STRING("   ")), ElementsAre());
+    EXPECT_THAT(run_method("s.split()", NEW_STRING("x\x1cy")), ElementsAre("x", "y"));
+    EXPECT_THAT(run_method("s.split()", NEW_BYTES("x\x1cy")), ElementsAre("x\x1cy"));
+
+    auto csv = NEW_STRING("a,b,,c");
+    EXPECT_THAT(run_method("s.split(',')", csv), ElementsAre("a", "b", "", "c"));
+    EXPECT_THAT(run_method("s.split(',', 2)", csv), ElementsAre("a", "b", ",c"));
+    EXPECT_THAT(run_method("s.split(',,')", csv), ElementsAre("a,b", "c"));
+    EXPECT_THAT(run_method("s.split(';')", csv), ElementsAre("a,b,,c"));
+    EXPECT_ANY_THROW(run_method("s.split('')", csv));
+}
+
+TEST_F(StringVariableTest, partition) {
+    auto path = NEW_STRING("usr/local/bin");
+    EXPECT_THAT(run_method("s.partition('/')", path), ElementsAre("usr", "/", "local/bin"));
+    EXPECT_THAT(run_method("s.rpartition('/')", path), ElementsAre("usr/local", "/", "bin"));
+    EXPECT_THAT(run_method("s.partition('::')", path), ElementsAre("usr/local/bin", "", ""));
+    EXPECT_THAT(run_method("s.rpartition('::')", path), ElementsAre("", "", "usr/local/bin"));
+    EXPECT_THAT(run_method("s.partition('local')", path), ElementsAre("usr/", "local", "/bin"));
+    EXPECT_ANY_THROW(run_method("s.partition('')", path));
+}
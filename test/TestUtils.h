@@ -0,0 +1,50 @@
+#pragma once
+
+#include "src/Instruction.h"
+#include "src/Scope.h"
+#include "variable/Variable.h"
+
+#include <gtest/gtest.h>
+
+#include <random>
+#include <string>
+
+// Bytes from one generator seeded once per test binary: every call returns
+// new data and every run the same data
+inline std::string random_bytes(size_t count) {
+    static std::mt19937 generator(42);
+    std::uniform_int_distribution<int> distribution(0, 255);
+    std::string result(count, '\0');
+    for (auto &ch: result) {
+        ch = static_cast<char>(distribution(generator));
+    }
+    return result;
+}
+
+// Calls methods of objects, with the arguments given as values
+class CallFixture: public testing::Test {
+protected:
+    MiniPython::Variable call_method(const MiniPython::Variable &object, const std::string &name, MiniPython::InstructionParams params = {}) {
+        auto method = std::dynamic_pointer_cast<MiniPython::FunctionVariable>(MiniPython::get_bound_attr(object, name));
+        return method->call(params, &scope);
+    }
+
+    MiniPython::Scope scope;
+};
+
+// Also calls the functions of a built-in module
+template<typename Module>
+class ModuleFixture: public CallFixture {
+protected:
+    MiniPython::Variable call(const std::string &name, MiniPython::Variable param) {
+        auto function = std::dynamic_pointer_cast<MiniPython::FunctionVariable>(module.get_attr(name));
+        return function->call(param, &scope);
+    }
+
+    MiniPython::Variable call(const std::string &name, MiniPython::Variable param1, MiniPython::Variable param2) {
+        auto function = std::dynamic_pointer_cast<MiniPython::FunctionVariable>(module.get_attr(name));
+        return function->call(param1, param2, &scope);
+    }
+
+    Module module;
+};
@@ -0,0 +1,113 @@
+#include "src/TextKernels.h"
+#include "test/TestUtils.h"
+
+#include <gtest/gtest.h>
+
+#include <cctype>
+#include <string>
+
+using namespace MiniPython;
+using TextKernels::Case;
+
+class TextKernelsTest: public testing::Test {
+};
+
+static uint8_t reference_classes(const std::string &input, bool text = false) {
+    uint8_t result = 0;
+    for (unsigned char ch: input) {
+        result |= (ch >= 0x80) ? TextKernels::NON_ASCII
+                : std::islower(ch) ? TextKernels::LOWER
+                : std::isupper(ch) ? TextKernels::UPPER
+                : std::isdigit(ch) ? TextKernels::DIGIT
+                : (std::isspace(ch) || (text && 0x1c <= ch && ch <= 0x1f)) ? TextKernels::SPACE
+                : TextKernels::OTHER;
+    }
+    return result;
+}
+
+static std::string reference_case(std::string input, Case mapping) {
+    for (auto &ch: input) {
+        unsigned char byte = ch;
+        if (byte < 0x80 && (mapping == Case::LOWER || (mapping == Case::SWAP && std::isupper(byte)))) {
+            ch = std::tolower(byte);
+        }
+        else if (byte < 0x80 && (mapping == Case::UPPER || (mapping == Case::SWAP && std::islower(byte)))) {
+            ch = std::toupper(byte);
+        }
+    }
+    return input;
+}
+
+TEST_F(TextKernelsTest, classify) {
+    // Lengths cover every vector width plus the tails
+    for (size_t length = 0; length <= 100; ++length) {
+        std::string input = random_bytes(length);
+        EXPECT_EQ(TextKernels::classify(input), reference_classes(input)) << "length = " << length;
+    }
+    std::string letters(70, 'a');
+    EXPECT_EQ(TextKernels::classify(letters), TextKernels::LOWER);
+    letters[65] = 'Q';
+    EXPECT_EQ(TextKernels::classify(letters), TextKernels::LOWER | TextKernels::UPPER);
+    EXPECT_EQ(TextKernels::classify(" \t\n\v\f\r"), TextKernels::SPACE);
+    EXPECT_EQ(TextKernels::classify("@[`{/:"), TextKernels::OTHER);
+    EXPECT_EQ(TextKernels::classify(""), 0);
+}
+
+TEST_F(TextKernelsTest, classify_str) {
+    // \x1c-\x1f are whitespace in str only, in the vector part and in the tail
+    std::string separators(40, ' ');
+    separators[3] = '\x1c';
+    separators[39] = '\x1f';
+    EXPECT_EQ(TextKernels::classify_str(separators), TextKernels::SPACE);
+    EXPECT_EQ(TextKernels::classify(separators), TextKernels::SPACE | TextKernels::OTHER);
+    EXPECT_EQ(TextKernels::classify_str("\x1d\x1e a"), TextKernels::SPACE | TextKernels::LOWER);
+    EXPECT_EQ(TextKernels::classify_utf8("\x1c\xc2\xa0"), TextKernels::SPACE);
+    for (size_t length = 0; length <= 100; ++length) {
+        std::string input = random_bytes(length);
+        EXPECT_EQ(TextKernels::classify_str(input), reference_classes(input, true)) << "length = " << length;
+    }
+}
+
+TEST_F(TextKernelsTest, map_case) {
+    for (size_t length = 0; length <= 100; ++length) {
+        std::string input = random_bytes(length);
+        for (Case mapping: {Case::LOWER, Case::UPPER, Case::SWAP}) {
+            EXPECT_EQ(TextKernels::map_case(input, mapping), reference_case(input, mapping)) << "length = " << length;
+        }
+    }
+
+    // In place
+    std::string text = "Mixed Case Text That Is Longer Than One Vector";
+    TextKernels::map_case(text, text.data(), Case::UPPER);
+    EXPECT_EQ(text, "MIXED CASE TEXT THAT IS LONGER THAN ONE VECTOR");
+}
+
+TEST_F(TextKernelsTest, utf8) {
+    EXPECT_EQ(TextKernels::map_case_utf8("Grüße, ÉTÉ", Case::LOWER), "grüße, été");
+    EXPECT_EQ(TextKernels::map_case_utf8("Grüne, ÉTÉ", Case::SWAP), "gRÜNE, été");
+    EXPECT_EQ(TextKernels::classify_utf8("été"), TextKernels::LOWER);
+    EXPECT_EQ(TextKernels::classify_utf8("Été"), TextKernels::LOWER | TextKernels::UPPER);
+    EXPECT_EQ(TextKernels::classify_utf8("日本"), TextKernels::LETTER);
+    // U+00A0 and U+3000
+    EXPECT_EQ(TextKernels::classify_utf8("\xc2\xa0\xe3\x80\x80"), TextKernels::SPACE);
+
+    // U+01C4-U+01C6: DŽ, Dž (titlecase), dž
+    EXPECT_EQ(TextKernels::classify_utf8("\u01c5"), TextKernels::TITLE);
+    EXPECT_EQ(TextKernels::map_case_utf8("\u01c4\u01c5\u01c6", Case::SWAP), "\u01c6\u01c5\u01c4");
+    EXPECT_EQ(TextKernels::map_case_utf8("\u01c6a", Case::TITLE), "\u01c5A");
+    EXPECT_EQ(TextKernels::map_case("ab", Case::TITLE), "AB");
+
+    // U+0663 (Arabic-Indic three), U+00B2 (superscript two), U+00BD (one half), U+4E09 (CJK three)
+    EXPECT_EQ(TextKernels::classify_utf8("\u0663\u00b2\u00bd"), TextKernels::DIGIT);
+    EXPECT_EQ(TextKernels::classify_utf8("\u4e09"), TextKernels::LETTER);
+    EXPECT_EQ(TextKernels::numeric_types_utf8("1\u0663"), TextKernels::NUMERIC_DECIMAL);
+    EXPECT_EQ(TextKernels::numeric_types_utf8("\u00b2\u2460"), TextKernels::NUMERIC_DIGIT);
+    EXPECT_EQ(TextKernels::numeric_types_utf8("\u00bd\u216b\u4e09"), TextKernels::NUMERIC_OTHER);
+    EXPECT_EQ(TextKernels::numeric_types_utf8("\u00b2x"), TextKernels::NUMERIC_DIGIT | TextKernels::NUMERIC_NONE);
+    EXPECT_EQ(TextKernels::numeric_types_utf8("\U0001d7ce\U0001d7ff"), TextKernels::NUMERIC_DECIMAL);
+
+    // Malformed sequences are kept as they are
+    std::string malformed = "a\xc3(\xff";
+    EXPECT_EQ(TextKernels::map_case_utf8(malformed, Case::UPPER), "A\xc3(\xff");
+    EXPECT_EQ(TextKernels::classify_utf8(malformed), TextKernels::LOWER | TextKernels::OTHER);
+}
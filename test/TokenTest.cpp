@@ -181,6 +181,15 @@ TEST_F(TokentTest, attribute_access) {
                                                    Token(TokenType::CLOSING_ROUND_BRACKET, ")")));
 }
 
+TEST_F(TokentTest, keyword_prefix) {
+    ASSERT_THAT(tokenizeLine("s.isdigit"), ElementsAre(Token(TokenType::IDENTIFIER, "s"),
+                                                       Token(TokenType::OPERATOR, "."),
+                                                       Token(TokenType::IDENTIFIER, "isdigit")));
+    ASSERT_THAT(tokenizeLine("a is b"), ElementsAre(Token(TokenType::IDENTIFIER, "a"),
+                                                    Token(TokenType::OPERATOR, "is"),
+                                                    Token(TokenType::IDENTIFIER, "b")));
+}
+
 // Put quotes in #define to avoid quote escaping issues
 
 #define Q1 "'''"
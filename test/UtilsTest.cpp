@@ -0,0 +1,180 @@
+#include "src/Utils.h"
+#include "test/TestUtils.h"
+#include "variable/Variable.h"
+
+#include <gtest/gtest.h>
+
+#include <stdexcept>
+#include <string>
+
+using namespace MiniPython;
+
+class UtilsTest: public testing::Test {
+};
+
+static std::string reference_hex(const std::string &input) {
+    static const char digits[] = "0123456789abcdef";
+    std::string result;
+    for (unsigned char ch: input) {
+        result += digits[ch >> 4];
+        result += digits[ch & 15];
+    }
+    return result;
+}
+
+static std::string reference_base64(const std::string &input) {
+    static const char alphabet[] = "ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz0123456789+/";
+    std::string result;
+    for (size_t i = 0; i < input.size(); i += 3) {
+        uint32_t block = static_cast<unsigned char>(input[i]) << 16;
+        if (i + 1 < input.size()) block |= static_cast<unsigned char>(input[i + 1]) << 8;
+        if (i + 2 < input.size()) block |= static_cast<unsigned char>(input[i + 2]);
+        result += alphabet[(block >> 18) & 63];
+        result += alphabet[(block >> 12) & 63];
+        result += i + 1 < input.size() ? alphabet[(block >> 6) & 63] : '=';
+        result += i + 2 < input.size() ? alphabet[block & 63] : '=';
+    }
+    return result;
+}
+
+TEST_F(UtilsTest, hex_round_trip) {
+    // Lengths cover every vector width plus the scalar tails
+    for (size_t length = 0; length <= 200; ++length) {
+        std::string input = random_bytes(length);
+        std::string hex = hex_encode(input);
+        EXPECT_EQ(hex, reference_hex(input)) << "length = " << length;
+        EXPECT_EQ(str_from_hex_str(hex), input) << "length = " << length;
+    }
+}
+
+TEST_F(UtilsTest, hex_decode) {
+    EXPECT_EQ(str_from_hex_str("DEADbeef0123456789ABCDEFabcdef00"),
+              std::string("\xde\xad\xbe\xef\x01\x23\x45\x67\x89\xab\xcd\xef\xab\xcd\xef\x00", 16));
+    EXPECT_EQ(str_from_hex_str("de ad\tbe ef"), "\xde\xad\xbe\xef");
+
+    // Invalid characters inside a vector block and in the tail
+    std::string digits(64, '0');
+    for (size_t position: {0, 5, 31, 32, 63}) {
+        for (char invalid: {'g', 'G', '/', ':', '@', '`', '\x10', '\x80'}) {
+            std::string bad = digits;
+            bad[position] = invalid;
+            EXPECT_THROW(str_from_hex_str(bad), std::runtime_error) << position << " " << int(invalid);
+        }
+    }
+}
+
+TEST_F(UtilsTest, base64_round_trip) {
+    for (size_t length = 0; length <= 200; ++length) {
+        std::string input = random_bytes(length);
+        std::string encoded = base64_encode(input);
+        EXPECT_EQ(encoded, reference_base64(input)) << "length = " << length;
+        EXPECT_EQ(base64_decode(encoded), input) << "length = " << length;
+    }
+}
+
+TEST_F(UtilsTest, base64_decode) {
+    EXPECT_EQ(base64_decode("aGVsbG8="), "hello");
+    EXPECT_EQ(base64_decode("aGVsbG8"), "hello");
+    EXPECT_EQ(base64_decode("aGVsbA=="), "hell");
+    EXPECT_EQ(base64_decode(""), "");
+    EXPECT_THROW(base64_decode("aGVsb"), std::runtime_error);
+
+    std::string letters(64, 'A');
+    for (size_t position: {0, 17, 40, 63}) {
+        for (char invalid: {'-', '_', '.', '\xff'}) {
+            std::string bad = letters;
+            bad[position] = invalid;
+            EXPECT_THROW(base64_decode(bad), std::runtime_error) << position << " " << int(invalid);
+        }
+    }
+}
+
+// Feeds the input in chunks of the given size
+template <typename Codec>
+static std::string run_chunked(Codec &codec, const std::string &input, size_t chunk_size) {
+    std::string result;
+    for (size_t i = 0; i < input.size(); i += chunk_size) {
+        result += codec.update(std::string_view(input).substr(i, chunk_size));
+    }
+    return result + codec.finish();
+}
+
+TEST_F(UtilsTest, base64_streaming) {
+    std::string input = random_bytes(1000);
+    std::string encoded = base64_encode(input);
+    for (size_t chunk_size: {1, 2, 3, 4, 5, 7, 64, 999, 1000, 5000}) {
+        Base64Encoder encoder;
+        EXPECT_EQ(run_chunked(encoder, input, chunk_size), encoded) << chunk_size;
+        Base64Decoder decoder;
+        EXPECT_EQ(run_chunked(decoder, encoded, chunk_size), input) << chunk_size;
+    }
+}
+
+TEST_F(UtilsTest, base64_streaming_lines) {
+    std::string input = random_bytes(200);
+    Base64Encoder encoder(76);
+    std::string encoded = run_chunked(encoder, input, 10);
+    EXPECT_EQ(encoded.size(), 268u + 4);
+    EXPECT_EQ(encoded[76], '\n');
+    EXPECT_EQ(encoded[153], '\n');
+    EXPECT_EQ(encoded.back(), '\n');
+
+    // Newlines and other characters outside the alphabet are skipped
+    Base64Decoder decoder;
+    EXPECT_EQ(run_chunked(decoder, encoded, 13), input);
+
+    Base64Encoder exact(4);
+    EXPECT_EQ(run_chunked(exact, "abcdef", 1), "YWJj\nZGVm\n");
+    Base64Encoder empty(76);
+    EXPECT_EQ(run_chunked(empty, "", 1), "");
+}
+
+TEST_F(UtilsTest, base64_streaming_padding) {
+    Base64Decoder leading;
+    EXPECT_EQ(run_chunked(leading, "==aGVs\nbG8=IGlnbm9yZWQ=", 3), "hello");
+
+    Base64Decoder truncated;
+    EXPECT_EQ(truncated.update("aGVsb"), "hel");
+    EXPECT_THROW(truncated.finish(), std::runtime_error);
+}
+
+TEST_F(UtilsTest, repeat) {
+    for (size_t count = 0; count <= 70; ++count) {
+        std::string expected;
+        for (size_t i = 0; i < count; ++i) {
+            expected += "abc";
+        }
+        EXPECT_EQ(repeat("abc", count), expected) << count;
+    }
+    EXPECT_EQ(repeat("x", 1000000), std::string(1000000, 'x'));
+    EXPECT_EQ(repeat("abc", -5), "");
+    EXPECT_EQ(repeat("", 1000), "");
+
+    EXPECT_EQ(repeated_size(3, 4, 100), 12u);
+    EXPECT_EQ(repeated_size(3, -4, 100), 0u);
+    EXPECT_THROW(repeated_size(3, 34, 100), std::runtime_error);
+    EXPECT_THROW(repeat("ab", INT64_MAX), std::runtime_error);
+    // Fits in max_size(), but can't be allocated: MemoryError, not std::bad_alloc
+    EXPECT_THROW(repeat("x", int64_t(1) << 62), std::runtime_error);
+}
+
+TEST_F(UtilsTest, repeat_list) {
+    auto pair = std::make_shared<ListVariable>(ListType{NEW_INT(1), NEW_INT(2)});
+    EXPECT_EQ(VAR_TO_LIST(pair->mul(NEW_INT(3))).size(), 6u);
+    EXPECT_EQ(VAR_TO_LIST(pair->mul(NEW_INT(-1))).size(), 0u);
+    // Nothing to copy: returns at once instead of looping count times
+    auto empty = std::make_shared<ListVariable>();
+    EXPECT_EQ(VAR_TO_LIST(empty->mul(NEW_INT(1000000000000000000))).size(), 0u);
+    EXPECT_THROW(pair->mul(NEW_INT(int64_t(1) << 60)), std::runtime_error);
+}
+
+TEST_F(UtilsTest, ascii_only) {
+    std::string text(100, 'a');
+    EXPECT_TRUE(ascii_only(""));
+    EXPECT_TRUE(ascii_only(text));
+    for (size_t position: {0, 7, 8, 63, 99}) {
+        std::string bad = text;
+        bad[position] = '\x80';
+        EXPECT_FALSE(ascii_only(bad)) << position;
+    }
+}
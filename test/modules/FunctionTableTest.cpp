@@ -0,0 +1,54 @@
+#include "modules/Module.h"
+
+#include <gtest/gtest.h>
+
+using namespace MiniPython;
+
+class FunctionTableTest: public testing::Test {
+};
+
+static Variable first(const InstructionParams &params, Scope *scope) {
+    return NEW_INT(1);
+}
+
+static Variable second(const InstructionParams &params, Scope *scope) {
+    return NEW_INT(2);
+}
+
+static constexpr StaticFunctionTable test_functions({
+    {"first", first},
+    {"second", second},
+    {"also_first", first},
+});
+
+class TestModule: public BuiltinModule {
+public:
+    TestModule(): BuiltinModule(test_functions) {}
+};
+
+TEST_F(FunctionTableTest, find) {
+    FunctionTable table = test_functions;
+    EXPECT_EQ(table.size(), 3);
+    EXPECT_EQ(table.find("first"), 0);
+    EXPECT_EQ(table.find("second"), 1);
+    EXPECT_EQ(table.find("also_first"), 2);
+    EXPECT_EQ(table.find("third"), -1);
+    EXPECT_EQ(table.find(""), -1);
+}
+
+TEST_F(FunctionTableTest, module_attributes) {
+    TestModule module;
+    EXPECT_TRUE(module.has_attr("second"));
+    EXPECT_FALSE(module.has_attr("third"));
+
+    auto function = module.get_attr("second");
+    EXPECT_EQ(function->get_type(), VariableType::FUNCTION);
+    // The FunctionVariable is created once
+    EXPECT_EQ(function, module.get_attr("second"));
+
+    module.set_attr("second", NEW_INT(5));
+    EXPECT_EQ(VAR_TO_INT(module.get_attr("second")), 5);
+
+    module.set_attr("third", NEW_INT(3));
+    EXPECT_EQ(VAR_TO_INT(module.get_attr("third")), 3);
+}
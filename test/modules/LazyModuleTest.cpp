@@ -0,0 +1,42 @@
+#include "modules/Module.h"
+
+#include <gtest/gtest.h>
+
+using namespace MiniPython;
+
+class LazyModuleTest: public testing::Test {
+};
+
+static int modules_created = 0;
+
+class CountingModule: public ModuleVariable {
+public:
+    CountingModule() {
+        modules_created++;
+        set_attr("answer", NEW_INT(42));
+    }
+};
+
+TEST_F(LazyModuleTest, created_on_first_access) {
+    modules_created = 0;
+
+    auto module = std::make_shared<LazyModule>(make_module<CountingModule>);
+    EXPECT_EQ(modules_created, 0);
+    EXPECT_FALSE(module->is_loaded());
+
+    EXPECT_EQ(VAR_TO_INT(module->get_attr("answer")), 42);
+    EXPECT_EQ(modules_created, 1);
+    EXPECT_TRUE(module->is_loaded());
+
+    EXPECT_TRUE(module->has_attr("answer"));
+    EXPECT_FALSE(module->has_attr("question"));
+    EXPECT_EQ(modules_created, 1);
+}
+
+TEST_F(LazyModuleTest, reset_does_not_create_module) {
+    modules_created = 0;
+
+    auto module = std::make_shared<LazyModule>(make_module<CountingModule>);
+    module->reset();
+    EXPECT_EQ(modules_created, 0);
+}
@@ -0,0 +1,57 @@
+#include "modules/Module.h"
+#include "src/Scope.h"
+#include "variable/File.h"
+#include "test/TestUtils.h"
+
+#include <gtest/gtest.h>
+
+#include <cstdio>
+#include <fstream>
+#include <sstream>
+
+using namespace MiniPython;
+
+class Base64ModuleTest: public ModuleFixture<base64> {
+protected:
+    static std::string read_file(const std::string &filename) {
+        std::ifstream file(filename, std::ios::binary);
+        std::stringstream content;
+        content << file.rdbuf();
+        return content.str();
+    }
+};
+
+TEST_F(Base64ModuleTest, encode_and_decode_files) {
+    std::string original = testing::TempDir() + "base64_test.bin";
+    std::string encoded = testing::TempDir() + "base64_test.b64";
+    std::string decoded = testing::TempDir() + "base64_test.out";
+
+    // Larger than one stream chunk and not a multiple of 3
+    std::string data;
+    for (size_t i = 0; i < 100000; ++i) {
+        data += static_cast<char>(i * 7 % 251);
+    }
+    std::ofstream(original, std::ios::binary) << data;
+
+    {
+        Variable in = std::make_shared<FileVariable>(original, "rb");
+        Variable out = std::make_shared<FileVariable>(encoded, "wb");
+        call("encode", in, out);
+    }
+    EXPECT_EQ(read_file(encoded), VAR_TO_BYTES(call("encodebytes", NEW_BYTES(data))));
+
+    {
+        Variable in = std::make_shared<FileVariable>(encoded, "rb");
+        Variable out = std::make_shared<FileVariable>(decoded, "wb");
+        call("decode", in, out);
+    }
+    EXPECT_EQ(read_file(decoded), data);
+
+    Variable text = std::make_shared<FileVariable>(original, "r");
+    Variable out = std::make_shared<FileVariable>(decoded, "wb");
+    EXPECT_THROW(call("encode", text, out), std::runtime_error);
+
+    std::remove(original.c_str());
+    std::remove(encoded.c_str());
+    std::remove(decoded.c_str());
+}
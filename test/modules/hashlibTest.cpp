@@ -0,0 +1,44 @@
+#include "modules/Module.h"
+#include "src/Scope.h"
+#include "variable/Hash.h"
+#include "test/TestUtils.h"
+
+#include <gtest/gtest.h>
+
+using namespace MiniPython;
+
+class HashlibModuleTest: public ModuleFixture<hashlib> {
+};
+
+TEST_F(HashlibModuleTest, hexdigest) {
+    auto hash = call("sha256", NEW_BYTES("abc"));
+    EXPECT_EQ(hash->get_type(), VariableType::HASH);
+    EXPECT_EQ(VAR_TO_STR(call_method(hash, "hexdigest")),
+              "ba7816bf8f01cfea414140de5dae2223b00361a396177a9cb410ff61f20015ad");
+    EXPECT_EQ(VAR_TO_STR(hash->get_attr("name")), "sha256");
+    EXPECT_EQ(VAR_TO_INT(hash->get_attr("digest_size")), 32);
+    EXPECT_EQ(VAR_TO_INT(hash->get_attr("block_size")), 64);
+}
+
+TEST_F(HashlibModuleTest, update_and_copy) {
+    auto hash = call("md5", NEW_BYTES("a"));
+    auto copy = call_method(hash, "copy");
+    Variable rest = NEW_BYTES("bc");
+    call_method(hash, "update", {std::make_shared<Instruction>(rest)});
+    EXPECT_EQ(VAR_TO_STR(call_method(hash, "hexdigest")), "900150983cd24fb0d6963f7d28e17f72");
+    EXPECT_EQ(VAR_TO_STR(call_method(copy, "hexdigest")), "0cc175b9c0f1b6a831c399e269772661");
+    EXPECT_EQ(call_method(copy, "digest")->get_type(), VariableType::BYTES);
+}
+
+TEST_F(HashlibModuleTest, new_by_name) {
+    auto hash = call("new", NEW_STRING("sha1"), NEW_BYTES("abc"));
+    EXPECT_EQ(VAR_TO_STR(call_method(hash, "hexdigest")), "a9993e364706816aba3e25717850c26c9cd0d89d");
+    EXPECT_THROW(call("new", NEW_STRING("whirlpool")), std::runtime_error);
+}
+
+TEST_F(HashlibModuleTest, buffer_objects) {
+    auto array = std::make_shared<ArrayVariable>(NEW_STRING("B"), ListType({NEW_INT(97), NEW_INT(98), NEW_INT(99)}));
+    auto hash = call("blake2b", std::make_shared<MemoryView>(array));
+    EXPECT_EQ(VAR_TO_STR(call_method(hash, "hexdigest")).substr(0, 16), "ba80a53f981c4d0d");
+    EXPECT_THROW(call("sha256", NEW_STRING("text")), std::runtime_error);
+}
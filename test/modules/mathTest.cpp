@@ -0,0 +1,68 @@
+#include "modules/Module.h"
+#include "src/Scope.h"
+#include "test/TestUtils.h"
+
+#include <gtest/gtest.h>
+
+#include <cmath>
+
+using namespace MiniPython;
+
+class MathModuleTest: public ModuleFixture<math> {
+protected:
+    std::string error(const std::string &name, Variable param) {
+        try {
+            call(name, param);
+        }
+        catch (const std::runtime_error &e) {
+            return e.what();
+        }
+        return "";
+    }
+};
+
+TEST_F(MathModuleTest, scalar_stays_float) {
+    auto result = call("sqrt", NEW_INT(4));
+    EXPECT_EQ(result->get_type(), VariableType::FLOAT);
+    EXPECT_EQ(result->to_str(), "2.0");
+}
+
+TEST_F(MathModuleTest, list_gives_array) {
+    auto result = call("sqrt", NEW_LIST(ListType({NEW_INT(1), NEW_FLOAT(6.25), TRUE, NEW_INT(9)})));
+    EXPECT_EQ(result->get_type(), VariableType::ARRAY);
+    EXPECT_EQ(result->to_str(), "array('d', [1.0, 2.5, 1.0, 3.0])");
+}
+
+TEST_F(MathModuleTest, array_gives_array) {
+    auto input = std::make_shared<ArrayVariable>(NEW_STRING("i"), ListType({NEW_INT(0), NEW_INT(0), NEW_INT(0), NEW_INT(0), NEW_INT(0)}));
+    EXPECT_EQ(call("exp", input)->to_str(), "array('d', [1.0, 1.0, 1.0, 1.0, 1.0])");
+    EXPECT_EQ(call("sin", input)->to_str(), "array('d', [0.0, 0.0, 0.0, 0.0, 0.0])");
+    EXPECT_EQ(call("cos", input)->to_str(), "array('d', [1.0, 1.0, 1.0, 1.0, 1.0])");
+}
+
+TEST_F(MathModuleTest, empty_list) {
+    EXPECT_EQ(call("log", NEW_LIST(ListType()))->to_str(), "array('d')");
+}
+
+TEST_F(MathModuleTest, fsum_is_exact) {
+    EXPECT_EQ(call("fsum", NEW_LIST(ListType(10, NEW_FLOAT(0.1))))->to_str(), "1.0");
+    EXPECT_EQ(call("fsum", NEW_LIST(ListType({NEW_FLOAT(1e100), NEW_FLOAT(1.0), NEW_FLOAT(-1e100)})))->to_str(), "1.0");
+}
+
+TEST_F(MathModuleTest, fsum_errors) {
+    EXPECT_EQ(error("fsum", NEW_LIST(ListType({NEW_FLOAT(INFINITY), NEW_FLOAT(-INFINITY)}))),
+              "ValueError: -inf + inf in fsum");
+    EXPECT_EQ(error("fsum", NEW_LIST(ListType({NEW_FLOAT(1e308), NEW_FLOAT(1e308)}))),
+              "OverflowError: intermediate overflow in fsum");
+    EXPECT_EQ(call("fsum", NEW_LIST(ListType({NEW_FLOAT(1e308), NEW_FLOAT(INFINITY)})))->to_str(), "inf");
+}
+
+TEST_F(MathModuleTest, big_ints) {
+    EXPECT_EQ(call("sqrt", NEW_INT(BigInt::pow(2, 100)))->to_str(), "1125899906842624.0");
+    EXPECT_EQ(call("floor", NEW_INT(BigInt::pow(2, 70)))->to_str(), "1180591620717411303424");
+    EXPECT_EQ(call("isqrt", NEW_INT(BigInt::pow(2, 80)))->to_str(), "1099511627776");
+    EXPECT_EQ(call("isqrt", NEW_INT(BigInt::pow(10, 30) - 1))->to_str(), "999999999999999");
+    EXPECT_EQ(call("isqrt", NEW_INT(INT64_MAX))->to_str(), "3037000499");
+    EXPECT_EQ(call("ceil", NEW_FLOAT(1e20))->to_str(), "100000000000000000000");
+    EXPECT_EQ(call("trunc", NEW_FLOAT(-2.5))->to_str(), "-2");
+}
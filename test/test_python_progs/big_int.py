@@ -0,0 +1,26 @@
+a = 3 ** 3000
+b = 7 ** 1500
+c = 11 ** 700
+d = 0 - a
+print(a * b)
+print(a // b)
+print(a % b)
+print(a // c)
+print(a % c)
+print(d // c)
+print(d % c)
+print((a * b) // (a + 1))
+print((a * b) % (b * c + 12345))
+print((a * a) // (b * b * c))
+print(10 ** 1000 - 1)
+print(9223372036854775807 + 1)
+print(0 - 9223372036854775807 - 2)
+print(4294967296 * 4294967296)
+print(2 ** 64 // 3)
+print(0x123456789abcdef0123456789)
+print(0o777777777777777777777777777)
+print(123456789012345678901234567890123456789 * 987654321098765432109876543210987654321)
+print(2 ** 100 / 2 ** 90)
+import math
+print(math.factorial(25))
+print(math.factorial(600))
@@ -0,0 +1,13 @@
+import binascii
+import base64
+import array
+
+print(binascii.hexlify(memoryview(b'abc')))
+print(binascii.b2a_base64(memoryview(b'hello')))
+print(binascii.unhexlify('6162'))
+print(binascii.a2b_base64('aGVsbG8='))
+print(base64.encodebytes(memoryview(b'xyz')))
+print(base64.decodebytes(memoryview(b'eHl6')))
+print(binascii.hexlify(array.array('h', b'\x01\x02\x03\x04')))
+print(len(memoryview(b'abcd')))
+print(len(b'abcd'))
@@ -0,0 +1,35 @@
+print(0.1)
+print(0.1 + 0.2)
+print(1.0)
+print(0.0)
+print(0.0 - 0.0)
+print(123.456)
+print(2 ** 0.5)
+print(1 / 3)
+print(2 / 3)
+print(100.0)
+print(1e15)
+print(1e16)
+print(1.5e16)
+print(123456789012345678.0)
+print(0.0001)
+print(0.00001)
+print(0.000123)
+print(1.5e-7)
+print(1e300 * 10)
+print(5e-324)
+print(1.7976931348623157e308)
+print(1_000.5)
+print(3.14e2)
+print(2 ** 100 + 0.5)
+print(1e400)
+print(7.0 / 2)
+print("%f" % 3.14159)
+print("%.2f" % 3.14159)
+print("%.0f" % 2.5)
+print("%.3f" % 2)
+print("%d" % 42)
+print("%d" % 3.99)
+print("%d" % 2 ** 70)
+print("%+d" % 5)
+print("%+.1f" % 0.25)
@@ -0,0 +1,74 @@
+n = 1234567
+x = 0 - 3.14159
+name = 'mini'
+print(format(n, ','))
+print(format(n, '_'))
+print(format(n, '>12,'))
+print(format(n, '012,'))
+print(format(n, '+'))
+print(format(n, ' '))
+print(format(0 - n, '015_'))
+print(format(255, '#x'))
+print(format(255, '#010b'))
+print(format(255, 'X'))
+print(format(255, '#o'))
+print(format(65, 'c'))
+print(format(n, 'e'))
+print(format(n, '.2f'))
+print(format(x, '.2f'))
+print(format(x, '10.3f'))
+print(format(x, '<10.1f'))
+print(format(x, '^12.2f'))
+print(format(x, '=+12.2f'))
+print(format(x, '012.3f'))
+print(format(x, 'e'))
+print(format(x, '.3E'))
+print(format(x, 'g'))
+print(format(0.00001234, 'g'))
+print(format(123456789.0, 'g'))
+print(format(1.0, '.3'))
+print(format(123.0, '.2'))
+print(format(123.456, '.3'))
+print(format(1.5, '.0'))
+print(format(12.0, '.3'))
+print(format(99.96, '.3'))
+print(format(9.996, '.3'))
+print(format(0.0000123, '.3'))
+print(format(1e20, '.5'))
+print(format(x, '#.3'))
+y = 123.456
+print(f'{y:.3}|{y:.4}|{y:.10}')
+print(format(x, ''))
+print(format(0.25, '.1%'))
+print(format(1234567.891, ',.2f'))
+print(format(1.0, '#.0f'))
+print(format(name, '>8'))
+print(format(name, '*^9'))
+print(format(name, '.2'))
+print(format(name, '05'))
+print(format(True, ''))
+print(format(True, '>5'))
+print(format(False, 'd'))
+t = '{} has {:,} rows, {:.1%} done'
+print(t.format(name, n, 0.5))
+u = '{0}-{1}-{0}'
+print(u.format('a', 'b'))
+v = '{who:>6}|{n:^7}|'
+print(v.format(who=name, n=42))
+w = '{{literal}} {}'
+print(w.format(1))
+print(f'{n:,}')
+print(f'{x:+.2f}|{name:>6}|{n:_x}')
+print(f'[{n:>10}]')
+print('%05.1f' % x)
+print('%-6s|' % name)
+print('%+05d' % 42)
+big = 2 ** 70 + 255
+print(format(big, 'x'))
+print(format(big, '#o'))
+print(format(big, '_b'))
+print(f'{big:>24X}')
+r = '[{!r:>8}|{!s}|{!a}]'
+print(r.format(name, n, 'é'))
+nested = '[{:{}}|{:>{}.{}f}]'
+print(nested.format(name, 8, x, 9, 3))
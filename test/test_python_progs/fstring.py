@@ -0,0 +1,14 @@
+name = 'world'
+count = 3
+print(f'hello {name}')
+print(f"{count} items, {count * 2} halves")
+print(f'{{literal}} {name}')
+print(f'{name.upper()}!')
+print(f'{count + 1}{count - 1}')
+print(f'no placeholders')
+price = 2.5
+print(f'total: {price * count}')
+width = 9
+digits = 3
+print(f'[{3.14159:>{width}.{digits}f}]')
+print(f'[{width:0{digits}}]')
@@ -0,0 +1,7 @@
+import os
+print(hasattr(os, 'getcwd'))
+print(hasattr(os, 'no_such_name'))
+print(getattr(os, 'no_such_name', 'default'))
+text = 'ab'
+upper = (getattr(text, 'upper'))
+print(upper())
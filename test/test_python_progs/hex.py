@@ -1,3 +1,6 @@
 print(hex(0))
 print(hex(255))
 print(hex(-42))
+print(hex(True))
+print(hex(2**64))
+print(hex(0 - 2**100 - 255))
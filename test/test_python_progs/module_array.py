@@ -1,3 +1,7 @@
 import array
 
 print(array.array('i'))
+print(array.array('d', b'\x00\x00\x00\x00\x00\x00\xf0?\x00\x00\x00\x00\x00\x00\x04@'))
+print(array.array('i', b'\x01\x00\x00\x00\xfe\xff\xff\xff'))
+print(array.array('B', b'abc'))
+print(array.array('Q', b'\xff\xff\xff\xff\xff\xff\xff\xff'))
@@ -68,3 +68,14 @@ print(binascii.a2b_base64('AAAB'))
 
 
 # b2a_base64
+
+# crc32, crc_hqx
+print(binascii.crc32(b''))
+print(binascii.crc32(b'123456789'))
+print(binascii.crc32(b'hello world', 12345))
+print(binascii.crc32(b'The quick brown fox jumps over the lazy dog. The quick brown fox jumps over the lazy dog.'))
+print(binascii.crc32(b'bytes-like', 4294967295))
+print(binascii.crc_hqx(b'', 0))
+print(binascii.crc_hqx(b'123456789', 0))
+print(binascii.crc_hqx(b'123456789', 65535))
+print(binascii.crc_hqx(b'The quick brown fox jumps over the lazy dog', 7))
@@ -0,0 +1,9 @@
+import math
+
+print(math.sin(0.5))
+print(math.sin(-3))
+print(math.tan(1.0))
+print(math.cos(2))
+print(math.sqrt(2))
+print(math.exp(1.5))
+print(math.log(10))
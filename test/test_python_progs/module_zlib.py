@@ -0,0 +1,9 @@
+import zlib
+
+print(zlib.adler32(b''))
+print(zlib.adler32(b'Wikipedia'))
+print(zlib.adler32(b'hello world', 12345))
+print(zlib.adler32(b'', 4294967295))
+print(zlib.adler32(b'The quick brown fox jumps over the lazy dog. The quick brown fox jumps over the lazy dog.'))
+print(zlib.crc32(b'123456789'))
+print(zlib.crc32(b'The quick brown fox jumps over the lazy dog. The quick brown fox jumps over the lazy dog.', 99))
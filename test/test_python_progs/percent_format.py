@@ -0,0 +1,57 @@
+name = 'disk'
+used = 42
+ratio = 0.8765
+print('%s: 100%%' % name)
+print('[%5d]' % used)
+print('[%-5d]' % used)
+print('[%05d]' % used)
+print('[%+d]' % used)
+print('[% d]' % used)
+print('[%05d]' % (-used))
+print('[%x]' % 255)
+print('[%#X]' % 255)
+print('[%#06x]' % 255)
+print('[%#o]' % 8)
+print('[%.2f]' % ratio)
+print('[%8.3f]' % ratio)
+print('[%-8.1f]' % ratio)
+print('[%08.2f]' % (-ratio))
+print('[%+.1f]' % ratio)
+print('[%10s]' % name)
+print('[%-10s]' % name)
+print('[%.2s]' % name)
+print('%s' % ratio)
+print('%s' % True)
+print('%d' % 3.99)
+print('%i items' % used)
+big = 2 ** 70
+print('%d' % big)
+print('%f' % used)
+print(b'key=%s' % b'value')
+print(b'%5s|' % b'ab')
+print(b'%d' % used)
+print('%x' % big)
+print('%#X' % big)
+print('%o' % big)
+print('%x' % (0 - big))
+print('%d' % (0 - 0.5))
+print('%i' % (0 - 0.25))
+print('[%e]' % ratio)
+print('[%.2E]' % big)
+print('[%g]' % ratio)
+print('[%G]' % 1e-10)
+print('[%10.3g]' % (-ratio))
+print('[%c]' % 65)
+print('[%c]' % 'z')
+print('[%3c]' % 'é')
+print('%r' % name)
+print('%r' % 'it\'s')
+print('%r' % used)
+print('%r' % ratio)
+print('[%.3r]' % name)
+print('[%.3d]' % used)
+print('[%.3d]' % (0 - used))
+print('[%.4x]' % 255)
+print('[%#.4x]' % 255)
+print('[%08.3d]' % used)
+print('[%.25d]' % big)
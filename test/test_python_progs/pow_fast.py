@@ -0,0 +1,28 @@
+print(2 ** 62)
+print(2 ** 63)
+print(2 ** 64)
+print(-2 ** 63)
+print((0 - 2) ** 63)
+print((0 - 3) ** 41)
+print(7 ** 0)
+print(0 ** 0)
+print(10 ** 4000 // 10 ** 3990)
+print(3 ** 5000 % 1000000007)
+print(pow(2, 10 ** 18, 1000000007))
+print(pow(3, 10 ** 30, 18446744073709551557))
+print(pow(123456789, 987654321, 2 ** 200))
+print(pow(5, 3 ** 150, 11 ** 300 + 2))
+print(pow(7, 3 ** 200, 13 ** 120 * 2 + 1))
+print(pow(3, 0 - 1, 7))
+print(pow(38, 0 - 1, 97))
+print(pow(3, 5, 0 - 7))
+print(pow(0 - 3, 5, 7))
+print(pow(2, 100, 1))
+print(pow(True, 5))
+print(True ** 100)
+print(False ** 0)
+print(False ** 3)
+print(True ** True)
+print(2.5 ** 2)
+print(2.0 ** 10)
+print(4.0 ** 0.5)
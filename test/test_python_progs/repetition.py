@@ -0,0 +1,7 @@
+print('ab' * 5)
+print('ab' * 0)
+print('' * 100)
+print('xyz' * True)
+print(len('x' * 100000))
+print(b'\x00\x01' * 3)
+print(len(b'pad' * 33333))
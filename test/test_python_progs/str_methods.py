@@ -0,0 +1,72 @@
+s = 'Hello World 42'
+print(s.upper())
+print(s.lower())
+print(s.swapcase())
+print(s.capitalize())
+print(s.isalpha())
+print(s.isalnum())
+print(s.islower())
+print(s.isascii())
+w = 'word'
+print(w.isalpha())
+print(w.islower())
+print(w.isupper())
+n = '0123456789'
+print(n.isdigit())
+print(n.isdecimal())
+print(n.isalpha())
+sp = ' \t\n'
+print(sp.isspace())
+e = ''
+print(e.isspace())
+print(e.isalpha())
+print(e.upper())
+long = 'The Quick Brown Fox Jumps Over The Lazy Dog, 0123456789 times!'
+print(long.upper())
+print(long.lower())
+print(long.swapcase())
+u = 'École Été ÜBER strasse'
+print(u.lower())
+print(u.upper())
+print(u.swapcase())
+print(u.isascii())
+print(u.isalpha())
+a = 'Ünïcödé'
+print(a.isalpha())
+print(a.islower())
+b = b'MiXeD \xff bytes'
+print(b.lower())
+print(b.upper())
+print(b.isalpha())
+fs = '\x1c\x1d\x1e\x1f '
+print(fs.isspace())
+fb = b'\x1c'
+print(fb.isspace())
+padded = '\x1fab\x1c'
+print(len(padded.strip()))
+padded_bytes = b'\x1fab\x1c'
+print(len(padded_bytes.strip()))
+t = 'ǅ'
+print(t.isupper())
+print(t.islower())
+print(t.isalpha())
+print(t.swapcase())
+dz = 'ǆa'
+print(dz.capitalize())
+dz_upper = 'ǄA'
+print(dz_upper.capitalize())
+d = '²'
+print(d.isdigit())
+print(d.isdecimal())
+print(d.isnumeric())
+d = '٣'
+print(d.isdecimal())
+print(d.isalpha())
+print(d.isalnum())
+d = '½'
+print(d.isnumeric())
+print(d.isdigit())
+print(d.isalnum())
+d = '三'
+print(d.isnumeric())
+print(d.isalpha())
@@ -0,0 +1,22 @@
+s = 'the quick brown fox jumps over the lazy dog'
+print(s.find('fox'))
+print(s.find('the', 1))
+print(s.find('the', -10))
+print(s.rfind('the'))
+print(s.find('cat'))
+print(s.find('', 100))
+print(s.count('o'))
+print(s.count('the'))
+print(s.count(''))
+print(s.replace('the', 'a'))
+print(s.replace('o', '0', 2))
+print(s.replace('', '-', 3))
+print(s.index('dog'))
+print('fox' in s)
+print('cat' in s)
+print(s.isdigit())
+n = 'a.b.c'
+print(n.rfind('.', 0, 3))
+print(n.count('.', 2))
+print(n.rindex('.'))
+print(n.replace('.', ''))
@@ -0,0 +1,47 @@
+s = '  \t padded line \n'
+print(s.strip())
+print(len(s.strip()))
+print(s.lstrip())
+print(len(s.lstrip()))
+print(s.rstrip())
+print(len(s.rstrip()))
+f = 'xxyfieldyx'
+print(f.strip('xy'))
+print(f.lstrip('xy'))
+print(f.rstrip('xy'))
+print(f.strip('z'))
+e = '   '
+print(e.strip())
+print(len(e.strip()))
+u = ' café　'
+print(u.strip())
+print(u.strip(' 　é'))
+print(len(u.strip(' 　é')))
+n = 'report.csv'
+print(n.removesuffix('.csv'))
+print(n.removeprefix('rep'))
+print(n.removeprefix('csv'))
+print(n.startswith('rep'))
+print(n.startswith('port', 2))
+print(n.endswith('.csv'))
+print(n.endswith('rep', 0, 3))
+print(n.endswith('report.csv.'))
+w = 'ab'
+print(w.ljust(5))
+print(len(w.ljust(5)))
+print(w.rjust(5, '*'))
+print(w.center(5, '-'))
+print(w.center(6, '-'))
+print(w.ljust(1))
+print(w.center(5, '·'))
+z = '-42'
+print(z.zfill(6))
+print(z.zfill(2))
+p = '7'
+print(p.zfill(3))
+b = b'  bytes \n'
+print(b.strip())
+print(b.rjust(12, b'.'))
+c = b'--x--'
+print(c.strip(b'-'))
+print(c.zfill(7))
@@ -0,0 +1,20 @@
+s = ''
+s = s + 'ab'
+s = s + 'cd'
+s = s + 'ef'
+print(s)
+
+t = s
+s = s + 'g'
+print(t)
+print(s)
+
+u = 'q'
+u = u + u
+u = u + u
+print(u)
+
+b = b'x'
+b = b + b'yz'
+b = b + b'!'
+print(b)
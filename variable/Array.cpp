@@ -1,45 +1,416 @@
 #include "Variable.h"
 #include "RaiseException.h"
+#include "Utils.h"
 
-#include <map>
+#include <cstring>
+#include <limits>
+#include <type_traits>
 
 namespace MiniPython {
 
-const std::map<std::string, int> typecode_sizes = {
-    {"b", 1},
-    {"B", 1},
-    {"u", 2},
-    {"w", 4},
-    {"h", 2},
-    {"H", 2},
-    {"i", 2},
-    {"I", 2},
-    {"l", 4},
-    {"L", 4},
-    {"q", 8},
-    {"Q", 8},
-    {"f", 4},
-    {"d", 8},
+extern Variable execute_instruction(std::shared_ptr<Instruction> instr, Scope *scope);
+
+#define VAR(i) execute_instruction(params[i], scope)
+#define ARRAY(i) std::dynamic_pointer_cast<ArrayVariable>(VAR(i))
+
+/*
+ * Conversions between boxed values and packed items
+ */
+
+template<typename T>
+static T to_integer(const Variable &value) {
+    if (value->get_type() != VariableType::INT && value->get_type() != VariableType::BOOL) {
+        raise_exception("TypeError", "'" + value->get_class_name() + "' object cannot be interpreted as an integer");
+    }
+
+    if (value->get_type() == VariableType::INT && std::dynamic_pointer_cast<IntVariable>(value)->is_big()) {
+        auto big = std::dynamic_pointer_cast<IntVariable>(value)->to_big();
+        if constexpr (std::is_same_v<T, uint64_t>) {
+            if (!big.is_negative() && big.bit_length() <= 64) {
+                return big.to_int64();
+            }
+        }
+        raise_exception("OverflowError", "array item is out of range");
+    }
+
+    IntType result = value->to_int();
+    if constexpr (std::is_signed_v<T>) {
+        if (result < std::numeric_limits<T>::min() || result > std::numeric_limits<T>::max()) {
+            raise_exception("OverflowError", "array item is out of range");
+        }
+    }
+    else {
+        if (result < 0 || static_cast<uint64_t>(result) > std::numeric_limits<T>::max()) {
+            raise_exception("OverflowError", "array item is out of range");
+        }
+    }
+    return result;
+}
+
+template<typename T>
+static Variable load_int(const char *item) {
+    T value;
+    std::memcpy(&value, item, sizeof(T));
+    if constexpr (std::is_same_v<T, uint64_t>) {
+        if (value > static_cast<uint64_t>(std::numeric_limits<IntType>::max())) {
+            return NEW_INT(BigInt(static_cast<IntType>(value >> 1)) * 2 + static_cast<IntType>(value & 1));
+        }
+    }
+    return NEW_INT(static_cast<IntType>(value));
+}
+
+template<typename T>
+static void store_int(char *item, const Variable &value) {
+    T result = to_integer<T>(value);
+    std::memcpy(item, &result, sizeof(T));
+}
+
+template<typename T>
+static Variable load_float(const char *item) {
+    T value;
+    std::memcpy(&value, item, sizeof(T));
+    return NEW_FLOAT(value);
+}
+
+template<typename T>
+static void store_float(char *item, const Variable &value) {
+    T result;
+    switch (value->get_type()) {
+    case VariableType::INT:
+        result = std::dynamic_pointer_cast<IntVariable>(value)->to_float();
+        break;
+    case VariableType::BOOL:
+        result = value->to_bool();
+        break;
+    case VariableType::FLOAT:
+        result = VAR_TO_FLOAT(value);
+        break;
+    default:
+        raise_exception("TypeError", "must be real number, not " + value->get_class_name());
+        return;
+    }
+    std::memcpy(item, &result, sizeof(T));
+}
+
+static std::string encode_utf8(char32_t ch) {
+    std::string result;
+    if (ch < 0x80) {
+        result += ch;
+    }
+    else if (ch < 0x800) {
+        result += 0xc0 | (ch >> 6);
+        result += 0x80 | (ch & 0x3f);
+    }
+    else if (ch < 0x10000) {
+        result += 0xe0 | (ch >> 12);
+        result += 0x80 | ((ch >> 6) & 0x3f);
+        result += 0x80 | (ch & 0x3f);
+    }
+    else {
+        result += 0xf0 | (ch >> 18);
+        result += 0x80 | ((ch >> 12) & 0x3f);
+        result += 0x80 | ((ch >> 6) & 0x3f);
+        result += 0x80 | (ch & 0x3f);
+    }
+    return result;
+}
+
+// The code point of a string holding a single character
+static char32_t decode_utf8_char(const std::string &str) {
+    size_t length = str.empty() ? 0 : (static_cast<unsigned char>(str[0]) < 0x80) ? 1
+                                    : (static_cast<unsigned char>(str[0]) < 0xe0) ? 2
+                                    : (static_cast<unsigned char>(str[0]) < 0xf0) ? 3 : 4;
+    if (length == 0 || str.size() != length) {
+        raise_exception("TypeError", "array item must be a unicode character");
+        return 0;
+    }
+    if (length == 1) {
+        return str[0];
+    }
+    char32_t ch = static_cast<unsigned char>(str[0]) & (0x7f >> length);
+    for (size_t i = 1; i < length; ++i) {
+        ch = (ch << 6) | (static_cast<unsigned char>(str[i]) & 0x3f);
+    }
+    return ch;
+}
+
+static Variable load_char(const char *item) {
+    char32_t ch;
+    std::memcpy(&ch, item, sizeof(ch));
+    return NEW_STRING(encode_utf8(ch));
+}
+
+static void store_char(char *item, const Variable &value) {
+    if (value->get_type() != VariableType::STRING) {
+        raise_exception("TypeError", "array item must be a unicode character, not " + value->get_class_name());
+        return;
+    }
+    char32_t ch = decode_utf8_char(VAR_TO_STR(value));
+    std::memcpy(item, &ch, sizeof(ch));
+}
+
+struct ArrayTypecode {
+    char code;
+    size_t itemsize;
+    Variable (*load)(const char *item);
+    void (*store)(char *item, const Variable &value);
+};
+
+// Sizes are those of the C types on LP64, as in CPython
+static const ArrayTypecode typecodes[] = {
+    {'b', 1, load_int<int8_t>, store_int<int8_t>},
+    {'B', 1, load_int<uint8_t>, store_int<uint8_t>},
+    {'u', 4, load_char, store_char},
+    {'w', 4, load_char, store_char},
+    {'h', 2, load_int<int16_t>, store_int<int16_t>},
+    {'H', 2, load_int<uint16_t>, store_int<uint16_t>},
+    {'i', 4, load_int<int32_t>, store_int<int32_t>},
+    {'I', 4, load_int<uint32_t>, store_int<uint32_t>},
+    {'l', 8, load_int<int64_t>, store_int<int64_t>},
+    {'L', 8, load_int<uint64_t>, store_int<uint64_t>},
+    {'q', 8, load_int<int64_t>, store_int<int64_t>},
+    {'Q', 8, load_int<uint64_t>, store_int<uint64_t>},
+    {'f', 4, load_float<float>, store_float<float>},
+    {'d', 8, load_float<double>, store_float<double>},
 };
 
-ArrayVariable::ArrayVariable(Variable typecode, ListType _list)
-    : ListVariable(_list)
+static const ArrayTypecode *find_typecode(const std::string &code) {
+    for (auto &typecode: typecodes) {
+        if (code.size() == 1 && typecode.code == code[0]) {
+            return &typecode;
+        }
+    }
+    return nullptr;
+}
+
+static bool is_float_typecode(char code) {
+    return code == 'f' || code == 'd';
+}
+
+static bool is_char_typecode(char code) {
+    return code == 'u' || code == 'w';
+}
+
+/*
+ * Methods
+ */
+
+static Variable append(const InstructionParams& params, Scope *scope) {
+    ARRAY(0)->append(VAR(1));
+    return NONE;
+}
+
+static Variable extend(const InstructionParams& params, Scope *scope) {
+    ARRAY(0)->extend(VAR(1));
+    return NONE;
+}
+
+static Variable frombytes(const InstructionParams& params, Scope *scope) {
+    auto bytes = VAR(1);
+    ARRAY(0)->frombytes(get_buffer(bytes));
+    return NONE;
+}
+
+static Variable tobytes(const InstructionParams& params, Scope *scope) {
+    return NEW_BYTES(std::string(ARRAY(0)->buffer()));
+}
+
+static Variable tolist(const InstructionParams& params, Scope *scope) {
+    return NEW_LIST(ARRAY(0)->to_list());
+}
+
+static const std::pair<const char *, FunctionType *> methods[] = {
+    {"append", append},
+    {"extend", extend},
+    {"frombytes", frombytes},
+    {"tobytes", tobytes},
+    {"tolist", tolist},
+};
+
+/*
+ * Standard Variable API
+ */
+
+ArrayVariable::ArrayVariable(Variable typecode, const ListType &initializer)
+    : type(find_typecode(typecode->to_str()))
 {
-    if (!typecode_sizes.contains(typecode->to_str())) {
+    if (!type) {
         raise_exception("ValueError", "bad typecode (must be b, B, u, h, H, i, I, l, L, q, Q, f or d)");
     }
+    code = type->code;
+    item_size = type->itemsize;
 
-    set_attr("typecode", typecode);
-    set_attr("itemsize", NEW_INT(typecode_sizes.at(typecode->to_str())));
+    buffer_data.reserve(initializer.size() * item_size);
+    for (auto &item: initializer) {
+        append(item);
+    }
+}
+
+Variable ArrayVariable::add(const Variable &other) {
+    if (other->get_type() != VariableType::ARRAY) {
+        raise_exception("TypeError", "can only append array (not \"" + other->get_class_name() + "\") to array");
+    }
+    auto result = std::make_shared<ArrayVariable>(NEW_STRING(std::string(1, code)));
+    result->buffer_data = buffer_data;
+    result->extend(other);
+    return result;
+}
+
+Variable ArrayVariable::mul(const Variable &other) {
+    if (other->get_type() != VariableType::INT && other->get_type() != VariableType::BOOL) {
+        raise_exception("TypeError", "can't multiply sequence by non-int of type '" + other->get_class_name() + "'");
+    }
+    auto result = std::make_shared<ArrayVariable>(NEW_STRING(std::string(1, code)));
+    result->buffer_data = repeat(buffer_data, other->to_int());
+    return result;
+}
+
+bool ArrayVariable::to_bool() {
+    return !buffer_data.empty();
 }
 
 std::string ArrayVariable::to_str() {
-    if (list.size()) {
-        return std::string("array('") + get_attr("typecode")->to_str() + "', " + ListVariable::to_str() + ")";
+    std::string result = std::string("array('") + code + "'";
+    if (buffer_data.empty()) {
+        return result + ")";
     }
-    else {
-        return std::string("array('") + get_attr("typecode")->to_str() + "')";
+
+    if (is_char_typecode(code)) {
+        result += ", '";
+        for (size_t i = 0; i < size(); ++i) {
+            result += get_item(i)->to_str();
+        }
+        return result + "')";
+    }
+
+    result += ", [";
+    for (size_t i = 0; i < size(); ++i) {
+        if (i != 0) {
+            result += ", ";
+        }
+        result += get_item(i)->to_str();
+    }
+    return result + "])";
+}
+
+ListType ArrayVariable::to_list() {
+    ListType result;
+    result.reserve(size());
+    for (size_t i = 0; i < size(); ++i) {
+        result.push_back(get_item(i));
+    }
+    return result;
+}
+
+bool ArrayVariable::equal(const Variable &other) {
+    if (other->get_type() != VariableType::ARRAY) {
+        return false;
+    }
+    auto other_casted = std::dynamic_pointer_cast<ArrayVariable>(other);
+    // Floats need a value comparison: 0.0 == -0.0 and nan != nan
+    if (code == other_casted->code && !is_float_typecode(code)) {
+        return buffer_data == other_casted->buffer_data;
+    }
+    if (size() != other_casted->size()) {
+        return false;
+    }
+    for (size_t i = 0; i < size(); ++i) {
+        if (!get_item(i)->equal(other_casted->get_item(i))) {
+            return false;
+        }
+    }
+    return true;
+}
+
+bool ArrayVariable::strictly_equal(const Variable &other) {
+    if (get_type() != other->get_type()) {
+        return false;
     }
+    auto other_casted = std::dynamic_pointer_cast<ArrayVariable>(other);
+    return code == other_casted->code && buffer_data == other_casted->buffer_data;
+}
+
+Variable ArrayVariable::get_attr(const Atom &name) {
+    if (name == "typecode") {
+        return NEW_STRING(std::string(1, code));
+    }
+    if (name == "itemsize") {
+        return NEW_INT(static_cast<IntType>(item_size));
+    }
+    for (auto &[method_name, method]: methods) {
+        if (name == method_name) {
+            return std::make_shared<FunctionVariable>(*method, shared_from_this());
+        }
+    }
+    return IterableVariable::get_attr(name);
+}
+
+bool ArrayVariable::has_attr(const Atom &name) {
+    if (name == "typecode" || name == "itemsize") {
+        return true;
+    }
+    for (auto &[method_name, method]: methods) {
+        if (name == method_name) {
+            return true;
+        }
+    }
+    return IterableVariable::has_attr(name);
+}
+
+Variable ArrayVariable::get_item(size_t index) {
+    if (index >= size()) {
+        raise_exception("IndexError", "array index out of range");
+    }
+    return type->load(buffer_data.data() + index * item_size);
+}
+
+void ArrayVariable::set_item(size_t index, const Variable &value) {
+    if (index >= size()) {
+        raise_exception("IndexError", "array assignment index out of range");
+    }
+    type->store(buffer_data.data() + index * item_size, value);
+}
+
+void ArrayVariable::append(const Variable &value) {
+    // Convert first, so a bad value leaves the array as it was
+    char item[sizeof(uint64_t)];
+    type->store(item, value);
+    buffer_data.append(item, item_size);
+}
+
+void ArrayVariable::extend(const Variable &values) {
+    if (values->get_type() == VariableType::ARRAY) {
+        auto other = std::dynamic_pointer_cast<ArrayVariable>(values);
+        if (other->code != code) {
+            raise_exception("TypeError", "can only extend with array of same kind");
+            return;
+        }
+        buffer_data += other->buffer_data;
+        return;
+    }
+
+    auto iterable = std::dynamic_pointer_cast<IterableVariable>(values);
+    if (!iterable) {
+        raise_exception("TypeError", "'" + values->get_class_name() + "' object is not iterable");
+        return;
+    }
+    auto items = iterable->to_list();
+    buffer_data.reserve(buffer_data.size() + items.size() * item_size);
+    for (auto &item: items) {
+        append(item);
+    }
+}
+
+void ArrayVariable::frombytes(std::string_view bytes) {
+    if (bytes.size() % item_size != 0) {
+        raise_exception("ValueError", "bytes length not a multiple of item size");
+        return;
+    }
+    buffer_data.append(bytes);
+}
+
+void ArrayVariable::resize(size_t count) {
+    buffer_data.resize(count * item_size);
 }
 
 } // namespace MiniPython
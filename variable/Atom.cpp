@@ -0,0 +1,61 @@
+#include "Atom.h"
+
+#include <memory>
+#include <mutex>
+#include <shared_mutex>
+#include <unordered_map>
+
+namespace MiniPython {
+
+Atom::Atom() {
+    static const Atom empty{std::string_view()};
+    entry = empty.entry;
+}
+
+struct Atom::Table {
+    std::shared_mutex mutex;
+    // Keys view the names of the entries, which never move
+    std::unordered_map<std::string_view, std::unique_ptr<const Entry>> entries;
+};
+
+Atom::Table &Atom::table() {
+    static Table table;
+    return table;
+}
+
+Atom::Atom(std::string_view name) {
+    if (auto found = find(name)) {
+        entry = found->entry;
+        return;
+    }
+
+    Table &atoms = table();
+    std::unique_lock lock(atoms.mutex);
+    auto it = atoms.entries.find(name);
+    if (it == atoms.entries.end()) {
+        auto created = std::make_unique<const Entry>(std::string(name), std::hash<std::string_view>()(name));
+        it = atoms.entries.emplace(created->name, std::move(created)).first;
+    }
+    entry = it->second.get();
+}
+
+std::optional<Atom> Atom::find(std::string_view name) {
+    Table &atoms = table();
+    std::shared_lock lock(atoms.mutex);
+    auto it = atoms.entries.find(name);
+    if (it == atoms.entries.end()) {
+        return std::nullopt;
+    }
+    return Atom(it->second.get());
+}
+
+Atom::Lookup::Lookup(std::string_view name): atom(&entry) {
+    if (auto found = find(name)) {
+        atom = *found;
+        return;
+    }
+    entry.name = name;
+    entry.hash = std::hash<std::string_view>()(name);
+}
+
+} // namespace MiniPython
@@ -0,0 +1,92 @@
+#pragma once
+
+#include <cstddef>
+#include <functional>
+#include <optional>
+#include <string>
+#include <string_view>
+#include <type_traits>
+
+namespace MiniPython {
+
+/**
+ * @brief Interned name: identifiers and attribute names
+ *
+ * Every distinct string is stored once in a global table together with its
+ * hash, and an Atom points at that entry. Equal names give the same pointer,
+ * so atoms compare and hash without touching the characters.
+ *
+ * Constructing an Atom looks the string up in the table, so the parser does
+ * it once per identifier and lookups at run time reuse the atom. Entries are
+ * never removed; the table is shared by all interpreters and threads. Names
+ * coming from the program's data (getattr(), eval()) are looked up with
+ * find() or Lookup, which don't add them.
+ */
+class Atom {
+public:
+    // The empty name
+    Atom();
+    Atom(std::string_view name);
+    Atom(const std::string &name): Atom(std::string_view(name)) {}
+    Atom(const char *name): Atom(std::string_view(name)) {}
+    // The atom of an already interned name
+    static std::optional<Atom> find(std::string_view name);
+
+    /*
+     * Atom of a name that may not be interned, for looking it up without
+     * adding it: the interned atom if there is one, otherwise an entry of its
+     * own that equals no other atom, so it finds nothing in attribute tables
+     * but still matches names compared as strings. Valid while this lives.
+     */
+    class Lookup;
+
+    const std::string &str() const { return entry->name; }
+    size_t hash() const { return entry->hash; }
+
+    friend bool operator==(const Atom &a, const Atom &b) {
+        return a.entry == b.entry;
+    }
+    friend bool operator!=(const Atom &a, const Atom &b) {
+        return a.entry != b.entry;
+    }
+
+    // Comparison with a plain string, without interning it
+    template<typename T, typename = std::enable_if_t<std::is_convertible_v<const T &, std::string_view>>>
+    friend bool operator==(const Atom &a, const T &b) {
+        return a.entry->name == std::string_view(b);
+    }
+
+private:
+    struct Entry {
+        std::string name;
+        size_t hash;
+    };
+
+    struct Table;
+    static Table &table();
+
+    explicit Atom(const Entry *_entry): entry(_entry) {}
+
+    const Entry *entry;
+};
+
+class Atom::Lookup {
+public:
+    Lookup(std::string_view name);
+    Lookup(const Lookup &) = delete;
+    Lookup &operator=(const Lookup &) = delete;
+
+    operator const Atom &() const { return atom; }
+private:
+    Entry entry;
+    Atom atom;
+};
+
+} // namespace MiniPython
+
+template<>
+struct std::hash<MiniPython::Atom> {
+    size_t operator()(const MiniPython::Atom &atom) const noexcept {
+        return atom.hash();
+    }
+};
@@ -0,0 +1,972 @@
+#include "BigInt.h"
+
+#include <algorithm>
+#include <cmath>
+#include <memory>
+#include <mutex>
+#include <stdexcept>
+
+namespace MiniPython {
+
+using Limb = BigInt::Limb;
+using Limbs = BigInt::Limbs;
+
+// Sizes (in limbs) from which the asymptotically faster algorithms pay off
+static constexpr size_t KARATSUBA_THRESHOLD = 32;
+static constexpr size_t TOOM3_THRESHOLD = 160;
+static constexpr size_t NEWTON_DIVISION_THRESHOLD = 64;
+static constexpr size_t DECIMAL_SPLIT_THRESHOLD = 32;
+
+// The largest power of ten that fits in a limb
+static constexpr Limb DECIMAL_BASE = 1000000000;
+static constexpr size_t DECIMAL_BASE_DIGITS = 9;
+
+// ------------------------------ Magnitudes ----------------------------------
+
+static void trim(Limbs &a) {
+    while (!a.empty() && a.back() == 0) {
+        a.pop_back();
+    }
+}
+
+static Limbs slice(const Limbs &a, size_t begin, size_t end) {
+    end = std::min(end, a.size());
+    if (begin >= end) {
+        return {};
+    }
+    Limbs result(a.begin() + begin, a.begin() + end);
+    trim(result);
+    return result;
+}
+
+static int compare_magnitudes(const Limbs &a, const Limbs &b) {
+    if (a.size() != b.size()) {
+        return a.size() < b.size() ? -1 : 1;
+    }
+    for (size_t i = a.size(); i-- > 0;) {
+        if (a[i] != b[i]) {
+            return a[i] < b[i] ? -1 : 1;
+        }
+    }
+    return 0;
+}
+
+static Limbs add_magnitudes(const Limbs &a, const Limbs &b) {
+    const Limbs &longer = a.size() >= b.size() ? a : b;
+    const Limbs &shorter = a.size() >= b.size() ? b : a;
+
+    Limbs result(longer.size() + 1);
+    uint64_t carry = 0;
+    for (size_t i = 0; i < longer.size(); ++i) {
+        carry += longer[i];
+        if (i < shorter.size()) {
+            carry += shorter[i];
+        }
+        result[i] = Limb(carry);
+        carry >>= 32;
+    }
+    result[longer.size()] = Limb(carry);
+    trim(result);
+    return result;
+}
+
+// a - b, a must not be less than b
+static Limbs sub_magnitudes(const Limbs &a, const Limbs &b) {
+    Limbs result(a.size());
+    int64_t borrow = 0;
+    for (size_t i = 0; i < a.size(); ++i) {
+        int64_t diff = int64_t(a[i]) - (i < b.size() ? b[i] : 0) - borrow;
+        result[i] = Limb(diff);
+        borrow = diff < 0 ? 1 : 0;
+    }
+    trim(result);
+    return result;
+}
+
+// result += a * B^offset, result must be long enough to hold the sum
+static void add_shifted(Limbs &result, const Limbs &a, size_t offset) {
+    uint64_t carry = 0;
+    size_t i = 0;
+    for (; i < a.size(); ++i) {
+        carry += uint64_t(result[offset + i]) + a[i];
+        result[offset + i] = Limb(carry);
+        carry >>= 32;
+    }
+    for (size_t j = offset + i; carry; ++j) {
+        carry += result[j];
+        result[j] = Limb(carry);
+        carry >>= 32;
+    }
+}
+
+static Limbs shift_left_bits(const Limbs &a, unsigned bits) {
+    Limbs result(a.size() + 1);
+    for (size_t i = 0; i < a.size(); ++i) {
+        uint64_t shifted = uint64_t(a[i]) << bits;
+        result[i] |= Limb(shifted);
+        result[i + 1] = Limb(shifted >> 32);
+    }
+    trim(result);
+    return result;
+}
+
+static Limbs shift_right_bits(const Limbs &a, unsigned bits) {
+    if (bits == 0) {
+        return a;
+    }
+    Limbs result(a.size());
+    for (size_t i = 0; i < a.size(); ++i) {
+        uint64_t high = i + 1 < a.size() ? a[i + 1] : 0;
+        result[i] = Limb(((high << 32) | a[i]) >> bits);
+    }
+    trim(result);
+    return result;
+}
+
+// a * multiplier + addend, in place
+static void mul_add_small(Limbs &a, Limb multiplier, Limb addend) {
+    uint64_t carry = addend;
+    for (auto &limb: a) {
+        carry += uint64_t(limb) * multiplier;
+        limb = Limb(carry);
+        carry >>= 32;
+    }
+    if (carry) {
+        a.push_back(Limb(carry));
+    }
+}
+
+static Limbs divmod_small(const Limbs &a, Limb divisor, Limb &remainder) {
+    Limbs quotient(a.size());
+    uint64_t rest = 0;
+    for (size_t i = a.size(); i-- > 0;) {
+        uint64_t current = (rest << 32) | a[i];
+        quotient[i] = Limb(current / divisor);
+        rest = current % divisor;
+    }
+    remainder = Limb(rest);
+    trim(quotient);
+    return quotient;
+}
+
+// ---------------------------- Multiplication --------------------------------
+
+static Limbs mul_magnitudes(const Limbs &a, const Limbs &b);
+
+static Limbs mul_schoolbook(const Limbs &a, const Limbs &b) {
+    Limbs result(a.size() + b.size());
+    for (size_t i = 0; i < a.size(); ++i) {
+        uint64_t multiplier = a[i];
+        if (multiplier == 0) {
+            continue;
+        }
+        uint64_t carry = 0;
+        for (size_t j = 0; j < b.size(); ++j) {
+            // Can't overflow: (2^32-1)^2 + 2 * (2^32-1) == 2^64-1
+            carry += multiplier * b[j] + result[i + j];
+            result[i + j] = Limb(carry);
+            carry >>= 32;
+        }
+        result[i + b.size()] = Limb(carry);
+    }
+    trim(result);
+    return result;
+}
+
+// a = a1 * B^k + a0, b = b1 * B^k + b0
+// a * b = a1*b1 * B^2k + ((a0+a1)(b0+b1) - a0*b0 - a1*b1) * B^k + a0*b0
+static Limbs mul_karatsuba(const Limbs &a, const Limbs &b) {
+    size_t k = (a.size() + 1) / 2;
+    Limbs a0 = slice(a, 0, k);
+    Limbs a1 = slice(a, k, a.size());
+    Limbs b0 = slice(b, 0, k);
+    Limbs b1 = slice(b, k, b.size());
+
+    Limbs result(a.size() + b.size() + 1);
+    if (b1.empty()) {
+        add_shifted(result, mul_magnitudes(a0, b), 0);
+        add_shifted(result, mul_magnitudes(a1, b), k);
+    }
+    else {
+        Limbs z0 = mul_magnitudes(a0, b0);
+        Limbs z2 = mul_magnitudes(a1, b1);
+        Limbs z1 = mul_magnitudes(add_magnitudes(a0, a1), add_magnitudes(b0, b1));
+        z1 = sub_magnitudes(sub_magnitudes(z1, z0), z2);
+
+        add_shifted(result, z0, 0);
+        add_shifted(result, z1, k);
+        add_shifted(result, z2, 2 * k);
+    }
+    trim(result);
+    return result;
+}
+
+// Toom-3 evaluates the operands at negative points, so it needs signed values
+struct Signed {
+    bool negative = false;
+    Limbs magnitude;
+};
+
+static Signed make_signed(bool negative, Limbs magnitude) {
+    return {negative && !magnitude.empty(), std::move(magnitude)};
+}
+
+static Signed signed_add(bool a_negative, const Limbs &a, bool b_negative, const Limbs &b) {
+    if (a_negative == b_negative) {
+        return make_signed(a_negative, add_magnitudes(a, b));
+    }
+    if (compare_magnitudes(a, b) >= 0) {
+        return make_signed(a_negative, sub_magnitudes(a, b));
+    }
+    return make_signed(b_negative, sub_magnitudes(b, a));
+}
+
+static Signed operator+(const Signed &a, const Signed &b) {
+    return signed_add(a.negative, a.magnitude, b.negative, b.magnitude);
+}
+
+static Signed operator-(const Signed &a, const Signed &b) {
+    return signed_add(a.negative, a.magnitude, !b.negative, b.magnitude);
+}
+
+static Signed operator*(const Signed &a, const Signed &b) {
+    return make_signed(a.negative != b.negative, mul_magnitudes(a.magnitude, b.magnitude));
+}
+
+static Signed divide_exactly(const Signed &a, Limb divisor) {
+    Limb remainder;
+    return make_signed(a.negative, divmod_small(a.magnitude, divisor, remainder));
+}
+
+// Splits both operands in three parts, evaluates them at 0, 1, -1, -2 and infinity
+// and interpolates the product from the five smaller products (Bodrato's sequence)
+static Limbs mul_toom3(const Limbs &a, const Limbs &b) {
+    size_t k = (a.size() + 2) / 3;
+
+    Signed a0{false, slice(a, 0, k)};
+    Signed a1{false, slice(a, k, 2 * k)};
+    Signed a2{false, slice(a, 2 * k, a.size())};
+    Signed b0{false, slice(b, 0, k)};
+    Signed b1{false, slice(b, k, 2 * k)};
+    Signed b2{false, slice(b, 2 * k, b.size())};
+
+    Signed a02 = a0 + a2;
+    Signed a_at_1 = a02 + a1;
+    Signed a_at_minus_1 = a02 - a1;
+    Signed a_at_minus_1_plus_a2 = a_at_minus_1 + a2;
+    Signed a_at_minus_2 = a_at_minus_1_plus_a2 + a_at_minus_1_plus_a2 - a0;
+
+    Signed b02 = b0 + b2;
+    Signed b_at_1 = b02 + b1;
+    Signed b_at_minus_1 = b02 - b1;
+    Signed b_at_minus_1_plus_b2 = b_at_minus_1 + b2;
+    Signed b_at_minus_2 = b_at_minus_1_plus_b2 + b_at_minus_1_plus_b2 - b0;
+
+    Signed r0 = a0 * b0;
+    Signed r_at_1 = a_at_1 * b_at_1;
+    Signed r_at_minus_1 = a_at_minus_1 * b_at_minus_1;
+    Signed r_at_minus_2 = a_at_minus_2 * b_at_minus_2;
+    Signed r4 = a2 * b2;
+
+    Signed r3 = divide_exactly(r_at_minus_2 - r_at_1, 3);
+    Signed r1 = divide_exactly(r_at_1 - r_at_minus_1, 2);
+    Signed r2 = r_at_minus_1 - r0;
+    r3 = divide_exactly(r2 - r3, 2) + r4 + r4;
+    r2 = r2 + r1 - r4;
+    r1 = r1 - r3;
+
+    // All the coefficients of a product of non-negative polynomials are non-negative
+    Limbs result(a.size() + b.size() + 1);
+    add_shifted(result, r0.magnitude, 0);
+    add_shifted(result, r1.magnitude, k);
+    add_shifted(result, r2.magnitude, 2 * k);
+    add_shifted(result, r3.magnitude, 3 * k);
+    add_shifted(result, r4.magnitude, 4 * k);
+    trim(result);
+    return result;
+}
+
+static Limbs mul_magnitudes(const Limbs &a, const Limbs &b) {
+    if (a.size() < b.size()) {
+        return mul_magnitudes(b, a);
+    }
+    if (b.empty()) {
+        return {};
+    }
+    if (b.size() < KARATSUBA_THRESHOLD) {
+        return mul_schoolbook(a, b);
+    }
+
+    // Unbalanced operands: split the longer one into pieces of the size of the shorter
+    if (a.size() >= 2 * b.size()) {
+        Limbs result(a.size() + b.size() + 1);
+        for (size_t i = 0; i < a.size(); i += b.size()) {
+            add_shifted(result, mul_magnitudes(slice(a, i, i + b.size()), b), i);
+        }
+        trim(result);
+        return result;
+    }
+
+    if (b.size() < TOOM3_THRESHOLD || b.size() <= 2 * ((a.size() + 2) / 3)) {
+        return mul_karatsuba(a, b);
+    }
+    return mul_toom3(a, b);
+}
+
+// ------------------------------- Division -----------------------------------
+
+// Knuth's algorithm D, divisor has at least two limbs and a >= b
+static void divmod_schoolbook(const Limbs &a, const Limbs &b, Limbs &quotient, Limbs &remainder) {
+    constexpr uint64_t BASE = uint64_t(1) << 32;
+
+    // Normalize, so the top bit of the divisor is set
+    unsigned shift = __builtin_clz(b.back());
+    Limbs v = shift_left_bits(b, shift);
+    Limbs u = shift_left_bits(a, shift);
+    u.resize(a.size() + 1);
+
+    size_t n = v.size();
+    size_t m = u.size() - n - 1;
+    quotient.assign(m + 1, 0);
+
+    for (size_t j = m + 1; j-- > 0;) {
+        uint64_t numerator = (uint64_t(u[j + n]) << 32) | u[j + n - 1];
+        uint64_t qhat = numerator / v[n - 1];
+        uint64_t rhat = numerator % v[n - 1];
+        while (qhat >= BASE || qhat * v[n - 2] > ((rhat << 32) | u[j + n - 2])) {
+            qhat--;
+            rhat += v[n - 1];
+            if (rhat >= BASE) {
+                break;
+            }
+        }
+
+        // u -= qhat * v
+        int64_t borrow = 0;
+        int64_t t;
+        for (size_t i = 0; i < n; ++i) {
+            uint64_t product = qhat * v[i];
+            t = int64_t(u[i + j]) - borrow - int64_t(product & 0xffffffff);
+            u[i + j] = Limb(t);
+            borrow = int64_t(product >> 32) - (t >> 32);
+        }
+        t = int64_t(u[j + n]) - borrow;
+        u[j + n] = Limb(t);
+
+        quotient[j] = Limb(qhat);
+        // qhat was one too large, add v back
+        if (t < 0) {
+            quotient[j]--;
+            uint64_t carry = 0;
+            for (size_t i = 0; i < n; ++i) {
+                carry += uint64_t(u[i + j]) + v[i];
+                u[i + j] = Limb(carry);
+                carry >>= 32;
+            }
+            u[j + n] += Limb(carry);
+        }
+    }
+
+    trim(quotient);
+    u.resize(n);
+    remainder = shift_right_bits(u, shift);
+}
+
+static void divmod_magnitudes(const Limbs &a, const Limbs &b, Limbs &quotient, Limbs &remainder);
+
+/*
+ * floor(B^2n / d) where n is the size of d. The reciprocal of the top half of
+ * d, scaled up, is already right to about n limbs and one Newton step
+ * x += x * (B^2n - d*x) / B^2n at full size doubles that, so the sizes halve
+ * down the recursion and the whole costs a few multiplications of n limbs.
+ */
+static Limbs reciprocal(const Limbs &d) {
+    size_t n = d.size();
+
+    Limbs power(2 * n + 1);
+    power.back() = 1;
+    if (n < NEWTON_DIVISION_THRESHOLD) {
+        Limbs quotient, remainder;
+        divmod_magnitudes(power, d, quotient, remainder);
+        return quotient;
+    }
+
+    // Two guard limbs over half: the step leaves an error of a few units
+    size_t k = (n + 4) / 2;
+    Limbs x_limbs(n - k);
+    Limbs top = reciprocal(slice(d, n - k, n));
+    x_limbs.insert(x_limbs.end(), top.begin(), top.end());
+    Signed x{false, x_limbs};
+
+    Signed target{false, power};
+    Signed divisor{false, d};
+    Signed error = target - divisor * x;
+    Signed product = x * error;
+    x = x + make_signed(product.negative, slice(product.magnitude, 2 * n, product.magnitude.size()));
+
+    // Truncations leave the result a few units off
+    Signed one{false, {1}};
+    error = target - divisor * x;
+    while (error.negative) {
+        x = x - one;
+        error = error + divisor;
+    }
+    while (compare_magnitudes(error.magnitude, d) >= 0) {
+        x = x + one;
+        error = error - divisor;
+    }
+    return x.magnitude;
+}
+
+// Division with a precomputed reciprocal of the divisor, a must be less than d * B^n
+static void divmod_by_reciprocal(const Limbs &a, const Limbs &d, const Limbs &inverse, Limbs &quotient, Limbs &remainder) {
+    Limbs product = mul_magnitudes(a, inverse);
+    quotient = slice(product, 2 * d.size(), product.size());
+    // The estimate is at most 2 less than the real quotient
+    remainder = sub_magnitudes(a, mul_magnitudes(quotient, d));
+    while (compare_magnitudes(remainder, d) >= 0) {
+        remainder = sub_magnitudes(remainder, d);
+        quotient = add_magnitudes(quotient, {1});
+    }
+}
+
+// Long division in base B^n, one division by reciprocal per digit
+static void divmod_newton(const Limbs &a, const Limbs &d, const Limbs &inverse, Limbs &quotient, Limbs &remainder) {
+    size_t n = d.size();
+    size_t chunks = (a.size() + n - 1) / n;
+
+    quotient.assign(chunks * n, 0);
+    remainder.clear();
+    for (size_t chunk = chunks; chunk-- > 0;) {
+        Limbs current(a.begin() + chunk * n, a.begin() + std::min(a.size(), (chunk + 1) * n));
+        current.resize(n);
+        current.insert(current.end(), remainder.begin(), remainder.end());
+        trim(current);
+
+        Limbs chunk_quotient;
+        divmod_by_reciprocal(current, d, inverse, chunk_quotient, remainder);
+        std::copy(chunk_quotient.begin(), chunk_quotient.end(), quotient.begin() + chunk * n);
+    }
+    trim(quotient);
+}
+
+static void divmod_magnitudes(const Limbs &a, const Limbs &b, Limbs &quotient, Limbs &remainder) {
+    if (compare_magnitudes(a, b) < 0) {
+        quotient.clear();
+        remainder = a;
+    }
+    else if (b.size() == 1) {
+        Limb rest;
+        quotient = divmod_small(a, b[0], rest);
+        remainder = rest ? Limbs{rest} : Limbs{};
+    }
+    else if (b.size() >= NEWTON_DIVISION_THRESHOLD && a.size() - b.size() >= NEWTON_DIVISION_THRESHOLD) {
+        divmod_newton(a, b, reciprocal(b), quotient, remainder);
+    }
+    else {
+        divmod_schoolbook(a, b, quotient, remainder);
+    }
+}
+
+// --------------------------- Modular arithmetic -----------------------------
+
+/*
+ * Montgomery representation x * B^n mod m for an odd modulus m of n limbs.
+ * Multiplication is followed by a reduction that only needs shifts and
+ * multiplications by single limbs instead of a division.
+ */
+class Montgomery {
+public:
+    Montgomery(const Limbs &_modulus): modulus(_modulus) {
+        // m * inverse == 1 mod 2^32, each Newton step doubles the correct bits
+        Limb inverse = modulus[0];
+        for (int i = 0; i < 4; ++i) {
+            inverse *= 2 - modulus[0] * inverse;
+        }
+        minus_inverse = 0 - inverse;
+
+        Limbs r(modulus.size() + 1);
+        r.back() = 1;
+        Limbs quotient;
+        divmod_magnitudes(r, modulus, quotient, one);
+        divmod_magnitudes(mul_magnitudes(one, one), modulus, quotient, r_squared);
+    }
+
+    // x must be less than the modulus
+    Limbs to_montgomery(const Limbs &x) const {
+        return reduce(mul_magnitudes(x, r_squared));
+    }
+
+    Limbs from_montgomery(const Limbs &x) const {
+        return reduce(x);
+    }
+
+    Limbs multiply(const Limbs &a, const Limbs &b) const {
+        return reduce(mul_magnitudes(a, b));
+    }
+
+    // 1 in the Montgomery representation
+    Limbs one;
+
+private:
+    // t * B^-n mod m, t must be less than m * B^n
+    Limbs reduce(Limbs t) const {
+        size_t n = modulus.size();
+        t.resize(2 * n + 1);
+        for (size_t i = 0; i < n; ++i) {
+            // Makes the limb i of t zero
+            uint64_t multiplier = Limb(t[i] * minus_inverse);
+            uint64_t carry = 0;
+            for (size_t j = 0; j < n; ++j) {
+                carry += multiplier * modulus[j] + t[i + j];
+                t[i + j] = Limb(carry);
+                carry >>= 32;
+            }
+            for (size_t j = i + n; carry; ++j) {
+                carry += t[j];
+                t[j] = Limb(carry);
+                carry >>= 32;
+            }
+        }
+
+        Limbs result = slice(t, n, t.size());
+        if (compare_magnitudes(result, modulus) >= 0) {
+            result = sub_magnitudes(result, modulus);
+        }
+        return result;
+    }
+
+    Limbs modulus;
+    Limb minus_inverse;
+    Limbs r_squared;
+};
+
+// Left-to-right exponentiation with a 4-bit window: 4 squarings and at most one
+// multiplication for every 4 bits of the exponent
+template<typename Multiply>
+static Limbs pow_window(const Limbs &base, const Limbs &one, const BigInt &exponent, Multiply multiply) {
+    constexpr size_t WINDOW = 4;
+
+    Limbs powers[1 << WINDOW];
+    powers[0] = one;
+    for (size_t i = 1; i < (1 << WINDOW); ++i) {
+        powers[i] = multiply(powers[i - 1], base);
+    }
+
+    Limbs result = one;
+    size_t windows = (exponent.bit_length() + WINDOW - 1) / WINDOW;
+    for (size_t window = windows; window-- > 0;) {
+        if (window + 1 != windows) {
+            for (size_t i = 0; i < WINDOW; ++i) {
+                result = multiply(result, result);
+            }
+        }
+        size_t bits = 0;
+        for (size_t i = WINDOW; i-- > 0;) {
+            bits = (bits << 1) | exponent.test_bit(window * WINDOW + i);
+        }
+        if (bits) {
+            result = multiply(result, powers[bits]);
+        }
+    }
+    return result;
+}
+
+static uint64_t pow_mod_64(uint64_t base, const BigInt &exponent, uint64_t modulus) {
+    uint64_t result = 1 % modulus;
+    for (size_t bit = exponent.bit_length(); bit-- > 0;) {
+        result = (unsigned __int128)result * result % modulus;
+        if (exponent.test_bit(bit)) {
+            result = (unsigned __int128)result * base % modulus;
+        }
+    }
+    return result;
+}
+
+// ------------------------- Decimal conversions ------------------------------
+
+/*
+ * 10^(9 * 2^k) are shared by all conversions, together with their reciprocals,
+ * so converting many numbers of similar size only pays for them once.
+ */
+struct PowerOfTen {
+    Limbs value;
+
+    const Limbs &inverse() const {
+        std::call_once(inverse_computed, [this]() { inverse_value = reciprocal(value); });
+        return inverse_value;
+    }
+
+private:
+    mutable std::once_flag inverse_computed;
+    mutable Limbs inverse_value;
+};
+
+static const PowerOfTen &power_of_ten(size_t k) {
+    static std::mutex mutex;
+    static std::vector<std::unique_ptr<PowerOfTen>> powers;
+
+    std::lock_guard lock(mutex);
+    while (powers.size() <= k) {
+        auto power = std::make_unique<PowerOfTen>();
+        power->value = powers.empty() ? Limbs{DECIMAL_BASE} : mul_magnitudes(powers.back()->value, powers.back()->value);
+        powers.push_back(std::move(power));
+    }
+    return *powers[k];
+}
+
+static void divmod_power_of_ten(const Limbs &a, const PowerOfTen &power, Limbs &quotient, Limbs &remainder) {
+    if (power.value.size() >= NEWTON_DIVISION_THRESHOLD) {
+        divmod_newton(a, power.value, power.inverse(), quotient, remainder);
+    }
+    else {
+        divmod_magnitudes(a, power.value, quotient, remainder);
+    }
+}
+
+// Appends the digits of a, padded with zeros to width
+static void to_decimal(const Limbs &a, size_t width, std::string &out) {
+    if (a.size() <= DECIMAL_SPLIT_THRESHOLD) {
+        std::vector<Limb> chunks;
+        Limbs rest = a;
+        while (!rest.empty()) {
+            Limb chunk;
+            rest = divmod_small(rest, DECIMAL_BASE, chunk);
+            chunks.push_back(chunk);
+        }
+
+        std::string digits;
+        for (size_t i = chunks.size(); i-- > 0;) {
+            auto chunk = std::to_string(chunks[i]);
+            if (i + 1 != chunks.size()) {
+                digits.append(DECIMAL_BASE_DIGITS - chunk.size(), '0');
+            }
+            digits += chunk;
+        }
+        if (digits.size() < width) {
+            out.append(width - digits.size(), '0');
+        }
+        out += digits;
+        return;
+    }
+
+    // Split in halves: a = high * 10^(9 * 2^k) + low
+    size_t k = 0;
+    while (power_of_ten(k + 1).value.size() * 2 <= a.size() + 1) {
+        ++k;
+    }
+    Limbs high, low;
+    divmod_power_of_ten(a, power_of_ten(k), high, low);
+
+    size_t low_width = DECIMAL_BASE_DIGITS << k;
+    to_decimal(high, width > low_width ? width - low_width : 0, out);
+    to_decimal(low, low_width, out);
+}
+
+static Limbs from_decimal(const char *digits, size_t count) {
+    if (count <= DECIMAL_SPLIT_THRESHOLD * DECIMAL_BASE_DIGITS) {
+        Limbs result;
+        size_t chunk_size = count % DECIMAL_BASE_DIGITS ? count % DECIMAL_BASE_DIGITS : DECIMAL_BASE_DIGITS;
+        for (size_t i = 0; i < count; i += chunk_size, chunk_size = DECIMAL_BASE_DIGITS) {
+            Limb chunk = 0;
+            Limb multiplier = 1;
+            for (size_t j = i; j < i + chunk_size; ++j) {
+                chunk = chunk * 10 + (digits[j] - '0');
+                multiplier *= 10;
+            }
+            mul_add_small(result, multiplier, chunk);
+        }
+        trim(result);
+        return result;
+    }
+
+    size_t k = 0;
+    while ((DECIMAL_BASE_DIGITS << (k + 1)) < count) {
+        ++k;
+    }
+    size_t low_count = DECIMAL_BASE_DIGITS << k;
+
+    Limbs high = from_decimal(digits, count - low_count);
+    Limbs low = from_decimal(digits + count - low_count, low_count);
+    return add_magnitudes(mul_magnitudes(high, power_of_ten(k).value), low);
+}
+
+static Limbs from_power_of_two_base(const std::string &digits, unsigned bits_per_digit) {
+    Limbs result;
+    uint64_t accumulator = 0;
+    unsigned bits = 0;
+    for (size_t i = digits.size(); i-- > 0;) {
+        accumulator |= uint64_t(digits[i]) << bits;
+        bits += bits_per_digit;
+        if (bits >= 32) {
+            result.push_back(Limb(accumulator));
+            accumulator >>= 32;
+            bits -= 32;
+        }
+    }
+    result.push_back(Limb(accumulator));
+    trim(result);
+    return result;
+}
+
+// Most significant digit first, lower case letters
+static void to_power_of_two_base(const Limbs &a, unsigned bits_per_digit, std::string &out) {
+    static const char digit_chars[] = "0123456789abcdef";
+    size_t total_bits = 32 * a.size() - __builtin_clz(a.back());
+    size_t count = (total_bits + bits_per_digit - 1) / bits_per_digit;
+    Limb mask = (Limb(1) << bits_per_digit) - 1;
+
+    size_t start = out.size();
+    out.resize(start + count);
+    for (size_t i = 0; i < count; ++i) {
+        // Octal digits may straddle two limbs
+        size_t bit = i * bits_per_digit;
+        uint64_t window = a[bit / 32];
+        if (bit / 32 + 1 < a.size()) {
+            window |= uint64_t(a[bit / 32 + 1]) << 32;
+        }
+        out[start + count - 1 - i] = digit_chars[(window >> (bit % 32)) & mask];
+    }
+}
+
+// --------------------------------- BigInt -----------------------------------
+
+BigInt::BigInt(int64_t value): negative(value < 0) {
+    uint64_t magnitude = value < 0 ? 0 - uint64_t(value) : uint64_t(value);
+    while (magnitude) {
+        limbs.push_back(Limb(magnitude));
+        magnitude >>= 32;
+    }
+}
+
+BigInt::BigInt(bool _negative, Limbs _limbs)
+    : negative(_negative && !_limbs.empty()), limbs(std::move(_limbs))
+    {}
+
+BigInt BigInt::from_string(const std::string &str, int base) {
+    size_t start = 0;
+    bool negative = false;
+    if (!str.empty() && (str[0] == '-' || str[0] == '+')) {
+        negative = (str[0] == '-');
+        start = 1;
+    }
+
+    // Digit values, decimal digits are kept as characters
+    std::string digits;
+    digits.reserve(str.size() - start);
+    for (size_t i = start; i < str.size(); ++i) {
+        char c = str[i];
+        if (c == '_') {
+            continue;
+        }
+        int digit = (c >= '0' && c <= '9') ? c - '0'
+                  : (c >= 'a' && c <= 'z') ? c - 'a' + 10
+                  : (c >= 'A' && c <= 'Z') ? c - 'A' + 10
+                  : base;
+        if (digit >= base) {
+            throw std::runtime_error("Invalid literal for int() with base " + std::to_string(base) + ": '" + str + "'");
+        }
+        digits += base == 10 ? c : char(digit);
+    }
+    if (digits.empty()) {
+        throw std::runtime_error("Invalid literal for int() with base " + std::to_string(base) + ": '" + str + "'");
+    }
+
+    switch (base) {
+    case 2:
+        return BigInt(negative, from_power_of_two_base(digits, 1));
+    case 8:
+        return BigInt(negative, from_power_of_two_base(digits, 3));
+    case 16:
+        return BigInt(negative, from_power_of_two_base(digits, 4));
+    case 10:
+        return BigInt(negative, from_decimal(digits.data(), digits.size()));
+    default:
+        throw std::runtime_error("Unsupported base " + std::to_string(base));
+    }
+}
+
+std::string BigInt::to_string(int base) const {
+    if (limbs.empty()) {
+        return "0";
+    }
+    std::string result = negative ? "-" : "";
+    switch (base) {
+    case 2:
+        to_power_of_two_base(limbs, 1, result);
+        break;
+    case 8:
+        to_power_of_two_base(limbs, 3, result);
+        break;
+    case 16:
+        to_power_of_two_base(limbs, 4, result);
+        break;
+    case 10:
+        to_decimal(limbs, 0, result);
+        break;
+    default:
+        throw std::runtime_error("Unsupported base " + std::to_string(base));
+    }
+    return result;
+}
+
+bool BigInt::fits_int64() const {
+    if (limbs.size() > 2) {
+        return false;
+    }
+    uint64_t magnitude = limbs.empty() ? 0 : limbs[0] | (limbs.size() > 1 ? uint64_t(limbs[1]) << 32 : 0);
+    return negative ? magnitude <= (uint64_t(1) << 63) : magnitude < (uint64_t(1) << 63);
+}
+
+int64_t BigInt::to_int64() const {
+    uint64_t magnitude = 0;
+    if (limbs.size() > 0) {
+        magnitude |= limbs[0];
+    }
+    if (limbs.size() > 1) {
+        magnitude |= uint64_t(limbs[1]) << 32;
+    }
+    return int64_t(negative ? 0 - magnitude : magnitude);
+}
+
+double BigInt::to_double() const {
+    // The top three limbs hold more bits than a double can
+    double result = 0;
+    size_t lowest = limbs.size() > 3 ? limbs.size() - 3 : 0;
+    for (size_t i = limbs.size(); i-- > lowest;) {
+        result = result * 4294967296.0 + limbs[i];
+    }
+    result = std::ldexp(result, 32 * lowest);
+    return negative ? -result : result;
+}
+
+size_t BigInt::bit_length() const {
+    if (limbs.empty()) {
+        return 0;
+    }
+    return 32 * limbs.size() - __builtin_clz(limbs.back());
+}
+
+bool BigInt::test_bit(size_t bit) const {
+    size_t limb = bit / 32;
+    return limb < limbs.size() && ((limbs[limb] >> (bit % 32)) & 1);
+}
+
+BigInt BigInt::operator-() const {
+    return BigInt(!negative, limbs);
+}
+
+BigInt operator+(const BigInt &a, const BigInt &b) {
+    auto sum = signed_add(a.negative, a.limbs, b.negative, b.limbs);
+    return BigInt(sum.negative, std::move(sum.magnitude));
+}
+
+BigInt operator-(const BigInt &a, const BigInt &b) {
+    auto difference = signed_add(a.negative, a.limbs, !b.negative, b.limbs);
+    return BigInt(difference.negative, std::move(difference.magnitude));
+}
+
+BigInt operator*(const BigInt &a, const BigInt &b) {
+    return BigInt(a.negative != b.negative, mul_magnitudes(a.limbs, b.limbs));
+}
+
+void BigInt::floor_divmod(const BigInt &a, const BigInt &b, BigInt &quotient, BigInt &remainder) {
+    if (b.is_zero()) {
+        throw std::runtime_error("Division by zero");
+    }
+
+    Limbs quotient_limbs, remainder_limbs;
+    divmod_magnitudes(a.limbs, b.limbs, quotient_limbs, remainder_limbs);
+    quotient = BigInt(a.negative != b.negative, std::move(quotient_limbs));
+    remainder = BigInt(a.negative, std::move(remainder_limbs));
+
+    // Round the quotient down instead of towards zero
+    if (!remainder.is_zero() && a.negative != b.negative) {
+        quotient = quotient - 1;
+        remainder = remainder + b;
+    }
+}
+
+BigInt BigInt::pow(const BigInt &base, uint64_t exponent) {
+    BigInt result = 1;
+    for (int bit = 63 - __builtin_clzll(exponent | 1); bit >= 0; --bit) {
+        result = result * result;
+        if ((exponent >> bit) & 1) {
+            result = result * base;
+        }
+    }
+    return result;
+}
+
+// x^-1 mod m by the extended Euclidean algorithm, x must be in [0, m)
+static BigInt modular_inverse(const BigInt &x, const BigInt &m) {
+    BigInt old_r = x, r = m;
+    BigInt old_s = 1, s = 0;
+    while (!r.is_zero()) {
+        BigInt quotient, remainder;
+        BigInt::floor_divmod(old_r, r, quotient, remainder);
+        old_r = r;
+        r = remainder;
+        BigInt next_s = old_s - quotient * s;
+        old_s = s;
+        s = next_s;
+    }
+    if (old_r != 1) {
+        throw std::runtime_error("ValueError: base is not invertible for the given modulus");
+    }
+
+    BigInt quotient, inverse;
+    BigInt::floor_divmod(old_s, m, quotient, inverse);
+    return inverse;
+}
+
+BigInt BigInt::pow_mod(const BigInt &base, const BigInt &exponent, const BigInt &modulus) {
+    if (modulus.is_zero()) {
+        throw std::runtime_error("ValueError: pow() 3rd argument cannot be 0");
+    }
+
+    BigInt m(false, modulus.limbs);
+    BigInt quotient, reduced;
+    floor_divmod(base, m, quotient, reduced);
+    if (exponent.negative) {
+        reduced = modular_inverse(reduced, m);
+    }
+
+    Limbs result;
+    if (m.limbs.size() <= 2) {
+        uint64_t small_result = pow_mod_64(reduced.to_int64(), exponent, m.to_int64());
+        result = {Limb(small_result), Limb(small_result >> 32)};
+        trim(result);
+    }
+    else if (m.is_odd()) {
+        Montgomery montgomery(m.limbs);
+        auto multiply = [&](const Limbs &a, const Limbs &b) { return montgomery.multiply(a, b); };
+        result = montgomery.from_montgomery(
+            pow_window(montgomery.to_montgomery(reduced.limbs), montgomery.one, exponent, multiply));
+    }
+    else {
+        auto multiply = [&](const Limbs &a, const Limbs &b) {
+            Limbs quotient, remainder;
+            divmod_magnitudes(mul_magnitudes(a, b), m.limbs, quotient, remainder);
+            return remainder;
+        };
+        result = pow_window(reduced.limbs, {1}, exponent, multiply);
+    }
+
+    BigInt positive(false, std::move(result));
+    // The result has the sign of the modulus
+    if (modulus.negative && !positive.is_zero()) {
+        return positive + modulus;
+    }
+    return positive;
+}
+
+int BigInt::compare(const BigInt &a, const BigInt &b) {
+    if (a.negative != b.negative) {
+        return a.negative ? -1 : 1;
+    }
+    int magnitudes = compare_magnitudes(a.limbs, b.limbs);
+    return a.negative ? -magnitudes : magnitudes;
+}
+
+} // namespace MiniPython
@@ -0,0 +1,75 @@
+#pragma once
+
+#include <cstdint>
+#include <string>
+#include <vector>
+
+namespace MiniPython {
+
+/**
+ * @brief Arbitrary-precision integer
+ *
+ * Sign and magnitude. The magnitude is stored in 32-bit limbs, least significant
+ * first, without leading zero limbs, so zero has no limbs at all.
+ *
+ * Multiplication is schoolbook, Karatsuba or Toom-3 depending on the size of
+ * the operands, division by large numbers uses a Newton reciprocal, and decimal
+ * conversion in both directions splits the number in halves, so all of them are
+ * subquadratic.
+ */
+class BigInt {
+public:
+    using Limb = uint32_t;
+    using Limbs = std::vector<Limb>;
+
+    BigInt() = default;
+    BigInt(int64_t value);
+
+    // Digits in the given base (2, 8, 10 or 16) with an optional sign, no prefix
+    static BigInt from_string(const std::string &str, int base = 10);
+    // Same format, lower case letters
+    std::string to_string(int base = 10) const;
+
+    bool is_zero() const { return limbs.empty(); }
+    bool is_negative() const { return negative; }
+    bool is_odd() const { return !limbs.empty() && (limbs[0] & 1); }
+
+    bool fits_int64() const;
+    // Low 64 bits if the value does not fit
+    int64_t to_int64() const;
+    double to_double() const;
+
+    size_t bit_length() const;
+    bool test_bit(size_t bit) const;
+
+    BigInt operator-() const;
+
+    friend BigInt operator+(const BigInt &a, const BigInt &b);
+    friend BigInt operator-(const BigInt &a, const BigInt &b);
+    friend BigInt operator*(const BigInt &a, const BigInt &b);
+
+    // Python semantics: the quotient is rounded towards minus infinity
+    // and the remainder has the sign of the divisor
+    static void floor_divmod(const BigInt &a, const BigInt &b, BigInt &quotient, BigInt &remainder);
+
+    // Exponentiation by squaring
+    static BigInt pow(const BigInt &base, uint64_t exponent);
+    // Python's pow(base, exponent, modulus): reduces after every step, negative
+    // exponents use the modular inverse, the result has the sign of the modulus
+    static BigInt pow_mod(const BigInt &base, const BigInt &exponent, const BigInt &modulus);
+
+    // -1, 0 or 1
+    static int compare(const BigInt &a, const BigInt &b);
+
+    friend bool operator==(const BigInt &a, const BigInt &b) { return compare(a, b) == 0; }
+    friend bool operator!=(const BigInt &a, const BigInt &b) { return compare(a, b) != 0; }
+    friend bool operator<(const BigInt &a, const BigInt &b) { return compare(a, b) < 0; }
+
+private:
+    BigInt(bool _negative, Limbs _limbs);
+
+    bool negative = false;
+    Limbs limbs;
+};
+
+} // namespace MiniPython
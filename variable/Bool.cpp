@@ -44,6 +44,17 @@ Variable BoolVariable::mod(const Variable &other) {
 }
 
 Variable BoolVariable::pow(const Variable &other) {
+    // 1 ** n and 0 ** n don't need the general algorithm
+    if (other->get_type() == VariableType::INT || other->get_type() == VariableType::BOOL) {
+        auto exponent = std::dynamic_pointer_cast<IntVariable>(other->get_type() == VariableType::INT ? other : other->to_int_var());
+        if (exponent->big ? exponent->big->is_negative() : exponent->value < 0) {
+            if (!value) {
+                throw std::runtime_error("ZeroDivisionError: 0.0 cannot be raised to a negative power");
+            }
+            return NEW_FLOAT(1.0);
+        }
+        return NEW_INT(value || !exponent->to_bool() ? 1 : 0);
+    }
     return toIntVar()->pow(other);
 }
 
@@ -11,6 +11,7 @@ namespace MiniPython {
  */
 
 Bytes::Bytes(const StringType &_value): StringVariable(_value) {}
+Bytes::Bytes(StringType &&_value): StringVariable(std::move(_value)) {}
 
 VariableType Bytes::get_type() {
     return VariableType::BYTES;
@@ -21,26 +22,24 @@ Bytes::StringType Bytes::get_value() {
 }
 
 Variable Bytes::add(const Variable &other) {
-    switch (other->get_type()) {
-    case VariableType::BYTES: {
-        auto other_casted = std::dynamic_pointer_cast<Bytes>(other);
-        return std::make_shared<Bytes>(value + other_casted->value);
-    }
-    default:
+    // Anything exporting a buffer can be appended, as in Python
+    auto other_exporter = std::dynamic_pointer_cast<BufferExporter>(other);
+    if (!other_exporter) {
         throw std::runtime_error("Can't add this to bytes");
     }
+    auto other_data = other_exporter->buffer();
+
+    std::string result;
+    result.reserve(value.size() + other_data.size());
+    result += value;
+    result += other_data;
+    return std::make_shared<Bytes>(std::move(result));
 }
 
 Variable Bytes::mul(const Variable &other) {
     switch (other->get_type()) {
     case VariableType::INT: {
-        auto other_casted = std::dynamic_pointer_cast<IntVariable>(other);
-
-        std::string result = {};
-        for (IntType i = 0; i < other_casted->get_value(); ++i) {
-            result += value;
-        }
-        return std::make_shared<Bytes>(result);
+        return std::make_shared<Bytes>(repeat(value, other->to_int()));
     }
     case VariableType::BOOL: {
         auto other_casted = std::dynamic_pointer_cast<BoolVariable>(other);
@@ -52,14 +51,7 @@ Variable Bytes::mul(const Variable &other) {
 }
 
 Variable Bytes::mod(const Variable &other) {
-    if (is_tuple(other)) {
-        return NEW_BYTES(PercentFormatter(to_str()).format(VAR_TO_LIST(other)));
-    }
-    else {
-        std::vector<Variable> vec;
-        vec.push_back(other);
-        return NEW_BYTES(PercentFormatter(to_str()).format(vec));
-    }
+    return PercentFormatter(value, true).mod(other);
 }
 
 static std::string char_to_str(unsigned char ch) {
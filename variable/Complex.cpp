@@ -15,7 +15,7 @@ VariableType ComplexVariable::get_type() {
 
 ComplexVariable to_complex(const Variable &var) {
     if (var->get_type() == VariableType::INT) {
-        return ComplexVariable(std::dynamic_pointer_cast<IntVariable>(var)->value);
+        return ComplexVariable(std::dynamic_pointer_cast<IntVariable>(var)->to_float());
     }
     if (var->get_type() == VariableType::BOOL) {
         return ComplexVariable(std::dynamic_pointer_cast<BoolVariable>(var)->value ? 1 : 0);
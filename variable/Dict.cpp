@@ -54,9 +54,18 @@ ListType DictVariable::to_list() {
     return keys();
 }
 
+// str keys keep their hash, so comparing them with other keys
+// mostly stops at the hashes
+static void hash_key(const Variable &key) {
+    if (key->get_type() == VariableType::STRING) {
+        std::static_pointer_cast<StringVariable>(key)->hash();
+    }
+}
+
 Variable DictVariable::get_item_helper(Variable key) {
+    hash_key(key);
     for (auto &pair: pairs) {
-        if (key == pair.first) {
+        if (pair.first->equal(key)) {
             return pair.second;
         }
     }
@@ -77,6 +86,7 @@ Variable DictVariable::get(Variable key, Variable default_value) {
 }
 
 Variable DictVariable::set_item(Variable key, Variable value) {
+    hash_key(key);
     for (auto &pair : pairs) {
         if (pair.first->equal(key)) {
             pair.second = value;
@@ -99,6 +109,7 @@ Variable DictVariable::copy() {
 }
 
 Variable DictVariable::del_item_helper(Variable key) {
+    hash_key(key);
     for (size_t i = 0; i < pairs.size(); ++i) {
         if (pairs[i].first->equal(key)) {
             auto res = pairs[i].second;
@@ -1,4 +1,5 @@
 #include "File.h"
+#include "RaiseException.h"
 
 #include <stdexcept>
 
@@ -11,18 +12,33 @@ extern Variable execute_instruction(std::shared_ptr<Instruction> instr, Scope *s
 #define STRING(i) std::dynamic_pointer_cast<StringVariable>(VAR(i))
 #define FILE_VAR(i) std::dynamic_pointer_cast<FileVariable>(VAR(i))
 
-static Variable read_str(FILE *fh, size_t size) {
+static FILE *open_fh(const std::shared_ptr<FileVariable> &file) {
+    if (!file->fh) {
+        raise_exception("ValueError", "I/O operation on closed file.");
+    }
+    return file->fh;
+}
+
+static Variable make_str(const std::shared_ptr<FileVariable> &file, std::string &&str) {
+    if (file->binary) {
+        return NEW_BYTES(std::move(str));
+    }
+    return NEW_STRING(std::move(str));
+}
+
+static Variable read_str(const std::shared_ptr<FileVariable> &file, size_t size) {
     std::string res(size, 0);
-    int ret = fread(&res[0], 1, size, fh);
-    if (ret < 0) {
+    size_t ret = fread(&res[0], 1, size, open_fh(file));
+    if (ret < size && ferror(file->fh)) {
         throw std::runtime_error("fread error");
     }
     res.resize(ret);
-    return NEW_STRING(res);
+    return make_str(file, std::move(res));
 }
 
 static Variable read(const InstructionParams& params, Scope *scope) {
-    auto fh = FILE_VAR(0)->fh;
+    auto file = FILE_VAR(0);
+    auto fh = open_fh(file);
     if (params.size() == 1) {
         // read whole file
         auto current_pos = ftell(fh);
@@ -31,28 +47,33 @@ static Variable read(const InstructionParams& params, Scope *scope) {
         fseek(fh, current_pos, SEEK_SET);
 
         auto size = end_pos - current_pos;
-        return read_str(fh, size);
+        return read_str(file, size);
     }
 
     // read exact number of bytes
-    return read_str(fh, INT(0)->value);
+    return read_str(file, INT(1)->to_int());
 }
 
 static Variable write(const InstructionParams& params, Scope *scope) {
-    auto &str = STRING(1)->value;
-    return NEW_INT(fwrite(str.c_str(), 1, str.size(), FILE_VAR(0)->fh));
+    auto file = FILE_VAR(0);
+    auto data = VAR(1);
+    if (!file->binary && data->get_type() != VariableType::STRING) {
+        raise_exception("TypeError", "write() argument must be str, not " + data->get_class_name());
+    }
+
+    // Written straight from the exporter's memory
+    auto buffer = file->binary ? get_buffer(data) : std::string_view(VAR_TO_STR(data));
+    return NEW_INT(fwrite(buffer.data(), 1, buffer.size(), open_fh(file)));
 }
 
 static Variable readline(const InstructionParams& params, Scope *scope) {
+    auto file = FILE_VAR(0);
     char *line = NULL;
     size_t len = 0;
-    ssize_t ret = getline(&line, &len, FILE_VAR(0)->fh);
-    if (ret == -1) {
-        return NEW_STRING("");
-    }
-    std::string res(line, len);
-    delete line;
-    return NEW_STRING(res);
+    ssize_t ret = getline(&line, &len, open_fh(file));
+    std::string res = (ret == -1) ? "" : std::string(line, ret);
+    free(line);
+    return make_str(file, std::move(res));
 }
 
 static Variable readlines(const InstructionParams& params, Scope *scope) {
@@ -68,32 +89,61 @@ static Variable readlines(const InstructionParams& params, Scope *scope) {
 }
 
 static Variable tell(const InstructionParams& params, Scope *scope) {
-    return NEW_INT(ftell(FILE_VAR(0)->fh));
+    return NEW_INT(ftell(open_fh(FILE_VAR(0))));
 }
 
 static Variable flush(const InstructionParams& params, Scope *scope) {
-    fflush(FILE_VAR(0)->fh);
+    fflush(open_fh(FILE_VAR(0)));
+    return NONE;
+}
+
+static Variable close(const InstructionParams& params, Scope *scope) {
+    FILE_VAR(0)->close();
     return NONE;
 }
 
 static Variable seek(const InstructionParams& params, Scope *scope) {
     int whence = SEEK_SET;
     if (params.size() == 3) {
-        switch (INT(2)->value) {
+        switch (INT(2)->to_int()) {
         case 0: whence = SEEK_SET; break;
         case 1: whence = SEEK_CUR; break;
         case 2: whence = SEEK_END; break;
         default: throw std::runtime_error("seek: Unsupported value of whence");
         }
     }
-    return NEW_INT(fseek(FILE_VAR(0)->fh, INT(1)->value, whence));
+    return NEW_INT(fseek(open_fh(FILE_VAR(0)), INT(1)->to_int(), whence));
 }
 
+static const std::pair<const char *, FunctionType *> methods[] = {
+    {"read", read},
+    {"write", write},
+    {"readline", readline},
+    {"readlines", readlines},
+    {"tell", tell},
+    {"flush", flush},
+    {"seek", seek},
+    {"close", close},
+};
+
 FileVariable::FileVariable(const std::string &filename, const std::string &mode) :
-    fh(fopen(filename.c_str(), mode.c_str())) {}
+    fh(fopen(filename.c_str(), mode.c_str())),
+    binary(mode.find('b') != std::string::npos)
+{
+    if (!fh) {
+        raise_exception("FileNotFoundError", "No such file or directory: '" + filename + "'");
+    }
+}
 
 FileVariable::~FileVariable() {
-    fclose(fh);
+    close();
+}
+
+void FileVariable::close() {
+    if (fh) {
+        fclose(fh);
+        fh = nullptr;
+    }
 }
 
 VariableType FileVariable::get_type() {
@@ -113,4 +163,22 @@ bool FileVariable::less(const Variable &other) {
 
 bool FileVariable::strictly_equal(const Variable &other) { throw std::runtime_error("FileVariable: strictly_equal not supported"); }
 
+Variable FileVariable::get_attr(const Atom &name) {
+    for (auto &[method_name, method]: methods) {
+        if (name == method_name) {
+            return std::make_shared<FunctionVariable>(*method, shared_from_this());
+        }
+    }
+    return GenericVariable::get_attr(name);
+}
+
+bool FileVariable::has_attr(const Atom &name) {
+    for (auto &[method_name, method]: methods) {
+        if (name == method_name) {
+            return true;
+        }
+    }
+    return GenericVariable::has_attr(name);
+}
+
 } // namespace MiniPython
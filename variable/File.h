@@ -4,7 +4,7 @@
 
 namespace MiniPython {
 
-class FileVariable: public GenericVariable {
+class FileVariable: public GenericVariable, public std::enable_shared_from_this<FileVariable> {
 public:
     FileVariable(const std::string &filename, const std::string &mode);
     ~FileVariable();
@@ -18,7 +18,15 @@ public:
 
     bool strictly_equal(const Variable &other) override;
 
+    // The methods, bound to this file
+    Variable get_attr(const Atom &name) override;
+    bool has_attr(const Atom &name) override;
+
+    void close();
+
     FILE *fh;
+    // Opened with 'b': reads give bytes and writes take any bytes-like object
+    bool binary;
 };
 
 } //namespace MiniPython
@@ -1,6 +1,8 @@
 #include "Variable.h"
 
+#include <charconv>
 #include <cmath>
+#include <cstdlib>
 #include <stdexcept>
 
 namespace MiniPython {
@@ -23,7 +25,7 @@ Variable FloatVariable::add(const Variable &other) {
     switch (other->get_type()) {
     case VariableType::INT: {
         auto other_casted = std::dynamic_pointer_cast<IntVariable>(other);
-        return std::make_shared<FloatVariable>(value + other_casted->get_value());
+        return std::make_shared<FloatVariable>(value + other_casted->to_float());
     }
     case VariableType::BOOL: {
         auto other_casted = std::dynamic_pointer_cast<BoolVariable>(other);
@@ -42,7 +44,7 @@ Variable FloatVariable::sub(const Variable &other) {
     switch (other->get_type()) {
     case VariableType::INT: {
         auto other_casted = std::dynamic_pointer_cast<IntVariable>(other);
-        return std::make_shared<FloatVariable>(value - other_casted->get_value());
+        return std::make_shared<FloatVariable>(value - other_casted->to_float());
     }
     case VariableType::BOOL: {
         auto other_casted = std::dynamic_pointer_cast<BoolVariable>(other);
@@ -61,7 +63,7 @@ Variable FloatVariable::mul(const Variable &other) {
     switch (other->get_type()) {
     case VariableType::INT: {
         auto other_casted = std::dynamic_pointer_cast<IntVariable>(other);
-        return std::make_shared<FloatVariable>(value * other_casted->get_value());
+        return std::make_shared<FloatVariable>(value * other_casted->to_float());
     }
     case VariableType::BOOL: {
         auto other_casted = std::dynamic_pointer_cast<BoolVariable>(other);
@@ -80,10 +82,10 @@ Variable FloatVariable::div(const Variable &other) {
     switch (other->get_type()) {
     case VariableType::INT: {
         auto other_casted = std::dynamic_pointer_cast<IntVariable>(other);
-        if (other_casted->get_value() == 0) {
+        if (!other_casted->to_bool()) {
             throw std::runtime_error("Division by zero");
         }
-        return std::make_shared<FloatVariable>(value / other_casted->get_value());
+        return std::make_shared<FloatVariable>(value / other_casted->to_float());
     }
     case VariableType::BOOL: {
         auto other_casted = std::dynamic_pointer_cast<BoolVariable>(other);
@@ -144,20 +146,19 @@ Variable FloatVariable::mod(const Variable &other) {
 
 Variable FloatVariable::pow(const Variable &other) {
     switch (other->get_type()) {
-    case VariableType::INT: {
-        auto other_casted = std::dynamic_pointer_cast<IntVariable>(other);
-        return pow(other_casted->toFloatVar());
-    }
-    case VariableType::BOOL: {
-        auto other_casted = std::dynamic_pointer_cast<BoolVariable>(other);
-        return pow(other_casted->toFloatVar());
-    }
+    case VariableType::INT:
+    case VariableType::BOOL:
     case VariableType::FLOAT: {
-        auto other_casted = std::dynamic_pointer_cast<FloatVariable>(other);
-        if (value == 0 && other_casted->value < 0) {
+        // No temporary float for int exponents, std::pow has its own fast path for them
+        FloatType exponent = other->get_type() == VariableType::INT
+                           ? std::dynamic_pointer_cast<IntVariable>(other)->to_float()
+                           : other->get_type() == VariableType::BOOL
+                           ? other->to_int()
+                           : std::dynamic_pointer_cast<FloatVariable>(other)->value;
+        if (value == 0 && exponent < 0) {
             throw std::runtime_error("ZeroDivisionError: 0.0 cannot be raised to a negative power");
         }
-        return std::make_shared<FloatVariable>(std::pow(value, other_casted->value));
+        return std::make_shared<FloatVariable>(std::pow(value, exponent));
     }
     default:
         throw std::runtime_error("Can't raise float to power of that type");
@@ -169,17 +170,64 @@ bool FloatVariable::to_bool() {
 }
 
 std::string FloatVariable::to_str() {
-    auto str = std::to_string(value);
-    // C++ adds too many zeros in the fractional part (e.g. 123.000000 while Python uses 123.0)
-    size_t dot_pos = str.find('.');
-    size_t trailing_zero_start = str.length();
-    for (size_t i = str.length() - 1; (i >= 0) && (str[i] == '0'); --i) {
-        trailing_zero_start = i;
-    }
-    // Ensure that there is at least one digit in fractional part (e.g. 123.0, not 123)
-    size_t new_length = trailing_zero_start > dot_pos + 1 ? trailing_zero_start : trailing_zero_start + 1;
-    if (new_length < str.length()) {
-        str.resize(new_length);
+    if (std::isnan(value)) {
+        return "nan";
+    }
+    if (std::isinf(value)) {
+        return value > 0 ? "inf" : "-inf";
+    }
+
+    // Shortest digits that read back as the same double, as [-]d[.ddd]e(+|-)dd
+    char buffer[32];
+    auto end = std::to_chars(buffer, buffer + sizeof(buffer), value, std::chars_format::scientific).ptr;
+
+    const char *position = buffer;
+    bool negative = (*position == '-');
+    if (negative) {
+        ++position;
+    }
+    std::string digits;
+    for (; *position != 'e'; ++position) {
+        if (*position != '.') {
+            digits += *position;
+        }
+    }
+    ++position;
+    if (*position == '+') {
+        ++position;
+    }
+    int exponent = 0;
+    std::from_chars(position, end, exponent);
+
+    // Python's repr() switches to the exponent notation outside of [1e-4, 1e16)
+    std::string str = negative ? "-" : "";
+    int point_position = exponent + 1;
+    if (exponent < -4 || exponent >= 16) {
+        str += digits[0];
+        if (digits.size() > 1) {
+            str += '.';
+            str.append(digits, 1);
+        }
+        str += exponent < 0 ? "e-" : "e+";
+        if (std::abs(exponent) < 10) {
+            str += '0';
+        }
+        str += std::to_string(std::abs(exponent));
+    }
+    else if (point_position <= 0) {
+        str += "0.";
+        str.append(-point_position, '0');
+        str += digits;
+    }
+    else if (size_t(point_position) < digits.size()) {
+        str.append(digits, 0, point_position);
+        str += '.';
+        str.append(digits, point_position);
+    }
+    else {
+        str += digits;
+        str.append(point_position - digits.size(), '0');
+        str += ".0";
     }
     return str;
 }
@@ -188,7 +236,7 @@ bool FloatVariable::equal(const Variable &other) {
     switch (other->get_type()) {
     case VariableType::INT: {
         auto other_casted = std::dynamic_pointer_cast<IntVariable>(other);
-        return this->value == other_casted->get_value();
+        return this->value == other_casted->to_float();
     }
     case VariableType::BOOL: {
         auto other_casted = std::dynamic_pointer_cast<BoolVariable>(other);
@@ -207,7 +255,7 @@ bool FloatVariable::less(const Variable &other) {
     switch (other->get_type()) {
     case VariableType::INT: {
         auto other_casted = std::dynamic_pointer_cast<IntVariable>(other);
-        return this->value < other_casted->get_value();
+        return this->value < other_casted->to_float();
     }
     case VariableType::BOOL: {
         auto other_casted = std::dynamic_pointer_cast<BoolVariable>(other);
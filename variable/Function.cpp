@@ -9,6 +9,11 @@ FunctionVariable::FunctionVariable(FunctionType& function)
     : value(function)
     {}
 
+FunctionVariable::FunctionVariable(FunctionType& function, Variable _self)
+    : value(function)
+    , self(_self)
+    {}
+
 VariableType FunctionVariable::get_type() {
     return VariableType::FUNCTION;
 }
@@ -18,20 +23,27 @@ const FunctionType& FunctionVariable::get_value() {
 }
 
 Variable FunctionVariable::call(const InstructionParams &params, Scope *scope) {
-    return value(params, scope);
+    if (!self) {
+        return value(params, scope);
+    }
+    InstructionParams method_params;
+    method_params.reserve(params.size() + 1);
+    method_params.push_back(std::make_shared<Instruction>(self));
+    method_params.insert(method_params.end(), params.begin(), params.end());
+    return value(method_params, scope);
 }
 
 Variable FunctionVariable::call(Variable &param, Scope *scope) {
     InstructionParams params;
     params.push_back(std::make_shared<Instruction>(param));
-    return value(params, scope);
+    return call(params, scope);
 }
 
 Variable FunctionVariable::call(Variable &param1, Variable &param2, Scope *scope) {
     InstructionParams params;
     params.push_back(std::make_shared<Instruction>(param1));
     params.push_back(std::make_shared<Instruction>(param2));
-    return value(params, scope);
+    return call(params, scope);
 }
 
 std::string FunctionVariable::to_str() {
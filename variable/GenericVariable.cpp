@@ -1,27 +1,29 @@
 #include "Variable.h"
+#include "RaiseException.h"
+
+#include <stdexcept>
 
 namespace MiniPython {
 
 std::string GenericVariable::get_class_name() {
-    static std::unordered_map<VariableType, const char*> mapping = {
-        {VariableType::NONE, "NoneType"},
-        {VariableType::INT, "int"},
-        {VariableType::BOOL, "bool"},
-        {VariableType::FLOAT, "float"},
-        {VariableType::COMPLEX, "complex"},
-        {VariableType::STRING, "str"},
-        {VariableType::BYTES, "bytes"},
-        {VariableType::LIST, "list"},
-        {VariableType::ARRAY, "array"},
-        {VariableType::SET, "set"},
-        {VariableType::DICT, "dict"},
-        {VariableType::FUNCTION, "function"},
-        {VariableType::MODULE, "module"},
-    };
-
-    return mapping.find(get_type()) == mapping.end()
-         ? mapping[get_type()]
-         : "type";
+    switch (get_type()) {
+    case VariableType::NONE:     return "NoneType";
+    case VariableType::INT:      return "int";
+    case VariableType::BOOL:     return "bool";
+    case VariableType::FLOAT:    return "float";
+    case VariableType::COMPLEX:  return "complex";
+    case VariableType::STRING:   return "str";
+    case VariableType::BYTES:    return "bytes";
+    case VariableType::LIST:     return "list";
+    case VariableType::ARRAY:    return "array";
+    case VariableType::MEMORYVIEW: return "memoryview";
+    case VariableType::SET:      return "set";
+    case VariableType::DICT:     return "dict";
+    case VariableType::FUNCTION: return "function";
+    case VariableType::HASH:     return "_hashlib.HASH";
+    case VariableType::MODULE:   return "module";
+    default:                     return "type";
+    }
 }
 
 Variable GenericVariable::add(const Variable &other) {
@@ -84,16 +86,17 @@ bool GenericVariable::strictly_equal(const Variable &other) {
     throw std::runtime_error("Operation `strictly_equal` not supported");
 }
 
-Variable GenericVariable::get_attr(const std::string &name) {
-    throw std::runtime_error("get_attr() should not be called from GenericVariable");
+Variable GenericVariable::get_attr(const Atom &name) {
+    raise_exception("AttributeError", "'" + get_class_name() + "' object has no attribute '" + name.str() + "'");
+    return NONE;
 }
 
-void GenericVariable::set_attr(const std::string &name, Variable attr_value) {
-    throw std::runtime_error("set_attr() should not be called from GenericVariable");
+void GenericVariable::set_attr(const Atom &name, Variable attr_value) {
+    raise_exception("AttributeError", "'" + get_class_name() + "' object has no attribute '" + name.str() + "'");
 }
 
-bool GenericVariable::has_attr(const std::string &name) {
-    throw std::runtime_error("has_attr() should not be called from GenericVariable");
+bool GenericVariable::has_attr(const Atom &name) {
+    return false;
 }
 
 } // namespace MiniPython
@@ -2,16 +2,43 @@
 
 namespace MiniPython {
 
-Variable GenericVariableImpl::get_attr(const std::string &name) {
-    return attr[name];
+Variable GenericVariableImpl::get_attr(const Atom &name) {
+    if (attr) {
+        auto it = attr->find(name);
+        if (it != attr->end()) {
+            return it->second;
+        }
+    }
+    return GenericVariable::get_attr(name);
 }
 
-void GenericVariableImpl::set_attr(const std::string &name, Variable attr_value) {
-    attr[name] = attr_value;
+void GenericVariableImpl::set_attr(const Atom &name, Variable attr_value) {
+    if (!attr) {
+        attr = std::make_unique<std::unordered_map<Atom, Variable>>();
+    }
+    (*attr)[name] = attr_value;
 }
 
-bool GenericVariableImpl::has_attr(const std::string &name) {
-    return attr.find(name) != attr.end();
+bool GenericVariableImpl::has_attr(const Atom &name) {
+    return attr && attr->find(name) != attr->end();
+}
+
+void ModuleVariable::set_attr(const Atom &name, Variable attr_value) {
+    attr_changed = true;
+    GenericVariableImpl::set_attr(name, attr_value);
+}
+
+void ModuleVariable::reset() {
+    // Most modules are used without changing them, which needs no copy
+    if (initial_attr && attr_changed) {
+        *attr = *initial_attr;
+        attr_changed = false;
+    }
+}
+
+void ModuleVariable::save_initial_attrs() {
+    initial_attr = attr ? *attr : std::unordered_map<Atom, Variable>();
+    attr_changed = false;
 }
 
 };
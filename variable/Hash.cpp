@@ -0,0 +1,93 @@
+#include "Hash.h"
+#include "Utils.h"
+
+namespace MiniPython {
+
+extern Variable execute_instruction(std::shared_ptr<Instruction> instr, Scope *scope);
+
+#define VAR(i) execute_instruction(params[i], scope)
+#define HASH(i) std::dynamic_pointer_cast<HashVariable>(VAR(i))
+
+/*
+ * Methods
+ */
+
+static Variable update(const InstructionParams& params, Scope *scope) {
+    HASH(0)->hash->update(get_buffer(VAR(1)));
+    return NONE;
+}
+
+static Variable digest(const InstructionParams& params, Scope *scope) {
+    return NEW_BYTES(HASH(0)->hash->digest());
+}
+
+static Variable hexdigest(const InstructionParams& params, Scope *scope) {
+    return NEW_STRING(hex_encode(HASH(0)->hash->digest()));
+}
+
+static Variable copy(const InstructionParams& params, Scope *scope) {
+    return std::make_shared<HashVariable>(HASH(0)->hash->copy());
+}
+
+static const std::pair<const char *, FunctionType *> methods[] = {
+    {"update", update},
+    {"digest", digest},
+    {"hexdigest", hexdigest},
+    {"copy", copy},
+};
+
+/*
+ * Standard Variable API
+ */
+
+HashVariable::HashVariable(std::unique_ptr<Hashing::Hash> _hash)
+    : hash(std::move(_hash))
+    {}
+
+VariableType HashVariable::get_type() {
+    return VariableType::HASH;
+}
+
+std::string HashVariable::to_str() {
+    return std::string("<") + hash->name() + " _hashlib.HASH object>";
+}
+
+bool HashVariable::equal(const Variable &other) {
+    return this == other.get();
+}
+
+bool HashVariable::strictly_equal(const Variable &other) {
+    return equal(other);
+}
+
+Variable HashVariable::get_attr(const Atom &name) {
+    if (name == "name") {
+        return NEW_STRING(hash->name());
+    }
+    if (name == "digest_size") {
+        return NEW_INT(static_cast<IntType>(hash->digest_size()));
+    }
+    if (name == "block_size") {
+        return NEW_INT(static_cast<IntType>(hash->block_size()));
+    }
+    for (auto &[method_name, method]: methods) {
+        if (name == method_name) {
+            return std::make_shared<FunctionVariable>(*method, shared_from_this());
+        }
+    }
+    return GenericVariable::get_attr(name);
+}
+
+bool HashVariable::has_attr(const Atom &name) {
+    if (name == "name" || name == "digest_size" || name == "block_size") {
+        return true;
+    }
+    for (auto &[method_name, method]: methods) {
+        if (name == method_name) {
+            return true;
+        }
+    }
+    return GenericVariable::has_attr(name);
+}
+
+} // namespace MiniPython
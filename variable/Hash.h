@@ -0,0 +1,27 @@
+#pragma once
+
+#include "Variable.h"
+#include "Hashing.h"
+
+namespace MiniPython {
+
+// Hash object returned by the hashlib constructors
+class HashVariable: public GenericVariable, public std::enable_shared_from_this<HashVariable> {
+public:
+    HashVariable(std::unique_ptr<Hashing::Hash> _hash);
+
+    VariableType get_type() override;
+
+    std::string to_str() override;
+
+    bool equal(const Variable &other) override;
+    bool strictly_equal(const Variable &other) override;
+
+    // The methods, bound to this hash, and name, digest_size and block_size
+    Variable get_attr(const Atom &name) override;
+    bool has_attr(const Atom &name) override;
+
+    std::unique_ptr<Hashing::Hash> hash;
+};
+
+} // namespace MiniPython
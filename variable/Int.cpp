@@ -7,6 +7,12 @@ namespace MiniPython {
 
 IntVariable::IntVariable(IntType _value): value(_value) {}
 
+IntVariable::IntVariable(const BigInt &_value): value(_value.to_int64()) {
+    if (!_value.fits_int64()) {
+        big = std::make_shared<const BigInt>(_value);
+    }
+}
+
 VariableType IntVariable::get_type() {
     return VariableType::INT;
 }
@@ -16,14 +22,26 @@ IntType IntVariable::get_value() {
 }
 
 Variable IntVariable::toFloatVar() {
-    return std::make_shared<FloatVariable>(value);
+    return std::make_shared<FloatVariable>(to_float());
+}
+
+FloatType IntVariable::to_float() {
+    return big ? big->to_double() : value;
+}
+
+BigInt IntVariable::to_big() {
+    return big ? *big : BigInt(value);
 }
 
 Variable IntVariable::add(const Variable &other) {
     switch (other->get_type()) {
     case VariableType::INT: {
         auto other_casted = std::dynamic_pointer_cast<IntVariable>(other);
-        return std::make_shared<IntVariable>(value + other_casted->value);
+        IntType result;
+        if (!big && !other_casted->big && !__builtin_add_overflow(value, other_casted->value, &result)) {
+            return std::make_shared<IntVariable>(result);
+        }
+        return std::make_shared<IntVariable>(to_big() + other_casted->to_big());
     }
     case VariableType::BOOL: {
         auto other_casted = std::dynamic_pointer_cast<BoolVariable>(other);
@@ -31,7 +49,7 @@ Variable IntVariable::add(const Variable &other) {
     }
     case VariableType::FLOAT: {
         auto other_casted = std::dynamic_pointer_cast<FloatVariable>(other);
-        return std::make_shared<FloatVariable>(value + other_casted->get_value());
+        return std::make_shared<FloatVariable>(to_float() + other_casted->get_value());
     }
     default:
         throw std::runtime_error("Can't add this to int");
@@ -42,7 +60,11 @@ Variable IntVariable::sub(const Variable &other) {
     switch (other->get_type()) {
     case VariableType::INT: {
         auto other_casted = std::dynamic_pointer_cast<IntVariable>(other);
-        return std::make_shared<IntVariable>(value - other_casted->value);
+        IntType result;
+        if (!big && !other_casted->big && !__builtin_sub_overflow(value, other_casted->value, &result)) {
+            return std::make_shared<IntVariable>(result);
+        }
+        return std::make_shared<IntVariable>(to_big() - other_casted->to_big());
     }
     case VariableType::BOOL: {
         auto other_casted = std::dynamic_pointer_cast<BoolVariable>(other);
@@ -50,18 +72,30 @@ Variable IntVariable::sub(const Variable &other) {
     }
     case VariableType::FLOAT: {
         auto other_casted = std::dynamic_pointer_cast<FloatVariable>(other);
-        return std::make_shared<FloatVariable>(value - other_casted->get_value());
+        return std::make_shared<FloatVariable>(to_float() - other_casted->get_value());
     }
     default:
         throw std::runtime_error("Can't substract this from int");
     }
 }
 
+// The count of a sequence repetition: n * 'ab' with a big n can't be a size
+static Variable repeat_count(const IntVariable &count) {
+    if (count.is_big()) {
+        throw std::runtime_error("OverflowError: cannot fit 'int' into an index-sized integer");
+    }
+    return std::make_shared<IntVariable>(count.value);
+}
+
 Variable IntVariable::mul(const Variable &other) {
     switch (other->get_type()) {
     case VariableType::INT: {
         auto other_casted = std::dynamic_pointer_cast<IntVariable>(other);
-        return std::make_shared<IntVariable>(value * other_casted->value);
+        IntType result;
+        if (!big && !other_casted->big && !__builtin_mul_overflow(value, other_casted->value, &result)) {
+            return std::make_shared<IntVariable>(result);
+        }
+        return std::make_shared<IntVariable>(to_big() * other_casted->to_big());
     }
     case VariableType::BOOL: {
         auto other_casted = std::dynamic_pointer_cast<BoolVariable>(other);
@@ -69,15 +103,15 @@ Variable IntVariable::mul(const Variable &other) {
     }
     case VariableType::FLOAT: {
         auto other_casted = std::dynamic_pointer_cast<FloatVariable>(other);
-        return std::make_shared<FloatVariable>(value * other_casted->get_value());
+        return std::make_shared<FloatVariable>(to_float() * other_casted->get_value());
     }
     case VariableType::STRING: {
         auto other_casted = std::dynamic_pointer_cast<StringVariable>(other);
-        return other_casted->mul(std::make_shared<IntVariable>(value));
+        return other_casted->mul(repeat_count(*this));
     }
     case VariableType::LIST: {
         auto other_casted = std::dynamic_pointer_cast<ListVariable>(other);
-        return other_casted->mul(std::make_shared<IntVariable>(value));
+        return other_casted->mul(repeat_count(*this));
     }
     default:
         throw std::runtime_error("Can't multiply that with int");
@@ -88,10 +122,10 @@ Variable IntVariable::div(const Variable &other) {
     switch (other->get_type()) {
     case VariableType::INT: {
         auto other_casted = std::dynamic_pointer_cast<IntVariable>(other);
-        if (other_casted->get_value() == 0) {
+        if (!other_casted->to_bool()) {
             throw std::runtime_error("Division by zero");
         }
-        return std::make_shared<FloatVariable>((double)value / other_casted->get_value());
+        return std::make_shared<FloatVariable>(to_float() / other_casted->to_float());
     }
     case VariableType::BOOL: {
         auto other_casted = std::dynamic_pointer_cast<BoolVariable>(other);
@@ -102,7 +136,7 @@ Variable IntVariable::div(const Variable &other) {
         if (other_casted->get_value() == 0) {
             throw std::runtime_error("Division by zero");
         }
-        return std::make_shared<FloatVariable>(value / other_casted->get_value());
+        return std::make_shared<FloatVariable>(to_float() / other_casted->get_value());
     }
     default:
         throw std::runtime_error("Can't divide int by that");
@@ -113,10 +147,24 @@ Variable IntVariable::int_div(const Variable &other) {
     switch (other->get_type()) {
     case VariableType::INT: {
         auto other_casted = std::dynamic_pointer_cast<IntVariable>(other);
-        if (other_casted->get_value() == 0) {
+        if (!other_casted->to_bool()) {
             throw std::runtime_error("Division by zero");
         }
-        return std::make_shared<IntVariable>(std::floor((double)value / other_casted->get_value()));
+
+        auto x = value;
+        auto y = other_casted->value;
+        if (!big && !other_casted->big && !(x == INT64_MIN && y == -1)) {
+            IntType quotient = x / y;
+            // Round towards minus infinity
+            if (x % y != 0 && (x < 0) != (y < 0)) {
+                quotient--;
+            }
+            return std::make_shared<IntVariable>(quotient);
+        }
+
+        BigInt quotient, remainder;
+        BigInt::floor_divmod(to_big(), other_casted->to_big(), quotient, remainder);
+        return std::make_shared<IntVariable>(quotient);
     }
     case VariableType::BOOL: {
         auto other_casted = std::dynamic_pointer_cast<BoolVariable>(other);
@@ -127,7 +175,7 @@ Variable IntVariable::int_div(const Variable &other) {
         if (other_casted->get_value() == 0) {
             throw std::runtime_error("Division by zero");
         }
-        return std::make_shared<FloatVariable>(std::floor(value / other_casted->get_value()));
+        return std::make_shared<FloatVariable>(std::floor(to_float() / other_casted->get_value()));
     }
     default:
         throw std::runtime_error("Can't divide int by that");
@@ -139,13 +187,19 @@ Variable IntVariable::mod(const Variable &other) {
     case VariableType::INT: {
         auto other_casted = std::dynamic_pointer_cast<IntVariable>(other);
 
-        if (other_casted->value == 0) {
+        if (!other_casted->to_bool()) {
             throw std::runtime_error("Modulo by zero");
         }
-        // x%y = x - (x//y)*y
+
         auto x = value;
         auto y = other_casted->get_value();
+        if (big || other_casted->big || (x == INT64_MIN && y == -1)) {
+            BigInt quotient, remainder;
+            BigInt::floor_divmod(to_big(), other_casted->to_big(), quotient, remainder);
+            return std::make_shared<IntVariable>(remainder);
+        }
 
+        // x%y = x - (x//y)*y
         auto result = x - (int64_t(x / y)) * y;
 
         if (x < 0 && y > 0 && result != 0) {
@@ -169,25 +223,47 @@ Variable IntVariable::mod(const Variable &other) {
     }
 }
 
+// Exponentiation by squaring, false on overflow
+static bool checked_pow(IntType base, IntType exponent, IntType &result) {
+    result = 1;
+    while (exponent) {
+        if ((exponent & 1) && __builtin_mul_overflow(result, base, &result)) {
+            return false;
+        }
+        exponent >>= 1;
+        if (exponent && __builtin_mul_overflow(base, base, &base)) {
+            return false;
+        }
+    }
+    return true;
+}
+
 Variable IntVariable::pow(const Variable &other) {
     switch (other->get_type()) {
     case VariableType::INT: {
         auto other_casted = std::dynamic_pointer_cast<IntVariable>(other);
 
-        IntType result = 1;
-
         // Note that according to Python on my computer, 0 ** 0 == 1,
         // so it is apparently NOT a corner case
-        if (other_casted->value >= 0) {
-            // TODO: faster exponentation
-            for (size_t i = 0; i < other_casted->value; ++i) {
-                result *= this->value;
+        if (other_casted->big ? other_casted->big->is_negative() : other_casted->value < 0) {
+            return toFloatVar()->pow(other);
+        }
+        if (other_casted->big) {
+            // Only 0, 1 and -1 have powers small enough to compute
+            if (!big && (value == 0 || value == 1)) {
+                return std::make_shared<IntVariable>(value);
+            }
+            if (!big && value == -1) {
+                return std::make_shared<IntVariable>(other_casted->big->is_odd() ? -1 : 1);
             }
+            throw std::runtime_error("OverflowError: exponent too large");
         }
-        else {
-            return toFloatVar()->pow(other);
+
+        IntType result;
+        if (!big && checked_pow(value, other_casted->value, result)) {
+            return std::make_shared<IntVariable>(result);
         }
-        return std::make_shared<IntVariable>(result);
+        return std::make_shared<IntVariable>(BigInt::pow(to_big(), other_casted->value));
     }
     case VariableType::BOOL: {
         auto other_casted = std::dynamic_pointer_cast<BoolVariable>(other);
@@ -202,21 +278,27 @@ Variable IntVariable::pow(const Variable &other) {
 }
 
 bool IntVariable::to_bool() {
-    return value != 0;
+    return big || value != 0;
 }
 
 IntType IntVariable::to_int() {
+    if (big) {
+        throw std::runtime_error("OverflowError: Python int too large to convert to C long");
+    }
     return value;
 }
 
 std::string IntVariable::to_str() {
-    return std::to_string(value);
+    return big ? big->to_string() : std::to_string(value);
 }
 
 bool IntVariable::equal(const Variable &other) {
     switch (other->get_type()) {
     case VariableType::INT: {
         auto other_casted = std::dynamic_pointer_cast<IntVariable>(other);
+        if (big || other_casted->big) {
+            return to_big() == other_casted->to_big();
+        }
         return this->value == other_casted->value;
     }
     case VariableType::BOOL: {
@@ -225,7 +307,7 @@ bool IntVariable::equal(const Variable &other) {
     }
     case VariableType::FLOAT: {
         auto other_casted = std::dynamic_pointer_cast<FloatVariable>(other);
-        return this->value == other_casted->get_value();
+        return to_float() == other_casted->get_value();
     }
     default:
         return false;
@@ -236,6 +318,9 @@ bool IntVariable::less(const Variable &other) {
     switch (other->get_type()) {
     case VariableType::INT: {
         auto other_casted = std::dynamic_pointer_cast<IntVariable>(other);
+        if (big || other_casted->big) {
+            return to_big() < other_casted->to_big();
+        }
         return this->value < other_casted->value;
     }
     case VariableType::BOOL: {
@@ -244,7 +329,7 @@ bool IntVariable::less(const Variable &other) {
     }
     case VariableType::FLOAT: {
         auto other_casted = std::dynamic_pointer_cast<FloatVariable>(other);
-        return this->value < other_casted->get_value();
+        return to_float() < other_casted->get_value();
     }
     default:
         throw std::runtime_error("Can't compare float with this type");
@@ -256,7 +341,7 @@ bool IntVariable::strictly_equal(const Variable &other) {
         return false;
     }
 
-    return value == std::dynamic_pointer_cast<IntVariable>(other)->value;
+    return equal(other);
 }
 
 } // namespace MiniPython
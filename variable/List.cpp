@@ -1,6 +1,9 @@
 #include "Variable.h"
+#include "Utils.h"
+#include "RaiseException.h"
 
 #include <algorithm>
+#include <new>
 #include <stdexcept>
 
 namespace MiniPython {
@@ -19,7 +22,7 @@ Variable append(const InstructionParams& params, Scope *scope) {
 }
 
 Variable insert(const InstructionParams& params, Scope *scope) {
-    LIST(0)->list.insert(LIST(0)->list.begin() + INT(1)->value, VAR(2));
+    LIST(0)->list.insert(LIST(0)->list.begin() + INT(1)->to_int(), VAR(2));
     return NONE;
 }
 
@@ -65,13 +68,22 @@ Variable ListVariable::add(const Variable &other) {
 Variable ListVariable::mul(const Variable &other) {
     switch (other->get_type()) {
     case VariableType::INT: {
-        auto other_casted = std::dynamic_pointer_cast<IntVariable>(other);
-
         ListType result;
-        for (IntType i = 0; i < other_casted->get_value(); ++i) {
-            result.insert(result.end(), this->list.begin(), this->list.end());
+        IntType count = other->to_int();
+        if (list.empty()) {
+            return std::make_shared<ListVariable>(std::move(result));
         }
-        return std::make_shared<ListVariable>(result);
+        // Sized once, so the items are copied without reallocations
+        try {
+            result.reserve(repeated_size(list.size(), count, result.max_size()));
+        }
+        catch (const std::bad_alloc &) {
+            raise_exception("MemoryError", "");
+        }
+        for (IntType i = 0; i < count; ++i) {
+            result.insert(result.end(), list.begin(), list.end());
+        }
+        return std::make_shared<ListVariable>(std::move(result));
     }
     case VariableType::BOOL: {
         auto other_casted = std::dynamic_pointer_cast<BoolVariable>(other);
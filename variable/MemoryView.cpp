@@ -0,0 +1,150 @@
+#include "Variable.h"
+#include "RaiseException.h"
+#include "Utils.h"
+
+#include <algorithm>
+
+namespace MiniPython {
+
+extern Variable execute_instruction(std::shared_ptr<Instruction> instr, Scope *scope);
+
+#define VAR(i) execute_instruction(params[i], scope)
+#define MEMORYVIEW(i) std::dynamic_pointer_cast<MemoryView>(VAR(i))
+
+std::string_view get_buffer(const Variable &var) {
+    auto exporter = std::dynamic_pointer_cast<BufferExporter>(var);
+    if (!exporter) {
+        raise_exception("TypeError", "a bytes-like object is required, not '" + var->get_class_name() + "'");
+        return {};
+    }
+    return exporter->buffer();
+}
+
+/*
+ * Methods
+ */
+
+static Variable tobytes(const InstructionParams& params, Scope *scope) {
+    return MEMORYVIEW(0)->to_bytes_variable();
+}
+
+static Variable tolist(const InstructionParams& params, Scope *scope) {
+    return NEW_LIST(MEMORYVIEW(0)->to_list());
+}
+
+static Variable hex(const InstructionParams& params, Scope *scope) {
+    return NEW_STRING(hex_encode(MEMORYVIEW(0)->buffer()));
+}
+
+static const std::pair<const char *, FunctionType *> methods[] = {
+    {"tobytes", tobytes},
+    {"tolist", tolist},
+    {"hex", hex},
+};
+
+/*
+ * Standard Variable API
+ */
+
+MemoryView::MemoryView(Variable _exporter)
+    : exporter(_exporter)
+    , offset(0)
+    , length(get_buffer(_exporter).size())
+{
+    // A view of a view refers to the original exporter directly
+    if (auto view = std::dynamic_pointer_cast<MemoryView>(_exporter)) {
+        exporter = view->exporter;
+        offset = view->offset;
+        length = view->length;
+    }
+}
+
+MemoryView::MemoryView(Variable _exporter, size_t _offset, size_t _length)
+    : exporter(_exporter)
+    , offset(_offset)
+    , length(_length)
+    {}
+
+std::string_view MemoryView::buffer() {
+    auto data = get_buffer(exporter);
+    if (offset + length > data.size()) {
+        raise_exception("ValueError", "memoryview: underlying buffer was resized");
+    }
+    return data.substr(offset, length);
+}
+
+bool MemoryView::to_bool() {
+    return length != 0;
+}
+
+std::string MemoryView::to_str() {
+    return "<memory>";
+}
+
+ListType MemoryView::to_list() {
+    ListType result;
+    result.reserve(length);
+    for (unsigned char ch: buffer()) {
+        result.push_back(NEW_INT(ch));
+    }
+    return result;
+}
+
+Variable MemoryView::to_bytes_variable() {
+    return NEW_BYTES(std::string(buffer()));
+}
+
+bool MemoryView::equal(const Variable &other) {
+    auto other_exporter = std::dynamic_pointer_cast<BufferExporter>(other);
+    if (!other_exporter) {
+        return false;
+    }
+    return buffer() == other_exporter->buffer();
+}
+
+bool MemoryView::strictly_equal(const Variable &other) {
+    return get_type() == other->get_type() && equal(other);
+}
+
+Variable MemoryView::get_attr(const Atom &name) {
+    if (name == "nbytes") {
+        return NEW_INT(static_cast<IntType>(length));
+    }
+    if (name == "readonly") {
+        // Only arrays can be modified
+        return NEW_BOOL(exporter->get_type() != VariableType::ARRAY);
+    }
+    if (name == "obj") {
+        return exporter;
+    }
+    for (auto &[method_name, method]: methods) {
+        if (name == method_name) {
+            return std::make_shared<FunctionVariable>(*method, shared_from_this());
+        }
+    }
+    return IterableVariable::get_attr(name);
+}
+
+bool MemoryView::has_attr(const Atom &name) {
+    if (name == "nbytes" || name == "readonly" || name == "obj") {
+        return true;
+    }
+    for (auto &[method_name, method]: methods) {
+        if (name == method_name) {
+            return true;
+        }
+    }
+    return IterableVariable::has_attr(name);
+}
+
+std::shared_ptr<MemoryView> MemoryView::slice(IntType start, IntType stop) {
+    IntType size = length;
+    auto clamp = [size](IntType index) {
+        return std::clamp<IntType>(index < 0 ? index + size : index, 0, size);
+    };
+    start = clamp(start);
+    stop = std::max(start, clamp(stop));
+    return std::shared_ptr<MemoryView>(new MemoryView(exporter, offset + start, stop - start));
+}
+
+} // namespace MiniPython
@@ -1,398 +1,569 @@
 #include "Variable.h"
 #include "src/StringFormatting.h"
+#include "src/Instruction.h"
 #include "Utils.h"
+#include "TextKernels.h"
+#include "StringSearch.h"
+#include "RaiseException.h"
 
+#include <algorithm>
+#include <cstring>
+#include <optional>
 #include <stdexcept>
 
 namespace MiniPython {
 
-static bool ch_is_lower(char ch) {
-    return ('a' <= ch) && (ch <= 'z');
+static Variable encode_string(const std::string &value) {
+    return std::make_shared<MiniPython::StringVariable>(value);
 }
 
-static bool ch_is_upper(char ch) {
-    return ('A' <= ch) && (ch <= 'Z');
-}
+extern Variable execute_instruction(std::shared_ptr<Instruction> instr, Scope *scope);
 
-static bool ch_is_cased(char ch) {
-    return ch_is_lower(ch) || ch_is_upper(ch);
-}
+#define DECODE_STRING(index) std::dynamic_pointer_cast<StringVariable>(execute_instruction(params[index], scope))->value
 
-static bool ch_is_alpha(char ch) {
-    return (('a' <= ch) && (ch <= 'z')) || (('A' <= ch) && (ch <= 'Z'));
-}
+/*
+ * Character classes and case mapping
+ *
+ * str values that are not pure ASCII go through the UTF-8 variants of the
+ * kernels, bytes are always handled byte by byte.
+ */
 
-static bool ch_is_numeric(char ch) {
-    return ('0' <= ch) && (ch <= '9');
-}
+#define DECODE_SELF(index) std::dynamic_pointer_cast<StringVariable>(execute_instruction(params[index], scope))
 
-static char ch_to_lower(char ch) {
-    if (('A' <= ch) && (ch <= 'Z')) {
-        return ch + 32;
-    }
-    return ch;
+static bool is_utf8_text(const std::shared_ptr<StringVariable> &str) {
+    return (str->get_type() == VariableType::STRING) && !str->is_ascii();
 }
 
-static char ch_to_upper(char ch) {
-    if (('a' <= ch) && (ch <= 'z')) {
-        return ch - 32;
-    }
-    return ch;
+// All characters are in the allowed classes and at least one is in the required ones
+static Variable has_only(const InstructionParams& params, Scope *scope, uint8_t allowed, uint8_t required) {
+    auto str = DECODE_SELF(0);
+    uint8_t classes = (str->get_type() == VariableType::BYTES) ? TextKernels::classify(str->value)
+                    : str->is_ascii() ? TextKernels::classify_str(str->value)
+                    : TextKernels::classify_utf8(str->value);
+    return NEW_BOOL(!(classes & ~allowed) && (classes & required));
 }
 
-static Variable encode_string(const std::string &value) {
-    return std::make_shared<MiniPython::StringVariable>(value);
-}
-
-extern Variable execute_instruction(std::shared_ptr<Instruction> instr, Scope *scope);
-
-#define DECODE_STRING(index) std::dynamic_pointer_cast<StringVariable>(execute_instruction(params[index], scope))->value
-#define DECODE_INT(index) std::dynamic_pointer_cast<IntVariable>(execute_instruction(params[index], scope))->value
-
 static Variable islower(const InstructionParams& params, Scope *scope) {
-    std::string orig_value = DECODE_STRING(0);
-    bool has_cased_char = false;
-    bool has_lower_char = false;
-    for (size_t i = 0; i < orig_value.size(); ++i) {
-        char ch = orig_value[i];
-        if (ch_is_cased(ch)) {
-            has_cased_char = true;
-        }
-        if (ch_is_lower(ch)) {
-            has_lower_char = true;
-        }
-    }
-    bool res = has_cased_char && (!has_lower_char);
-    return std::make_shared<BoolVariable>(res);
+    return has_only(params, scope, ~TextKernels::UPPER, TextKernels::LOWER);
 }
 
 static Variable isupper(const InstructionParams& params, Scope *scope) {
-    std::string orig_value = DECODE_STRING(0);
-    bool has_cased_char = false;
-    bool has_upper_char = false;
-    for (size_t i = 0; i < orig_value.size(); ++i) {
-        char ch = orig_value[i];
-        if (ch_is_cased(ch)) {
-            has_cased_char = true;
-        }
-        if (ch_is_upper(ch)) {
-            has_upper_char = true;
-        }
-    }
-    bool res = has_cased_char && (!has_upper_char);
-    return std::make_shared<BoolVariable>(res);
+    return has_only(params, scope, ~TextKernels::LOWER, TextKernels::UPPER);
 }
 
 static Variable isalpha(const InstructionParams& params, Scope *scope) {
-    std::string str = DECODE_STRING(0);
-    if (str.size() == 0) {
-        return std::make_shared<BoolVariable>(false);
-    }
-    for (size_t i = 0; i < str.size(); ++i) {
-        if (!ch_is_alpha(str[i])) {
-            return std::make_shared<BoolVariable>(false);
-        }
-    }
-    return std::make_shared<BoolVariable>(true);
+    uint8_t letters = TextKernels::LOWER | TextKernels::UPPER | TextKernels::LETTER;
+    return has_only(params, scope, letters, letters);
 }
 
 static Variable isascii(const InstructionParams& params, Scope *scope) {
-    std::string str = DECODE_STRING(0);
-    if (str.size() == 0) {
-        return std::make_shared<BoolVariable>(true);
-    }
-    for (size_t i = 0; i < str.size(); ++i) {
-        if ((str[i] < 0) || (str[i] > 0xFF)) {
-            return std::make_shared<BoolVariable>(false);
-        }
-    }
-    return std::make_shared<BoolVariable>(true);
+    return NEW_BOOL(DECODE_SELF(0)->is_ascii());
 }
 
-static Variable isdecimal(const InstructionParams& params, Scope *scope) {
-    std::string str = DECODE_STRING(0);
-    if (str.size() == 0) {
-        return std::make_shared<BoolVariable>(false);
-    }
-    for (size_t i = 0; i < str.size(); ++i) {
-        if (!ch_is_numeric(str[i])) {
-            return std::make_shared<BoolVariable>(false);
-        }
-    }
-    return std::make_shared<BoolVariable>(true);
+static Variable isalnum(const InstructionParams& params, Scope *scope) {
+    uint8_t alnum = TextKernels::LOWER | TextKernels::UPPER | TextKernels::LETTER | TextKernels::DIGIT;
+    return has_only(params, scope, alnum, alnum);
 }
 
-static Variable isalnum(const InstructionParams& params, Scope *scope) {
-    std::string str = DECODE_STRING(0);
-    if (str.size() == 0) {
-        return std::make_shared<BoolVariable>(false);
+// All characters have one of the allowed Unicode numeric types, and there is one
+static Variable has_numeric_only(const InstructionParams& params, Scope *scope, uint8_t allowed) {
+    auto str = DECODE_SELF(0);
+    uint8_t types = 0;
+    if (is_utf8_text(str)) {
+        types = TextKernels::numeric_types_utf8(str->value);
     }
-    for (size_t i = 0; i < str.size(); ++i) {
-        if (!ch_is_alpha(str[i]) && !ch_is_numeric(str[i])) {
-            return std::make_shared<BoolVariable>(false);
-        }
+    else if (uint8_t classes = TextKernels::classify(str->value)) {
+        types = (classes == TextKernels::DIGIT) ? TextKernels::NUMERIC_DECIMAL : TextKernels::NUMERIC_NONE;
     }
-    return std::make_shared<BoolVariable>(true);
+    return NEW_BOOL(types && !(types & ~allowed));
+}
+
+static Variable isdecimal(const InstructionParams& params, Scope *scope) {
+    return has_numeric_only(params, scope, TextKernels::NUMERIC_DECIMAL);
 }
 
 static Variable isdigit(const InstructionParams& params, Scope *scope) {
-    return isdecimal(params, scope);
+    return has_numeric_only(params, scope, TextKernels::NUMERIC_DECIMAL | TextKernels::NUMERIC_DIGIT);
 }
 
 static Variable isnumeric(const InstructionParams& params, Scope *scope) {
-    return isdecimal(params, scope);
+    return has_numeric_only(params, scope, TextKernels::NUMERIC_DECIMAL | TextKernels::NUMERIC_DIGIT
+                                           | TextKernels::NUMERIC_OTHER);
 }
 
 static Variable isspace(const InstructionParams& params, Scope *scope) {
-    std::string str = DECODE_STRING(0);
-    if (str.size() == 0) {
-        return std::make_shared<BoolVariable>(false);
-    }
-    for (size_t i = 0; i < str.size(); ++i) {
-        if ((str[i] != ' ') && (str[i] != '\t')) {
-            return std::make_shared<BoolVariable>(false);
-        }
+    return has_only(params, scope, TextKernels::SPACE, TextKernels::SPACE);
+}
+
+// Same type as str: bytes methods return bytes
+static Variable like(const std::shared_ptr<StringVariable> &str, std::string &&value) {
+    if (str->get_type() == VariableType::BYTES) {
+        return NEW_BYTES(std::move(value));
     }
-    return std::make_shared<BoolVariable>(true);
+    return NEW_STRING(std::move(value));
+}
+
+static std::string map_case(const std::shared_ptr<StringVariable> &str, std::string_view value, TextKernels::Case mapping) {
+    return is_utf8_text(str) ? TextKernels::map_case_utf8(value, mapping) : TextKernels::map_case(value, mapping);
 }
 
 static Variable lower(const InstructionParams& params, Scope *scope) {
-    std::string orig_value = DECODE_STRING(0);
-    std::string res;
-    for (size_t i = 0; i < orig_value.size(); ++i) {
-        res += ch_to_lower(orig_value[i]);
-    }
-    return encode_string(res);
+    auto str = DECODE_SELF(0);
+    return like(str, map_case(str, str->value, TextKernels::Case::LOWER));
 }
 
 static Variable upper(const InstructionParams& params, Scope *scope) {
-    std::string orig_value = DECODE_STRING(0);
-    std::string res;
-    for (size_t i = 0; i < orig_value.size(); ++i) {
-        res += ch_to_upper(orig_value[i]);
-    }
-    return encode_string(res);
+    auto str = DECODE_SELF(0);
+    return like(str, map_case(str, str->value, TextKernels::Case::UPPER));
 }
 
 static Variable capitalize(const InstructionParams& params, Scope *scope) {
-    std::string orig_value = DECODE_STRING(0);
-    std::string res;
-    for (size_t i = 0; i < orig_value.size(); ++i) {
-        if (i == 0) {
-            res += ch_to_upper(orig_value[i]);
-        }
-        else {
-            res += ch_to_lower(orig_value[i]);
-        }
+    auto str = DECODE_SELF(0);
+    std::string_view value = str->value;
+    // Bytes of the first character
+    size_t first = std::min<size_t>(1, value.size());
+    while (is_utf8_text(str) && first < value.size() && (value[first] & 0xc0) == 0x80) {
+        ++first;
     }
-    return encode_string(res);
+    std::string result = map_case(str, value.substr(0, first), TextKernels::Case::TITLE);
+    result += map_case(str, value.substr(first), TextKernels::Case::LOWER);
+    return like(str, std::move(result));
 }
 
 static Variable swapcase(const InstructionParams& params, Scope *scope) {
-    std::string orig_value = DECODE_STRING(0);
-    std::string res;
-    for (size_t i = 0; i < orig_value.size(); ++i) {
-        char ch = orig_value[i];
-        if (ch_is_lower(ch)) {
-            res += ch_to_upper(ch);
-        }
-        else if (ch_is_upper(ch)) {
-            res += ch_to_lower(ch);
-        }
-        else {
-            res += ch;
-        }
+    auto str = DECODE_SELF(0);
+    return like(str, map_case(str, str->value, TextKernels::Case::SWAP));
+}
+
+/*
+ * Search
+ *
+ * All of them search views of the values with StringSearch, nothing is
+ * copied until the results are built.
+ */
+
+// A str argument of a str method, or bytes of a bytes method
+static std::shared_ptr<StringVariable> same_type(const std::shared_ptr<StringVariable> &str, const Variable &value) {
+    if (value->get_type() != str->get_type()) {
+        raise_exception("TypeError", "must be " + str->get_class_name() + ", not " + value->get_class_name());
+        return nullptr;
     }
+    return std::static_pointer_cast<StringVariable>(value);
+}
 
-    return encode_string(res);
+static std::shared_ptr<StringVariable> same_type_argument(const std::shared_ptr<StringVariable> &str,
+                                                          const InstructionParams& params, Scope *scope, size_t index) {
+    return same_type(str, execute_instruction(params[index], scope));
 }
 
-static std::string create_padding(const std::string &str_to_pad, int desired_len, char padding_char) {
-    int padding_len = desired_len > str_to_pad.size() ? desired_len - str_to_pad.size() : 0;
-    return std::string(padding_len, padding_char);
+// Optional argument, None when missing
+static Variable optional_argument(const InstructionParams& params, Scope *scope, size_t index) {
+    return (index < params.size()) ? execute_instruction(params[index], scope) : NONE;
 }
 
-static Variable ljust(const InstructionParams& params, Scope *scope) {
-    std::string orig_value = DECODE_STRING(0);
-    int desired_len = DECODE_INT(1);
-    char padding_char = (params.size() == 3) ? DECODE_STRING(2)[0] : ' ';
+/*
+ * The part of the string selected by the optional start and end arguments
+ * at params[index] and params[index + 1], with the rules of slices. nullopt
+ * when start is past end: then nothing is found, not even an empty string.
+ */
+static std::optional<std::string_view> search_window(std::string_view value, const InstructionParams& params,
+                                                     Scope *scope, size_t index) {
+    auto bound = [&](size_t i, IntType missing) {
+        auto arg = optional_argument(params, scope, i);
+        IntType bound = (arg->get_type() == VariableType::NONE) ? missing : arg->to_int();
+        if (bound < 0) {
+            bound += value.size();
+        }
+        return static_cast<size_t>(std::max<IntType>(bound, 0));
+    };
+    // A start past the end finds nothing, not even the empty string
+    size_t start = bound(index, 0);
+    size_t end = std::min(bound(index + 1, value.size()), value.size());
+    if (start > end) {
+        return std::nullopt;
+    }
+    return value.substr(start, end - start);
+}
 
-    std::string padding = create_padding(orig_value, desired_len, padding_char);
-    return encode_string(padding + orig_value);
+// Position in the whole string, or -1
+static IntType search(const InstructionParams& params, Scope *scope, bool reverse) {
+    auto str = DECODE_SELF(0);
+    auto needle = same_type_argument(str, params, scope, 1);
+    auto window = search_window(str->value, params, scope, 2);
+    if (!window) {
+        return -1;
+    }
+    StringSearch::Searcher searcher(needle->value);
+    size_t position = reverse ? searcher.rfind(*window) : searcher.find(*window);
+    if (position == StringSearch::npos) {
+        return -1;
+    }
+    return position + (window->data() - str->value.data());
 }
 
-static Variable rjust(const InstructionParams& params, Scope *scope) {
-    std::string orig_value = DECODE_STRING(0);
-    int desired_len = DECODE_INT(1);
-    char padding_char = (params.size() == 3) ? DECODE_STRING(2)[0] : ' ';
+static Variable find(const InstructionParams& params, Scope *scope) {
+    return NEW_INT(search(params, scope, false));
+}
 
-    std::string padding = create_padding(orig_value, desired_len, padding_char);
-    return encode_string(orig_value + padding);
+static Variable index(const InstructionParams& params, Scope *scope) {
+    IntType position = search(params, scope, false);
+    if (position < 0) {
+        raise_exception("ValueError", "substring not found");
+    }
+    return NEW_INT(position);
 }
 
-static Variable zfill(const InstructionParams& params, Scope *scope) {
-    std::string orig_value = DECODE_STRING(0);
-    int desired_len = DECODE_INT(1);
-    std::string res;
-    int start_pos = 0;
+static Variable rfind(const InstructionParams& params, Scope *scope) {
+    return NEW_INT(search(params, scope, true));
+}
 
-    if (orig_value.size() >= desired_len) {
-        return encode_string(orig_value);
+static Variable rindex(const InstructionParams& params, Scope *scope) {
+    IntType position = search(params, scope, true);
+    if (position < 0) {
+        raise_exception("ValueError", "substring not found");
+    }
+    return NEW_INT(position);
+}
+
+static Variable count(const InstructionParams& params, Scope *scope) {
+    auto str = DECODE_SELF(0);
+    auto needle = same_type_argument(str, params, scope, 1);
+    auto window = search_window(str->value, params, scope, 2);
+    return NEW_INT(window ? static_cast<IntType>(StringSearch::count(*window, needle->value)) : 0);
+}
+
+// Negative or missing counts mean all
+static size_t max_count_argument(const InstructionParams& params, Scope *scope, size_t index) {
+    auto arg = optional_argument(params, scope, index);
+    IntType count = (arg->get_type() == VariableType::NONE) ? -1 : arg->to_int();
+    return (count < 0) ? StringSearch::npos : static_cast<size_t>(count);
+}
+
+static Variable replace(const InstructionParams& params, Scope *scope) {
+    auto str = DECODE_SELF(0);
+    auto old = same_type_argument(str, params, scope, 1);
+    auto replacement = same_type_argument(str, params, scope, 2);
+    size_t max_count = max_count_argument(params, scope, 3);
+    return like(str, StringSearch::replace(str->value, old->value, replacement->value, max_count));
+}
+
+// ASCII whitespace; \x1c-\x1f are whitespace in str but not in bytes
+static bool is_split_space(char ch, bool text) {
+    return ch == ' ' || ('\t' <= ch && ch <= '\r') || (text && 0x1c <= ch && ch <= 0x1f);
+}
+
+static Variable split(const InstructionParams& params, Scope *scope) {
+    auto str = DECODE_SELF(0);
+    auto separator = optional_argument(params, scope, 1);
+    size_t max_count = max_count_argument(params, scope, 2);
+    std::string_view value = str->value;
+    ListType result;
+
+    if (separator->get_type() == VariableType::NONE) {
+        bool text = (str->get_type() == VariableType::STRING);
+        // Runs of whitespace, none at the ends
+        size_t i = 0;
+        while (true) {
+            while (i < value.size() && is_split_space(value[i], text)) {
+                ++i;
+            }
+            if (i == value.size()) {
+                break;
+            }
+            if (result.size() == max_count) {
+                // The rest as it is, trailing whitespace included
+                result.push_back(like(str, std::string(value.substr(i))));
+                break;
+            }
+            size_t start = i;
+            while (i < value.size() && !is_split_space(value[i], text)) {
+                ++i;
+            }
+            result.push_back(like(str, std::string(value.substr(start, i - start))));
+        }
+        return std::make_shared<ListVariable>(std::move(result));
     }
 
-    if ((orig_value.size() > 0) && ((orig_value[0] == '+') || (orig_value[0] == '-'))) {
-        start_pos = 1;
-        res += orig_value[0];
+    auto needle = same_type_argument(str, params, scope, 1);
+    if (needle->value.empty()) {
+        raise_exception("ValueError", "empty separator");
+        return NONE;
     }
-
-    res += create_padding(orig_value, desired_len, '0');
-    res += orig_value.substr(start_pos);
-
-    return encode_string(res);
-}
-
-bool str_starts_with(const std::string &str, const std::string &substr) {
-    if (substr.size() > str.size()) {
-        return false;
+    StringSearch::Searcher searcher(needle->value);
+    size_t start = 0;
+    for (size_t position = searcher.find(value); position != StringSearch::npos && result.size() < max_count;
+         position = searcher.find(value, start)) {
+        result.push_back(like(str, std::string(value.substr(start, position - start))));
+        start = position + needle->value.size();
     }
-    return str.rfind(substr, 0) == 0;
+    result.push_back(like(str, std::string(value.substr(start))));
+    return std::make_shared<ListVariable>(std::move(result));
 }
 
-bool str_ends_with(const std::string &str, const std::string substr) {
-    if (substr.size() > str.size()) {
-        return false;
+// (head, separator, tail) around the first or the last separator
+static Variable partition_at(const InstructionParams& params, Scope *scope, bool reverse) {
+    auto str = DECODE_SELF(0);
+    auto separator = same_type_argument(str, params, scope, 1);
+    if (separator->value.empty()) {
+        raise_exception("ValueError", "empty separator");
+        return NONE;
     }
-    return str.find(substr, str.size() - substr.size()) == str.size() - substr.size();
+    std::string_view value = str->value;
+    StringSearch::Searcher searcher(separator->value);
+    size_t position = reverse ? searcher.rfind(value) : searcher.find(value);
+    if (position == StringSearch::npos) {
+        auto empty = like(str, std::string());
+        return std::make_shared<ListVariable>(reverse ? ListType{empty, empty, str} : ListType{str, empty, empty});
+    }
+    return std::make_shared<ListVariable>(ListType{
+        like(str, std::string(value.substr(0, position))),
+        separator,
+        like(str, std::string(value.substr(position + separator->value.size()))),
+    });
 }
 
-static Variable startswith(const InstructionParams& params, Scope *scope) {
-    std::string str = DECODE_STRING(0);
-    std::string substr = DECODE_STRING(1);
-    bool res = str_starts_with(str, substr);
-    return std::make_shared<BoolVariable>(res);
+static Variable partition(const InstructionParams& params, Scope *scope) {
+    return partition_at(params, scope, false);
 }
 
-static Variable endswith(const InstructionParams& params, Scope *scope) {
-    std::string str = DECODE_STRING(0);
-    std::string substr = DECODE_STRING(1);
-    bool res = str_ends_with(str, substr);
-    return std::make_shared<BoolVariable>(res);
+static Variable rpartition(const InstructionParams& params, Scope *scope) {
+    return partition_at(params, scope, true);
 }
 
-static Variable removeprefix(const InstructionParams& params, Scope *scope) {
-    std::string str = DECODE_STRING(0);
-    std::string prefix = DECODE_STRING(1);
-    if (!str_starts_with(str, prefix)) {
-        return encode_string(str);
+/*
+ * Trimming and padding
+ *
+ * Strings are immutable, so a result with all of the input is the input
+ * object itself. Other results are built from views of the input in one
+ * allocation.
+ */
+
+// str itself when part is all of it
+static Variable same_or_part(const std::shared_ptr<StringVariable> &str, std::string_view part) {
+    if (part.size() == str->value.size()) {
+        return str;
     }
-    return encode_string(str.substr(prefix.size()));
+    return like(str, std::string(part));
 }
 
-static Variable removesuffix(const InstructionParams& params, Scope *scope) {
-    std::string str = DECODE_STRING(0);
-    std::string suffix = DECODE_STRING(1);
-    if (!str_ends_with(str, suffix)) {
-        return encode_string(str);
+// Bytes of the first and of the last character of a non-empty value
+static size_t first_char_size(std::string_view value, bool utf8) {
+    size_t size = 1;
+    while (utf8 && size < value.size() && (value[size] & 0xc0) == 0x80) {
+        ++size;
     }
-    return encode_string(str.substr(0, str.size() - suffix.size()));
+    return size;
 }
 
-bool str_contains_char(const std::string &str, char ch) {
-    return str.find(ch) != std::string::npos;
+static size_t last_char_size(std::string_view value, bool utf8) {
+    size_t size = 1;
+    while (utf8 && size < value.size() && (value[value.size() - size] & 0xc0) == 0x80) {
+        ++size;
+    }
+    return size;
 }
 
-std::string str_lstrip(const std::string &str, const std::string &chars_to_strip) {
-    int first_char_not_to_strip = -1;
-    for (size_t i = 0; i < str.size(); ++i) {
-        if (!str_contains_char(chars_to_strip, str[i])) {
-            first_char_not_to_strip = i;
-            break;
-        }
+// Length in characters
+static size_t char_count(const std::shared_ptr<StringVariable> &str) {
+    if (!is_utf8_text(str)) {
+        return str->value.size();
     }
-    if (first_char_not_to_strip == -1) {
-        return "";
-    }
-    return str.substr(first_char_not_to_strip);
+    return std::count_if(str->value.begin(), str->value.end(), [](char ch) { return (ch & 0xc0) != 0x80; });
 }
 
-std::string str_rstrip(const std::string &str, const std::string &chars_to_strip) {
-    int first_char_not_to_strip = -1;
-    for (int i = str.size() - 1; i >= 0; --i) {
-        if (!str_contains_char(chars_to_strip, str[i])) {
-            first_char_not_to_strip = i;
+/*
+ * The value without the leading and/or trailing characters found in chars,
+ * or without whitespace when chars is None. A UTF-8 character is found in
+ * chars when its bytes are: valid UTF-8 can't match in the middle of another
+ * character.
+ */
+static std::string_view strip_view(const std::shared_ptr<StringVariable> &str, const Variable &chars,
+                                   bool left, bool right) {
+    std::string_view value = str->value;
+    bool utf8 = is_utf8_text(str);
+    bool whitespace = (chars->get_type() == VariableType::NONE);
+    bool text = (str->get_type() == VariableType::STRING);
+    std::string_view set = whitespace ? std::string_view() : same_type(str, chars)->value;
+
+    auto strippable = [&](std::string_view ch) {
+        if (whitespace) {
+            return (ch.size() == 1) ? is_split_space(ch[0], text) : (TextKernels::classify_utf8(ch) == TextKernels::SPACE);
+        }
+        return (ch.size() == 1) ? (set.find(ch[0]) != std::string_view::npos)
+                                : (StringSearch::find(set, ch) != StringSearch::npos);
+    };
+
+    while (left && !value.empty()) {
+        size_t size = first_char_size(value, utf8);
+        if (!strippable(value.substr(0, size))) {
             break;
         }
+        value.remove_prefix(size);
     }
-    if (first_char_not_to_strip == -1) {
-        return "";
+    while (right && !value.empty()) {
+        size_t size = last_char_size(value, utf8);
+        if (!strippable(value.substr(value.size() - size))) {
+            break;
+        }
+        value.remove_suffix(size);
     }
-    return str.substr(0, first_char_not_to_strip);
+    return value;
+}
+
+static Variable strip_sides(const InstructionParams& params, Scope *scope, bool left, bool right) {
+    auto str = DECODE_SELF(0);
+    return same_or_part(str, strip_view(str, optional_argument(params, scope, 1), left, right));
+}
+
+static Variable strip(const InstructionParams& params, Scope *scope) {
+    return strip_sides(params, scope, true, true);
 }
 
 static Variable lstrip(const InstructionParams& params, Scope *scope) {
-    std::string str = DECODE_STRING(0);
-    std::string chars = (params.size() == 2) ? DECODE_STRING(1) : " \t";
-    return encode_string(str_lstrip(str, chars));
+    return strip_sides(params, scope, true, false);
 }
 
 static Variable rstrip(const InstructionParams& params, Scope *scope) {
-    std::string str = DECODE_STRING(0);
-    std::string chars = (params.size() == 2) ? DECODE_STRING(1) : " \t";
-    return encode_string(str_rstrip(str, chars));
+    return strip_sides(params, scope, false, true);
 }
 
-static Variable strip(const InstructionParams& params, Scope *scope) {
-    std::string str = DECODE_STRING(0);
-    std::string chars = (params.size() == 2) ? DECODE_STRING(1) : " \t";
-    return encode_string(str_lstrip(str_rstrip(str, chars), chars));
+static Variable startswith(const InstructionParams& params, Scope *scope) {
+    auto str = DECODE_SELF(0);
+    auto prefix = same_type_argument(str, params, scope, 1);
+    auto window = search_window(str->value, params, scope, 2);
+    return NEW_BOOL(window && window->substr(0, prefix->value.size()) == prefix->value);
 }
 
-static size_t _find(const InstructionParams& params, Scope *scope) {
-    std::string str = DECODE_STRING(0);
-    std::string substr = DECODE_STRING(1);
-    int start = params.size() > 2 ? DECODE_INT(2) : 0;
-    int end = params.size() > 3 ? DECODE_INT(3) : str.size();
-    return str.substr(start, end).find(substr);
+static Variable endswith(const InstructionParams& params, Scope *scope) {
+    auto str = DECODE_SELF(0);
+    auto suffix = same_type_argument(str, params, scope, 1);
+    auto window = search_window(str->value, params, scope, 2);
+    return NEW_BOOL(window && window->size() >= suffix->value.size()
+                    && window->substr(window->size() - suffix->value.size()) == suffix->value);
 }
 
-static Variable find(const InstructionParams& params, Scope *scope) {
-    size_t pos = _find(params, scope);
-    if (pos == std::string::npos) {
-        return std::make_shared<IntVariable>(-1);
+static Variable removeprefix(const InstructionParams& params, Scope *scope) {
+    auto str = DECODE_SELF(0);
+    auto prefix = same_type_argument(str, params, scope, 1);
+    std::string_view value = str->value;
+    if (value.substr(0, prefix->value.size()) == prefix->value) {
+        value.remove_prefix(prefix->value.size());
     }
-    return std::make_shared<IntVariable>(pos);
+    return same_or_part(str, value);
 }
 
-static Variable index(const InstructionParams& params, Scope *scope) {
-    size_t pos = _find(params, scope);
-    if (pos == std::string::npos) {
-        throw std::runtime_error("ValueError: index: substring not found");
+static Variable removesuffix(const InstructionParams& params, Scope *scope) {
+    auto str = DECODE_SELF(0);
+    auto suffix = same_type_argument(str, params, scope, 1);
+    std::string_view value = str->value;
+    if (value.size() >= suffix->value.size() && value.substr(value.size() - suffix->value.size()) == suffix->value) {
+        value.remove_suffix(suffix->value.size());
+    }
+    return same_or_part(str, value);
+}
+
+static char *fill_n(char *output, size_t count, std::string_view fill) {
+    if (fill.size() == 1) {
+        std::memset(output, fill[0], count);
+        return output + count;
+    }
+    for (size_t i = 0; i < count; ++i) {
+        output = std::copy(fill.begin(), fill.end(), output);
+    }
+    return output;
+}
+
+// The value with left and right fill characters around it
+static Variable pad(const std::shared_ptr<StringVariable> &str, size_t left, size_t right, std::string_view fill) {
+    if (left == 0 && right == 0) {
+        return str;
+    }
+    std::string_view value = str->value;
+    size_t size = value.size() + (left + right) * fill.size();
+    return like(str, write_string(size, [&](char *output) {
+        output = fill_n(output, left, fill);
+        output = std::copy(value.begin(), value.end(), output);
+        fill_n(output, right, fill);
+    }));
+}
+
+// Characters to add to reach the width argument, and the fill character
+static std::pair<size_t, std::string_view> padding_arguments(const std::shared_ptr<StringVariable> &str,
+                                                             const InstructionParams& params, Scope *scope) {
+    IntType width = execute_instruction(params[1], scope)->to_int();
+    std::string_view fill = " ";
+    if (params.size() > 2) {
+        auto fill_str = same_type_argument(str, params, scope, 2);
+        fill = fill_str->value;
+        if (fill.empty() || first_char_size(fill, is_utf8_text(fill_str)) != fill.size()) {
+            raise_exception("TypeError", "The fill character must be exactly one character long");
+            return {0, fill};
+        }
     }
-    return std::make_shared<IntVariable>(pos);
+    size_t length = char_count(str);
+    return {(width > static_cast<IntType>(length)) ? width - length : 0, fill};
 }
 
-static size_t _rfind(const InstructionParams& params, Scope *scope) {
-    std::string str = DECODE_STRING(0);
-    std::string substr = DECODE_STRING(1);
-    int start = params.size() > 2 ? DECODE_INT(2) : 0;
-    int end = params.size() > 3 ? DECODE_INT(3) : str.size();
-    return str.substr(start, end).rfind(substr);
+static Variable ljust(const InstructionParams& params, Scope *scope) {
+    auto str = DECODE_SELF(0);
+    auto [padding, fill] = padding_arguments(str, params, scope);
+    return pad(str, 0, padding, fill);
 }
 
-static Variable rfind(const InstructionParams& params, Scope *scope) {
-    size_t pos = _rfind(params, scope);
-    if (pos == std::string::npos) {
-        return std::make_shared<IntVariable>(-1);
-    }
-    return std::make_shared<IntVariable>(pos);
+static Variable rjust(const InstructionParams& params, Scope *scope) {
+    auto str = DECODE_SELF(0);
+    auto [padding, fill] = padding_arguments(str, params, scope);
+    return pad(str, padding, 0, fill);
 }
 
-static Variable rindex(const InstructionParams& params, Scope *scope) {
-    size_t pos = _rfind(params, scope);
-    if (pos == std::string::npos) {
-        throw std::runtime_error("ValueError: rindex: substring not found");
+static Variable center(const InstructionParams& params, Scope *scope) {
+    auto str = DECODE_SELF(0);
+    auto [padding, fill] = padding_arguments(str, params, scope);
+    // The extra character of an odd padding goes left when the width is odd
+    IntType width = padding + char_count(str);
+    size_t left = padding / 2 + (padding & width & 1);
+    return pad(str, left, padding - left, fill);
+}
+
+// Zeros after the sign
+static Variable zfill(const InstructionParams& params, Scope *scope) {
+    auto str = DECODE_SELF(0);
+    IntType width = execute_instruction(params[1], scope)->to_int();
+    size_t length = char_count(str);
+    if (width <= static_cast<IntType>(length)) {
+        return str;
+    }
+    std::string_view value = str->value;
+    size_t sign = (!value.empty() && (value[0] == '+' || value[0] == '-')) ? 1 : 0;
+    size_t size = value.size() + (width - length);
+    return like(str, write_string(size, [&](char *output) {
+        output = std::copy_n(value.begin(), sign, output);
+        output = fill_n(output, width - length, "0");
+        std::copy(value.begin() + sign, value.end(), output);
+    }));
+}
+
+/*
+ * str.format()
+ */
+
+static Variable format(const InstructionParams& params, Scope *scope) {
+    auto str = DECODE_SELF(0);
+    if (str->get_type() != VariableType::STRING) {
+        raise_exception("AttributeError", "'" + str->get_class_name() + "' object has no attribute 'format'");
+        return NONE;
+    }
+    std::vector<Variable> args;
+    std::vector<std::pair<std::string_view, Variable>> kwargs;
+    for (size_t i = 1; i < params.size(); ++i) {
+        if (params[i]->op == Operation::KWARG) {
+            kwargs.emplace_back(params[i]->params[0]->name.str(), execute_instruction(params[i]->params[1], scope));
+        }
+        else {
+            args.push_back(execute_instruction(params[i], scope));
+        }
     }
-    return std::make_shared<IntVariable>(pos);
+    return NEW_STRING(format_fields(str->value, args, kwargs));
 }
 
 /*
@@ -407,18 +578,53 @@ static Variable fromhex(const InstructionParams& params, Scope *scope) {
 
 static Variable hex(const InstructionParams& params, Scope *scope) {
     std::string str = DECODE_STRING(0);
-    std::string res;
-    for (const auto& ch: str) {
-        res += byte_to_hex(ch);
-    }
-    return encode_string(res);
-}
+    return encode_string(hex_encode(str));
+}
+
+// Bound to str and bytes objects by get_bound_attr()
+static const std::pair<const char *, FunctionType *> methods[] = {
+    {"capitalize", capitalize},
+    {"center", center},
+    {"count", count},
+    {"endswith", endswith},
+    {"find", find},
+    {"format", format},
+    {"index", index},
+    {"isalnum", isalnum},
+    {"isalpha", isalpha},
+    {"isascii", isascii},
+    {"isdecimal", isdecimal},
+    {"isdigit", isdigit},
+    {"islower", islower},
+    {"isnumeric", isnumeric},
+    {"isspace", isspace},
+    {"isupper", isupper},
+    {"ljust", ljust},
+    {"lower", lower},
+    {"lstrip", lstrip},
+    {"partition", partition},
+    {"removeprefix", removeprefix},
+    {"removesuffix", removesuffix},
+    {"replace", replace},
+    {"rfind", rfind},
+    {"rindex", rindex},
+    {"rjust", rjust},
+    {"rpartition", rpartition},
+    {"rstrip", rstrip},
+    {"split", split},
+    {"startswith", startswith},
+    {"strip", strip},
+    {"swapcase", swapcase},
+    {"upper", upper},
+    {"zfill", zfill},
+};
 
 /*
  * Standard Variable API
  */
 
 StringVariable::StringVariable(const StringType &_value): value(_value) {}
+StringVariable::StringVariable(StringType &&_value): value(std::move(_value)) {}
 
 VariableType StringVariable::get_type() {
     return VariableType::STRING;
@@ -442,13 +648,7 @@ Variable StringVariable::add(const Variable &other) {
 Variable StringVariable::mul(const Variable &other) {
     switch (other->get_type()) {
     case VariableType::INT: {
-        auto other_casted = std::dynamic_pointer_cast<IntVariable>(other);
-
-        std::string result = {};
-        for (IntType i = 0; i < other_casted->get_value(); ++i) {
-            result += value;
-        }
-        return std::make_shared<StringVariable>(result);
+        return std::make_shared<StringVariable>(repeat(value, other->to_int()));
     }
     case VariableType::BOOL: {
         auto other_casted = std::dynamic_pointer_cast<BoolVariable>(other);
@@ -460,14 +660,7 @@ Variable StringVariable::mul(const Variable &other) {
 }
 
 Variable StringVariable::mod(const Variable &other) {
-    if (is_tuple(other)) {
-        return NEW_STRING(PercentFormatter(to_str()).format(VAR_TO_LIST(other)));
-    }
-    else {
-        std::vector<Variable> vec;
-        vec.push_back(other);
-        return NEW_STRING(PercentFormatter(to_str()).format(vec));
-    }
+    return PercentFormatter(value).mod(other);
 }
 
 bool StringVariable::to_bool() {
@@ -489,7 +682,7 @@ ListType StringVariable::to_list() {
 bool StringVariable::equal(const Variable &other) {
     switch (other->get_type()) {
     case VariableType::STRING: {
-        auto other_casted = std::dynamic_pointer_cast<StringVariable>(other);
+        auto other_casted = std::static_pointer_cast<StringVariable>(other);
         return this->value == other_casted->value;
     }
     default:
@@ -516,4 +709,58 @@ bool StringVariable::strictly_equal(const Variable &other) {
     return value == std::dynamic_pointer_cast<StringVariable>(other)->value;
 }
 
+bool StringVariable::contains(const Variable &item) {
+    if (item->get_type() != get_type()) {
+        raise_exception("TypeError", "'in <" + get_class_name() + ">' requires " + get_class_name() + " as left operand, not "
+                        + item->get_class_name());
+        return false;
+    }
+    return StringSearch::find(value, std::static_pointer_cast<StringVariable>(item)->value) != StringSearch::npos;
+}
+
+bool StringVariable::has_attr(const Atom &name) {
+    for (auto &[method_name, method]: methods) {
+        if (name == method_name) {
+            return true;
+        }
+    }
+    return IterableVariable::has_attr(name);
+}
+
+Variable get_bound_attr(const Variable &object, const Atom &name) {
+    VariableType type = object->get_type();
+    if (type == VariableType::STRING || type == VariableType::BYTES) {
+        for (auto &[method_name, method]: methods) {
+            if (name == method_name) {
+                return std::make_shared<FunctionVariable>(*method, object);
+            }
+        }
+    }
+    return object->get_attr(name);
+}
+
+size_t StringVariable::hash() {
+    if (cached.load(std::memory_order_acquire) & HASH_KNOWN) {
+        return cached_hash.load(std::memory_order_relaxed);
+    }
+    size_t result = std::hash<std::string_view>()(value);
+    cached_hash.store(result, std::memory_order_relaxed);
+    cached.fetch_or(HASH_KNOWN, std::memory_order_release);
+    return result;
+}
+
+bool StringVariable::is_ascii() {
+    uint8_t flags = cached.load(std::memory_order_acquire);
+    if (flags & ASCII_KNOWN) {
+        return flags & ASCII;
+    }
+    bool result = ascii_only(value);
+    cached.fetch_or(result ? (ASCII_KNOWN | ASCII) : ASCII_KNOWN, std::memory_order_release);
+    return result;
+}
+
+void StringVariable::value_changed() {
+    cached.store(0, std::memory_order_release);
+}
+
 } // namespace MiniPython
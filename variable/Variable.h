@@ -1,7 +1,13 @@
 #pragma once
 
+#include "Atom.h"
+#include "BigInt.h"
+
+#include <atomic>
 #include <memory>
+#include <optional>
 #include <string>
+#include <string_view>
 #include <vector>
 #include <unordered_map>
 
@@ -18,10 +24,12 @@ enum class VariableType {
     BYTES,
     LIST,
     ARRAY,
+    MEMORYVIEW,
     SET,
     DICT,
     FUNCTION,
     FILE,
+    HASH,
     MODULE,
 };
 
@@ -34,7 +42,7 @@ enum class VariableType {
 #define NEW_SET(set) std::make_shared<SetVariable>(set)
 
 #define VAR_TO_BOOL(var) std::dynamic_pointer_cast<BoolVariable>(var)->value
-#define VAR_TO_INT(var) std::dynamic_pointer_cast<IntVariable>(var)->value
+#define VAR_TO_INT(var) std::dynamic_pointer_cast<IntVariable>(var)->to_int()
 #define VAR_TO_FLOAT(var) std::dynamic_pointer_cast<FloatVariable>(var)->value
 #define VAR_TO_STR(var) ((var->get_type() == VariableType::BYTES) ? VAR_TO_BYTES(var) : std::dynamic_pointer_cast<StringVariable>(var)->value)
 #define VAR_TO_BYTES(var) std::dynamic_pointer_cast<Bytes>(var)->value
@@ -70,9 +78,9 @@ public:
     virtual bool equal(const Variable &other);
     virtual bool less(const Variable &other);
 
-    virtual Variable get_attr(const std::string &name);
-    virtual void set_attr(const std::string &name, Variable attr_value);
-    virtual bool has_attr(const std::string &name);
+    virtual Variable get_attr(const Atom &name);
+    virtual void set_attr(const Atom &name, Variable attr_value);
+    virtual bool has_attr(const Atom &name);
 
     // for test purposes
     virtual bool strictly_equal(const Variable &other);
@@ -80,21 +88,42 @@ public:
 
 class GenericVariableImpl: public GenericVariable {
 public:
-    virtual Variable get_attr(const std::string &name) override;
-    virtual void set_attr(const std::string &name, Variable attr_value) override;
-    virtual bool has_attr(const std::string &name) override;
+    virtual Variable get_attr(const Atom &name) override;
+    virtual void set_attr(const Atom &name, Variable attr_value) override;
+    virtual bool has_attr(const Atom &name) override;
 
-private:
-    std::unordered_map<std::string, Variable> attr;
+protected:
+    // Created by the first set_attr(): most objects never get an attribute
+    std::unique_ptr<std::unordered_map<Atom, Variable>> attr;
 };
 
 class IterableVariable: public GenericVariableImpl {
 public:
     virtual ListType to_list() = 0;
-    bool contains(const Variable &item);
+    // The `in` operator
+    virtual bool contains(const Variable &item);
+};
+
+/**
+ * @brief Buffer protocol: objects whose contents are contiguous bytes
+ *
+ * The view stays valid while the exporter is alive and not resized.
+ */
+class BufferExporter {
+public:
+    virtual ~BufferExporter() = default;
+    virtual std::string_view buffer() = 0;
 };
 
-class NoneVariable: public GenericVariableImpl {
+// Contents of a bytes-like object, raises TypeError for anything else
+std::string_view get_buffer(const Variable &var);
+
+/*
+ * None, True and False have no attributes and are never modified,
+ * so a single instance of each is shared by all interpreters.
+ */
+
+class NoneVariable: public GenericVariable {
 public:
     VariableType get_type() override;
 
@@ -105,19 +134,27 @@ public:
     bool strictly_equal(const Variable &other) override;
 };
 
-static Variable NONE = std::make_shared<NoneVariable>();
+inline const Variable NONE = std::make_shared<NoneVariable>();
 
-class ObjectNotFoundVariable: public GenericVariableImpl {
+class ObjectNotFoundVariable: public GenericVariable {
 public:
     VariableType get_type() override;
     bool equal(const Variable &other) override;
 };
 
-static Variable OBJECT_NOT_FOUND = std::make_shared<ObjectNotFoundVariable>();
+inline const Variable OBJECT_NOT_FOUND = std::make_shared<ObjectNotFoundVariable>();
 
+/**
+ * @brief int
+ *
+ * Values that fit in IntType are kept in value, larger ones in big,
+ * so the common case never touches BigInt.
+ */
 class IntVariable: public GenericVariableImpl {
 public:
     IntVariable(IntType _value);
+    // Stored as IntType if it fits
+    IntVariable(const BigInt &_value);
 
     VariableType get_type() override;
     IntType get_value();
@@ -140,11 +177,16 @@ public:
     bool strictly_equal(const Variable &other) override;
 
     Variable toFloatVar();
+    FloatType to_float();
+    BigInt to_big();
+    bool is_big() const { return big != nullptr; }
 
+    // Low bits of the value when it is big
     IntType value;
+    std::shared_ptr<const BigInt> big;
 };
 
-class BoolVariable: public GenericVariableImpl {
+class BoolVariable: public GenericVariable {
 public:
     BoolVariable(bool _value);
 
@@ -173,8 +215,8 @@ public:
     bool value;
 };
 
-static auto TRUE = std::make_shared<BoolVariable>(true);
-static auto FALSE = std::make_shared<BoolVariable>(false);
+inline const auto TRUE = std::make_shared<BoolVariable>(true);
+inline const auto FALSE = std::make_shared<BoolVariable>(false);
 
 class FloatVariable: public GenericVariableImpl {
 public:
@@ -238,6 +280,7 @@ public:
     using StringType = std::string;
 
     StringVariable(const StringType &_value);
+    StringVariable(StringType &&_value);
 
     VariableType get_type() override;
     StringType get_value();
@@ -255,12 +298,38 @@ public:
 
     bool strictly_equal(const Variable &other) override;
 
+    // Substring search
+    bool contains(const Variable &item) override;
+
+    // The str methods; get_bound_attr() binds them to the string
+    bool has_attr(const Atom &name) override;
+
+    // Both are computed on the first call and cached; code that modifies
+    // value in place calls value_changed() afterwards
+    size_t hash();
+    bool is_ascii();
+    void value_changed();
+
     StringType value;
+
+private:
+    enum: uint8_t {
+        HASH_KNOWN = 1,
+        ASCII_KNOWN = 2,
+        ASCII = 4,
+    };
+
+    // Literals are shared by interpreters running in other threads
+    std::atomic<uint8_t> cached{0};
+    std::atomic<size_t> cached_hash{0};
 };
 
-class Bytes: public StringVariable {
+class Bytes: public StringVariable, public BufferExporter {
 public:
     Bytes(const StringType &_value);
+    Bytes(StringType &&_value);
+
+    std::string_view buffer() override { return value; }
 
     VariableType get_type() override;
     StringType get_value();
@@ -309,12 +378,90 @@ public:
 
 bool is_tuple(Variable var);
 
-class ArrayVariable: public ListVariable {
+struct ArrayTypecode;
+
+/**
+ * @brief array.array
+ *
+ * Items are packed in buffer as the C type of the typecode, the same layout
+ * CPython uses, and boxed only when they are read.
+ */
+class ArrayVariable: public IterableVariable, public BufferExporter, public std::enable_shared_from_this<ArrayVariable> {
 public:
-    ArrayVariable(Variable typecode, ListType _list);
+    ArrayVariable(Variable typecode, const ListType &initializer = {});
+
+    std::string_view buffer() override { return buffer_data; }
 
     VariableType get_type() override { return VariableType::ARRAY; }
+
+    Variable add(const Variable &other) override;
+    Variable mul(const Variable &other) override;
+
+    bool to_bool() override;
+    std::string to_str() override;
+    ListType to_list() override;
+
+    bool equal(const Variable &other) override;
+    bool strictly_equal(const Variable &other) override;
+
+    // typecode, itemsize and the methods, bound to this array
+    Variable get_attr(const Atom &name) override;
+    bool has_attr(const Atom &name) override;
+
+    char typecode() const { return code; }
+    size_t itemsize() const { return item_size; }
+    size_t size() const { return buffer_data.size() / item_size; }
+
+    Variable get_item(size_t index);
+    void set_item(size_t index, const Variable &value);
+    void append(const Variable &value);
+    // Arrays of the same typecode are copied as raw memory
+    void extend(const Variable &values);
+    void frombytes(std::string_view bytes);
+    // New items are zero
+    void resize(size_t count);
+
+    template<typename T>
+    T *items() { return reinterpret_cast<T *>(buffer_data.data()); }
+
+private:
+    const ArrayTypecode *type;
+    char code;
+    size_t item_size;
+    std::string buffer_data;
+};
+
+/**
+ * @brief memoryview: a byte range of a buffer exporter, sliced without copying
+ */
+class MemoryView: public IterableVariable, public BufferExporter, public std::enable_shared_from_this<MemoryView> {
+public:
+    MemoryView(Variable _exporter);
+
+    VariableType get_type() override { return VariableType::MEMORYVIEW; }
+    std::string_view buffer() override;
+
+    bool to_bool() override;
     std::string to_str() override;
+    ListType to_list() override;
+    Variable to_bytes_variable() override;
+
+    bool equal(const Variable &other) override;
+    bool strictly_equal(const Variable &other) override;
+
+    // nbytes, readonly and the methods, bound to this view
+    Variable get_attr(const Atom &name) override;
+    bool has_attr(const Atom &name) override;
+
+    // Python's view[start:stop] with step 1
+    std::shared_ptr<MemoryView> slice(IntType start, IntType stop);
+
+private:
+    MemoryView(Variable _exporter, size_t _offset, size_t _length);
+
+    Variable exporter;
+    size_t offset;
+    size_t length;
 };
 
 class SetVariable: public IterableVariable {
@@ -390,6 +537,8 @@ using FunctionType = Variable(const InstructionParams&, Scope *scope);
 class FunctionVariable: public GenericVariableImpl {
 public:
     FunctionVariable(FunctionType& function);
+    // A method: self is passed as the first parameter
+    FunctionVariable(FunctionType& function, Variable _self);
 
     VariableType get_type() override;
     FunctionType& get_value();
@@ -407,12 +556,29 @@ public:
     void append(const Variable &other);
 private:
     FunctionType& value;
+    Variable self;
 };
 
+// object.name, with the str and bytes methods bound to object: strings keep
+// no pointer to themselves, the caller's is used
+Variable get_bound_attr(const Variable &object, const Atom &name);
+
 class ModuleVariable: public GenericVariableImpl {
 public:
     VariableType get_type() override { return VariableType::MODULE; }
     std::string to_str() override { return "<module>"; }
+
+    void set_attr(const Atom &name, Variable attr_value) override;
+
+    // Drop changes made by a script or the host, so the module can be used by the next one
+    virtual void reset();
+    // The attributes reset() goes back to, taken once the module is set up
+    void save_initial_attrs();
+
+private:
+    // Unset until save_initial_attrs(), reset() keeps the attributes then
+    std::optional<std::unordered_map<Atom, Variable>> initial_attr;
+    bool attr_changed = false;
 };
 
 } // namespace MiniPython